@@ -25,12 +25,18 @@ SOURCES += \
     $$SRC_DIR/eles_pris.cpp \
     $$SRC_DIR/eles_hexas.cpp \
     $$SRC_DIR/eles.cpp \
+    $$SRC_DIR/eles_kernels.cpp \
+    $$SRC_DIR/opp_cache.cpp \
+    $$SRC_DIR/implicit_solver.cpp \
+    $$SRC_DIR/pmultigrid.cpp \
+    $$SRC_DIR/local_time_stepping.cpp \
     $$SRC_DIR/cuda_kernels.cu \
     $$SRC_DIR/cubature_tri.cpp \
     $$SRC_DIR/cubature_tet.cpp \
     $$SRC_DIR/cubature_quad.cpp \
     $$SRC_DIR/cubature_hexa.cpp \
     $$SRC_DIR/cubature_1d.cpp \
+    $$SRC_DIR/cubature_tables.cpp \
     $$SRC_DIR/bdy_inters.cpp \
     src/vector_structure.cpp \
     src/mesh.cpp \
@@ -64,14 +70,22 @@ HEADERS += \
     $$INCLUDE_DIR/eles_pris.h \
     $$INCLUDE_DIR/eles_hexas.h \
     $$INCLUDE_DIR/eles.h \
+    $$INCLUDE_DIR/eles_kernels.h \
+    $$INCLUDE_DIR/opp_cache.h \
+    $$INCLUDE_DIR/implicit_solver.h \
+    $$INCLUDE_DIR/pmultigrid.h \
+    $$INCLUDE_DIR/local_time_stepping.h \
     $$INCLUDE_DIR/cuda_kernels.h \
     $$INCLUDE_DIR/cubature_tri.h \
     $$INCLUDE_DIR/cubature_tet.h \
     $$INCLUDE_DIR/cubature_quad.h \
     $$INCLUDE_DIR/cubature_hexa.h \
     $$INCLUDE_DIR/cubature_1d.h \
+    $$INCLUDE_DIR/cubature_tables.h \
     $$INCLUDE_DIR/bdy_inters.h \
     $$INCLUDE_DIR/array.h \
+    $$INCLUDE_DIR/ele_array.h \
+    $$INCLUDE_DIR/inters_fpts.h \
     include/vector_structure.hpp \
     include/linear_solvers_structure.hpp \
     include/matrix_structure.hpp \
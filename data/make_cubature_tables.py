@@ -0,0 +1,90 @@
+#!/usr/bin/env python
+
+# \file make_cubature_tables.py
+# \brief Generates src/cubature_tables.cpp, the cubature rules of data/cubature_*.dat compiled into the code
+#
+# Run from the HiFiLES directory (make cubature_tables) after changing one of the data files:
+#
+#   python data/make_cubature_tables.py
+#
+# Each file holds rules headed by "<key>=<value>", followed by a label line ("locs", "locs(x)", ..., "weights")
+# before the values of each coordinate and of the weights, one value per line. The values are written out as
+# they appear in the file, so the compiler converts them exactly as atof did when the files were read at run time.
+
+import os, sys
+
+# shape, file, key of the rules in the file, number of coordinates
+shapes = [("1d",   "cubature_1d.dat",   "n_pts", 1),
+          ("tri",  "cubature_tri.dat",  "order", 2),
+          ("quad", "cubature_quad.dat", "rule",  2),
+          ("tet",  "cubature_tet.dat",  "rule",  3),
+          ("hexa", "cubature_hexa.dat", "rule",  3)]
+
+def read_rules(file_name, key, n_coords):
+  rules = []
+  blocks = None
+  for line in open(file_name):
+    words = line.split()
+    if not words:
+      continue
+    if words[0].startswith(key+"="):
+      blocks = []
+      rules.append((int(words[0][len(key)+1:]), blocks))
+    elif words[0].startswith("locs") or words[0].startswith("weights"):
+      blocks.append([])
+    else:
+      float(words[0])
+      blocks[-1].append(words[0])
+
+  for value, blocks in rules:
+    if len(blocks) != n_coords+1 or any(len(b) != len(blocks[0]) for b in blocks):
+      sys.exit("%s: rule %s=%d does not have %d coordinates and weights of equal length" % (file_name, key, value, n_coords))
+
+  return rules
+
+def write_values(out, name, values):
+  out.write("static const double %s[]={\n" % name)
+  for i in range(0, len(values), 4):
+    out.write("  " + ",".join(values[i:i+4]) + (",\n" if i+4 < len(values) else "\n"))
+  out.write("};\n")
+
+root = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+license = open(os.path.join(root, "src", "cubature_1d.cpp")).read().split("*/")[0]
+license = license.replace("cubature_1d.cpp", "cubature_tables.cpp")
+
+out = open(os.path.join(root, "src", "cubature_tables.cpp"), "w")
+out.write(license + "*/\n\n")
+out.write("// Generated by data/make_cubature_tables.py from data/cubature_*.dat, do not edit\n\n")
+out.write("#include <cstddef>\n\n#include \"../include/cubature_tables.h\"\n")
+
+for shape, file_name, key, n_coords in shapes:
+  rules = read_rules(os.path.join(root, "data", file_name), key, n_coords)
+
+  out.write("\n// %s\n\n" % file_name)
+  for value, blocks in rules:
+    write_values(out, "cubature_%s_%d_locs" % (shape, value), sum(blocks[:n_coords], []))
+    write_values(out, "cubature_%s_%d_weights" % (shape, value), blocks[n_coords])
+
+  out.write("\nstatic const cubature_table cubature_%s_tables[]={\n" % shape)
+  out.write(",\n".join("  {%d,%d,cubature_%s_%d_locs,cubature_%s_%d_weights}" % (value, len(blocks[0]), shape, value, shape, value) for value, blocks in rules))
+  out.write("\n};\n")
+
+out.write("""
+// look up rule in_key of shape in_shape
+
+const cubature_table* get_cubature_table(int in_shape, int in_key)
+{
+  const cubature_table* tables[5]={cubature_1d_tables,cubature_tri_tables,cubature_quad_tables,cubature_tet_tables,cubature_hexa_tables};
+  const int n_tables[5]={%s};
+
+  if(in_shape<0 || in_shape>4)
+    return NULL;
+
+  for(int i=0;i<n_tables[in_shape];i++)
+    if(tables[in_shape][i].key==in_key)
+      return &tables[in_shape][i];
+
+  return NULL;
+}
+""" % ",".join("(int)(sizeof(cubature_%s_tables)/sizeof(cubature_table))" % s[0] for s in shapes))
+out.close()
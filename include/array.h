@@ -39,6 +39,79 @@
 #include "cuda_runtime_api.h"
 #endif
 
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+/*! alignment of the cpu storage of arrays of arithmetic types, in bytes (one cache line) */
+#define ARRAY_ALIGN 64
+
+/*! storage smaller than this many bytes is not worth aligning, and is left to malloc so that the many small
+    arrays made by the polynomial and basis routines do not fragment the heap */
+#define ARRAY_ALIGN_MIN 1024
+
+/*! storage of at least this many bytes is aligned to a huge page and advised to use huge pages, where available */
+#define ARRAY_HUGE_PAGE 2097152
+
+/*! allocate in_bytes of aligned memory, to be released with free() */
+inline void* array_alloc_aligned(size_t in_bytes)
+{
+  void* ptr;
+  size_t align=ARRAY_ALIGN;
+
+  if(in_bytes<ARRAY_ALIGN_MIN)
+  {
+    ptr=malloc(in_bytes>0 ? in_bytes : 1);
+    if(ptr==NULL)
+      FatalError("Could not allocate array storage");
+
+    return ptr;
+  }
+
+#ifdef MADV_HUGEPAGE
+  if(in_bytes>=ARRAY_HUGE_PAGE)
+    align=ARRAY_HUGE_PAGE;
+#endif
+
+  if(posix_memalign(&ptr,align,in_bytes)!=0)
+    FatalError("Could not allocate array storage");
+
+#ifdef MADV_HUGEPAGE
+  if(align==ARRAY_HUGE_PAGE)
+    madvise(ptr,in_bytes,MADV_HUGEPAGE);
+#endif
+
+  return ptr;
+}
+
+/*! cpu storage of array<T>, new[] so that constructors of class types are run */
+template <typename T>
+struct array_storage
+{
+  static T* alloc(int in_size) { return new T[in_size]; }
+  static void release(T* in_ptr) { delete[] in_ptr; }
+};
+
+/*! aligned cpu storage for arithmetic types */
+template <typename T>
+struct array_aligned_storage
+{
+  static T* alloc(int in_size) { return (T*) array_alloc_aligned(in_size*sizeof(T)); }
+  static void release(T* in_ptr) { free(in_ptr); }
+};
+
+template <> struct array_storage<double> : array_aligned_storage<double> {};
+template <> struct array_storage<float> : array_aligned_storage<float> {};
+template <> struct array_storage<int> : array_aligned_storage<int> {};
+template <> struct array_storage<long> : array_aligned_storage<long> {};
+
+/*! number of cpu allocations made by all arrays, used to check that the time-step loop does not allocate */
+inline long& array_n_allocs(void)
+{
+  static long n_allocs=0;
+  return n_allocs;
+}
+
 
 template <typename T>
 class array
@@ -55,6 +128,10 @@ public:
 
   array(int in_dim_0, int in_dim_1=1, int in_dim_2=1, int in_dim_3=1);
 
+  // view constructor, in_data is not copied or freed by the array and must outlive it
+
+  array(T* in_data, int in_dim_0, int in_dim_1=1, int in_dim_2=1, int in_dim_3=1);
+
   // copy constructor
 
   array(const array<T>& in_array);
@@ -148,6 +225,12 @@ public:
 
 protected:
 
+  /*! allocate cpu storage for in_size elements */
+  T* alloc_cpu(int in_size);
+
+  /*! free cpu storage, unless the array is a view */
+  void free_cpu(void);
+
   int dim_0;
   int dim_1;
   int dim_2;
@@ -159,6 +242,35 @@ protected:
   int cpu_flag;
   int gpu_flag;
 
+  /*! whether cpu_data is owned by the array, false for a view */
+  bool own_cpu;
+
+};
+
+/*! fixed-size storage for the temporary arrays of a function, which are made as views of it instead of being allocated */
+template <typename T, int N>
+class array_pool
+{
+public:
+
+  array_pool() : n_used(0) {}
+
+  /*! take storage for in_size elements from the pool */
+  T* take(int in_size)
+  {
+    if(n_used+in_size>N)
+      FatalError("Array pool is too small");
+
+    T* ptr=data+n_used;
+    n_used+=in_size;
+    return ptr;
+  }
+
+private:
+
+  T data[N];
+  int n_used;
+
 };
 
 // definitions
@@ -179,10 +291,11 @@ array<T>::array()
   dim_2=1;
   dim_3=1;
 
-  cpu_data = new T[dim_0*dim_1*dim_2*dim_3];
+  cpu_data = alloc_cpu(dim_0*dim_1*dim_2*dim_3);
 
   cpu_flag=1;
   gpu_flag=0;
+  own_cpu=true;
 }
 
 // constructor 1
@@ -195,11 +308,29 @@ array<T>::array(int in_dim_0, int in_dim_1, int in_dim_2, int in_dim_3)
   dim_2=in_dim_2;
   dim_3=in_dim_3;
 
-  cpu_data = new T[dim_0*dim_1*dim_2*dim_3];
+  cpu_data = alloc_cpu(dim_0*dim_1*dim_2*dim_3);
 
 
   cpu_flag=1;
   gpu_flag=0;
+  own_cpu=true;
+}
+
+// view constructor
+
+template <typename T>
+array<T>::array(T* in_data, int in_dim_0, int in_dim_1, int in_dim_2, int in_dim_3)
+{
+  dim_0=in_dim_0;
+  dim_1=in_dim_1;
+  dim_2=in_dim_2;
+  dim_3=in_dim_3;
+
+  cpu_data = in_data;
+
+  cpu_flag=1;
+  gpu_flag=0;
+  own_cpu=false;
 }
 
 // copy constructor
@@ -214,12 +345,16 @@ array<T>::array(const array<T>& in_array)
   dim_2=in_array.dim_2;
   dim_3=in_array.dim_3;
 
-  cpu_data = new T[dim_0*dim_1*dim_2*dim_3];
+  cpu_data = alloc_cpu(dim_0*dim_1*dim_2*dim_3);
+  own_cpu=true;
 
   for(i=0; i<dim_0*dim_1*dim_2*dim_3; i++)
     {
       cpu_data[i]=in_array.cpu_data[i];
     }
+
+  cpu_flag=1;
+  gpu_flag=0;
 }
 
 // assignment
@@ -235,14 +370,15 @@ array<T>& array<T>::operator=(const array<T>& in_array)
     }
   else
     {
-      delete[] cpu_data;
+      free_cpu();
 
       dim_0=in_array.dim_0;
       dim_1=in_array.dim_1;
       dim_2=in_array.dim_2;
       dim_3=in_array.dim_3;
 
-      cpu_data = new T[dim_0*dim_1*dim_2*dim_3];
+      cpu_data = alloc_cpu(dim_0*dim_1*dim_2*dim_3);
+      own_cpu=true;
       //NOTE: THIS COPIES POINTERS; NOT VALUES
       for(i=0; i<dim_0*dim_1*dim_2*dim_3; i++)
         {
@@ -261,7 +397,7 @@ array<T>& array<T>::operator=(const array<T>& in_array)
 template <typename T>
 array<T>::~array()
 {
-  delete[] cpu_data;
+  free_cpu();
   // do we need to deallocate gpu memory here as well?
 }
 
@@ -272,18 +408,39 @@ array<T>::~array()
 template <typename T>
 void array<T>::setup(int in_dim_0, int in_dim_1, int in_dim_2, int in_dim_3)
 {
-  delete[] cpu_data;
+  free_cpu();
 
   dim_0=in_dim_0;
   dim_1=in_dim_1;
   dim_2=in_dim_2;
   dim_3=in_dim_3;
 
-  cpu_data=new T[dim_0*dim_1*dim_2*dim_3];
+  cpu_data=alloc_cpu(dim_0*dim_1*dim_2*dim_3);
+  own_cpu=true;
   cpu_flag=1;
   gpu_flag=0;
 }
 
+// allocate cpu storage
+
+template <typename T>
+T* array<T>::alloc_cpu(int in_size)
+{
+#pragma omp atomic
+  array_n_allocs()++;
+
+  return array_storage<T>::alloc(in_size);
+}
+
+// free cpu storage
+
+template <typename T>
+void array<T>::free_cpu(void)
+{
+  if(own_cpu)
+    array_storage<T>::release(cpu_data);
+}
+
 template <typename T>
 T& array<T>::operator()(int in_pos_0)
 {
@@ -488,8 +645,9 @@ void array<T>::mv_cpu_gpu(void)
   cudaMalloc((void**) &gpu_data,dim_0*dim_1*dim_2*dim_3*sizeof(T));
   cudaMemcpy(gpu_data,cpu_data,dim_0*dim_1*dim_2*dim_3*sizeof(T),cudaMemcpyHostToDevice);
 
-  delete[] cpu_data;
-  cpu_data = new T[1];
+  free_cpu();
+  cpu_data = alloc_cpu(1);
+  own_cpu=true;
 
   cpu_flag=0;
   gpu_flag=1;
@@ -507,8 +665,9 @@ void array<T>::mv_gpu_cpu(void)
 #ifdef _GPU
 
   check_cuda_error("mv_gpu_cpu before",__FILE__, __LINE__);
-  delete[] cpu_data;
-  cpu_data = new T[dim_0*dim_1*dim_2*dim_3];
+  free_cpu();
+  cpu_data = alloc_cpu(dim_0*dim_1*dim_2*dim_3);
+  own_cpu=true;
 
   cudaMemcpy(cpu_data,gpu_data,dim_0*dim_1*dim_2*dim_3*sizeof(T),cudaMemcpyDeviceToHost);
   cudaFree(gpu_data);
@@ -536,7 +695,8 @@ void array<T>::cp_gpu_cpu(void)
 
   if (cpu_flag==0)
     {
-      cpu_data = new T[dim_0*dim_1*dim_2*dim_3];
+      cpu_data = alloc_cpu(dim_0*dim_1*dim_2*dim_3);
+      own_cpu=true;
       cpu_flag=1;
     }
 
@@ -578,8 +738,9 @@ void array<T>::rm_cpu(void)
 #ifdef _GPU
 
   check_cuda_error("rm_cpu before",__FILE__, __LINE__);
-  delete[] cpu_data;
-  cpu_data = new T[1];
+  free_cpu();
+  cpu_data = alloc_cpu(1);
+  own_cpu=true;
 
   cpu_flag=0;
   check_cuda_error("rm_cpu after",__FILE__, __LINE__);
@@ -57,11 +57,20 @@ public:
   /*! Set bdy interface */
   void set_boundary(int in_inter, int bdy_type, int in_ele_type_l, int in_ele_l, int in_local_inter_l, struct solution* FlowSol);
 
-  /*! Compute right hand side state at boundaries */
-  void set_inv_boundary_conditions(int bdy_type, double* u_l, double* u_r, double* v_g, double *norm, double *loc, double *bdy_params, int n_dims, int n_fields, double gamma, double R_ref, double time_bound, int equation);
+  /*! group the interfaces by boundary type, once all are set */
+  void set_bdy_groups(void);
 
-  /*! Compute right hand side gradient at boundaries */
-  void set_vis_boundary_conditions(int bdy_type, double* u_l, double* u_r, double* grad_u, double *norm, double *loc, double *bdy_params, int n_dims, int n_fields, double gamma, double R_ref, double time_bound, int equation);
+  /*! sort the in_n_list boundary interfaces of in_list by boundary type, keeping their order within a type */
+  void sort_by_bdy_type(int in_n_list, int* in_list);
+
+  /*! Compute right hand side state (batch_u_r) at the in_n_pts flux points of the batch buffers, all on boundaries of type in_bdy_type */
+  void set_inv_boundary_conditions_batch(int in_bdy_type, int in_n_pts);
+
+  /*! Compute right hand side gradient (batch_grad_u_r) at the in_n_pts flux points of the batch buffers, all on boundaries of type in_bdy_type */
+  void set_vis_boundary_conditions_batch(int in_bdy_type, int in_n_pts);
+
+  /*! Compute common inviscid flux, and common solution when viscous, at the in_n_pts flux points of the batch buffers, all on boundaries of type in_bdy_type */
+  void calc_bdy_invFlux_batch(int in_bdy_type, int in_n_pts);
 
   /*! move all from cpu to gpu */
   void mv_all_cpu_gpu(void);
@@ -69,12 +78,18 @@ public:
   /*! calculate normal transformed continuous inviscid flux at the flux points on boundaries*/
   void evaluate_boundaryConditions_invFlux(double time_bound);
 
+  /*! calculate normal transformed continuous inviscid flux at the flux points of the in_n_list boundary interfaces of in_list */
+  void evaluate_boundaryConditions_invFlux(double time_bound, int in_n_list, int* in_list);
+
   /*! calculate delta in transformed discontinuous solution at flux points */
   void calc_delta_disu_fpts_boundary(void);
 
   /*! calculate normal transformed continuous viscous flux at the flux points on boundaries*/
   void evaluate_boundaryConditions_viscFlux(double time_bound);
 
+  /*! calculate normal transformed continuous viscous flux at the flux points of the in_n_list boundary interfaces of in_list */
+  void evaluate_boundaryConditions_viscFlux(double time_bound, int in_n_list, int* in_list);
+
 protected:
 
   // #### members ####
@@ -84,4 +99,11 @@ protected:
   array<int> boundary_type;
   array<double> bdy_params;
 
+  /*! the interfaces sorted by boundary type, so that those of one type are evaluated together */
+  array<int> bdy_group_inters;
+
+  /*! gradient on both sides at the flux points of a batch (n_batch_inters*n_fpts_per_inter,n_fields,n_dims), one per thread */
+  array< array<double> > batch_grad_u_l;
+  array< array<double> > batch_grad_u_r;
+
 };
@@ -0,0 +1,60 @@
+/*!
+ * \file cubature_tables.h
+ * \author - Original code: SD++ developed by Patrice Castonguay, Antony Jameson,
+ *                          Peter Vincent, David Williams (alphabetical by surname).
+ *         - Current development: Aerospace Computing Laboratory (ACL)
+ *                                Aero/Astro Department. Stanford University.
+ * \version 0.1.0
+ *
+ * High Fidelity Large Eddy Simulation (HiFiLES) Code.
+ * Copyright (C) 2014 Aerospace Computing Laboratory (ACL).
+ *
+ * HiFiLES is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * HiFiLES is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with HiFiLES.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+/*! shapes of the compiled cubature rules */
+enum cubature_shape
+{
+  CUBATURE_1D=0,
+  CUBATURE_TRI=1,
+  CUBATURE_QUAD=2,
+  CUBATURE_TET=3,
+  CUBATURE_HEXA=4
+};
+
+/*!
+ * \brief Cubature rule compiled in from data/cubature_*.dat.
+ *
+ * src/cubature_tables.cpp is generated from the data files by data/make_cubature_tables.py (make cubature_tables),
+ * so no file is read at run time.
+ */
+struct cubature_table
+{
+  /*! number of points (1d), order (tri) or rule (quad, tet, hexa) the rule is labelled with in the data file */
+  int key;
+
+  /*! number of points */
+  int n_pts;
+
+  /*! point locations, all the first coordinates, then all the second ones, ... */
+  const double* locs;
+
+  /*! weights */
+  const double* weights;
+};
+
+/*! rule in_key of shape in_shape (a cubature_shape), NULL if there is none */
+const cubature_table* get_cubature_table(int in_shape, int in_key);
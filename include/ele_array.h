@@ -0,0 +1,122 @@
+/*!
+ * \file ele_array.h
+ * \author - Original code: SD++ developed by Patrice Castonguay, Antony Jameson,
+ *                          Peter Vincent, David Williams (alphabetical by surname).
+ *         - Current development: Aerospace Computing Laboratory (ACL)
+ *                                Aero/Astro Department. Stanford University.
+ * \version 0.1.0
+ *
+ * High Fidelity Large Eddy Simulation (HiFiLES) Code.
+ * Copyright (C) 2014 Aerospace Computing Laboratory (ACL).
+ *
+ * HiFiLES is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * HiFiLES is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with HiFiLES.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "array.h"
+
+/*!
+ * \brief Solution point array of an element type, indexed (in_upt, in_ele, in_field[, in_dim])
+ *
+ * The storage order is chosen at setup:
+ * - width 1 (structure of arrays): the usual column-major order, upt fastest then ele, field and dim.
+ *   The leading dimension may be padded beyond the number of solution points.
+ * - width W > 1 (array of structures of arrays): elements are grouped in blocks of W, and a block
+ *   is stored as (lane, upt, field, dim) with the W elements of the block in the fastest index.
+ *   A pointwise kernel sees W*n_upts consecutive points per field, fields s_field apart, and the
+ *   dims of a block n_fields*s_field apart. The number of elements is padded to a whole block.
+ */
+class ele_array : public array<double>
+{
+public:
+
+  ele_array() : s_upt(1), s_field(0), s_dim(0), s_blk(0), shift(0), mask(0), width(1) {}
+
+  /*! allocate with in_width elements per block (1, or a power of 2), and leading dimension in_ld when in_width is 1 */
+  void setup_layout(int in_n_upts, int in_ld, int in_n_eles, int in_n_fields, int in_n_dims=1, int in_width=1)
+  {
+    width=in_width;
+    shift=0;
+    while((1<<shift)<width)
+      shift++;
+
+    if((1<<shift)!=width)
+      FatalError("AoSoA block width must be a power of 2");
+
+    mask=width-1;
+
+    if(width==1)
+    {
+      setup(in_ld,in_n_eles,in_n_fields,in_n_dims);
+
+      s_upt=1;
+      s_blk=in_ld;
+      s_field=in_ld*in_n_eles;
+      s_dim=s_field*in_n_fields;
+    }
+    else
+    {
+      int n_blks=(in_n_eles+width-1)/width;
+
+      setup(in_n_upts,n_blks*width,in_n_fields,in_n_dims);
+
+      s_upt=width;
+      s_field=width*in_n_upts;
+      s_dim=s_field*in_n_fields;
+      s_blk=s_dim*in_n_dims;
+    }
+  }
+
+  /*! access/set 3d */
+  inline double& operator() (int in_upt, int in_ele, int in_field)
+  {
+    return cpu_data[in_upt*s_upt+in_field*s_field+(in_ele>>shift)*s_blk+(in_ele&mask)];
+  }
+
+  /*! access/set 4d */
+  inline double& operator() (int in_upt, int in_ele, int in_field, int in_dim)
+  {
+    return cpu_data[in_upt*s_upt+in_field*s_field+in_dim*s_dim+(in_ele>>shift)*s_blk+(in_ele&mask)];
+  }
+
+  using array<double>::get_ptr_cpu;
+
+  /*! return pointer to an entry */
+  double* get_ptr_cpu(int in_upt, int in_ele=0, int in_field=0, int in_dim=0)
+  {
+    return get_ptr_cpu()+in_upt*s_upt+in_field*s_field+in_dim*s_dim+(in_ele>>shift)*s_blk+(in_ele&mask);
+  }
+
+  /*! elements per block, 1 for the structure of arrays layout */
+  int get_width(void) { return width; }
+
+  /*! distance between fields */
+  int get_field_stride(void) { return s_field; }
+
+  /*! distance between blocks of elements (between elements for width 1) */
+  int get_blk_stride(void) { return s_blk; }
+
+protected:
+
+  int s_upt;
+  int s_field;
+  int s_dim;
+  int s_blk;
+
+  int shift;
+  int mask;
+  int width;
+
+};
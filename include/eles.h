@@ -26,7 +26,10 @@
 #pragma once
 
 #include "array.h"
+#include "ele_array.h"
 #include "input.h"
+#include "eles_kernels.h"
+#include "opp_cache.h"
 
 #if defined _GPU
 #include "cuda_runtime_api.h"
@@ -108,39 +111,90 @@ public:
   /*! calculate the discontinuous solution at the flux points */
   void extrapolate_solution(int in_disu_upts_from);
 
+  /*! calculate the discontinuous solution at the flux points of elements in_ele_start to in_ele_end-1 */
+  void extrapolate_solution(int in_disu_upts_from, int in_ele_start, int in_ele_end);
+
   /*! Calculate terms for some LES models */
   void calc_sgs_terms(int in_disu_upts_from);
 
   /*! calculate transformed discontinuous inviscid flux at solution points */
   void evaluate_invFlux(int in_disu_upts_from);
+
+  /*! calculate transformed discontinuous inviscid flux at solution points of elements in_ele_start to in_ele_end-1 */
+  void evaluate_invFlux(int in_disu_upts_from, int in_ele_start, int in_ele_end);
   
   /*! calculate divergence of transformed discontinuous flux at solution points */
   void calculate_divergence(int in_div_tconf_upts_to);
+
+  /*! calculate divergence of transformed discontinuous flux at solution points of elements in_ele_start to in_ele_end-1 */
+  void calculate_divergence(int in_div_tconf_upts_to, int in_ele_start, int in_ele_end);
   
   /*! calculate normal transformed discontinuous flux at flux points */
   void extrapolate_totalFlux(void);
+
+  /*! calculate normal transformed discontinuous flux at flux points of elements in_ele_start to in_ele_end-1 */
+  void extrapolate_totalFlux(int in_ele_start, int in_ele_end);
   
+  /*! extrapolate_totalFlux and calculate_divergence, in one pass over the flux when opp_1 and opp_2 are packed dense */
+  void calculate_totalFlux_divergence(int in_div_tconf_upts_to);
+
+  /*! extrapolate_totalFlux and calculate_divergence of elements in_ele_start to in_ele_end-1 */
+  void calculate_totalFlux_divergence(int in_div_tconf_upts_to, int in_ele_start, int in_ele_end);
+
   /*! calculate subgrid-scale flux at flux points */
   void evaluate_sgsFlux(void);
 
+  /*! calculate subgrid-scale flux at flux points of elements in_ele_start to in_ele_end-1 */
+  void evaluate_sgsFlux(int in_ele_start, int in_ele_end);
+
   /*! calculate divergence of transformed continuous flux at solution points */
   void calculate_corrected_divergence(int in_div_tconf_upts_to);
+
+  /*! calculate divergence of transformed continuous flux at solution points of elements in_ele_start to in_ele_end-1 */
+  void calculate_corrected_divergence(int in_div_tconf_upts_to, int in_ele_start, int in_ele_end);
+
+  /*! add the correction of the flux point values in_fpts_ptr (laid out as norm_tconf_fpts) to the divergence of elements in_ele_start to in_ele_end-1 */
+  void add_corrected_divergence(double* in_fpts_ptr, int in_div_tconf_upts_to, int in_ele_start, int in_ele_end);
   
   /*! calculate uncorrected transformed gradient of the discontinuous solution at the solution points */
   void calculate_gradient(int in_disu_upts_from);
 
+  /*! calculate uncorrected transformed gradient at the solution points of elements in_ele_start to in_ele_end-1 */
+  void calculate_gradient(int in_disu_upts_from, int in_ele_start, int in_ele_end);
+
   /*! calculate corrected gradient of the discontinuous solution at solution points */
   void correct_gradient(void);
 
+  /*! calculate corrected gradient at solution points of elements in_ele_start to in_ele_end-1 */
+  void correct_gradient(int in_ele_start, int in_ele_end);
+
   /*! calculate corrected gradient of the discontinuous solution at flux points */
   void extrapolate_corrected_gradient(void);
 
+  /*! calculate corrected gradient at flux points of elements in_ele_start to in_ele_end-1 */
+  void extrapolate_corrected_gradient(int in_ele_start, int in_ele_end);
+
   /*! calculate corrected gradient of solution at flux points */
   //void extrapolate_corrected_gradient(void);
 
   /*! calculate transformed discontinuous viscous flux at solution points */
   void evaluate_viscFlux(int in_disu_upts_from);
 
+  /*! calculate transformed discontinuous viscous flux at solution points of elements in_ele_start to in_ele_end-1 */
+  void evaluate_viscFlux(int in_disu_upts_from, int in_ele_start, int in_ele_end);
+
+  /*! calculate the transformed inviscid flux, or add the viscous flux, on a static mesh with the AoSoA layout */
+  void evaluate_flux_aosoa(int in_disu_upts_from, bool in_viscous, int in_ele_start, int in_ele_end);
+
+  /*! extrapolate_solution, calculate_gradient and evaluate_invFlux, one block of elements at a time */
+  void evaluate_invFlux_blocked(int in_disu_upts_from);
+
+  /*! correct_gradient and extrapolate_corrected_gradient, one block of elements at a time */
+  void correct_gradient_blocked(void);
+
+  /*! evaluate_viscFlux, evaluate_sgsFlux, extrapolate_totalFlux and calculate_divergence, one block of elements at a time */
+  void calculate_divergence_blocked(int in_disu_upts_from, int in_div_tconf_upts_to);
+
   /*! calculate divergence of transformed discontinuous viscous flux at solution points */
   //void calc_div_tdisvisf_upts(int in_div_tconinvf_upts_to);
 
@@ -156,12 +210,66 @@ public:
   /*! advance solution using a runge-kutta scheme */
   void AdvanceSolution(int in_step, int adv_type);
 
+  /*! advance solution of elements in_ele_start to in_ele_end-1 using a runge-kutta scheme */
+  void AdvanceSolution(int in_step, int adv_type, int in_ele_start, int in_ele_end);
+
   /*! Calculate element local timestep */
   double calc_dt_local(int in_ele);
 
+  /*! Calculate the timesteps of dt_type 1 or 2 and store them in dt_local */
+  void set_dt_local(void);
+
+  /*! Get the timestep of an element for the dt_type in use (after set_dt_local) */
+  double get_dt_ele(int in_ele);
+
+  /*! set the level of local time stepping of each element, an element of level l advances with timestep in_dt_min*2^l */
+  void set_lts_levels(int* in_levels, double in_dt_min);
+
+  /*! copy the solution of elements in_ele_start to in_ele_end-1 as that of the start (in_end 0, also clears their flux
+   difference) or the end (in_end 1) of their local timestep */
+  void save_lts_solution(int in_end, int in_ele_start, int in_ele_end);
+
+  /*! set the solution of elements in_ele_start to in_ele_end-1 back to that of the end of their local timestep */
+  void restore_lts_solution(int in_ele_start, int in_ele_end);
+
+  /*! set the solution of the in_n_list elements of in_list to that at fraction in_theta(level) of their local timestep */
+  void interpolate_lts_solution(int in_n_list, int* in_list, double* in_theta);
+
+  /*! add in_weight times the normal transformed continuous flux on the in_n_list faces of in_list, each given by element,
+   local face and sign, to the flux difference of local time stepping */
+  void accumulate_lts_flux(int in_n_list, int* in_list, double in_weight);
+
+  /*! correct the solution of elements in_ele_start to in_ele_end-1 by their flux difference of local time stepping */
+  void apply_lts_flux(int in_ele_start, int in_ele_end);
+
+  /*! start a physical timestep of dual time stepping, the solution becomes the latest physical time level */
+  void shift_dual_time_levels(void);
+
+  /*! get the sum of squares of the unsteady residual of field res_norm_field, from the last first stage of adv_type 5 */
+  double get_dual_time_res(void);
+
+  /*! get number of unknowns per element, all fields at all solution points */
+  int get_n_dofs_per_ele(void);
+
+  /*! copy the solution to or from a vector ordered by element, then field, then solution point */
+  void get_disu_upts_dofs(double* out_dofs);
+  void set_disu_upts_dofs(double* in_dofs);
+
+  /*! copy the right-hand side of du/dt at the solution points to a vector ordered as in get_disu_upts_dofs */
+  void get_rhs_upts_dofs(double* out_dofs);
+
+  /*! set the forcing of p-multigrid added to the right-hand side of du/dt, from a vector ordered as in get_disu_upts_dofs */
+  void set_mg_src_upts_dofs(double* in_dofs);
+
   /*! get number of elements */
   int get_n_eles(void);
 
+  /*! get number of flux points per element */
+  int get_n_fpts_per_ele(void);
+
+  /*! get the first flux point of local interface in_ele_local_inter */
+  int get_first_fpt(int in_ele_local_inter);
+
   // get number of ppts_per_ele
   int get_n_ppts_per_ele(void);
 
@@ -244,7 +352,7 @@ public:
   double* get_grad_disu_fpts_ptr(int in_inter_local_fpt, int in_ele_local_inter, int in_dim, int in_field, int in_ele);
 
   /*! get a pointer to gradient of discontinuous solution at a flux point */
-  double* get_normal_disu_fpts_ptr(int in_inter_local_fpt, int in_ele_local_inter, int in_field, int in_ele, array<double> temp_loc, double temp_pos[3]);
+  double* get_normal_disu_fpts_ptr(int in_inter_local_fpt, int in_ele_local_inter, int in_field, int in_ele, array<double>& temp_loc, double temp_pos[3]);
   
   /*! get a pointer to the normal transformed continuous viscous flux at a flux point */
   //double* get_norm_tconvisf_fpts_ptr(int in_inter_local_fpt, int in_ele_local_inter, int in_field, int in_ele);
@@ -273,6 +381,39 @@ public:
   /*! set opp_6 */
   void set_opp_6(int in_sparse);
 
+  /*! set the 1D factors used to apply opp_0 to opp_6 by sum factorization (tensor-product elements) */
+  void set_opp_tensor(void);
+
+  /*! apply 1D derivative factors along in_dim to each element/field column of in_ptr, columns in_ld apart */
+  void apply_tensor_deriv(array<double>& in_deriv, int in_dim, double* in_ptr, double* out_ptr, int in_ld, double in_beta, int in_ele_start, int in_ele_end);
+
+  /*! extrapolate each element/field column of in_ptr (in_ld apart) to the flux points along the face-normal lines */
+  void apply_tensor_extrap(array<double>& in_coeff, double* in_ptr, int in_ld, int in_dim_stride, double* out_ptr, int in_ele_start, int in_ele_end);
+
+  /*! add the flux point values of in_ptr back along the face-normal lines (in_dim < 0 for all faces), out columns in_ld apart */
+  void apply_tensor_correct(array<double>& in_coeff, int in_dim, double* in_ptr, double* out_ptr, int in_ld, int in_ele_start, int in_ele_end);
+
+  /*! apply a dense, csr or packed dense operator to the element/field columns of in_ptr, with leading dimensions in_ld and out_ld */
+  void apply_opp(int in_sparse, array<double>& in_opp, array<double>& in_data, array<int>& in_cols, array<int>& in_b, array<int>& in_e, double* in_ptr, int in_ld, double in_beta, double* out_ptr, int out_ld, int in_ele_start, int in_ele_end);
+
+  /*! apply an operator in storage in_sparse to in_n_cols consecutive columns of in_ptr, in double precision */
+  void apply_opp_cols(int in_sparse, array<double>& in_opp, array<double>& in_data, array<int>& in_cols, array<int>& in_b, array<int>& in_e, int in_n_cols, double* in_ptr, int in_ld, double in_beta, double* out_ptr, int out_ld);
+
+  /*! set collocated_fpts and fpt_upt from opp_0 */
+  void set_fpt_upt(void);
+
+  /*! pack the in_n_opps operators at in_opp side by side for stacked_opp */
+  void pack_opp_stacked(array<double>* in_opp, int in_n_opps, array<double>& out_packed);
+
+  /*! time the storage forms of the in_n_opps operators at in_opp and return the fastest (sparse_* 4) */
+  int select_opp_sparse(const char* in_name, array<double>* in_opp, int in_n_opps);
+
+  /*! apply a dense operator in single precision to chunks of columns, the products are added to out_ptr in double */
+  void apply_opp_single(array<double>& in_opp, double* in_ptr, int in_ld, double in_beta, double* out_ptr, int out_ld, int in_ele_start, int in_ele_end);
+
+  /*! apply a dense operator block by block in the AoSoA layout, in_blk/out_blk are the block strides of AoSoA operands, 0 for flux point arrays */
+  void apply_opp_aosoa(array<double>& in_opp, double* in_ptr, int in_blk, double in_beta, double* out_ptr, int out_blk, int in_ele_start, int in_ele_end);
+
   /*! set opp_p */
   void set_opp_p(void);
 
@@ -339,7 +480,7 @@ public:
 	void calc_wall_distance_parallel(array<int> n_seg_noslip_inters, array<int> n_tri_noslip_inters, array<int> n_quad_noslip_inters, array< array<double> > loc_noslip_bdy_global, int nproc);
 
   /*! calculate position */
-  void calc_pos(array<double> in_loc, int in_ele, array<double>& out_pos);
+  void calc_pos(array<double>& in_loc, int in_ele, array<double>& out_pos);
 
   /*! calculate derivative of position */
   void calc_d_pos(array<double> in_loc, int in_ele, array<double>& out_d_pos);
@@ -349,6 +490,15 @@ public:
 
   /*! calculate derivative of position at a flux point (using pre-computed gradients) */
   void calc_d_pos_fpt(int in_fpt, int in_ele, array<double>& out_d_pos);
+
+  /*! allocate scratch storage for the pointwise kernels, one set per thread */
+  void setup_thread_scratch(void);
+
+  /*! set up cached_opps for this element type, disabled unless opp_cache is 1 */
+  void setup_opp_cache(void);
+
+  /*! true if in_memo_loc and in_memo_order hold the first in_n_dims coordinates of in_loc and in_order, otherwise store them there */
+  bool check_basis_memo(array<double>& in_loc, int in_n_dims, int in_order, array<double>& in_memo_loc, int& in_memo_order);
   
   // #### virtual methods ####
 
@@ -362,16 +512,16 @@ public:
   virtual void write_restart_info(ofstream& restart_file)=0;
 
   /*! Compute interface jacobian determinant on face */
-  virtual double compute_inter_detjac_inters_cubpts(int in_inter, array<double> d_pos)=0;
+  virtual double compute_inter_detjac_inters_cubpts(int in_inter, array<double>& d_pos)=0;
 
   /*! evaluate nodal basis */
-  virtual double eval_nodal_basis(int in_index, array<double> in_loc)=0;
+  virtual double eval_nodal_basis(int in_index, array<double>& in_loc)=0;
 
   /*! evaluate nodal basis for restart file*/
-  virtual double eval_nodal_basis_restart(int in_index, array<double> in_loc)=0;
+  virtual double eval_nodal_basis_restart(int in_index, array<double>& in_loc)=0;
 
   /*! evaluate derivative of nodal basis */
-  virtual double eval_d_nodal_basis(int in_index, int in_cpnt, array<double> in_loc)=0;
+  virtual double eval_d_nodal_basis(int in_index, int in_cpnt, array<double>& in_loc)=0;
 
   virtual void fill_opp_3(array<double>& opp_3)=0;
 
@@ -379,7 +529,7 @@ public:
   //virtual double eval_div_vcjh_basis(int in_index, array<double>& loc)=0;
 
   /*! evaluate nodal shape basis */
-  virtual double eval_nodal_s_basis(int in_index, array<double> in_loc, int in_n_spts)=0;
+  virtual double eval_nodal_s_basis(int in_index, array<double>& in_loc, int in_n_spts)=0;
 
   /*! evaluate derivative of nodal shape basis */
   virtual void eval_d_nodal_s_basis(array<double> &d_nodal_s_basis, array<double> in_loc, int in_n_spts)=0;
@@ -387,8 +537,8 @@ public:
   /*! Calculate SGS flux */
   void calc_sgsf_upts(array<double>& temp_u, array<double>& temp_grad_u, double& detjac, int ele, int upt, array<double>& temp_sgsf);
 
-  /*! rotate velocity components to surface*/
-  array<double> calc_rotation_matrix(array<double>& norm);
+  /*! rotation matrix from Cartesian to surface coordinates, for a surface with normal norm */
+  void calc_rotation_matrix(array<double>& norm, array<double>& out_mrot);
 
   /*! calculate wall shear stress using LES wall model*/
   void calc_wall_stress(double rho, array<double>& urot, double ene, double mu, double Pr, double gamma, double y, array<double>& tau_wall, double q_wall);
@@ -534,7 +684,7 @@ public:
   void initialize_grid_vel(int in_max_n_spts_per_ele);
 
   /*! set grid velocity on element shape points */
-  void set_grid_vel_spt(int in_ele, int in_spt, array<double> in_vel);
+  void set_grid_vel_spt(int in_ele, int in_spt, array<double>& in_vel);
 
   /*! interpolate grid velocity from shape points to flux points */
   void set_grid_vel_fpts(int in_rk_step);
@@ -586,7 +736,7 @@ public:
   /* --- Shock capturing functions --- */
 
   void shock_capture_concentration(int in_disu_upts_from);
-  void shock_capture_concentration_cpu(int in_n_eles, int in_n_upts_per_ele, int in_n_fields, int in_order, int in_ele_type, int in_artif_type, double s0, double kappa, double* in_disu_upts_ptr, double* in_inv_vandermonde_ptr, double* in_inv_vandermonde2D_ptr, double* in_vandermonde2D_ptr, double* concentration_array_ptr, double* out_sensor, double* sigma);
+  void shock_capture_concentration_cpu(int in_n_eles, int in_n_upts_per_ele, int in_ld, int in_n_fields, int in_order, int in_ele_type, int in_artif_type, double s0, double kappa, double* in_disu_upts_ptr, double* in_inv_vandermonde_ptr, double* in_inv_vandermonde2D_ptr, double* in_vandermonde2D_ptr, double* concentration_array_ptr, double* out_sensor, double* sigma);
 
 protected:
 
@@ -646,6 +796,12 @@ protected:
   /*! number of solution points per element */
   int n_upts_per_ele;
 
+  /*! leading dimension of disu_upts, div_tconf_upts, tdisf_upts and grad_disu_upts (n_upts_per_ele, or padded to 64 bytes) */
+  int n_upts_ld;
+
+  /*! elements per block of disu_upts, div_tconf_upts, tdisf_upts and grad_disu_upts (1: structure of arrays, else AoSoA) */
+  int upts_width;
+
   /*! number of solution points per element */
   int n_upts_per_ele_rest;
 
@@ -786,11 +942,23 @@ protected:
   /*! nodal shape basis contributions at output plot points */
   array<array<double> > d_nodal_s_basis_inters_cubpts;
 
-	/*! temporary solution storage at a single solution point */
-	array<double> temp_u;
+  /*! number of threads sharing the pointwise CPU kernels */
+  int n_threads;
+
+  /*! number of elements per block for the blocked residual */
+  int ele_block_size;
+
+  /*! specialized Euler flux kernel, NULL to use the generic loop */
+  invFlux_kernel invFlux_fn;
+
+  /*! AoSoA operator kernel for the block width, NULL for the generic loops */
+  aosoa_opp_kernel aosoa_opp_fn;
 
-  /*! temporary grid velocity storage at a single solution point */
-  array<double> temp_v;
+	/*! per-thread temporary solution storage at a single solution point */
+	array< array<double> > temp_u;
+
+  /*! per-thread temporary grid velocity storage at a single solution point */
+  array< array<double> > temp_v;
 
   /*! temporary grid velocity storage at a single solution point (transformed to static frame) */
   array<double> temp_v_ref;
@@ -804,8 +972,8 @@ protected:
   /*! constansts for RK time-stepping */
   array<double> RK_a, RK_b, RK_c;
 
-	/*! temporary solution gradient storage */
-	array<double> temp_grad_u;
+	/*! per-thread temporary solution gradient storage */
+	array< array<double> > temp_grad_u;
 
 	/*! Matrix of filter weights at solution points */
 	array<double> filter_upts;
@@ -813,17 +981,26 @@ protected:
 	/*! extra arrays for similarity model: Leonard tensors, velocity/energy products */
 	array<double> Lu, Le, uu, ue;
 
-	/*! temporary flux storage */
-	array<double> temp_f;
+	/*! per-thread temporary flux storage */
+	array< array<double> > temp_f;
+
+  /*! per-thread temporary flux storage for dynamic->static transformation */
+  array< array<double> > temp_f_ref;
+
+	/*! per-thread temporary subgrid-scale flux storage */
+	array< array<double> > temp_sgsf;
+
+  /*! per-thread temporary subgrid-scale flux storage for dynamic->static transformation */
+  array< array<double> > temp_sgsf_ref;
 
-  /*! temporary flux storage */
-  array<double> temp_f_ref;
+  /*! per-thread temporary flux storage at all solution points of an element, indexing: (in_upt, in_field, in_dim) */
+  array< array<double> > temp_f_upts;
 
-	/*! temporary subgrid-scale flux storage */
-	array<double> temp_sgsf;
+  /*! per-thread element blocks of flux point values, transposed to the AoSoA order for apply_opp_aosoa */
+  array< array<double> > temp_blk_fpts;
 
-  /*! temporary subgrid-scale flux storage for dynamic->static transformation */
-  array<double> temp_sgsf_ref;
+  /*! per-thread single precision operator and column chunks for apply_opp_single */
+  array< array<float> > temp_opp_sp;
 	
 	/*! storage for distance of solution points to nearest no-slip boundary */
 	array<double> wall_distance;
@@ -911,7 +1088,7 @@ protected:
         indexing: \n
         matrix mapping:
         */
-  array< array<double> > disu_upts;
+  array<ele_array> disu_upts;
 
 	/*!
 	running time-averaged diagnostic fields at solution points
@@ -943,7 +1120,7 @@ protected:
 	indexing: (in_upt, in_dim, in_field, in_ele) \n
 	matrix mapping: (in_upt, in_dim || in_field, in_ele)
 	*/
-	array<double> tdisf_upts;
+	ele_array tdisf_upts;
 	
 	/*!
 	description: subgrid-scale flux at the solution points \n
@@ -978,13 +1155,13 @@ protected:
 	indexing: \n
 	matrix mapping:
 	*/
-	array< array<double> > div_tconf_upts;
+	array<ele_array> div_tconf_upts;
 	
 	/*! delta of the transformed discontinuous solution at the flux points   */
 	array<double> delta_disu_fpts;
 
 	/*! gradient of discontinuous solution at solution points */
-	array<double> grad_disu_upts;
+	ele_array grad_disu_upts;
 	
 	/*! gradient of discontinuous solution at flux points */
 	array<double> grad_disu_fpts;
@@ -1075,6 +1252,8 @@ protected:
   array< array<int> > opp_1_b;
   array< array<int> > opp_1_e;
   int opp_1_sparse;
+  /*! opp_1 of all dimensions side by side, packed for stacked_opp (sparse 3) */
+  array<double> opp_1_stacked;
 #ifdef _GPU
   array< array<double> > opp_1_ell_data;
   array< array<int> > opp_1_ell_indices;
@@ -1088,6 +1267,8 @@ protected:
   array< array<int> > opp_2_b;
   array< array<int> > opp_2_e;
   int opp_2_sparse;
+  /*! opp_2 of all dimensions side by side, packed for stacked_opp (sparse 3) */
+  array<double> opp_2_stacked;
 #ifdef _GPU
   array< array<double> > opp_2_ell_data;
   array< array<int> > opp_2_ell_indices;
@@ -1146,9 +1327,56 @@ protected:
   int opp_6_nnz_per_row;
 #endif
 
+  /*! number of solution points along each direction of a tensor-product element */
+  int n_upts_1d;
+
+  /*! direction of the line of solution points normal to each flux point */
+  array<int> tensor_fpt_dir;
+
+  /*! first solution point of the line normal to each flux point */
+  array<int> tensor_fpt_base;
+
+  /*! stride between the solution points of the line normal to each flux point */
+  array<int> tensor_fpt_stride;
+
+  /*! whether every flux point coincides with a solution point, so that opp_0 and opp_6 are replaced by gathers */
+  int collocated_fpts;
+
+  /*! solution point at each flux point when collocated_fpts is set */
+  array<int> fpt_upt;
+
+  /*! 1D factors of opp_0, opp_1, opp_3, opp_5 and opp_6, indexing: (in_upt_1d, in_fpt) */
+  array<double> opp_0_tensor;
+  array<double> opp_1_tensor;
+  array<double> opp_3_tensor;
+  array<double> opp_5_tensor;
+  array<double> opp_6_tensor;
+
+  /*! 1D factors of opp_2 and opp_4, indexing: (in_dim)(in_upt_1d, in_upt_1d) */
+  array< array<double> > opp_2_tensor;
+  array< array<double> > opp_4_tensor;
+
+  /*! specialized sum-factorization kernels for n_upts_1d, NULL to use the generic loops */
+  tensor_deriv_kernel tensor_deriv_fn;
+  tensor_extrap_kernel tensor_extrap_fn;
+  tensor_correct_kernel tensor_correct_fn;
+
   /*! operator to go from discontinuous solution at the solution points to discontinuous solution at the plot points */
   array<double> opp_p;
 
+  /*! reference element operators read from and written to the operator cache file (opp_cache 1) */
+  opp_cache cached_opps;
+
+  /*! orthonormal basis at the location of the last eval_nodal_basis call, reused while the operator loops run over the nodal basis functions at one location */
+  array<double> basis_memo;
+  array<double> basis_memo_loc;
+  int basis_memo_order;
+
+  /*! gradient of the orthonormal basis at the location of the last eval_d_nodal_basis call, indexing: (in_mode,in_cpnt) */
+  array<double> d_basis_memo;
+  array<double> d_basis_memo_loc;
+  int d_basis_memo_order;
+
   array< array<double> > opp_inters_cubpts;
   array<double> opp_volume_cubpts;
 
@@ -1189,9 +1417,29 @@ protected:
   
   /*! element local timestep */
   array<double> dt_local;
-  double dt_local_new;
   array<double> dt_local_mpi;
 
+  /*! solution at the last two physical time levels of dual time stepping (adv_type 5), and how many are set */
+  array<ele_array> disu_upts_dual;
+  int n_dual_levels;
+
+  /*! sum of squares of the unsteady residual of field res_norm_field at the first stage of adv_type 5 */
+  double dual_time_res;
+
+  /*! level of local time stepping of each element */
+  array<int> lts_level;
+
+  /*! solution at the start and at the end of the local timestep of each element */
+  array<ele_array> disu_upts_lts;
+
+  /*! normal transformed continuous flux at the flux points integrated over the steps of the finer neighbours, less that
+   integrated over the element's own step, on the faces it shares with them */
+  array<double> lts_flux_fpts;
+
+  /*! forcing of the lower orders of p-multigrid at the solution points, and whether it is set */
+  ele_array mg_src_upts;
+  int mg_forcing;
+
   /*! Artificial Viscosity variables */
   array<double> vandermonde;
   array<double> inv_vandermonde;
@@ -0,0 +1,100 @@
+/*!
+ * \file eles_kernels.h
+ * \author - Original code: SD++ developed by Patrice Castonguay, Antony Jameson,
+ *                          Peter Vincent, David Williams (alphabetical by surname).
+ *         - Current development: Aerospace Computing Laboratory (ACL)
+ *                                Aero/Astro Department. Stanford University.
+ * \version 0.1.0
+ *
+ * High Fidelity Large Eddy Simulation (HiFiLES) Code.
+ * Copyright (C) 2014 Aerospace Computing Laboratory (ACL).
+ *
+ * HiFiLES is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * HiFiLES is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with HiFiLES.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+/*!
+ * Element kernels with the number of dimensions and solution points per direction fixed at compile
+ * time, so that their loops can be unrolled and vectorized. Each get_*_kernel function returns the
+ * instantiation for a configuration, or NULL if there is none and the generic loops must be used.
+ * in_ld is the leading dimension of the solution point arrays, which may be padded.
+ */
+
+/*! 1D derivative along in_dim of a tensor-product element, out = in_beta*out + D*in */
+typedef void (*tensor_deriv_kernel)(double* in_deriv, int in_dim, double* in_ptr, double* out_ptr, int in_ld, double in_beta, int in_n_eles, int in_n_fields, int in_ele_start, int in_ele_end);
+
+/*! extrapolation of a tensor-product element to its flux points along the face-normal lines, out = W*in */
+typedef void (*tensor_extrap_kernel)(double* in_coeff, int* in_fpt_dir, int* in_fpt_base, int* in_fpt_stride, double* in_ptr, int in_ld, int in_dim_stride, double* out_ptr, int in_n_eles, int in_n_fields, int in_ele_start, int in_ele_end);
+
+/*! correction of a tensor-product element from its flux points along the face-normal lines, out += C*in */
+typedef void (*tensor_correct_kernel)(double* in_coeff, int in_dim, int* in_fpt_dir, int* in_fpt_base, int* in_fpt_stride, double* in_ptr, double* out_ptr, int in_ld, int in_n_eles, int in_n_fields, int in_ele_start, int in_ele_end);
+
+/*! transformed Euler flux at the solution points of a static mesh */
+typedef void (*invFlux_kernel)(double* in_disu_upts, double* in_JGinv_upts, double* out_tdisf_upts, int in_ld, double in_gamma, int in_n_upts_per_ele, int in_n_eles, int in_ele_start, int in_ele_end);
+
+/*! dense operator on a full block of elements in the AoSoA layout, out = in_beta*out + A*in, with the lanes of a block fastest */
+typedef void (*aosoa_opp_kernel)(double* in_opp, int in_n_rows, int in_n_inner, double* in_ptr, double in_beta, double* out_ptr);
+
+/*! dense operator packed by pack_small_gemm, out = in_beta*out + A*in for in_n_cols columns, in_ld and out_ld apart */
+typedef void (*small_gemm_kernel)(double* in_packed, int in_n_rows, int in_n_inner, double* in_ptr, int in_ld, int in_n_cols, double in_beta, double* out_ptr, int out_ld);
+
+/*! in_n_in operators packed side by side by pack_small_gemm, out = in_beta*out + sum_s A_s*in_s for in_n_cols columns in one thread, with the inputs in_stride apart */
+typedef void (*small_gemm_block_kernel)(double* in_packed, int in_n_rows, int in_n_inner, int in_n_in, int in_stride, double* in_ptr, int in_ld, int in_n_cols, double in_beta, double* out_ptr, int out_ld);
+
+/*! number of operator rows accumulated together by the small matrix multiply */
+#define SMALL_GEMM_MR 12
+
+/*! largest number of outputs of stacked_opp */
+#define SMALL_GEMM_MAX_OUT 4
+
+/*! number of columns stacked_opp applies all its operators to at a time */
+#define SMALL_GEMM_NC 16
+
+/*! one-based four-array csr operator (see array_to_mklcsr), out = in_beta*out + A*in for in_n_cols columns, in_ld and out_ld apart */
+void csr_opp(double* in_data, int* in_cols, int* in_b, int* in_e, int in_n_rows, double* in_ptr, int in_ld, int in_n_cols, double in_beta, double* out_ptr, int out_ld);
+
+/*! copy the solution point in_fpt_upt[j] of each element/field column of in_ptr (in_ld apart) to flux point j of out_ptr */
+void gather_fpts(int* in_fpt_upt, int in_n_fpts, double* in_ptr, int in_ld, double* out_ptr, int in_n_eles, int in_n_fields, int in_ele_start, int in_ele_end);
+
+/*! get the derivative kernel for in_n_dims dimensions and in_n_upts_1d points per direction */
+tensor_deriv_kernel get_tensor_deriv_kernel(int in_n_dims, int in_n_upts_1d);
+
+/*! get the extrapolation kernel for in_n_dims dimensions and in_n_upts_1d points per direction */
+tensor_extrap_kernel get_tensor_extrap_kernel(int in_n_dims, int in_n_upts_1d);
+
+/*! get the correction kernel for in_n_dims dimensions and in_n_upts_1d points per direction */
+tensor_correct_kernel get_tensor_correct_kernel(int in_n_dims, int in_n_upts_1d);
+
+/*! get the Euler flux kernel for in_n_dims dimensions and in_n_fields fields */
+invFlux_kernel get_invFlux_kernel(int in_n_dims, int in_n_fields);
+
+/*! get the AoSoA operator kernel for blocks of in_width elements */
+aosoa_opp_kernel get_aosoa_opp_kernel(int in_width);
+
+/*! get the small matrix multiply for an operator with in_n_rows rows */
+small_gemm_kernel get_small_gemm_kernel(int in_n_rows);
+
+/*! get the single thread small matrix multiply for an operator with in_n_rows rows */
+small_gemm_block_kernel get_small_gemm_block_kernel(int in_n_rows);
+
+/*! in_n_out operators packed by pack_small_gemm, each with in_n_in in_n_rows[o] x in_n_inner blocks side by side, applied in one pass over the columns
+    of elements in_ele_start to in_ele_end-1: out_o = in_beta*out_o + sum_s A_os*in_s, with the inputs in_stride apart and in_n_out at most SMALL_GEMM_MAX_OUT */
+void stacked_opp(int in_n_out, double** in_packed, int* in_n_rows, int in_n_inner, int in_n_in, double* in_ptr, int in_ld, int in_stride, double in_beta, double** out_ptr, int* out_ld, int in_n_eles, int in_n_fields, int in_ele_start, int in_ele_end);
+
+/*! size of an in_n_rows x in_n_inner operator packed for the small matrix multiply */
+int get_small_gemm_size(int in_n_rows, int in_n_inner);
+
+/*! pack a column-major in_n_rows x in_n_inner operator for the small matrix multiply, out_packed has get_small_gemm_size entries */
+void pack_small_gemm(double* in_opp, int in_n_rows, int in_n_inner, double* out_packed);
@@ -80,16 +80,16 @@ public:
   void write_restart_info(ofstream& restart_file);
 
   /*! Compute interface jacobian determinant on face */
-  double compute_inter_detjac_inters_cubpts(int in_inter, array<double> d_pos);
+  double compute_inter_detjac_inters_cubpts(int in_inter, array<double>& d_pos);
 
   /*! evaluate nodal basis */
-  double eval_nodal_basis(int in_index, array<double> in_loc);
+  double eval_nodal_basis(int in_index, array<double>& in_loc);
 
   /*! evaluate nodal basis restart*/
-  double eval_nodal_basis_restart(int in_index, array<double> in_loc);
+  double eval_nodal_basis_restart(int in_index, array<double>& in_loc);
 
   /*! evaluate derivative of nodal basis */
-  double eval_d_nodal_basis(int in_index, int in_cpnt, array<double> in_loc);
+  double eval_d_nodal_basis(int in_index, int in_cpnt, array<double>& in_loc);
 
   /*! evaluate divergence of vcjh basis */
   double eval_div_vcjh_basis(int in_index, array<double>& loc);
@@ -97,7 +97,7 @@ public:
   void fill_opp_3(array<double>& opp_3);
 
   /*! evaluate nodal shape basis */
-  double eval_nodal_s_basis(int in_index, array<double> in_loc, int in_n_spts);
+  double eval_nodal_s_basis(int in_index, array<double>& in_loc, int in_n_spts);
 
   /*! evaluate derivative of nodal shape basis */
   void eval_d_nodal_s_basis(array<double> &d_nodal_s_basis, array<double> in_loc, int in_n_spts);
@@ -133,7 +133,7 @@ public:
   double exponential_filter(int, int);
 
   /*! Evaluate 2D Legendre Basis */
-  double eval_legendre_basis_2D_hierarchical(int, array<double>, int in_order);
+  double eval_legendre_basis_2D_hierarchical(int, array<double>&, int in_order);
 
 protected:
 
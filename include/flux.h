@@ -39,6 +39,31 @@ void calc_visf_2d(array<double>& in_u, array<double>& in_grad_u, array<double>&
 /*! calculate viscous flux in 3D */
 void calc_visf_3d(array<double>& in_u, array<double>& in_grad_u, array<double>& out_f);
 
+/*!
+ * \brief calculate inviscid flux in 2D for a batch of points stored as structure of arrays
+ * \param[in] in_n_pts - Number of points
+ * \param[in] in_n_fields - Number of fields
+ * \param[in] in_u - Solution, field k of point p at in_u[p+k*in_u_stride]
+ * \param[in] in_u_stride - Stride between the fields of in_u
+ * \param[out] out_f - Flux, field k in direction l of point p at out_f[p+(k+in_n_fields*l)*in_f_stride]
+ * \param[in] in_f_stride - Stride between the fields of out_f
+ */
+void calc_invf_2d_batch(int in_n_pts, int in_n_fields, double* in_u, int in_u_stride, double* out_f, int in_f_stride);
+
+/*! calculate inviscid flux in 3D for a batch of points, see calc_invf_2d_batch */
+void calc_invf_3d_batch(int in_n_pts, int in_n_fields, double* in_u, int in_u_stride, double* out_f, int in_f_stride);
+
+/*!
+ * \brief calculate viscous flux in 2D for a batch of points stored as structure of arrays
+ * \param[in] in_grad_u - Gradient, field k in direction l of point p at in_grad_u[p+(k+in_n_fields*l)*in_grad_stride]
+ * \param[in] in_grad_stride - Stride between the fields of in_grad_u
+ * Other parameters as in calc_invf_2d_batch
+ */
+void calc_visf_2d_batch(int in_n_pts, int in_n_fields, double* in_u, int in_u_stride, double* in_grad_u, int in_grad_stride, double* out_f, int in_f_stride);
+
+/*! calculate viscous flux in 3D for a batch of points, see calc_visf_2d_batch */
+void calc_visf_3d_batch(int in_n_pts, int in_n_fields, double* in_u, int in_u_stride, double* in_grad_u, int in_grad_stride, double* out_f, int in_f_stride);
+
 /*!
  * \brief calculate & add addtional ALE flux term in 2D
  * \param[in] in_u - Solution vector
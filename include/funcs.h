@@ -106,6 +106,24 @@ double eval_dubiner_basis_3d(double in_r, double in_s, double in_t, int in_mode,
 /*! helper method to evaluate gradient of scalar dubiner basis*/
 double eval_grad_dubiner_basis_3d(double in_r, double in_s, double in_t, int in_mode, int in_basis_order, int component);
 
+/*! evaluate normalized jacobi polynomials of modes 0 to in_n_modes-1 in one recurrence */
+void eval_jacobi_modes(double in_r, int in_alpha, int in_beta, int in_n_modes, double* out_jacobi);
+
+/*! evaluate gradients of normalized jacobi polynomials of modes 0 to in_n_modes-1 in one recurrence */
+void eval_grad_jacobi_modes(double in_r, int in_alpha, int in_beta, int in_n_modes, double* out_grad_jacobi);
+
+/*! evaluate all modes of the triangle dubiner basis */
+void eval_dubiner_basis_2d_modes(double in_r, double in_s, int in_basis_order, array<double>& out_basis);
+
+/*! evaluate d/dr and d/ds of all modes of the triangle dubiner basis, indexing: (in_mode,in_cpnt) */
+void eval_grad_dubiner_basis_2d_modes(double in_r, double in_s, int in_basis_order, array<double>& out_grad_basis);
+
+/*! evaluate all modes of the tet dubiner basis */
+void eval_dubiner_basis_3d_modes(double in_r, double in_s, double in_t, int in_basis_order, array<double>& out_basis);
+
+/*! evaluate the gradient of all modes of the tet dubiner basis, indexing: (in_mode,in_cpnt) */
+void eval_grad_dubiner_basis_3d_modes(double in_r, double in_s, double in_t, int in_basis_order, array<double>& out_grad_basis);
+
 /*! helper method to compute eta for vcjh schemes */
 double compute_eta(int vjch_scheme, int order);
 
@@ -192,7 +210,7 @@ array<double> diffPoly(array<double> & p, array<int> & term2Diff);
 // evalPoly function: returns a double, which is the value of a polynomial "p" evaluated at coordinates coords;
 // the height of matrix representing polynomial p must equal the number of elements (columns) of array coords
 
-double evalPoly(array<double> p, array<double> coords);
+double evalPoly(array<double>& p, array<double>& coords);
 
 // createEquispacedArray: returns array with nPoints values equispaced between a and b (in that order)
 array<double> createEquispacedArray(double a, double b, int nPoints);
@@ -74,6 +74,22 @@ void GeoPreprocess(struct solution* FlowSol, mesh &Mesh);
 void ReadMesh(string& in_file_name, array<double>& out_xv, array<int>& out_c2v, array<int>& out_c2n_v, array<int>& out_ctype, array<int>& out_ic2icg,
               array<int>& out_iv2ivg, int& out_n_cells, int& out_n_verts, int& out_n_verts_global, struct solution* FlowSol);
 
+/*!
+ * \brief Method to find the storage order of the cells.
+ * \param[in] in_order_type - 0: as read, 1: Morton curve, 2: Hilbert curve through the centroids, 3: reverse Cuthill-McKee on the face neighbours.
+ * \param[in] in_f2c - Face to index of left and right cells, used by reverse Cuthill-McKee.
+ * \param[out] out_c_order - Cell at each position of the storage order.
+ */
+void ReorderCells(int in_order_type, array<double>& in_xv, array<int>& in_c2v, array<int>& in_c2n_v, array<int>& in_f2c, int in_n_faces,
+                  int in_n_cells, int in_n_dims, array<int>& out_c_order);
+
+/*!
+ * \brief Method to order the faces by the storage position of their left cell.
+ * \param[in] in_c_order - Cell at each position of the storage order.
+ * \param[out] out_f_order - Face at each position of the order.
+ */
+void ReorderFaces(array<int>& in_f2c, array<int>& in_c_order, int in_n_faces, int in_n_cells, array<int>& out_f_order);
+
 /*! method to read boundaries from mesh */
 void ReadBound(string& in_file_name, array<int>& in_c2v, array<int>& in_c2n_v, array<int>& in_c2f, array<int>& in_f2v, array<int>& in_f2nv,
                array<int>& in_ctype, array<int>& out_bctype, array<array<int> >& out_boundpts, array<int> &out_bc_list, array<int> &out_bound_flag,
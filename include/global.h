@@ -73,11 +73,23 @@ enum MOTION_TYPE {
 /** enumeration for mesh motion type */
 enum {MOTION_DISABLED, MOTION_ENABLED};
 
-/*! environment variable specifying location of HiFiLES repository */
-extern const char* HIFILES_DIR;
-
 /*! routine that mimics BLAS dgemm */
 int dgemm(int Arows, int Bcols, int Acols, double alpha, double beta, double* a, double* b, double* c);
 
+/*! routine that mimics BLAS dgemm, with leading dimensions lda, ldb and ldc */
+int dgemm(int Arows, int Bcols, int Acols, double alpha, double beta, double* a, int lda, double* b, int ldb, double* c, int ldc);
+
+/*! routine that mimics BLAS sgemm, with leading dimensions lda, ldb and ldc */
+int sgemm(int Arows, int Bcols, int Acols, float alpha, float beta, float* a, int lda, float* b, int ldb, float* c, int ldc);
+
 /*! routine that mimics BLAS daxpy */
 int daxpy(int n, double alpha, double *x, double *y);
+
+/*! number of threads available to the threaded CPU kernels (1 if not built with OpenMP) */
+int get_n_threads(void);
+
+/*! index of the calling thread inside a parallel region (0 if not built with OpenMP) */
+int get_thread_num(void);
+
+/*! wall-clock time in seconds (processor time if not built with OpenMP) */
+double get_wall_time(void);
@@ -0,0 +1,147 @@
+/*!
+ * \file implicit_solver.h
+ * \author - Original code: SD++ developed by Patrice Castonguay, Antony Jameson,
+ *                          Peter Vincent, David Williams (alphabetical by surname).
+ *         - Current development: Aerospace Computing Laboratory (ACL)
+ *                                Aero/Astro Department. Stanford University.
+ * \version 0.1.0
+ *
+ * High Fidelity Large Eddy Simulation (HiFiLES) Code.
+ * Copyright (C) 2014 Aerospace Computing Laboratory (ACL).
+ *
+ * HiFiLES is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * HiFiLES is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with HiFiLES.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "array.h"
+#include "mesh.h"
+#include "solution.h"
+#include "vector_structure.hpp"
+#include "linear_solvers_structure.hpp"
+
+/*!
+ * \brief Backward Euler pseudo-time stepping to a steady state (adv_type 4).
+ *
+ * Each step solves (I/dt - dR/du) du = R(u) with FGMRES, R the right-hand side of du/dt and dt the element
+ * timestep of dt_type scaled up as the residual falls (switched evolution relaxation), to at most implicit_cfl_max.
+ * The Jacobian is applied matrix-free, by a finite difference of CalcResidual. The preconditioner solves with the
+ * diagonal block of each element, found by finite differences of the residual: the elements are coloured so that
+ * no two elements of a colour are within reach of each other's residual (neighbours, and neighbours of neighbours
+ * for viscous flow), and one residual evaluation per colour and unknown of an element gives these columns of all
+ * blocks. Elements of other partitions are not coloured, so the blocks of elements on a partition boundary can
+ * include a neighbour's coupling; this only weakens the preconditioner.
+ */
+class implicit_solver
+{
+public:
+
+  // #### constructors ####
+
+  // default constructor
+  implicit_solver();
+
+  // #### methods ####
+
+  /*! allocate the vectors and colour the elements of Mesh */
+  void setup(struct solution* FlowSol, mesh& Mesh);
+
+  /*! advance the solution by one pseudo-time step */
+  void advance(int in_file_num);
+
+  /*! out_v = (I/dt - dR/du) in_u at the solution of the current step */
+  void apply_jacobian(const CSysVector& in_u, CSysVector& out_v);
+
+  /*! out_v = in_u solved with the element blocks of I/dt - dR/du (copied without a preconditioner) */
+  void apply_precond(const CSysVector& in_u, CSysVector& out_v);
+
+protected:
+
+  /*! set the solution to in_u and compute the right-hand side out_rhs */
+  void calc_rhs(int in_file_num, int in_rk_stage, CSysVector& in_u, CSysVector& out_rhs);
+
+  /*! compute the element blocks of dR/du at the solution u, whose right-hand side is rhs */
+  void calc_jacobian_blocks(int in_file_num);
+
+  /*! factor the element blocks of I/dt - dR/du */
+  void factor_blocks(void);
+
+  // #### members ####
+
+  /*! solution structure, for the residual evaluations */
+  struct solution* FlowSol;
+
+  /*! number of unknowns on this partition, and offset of the unknowns of each element type */
+  int n_dofs;
+  array<int> dof_offset;
+
+  /*! unknowns per element of each element type, and the most of all types on all partitions */
+  array<int> n_dofs_per_ele;
+  int max_n_dofs_per_ele;
+
+  /*! colour of each element of each type, and number of colours on all partitions */
+  array< array<int> > ele_colour;
+  int n_colours;
+
+  /*! solution and right-hand side of the current step */
+  CSysVector u, rhs;
+
+  /*! whether rhs is the right-hand side at u, kept from the end of the previous step */
+  bool rhs_current;
+
+  /*! 1/dt of each unknown */
+  CSysVector inv_dt;
+
+  /*! work vectors of the finite differences and the update */
+  CSysVector u_pert, rhs_pert, du;
+
+  /*! norms of rhs and u */
+  double norm_rhs, norm_u;
+
+  /*! timestep scaling of the switched evolution relaxation, and its largest value */
+  double dt_scale, max_dt_scale;
+
+  /*! steps since the element Jacobians were computed */
+  int n_steps_jac;
+
+  /*! element blocks of dR/du (n_dofs_per_ele,n_dofs_per_ele,n_eles), their LU factors with I/dt and the pivots */
+  array< array<double> > jac_blocks;
+  array< array<double> > lu_blocks;
+  array< array<int> > lu_pivots;
+
+  /*! FGMRES */
+  CSysSolve linear_solver;
+};
+
+/*! matrix-vector product of FGMRES, the Jacobian of an implicit_solver */
+class implicit_jacobian_product : public CMatrixVectorProduct
+{
+public:
+  implicit_jacobian_product(implicit_solver* in_solver) : solver(in_solver) {}
+  void operator()(const CSysVector& u, CSysVector& v) const { solver->apply_jacobian(u,v); }
+
+private:
+  implicit_solver* solver;
+};
+
+/*! preconditioner of FGMRES, the element blocks of an implicit_solver */
+class implicit_block_precond : public CPreconditioner
+{
+public:
+  implicit_block_precond(implicit_solver* in_solver) : solver(in_solver) {}
+  void operator()(const CSysVector& u, CSysVector& v) const { solver->apply_precond(u,v); }
+
+private:
+  implicit_solver* solver;
+};
@@ -101,6 +101,26 @@ public:
   string data_file_name;
   int restart_dump_freq;
   int adv_type;
+  int n_threads; // threads per process for the CPU kernels (0: OpenMP runtime default)
+  int blocked_residual; // run the element-local residual stages on blocks of elements
+  int ele_block_size; // elements per block (0: sized to fit in cache)
+  int pad_upts; // pad the leading dimension of the solution point arrays to a multiple of 64 bytes
+  int upts_layout; // layout of the solution point arrays (0: structure of arrays, 1: AoSoA)
+  int aosoa_width; // elements per block of the AoSoA layout
+  int precision; // 0: double, 1: mixed (single precision operators and MPI halo exchange)
+  int opp_cache; // read and write the element operators in opp_cache_dir (0: compute them every run)
+  string opp_cache_dir;
+  double implicit_cfl_max; // largest CFL number of the pseudo-time steps of the implicit solver (adv_type 4)
+  double implicit_lin_tol; // relative tolerance of the linear solve of each implicit step
+  int implicit_krylov_dim; // largest Krylov subspace of the linear solve
+  int implicit_precond; // 0: none, 1: element block Jacobi
+  int implicit_jac_freq; // steps between evaluations of the element Jacobians of the preconditioner
+  int dual_time_max_iter; // most pseudo-time iterations per physical timestep of dual time stepping (adv_type 5)
+  double dual_time_tol; // drop of the unsteady residual that ends the pseudo-time iterations of a physical timestep
+  int p_multigrid; // advance with p-multigrid V-cycles of the time integration scheme (adv_type 0 or 3)
+  int pmg_min_order; // lowest order of the p-multigrid cycle
+  int pmg_n_smooth; // steps of the time integration scheme on each order before and after the lower orders
+  int lts_levels; // number of timestep levels of local time stepping, each twice the timestep of the one below
 
   int LES;
   int filter_type;
@@ -151,6 +171,8 @@ public:
 
   int mesh_format;
   string mesh_file;
+  int reorder_eles; // storage order of the elements (0: as read, 1: Morton curve, 2: Hilbert curve, 3: reverse Cuthill-McKee)
+  int reorder_faces; // set up the interior and boundary interfaces in the storage order of their left element
 
   double dx_cyclic;
   double dy_cyclic;
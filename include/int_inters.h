@@ -54,15 +54,29 @@ public:
   /*! set interior interface */
   void set_interior(int in_inter, int in_ele_type_l, int in_ele_type_r, int in_ele_l, int in_ele_r, int in_local_inter_l, int in_local_inter_r, int rot_tag, struct solution* FlowSol);
 
+  /*! point the flux point maps of the right side at the flux point arrays of element type in_ele_type, and record the
+   first flux point of its local interface in_local_inter */
+  void set_fpts_r(int in_ele_type, int in_local_inter, struct solution* FlowSol);
+
+  /*! get the bytes of the connectivity and flux point maps of both sides, and those the arrays of pointers they
+   replace would take */
+  void get_fpts_n_bytes(long& out_n_bytes, long& out_n_bytes_ptrs);
+
   /*! move all from cpu to gpu */
   void mv_all_cpu_gpu(void);
 
   /*! calculate normal transformed continuous inviscid flux at the flux points */
   void calculate_common_invFlux(void);
 
+  /*! calculate normal transformed continuous inviscid flux at the flux points of the in_n_list interfaces of in_list */
+  void calculate_common_invFlux(int in_n_list, int* in_list);
+
   /*! calculate normal transformed continuous viscous flux at the flux points */
   void calculate_common_viscFlux(void);
 
+  /*! calculate normal transformed continuous viscous flux at the flux points of the in_n_list interfaces of in_list */
+  void calculate_common_viscFlux(int in_n_list, int* in_list);
+
   /*! calculate delta in transformed discontinuous solution at flux points */
   void calc_delta_disu_fpts(void);
 
@@ -70,17 +84,17 @@ protected:
 
   // #### members ####
   //
-  array<double*> disu_fpts_r;
-  array<double*> delta_disu_fpts_r;
-  array<double*> norm_tconf_fpts_r;
+  inters_fpts disu_fpts_r;
+  inters_fpts delta_disu_fpts_r;
+  inters_fpts norm_tconf_fpts_r;
   //array<double*> norm_tconvisf_fpts_r;
-  array<double*> detjac_fpts_r;
-  array<double*> tdA_fpts_r;
-  array<double*> grad_disu_fpts_r;
+  inters_fpts detjac_fpts_r;
+  inters_fpts tdA_fpts_r;
+  inters_fpts grad_disu_fpts_r;
 
   // Dynamic grid variables:
-  array<double*> ndA_dyn_fpts_r;
-  array<double*> J_dyn_fpts_r;
+  inters_fpts ndA_dyn_fpts_r;
+  inters_fpts J_dyn_fpts_r;
   array<double*> disu_GCL_fpts_r;
   array<double*> norm_tconf_GCL_fpts_r;
 
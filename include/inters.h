@@ -27,11 +27,14 @@
 
 #include "inters.h"
 #include "array.h"
+#include "inters_fpts.h"
 
 #ifdef _MPI
 #include "mpi.h"
 #endif
 
+struct solution; // forwards declaration
+
 class inters
 {
 public:
@@ -51,6 +54,18 @@ public:
   /*! setup inters */
   void setup_inters(int in_n_inters, int in_inter_type);
 
+  /*! set up the scratch storage of the flux evaluation, one copy per thread */
+  void setup_thread_scratch(void);
+
+  /*! get number of interfaces */
+  int get_n_inters(void);
+
+  /*! get wall time spent in the common inviscid flux evaluation (the boundary conditions for bdy_inters) */
+  double get_invFlux_time(void);
+
+  /*! get wall time spent in the common viscous flux evaluation */
+  double get_viscFlux_time(void);
+
   /*! Set normal flux to be normal * f_r */
   void right_flux(array<double> &f_r, array<double> &norm, array<double> &fn, int n_dims, int n_fields, double gamma);
 
@@ -69,8 +84,37 @@ public:
   /*! Compute common solution using LDG formulation */
   void ldg_solution(int flux_spec, array<double> &u_l, array<double> &u_r, array<double> &u_c, double pen_fact, array<double>& norm);
 
+  /*!
+   * \brief Compute the common inviscid flux of the in_n_pts flux points gathered into the batch buffers
+   *
+   * Reads batch_u_l, batch_u_r (in dynamic space), batch_norm and batch_v, and writes the common normal flux to
+   * batch_fn with the Riemann solver of riemann_solve_type and, when viscous, the LDG common solution of interior
+   * and mpi interfaces to batch_u_c.
+   */
+  void calc_common_invFlux_batch(int in_n_pts);
+
+  /*! Compute common inviscid flux using Rusanov flux for the points of the batch buffers */
+  void rusanov_flux_batch(int in_n_pts);
+
+  /*! Compute common inviscid flux using Roe flux for the points of the batch buffers (2D only) */
+  void roe_flux_batch(int in_n_pts);
+
+  /*! Compute common inviscid flux using Lax-Friedrich flux for the points of the batch buffers */
+  void lax_friedrich_batch(int in_n_pts);
+
+  /*! Compute common solution of interior and mpi interfaces using LDG formulation for the points of the batch buffers */
+  void ldg_solution_batch(int in_n_pts);
+
 	/*! get look up table for flux point connectivity based on rotation tag */
 	void get_lut(int in_rot_tag);
+
+  /*! point the flux point maps of the left side at the flux point arrays of element type in_ele_type, and record the
+   first flux point of its local interface in_local_inter */
+  void set_fpts_l(int in_ele_type, int in_local_inter, struct solution* FlowSol);
+
+  /*! get the bytes of the connectivity and flux point maps of the left side, and those the arrays of pointers they
+   replace would take */
+  void get_fpts_n_bytes(long& out_n_bytes, long& out_n_bytes_ptrs);
 	
   /*! Compute common flux at boundaries using convective flux formulation */
   void convective_flux_boundary(array<double> &f_l, array<double> &f_r, array<double> &norm, array<double> &fn, int n_dims, int n_fields);
@@ -91,63 +135,95 @@ public:
 	int n_dims;
   int motion;       //!< Mesh motion flag
 	
-	array<double*> disu_fpts_l;
-	array<double*> delta_disu_fpts_l;
-	array<double*> norm_tconf_fpts_l;
-	//array<double*> norm_tconvisf_fpts_l;
-	array<double*> detjac_fpts_l;
-	array<double*> tdA_fpts_l;
-	array<double*> norm_fpts;
-	array<double*> pos_fpts;
-  array<double*> pos_dyn_fpts;
-
-  array<double> pos_disu_fpts_l;
-  array<double*> grad_disu_fpts_l;
-  array<double*> normal_disu_fpts_l;
-
-  array<double> temp_u_l;
-  array<double> temp_u_r;
-
-  array<double> temp_grad_u_l;
-  array<double> temp_grad_u_r;
+  /*! number of flux point permutations of the connectivity: the identity and the look up table of each rotation tag */
+  int n_perms;
 
-  array<double> temp_normal_u_l;
+  /*! element types of the connectivity, those of eles and the receive buffer of mpi_inters */
+  int n_conn_types;
 
-  array<double> temp_pos_u_l;
+  /*! connectivity of the left and right sides, and the flux point values they give (n_fpts_per_inter,n_inters,...) */
+  inters_conn conn_l;
+  inters_conn conn_r;
 
-  array<double> temp_f_l;
-  array<double> temp_f_r;
-
-  array<double> temp_fn_l;
-  array<double> temp_fn_r;
+	inters_fpts disu_fpts_l;
+	inters_fpts delta_disu_fpts_l;
+	inters_fpts norm_tconf_fpts_l;
+	//array<double*> norm_tconvisf_fpts_l;
+	inters_fpts detjac_fpts_l;
+	inters_fpts tdA_fpts_l;
+	inters_fpts norm_fpts;
+	inters_fpts pos_fpts;
+  inters_fpts pos_dyn_fpts;
 
-  array<double> temp_f;
+  array<double> pos_disu_fpts_l;
+  inters_fpts grad_disu_fpts_l;
+  array<double*> normal_disu_fpts_l;
 
-  array<double> temp_loc;
+  /*! number of threads of the flux evaluation; the scratch storage below has one entry per thread, picked by
+   get_thread_num() */
+  int n_threads;
+
+  array< array<double> > temp_u_l;
+  array< array<double> > temp_u_r;
+
+  array< array<double> > temp_f_l;
+  array< array<double> > temp_f_r;
+
+  array< array<double> > temp_fn_l;
+  array< array<double> > temp_fn_r;
+
+  /*! interface normal and common normal flux at a flux point */
+  array< array<double> > temp_norm;
+  array< array<double> > temp_fn;
+
+  array< array<double> > temp_f;
+
+  /*! solution, gradient and flux at all flux points of an interface, stored as structure of arrays for the batched flux functions */
+  array< array<double> > temp_u_l_batch;
+  array< array<double> > temp_u_r_batch;
+  array< array<double> > temp_grad_u_l_batch;
+  array< array<double> > temp_grad_u_r_batch;
+  array< array<double> > temp_f_l_batch;
+  array< array<double> > temp_f_r_batch;
+
+  /*! interfaces per batch of the Riemann solvers, and the state, normal, grid velocity, flux, common normal flux,
+   common solution and a scalar of the solvers (wave speed, penalty) at the flux points of a batch
+   (n_batch_inters*n_fpts_per_inter,...), stored as structure of arrays */
+  int n_batch_inters;
+  array< array<double> > batch_u_l;
+  array< array<double> > batch_u_r;
+  array< array<double> > batch_norm;
+  array< array<double> > batch_v;
+  array< array<double> > batch_f_l;
+  array< array<double> > batch_f_r;
+  array< array<double> > batch_fn;
+  array< array<double> > batch_u_c;
+  array< array<double> > batch_eig;
 
 	// LES and wall model quantities
-	array<double*> sgsf_fpts_l;
-	array<double*> sgsf_fpts_r;
-	array<double> temp_sgsf_l;
-	array<double> temp_sgsf_r;
+	inters_fpts sgsf_fpts_l;
+	inters_fpts sgsf_fpts_r;
+	array< array<double> > temp_sgsf_l;
+	array< array<double> > temp_sgsf_r;
+
+  /*! wall time spent in the common inviscid and viscous flux evaluations on the CPU */
+  double t_invFlux;
+  double t_viscFlux;
 
   array<int> lut;
 
-  array<double> v_l, v_r, um, du;
+  // For Roe flux computation
+  array< array<double> > v_l, v_r, um, du;
 
   // Dynamic grid variables:
   // Note: grid velocity is continuous across interfaces
-  array<double*> ndA_dyn_fpts_l;
-  array<double*> norm_dyn_fpts;
-  array<double*> J_dyn_fpts_l;
-  array<double*> grid_vel_fpts;
+  inters_fpts ndA_dyn_fpts_l;
+  inters_fpts norm_dyn_fpts;
+  inters_fpts J_dyn_fpts_l;
+  inters_fpts grid_vel_fpts;
   array<double*> disu_GCL_fpts_l;
   array<double*> norm_tconf_GCL_fpts_l;
 
   double temp_u_GCL_l;
   double temp_f_GCL_l;
-
-  array<double> temp_v;
-  array<double> temp_fn_ref_l;
-  array<double> temp_fn_ref_r;
 };
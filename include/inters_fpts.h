@@ -0,0 +1,209 @@
+/*!
+ * \file inters_fpts.h
+ * \author - Original code: SD++ developed by Patrice Castonguay, Antony Jameson,
+ *                          Peter Vincent, David Williams (alphabetical by surname).
+ *         - Current development: Aerospace Computing Laboratory (ACL)
+ *                                Aero/Astro Department. Stanford University.
+ * \version 0.1.0
+ *
+ * High Fidelity Large Eddy Simulation (HiFiLES) Code.
+ * Copyright (C) 2014 Aerospace Computing Laboratory (ACL).
+ *
+ * HiFiLES is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * HiFiLES is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with HiFiLES.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "array.h"
+
+/*!
+ * \brief Connectivity of one side of the interfaces of an inters
+ *
+ * Each interface is given by the element type, element, local face and flux point permutation of the side. Flux point
+ * in_fpt of an interface is flux point first_fpt(type,local face)+lut(in_fpt,permutation) of its element. Permutation
+ * 0 is the identity, permutation 1+r the look up table of rotation tag r (inters::get_lut).
+ */
+class inters_conn
+{
+public:
+
+  /*! allocate for in_n_inters interfaces of in_n_fpts_per_inter flux points between elements of in_n_types types with
+   up to in_n_faces faces, and in_n_perms flux point permutations */
+  void setup(int in_n_inters, int in_n_fpts_per_inter, int in_n_types, int in_n_faces, int in_n_perms)
+  {
+    type.setup(in_n_inters);
+    ele.setup(in_n_inters);
+    local_face.setup(in_n_inters);
+    perm.setup(in_n_inters);
+
+    first_fpt.setup(in_n_types,in_n_faces);
+    first_fpt.initialize_to_value(-1);
+
+    lut.setup(in_n_fpts_per_inter,in_n_perms);
+    for(int j=0;j<in_n_fpts_per_inter;j++)
+      lut(j,0)=j;
+  }
+
+  /*! set permutation in_perm from the look up table in_lut */
+  void set_lut(int in_perm, array<int>& in_lut)
+  {
+    for(int j=0;j<lut.get_dim(0);j++)
+      lut(j,in_perm)=in_lut(j);
+  }
+
+  /*! set the first flux point of local face in_local_face of element type in_type */
+  void set_first_fpt(int in_type, int in_local_face, int in_fpt) { first_fpt(in_type,in_local_face)=in_fpt; }
+
+  /*! whether the first flux point of local face in_local_face of element type in_type is set */
+  bool has_first_fpt(int in_type, int in_local_face) { return first_fpt(in_type,in_local_face)>=0; }
+
+  /*! set interface in_inter */
+  void set_inter(int in_inter, int in_type, int in_ele, int in_local_face, int in_perm)
+  {
+    type(in_inter)=in_type;
+    ele(in_inter)=in_ele;
+    local_face(in_inter)=in_local_face;
+    perm(in_inter)=in_perm;
+  }
+
+  /*! element type of interface in_inter */
+  inline int get_type(int in_inter) { return type(in_inter); }
+
+  /*! element of interface in_inter */
+  inline int get_ele(int in_inter) { return ele(in_inter); }
+
+  /*! flux point of the element at flux point in_fpt of interface in_inter */
+  inline int get_fpt(int in_fpt, int in_inter) { return first_fpt(type(in_inter),local_face(in_inter))+lut(in_fpt,perm(in_inter)); }
+
+  /*! number of interfaces and flux points per interface */
+  int get_n_inters(void) { return type.get_dim(0); }
+  int get_n_fpts_per_inter(void) { return lut.get_dim(0); }
+
+  /*! bytes of storage */
+  long get_n_bytes(void)
+  {
+    return sizeof(int)*(4*(long)type.get_dim(0)+first_fpt.get_dim(0)*first_fpt.get_dim(1)+lut.get_dim(0)*lut.get_dim(1));
+  }
+
+protected:
+
+  array<int> type;
+  array<int> ele;
+  array<int> local_face;
+  array<int> perm;
+
+  array<int> first_fpt;
+  array<int> lut;
+};
+
+/*!
+ * \brief Flux point values on one side of the interfaces of an inters, indexed (in_fpt, in_inter[, in_i[, in_j]])
+ *
+ * Takes the place of an array of pointers to the flux point values of the elements: operator() returns the pointer,
+ * found from the connectivity of the side and the base and strides of the flux point array of each element type,
+ * (n_fpts_per_ele,n_eles[,n_i[,n_j]]) for the arrays of eles. The GPU kernels still take an array of pointers, which
+ * is filled when the map is moved to the GPU.
+ */
+class inters_fpts
+{
+public:
+
+  inters_fpts() : conn(NULL) {}
+
+  /*! use connectivity in_conn, for values with extents in_n_i and in_n_j beyond the flux point and interface */
+  void setup(inters_conn* in_conn, int in_n_types, int in_n_i=1, int in_n_j=1)
+  {
+    conn=in_conn;
+    n_i=in_n_i;
+    n_j=in_n_j;
+
+    base.setup(in_n_types);
+    s_ele.setup(in_n_types);
+    s_i.setup(in_n_types);
+    s_j.setup(in_n_types);
+
+    for(int t=0;t<in_n_types;t++)
+      base(t)=NULL;
+  }
+
+  /*! whether values of element type in_type are set */
+  bool has_type(int in_type) { return conn!=NULL && base(in_type)!=NULL; }
+
+  /*! set the values of element type in_type, entry (fpt,ele,i,j) at in_base+fpt+in_s_ele*ele+in_s_i*i+in_s_j*j */
+  void set_type(int in_type, double* in_base, int in_s_ele, int in_s_i, int in_s_j)
+  {
+    base(in_type)=in_base;
+    s_ele(in_type)=in_s_ele;
+    s_i(in_type)=in_s_i;
+    s_j(in_type)=in_s_j;
+  }
+
+  /*! set the values of element type in_type from a flux point array of eles, in_n_fpts_per_ele by in_n_eles by n_i */
+  void set_type_ele_array(int in_type, double* in_base, int in_n_fpts_per_ele, int in_n_eles)
+  {
+    set_type(in_type,in_base,in_n_fpts_per_ele,in_n_fpts_per_ele*in_n_eles,in_n_fpts_per_ele*in_n_eles*n_i);
+  }
+
+  /*! pointer to an entry */
+  inline double* operator() (int in_fpt, int in_inter, int in_i=0, int in_j=0)
+  {
+    int t=conn->get_type(in_inter);
+    return base(t)+conn->get_fpt(in_fpt,in_inter)+s_ele(t)*conn->get_ele(in_inter)+s_i(t)*in_i+s_j(t)*in_j;
+  }
+
+  /*! bytes an array of pointers to the entries would take */
+  long get_n_bytes_ptrs(void)
+  {
+    if(conn==NULL)
+      return 0;
+
+    return sizeof(double*)*(long)conn->get_n_fpts_per_inter()*conn->get_n_inters()*n_i*n_j;
+  }
+
+  /*! fill the array of pointers of the GPU kernels and move it to the GPU */
+  void mv_cpu_gpu(void)
+  {
+    if(conn==NULL)
+      return;
+
+    int n_fpts_per_inter=conn->get_n_fpts_per_inter();
+    int n_inters=conn->get_n_inters();
+
+    ptrs.setup(n_fpts_per_inter,n_inters,n_i,n_j);
+
+    for(int i=0;i<n_inters;i++)
+      for(int k=0;k<n_i;k++)
+        for(int l=0;l<n_j;l++)
+          for(int j=0;j<n_fpts_per_inter;j++)
+            ptrs(j,i,k,l)=(*this)(j,i,k,l);
+
+    ptrs.mv_cpu_gpu();
+  }
+
+  /*! GPU array of pointers */
+  double** get_ptr_gpu(void) { return ptrs.get_ptr_gpu(); }
+
+protected:
+
+  inters_conn* conn;
+  int n_i;
+  int n_j;
+
+  array<double*> base;
+  array<int> s_ele;
+  array<int> s_i;
+  array<int> s_j;
+
+  array<double*> ptrs;
+};
@@ -0,0 +1,122 @@
+/*!
+ * \file local_time_stepping.h
+ * \author - Original code: SD++ developed by Patrice Castonguay, Antony Jameson,
+ *                          Peter Vincent, David Williams (alphabetical by surname).
+ *         - Current development: Aerospace Computing Laboratory (ACL)
+ *                                Aero/Astro Department. Stanford University.
+ * \version 0.1.0
+ *
+ * High Fidelity Large Eddy Simulation (HiFiLES) Code.
+ * Copyright (C) 2014 Aerospace Computing Laboratory (ACL).
+ *
+ * HiFiLES is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * HiFiLES is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with HiFiLES.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "array.h"
+#include "mesh.h"
+#include "solution.h"
+
+/*!
+ * \brief Multi-rate local time stepping of RK45 (lts_levels > 1, adv_type 3, dt_type 1).
+ *
+ * Each element gets a level l from its timestep, the largest with dt_min*2^l within it (dt_min the global minimum),
+ * below lts_levels and at most one above the levels of its neighbours. A step advances the coarsest level by one RK45
+ * step, then each finer level by two steps of half its timestep, recursively, the coarser first. The residual of a
+ * level is evaluated on its elements and the neighbours its interface fluxes (and corrected gradients) reach: finer
+ * neighbours are at the start of the step, coarser ones are interpolated linearly in time between the two ends of
+ * theirs. On the faces between levels the coarser element then takes the flux the finer one saw over its steps in
+ * place of the flux of its own stages, so that the scheme stays conservative. The levels are set again every step.
+ */
+class local_time_stepping
+{
+public:
+
+  // #### constructors ####
+
+  // default constructor
+  local_time_stepping();
+
+  // #### methods ####
+
+  /*! allocate the element and interface lists of the levels of FlowSol and Mesh */
+  void setup(struct solution* FlowSol, mesh& Mesh);
+
+  /*! advance the solution by one step of the coarsest level, and leave its size in run_input.dt */
+  void advance(int in_file_num);
+
+protected:
+
+  /*! set the level of every element and the lists of each level */
+  void set_levels(int in_file_num);
+
+  /*! values of in_cell_values of the cells across the MPI faces, per MPI interface type */
+  void exchange_cell_values(array<int>& in_cell_values, array< array<int> >& out_values);
+
+  /*! value across face in_face of cell in_cell, of a local neighbour from in_cell_values or of one across an MPI
+   face from in_mpi_values, -1 without a neighbour */
+  int get_neighbour_value(int in_cell, int in_face, array<int>& in_cell_values, array< array<int> >& in_mpi_values);
+
+  /*! advance the elements of level in_level, then the finer levels twice, from time in_time */
+  void step_level(int in_level, double in_time);
+
+  /*! residual of the elements of level in_level, the flux on the faces between levels is added to the flux difference
+   with weight in_flux_weight */
+  void calc_residual(int in_level, double in_flux_weight);
+
+  /*! add element in_ele to the runs of consecutive elements in_runs (two per run, start and end), n_runs of them */
+  void add_to_runs(int in_ele, int* in_runs, int& n_runs);
+
+  // #### members ####
+
+  /*! solution structure and mesh */
+  struct solution* FlowSol;
+  mesh* Mesh;
+
+  /*! number of levels, and the number in use this step on all partitions */
+  int n_levels;
+  int n_levels_used;
+
+  /*! global minimum timestep of the step */
+  double dt_min;
+
+  /*! RK45 coefficients, stage times and the weight of each stage in the step */
+  array<double> rk_a, rk_b, rk_c, rk_w;
+
+  /*! timestep, level and levels reached by the interface fluxes (bit l set for the elements of level l and their
+   neighbours) of each cell */
+  array<double> cell_dt;
+  array<int> cell_level, cell_mask;
+
+  /*! start of the current timestep of each level, and the fraction of it reached by the stage being evaluated */
+  array<double> level_time;
+  array<double> level_theta;
+
+  /*! per element type, level of each element, and the lists of each level (capacity,n_levels), with their lengths
+   (n_levels): elements of the level (runs), elements whose solution is extrapolated (runs) and whose gradient is
+   computed (runs, viscous), coarser elements among them (list), elements of the level with finer neighbours (runs)
+   and the faces between levels (element, local face and sign) */
+  array< array<int> > ele_level;
+  array< array<int> > ele_runs, sol_runs, grad_runs, interp_list, reflux_runs, couple_list;
+  array< array<int> > n_ele_runs, n_sol_runs, n_grad_runs, n_interp_list, n_reflux_runs, n_couple_list;
+
+  /*! per interface type, the interior and boundary interfaces of the inviscid pass (faces of the extrapolated and
+   gradient elements when viscous) and of the viscous pass (faces of the elements of the level), with their lengths */
+  array< array<int> > int_inv_list, int_visc_list, bdy_inv_list, bdy_visc_list;
+  array< array<int> > n_int_inv_list, n_int_visc_list, n_bdy_inv_list, n_bdy_visc_list;
+
+  /*! per MPI interface type, the cell of each interface, the values sent across and those of the cells across */
+  array< array<int> > mpi_cell, mpi_send, mpi_level, mpi_mask;
+};
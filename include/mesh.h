@@ -103,6 +103,13 @@ public:
   f2c,f2loc_f,c2f,c2e,f2v,f2n_v,e2v,v2n_e;
   array<array<int> > v2e;
 
+  /** neighbouring cell across each face of a cell (interior and periodic faces, -1 otherwise), set for the implicit solver
+      and local time stepping */
+  array<int> c2c;
+
+  /** interface of each face: kind (0 interior, 1 boundary, 2 MPI), type and index (-1 for none), set for local time stepping */
+  array<int> f2inter;
+
   /** #### Boundary information #### */
 
   int n_bnds, n_faces;
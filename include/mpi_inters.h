@@ -64,6 +64,9 @@ public:
 
   void receive_solution();
 
+  /*! send in_values, one per interface, across the interfaces and receive the values of the other partitions */
+  void exchange_inter_values(array<int>& in_values, array<int>& out_values);
+
   void send_corrected_gradient();
 
   void receive_corrected_gradient();
@@ -74,6 +77,10 @@ public:
 
   void set_mpi(int in_inter, int in_ele_type_l, int in_ele_l, int in_local_inter_l, int rot_tag, struct solution* FlowSol);
 
+  /*! get the bytes of the connectivity and flux point maps of both sides, and those the arrays of pointers they
+   replace would take */
+  void get_fpts_n_bytes(long& out_n_bytes, long& out_n_bytes_ptrs);
+
   void calculate_common_invFlux(void);
   void calculate_common_viscFlux(void);
 
@@ -84,8 +91,8 @@ protected:
 
   // #### members ####
 
-  array<double*> disu_fpts_r;
-  array<double*> grad_disu_fpts_r;
+  inters_fpts disu_fpts_r;
+  inters_fpts grad_disu_fpts_r;
 
   int nproc;
   int rank;
@@ -100,6 +107,11 @@ protected:
   // LES
   array<double> out_buffer_sgsf, in_buffer_sgsf;
 
+  // Single precision copies of the buffers for the mixed precision mode
+  array<float> out_buffer_disu_sp, in_buffer_disu_sp;
+  array<float> out_buffer_grad_disu_sp, in_buffer_grad_disu_sp;
+  array<float> out_buffer_sgsf_sp, in_buffer_sgsf_sp;
+
 #ifdef _MPI
   MPI_Request *mpi_out_requests;
   MPI_Request *mpi_in_requests;
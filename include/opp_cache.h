@@ -0,0 +1,91 @@
+/*!
+ * \file opp_cache.h
+ * \author - Original code: SD++ developed by Patrice Castonguay, Antony Jameson,
+ *                          Peter Vincent, David Williams (alphabetical by surname).
+ *         - Current development: Aerospace Computing Laboratory (ACL)
+ *                                Aero/Astro Department. Stanford University.
+ * \version 0.1.0
+ *
+ * High Fidelity Large Eddy Simulation (HiFiLES) Code.
+ * Copyright (C) 2014 Aerospace Computing Laboratory (ACL).
+ *
+ * HiFiLES is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * HiFiLES is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with HiFiLES.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include "array.h"
+
+/*! version of the operator cache file format, increase when the format or the operators change */
+#define OPP_CACHE_VERSION 1
+
+/*!
+ * \brief Binary file of the reference element operators of one element type (opp_cache 1).
+ *
+ * The file holds a version number, a key of the integer and real parameters the operators depend on, and
+ * the operators by name. It is only read if the version and key match exactly, and an operator is only
+ * copied into an array of the same dimensions, so a stale or foreign file is ignored and rewritten.
+ */
+class opp_cache
+{
+public:
+
+  // #### constructors ####
+
+  // default constructor
+  opp_cache();
+
+  // #### methods ####
+
+  /*! read in_file_name if it was written with the same version and key, an empty file name disables the cache */
+  void setup(string in_file_name, array<int>& in_key_int, array<double>& in_key_double);
+
+  /*! copy operator in_name into out_opp, which has its dimensions set; false if it is not cached */
+  bool get(string in_name, array<double>& out_opp);
+
+  /*! add or replace operator in_name */
+  void put(string in_name, array<double>& in_opp);
+
+  /*! copy operators in_name(i) into out_opps(i), false unless all are cached */
+  bool get(string in_name, array< array<double> >& out_opps);
+
+  /*! add or replace operators in_name(i) */
+  void put(string in_name, array< array<double> >& in_opps);
+
+  /*! write the file if operators were added since it was read, through a temporary file of rank in_rank */
+  void write(int in_rank);
+
+protected:
+
+  /*! read the file, false if it is missing or does not match */
+  bool read(void);
+
+  // #### members ####
+
+  /*! cache file, empty when disabled */
+  string file_name;
+
+  /*! key the file must have been written with */
+  array<int> key_int;
+  array<double> key_double;
+
+  /*! cached operators and their names */
+  vector<string> names;
+  vector< array<double> > opps;
+
+  /*! whether operators were added since the file was read */
+  bool modified;
+};
@@ -77,6 +77,9 @@ void HistoryOutput(int in_file_num, clock_t init, ofstream *write_hist, struct s
 /*! check if the solution is bounded !*/
 void check_stability(struct solution* FlowSol);
 
+/*! print the number of interfaces and the wall time of their common flux evaluation, per kind and type of interface */
+void InterfaceTimingOutput(struct solution* FlowSol);
+
 #ifdef _GPU
 /*! copy solution and gradients from GPU to CPU for above routines !*/
 void CopyGPUCPU(struct solution* FlowSol);
@@ -0,0 +1,91 @@
+/*!
+ * \file pmultigrid.h
+ * \author - Original code: SD++ developed by Patrice Castonguay, Antony Jameson,
+ *                          Peter Vincent, David Williams (alphabetical by surname).
+ *         - Current development: Aerospace Computing Laboratory (ACL)
+ *                                Aero/Astro Department. Stanford University.
+ * \version 0.1.0
+ *
+ * High Fidelity Large Eddy Simulation (HiFiLES) Code.
+ * Copyright (C) 2014 Aerospace Computing Laboratory (ACL).
+ *
+ * HiFiLES is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * HiFiLES is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with HiFiLES.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "array.h"
+#include "mesh.h"
+#include "solution.h"
+
+/*!
+ * \brief p-multigrid acceleration of the explicit time integration (p_multigrid 1).
+ *
+ * The same mesh is set up at orders order-1, ..., pmg_min_order. Each step is a full approximation scheme V-cycle:
+ * pmg_n_smooth steps of the time integration scheme of adv_type on a level, then the solution and the right-hand side
+ * are restricted to the next lower order, which is advanced with the forcing that makes its right-hand side equal the
+ * restricted one at the restricted solution, and the change of its solution is prolongated back before another
+ * pmg_n_smooth steps. The prolongation evaluates the nodal basis of the lower order at the solution points of the
+ * higher one, the restriction is the least squares fit of the lower order polynomial to the solution point values.
+ */
+class pmultigrid
+{
+public:
+
+  // #### constructors ####
+
+  // default constructor
+  pmultigrid();
+
+  // #### methods ####
+
+  /*! set up the lower orders of the mesh of FlowSol and the operators between the orders */
+  void setup(struct solution* FlowSol);
+
+  /*! advance the solution by one V-cycle */
+  void cycle(int in_file_num);
+
+protected:
+
+  /*! V-cycle from level in_level down */
+  void cycle_level(int in_file_num, int in_level);
+
+  /*! advance level in_level by pmg_n_smooth steps of the time integration scheme */
+  void smooth(int in_file_num, int in_level);
+
+  /*! right-hand side of level in_level, without its forcing, per element type ordered as in get_disu_upts_dofs */
+  void calc_rhs(int in_file_num, int in_level, array< array<double> >& out_rhs);
+
+  // #### members ####
+
+  /*! number of levels, level 0 is the solution being advanced and level l has order order-l */
+  int n_levels;
+
+  /*! solution and mesh of each level, those of level 0 belong to the caller */
+  array<struct solution*> FlowSol_levels;
+  array<mesh*> Mesh_levels;
+
+  /*! prolongation (n_upts_per_ele of level l,n_upts_per_ele of level l+1) and restriction of each level and
+   element type */
+  array< array< array<double> > > opp_prolong;
+  array< array< array<double> > > opp_restrict;
+
+  /*! restricted solution and forcing of each level and element type, ordered as in get_disu_upts_dofs */
+  array< array< array<double> > > disu_restricted;
+  array< array< array<double> > > forcing;
+
+  /*! solution and right-hand side of each level and element type while the cycle is on the lower orders */
+  array< array< array<double> > > disu_work;
+  array< array< array<double> > > rhs_work;
+};
@@ -49,6 +49,12 @@
  */
 void CalcResidual(int in_file_num, int in_rk_stage, struct solution* FlowSol);
 
+/*!
+ * \brief Advance the solution by one physical timestep of dual time stepping (adv_type 5).
+ * \param[in] FlowSol - Structure with the entire solution and mesh information.
+ */
+void DualTimeStep(int in_file_num, struct solution* FlowSol);
+
 void set_rank_nproc(int in_rank, int in_nproc, struct solution* FlowSol);
 
 /*! get pointer to transformed discontinuous solution at a flux point */
@@ -94,7 +100,7 @@ double* get_delta_disu_fpts_ptr(int in_ele_type, int in_ele, int in_field, int n
 double* get_grad_disu_fpts_ptr(int in_ele_type, int in_ele, int in_local_inter, int in_field, int in_dim, int in_fpt, struct solution* FlowSol);
 
 /*! get pointer to the closest normal point of the discontinuous solution at a flux point */
-double* get_normal_disu_fpts_ptr(int in_ele_type, int in_ele, int in_local_inter, int in_field, int in_fpt, struct solution* FlowSol, array<double> temp_loc, double temp_pos[3]);
+double* get_normal_disu_fpts_ptr(int in_ele_type, int in_ele, int in_local_inter, int in_field, int in_fpt, struct solution* FlowSol, array<double>& temp_loc, double temp_pos[3]);
 
 /*! get pointer to the grid velocity at a flux point */
 double* get_grid_vel_fpts_ptr(int in_ele_type, int in_ele, int in_local_inter, int in_fpt, int in_dim, struct solution* FlowSol);
@@ -35,6 +35,9 @@
 #include "../include/solver.h"
 #include "../include/output.h"
 #include "../include/solution.h"
+#include "../include/implicit_solver.h"
+#include "../include/pmultigrid.h"
+#include "../include/local_time_stepping.h"
 
 #ifdef _MPI
 #include "mpi.h"
@@ -44,6 +47,10 @@
 #include "util.h"
 #endif
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 using namespace std;
 
 int main(int argc, char *argv[]) {
@@ -54,9 +61,13 @@ int main(int argc, char *argv[]) {
   int RKSteps;                        /*!< Number of RK steps */
   ifstream run_input_file;            /*!< Config input file */
   clock_t init_time, final_time;                /*!< To control the time */
+  long n_allocs_start, n_allocs_steps = 0;      /*!< Array allocations made by the time-step loop */
   struct solution FlowSol;            /*!< Main structure with the flow solution and geometry */
   ofstream write_hist;                /*!< Output files (forces, statistics, and history) */
   mesh Mesh;                          /*!< Store mesh details & perform mesh motion */
+  implicit_solver Implicit;           /*!< Pseudo-time stepping of adv_type 4 */
+  pmultigrid PMG;                     /*!< Lower orders of p_multigrid */
+  local_time_stepping LTS;            /*!< Levels of local time stepping */
   
   /*! Check the command line input. */
   
@@ -90,6 +101,15 @@ int main(int argc, char *argv[]) {
 
   run_input.setup(argv[1], rank);
   
+  /*! Set the number of threads used by the element kernels. */
+  
+#ifdef _OPENMP
+  if (run_input.n_threads > 0)
+    omp_set_num_threads(run_input.n_threads);
+  
+  if (rank == 0) cout << "OpenMP threads per process: " << omp_get_max_threads() << endl;
+#endif
+  
   /*! Set the input values in the FlowSol structure. */
   
   SetInput(&FlowSol);
@@ -100,6 +120,12 @@ int main(int argc, char *argv[]) {
   
   InitSolution(&FlowSol);
   
+  if (FlowSol.adv_type == 4) Implicit.setup(&FlowSol, Mesh);
+  
+  if (run_input.p_multigrid) PMG.setup(&FlowSol);
+  
+  if (run_input.lts_levels > 1) LTS.setup(&FlowSol, Mesh);
+  
   init_time = clock();
   
   /////////////////////////////////////////////////
@@ -156,32 +182,61 @@ int main(int argc, char *argv[]) {
     if (FlowSol.adv_type == 0) RKSteps = 1;
     if (FlowSol.adv_type == 3) RKSteps = 5;
     
-    for(i=0; i < RKSteps; i++) {
+    n_allocs_start = array_n_allocs();
+    
+    /*! Backward Euler pseudo-time step. */
+    
+    if (FlowSol.adv_type == 4) {
+      Implicit.advance(FlowSol.ini_iter+i_steps);
+    }
 
-      /* If using moving mesh, need to advance the Geometric Conservation Law
-       * (GCL) first to get updated Jacobians. Necessary to preserve freestream
-       * on arbitrarily deforming mesh. See Kui Ou's Ph.D. thesis for details. */
-      if (run_input.motion > 0) {
+    /*! BDF2 physical timestep, converged in pseudo time. */
 
-        /* Update the mesh */
-        Mesh.move(FlowSol.ini_iter+i_steps,i,&FlowSol);
+    else if (FlowSol.adv_type == 5) {
+      DualTimeStep(FlowSol.ini_iter+i_steps, &FlowSol);
+    }
 
-      }
+    /*! p-multigrid V-cycle. */
 
-      /*! Spatial integration. */
+    else if (run_input.p_multigrid) {
+      PMG.cycle(FlowSol.ini_iter+i_steps);
+    }
+
+    /*! RK45 step of the coarsest level of local time stepping, the finer levels in it. */
+
+    else if (run_input.lts_levels > 1) {
+      LTS.advance(FlowSol.ini_iter+i_steps);
+    }
+    else {
+      for(i=0; i < RKSteps; i++) {
+
+        /* If using moving mesh, need to advance the Geometric Conservation Law
+         * (GCL) first to get updated Jacobians. Necessary to preserve freestream
+         * on arbitrarily deforming mesh. See Kui Ou's Ph.D. thesis for details. */
+        if (run_input.motion > 0) {
+
+          /* Update the mesh */
+          Mesh.move(FlowSol.ini_iter+i_steps,i,&FlowSol);
+
+        }
 
-      CalcResidual(FlowSol.ini_iter+i_steps, i, &FlowSol);
+        /*! Spatial integration. */
+
+        CalcResidual(FlowSol.ini_iter+i_steps, i, &FlowSol);
       
-      /*! Time integration usign a RK scheme */
+        /*! Time integration usign a RK scheme */
       
-      for(j=0; j<FlowSol.n_ele_types; j++) {
+        for(j=0; j<FlowSol.n_ele_types; j++) {
         
-        FlowSol.mesh_eles(j)->AdvanceSolution(i, FlowSol.adv_type);
+          FlowSol.mesh_eles(j)->AdvanceSolution(i, FlowSol.adv_type);
         
-      }
+        }
       
+      }
     }
 
+    n_allocs_steps += array_n_allocs()-n_allocs_start;
+
     /*! Update total time, and increase the iteration index. */
     
     FlowSol.time += run_input.dt;
@@ -247,6 +302,10 @@ int main(int argc, char *argv[]) {
   /// End simulation
   /////////////////////////////////////////////////
   
+  /*! Print the time of the interface flux evaluation. */
+
+  InterfaceTimingOutput(&FlowSol);
+
   /*! Close convergence history file. */
   
   if (rank == 0) {
@@ -256,6 +315,7 @@ int main(int argc, char *argv[]) {
   
   final_time = clock()-init_time;
   printf("Execution time= %f s\n", (double) final_time/((double) CLOCKS_PER_SEC));
+  printf("Array allocations in time steps= %ld\n", n_allocs_steps);
     }
   /*! Finalize MPI. */
   
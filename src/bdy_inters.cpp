@@ -25,6 +25,7 @@
 
 #include <iostream>
 #include <cmath>
+#include <climits>
 
 #include "../include/global.h"
 #include "../include/array.h"
@@ -73,6 +74,24 @@ void bdy_inters::setup(int in_n_inters, int in_inters_type)
   boundary_type.setup(in_n_inters);
   set_bdy_params();
 
+  // in set-up order until set_bdy_groups
+  bdy_group_inters.setup(max(1,in_n_inters));
+  for(int i=0;i<in_n_inters;i++)
+    bdy_group_inters(i)=i;
+
+  if(viscous)
+    {
+      int n_batch = n_batch_inters*n_fpts_per_inter;
+
+      batch_grad_u_l.setup(n_threads);
+      batch_grad_u_r.setup(n_threads);
+
+      for(int t=0;t<n_threads;t++)
+        {
+          batch_grad_u_l(t).setup(n_batch,n_fields,n_dims);
+          batch_grad_u_r(t).setup(n_batch,n_fields,n_dims);
+        }
+    }
 }
 
 void bdy_inters::set_bdy_params()
@@ -112,70 +131,9 @@ void bdy_inters::set_boundary(int in_inter, int bdy_type, int in_ele_type_l, int
 {
   boundary_type(in_inter) = bdy_type;
 
-      for(int i=0;i<n_fields;i++)
-        {
-          for(int j=0;j<n_fpts_per_inter;j++)
-            {
-              disu_fpts_l(j,in_inter,i)=get_disu_fpts_ptr(in_ele_type_l,in_ele_l,i,in_local_inter_l,j,FlowSol);
-
-              norm_tconf_fpts_l(j,in_inter,i)=get_norm_tconf_fpts_ptr(in_ele_type_l,in_ele_l,i,in_local_inter_l,j,FlowSol);
-
-              if(viscous)
-                {
-                  delta_disu_fpts_l(j,in_inter,i)=get_delta_disu_fpts_ptr(in_ele_type_l,in_ele_l,i,in_local_inter_l,j,FlowSol);
-                }
-            }
-        }
-
-      for(int i=0;i<n_fields;i++)
-        {
-          for(int j=0;j<n_fpts_per_inter;j++)
-            {
-              for(int k=0; k<n_dims; k++)
-                {
-                  if(viscous)
-                    {
-                      grad_disu_fpts_l(j,in_inter,i,k) = get_grad_disu_fpts_ptr(in_ele_type_l,in_ele_l,in_local_inter_l,i,k,j,FlowSol);
-                    }
-
-                  // Subgrid-scale flux
-                  if(LES)
-                    {
-                      sgsf_fpts_l(j,in_inter,i,k) = get_sgsf_fpts_ptr(in_ele_type_l,in_ele_l,in_local_inter_l,i,k,j,FlowSol);
-                    }
-                }
-            }
-        }
-
-      for(int j=0;j<n_fpts_per_inter;j++)
-        {
-          tdA_fpts_l(j,in_inter)=get_tdA_fpts_ptr(in_ele_type_l,in_ele_l,in_local_inter_l,j,FlowSol);
-
-          if (motion) {
-            ndA_dyn_fpts_l(j,in_inter)=get_ndA_dyn_fpts_ptr(in_ele_type_l,in_ele_l,in_local_inter_l,j,FlowSol);
-            J_dyn_fpts_l(j,in_inter)=get_detjac_dyn_fpts_ptr(in_ele_type_l,in_ele_l,in_local_inter_l,j,FlowSol);
-            //if (run_input.GCL)
-              //disu_GCL_fpts_l(j,in_inter)=get_disu_GCL_fpts_ptr(in_ele_type_l,in_ele_l,in_local_inter_l,j,FlowSol);
-          }
-
-          for(int k=0;k<n_dims;k++)
-            {
-              norm_fpts(j,in_inter,k)=get_norm_fpts_ptr(in_ele_type_l,in_ele_l,in_local_inter_l,j,k,FlowSol);
-
-              if (motion) {
-                norm_dyn_fpts(j,in_inter,k)=get_norm_dyn_fpts_ptr(in_ele_type_l,in_ele_l,in_local_inter_l,j,k,FlowSol);
-                grid_vel_fpts(j,in_inter,k)=get_grid_vel_fpts_ptr(in_ele_type_l,in_ele_l,in_local_inter_l,j,k,FlowSol);
-                pos_dyn_fpts(j,in_inter,k)=get_pos_dyn_fpts_ptr_cpu(in_ele_type_l,in_ele_l,in_local_inter_l,j,k,FlowSol);
-              }
+      conn_l.set_inter(in_inter,in_ele_type_l,in_ele_l,in_local_inter_l,0);
 
-#ifdef _CPU
-              pos_fpts(j,in_inter,k)=get_loc_fpts_ptr_cpu(in_ele_type_l,in_ele_l,in_local_inter_l,j,k,FlowSol);
-#endif
-#ifdef _GPU
-              pos_fpts(j,in_inter,k)=get_loc_fpts_ptr_gpu(in_ele_type_l,in_ele_l,in_local_inter_l,j,k,FlowSol);
-#endif
-            }
-        }
+      set_fpts_l(in_ele_type_l,in_local_inter_l,FlowSol);
 
       // Get coordinates and solution at closest solution points to boundary
 
@@ -202,6 +160,44 @@ void bdy_inters::set_boundary(int in_inter, int bdy_type, int in_ele_type_l, int
 //      }
 }
 
+// group the interfaces by boundary type, keeping the set-up order within each type
+
+void bdy_inters::set_bdy_groups(void)
+{
+  for(int i=0;i<n_inters;i++)
+    bdy_group_inters(i)=i;
+
+  sort_by_bdy_type(n_inters,bdy_group_inters.get_ptr_cpu());
+}
+
+// sort the in_n_list boundary interfaces of in_list by boundary type, keeping their order within a type
+
+void bdy_inters::sort_by_bdy_type(int in_n_list, int* in_list)
+{
+  array<int> sorted(max(1,in_n_list));
+  int n_sorted=0;
+  int type=INT_MIN;
+
+  // collect the interfaces of each type in turn, in increasing order of type (there are only a few types)
+  while(n_sorted<in_n_list)
+    {
+      int next_type=INT_MAX;
+
+      for(int ii=0;ii<in_n_list;ii++)
+        if(boundary_type(in_list[ii])>type)
+          next_type=min(next_type,boundary_type(in_list[ii]));
+
+      for(int ii=0;ii<in_n_list;ii++)
+        if(boundary_type(in_list[ii])==next_type)
+          sorted(n_sorted++)=in_list[ii];
+
+      type=next_type;
+    }
+
+  for(int ii=0;ii<in_n_list;ii++)
+    in_list[ii]=sorted(ii);
+}
+
 // move all from cpu to gpu
 
 void bdy_inters::mv_all_cpu_gpu(void)
@@ -243,230 +239,372 @@ void bdy_inters::mv_all_cpu_gpu(void)
 /*! Calculate normal transformed continuous inviscid flux at the flux points on the boundaries.*/
 
 void bdy_inters::evaluate_boundaryConditions_invFlux(double time_bound) {
+  evaluate_boundaryConditions_invFlux(time_bound,n_inters,NULL);
+}
 
-#ifdef _CPU
-  array<double> norm(n_dims), fn(n_fields);
+/*! Calculate normal transformed continuous inviscid flux at the flux points of the in_n_list boundary interfaces of
+ in_list, or of all of them without a list (on the GPU, always all). The interfaces are evaluated n_batch_inters of one
+ boundary type at a time, so the list should be sorted by boundary type (see sort_by_bdy_type). */
+
+void bdy_inters::evaluate_boundaryConditions_invFlux(double time_bound, int in_n_list, int* in_list) {
 
-  //viscous
-  int bdy_spec, flux_spec;
-  array<double> u_c(n_fields);
+#ifdef _CPU
+  int* list = (in_list ? in_list : bdy_group_inters.get_ptr_cpu());
 
+  double t_start = get_wall_time();
 
-  for(int i=0;i<n_inters;i++)
+#pragma omp parallel
   {
-    for(int j=0;j<n_fpts_per_inter;j++)
+    // Batch buffers of this thread
+    int thr = get_thread_num();
+    array<double>& batch_u_l = this->batch_u_l(thr);
+    array<double>& batch_norm = this->batch_norm(thr);
+    array<double>& batch_v = this->batch_v(thr);
+    array<double>& batch_fn = this->batch_fn(thr);
+    array<double>& batch_u_c = this->batch_u_c(thr);
+
+    // Chunks of n_batch_inters interfaces of the list, each split where the boundary type changes
+#pragma omp for schedule(static)
+    for(int ii_chunk=0;ii_chunk<in_n_list;ii_chunk+=n_batch_inters)
     {
+      int ii_end = min(ii_chunk+n_batch_inters,in_n_list);
 
-      /*! storing normal components and flux points location */
-        if (motion) {
-          for (int m=0;m<n_dims;m++)
-            norm(m) = *norm_dyn_fpts(j,i,m);
-        }else{
-          for (int m=0;m<n_dims;m++)
-            norm(m) = *norm_fpts(j,i,m);
-        }
+      for(int ii_start=ii_chunk;ii_start<ii_end;)
+      {
+        // Block of interfaces of one boundary type
+        int bdy_type = boundary_type(list[ii_start]);
+        int n_block = 1;
 
-        /*! calculate discontinuous solution at flux points */
-        for(int k=0;k<n_fields;k++)
-          temp_u_l(k)=(*disu_fpts_l(j,i,k));
+        while(ii_start+n_block<ii_end && boundary_type(list[ii_start+n_block])==bdy_type)
+          n_block++;
 
-        if (motion) {
-          // Transform solution to dynamic space
-          for (int k=0; k<n_fields; k++) {
-            temp_u_l(k) /= (*J_dyn_fpts_l(j,i));
-          }
-          // Get dynamic grid velocity
-          for(int k=0; k<n_dims; k++) {
-            temp_v(k)=(*grid_vel_fpts(j,i,k));
-          }
-          // Get dynamic-physical flux point location
-          for (int m=0;m<n_dims;m++)
-            temp_loc(m) = *pos_dyn_fpts(j,i,m);
-        }else{
-          // Get static-physical flux point location
-          for (int m=0;m<n_dims;m++)
-            temp_loc(m) = *pos_fpts(j,i,m);
-
-          temp_v.initialize_to_zero();
-        }
+        int n_pts = n_block*n_fpts_per_inter;
+
+        // Gather the discontinuous solution (in dynamic space), the normal and the grid velocity
+        for(int b=0;b<n_block;b++)
+        {
+          int i=list[ii_start+b];
+          int p0=b*n_fpts_per_inter;
 
-        set_inv_boundary_conditions(boundary_type(i),temp_u_l.get_ptr_cpu(),temp_u_r.get_ptr_cpu(),temp_v.get_ptr_cpu(),norm.get_ptr_cpu(),temp_loc.get_ptr_cpu(),bdy_params.get_ptr_cpu(),n_dims,n_fields,run_input.gamma,run_input.R_ref,time_bound,run_input.equation);
+          for(int k=0;k<n_fields;k++)
+            for(int j=0;j<n_fpts_per_inter;j++)
+              batch_u_l(p0+j,k)=(*disu_fpts_l(j,i,k));
 
-        /*! calculate flux from discontinuous solution at flux points */
-        if(n_dims==2) {
-          calc_invf_2d(temp_u_l,temp_f_l);
-          calc_invf_2d(temp_u_r,temp_f_r);
-          if(motion) {
-            calc_alef_2d(temp_u_l,temp_v,temp_f_l);
-            calc_alef_2d(temp_u_r,temp_v,temp_f_r);
+          if (motion) {
+            for(int k=0;k<n_fields;k++)
+              for(int j=0;j<n_fpts_per_inter;j++)
+                batch_u_l(p0+j,k) /= (*J_dyn_fpts_l(j,i));
+
+            for(int m=0;m<n_dims;m++) {
+              for(int j=0;j<n_fpts_per_inter;j++) {
+                batch_norm(p0+j,m)=(*norm_dyn_fpts(j,i,m));
+                batch_v(p0+j,m)=(*grid_vel_fpts(j,i,m));
+              }
+            }
           }
-        }
-        else if(n_dims==3) {
-          calc_invf_3d(temp_u_l,temp_f_l);
-          calc_invf_3d(temp_u_r,temp_f_r);
-          if(motion) {
-            calc_alef_3d(temp_u_l,temp_v,temp_f_l);
-            calc_alef_3d(temp_u_r,temp_v,temp_f_r);
+          else {
+            for(int m=0;m<n_dims;m++)
+              for(int j=0;j<n_fpts_per_inter;j++)
+                batch_norm(p0+j,m)=(*norm_fpts(j,i,m));
           }
         }
-        else
-          FatalError("ERROR: Invalid number of dimensions ... ");
 
+        set_inv_boundary_conditions_batch(bdy_type,n_pts);
 
-          if (boundary_type(i)==16) // Dual consistent BC
-            {
-              /*! Set Normal flux to be right flux */
-              right_flux(temp_f_l,norm,fn,n_dims,n_fields,run_input.gamma);
-            }
-          else // Call Riemann solver
-            {
-              /*! Calling Riemann solver */
-              if (run_input.riemann_solve_type==0) { //Rusanov
-                  convective_flux_boundary(temp_f_l,temp_f_r,norm,fn,n_dims,n_fields);
-                }
-              else if (run_input.riemann_solve_type==1) { // Lax-Friedrich
-                  lax_friedrich(temp_u_l,temp_u_r,norm,fn,n_dims,n_fields,run_input.lambda,run_input.wave_speed);
-                }
-              else if (run_input.riemann_solve_type==2) { // ROE
-                  roe_flux(temp_u_l,temp_u_r,temp_v,norm,fn,n_dims,n_fields,run_input.gamma);
-                }
+        calc_bdy_invFlux_batch(bdy_type,n_pts);
+
+        // Scatter the common flux transformed back to reference space, and the solution corrections
+        for(int b=0;b<n_block;b++)
+        {
+          int i=list[ii_start+b];
+          int p0=b*n_fpts_per_inter;
+
+          for(int k=0;k<n_fields;k++) {
+            for(int j=0;j<n_fpts_per_inter;j++) {
+              if (motion)
+                (*norm_tconf_fpts_l(j,i,k))=batch_fn(p0+j,k)*(*ndA_dyn_fpts_l(j,i))*(*tdA_fpts_l(j,i));
               else
-                FatalError("Riemann solver not implemented");
-            }
+                (*norm_tconf_fpts_l(j,i,k))=batch_fn(p0+j,k)*(*tdA_fpts_l(j,i));
 
-          /*! Transform back to reference space */
-          if (motion) {
-            for(int k=0;k<n_fields;k++) {
-              (*norm_tconf_fpts_l(j,i,k))=fn(k)*(*ndA_dyn_fpts_l(j,i))*(*tdA_fpts_l(j,i));
-            }
-          }
-          else
-          {
-            for(int k=0;k<n_fields;k++) {
-              (*norm_tconf_fpts_l(j,i,k))=fn(k)*(*tdA_fpts_l(j,i));
+              if(viscous) {
+                if (motion) // Transform back to static-physical domain
+                  *delta_disu_fpts_l(j,i,k) = (batch_u_c(p0+j,k) - batch_u_l(p0+j,k))*(*J_dyn_fpts_l(j,i));
+                else
+                  *delta_disu_fpts_l(j,i,k) = (batch_u_c(p0+j,k) - batch_u_l(p0+j,k));
+              }
             }
           }
+        }
+
+        ii_start += n_block;
+      }
+    }
+  }
+
+  t_invFlux += get_wall_time()-t_start;
+
+#endif
+
+#ifdef _GPU
+  if (n_inters!=0)
+    evaluate_boundaryConditions_invFlux_gpu_kernel_wrapper(n_fpts_per_inter,n_dims,n_fields,n_inters,disu_fpts_l.get_ptr_gpu(),norm_tconf_fpts_l.get_ptr_gpu(),tdA_fpts_l.get_ptr_gpu(),ndA_dyn_fpts_l.get_ptr_gpu(),J_dyn_fpts_l.get_ptr_gpu(),norm_fpts.get_ptr_gpu(),norm_dyn_fpts.get_ptr_gpu(),pos_fpts.get_ptr_gpu(),pos_dyn_fpts.get_ptr_gpu(),grid_vel_fpts.get_ptr_gpu(),boundary_type.get_ptr_gpu(),bdy_params.get_ptr_gpu(),run_input.riemann_solve_type,delta_disu_fpts_l.get_ptr_gpu(),run_input.gamma,run_input.R_ref,viscous,motion,run_input.vis_riemann_solve_type, time_bound, run_input.wave_speed(0),run_input.wave_speed(1),run_input.wave_speed(2),run_input.lambda,run_input.equation,run_input.turb_model);
+#endif
+}
 
-          if(viscous)
+// common inviscid flux, and common solution when viscous, at the flux points of the batch buffers
+
+void bdy_inters::calc_bdy_invFlux_batch(int in_bdy_type, int in_n_pts)
+{
+  // Batch buffers of this thread
+  int thr = get_thread_num();
+  array<double>& batch_u_l = this->batch_u_l(thr);
+  array<double>& batch_u_r = this->batch_u_r(thr);
+  array<double>& batch_norm = this->batch_norm(thr);
+  array<double>& batch_v = this->batch_v(thr);
+  array<double>& batch_f_l = this->batch_f_l(thr);
+  array<double>& batch_f_r = this->batch_f_r(thr);
+  array<double>& batch_fn = this->batch_fn(thr);
+  array<double>& batch_u_c = this->batch_u_c(thr);
+  array<double>& batch_eig = this->batch_eig(thr);
+
+  int n_batch = batch_u_l.get_dim(0);
+
+  if (in_bdy_type==16 || run_input.riemann_solve_type==0)
+    {
+      // flux from discontinuous solution at flux points
+      if(n_dims==2) {
+          calc_invf_2d_batch(in_n_pts,n_fields,batch_u_l.get_ptr_cpu(),n_batch,batch_f_l.get_ptr_cpu(),n_batch);
+          calc_invf_2d_batch(in_n_pts,n_fields,batch_u_r.get_ptr_cpu(),n_batch,batch_f_r.get_ptr_cpu(),n_batch);
+        }
+      else if(n_dims==3) {
+          calc_invf_3d_batch(in_n_pts,n_fields,batch_u_l.get_ptr_cpu(),n_batch,batch_f_l.get_ptr_cpu(),n_batch);
+          calc_invf_3d_batch(in_n_pts,n_fields,batch_u_r.get_ptr_cpu(),n_batch,batch_f_r.get_ptr_cpu(),n_batch);
+        }
+      else
+        FatalError("ERROR: Invalid number of dimensions ... ");
+
+      // additional ALE flux term, as in calc_alef_2d/calc_alef_3d
+      if (motion)
+        {
+          int n_ale_fields = (run_input.equation==0 ? n_dims+2 : 1);
+
+          for(int k=0;k<n_ale_fields;k++)
+            for(int l=0;l<n_dims;l++)
+              {
+                double* f_l = batch_f_l.get_ptr_cpu(0,k,l);
+                double* f_r = batch_f_r.get_ptr_cpu(0,k,l);
+                double* u_l = batch_u_l.get_ptr_cpu(0,k);
+                double* u_r = batch_u_r.get_ptr_cpu(0,k);
+                double* v = batch_v.get_ptr_cpu(0,l);
+
+                for(int p=0;p<in_n_pts;p++) {
+                    f_l[p] -= u_l[p]*v[p];
+                    f_r[p] -= u_r[p]*v[p];
+                  }
+              }
+        }
+
+      for(int k=0;k<n_fields;k++)
+        {
+          double* fn = batch_fn.get_ptr_cpu(0,k);
+
+          if (in_bdy_type==16) // Dual consistent BC: normal flux is the flux of the left state
             {
-              /*! boundary specification */
-              bdy_spec = boundary_type(i);
+              for(int p=0;p<in_n_pts;p++)
+                fn[p] = 0.;
 
-              if(bdy_spec == 12 || bdy_spec == 14)
-                flux_spec = 2;
-              else
-                flux_spec = 1;
+              for(int l=0;l<n_dims;l++)
+                {
+                  double* f_l = batch_f_l.get_ptr_cpu(0,k,l);
+                  double* n = batch_norm.get_ptr_cpu(0,l);
 
-              // Calling viscous riemann solver
-              if (run_input.vis_riemann_solve_type==0)
-                ldg_solution(flux_spec,temp_u_l,temp_u_r,u_c,run_input.pen_fact,norm);
-              else
-                FatalError("Viscous Riemann solver not implemented");
+                  for(int p=0;p<in_n_pts;p++)
+                    fn[p] += f_l[p]*n[p];
+                }
+            }
+          else // Central flux of the two states, as in convective_flux_boundary
+            {
+              double* fn_l = batch_eig.get_ptr_cpu();
 
-              if (motion) {
-                // Transform back to static-physical domain
-                for(int k=0;k<n_fields;k++){
-                  *delta_disu_fpts_l(j,i,k) = (u_c(k) - temp_u_l(k))*(*J_dyn_fpts_l(j,i));
+              for(int p=0;p<in_n_pts;p++) {
+                  fn_l[p] = 0.;
+                  fn[p] = 0.;
                 }
-              }
-              else
-              {
-                for(int k=0;k<n_fields;k++){
-                  *delta_disu_fpts_l(j,i,k) = (u_c(k) - temp_u_l(k));
+
+              for(int l=0;l<n_dims;l++)
+                {
+                  double* f_l = batch_f_l.get_ptr_cpu(0,k,l);
+                  double* f_r = batch_f_r.get_ptr_cpu(0,k,l);
+                  double* n = batch_norm.get_ptr_cpu(0,l);
+
+                  for(int p=0;p<in_n_pts;p++) {
+                      fn_l[p] += f_l[p]*n[p];
+                      fn[p] += f_r[p]*n[p];
+                    }
                 }
-              }
+
+              for(int p=0;p<in_n_pts;p++)
+                fn[p] = 0.5*(fn_l[p]+fn[p]);
             }
+        }
+    }
+  else if (run_input.riemann_solve_type==1) // Lax-Friedrich
+    lax_friedrich_batch(in_n_pts);
+  else if (run_input.riemann_solve_type==2) // ROE
+    roe_flux_batch(in_n_pts);
+  else
+    FatalError("Riemann solver not implemented");
+
+  // Common solution of the LDG formulation, the same on all boundaries
+  if(viscous)
+    {
+      if (run_input.vis_riemann_solve_type!=0)
+        FatalError("Viscous Riemann solver not implemented");
+
+      for(int k=0;k<n_fields;k++)
+        {
+          double* u_l = batch_u_l.get_ptr_cpu(0,k);
+          double* u_r = batch_u_r.get_ptr_cpu(0,k);
+          double* u_c = batch_u_c.get_ptr_cpu(0,k);
 
+          for(int p=0;p<in_n_pts;p++)
+            u_c[p] = 0.5 * ( u_r[p] + u_l[p] );
         }
     }
+}
 
-#endif
+// primitive variables of the conservative state at u, with the fields in_stride apart
 
-#ifdef _GPU
-  if (n_inters!=0)
-    evaluate_boundaryConditions_invFlux_gpu_kernel_wrapper(n_fpts_per_inter,n_dims,n_fields,n_inters,disu_fpts_l.get_ptr_gpu(),norm_tconf_fpts_l.get_ptr_gpu(),tdA_fpts_l.get_ptr_gpu(),ndA_dyn_fpts_l.get_ptr_gpu(),J_dyn_fpts_l.get_ptr_gpu(),norm_fpts.get_ptr_gpu(),norm_dyn_fpts.get_ptr_gpu(),pos_fpts.get_ptr_gpu(),pos_dyn_fpts.get_ptr_gpu(),grid_vel_fpts.get_ptr_gpu(),boundary_type.get_ptr_gpu(),bdy_params.get_ptr_gpu(),run_input.riemann_solve_type,delta_disu_fpts_l.get_ptr_gpu(),run_input.gamma,run_input.R_ref,viscous,motion,run_input.vis_riemann_solve_type, time_bound, run_input.wave_speed(0),run_input.wave_speed(1),run_input.wave_speed(2),run_input.lambda,run_input.equation,run_input.turb_model);
-#endif
+static inline void get_primitives(int in_n_dims, double in_gamma, double* u, int in_stride, double& rho, double* v, double& e, double& p)
+{
+  double v_sq;
+
+  rho = u[0];
+  for (int i=0; i<in_n_dims; i++)
+    v[i] = u[(i+1)*in_stride]/u[0];
+  e = u[(in_n_dims+1)*in_stride];
+
+  v_sq = 0.;
+  for (int i=0; i<in_n_dims; i++)
+    v_sq += (v[i]*v[i]);
+  p = (in_gamma-1.0)*(e - 0.5*rho*v_sq);
 }
 
-void bdy_inters::set_inv_boundary_conditions(int bdy_type, double* u_l, double* u_r, double* v_g, double *norm, double *loc, double *bdy_params, int n_dims, int n_fields, double gamma, double R_ref, double time_bound, int equation)
+// conservative state at u, with the fields in_stride apart, from density, velocity and energy
+
+static inline void set_conservatives(int in_n_dims, double rho, double* v, double e, double* u, int in_stride)
 {
+  u[0] = rho;
+  for (int i=0; i<in_n_dims; i++)
+    u[(i+1)*in_stride] = rho*v[i];
+  u[(in_n_dims+1)*in_stride] = e;
+}
+
+// right hand side state at the flux points of the batch buffers: the branch on the boundary type and the boundary
+// parameters are taken out of the loops over the points
+
+void bdy_inters::set_inv_boundary_conditions_batch(int in_bdy_type, int in_n_pts)
+{
+  // Batch buffers of this thread
+  int thr = get_thread_num();
+  array<double>& batch_u_l = this->batch_u_l(thr);
+  array<double>& batch_u_r = this->batch_u_r(thr);
+  array<double>& batch_norm = this->batch_norm(thr);
+  array<double>& batch_v = this->batch_v(thr);
+
+  int n_batch = batch_u_l.get_dim(0);
+  double* u_l = batch_u_l.get_ptr_cpu();
+  double* u_r = batch_u_r.get_ptr_cpu();
+  double* v_g = batch_v.get_ptr_cpu();
+  double* norm = batch_norm.get_ptr_cpu();
+
+  double gamma = run_input.gamma;
+  double R_ref = run_input.R_ref;
+  bool sa = (run_input.turb_model == 1);
+
+  double rho_bound = bdy_params(0);
+  double v_bound[3] = {bdy_params(1), bdy_params(2), bdy_params(3)};
+  double p_bound = bdy_params(4);
+  double v_wall[3] = {bdy_params(5), bdy_params(6), bdy_params(7)};
+  double T_wall = bdy_params(8);
+  double p_total_bound = bdy_params(9);
+  double T_total_bound = bdy_params(10);
+  double n_free_stream[3] = {bdy_params(11), bdy_params(12), bdy_params(13)};
+  double mu_tilde_inf = bdy_params(14);
+
   double rho_l, rho_r;
-  double v_l[n_dims], v_r[n_dims];
+  double v_l[3], v_r[3];
   double e_l, e_r;
   double p_l, p_r;
   double T_r;
   double vn_l;
   double v_sq;
-  double rho_bound = bdy_params[0];
-  double* v_bound = &bdy_params[1];
-  double p_bound = bdy_params[4];
-  double* v_wall = &bdy_params[5];
-  double T_wall = bdy_params[8];
 
   // Navier-Stokes Boundary Conditions
-  if(equation==0)
+  if(run_input.equation==0)
     {
-      // Store primitive variables for clarity
-      rho_l = u_l[0];
-      for (int i=0; i<n_dims; i++)
-        v_l[i] = u_l[i+1]/u_l[0];
-      e_l = u_l[n_dims+1];
-
-      // Compute pressure on left side
-      v_sq = 0.;
-      for (int i=0; i<n_dims; i++)
-        v_sq += (v_l[i]*v_l[i]);
-      p_l = (gamma-1.0)*(e_l - 0.5*rho_l*v_sq);
+      double* mu_tilde_l = u_l+(n_dims+2)*n_batch;
+      double* mu_tilde_r = u_r+(n_dims+2)*n_batch;
 
       // Subsonic inflow simple (free pressure) //CONSIDER DELETING
-      if(bdy_type == 1)
+      if(in_bdy_type == 1)
         {
           // fix density and velocity
           rho_r = rho_bound;
           for (int i=0; i<n_dims; i++)
             v_r[i] = v_bound[i];
 
-          // extrapolate pressure
-          p_r = p_l;
-
-          // compute energy
           v_sq = 0.;
           for (int i=0; i<n_dims; i++)
             v_sq += (v_r[i]*v_r[i]);
-          e_r = (p_r/(gamma-1.0)) + 0.5*rho_r*v_sq;
 
-          // SA model
-          if (run_input.turb_model == 1)
-          {
-            // set turbulent eddy viscosity
-            double mu_tilde_inf = bdy_params[14];
-            u_r[n_dims+2] = mu_tilde_inf;
-          }
+          for (int p=0; p<in_n_pts; p++)
+            {
+              get_primitives(n_dims,gamma,u_l+p,n_batch,rho_l,v_l,e_l,p_l);
+
+              // extrapolate pressure
+              p_r = p_l;
+
+              // compute energy
+              e_r = (p_r/(gamma-1.0)) + 0.5*rho_r*v_sq;
+
+              set_conservatives(n_dims,rho_r,v_r,e_r,u_r+p,n_batch);
+            }
+
+          // SA model: set turbulent eddy viscosity
+          if (sa)
+            for (int p=0; p<in_n_pts; p++)
+              mu_tilde_r[p] = mu_tilde_inf;
         }
 
       // Subsonic outflow simple (fixed pressure) //CONSIDER DELETING
-      else if(bdy_type == 2)
+      else if(in_bdy_type == 2)
         {
-          // extrapolate density and velocity
-          rho_r = rho_l;
-          for (int i=0; i<n_dims; i++)
-            v_r[i] = v_l[i];
+          for (int p=0; p<in_n_pts; p++)
+            {
+              get_primitives(n_dims,gamma,u_l+p,n_batch,rho_l,v_l,e_l,p_l);
 
-          // fix pressure
-          p_r = p_bound;
+              // extrapolate density and velocity
+              rho_r = rho_l;
+              for (int i=0; i<n_dims; i++)
+                v_r[i] = v_l[i];
 
-          // compute energy
-          v_sq = 0.;
-          for (int i=0; i<n_dims; i++)
-            v_sq += (v_r[i]*v_r[i]);
-          e_r = (p_r/(gamma-1.0)) + 0.5*rho_r*v_sq;
+              // fix pressure
+              p_r = p_bound;
 
-          // SA model
-          if (run_input.turb_model == 1)
-          {
-            // extrapolate turbulent eddy viscosity
-            u_r[n_dims+2] = u_l[n_dims+2];
-          }
+              // compute energy
+              v_sq = 0.;
+              for (int i=0; i<n_dims; i++)
+                v_sq += (v_r[i]*v_r[i]);
+              e_r = (p_r/(gamma-1.0)) + 0.5*rho_r*v_sq;
+
+              set_conservatives(n_dims,rho_r,v_r,e_r,u_r+p,n_batch);
+            }
+
+          // SA model: extrapolate turbulent eddy viscosity
+          if (sa)
+            for (int p=0; p<in_n_pts; p++)
+              mu_tilde_r[p] = mu_tilde_l[p];
         }
 
       // Subsonic inflow characteristic
@@ -474,7 +612,7 @@ void bdy_inters::set_inv_boundary_conditions(int bdy_type, double* u_l, double*
       // all but one state variable at the inlet. The outgoing Riemann invariant
       // provides the final piece of info. Adapted from an implementation in
       // SU2.
-      else if(bdy_type == 3)
+      else if(in_bdy_type == 3)
         {
           double V_r;
           double c_l, c_r_sq, c_total_sq;
@@ -482,83 +620,82 @@ void bdy_inters::set_inv_boundary_conditions(int bdy_type, double* u_l, double*
           double aa, bb, cc, dd;
           double Mach_sq, alpha;
 
-          // Specify Inlet conditions
-          double p_total_bound = bdy_params[9];
-          double T_total_bound = bdy_params[10];
-          double *n_free_stream = &bdy_params[11];
+          // Specify total enthalpy
+          h_total = gamma*R_ref/(gamma-1.0)*T_total_bound;
 
-          // Compute normal velocity on left side
-          vn_l = 0.;
-          for (int i=0; i<n_dims; i++)
-            vn_l += v_l[i]*norm[i];
+          for (int p=0; p<in_n_pts; p++)
+            {
+              get_primitives(n_dims,gamma,u_l+p,n_batch,rho_l,v_l,e_l,p_l);
 
-          // Compute speed of sound
-          c_l = sqrt(gamma*p_l/rho_l);
+              // Compute normal velocity on left side
+              vn_l = 0.;
+              for (int i=0; i<n_dims; i++)
+                vn_l += v_l[i]*norm[p+i*n_batch];
 
-          // Extrapolate Riemann invariant
-          R_plus = vn_l + 2.0*c_l/(gamma-1.0);
+              // Compute speed of sound
+              c_l = sqrt(gamma*p_l/rho_l);
 
-          // Specify total enthalpy
-          h_total = gamma*R_ref/(gamma-1.0)*T_total_bound;
+              // Extrapolate Riemann invariant
+              R_plus = vn_l + 2.0*c_l/(gamma-1.0);
 
-          // Compute total speed of sound squared
-          v_sq = 0.;
-          for (int i=0; i<n_dims; i++)
-            v_sq += v_l[i]*v_l[i];
-          c_total_sq = (gamma-1.0)*(h_total - (e_l/rho_l + p_l/rho_l) + 0.5*v_sq) + c_l*c_l;
+              // Compute total speed of sound squared
+              v_sq = 0.;
+              for (int i=0; i<n_dims; i++)
+                v_sq += v_l[i]*v_l[i];
+              c_total_sq = (gamma-1.0)*(h_total - (e_l/rho_l + p_l/rho_l) + 0.5*v_sq) + c_l*c_l;
 
-          // Dot product of normal flow velocity
-          alpha = 0.;
-          for (int i=0; i<n_dims; i++)
-            alpha += norm[i]*n_free_stream[i];
-
-          // Coefficients of quadratic equation
-          aa = 1.0 + 0.5*(gamma-1.0)*alpha*alpha;
-          bb = -(gamma-1.0)*alpha*R_plus;
-          cc = 0.5*(gamma-1.0)*R_plus*R_plus - 2.0*c_total_sq/(gamma-1.0);
-
-          // Solve quadratic equation for velocity on right side
-          // (Note: largest value will always be the positive root)
-          // (Note: Will be set to zero if NaN)
-          dd = bb*bb - 4.0*aa*cc;
-          dd = sqrt(max(dd, 0.0));
-          V_r = (-bb + dd)/(2.0*aa);
-          V_r = max(V_r, 0.0);
-          v_sq = V_r*V_r;
-
-          // Compute speed of sound
-          c_r_sq = c_total_sq - 0.5*(gamma-1.0)*v_sq;
-
-          // Compute Mach number (cutoff at Mach = 1.0)
-          Mach_sq = v_sq/(c_r_sq);
-          Mach_sq = min(Mach_sq, 1.0);
-          v_sq = Mach_sq*c_r_sq;
-          V_r = sqrt(v_sq);
-          c_r_sq = c_total_sq - 0.5*(gamma-1.0)*v_sq;
-
-          // Compute velocity (based on free stream direction)
-          for (int i=0; i<n_dims; i++)
-            v_r[i] = V_r*n_free_stream[i];
+              // Dot product of normal flow velocity
+              alpha = 0.;
+              for (int i=0; i<n_dims; i++)
+                alpha += norm[p+i*n_batch]*n_free_stream[i];
+
+              // Coefficients of quadratic equation
+              aa = 1.0 + 0.5*(gamma-1.0)*alpha*alpha;
+              bb = -(gamma-1.0)*alpha*R_plus;
+              cc = 0.5*(gamma-1.0)*R_plus*R_plus - 2.0*c_total_sq/(gamma-1.0);
+
+              // Solve quadratic equation for velocity on right side
+              // (Note: largest value will always be the positive root)
+              // (Note: Will be set to zero if NaN)
+              dd = bb*bb - 4.0*aa*cc;
+              dd = sqrt(max(dd, 0.0));
+              V_r = (-bb + dd)/(2.0*aa);
+              V_r = max(V_r, 0.0);
+              v_sq = V_r*V_r;
+
+              // Compute speed of sound
+              c_r_sq = c_total_sq - 0.5*(gamma-1.0)*v_sq;
+
+              // Compute Mach number (cutoff at Mach = 1.0)
+              Mach_sq = v_sq/(c_r_sq);
+              Mach_sq = min(Mach_sq, 1.0);
+              v_sq = Mach_sq*c_r_sq;
+              V_r = sqrt(v_sq);
+              c_r_sq = c_total_sq - 0.5*(gamma-1.0)*v_sq;
+
+              // Compute velocity (based on free stream direction)
+              for (int i=0; i<n_dims; i++)
+                v_r[i] = V_r*n_free_stream[i];
 
-          // Compute temperature
-          T_r = c_r_sq/(gamma*R_ref);
+              // Compute temperature
+              T_r = c_r_sq/(gamma*R_ref);
 
-          // Compute pressure
-          p_r = p_total_bound*pow(T_r/T_total_bound, gamma/(gamma-1.0));
+              // Compute pressure
+              p_r = p_total_bound*pow(T_r/T_total_bound, gamma/(gamma-1.0));
 
-          // Compute density
-          rho_r = p_r/(R_ref*T_r);
+              // Compute density
+              rho_r = p_r/(R_ref*T_r);
 
-          // Compute energy
-          e_r = (p_r/(gamma-1.0)) + 0.5*rho_r*v_sq;
+              // Compute energy
+              e_r = (p_r/(gamma-1.0)) + 0.5*rho_r*v_sq;
 
-          // SA model
-          if (run_input.turb_model == 1)
-          {
-            // set turbulent eddy viscosity
-            double mu_tilde_inf = bdy_params[14];
-            u_r[n_dims+2] = mu_tilde_inf;
-          }
+              set_conservatives(n_dims,rho_r,v_r,e_r,u_r+p,n_batch);
+            }
+
+          // SA model: set turbulent eddy viscosity
+          if (sa)
+            for (int p=0; p<in_n_pts; p++)
+              mu_tilde_r[p] = mu_tilde_inf;
         }
 
       // Subsonic outflow characteristic
@@ -567,64 +704,67 @@ void bdy_inters::set_inv_boundary_conditions(int bdy_type, double* u_l, double*
       // variables. Compute the entropy and the acoustic Riemann variable.
       // These invariants, as well as the tangential velocity components,
       // are extrapolated. Adapted from an implementation in SU2.
-      else if(bdy_type == 4)
+      else if(in_bdy_type == 4)
         {
           double c_l, c_r;
           double R_plus, s;
           double vn_r;
 
-          // Compute normal velocity on left side
-          vn_l = 0.;
-          for (int i=0; i<n_dims; i++)
-            vn_l += v_l[i]*norm[i];
+          for (int p=0; p<in_n_pts; p++)
+            {
+              get_primitives(n_dims,gamma,u_l+p,n_batch,rho_l,v_l,e_l,p_l);
 
-          // Compute speed of sound
-          c_l = sqrt(gamma*p_l/rho_l);
+              // Compute normal velocity on left side
+              vn_l = 0.;
+              for (int i=0; i<n_dims; i++)
+                vn_l += v_l[i]*norm[p+i*n_batch];
 
-          // Extrapolate Riemann invariant
-          R_plus = vn_l + 2.0*c_l/(gamma-1.0);
+              // Compute speed of sound
+              c_l = sqrt(gamma*p_l/rho_l);
 
-          // Extrapolate entropy
-          s = p_l/pow(rho_l,gamma);
+              // Extrapolate Riemann invariant
+              R_plus = vn_l + 2.0*c_l/(gamma-1.0);
 
-          // fix pressure on the right side
-          p_r = p_bound;
+              // Extrapolate entropy
+              s = p_l/pow(rho_l,gamma);
 
-          // Compute density
-          rho_r = pow(p_r/s, 1.0/gamma);
+              // fix pressure on the right side
+              p_r = p_bound;
 
-          // Compute speed of sound
-          c_r = sqrt(gamma*p_r/rho_r);
+              // Compute density
+              rho_r = pow(p_r/s, 1.0/gamma);
 
-          // Compute normal velocity
-          vn_r = R_plus - 2.0*c_r/(gamma-1.0);
+              // Compute speed of sound
+              c_r = sqrt(gamma*p_r/rho_r);
 
-          // Compute velocity and energy
-          v_sq = 0.;
-          for (int i=0; i<n_dims; i++)
-            {
-              v_r[i] = v_l[i] + (vn_r - vn_l)*norm[i];
-              v_sq += (v_r[i]*v_r[i]);
+              // Compute normal velocity
+              vn_r = R_plus - 2.0*c_r/(gamma-1.0);
+
+              // Compute velocity and energy
+              v_sq = 0.;
+              for (int i=0; i<n_dims; i++)
+                {
+                  v_r[i] = v_l[i] + (vn_r - vn_l)*norm[p+i*n_batch];
+                  v_sq += (v_r[i]*v_r[i]);
+                }
+              e_r = (p_r/(gamma-1.0)) + 0.5*rho_r*v_sq;
+
+              set_conservatives(n_dims,rho_r,v_r,e_r,u_r+p,n_batch);
             }
-          e_r = (p_r/(gamma-1.0)) + 0.5*rho_r*v_sq;
 
-          // SA model
-          if (run_input.turb_model == 1)
-          {
-            // extrapolate turbulent eddy viscosity
-            u_r[n_dims+2] = u_l[n_dims+2];
-          }
+          // SA model: extrapolate turbulent eddy viscosity
+          if (sa)
+            for (int p=0; p<in_n_pts; p++)
+              mu_tilde_r[p] = mu_tilde_l[p];
         }
 
       // Supersonic inflow
-      else if(bdy_type == 5)
+      else if(in_bdy_type == 5)
         {
-          // fix density and velocity
+          // fix density, velocity and pressure
           rho_r = rho_bound;
           for (int i=0; i<n_dims; i++)
             v_r[i] = v_bound[i];
-
-          // fix pressure
           p_r = p_bound;
 
           // compute energy
@@ -632,144 +772,116 @@ void bdy_inters::set_inv_boundary_conditions(int bdy_type, double* u_l, double*
           for (int i=0; i<n_dims; i++)
             v_sq += (v_r[i]*v_r[i]);
           e_r = (p_r/(gamma-1.0)) + 0.5*rho_r*v_sq;
-        }
 
+          for (int p=0; p<in_n_pts; p++)
+            set_conservatives(n_dims,rho_r,v_r,e_r,u_r+p,n_batch);
+        }
 
       // Supersonic outflow
-      else if(bdy_type == 6)
+      else if(in_bdy_type == 6)
         {
           // extrapolate density, velocity, energy
-          rho_r = rho_l;
-          for (int i=0; i<n_dims; i++)
-            v_r[i] = v_l[i];
-          e_r = e_l;
+          for (int p=0; p<in_n_pts; p++)
+            {
+              get_primitives(n_dims,gamma,u_l+p,n_batch,rho_l,v_l,e_l,p_l);
+              set_conservatives(n_dims,rho_l,v_l,e_l,u_r+p,n_batch);
+            }
         }
 
       // Slip wall
-      else if(bdy_type == 7)
+      else if(in_bdy_type == 7)
         {
-          // extrapolate density
-          rho_r = rho_l;
+          for (int p=0; p<in_n_pts; p++)
+            {
+              get_primitives(n_dims,gamma,u_l+p,n_batch,rho_l,v_l,e_l,p_l);
 
-          // Compute normal velocity on left side
-          vn_l = 0.;
-          for (int i=0; i<n_dims; i++)
-            vn_l += (v_l[i]-v_g[i])*norm[i];
+              // Compute normal velocity on left side
+              vn_l = 0.;
+              for (int i=0; i<n_dims; i++)
+                vn_l += (v_l[i]-v_g[p+i*n_batch])*norm[p+i*n_batch];
 
-          // reflect normal velocity
-          for (int i=0; i<n_dims; i++)
-            v_r[i] = v_l[i] - 2.0*vn_l*norm[i];
+              // reflect normal velocity
+              for (int i=0; i<n_dims; i++)
+                v_r[i] = v_l[i] - 2.0*vn_l*norm[p+i*n_batch];
 
-          // extrapolate energy
-          e_r = e_l;
+              // extrapolate density and energy
+              set_conservatives(n_dims,rho_l,v_r,e_l,u_r+p,n_batch);
+            }
         }
 
-      // Isothermal, no-slip wall (fixed)
-      else if(bdy_type == 11)
+      // Isothermal, no-slip wall (fixed: v_wall is not used) and (moving)
+      else if(in_bdy_type == 11 || in_bdy_type == 13)
         {
-          // Set state for the right side
-          // extrapolate pressure
-          p_r = p_l;
-
           // isothermal temperature
           T_r = T_wall;
 
-          // density
-          rho_r = p_r/(R_ref*T_r);
-
-          // no-slip
-          for (int i=0; i<n_dims; i++)
-            v_r[i] = v_g[i];
-
-          // energy
-          v_sq = 0.;
-          for (int i=0; i<n_dims; i++)
-            v_sq += (v_r[i]*v_r[i]);
+          if (in_bdy_type == 11)
+            v_wall[0] = v_wall[1] = v_wall[2] = 0.;
 
-          e_r = (p_r/(gamma-1.0)) + 0.5*rho_r*v_sq;
+          for (int p=0; p<in_n_pts; p++)
+            {
+              get_primitives(n_dims,gamma,u_l+p,n_batch,rho_l,v_l,e_l,p_l);
 
-          // SA model
-          if (run_input.turb_model == 1)
-          {
-            // zero turbulent eddy viscosity at the wall
-            u_r[n_dims+2] = 0.0;
-          }
-        }
+              // extrapolate pressure
+              p_r = p_l;
 
-      // Adiabatic, no-slip wall (fixed)
-      else if(bdy_type == 12)
-        {
-          // extrapolate density
-          rho_r = rho_l; // only useful part
+              // density
+              rho_r = p_r/(R_ref*T_r);
 
-          // extrapolate pressure
-          p_r = p_l;
-
-          // no-slip
-          for (int i=0; i<n_dims; i++)
-            v_r[i] = v_g[i];
+              // no-slip
+              for (int i=0; i<n_dims; i++)
+                v_r[i] = v_wall[i] + v_g[p+i*n_batch];
 
-          // energy
-          v_sq = 0.;
-          for (int i=0; i<n_dims; i++)
-            v_sq += (v_r[i]*v_r[i]);
+              // energy
+              v_sq = 0.;
+              for (int i=0; i<n_dims; i++)
+                v_sq += (v_r[i]*v_r[i]);
+              e_r = (p_r/(gamma-1.0)) + 0.5*rho_r*v_sq;
 
-          e_r = (p_r/(gamma-1.0)) + 0.5*rho_r*v_sq;
+              set_conservatives(n_dims,rho_r,v_r,e_r,u_r+p,n_batch);
+            }
 
-          // SA model
-          if (run_input.turb_model == 1)
-          {
-            // zero turbulent eddy viscosity at the wall
-            u_r[n_dims+2] = 0.0;
-          }
+          // SA model: zero turbulent eddy viscosity at the fixed wall
+          if (sa && in_bdy_type == 11)
+            for (int p=0; p<in_n_pts; p++)
+              mu_tilde_r[p] = 0.0;
         }
 
-      // Isothermal, no-slip wall (moving)
-      else if(bdy_type == 13)
+      // Adiabatic, no-slip wall (fixed: v_wall is not used) and (moving)
+      else if(in_bdy_type == 12 || in_bdy_type == 14)
         {
-          // extrapolate pressure
-          p_r = p_l;
-
-          // isothermal temperature
-          T_r = T_wall;
-
-          // density
-          rho_r = p_r/(R_ref*T_r);
+          if (in_bdy_type == 12)
+            v_wall[0] = v_wall[1] = v_wall[2] = 0.;
 
-          // no-slip
-          for (int i=0; i<n_dims; i++)
-            v_r[i] = v_wall[i] + v_g[i];
+          for (int p=0; p<in_n_pts; p++)
+            {
+              get_primitives(n_dims,gamma,u_l+p,n_batch,rho_l,v_l,e_l,p_l);
 
-          // energy
-          v_sq = 0.;
-          for (int i=0; i<n_dims; i++)
-            v_sq += (v_r[i]*v_r[i]);
+              // extrapolate density and pressure
+              rho_r = rho_l;
+              p_r = p_l;
 
-          e_r = (p_r/(gamma-1.0)) + 0.5*rho_r*v_sq;
-        }
-
-      // Adiabatic, no-slip wall (moving)
-      else if(bdy_type == 14)
-        {
-          // extrapolate density
-          rho_r = rho_l;
+              // no-slip
+              for (int i=0; i<n_dims; i++)
+                v_r[i] = v_wall[i] + v_g[p+i*n_batch];
 
-          // extrapolate pressure
-          p_r = p_l;
+              // energy
+              v_sq = 0.;
+              for (int i=0; i<n_dims; i++)
+                v_sq += (v_r[i]*v_r[i]);
+              e_r = (p_r/(gamma-1.0)) + 0.5*rho_r*v_sq;
 
-          // no-slip
-          for (int i=0; i<n_dims; i++)
-            v_r[i] = v_wall[i] + v_g[i];
+              set_conservatives(n_dims,rho_r,v_r,e_r,u_r+p,n_batch);
+            }
 
-          // energy
-          v_sq = 0.;
-          for (int i=0; i<n_dims; i++)
-            v_sq += (v_r[i]*v_r[i]);
-          e_r = (p_r/(gamma-1.0)) + 0.5*rho_r*v_sq;
+          // SA model: zero turbulent eddy viscosity at the fixed wall
+          if (sa && in_bdy_type == 12)
+            for (int p=0; p<in_n_pts; p++)
+              mu_tilde_r[p] = 0.0;
         }
 
       // Characteristic
-      else if (bdy_type == 15)
+      else if (in_bdy_type == 15)
         {
           double c_star;
           double vn_star;
@@ -779,120 +891,117 @@ void bdy_inters::set_inv_boundary_conditions(int bdy_type, double* u_l, double*
           double one_over_s;
           double h_free_stream;
 
-          // Compute normal velocity on left side
-          vn_l = 0.;
-          for (int i=0; i<n_dims; i++)
-            vn_l += v_l[i]*norm[i];
+          for (int p=0; p<in_n_pts; p++)
+            {
+              get_primitives(n_dims,gamma,u_l+p,n_batch,rho_l,v_l,e_l,p_l);
 
-          vn_bound = 0;
-          for (int i=0; i<n_dims; i++)
-            vn_bound += v_bound[i]*norm[i];
+              // Compute normal velocity on left side
+              vn_l = 0.;
+              for (int i=0; i<n_dims; i++)
+                vn_l += v_l[i]*norm[p+i*n_batch];
 
-          r_plus  = vn_l + 2./(gamma-1.)*sqrt(gamma*p_l/rho_l);
-          r_minus = vn_bound - 2./(gamma-1.)*sqrt(gamma*p_bound/rho_bound);
+              vn_bound = 0;
+              for (int i=0; i<n_dims; i++)
+                vn_bound += v_bound[i]*norm[p+i*n_batch];
 
-          c_star = 0.25*(gamma-1.)*(r_plus-r_minus);
-          vn_star = 0.5*(r_plus+r_minus);
+              r_plus  = vn_l + 2./(gamma-1.)*sqrt(gamma*p_l/rho_l);
+              r_minus = vn_bound - 2./(gamma-1.)*sqrt(gamma*p_bound/rho_bound);
 
-          // Inflow
-          if (vn_l<0)
-            {
-              // HACK
-              one_over_s = pow(rho_bound,gamma)/p_bound;
+              c_star = 0.25*(gamma-1.)*(r_plus-r_minus);
+              vn_star = 0.5*(r_plus+r_minus);
 
-              // freestream total enthalpy
-              v_sq = 0.;
-              for (int i=0;i<n_dims;i++)
-                v_sq += v_bound[i]*v_bound[i];
-              h_free_stream = gamma/(gamma-1.)*p_bound/rho_bound + 0.5*v_sq;
+              // Inflow
+              if (vn_l<0)
+                {
+                  // HACK
+                  one_over_s = pow(rho_bound,gamma)/p_bound;
 
-              rho_r = pow(1./gamma*(one_over_s*c_star*c_star),1./(gamma-1.));
+                  // freestream total enthalpy
+                  v_sq = 0.;
+                  for (int i=0;i<n_dims;i++)
+                    v_sq += v_bound[i]*v_bound[i];
+                  h_free_stream = gamma/(gamma-1.)*p_bound/rho_bound + 0.5*v_sq;
 
-              // Compute velocity on the right side
-              for (int i=0; i<n_dims; i++)
-                v_r[i] = vn_star*norm[i] + (v_bound[i] - vn_bound*norm[i]);
+                  rho_r = pow(1./gamma*(one_over_s*c_star*c_star),1./(gamma-1.));
 
-              p_r = rho_r/gamma*c_star*c_star;
-              e_r = rho_r*h_free_stream - p_r;
+                  // Compute velocity on the right side
+                  for (int i=0; i<n_dims; i++)
+                    v_r[i] = vn_star*norm[p+i*n_batch] + (v_bound[i] - vn_bound*norm[p+i*n_batch]);
 
-              // SA model
-              if (run_input.turb_model == 1)
-              {
-                // set turbulent eddy viscosity
-                double mu_tilde_inf = bdy_params[14];
-                u_r[n_dims+2] = mu_tilde_inf;
-              }
-            }
+                  p_r = rho_r/gamma*c_star*c_star;
+                  e_r = rho_r*h_free_stream - p_r;
 
-          // Outflow
-          else
-            {
-              one_over_s = pow(rho_l,gamma)/p_l;
+                  // SA model: set turbulent eddy viscosity
+                  if (sa)
+                    mu_tilde_r[p] = mu_tilde_inf;
+                }
 
-              // freestream total enthalpy
-              rho_r = pow(1./gamma*(one_over_s*c_star*c_star), 1./(gamma-1.));
+              // Outflow
+              else
+                {
+                  one_over_s = pow(rho_l,gamma)/p_l;
 
-              // Compute velocity on the right side
-              for (int i=0; i<n_dims; i++)
-                v_r[i] = vn_star*norm[i] + (v_l[i] - vn_l*norm[i]);
+                  // freestream total enthalpy
+                  rho_r = pow(1./gamma*(one_over_s*c_star*c_star), 1./(gamma-1.));
 
-              p_r = rho_r/gamma*c_star*c_star;
-              v_sq = 0.;
-              for (int i=0; i<n_dims; i++)
-                v_sq += (v_r[i]*v_r[i]);
-              e_r = (p_r/(gamma-1.0)) + 0.5*rho_r*v_sq;
+                  // Compute velocity on the right side
+                  for (int i=0; i<n_dims; i++)
+                    v_r[i] = vn_star*norm[p+i*n_batch] + (v_l[i] - vn_l*norm[p+i*n_batch]);
 
-              // SA model
-              if (run_input.turb_model == 1)
-              {
-                // extrapolate turbulent eddy viscosity
-                u_r[n_dims+2] = u_l[n_dims+2];
-              }
-          }
+                  p_r = rho_r/gamma*c_star*c_star;
+                  v_sq = 0.;
+                  for (int i=0; i<n_dims; i++)
+                    v_sq += (v_r[i]*v_r[i]);
+                  e_r = (p_r/(gamma-1.0)) + 0.5*rho_r*v_sq;
+
+                  // SA model: extrapolate turbulent eddy viscosity
+                  if (sa)
+                    mu_tilde_r[p] = mu_tilde_l[p];
+                }
+
+              set_conservatives(n_dims,rho_r,v_r,e_r,u_r+p,n_batch);
+            }
         }
 
       // Dual consistent BC (see SD++ for more comments)
-      else if (bdy_type==16)
+      else if (in_bdy_type==16)
         {
-          // extrapolate density
-          rho_r = rho_l;
+          for (int p=0; p<in_n_pts; p++)
+            {
+              get_primitives(n_dims,gamma,u_l+p,n_batch,rho_l,v_l,e_l,p_l);
 
-          // Compute normal velocity on left side
-          vn_l = 0.;
-          for (int i=0; i<n_dims; i++)
-            vn_l += v_l[i]*norm[i];
+              // Compute normal velocity on left side
+              vn_l = 0.;
+              for (int i=0; i<n_dims; i++)
+                vn_l += v_l[i]*norm[p+i*n_batch];
 
-          // set u = u - (vn_l)nx
-          // set v = v - (vn_l)ny
-          // set w = w - (vn_l)nz
-          for (int i=0; i<n_dims; i++)
-            v_r[i] = v_l[i] - vn_l*norm[i];
+              // set u = u - (vn_l)nx
+              // set v = v - (vn_l)ny
+              // set w = w - (vn_l)nz
+              for (int i=0; i<n_dims; i++)
+                v_r[i] = v_l[i] - vn_l*norm[p+i*n_batch];
 
-          // extrapolate energy
-          e_r = e_l;
+              // extrapolate density and energy
+              set_conservatives(n_dims,rho_l,v_r,e_l,u_r+p,n_batch);
+            }
         }
 
       // Boundary condition not implemented yet
       else
         {
-          printf("bdy_type=%d\n",bdy_type);
+          printf("bdy_type=%d\n",in_bdy_type);
           printf("Boundary conditions yet to be implemented");
         }
-
-      // Conservative variables on right side
-      u_r[0] = rho_r;
-      for (int i=0; i<n_dims; i++)
-        u_r[i+1] = rho_r*v_r[i];
-      u_r[n_dims+1] = e_r;
     }
 
   // Advection, Advection-Diffusion Boundary Conditions
-  if(equation==1)
+  if(run_input.equation==1)
     {
       // Trivial Dirichlet
-      if(bdy_type==50)
+      if(in_bdy_type==50)
         {
-          u_r[0]=0.0;
+          for (int p=0; p<in_n_pts; p++)
+            u_r[p]=0.0;
         }
     }
 }
@@ -901,141 +1010,178 @@ void bdy_inters::set_inv_boundary_conditions(int bdy_type, double* u_l, double*
 /*! Calculate normal transformed continuous viscous flux at the flux points on the boundaries. */
 
 void bdy_inters::evaluate_boundaryConditions_viscFlux(double time_bound) {
+  evaluate_boundaryConditions_viscFlux(time_bound,n_inters,NULL);
+}
 
-#ifdef _CPU
-  int bdy_spec, flux_spec;
-  array<double> norm(n_dims), fn(n_fields);
+/*! Calculate normal transformed continuous viscous flux at the flux points of the in_n_list boundary interfaces of
+ in_list, or of all of them without a list (on the GPU, always all), n_batch_inters of one boundary type at a time as
+ for the inviscid flux. */
 
-  for(int i=0;i<n_inters;i++)
-  {
-    /*! boundary specification */
-    bdy_spec = boundary_type(i);
+void bdy_inters::evaluate_boundaryConditions_viscFlux(double time_bound, int in_n_list, int* in_list) {
 
-    if(bdy_spec == 12 || bdy_spec == 14)
-      flux_spec = 2;
-    else
-      flux_spec = 1;
+#ifdef _CPU
+  int* list = (in_list ? in_list : bdy_group_inters.get_ptr_cpu());
+
+  double t_start = get_wall_time();
 
-    for(int j=0;j<n_fpts_per_inter;j++)
+#pragma omp parallel
+  {
+    // Batch buffers of this thread
+    int thr = get_thread_num();
+    array<double>& batch_u_l = this->batch_u_l(thr);
+    array<double>& batch_u_r = this->batch_u_r(thr);
+    array<double>& batch_norm = this->batch_norm(thr);
+    array<double>& batch_v = this->batch_v(thr);
+    array<double>& batch_f_l = this->batch_f_l(thr);
+    array<double>& batch_f_r = this->batch_f_r(thr);
+    array<double>& batch_fn = this->batch_fn(thr);
+    array<double>& batch_grad_u_l = this->batch_grad_u_l(thr);
+    array<double>& batch_grad_u_r = this->batch_grad_u_r(thr);
+    int n_batch = batch_u_l.get_dim(0);
+
+    // Chunks of n_batch_inters interfaces of the list, each split where the boundary type changes
+#pragma omp for schedule(static)
+    for(int ii_chunk=0;ii_chunk<in_n_list;ii_chunk+=n_batch_inters)
     {
-      if (motion) {
-        /*! obtain discontinuous solution at flux points (transform to dynamic physical domain) */
-        for(int k=0;k<n_fields;k++)
-          temp_u_l(k)=(*disu_fpts_l(j,i,k))/(*J_dyn_fpts_l(j,i));
+      int ii_end = min(ii_chunk+n_batch_inters,in_n_list);
 
-        /*! Get grid velocity, normal components and flux points location */
-        for (int m=0;m<n_dims;m++) {
-          norm(m) = *norm_dyn_fpts(j,i,m);
-          temp_loc(m) = *pos_dyn_fpts(j,i,m);
-          temp_v(m)=(*grid_vel_fpts(j,i,m));
-        }
-      }
-      else
+      for(int ii_start=ii_chunk;ii_start<ii_end;)
       {
-        /*! obtain discontinuous solution at flux points */
-        for(int k=0;k<n_fields;k++)
-          temp_u_l(k)=(*disu_fpts_l(j,i,k));
-
-        /*! Get normal components and flux points location */
-        for (int m=0;m<n_dims;m++) {
-          norm(m) = *norm_fpts(j,i,m);
-          temp_loc(m) = *pos_fpts(j,i,m);
-        }
-        temp_v.initialize_to_zero();
-      }
-
-      set_inv_boundary_conditions(bdy_spec,temp_u_l.get_ptr_cpu(),temp_u_r.get_ptr_cpu(),temp_v.get_ptr_cpu(),norm.get_ptr_cpu(),temp_loc.get_ptr_cpu(),bdy_params.get_ptr_cpu(),n_dims,n_fields,run_input.gamma,run_input.R_ref,time_bound,run_input.equation);
+        // Block of interfaces of one boundary type
+        int bdy_type = boundary_type(list[ii_start]);
+        int n_block = 1;
 
-          /*! obtain physical gradient of discontinuous solution at flux points */
-          for(int k=0;k<n_dims;k++)
-            {
-              for(int l=0;l<n_fields;l++)
-                {
-                  temp_grad_u_l(l,k) = *grad_disu_fpts_l(j,i,l,k);
-                }
-            }
+        while(ii_start+n_block<ii_end && boundary_type(list[ii_start+n_block])==bdy_type)
+          n_block++;
 
-          /*! Right gradient */
-          if(flux_spec == 2)
-            {
-              // Extrapolate
-              for(int k=0;k<n_dims;k++)
-                {
-                  for(int l=0;l<n_fields;l++)
-                    {
-                      temp_grad_u_r(l,k) = temp_grad_u_l(l,k);
-                    }
-                }
+        int n_pts = n_block*n_fpts_per_inter;
 
-              set_vis_boundary_conditions(bdy_spec,temp_u_l.get_ptr_cpu(),temp_u_r.get_ptr_cpu(),temp_grad_u_r.get_ptr_cpu(),norm.get_ptr_cpu(),temp_loc.get_ptr_cpu(),bdy_params.get_ptr_cpu(),n_dims,n_fields,run_input.gamma,run_input.R_ref,time_bound,run_input.equation);
-            }
+        /*! boundary specification */
+        int flux_spec = ((bdy_type == 12 || bdy_type == 14) ? 2 : 1);
 
-          /*! calculate flux from discontinuous solution at flux points */
-          if(n_dims==2) {
+        // Gather the discontinuous solution (in dynamic space), its physical gradient, the normal and the grid velocity
+        for(int b=0;b<n_block;b++)
+        {
+          int i=list[ii_start+b];
+          int p0=b*n_fpts_per_inter;
 
-              if(flux_spec == 1)
-                {
-                  calc_visf_2d(temp_u_l,temp_grad_u_l,temp_f_l);
-                }
-              else if(flux_spec == 2)
-                {
-                  calc_visf_2d(temp_u_r,temp_grad_u_r,temp_f_r);
-                }
+          for(int k=0;k<n_fields;k++) {
+            for(int j=0;j<n_fpts_per_inter;j++) {
+              if (motion)
+                batch_u_l(p0+j,k)=(*disu_fpts_l(j,i,k))/(*J_dyn_fpts_l(j,i));
               else
-                FatalError("Invalid viscous flux specification");
+                batch_u_l(p0+j,k)=(*disu_fpts_l(j,i,k));
+
+              for(int m=0;m<n_dims;m++)
+                batch_grad_u_l(p0+j,k,m) = *grad_disu_fpts_l(j,i,k,m);
             }
-          else if(n_dims==3)  {
+          }
 
-              if(flux_spec == 1)
-                {
-                  calc_visf_3d(temp_u_l,temp_grad_u_l,temp_f_l);
-                }
-              else if(flux_spec == 2)
-                {
-                  calc_visf_3d(temp_u_r,temp_grad_u_r,temp_f_r);
-                }
-              else
-                FatalError("Invalid viscous flux specification");
+          if (motion) {
+            for(int m=0;m<n_dims;m++) {
+              for(int j=0;j<n_fpts_per_inter;j++) {
+                batch_norm(p0+j,m)=(*norm_dyn_fpts(j,i,m));
+                batch_v(p0+j,m)=(*grid_vel_fpts(j,i,m));
+              }
             }
-          else
-            FatalError("ERROR: Invalid number of dimensions ... ");
+          }
+          else {
+            for(int m=0;m<n_dims;m++)
+              for(int j=0;j<n_fpts_per_inter;j++)
+                batch_norm(p0+j,m)=(*norm_fpts(j,i,m));
+          }
+        }
 
+        set_inv_boundary_conditions_batch(bdy_type,n_pts);
 
-          // If LES (but no wall model?), get SGS flux and add to viscous flux
-          if(LES) {
+        /*! calculate flux from discontinuous solution at flux points: of the left state, or of the right state and an
+         extrapolated gradient corrected by the boundary condition */
+        double* u_s = batch_u_l.get_ptr_cpu();
+        double* grad_u_s = batch_grad_u_l.get_ptr_cpu();
+        double* f_s = batch_f_l.get_ptr_cpu();
 
-            for(int k=0;k<n_dims;k++)
-              {
-                for(int l=0;l<n_fields;l++)
-                  {
+        if(flux_spec == 2)
+          {
+            for(int m=0;m<n_dims;m++)
+              for(int k=0;k<n_fields;k++)
+                for(int p=0;p<n_pts;p++)
+                  batch_grad_u_r(p,k,m) = batch_grad_u_l(p,k,m);
 
-                    // pointer to subgrid-scale flux
-                    temp_sgsf_l(l,k) = *sgsf_fpts_l(j,i,l,k);
+            set_vis_boundary_conditions_batch(bdy_type,n_pts);
 
-                    // Add SGS flux to viscous flux
-                    temp_f_l(l,k) += temp_sgsf_l(l,k);
-                  }
-              }
+            u_s = batch_u_r.get_ptr_cpu();
+            grad_u_s = batch_grad_u_r.get_ptr_cpu();
+            f_s = batch_f_r.get_ptr_cpu();
           }
 
-          /*! Calling viscous riemann solver */
-          if (run_input.vis_riemann_solve_type==0)
-            ldg_flux(flux_spec,temp_u_l,temp_u_r,temp_f_l,temp_f_r,norm,fn,n_dims,n_fields,run_input.tau,run_input.pen_fact);
-          else
-            FatalError("Viscous Riemann solver not implemented");
+        if(n_dims==2)
+          calc_visf_2d_batch(n_pts,n_fields,u_s,n_batch,grad_u_s,n_batch,f_s,n_batch);
+        else if(n_dims==3)
+          calc_visf_3d_batch(n_pts,n_fields,u_s,n_batch,grad_u_s,n_batch,f_s,n_batch);
+        else
+          FatalError("ERROR: Invalid number of dimensions ... ");
 
-          /*! Transform back to reference space. */
-          if (motion) {
-            for(int k=0;k<n_fields;k++)
-              (*norm_tconf_fpts_l(j,i,k))+=fn(k)*(*tdA_fpts_l(j,i))*(*ndA_dyn_fpts_l(j,i));
+        // If LES (but no wall model?), get SGS flux and add to viscous flux
+        if(LES && flux_spec == 1) {
+          for(int b=0;b<n_block;b++) {
+            int i=list[ii_start+b];
+            int p0=b*n_fpts_per_inter;
+
+            for(int m=0;m<n_dims;m++)
+              for(int k=0;k<n_fields;k++)
+                for(int j=0;j<n_fpts_per_inter;j++)
+                  batch_f_l(p0+j,k,m) += *sgsf_fpts_l(j,i,k,m);
           }
-          else
+        }
+
+        /*! Calling viscous riemann solver: LDG flux, as in ldg_flux */
+        if (run_input.vis_riemann_solve_type!=0)
+          FatalError("Viscous Riemann solver not implemented");
+
+        double tau = run_input.tau;
+
+        for(int k=0;k<n_fields;k++)
           {
-            for(int k=0;k<n_fields;k++)
-              (*norm_tconf_fpts_l(j,i,k))+=fn(k)*(*tdA_fpts_l(j,i));
+            double* u_l = batch_u_l.get_ptr_cpu(0,k);
+            double* u_r = batch_u_r.get_ptr_cpu(0,k);
+            double* fn = batch_fn.get_ptr_cpu(0,k);
+
+            for(int m=0;m<n_dims;m++)
+              {
+                double* f = (flux_spec == 1 ? batch_f_l.get_ptr_cpu(0,k,m) : batch_f_r.get_ptr_cpu(0,k,m));
+                double* n = batch_norm.get_ptr_cpu(0,m);
+
+                if(m == 0)
+                  for(int p=0;p<n_pts;p++)
+                    fn[p] = (f[p] + tau*n[p]*(u_l[p] - u_r[p]))*n[p];
+                else
+                  for(int p=0;p<n_pts;p++)
+                    fn[p] += (f[p] + tau*n[p]*(u_l[p] - u_r[p]))*n[p];
+              }
+          }
+
+        /*! Transform back to reference space. */
+        for(int b=0;b<n_block;b++)
+        {
+          int i=list[ii_start+b];
+          int p0=b*n_fpts_per_inter;
+
+          for(int k=0;k<n_fields;k++) {
+            for(int j=0;j<n_fpts_per_inter;j++) {
+              if (motion)
+                (*norm_tconf_fpts_l(j,i,k))+=batch_fn(p0+j,k)*(*tdA_fpts_l(j,i))*(*ndA_dyn_fpts_l(j,i));
+              else
+                (*norm_tconf_fpts_l(j,i,k))+=batch_fn(p0+j,k)*(*tdA_fpts_l(j,i));
+            }
           }
         }
+
+        ii_start += n_block;
+      }
     }
+  }
+
+  t_viscFlux += get_wall_time()-t_start;
 
 #endif
 
@@ -1045,75 +1191,65 @@ void bdy_inters::evaluate_boundaryConditions_viscFlux(double time_bound) {
 #endif
 }
 
+// right hand side gradient at the flux points of the batch buffers, starting from the extrapolated gradient
 
-void bdy_inters::set_vis_boundary_conditions(int bdy_type, double* u_l, double* u_r, double* grad_u, double *norm, double *loc, double *bdy_params, int n_dims, int n_fields, double gamma, double R_ref, double time_bound, int equation)
+void bdy_inters::set_vis_boundary_conditions_batch(int in_bdy_type, int in_n_pts)
 {
-  int cpu_flag;
-  cpu_flag = 1;
+  // Batch buffers of this thread
+  int thr = get_thread_num();
+  array<double>& batch_u_l = this->batch_u_l(thr);
+  array<double>& batch_u_r = this->batch_u_r(thr);
+  array<double>& batch_grad_u_r = this->batch_grad_u_r(thr);
 
+  int n_batch = batch_u_l.get_dim(0);
+  double gamma = run_input.gamma;
 
-  double v_sq;
-  double inte;
-  double p_l, p_r;
+  // Adiabatic wall: energy gradient such that grad T = 0
+  if((in_bdy_type == 12 || in_bdy_type == 14) && run_input.equation == 0)
+    {
+      double* u_l = batch_u_l.get_ptr_cpu();
+      double* u_r = batch_u_r.get_ptr_cpu();
+      double grad_vel[9];
+      double v_sq, inte, p_l, p_r;
 
-  double grad_vel[n_dims*n_dims];
+      for (int p=0; p<in_n_pts; p++)
+        {
+          // grad_u(i,k): gradient of field k in direction i at this point
+          double* grad_u = batch_grad_u_r.get_ptr_cpu(p,0,0);
+          int d_stride = n_fields*n_batch;
 
+          v_sq = 0.;
+          for (int i=0;i<n_dims;i++)
+            v_sq += (u_l[p+(i+1)*n_batch]*u_l[p+(i+1)*n_batch]);
+          p_l   = (gamma-1.0)*( u_l[p+(n_dims+1)*n_batch] - 0.5*v_sq/u_l[p]);
+          p_r = p_l;
 
-  // Adiabatic wall
-  if(bdy_type == 12 || bdy_type == 14)
-    {
-      v_sq = 0.;
-      for (int i=0;i<n_dims;i++)
-        v_sq += (u_l[i+1]*u_l[i+1]);
-      p_l   = (gamma-1.0)*( u_l[n_dims+1] - 0.5*v_sq/u_l[0]);
-      p_r = p_l;
+          double rho_r = u_r[p];
+          double mx_r = u_r[p+n_batch];
+          double my_r = u_r[p+2*n_batch];
 
-      inte = p_r/((gamma-1.0)*u_r[0]);
+          inte = p_r/((gamma-1.0)*rho_r);
 
-      if(cpu_flag) // execute always
-        {
           // Velocity gradients
           for (int j=0;j<n_dims;j++)
             {
               for (int i=0;i<n_dims;i++)
-                grad_vel[j*n_dims + i] = (grad_u[i*n_fields + (j+1)] - grad_u[i*n_fields + 0]*u_r[j+1]/u_r[0])/u_r[0];
+                grad_vel[j*n_dims + i] = (grad_u[i*d_stride + (j+1)*n_batch] - grad_u[i*d_stride]*u_r[p+(j+1)*n_batch]/rho_r)/rho_r;
             }
 
-          // Energy gradients (grad T = 0)
+          // Energy gradients
           if(n_dims == 2)
             {
               for (int i=0;i<n_dims;i++)
-                grad_u[i*n_fields + 3] = inte*grad_u[i*n_fields + 0] + 0.5*((u_r[1]*u_r[1]+u_r[2]*u_r[2])/(u_r[0]*u_r[0]))*grad_u[i*n_fields + 0] + u_r[0]*((u_r[1]/u_r[0])*grad_vel[0*n_dims + i]+(u_r[2]/u_r[0])*grad_vel[1*n_dims + i]);
+                grad_u[i*d_stride + 3*n_batch] = inte*grad_u[i*d_stride] + 0.5*((mx_r*mx_r+my_r*my_r)/(rho_r*rho_r))*grad_u[i*d_stride] + rho_r*((mx_r/rho_r)*grad_vel[0*n_dims + i]+(my_r/rho_r)*grad_vel[1*n_dims + i]);
             }
           else if(n_dims == 3)
             {
-              for (int i=0;i<n_dims;i++)
-                grad_u[i*n_fields + 4] = inte*grad_u[i*n_fields + 0] + 0.5*((u_r[1]*u_r[1]+u_r[2]*u_r[2]+u_r[3]*u_r[3])/(u_r[0]*u_r[0]))*grad_u[i*n_fields + 0] + u_r[0]*((u_r[1]/u_r[0])*grad_vel[0*n_dims + i]+(u_r[2]/u_r[0])*grad_vel[1*n_dims + i]+(u_r[3]/u_r[0])*grad_vel[2*n_dims + i]);
-            }
-        }
-      else
-        {
-          // Velocity gradients
-          for (int j=0;j<n_dims;j++)
-            {
-              for (int i=0;i<n_dims;i++)
-                grad_vel[j*n_dims + i] = (grad_u[(j+1)*n_dims + i] - grad_u[0*n_dims + i]*u_r[j+1]/u_r[0])/u_r[0];
-            }
+              double mz_r = u_r[p+3*n_batch];
 
-          if(n_dims == 2)
-            {
-              // Total energy gradient
               for (int i=0;i<n_dims;i++)
-                grad_u[3*n_dims + i] = inte*grad_u[0*n_dims + i] + 0.5*((u_r[1]*u_r[1]+u_r[2]*u_r[2])/(u_r[0]*u_r[0]))*grad_u[0*n_dims + i] + u_r[0]*((u_r[1]/u_r[0])*grad_vel[0*n_dims + i]+(u_r[2]/u_r[0])*grad_vel[1*n_dims + i]);
-            }
-          else if(n_dims == 3)
-            {
-              for (int i=0;i<n_dims;i++)
-                grad_u[4*n_dims + i] = inte*grad_u[0*n_dims + i] + 0.5*((u_r[1]*u_r[1]+u_r[2]*u_r[2]+u_r[3]*u_r[3])/(u_r[0]*u_r[0]))*grad_u[0*n_dims + i] + u_r[0]*((u_r[1]/u_r[0])*grad_vel[0*n_dims + i]+(u_r[2]/u_r[0])*grad_vel[1*n_dims + i]+(u_r[3]/u_r[0])*grad_vel[2*n_dims + i]);
+                grad_u[i*d_stride + 4*n_batch] = inte*grad_u[i*d_stride] + 0.5*((mx_r*mx_r+my_r*my_r+mz_r*mz_r)/(rho_r*rho_r))*grad_u[i*d_stride] + rho_r*((mx_r/rho_r)*grad_vel[0*n_dims + i]+(my_r/rho_r)*grad_vel[1*n_dims + i]+(mz_r/rho_r)*grad_vel[2*n_dims + i]);
             }
         }
-
     }
-
 }
-
@@ -30,6 +30,7 @@
 
 #include "../include/global.h"
 #include "../include/cubature_hexa.h"
+#include "../include/cubature_tables.h"
 
 using namespace std;
 
@@ -48,96 +49,24 @@ cubature_hexa::cubature_hexa()
 // constructor 1
 
 cubature_hexa::cubature_hexa(int in_rule) // set by rule
-{	
-  ifstream datfile;
-  char buf[BUFSIZ]={""};
-  char section_TXT[100], param_TXT[100];
-  char* f;
-  string filename, param_name, param, ord;
-  istringstream strbuf;
-  int rule_file;
+{
+  const cubature_table* table;
 
   rule=in_rule;
   n_pts=rule*rule*rule;
+
   locs.setup(n_pts,3);
   weights.setup(n_pts);
 
-  if(rule < 13) {
-    
-    if (HIFILES_DIR == NULL)
-      FatalError("environment variable HIFILES_HOME is undefined");
-    
-    filename = HIFILES_DIR;
-    filename += "/data/cubature_hexa.dat";
-    f = (char*)filename.c_str();
-    datfile.open(f, ifstream::in);
-    if (!datfile) FatalError("Unable to open cubature file");
-
-    // read data from file to arrays
-    while(datfile.getline(buf,BUFSIZ))
-    {
-      sscanf(buf,"%s",section_TXT);
-      param_name.assign(section_TXT,0,99);
-      
-      if(!param_name.compare(0,4,"rule"))
-      {
-        // get no. of pts
-        ord = param_name.substr(5);
-        stringstream str(ord);
-        str >> rule_file;
-        
-        // if pts matches order, read locs and weights
-        if (rule_file == rule) {
-          
-          // skip next line
-          datfile.getline(buf,BUFSIZ);
-          
-          for(int i=0;i<n_pts;++i) {
-            datfile.getline(buf,BUFSIZ);
-            sscanf(buf,"%s",param_TXT);
-            param.assign(param_TXT,0,99);
-            strbuf.str(param);
-            locs(i,0) = atof(param.c_str());
-          }
-          
-          // skip next line
-          datfile.getline(buf,BUFSIZ);
-          
-          for(int i=0;i<n_pts;++i) {
-            datfile.getline(buf,BUFSIZ);
-            sscanf(buf,"%s",param_TXT);
-            param.assign(param_TXT,0,99);
-            strbuf.str(param);
-            locs(i,1) = atof(param.c_str());
-          }
-          
-          // skip next line
-          datfile.getline(buf,BUFSIZ);
-          
-          for(int i=0;i<n_pts;++i) {
-            datfile.getline(buf,BUFSIZ);
-            sscanf(buf,"%s",param_TXT);
-            param.assign(param_TXT,0,99);
-            strbuf.str(param);
-            locs(i,2) = atof(param.c_str());
-          }
-          
-          // skip next line
-          datfile.getline(buf,BUFSIZ);
-          
-          for(int i=0;i<n_pts;++i) {
-            datfile.getline(buf,BUFSIZ);
-            sscanf(buf,"%s",param_TXT);
-            param.assign(param_TXT,0,99);
-            strbuf.str(param);
-            weights(i) = atof(param.c_str());
-          }
-          break;
-        }
-      }
-    }
+  table=get_cubature_table(CUBATURE_HEXA,rule);
+  if (table==NULL) FatalError("cubature rule not implemented.");
+
+  for(int i=0;i<n_pts;++i) {
+    locs(i,0) = table->locs[i];
+    locs(i,1) = table->locs[n_pts+i];
+    locs(i,2) = table->locs[2*n_pts+i];
+    weights(i) = table->weights[i];
   }
-  else { FatalError("cubature rule not implemented."); }
 }
 
 // copy constructor
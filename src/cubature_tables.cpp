@@ -0,0 +1,10229 @@
+/*!
+ * \file cubature_tables.cpp
+ * \author - Original code: SD++ developed by Patrice Castonguay, Antony Jameson,
+ *                          Peter Vincent, David Williams (alphabetical by surname).
+ *         - Current development: Aerospace Computing Laboratory (ACL)
+ *                                Aero/Astro Department. Stanford University.
+ * \version 0.1.0
+ *
+ * High Fidelity Large Eddy Simulation (HiFiLES) Code.
+ * Copyright (C) 2014 Aerospace Computing Laboratory (ACL).
+ *
+ * HiFiLES is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * HiFiLES is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with HiFiLES.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Generated by data/make_cubature_tables.py from data/cubature_*.dat, do not edit
+
+#include <cstddef>
+
+#include "../include/cubature_tables.h"
+
+// cubature_1d.dat
+
+static const double cubature_1d_1_locs[]={
+  0.0
+};
+static const double cubature_1d_1_weights[]={
+  2.0
+};
+static const double cubature_1d_2_locs[]={
+  -0.577350269189626,0.577350269189626
+};
+static const double cubature_1d_2_weights[]={
+  1.0,1.0
+};
+static const double cubature_1d_3_locs[]={
+  -0.774596669241483,-0E-15,0.774596669241483
+};
+static const double cubature_1d_3_weights[]={
+  0.555555555556,0.888888888889,0.555555555556
+};
+static const double cubature_1d_4_locs[]={
+  -0.861136311594053,-0.339981043584856,0.339981043584856,0.861136311594053
+};
+static const double cubature_1d_4_weights[]={
+  0.347854845137,0.652145154863,0.652145154863,0.347854845137
+};
+static const double cubature_1d_5_locs[]={
+  -0.906179845938664,-0.538469310105683,-0E-15,0.538469310105683,
+  0.906179845938664
+};
+static const double cubature_1d_5_weights[]={
+  0.236926885056,0.478628670499,0.568888888889,0.478628670499,
+  0.236926885056
+};
+static const double cubature_1d_6_locs[]={
+  -0.932469514203152,-0.661209386466264,-0.238619186083197,0.238619186083197,
+  0.661209386466265,0.932469514203152
+};
+static const double cubature_1d_6_weights[]={
+  0.171324492379,0.360761573048,0.467913934573,0.467913934573,
+  0.360761573048,0.171324492379
+};
+static const double cubature_1d_7_locs[]={
+  -0.949107912342758,-0.741531185599395,-0.405845151377397,0E-15,
+  0.405845151377397,0.741531185599394,0.949107912342758
+};
+static const double cubature_1d_7_weights[]={
+  0.129484966169,0.279705391489,0.381830050505,0.417959183673,
+  0.381830050505,0.279705391489,0.129484966169
+};
+static const double cubature_1d_8_locs[]={
+  -0.960289856497536,-0.796666477413627,-0.525532409916329,-0.183434642495650,
+  0.183434642495650,0.525532409916329,0.796666477413627,0.960289856497536
+};
+static const double cubature_1d_8_weights[]={
+  0.10122853629,0.222381034453,0.313706645878,0.362683783378,
+  0.362683783378,0.313706645878,0.222381034453,0.10122853629
+};
+static const double cubature_1d_9_locs[]={
+  -0.968160239507626,-0.836031107326636,-0.613371432700591,-0.324253423403809,
+  0E-15,0.324253423403809,0.613371432700591,0.836031107326636,
+  0.968160239507626
+};
+static const double cubature_1d_9_weights[]={
+  0.0812743883616,0.180648160695,0.260610696403,0.31234707704,
+  0.330239355001,0.31234707704,0.260610696403,0.180648160695,
+  0.0812743883616
+};
+static const double cubature_1d_10_locs[]={
+  -0.973906528517172,-0.865063366688985,-0.679409568299024,-0.433395394129247,
+  -0.148874338981631,0.148874338981632,0.433395394129247,0.679409568299024,
+  0.865063366688984,0.973906528517171
+};
+static const double cubature_1d_10_weights[]={
+  0.0666713443087,0.149451349151,0.219086362516,0.26926671931,
+  0.295524224715,0.295524224715,0.26926671931,0.219086362516,
+  0.149451349151,0.0666713443087
+};
+static const double cubature_1d_11_locs[]={
+  -0.978228658146057,-0.887062599768095,-0.730152005574049,-0.519096129206812,
+  -0.269543155952345,-0E-15,0.269543155952345,0.519096129206812,
+  0.730152005574049,0.887062599768095,0.978228658146057
+};
+static const double cubature_1d_11_weights[]={
+  0.0556685671162,0.125580369465,0.186290210928,0.233193764592,
+  0.26280454451,0.272925086778,0.26280454451,0.233193764592,
+  0.186290210928,0.125580369465,0.0556685671162
+};
+static const double cubature_1d_12_locs[]={
+  -0.981560634246719,-0.904117256370475,-0.769902674194305,-0.587317954286617,
+  -0.367831498998180,-0.125233408511469,0.125233408511469,0.367831498998180,
+  0.587317954286618,0.769902674194305,0.904117256370475,0.981560634246719
+};
+static const double cubature_1d_12_weights[]={
+  0.0471753363865,0.106939325995,0.160078328543,0.203167426723,
+  0.233492536538,0.249147045813,0.249147045813,0.233492536538,
+  0.203167426723,0.160078328543,0.106939325995,0.0471753363865
+};
+
+static const cubature_table cubature_1d_tables[]={
+  {1,1,cubature_1d_1_locs,cubature_1d_1_weights},
+  {2,2,cubature_1d_2_locs,cubature_1d_2_weights},
+  {3,3,cubature_1d_3_locs,cubature_1d_3_weights},
+  {4,4,cubature_1d_4_locs,cubature_1d_4_weights},
+  {5,5,cubature_1d_5_locs,cubature_1d_5_weights},
+  {6,6,cubature_1d_6_locs,cubature_1d_6_weights},
+  {7,7,cubature_1d_7_locs,cubature_1d_7_weights},
+  {8,8,cubature_1d_8_locs,cubature_1d_8_weights},
+  {9,9,cubature_1d_9_locs,cubature_1d_9_weights},
+  {10,10,cubature_1d_10_locs,cubature_1d_10_weights},
+  {11,11,cubature_1d_11_locs,cubature_1d_11_weights},
+  {12,12,cubature_1d_12_locs,cubature_1d_12_weights}
+};
+
+// cubature_tri.dat
+
+static const double cubature_tri_2_locs[]={
+  -0.666666666666667,0.333333333333333,-0.666666666666667,-0.666666666666667,
+  -0.666666666666667,0.333333333333333
+};
+static const double cubature_tri_2_weights[]={
+  0.666666666667,0.666666666667,0.666666666667
+};
+static const double cubature_tri_3_locs[]={
+  -0.816847572980458,0.633695145960917,-0.816847572980459,-0.108103018168070,
+  -0.783793963663860,-0.108103018168070,-0.816847572980458,-0.816847572980459,
+  0.633695145960917,-0.108103018168070,-0.108103018168070,-0.783793963663860
+};
+static const double cubature_tri_3_weights[]={
+  0.219903487311,0.219903487311,0.219903487311,0.446763179356,
+  0.446763179356,0.446763179356
+};
+static const double cubature_tri_4_locs[]={
+  -0.816847572980458,0.633695145960917,-0.816847572980459,-0.108103018168070,
+  -0.783793963663860,-0.108103018168070,-0.816847572980458,-0.816847572980459,
+  0.633695145960917,-0.108103018168070,-0.108103018168070,-0.783793963663860
+};
+static const double cubature_tri_4_weights[]={
+  0.219903487311,0.219903487311,0.219903487311,0.446763179356,
+  0.446763179356,0.446763179356
+};
+static const double cubature_tri_5_locs[]={
+  -0.333333333333333,-0.059715871789770,-0.880568256420460,-0.059715871789770,
+  -0.797426985353087,0.594853970706175,-0.797426985353087,-0.333333333333333,
+  -0.059715871789770,-0.059715871789770,-0.880568256420460,-0.797426985353087,
+  -0.797426985353087,0.594853970706175
+};
+static const double cubature_tri_5_weights[]={
+  0.45,0.264788305577,0.264788305577,0.264788305577,
+  0.25187836109,0.25187836109,0.25187836109
+};
+static const double cubature_tri_6_locs[]={
+  -0.501426509658179,0.002853019316358,-0.501426509658179,-0.873821971016996,
+  0.747643942033991,-0.873821971016996,-0.379295097932431,-0.893709900310366,
+  0.273004998242797,-0.893709900310366,0.273004998242797,-0.379295097932431,
+  -0.501426509658179,-0.501426509658179,0.002853019316358,-0.873821971016996,
+  -0.873821971016996,0.747643942033991,-0.893709900310366,-0.379295097932431,
+  -0.893709900310366,0.273004998242797,-0.379295097932431,0.273004998242797
+};
+static const double cubature_tri_6_weights[]={
+  0.233572551453,0.233572551453,0.233572551453,0.10168981274,
+  0.10168981274,0.10168981274,0.165702151237,0.165702151237,
+  0.165702151237,0.165702151237,0.165702151237,0.165702151237
+};
+static const double cubature_tri_7_locs[]={
+  -0.158765070723907,-0.682469858552186,-0.158765070723907,-0.901937632421608,
+  0.803875264843215,-0.901937632421608,-0.696696002590528,0.393392005181056,
+  -0.696696002590528,0.348275575962283,-0.375762055856278,-0.972513520106005,
+  -0.375762055856278,-0.972513520106005,0.348275575962283,-0.158765070723907,
+  -0.158765070723907,-0.682469858552186,-0.901937632421608,-0.901937632421608,
+  0.803875264843215,-0.696696002590528,-0.696696002590528,0.393392005181056,
+  -0.375762055856278,0.348275575962283,-0.375762055856278,-0.972513520106005,
+  0.348275575962283,-0.972513520106005
+};
+static const double cubature_tri_7_weights[]={
+  0.27840295935,0.27840295935,0.27840295935,0.0636538826571,
+  0.0636538826571,0.0636538826571,0.16864264676,0.16864264676,
+  0.16864264676,0.0779835889497,0.0779835889497,0.0779835889497,
+  0.0779835889497,0.0779835889497,0.0779835889497
+};
+static const double cubature_tri_8_locs[]={
+  -0.333333333333333,-0.081414823414554,-0.837170353170893,-0.081414823414554,
+  -0.658861384496480,0.317722768992959,-0.658861384496480,-0.898905543365938,
+  0.797811086731876,-0.898905543365938,-0.473774340730724,0.456984785910809,
+  -0.983210445180085,0.456984785910809,-0.983210445180085,-0.473774340730724,
+  -0.333333333333333,-0.081414823414554,-0.081414823414554,-0.837170353170893,
+  -0.658861384496480,-0.658861384496480,0.317722768992959,-0.898905543365938,
+  -0.898905543365938,0.797811086731876,0.456984785910809,-0.473774340730724,
+  0.456984785910809,-0.983210445180085,-0.473774340730724,-0.983210445180085
+};
+static const double cubature_tri_8_weights[]={
+  0.288631215356,0.190183268535,0.190183268535,0.190183268535,
+  0.206434741069,0.206434741069,0.206434741069,0.0649169952464,
+  0.0649169952464,0.0649169952464,0.0544606283489,0.0544606283489,
+  0.0544606283489,0.0544606283489,0.0544606283489,0.0544606283489
+};
+static const double cubature_tri_9_locs[]={
+  -0.333333333333333,-0.020634961602525,-0.958730076794950,-0.020634961602525,
+  -0.125820817014127,-0.748358365971746,-0.125820817014127,-0.623592928761935,
+  0.247185857523869,-0.623592928761935,-0.910540973211095,0.821081946422189,
+  -0.910540973211095,0.482397197568996,-0.556074021678469,-0.926323175890527,
+  -0.556074021678469,-0.926323175890527,0.482397197568996,-0.333333333333333,
+  -0.020634961602525,-0.020634961602525,-0.958730076794950,-0.125820817014127,
+  -0.125820817014127,-0.748358365971746,-0.623592928761935,-0.623592928761935,
+  0.247185857523869,-0.910540973211095,-0.910540973211095,0.821081946422189,
+  -0.556074021678469,0.482397197568996,-0.556074021678469,-0.926323175890527,
+  0.482397197568996,-0.926323175890527
+};
+static const double cubature_tri_9_weights[]={
+  0.194271592566,0.0626694004543,0.0626694004543,0.0626694004543,
+  0.15565508201,0.15565508201,0.15565508201,0.159295477854,
+  0.159295477854,0.159295477854,0.0511553513174,0.0511553513174,
+  0.0511553513174,0.0865670787546,0.0865670787546,0.0865670787546,
+  0.0865670787546,0.0865670787546,0.0865670787546
+};
+static const double cubature_tri_10_locs[]={
+  -0.333333333333333,-0.004269134091050,-0.991461731817899,-0.004269134091050,
+  -0.143975100541888,-0.712049798916225,-0.143975100541888,-0.630487174513551,
+  0.260974349027102,-0.630487174513551,-0.959037562856645,0.918075125713290,
+  -0.959037562856645,-0.726852847487933,0.656846867693389,-0.929994020205456,
+  0.656846867693389,-0.929994020205456,-0.726852847487933,-0.334512798822723,
+  0.259414658305837,-0.924901859483115,0.259414658305837,-0.924901859483115,
+  -0.334512798822723,-0.333333333333333,-0.004269134091050,-0.004269134091050,
+  -0.991461731817899,-0.143975100541888,-0.143975100541888,-0.712049798916225,
+  -0.630487174513551,-0.630487174513551,0.260974349027102,-0.959037562856645,
+  -0.959037562856645,0.918075125713290,0.656846867693389,-0.726852847487933,
+  0.656846867693389,-0.929994020205456,-0.726852847487933,-0.929994020205456,
+  0.259414658305837,-0.334512798822723,0.259414658305837,-0.924901859483115,
+  -0.334512798822723,-0.924901859483115
+};
+static const double cubature_tri_10_weights[]={
+  0.16704679961,0.0144597011841,0.0144597011841,0.0144597011841,
+  0.148984355842,0.148984355842,0.148984355842,0.157292946806,
+  0.157292946806,0.157292946806,0.0138566461742,0.0138566461742,
+  0.0138566461742,0.0590366406696,0.0590366406696,0.0590366406696,
+  0.0590366406696,0.0590366406696,0.0590366406696,0.0791587343921,
+  0.0791587343921,0.0791587343921,0.0791587343921,0.0791587343921,
+  0.0791587343921
+};
+static const double cubature_tri_11_locs[]={
+  -0.333333333333333,-0.008227986519701,-0.983544026960598,-0.008227986519701,
+  -0.123062767323470,-0.753874465353061,-0.123062767323470,-0.579583807314522,
+  0.159167614629044,-0.579583807314522,-0.794793191450311,0.589586382900622,
+  -0.794793191450311,-0.943045809035533,0.886091618071066,-0.943045809035533,
+  -0.701412405190965,0.686811031831200,-0.985398626640235,0.686811031831200,
+  -0.985398626640235,-0.701412405190966,-0.420944470627256,0.328932876191794,
+  -0.907988405564538,0.328932876191794,-0.907988405564538,-0.420944470627256,
+  -0.333333333333333,-0.008227986519701,-0.008227986519701,-0.983544026960598,
+  -0.123062767323470,-0.123062767323470,-0.753874465353061,-0.579583807314522,
+  -0.579583807314522,0.159167614629044,-0.794793191450311,-0.794793191450311,
+  0.589586382900622,-0.943045809035533,-0.943045809035533,0.886091618071066,
+  0.686811031831200,-0.701412405190965,0.686811031831200,-0.985398626640235,
+  -0.701412405190966,-0.985398626640235,0.328932876191794,-0.420944470627256,
+  0.328932876191794,-0.907988405564538,-0.420944470627256,-0.907988405564538
+};
+static const double cubature_tri_11_weights[]={
+  0.171542269659,0.0332323096481,0.0332323096481,0.0332323096481,
+  0.134650934562,0.134650934562,0.134650934562,0.141045284214,
+  0.141045284214,0.141045284214,0.0772553524094,0.0772553524094,
+  0.0772553524094,0.0208516933118,0.0208516933118,0.0208516933118,
+  0.0205564541301,0.0205564541301,0.0205564541301,0.0205564541301,
+  0.0205564541301,0.0205564541301,0.0806687138543,0.0806687138543,
+  0.0806687138543,0.0806687138543,0.0806687138543,0.0806687138543
+};
+static const double cubature_tri_12_locs[]={
+  -0.115127288420454,-0.769745423159092,-0.115127288420454,-0.241326933740970,
+  -0.517346132518060,-0.241326933740970,-0.773435586772427,0.546871173544855,
+  -0.773435586772427,-0.550360151853422,0.100720303706844,-0.550360151853422,
+  -0.949850839686919,0.899701679373837,-0.949850839686919,-0.023247583079632,
+  -0.953504833840737,-0.023247583079632,0.701114686742190,-0.956341185792092,
+  -0.744773500950097,-0.956341185792092,-0.744773500950097,0.701114686742189,
+  0.280974603820889,-0.820754518409649,-0.460220085411240,-0.820754518409649,
+  -0.460220085411240,0.280974603820889,0.380092839755442,-0.412599349012509,
+  -0.967493490742933,-0.412599349012509,-0.967493490742933,0.380092839755442,
+  -0.115127288420454,-0.115127288420454,-0.769745423159092,-0.241326933740970,
+  -0.241326933740970,-0.517346132518060,-0.773435586772427,-0.773435586772427,
+  0.546871173544855,-0.550360151853422,-0.550360151853422,0.100720303706844,
+  -0.949850839686919,-0.949850839686919,0.899701679373837,-0.023247583079632,
+  -0.023247583079632,-0.953504833840737,-0.956341185792092,0.701114686742190,
+  -0.956341185792092,-0.744773500950097,0.701114686742189,-0.744773500950097,
+  -0.820754518409649,0.280974603820889,-0.820754518409649,-0.460220085411240,
+  0.280974603820889,-0.460220085411240,-0.412599349012509,0.380092839755442,
+  -0.412599349012509,-0.967493490742933,0.380092839755442,-0.967493490742933
+};
+static const double cubature_tri_12_weights[]={
+  0.0886940508124,0.0886940508124,0.0886940508124,0.0834866389705,
+  0.0834866389705,0.0834866389705,0.061949370457,0.061949370457,
+  0.061949370457,0.0969267446078,0.0969267446078,0.0969267446078,
+  0.0162847158134,0.0162847158134,0.0162847158134,0.0477301622095,
+  0.0477301622095,0.0477301622095,0.0307404781721,0.0307404781721,
+  0.0307404781721,0.0307404781721,0.0307404781721,0.0307404781721,
+  0.0733642951839,0.0733642951839,0.0733642951839,0.0733642951839,
+  0.0733642951839,0.0733642951839,0.031692718542,0.031692718542,
+  0.031692718542,0.031692718542,0.031692718542,0.031692718542
+};
+static const double cubature_tri_13_locs[]={
+  -0.333333333333333,-0.178369512906405,-0.643260974187191,-0.178369512906405,
+  -0.542160866418819,0.084321732837639,-0.542160866418819,-0.771083702251175,
+  0.542167404502350,-0.771083702251175,-0.951222762153923,0.902445524307847,
+  -0.951222762153923,-0.071124044893491,-0.857751910213018,-0.071124044893491,
+  0.089497598920545,-0.972567007080596,-0.116930591839948,-0.972567007080596,
+  -0.116930591839948,0.089497598920545,0.708303576893352,-0.752827405974001,
+  -0.955476170919351,-0.752827405974001,-0.955476170919351,0.708303576893352,
+  0.400693795223418,-0.438009873048077,-0.962683922175342,-0.438009873048076,
+  -0.962683922175342,0.400693795223419,-0.461147708177324,-0.809703416305633,
+  0.270851124482956,-0.809703416305633,0.270851124482956,-0.461147708177324,
+  -0.333333333333333,-0.178369512906405,-0.178369512906405,-0.643260974187191,
+  -0.542160866418819,-0.542160866418819,0.084321732837639,-0.771083702251175,
+  -0.771083702251175,0.542167404502350,-0.951222762153923,-0.951222762153923,
+  0.902445524307847,-0.071124044893491,-0.071124044893491,-0.857751910213018,
+  -0.972567007080596,0.089497598920545,-0.972567007080596,-0.116930591839948,
+  0.089497598920545,-0.116930591839948,-0.752827405974001,0.708303576893352,
+  -0.752827405974001,-0.955476170919351,0.708303576893352,-0.955476170919351,
+  -0.438009873048077,0.400693795223418,-0.438009873048076,-0.962683922175342,
+  0.400693795223419,-0.962683922175342,-0.809703416305633,-0.461147708177324,
+  -0.809703416305633,0.270851124482956,-0.461147708177324,0.270851124482956
+};
+static const double cubature_tri_13_weights[]={
+  0.0976498802566,0.0908303924353,0.0908303924353,0.0908303924353,
+  0.0936881722984,0.0936881722984,0.0936881722984,0.0626366257669,
+  0.0626366257669,0.0626366257669,0.0153841230588,0.0153841230588,
+  0.0153841230588,0.0633364118507,0.0633364118507,0.0633364118507,
+  0.0173631128952,0.0173631128952,0.0173631128952,0.0173631128952,
+  0.0173631128952,0.0173631128952,0.0302035193132,0.0302035193132,
+  0.0302035193132,0.0302035193132,0.0302035193132,0.0302035193132,
+  0.0329541206354,0.0329541206354,0.0329541206354,0.0329541206354,
+  0.0329541206354,0.0329541206354,0.0735997377417,0.0735997377417,
+  0.0735997377417,0.0735997377417,0.0735997377417,0.0735997377417
+};
+static const double cubature_tri_14_locs[]={
+  -0.333333333333333,-0.031437623162377,-0.937124753675245,-0.031437623162377,
+  -0.190179067155837,-0.619641865688325,-0.190179067155837,-0.544945017724160,
+  0.089890035448320,-0.544945017724160,-0.829084434528895,0.658168869057790,
+  -0.829084434528895,-0.961731843229187,0.923463686458374,-0.961731843229187,
+  -0.228055909294146,0.200257489743243,-0.972201580449098,0.200257489743243,
+  -0.972201580449097,-0.228055909294146,-0.801926305237733,0.769518568627872,
+  -0.967592263390139,0.769518568627872,-0.967592263390139,-0.801926305237733,
+  -0.544893784145096,0.504355701557747,-0.959461917412651,0.504355701557747,
+  -0.959461917412651,-0.544893784145095,-0.288429073961769,0.109399611316741,
+  -0.820970537354972,0.109399611316741,-0.820970537354972,-0.288429073961769,
+  -0.593507885280605,0.397658756992448,-0.804150871711842,0.397658756992447,
+  -0.804150871711842,-0.593507885280605,-0.333333333333333,-0.031437623162377,
+  -0.031437623162377,-0.937124753675245,-0.190179067155837,-0.190179067155837,
+  -0.619641865688325,-0.544945017724160,-0.544945017724160,0.089890035448320,
+  -0.829084434528895,-0.829084434528895,0.658168869057790,-0.961731843229187,
+  -0.961731843229187,0.923463686458374,0.200257489743243,-0.228055909294146,
+  0.200257489743243,-0.972201580449098,-0.228055909294146,-0.972201580449097,
+  0.769518568627872,-0.801926305237733,0.769518568627872,-0.967592263390139,
+  -0.801926305237733,-0.967592263390139,0.504355701557747,-0.544893784145096,
+  0.504355701557747,-0.959461917412651,-0.544893784145095,-0.959461917412651,
+  0.109399611316741,-0.288429073961769,0.109399611316741,-0.820970537354972,
+  -0.288429073961769,-0.820970537354972,0.397658756992448,-0.593507885280605,
+  0.397658756992447,-0.804150871711842,-0.593507885280605,-0.804150871711842
+};
+static const double cubature_tri_14_weights[]={
+  0.0860161619403,0.0208610425815,0.0208610425815,0.0208610425815,
+  0.0849065774338,0.0849065774338,0.0849065774338,0.0944129556944,
+  0.0944129556944,0.0944129556944,0.0369314205301,0.0369314205301,
+  0.0369314205301,0.00956685922343,0.00956685922343,0.00956685922343,
+  0.0238733321026,0.0238733321026,0.0238733321026,0.0238733321026,
+  0.0238733321026,0.0238733321026,0.0180065419689,0.0180065419689,
+  0.0180065419689,0.0180065419689,0.0180065419689,0.0180065419689,
+  0.0301179133575,0.0301179133575,0.0301179133575,0.0301179133575,
+  0.0301179133575,0.0301179133575,0.0670353351442,0.0670353351442,
+  0.0670353351442,0.0670353351442,0.0670353351442,0.0670353351442,
+  0.0566247560385,0.0566247560385,0.0566247560385,0.0566247560385,
+  0.0566247560385,0.0566247560385
+};
+static const double cubature_tri_15_locs[]={
+  -0.083438407261750,-0.833123185476500,-0.083438407261750,-0.192779070841739,
+  -0.614441858316522,-0.192779070841739,-0.413605664173949,-0.172788671652101,
+  -0.413605664173949,-0.707064426114454,0.414128852228908,-0.707064426114454,
+  -0.887274264668793,0.774548529337586,-0.887274264668793,-0.966849746283259,
+  0.933699492566519,-0.966849746283259,-0.520930891690411,0.501106485071962,
+  -0.980175593381550,0.501106485071962,-0.980175593381550,-0.520930891690411,
+  -0.190242385363320,0.158634844102864,-0.968392458739544,0.158634844102864,
+  -0.968392458739544,-0.190242385363320,-0.809995773773910,0.799708556139969,
+  -0.989712782366059,0.799708556139969,-0.989712782366059,-0.809995773773910,
+  -0.700493785355452,0.602649133849474,-0.902155348494022,0.602649133849474,
+  -0.902155348494023,-0.700493785355452,-0.426160775117330,0.288623277852292,
+  -0.862462502734962,0.288623277852292,-0.862462502734962,-0.426160775117330,
+  -0.436328663801831,0.099519827552432,-0.663191163750602,0.099519827552432,
+  -0.663191163750602,-0.436328663801831,-0.083438407261750,-0.083438407261750,
+  -0.833123185476500,-0.192779070841739,-0.192779070841739,-0.614441858316522,
+  -0.413605664173949,-0.413605664173949,-0.172788671652101,-0.707064426114454,
+  -0.707064426114454,0.414128852228908,-0.887274264668793,-0.887274264668793,
+  0.774548529337586,-0.966849746283259,-0.966849746283259,0.933699492566519,
+  0.501106485071962,-0.520930891690411,0.501106485071962,-0.980175593381550,
+  -0.520930891690411,-0.980175593381550,0.158634844102864,-0.190242385363320,
+  0.158634844102864,-0.968392458739544,-0.190242385363320,-0.968392458739544,
+  0.799708556139969,-0.809995773773910,0.799708556139969,-0.989712782366059,
+  -0.809995773773910,-0.989712782366059,0.602649133849474,-0.700493785355452,
+  0.602649133849474,-0.902155348494022,-0.700493785355452,-0.902155348494023,
+  0.288623277852292,-0.426160775117330,0.288623277852292,-0.862462502734962,
+  -0.426160775117330,-0.862462502734962,0.099519827552432,-0.436328663801831,
+  0.099519827552432,-0.663191163750602,-0.436328663801831,-0.663191163750602
+};
+static const double cubature_tri_15_weights[]={
+  0.0653236376976,0.0653236376976,0.0653236376976,0.0548256360627,
+  0.0548256360627,0.0548256360627,0.0530200731974,0.0530200731974,
+  0.0530200731974,0.058431924273,0.058431924273,0.058431924273,
+  0.0211692161325,0.0211692161325,0.0211692161325,0.00722928612818,
+  0.00722928612818,0.00722928612818,0.0170554962034,0.0170554962034,
+  0.0170554962034,0.0170554962034,0.0170554962034,0.0170554962034,
+  0.0278323530334,0.0278323530334,0.0278323530334,0.0278323530334,
+  0.0278323530334,0.0278323530334,0.00858386588147,0.00858386588147,
+  0.00858386588147,0.00858386588147,0.00858386588147,0.00858386588147,
+  0.0324706585635,0.0324706585635,0.0324706585635,0.0324706585635,
+  0.0324706585635,0.0324706585635,0.0512146818425,0.0512146818425,
+  0.0512146818425,0.0512146818425,0.0512146818425,0.0512146818425,
+  0.0661763910633,0.0661763910633,0.0661763910633,0.0661763910633,
+  0.0661763910633,0.0661763910633
+};
+static const double cubature_tri_16_locs[]={
+  -0.333333333333333,-0.015796436959213,-0.968407126081574,-0.015796436959213,
+  -0.087376299046785,-0.825247401906431,-0.087376299046785,-0.640498098534045,
+  0.280996197068091,-0.640498098534045,-0.828211591878549,0.656423183757099,
+  -0.828211591878549,-0.977882767295650,0.955765534591299,-0.977882767295650,
+  -0.648594849699253,0.619534954455185,-0.970940104755933,0.619534954455185,
+  -0.970940104755933,-0.648594849699253,-0.355089058161032,0.324703448463838,
+  -0.969614390302806,0.324703448463838,-0.969614390302806,-0.355089058161032,
+  -0.863082725186344,0.829810165174004,-0.966727439987660,0.829810165174004,
+  -0.966727439987660,-0.863082725186344,-0.650110471151428,0.511910525190604,
+  -0.861800054039176,0.511910525190604,-0.861800054039176,-0.650110471151428,
+  -0.282624366842035,0.131065359625217,-0.848440992783182,0.131065359625217,
+  -0.848440992783182,-0.282624366842035,-0.500121711290305,0.333566061453817,
+  -0.833444350163512,0.333566061453817,-0.833444350163512,-0.500121711290305,
+  -0.353308953197778,-0.027538833736648,-0.619152213065573,-0.027538833736648,
+  -0.619152213065573,-0.353308953197778,-0.333333333333333,-0.015796436959213,
+  -0.015796436959213,-0.968407126081574,-0.087376299046785,-0.087376299046785,
+  -0.825247401906431,-0.640498098534045,-0.640498098534045,0.280996197068091,
+  -0.828211591878549,-0.828211591878549,0.656423183757099,-0.977882767295650,
+  -0.977882767295650,0.955765534591299,0.619534954455185,-0.648594849699253,
+  0.619534954455185,-0.970940104755933,-0.648594849699253,-0.970940104755933,
+  0.324703448463838,-0.355089058161032,0.324703448463838,-0.969614390302806,
+  -0.355089058161032,-0.969614390302806,0.829810165174004,-0.863082725186344,
+  0.829810165174004,-0.966727439987660,-0.863082725186344,-0.966727439987660,
+  0.511910525190604,-0.650110471151428,0.511910525190604,-0.861800054039176,
+  -0.650110471151428,-0.861800054039176,0.131065359625217,-0.282624366842035,
+  0.131065359625217,-0.848440992783182,-0.282624366842035,-0.848440992783182,
+  0.333566061453817,-0.500121711290305,0.333566061453817,-0.833444350163512,
+  -0.500121711290305,-0.833444350163512,-0.027538833736648,-0.353308953197778,
+  -0.027538833736648,-0.619152213065573,-0.353308953197778,-0.619152213065573
+};
+static const double cubature_tri_16_weights[]={
+  0.0924212023218,0.0279916527347,0.0279916527347,0.0279916527347,
+  0.0364067635964,0.0364067635964,0.0364067635964,0.0627294233273,
+  0.0627294233273,0.0627294233273,0.0322171701927,0.0322171701927,
+  0.0322171701927,0.00367679257565,0.00367679257565,0.00367679257565,
+  0.0190756863133,0.0190756863133,0.0190756863133,0.0190756863133,
+  0.0190756863133,0.0190756863133,0.0251113367233,0.0251113367233,
+  0.0251113367233,0.0251113367233,0.0251113367233,0.0251113367233,
+  0.014134510743,0.014134510743,0.014134510743,0.014134510743,
+  0.014134510743,0.014134510743,0.0252555436725,0.0252555436725,
+  0.0252555436725,0.0252555436725,0.0252555436725,0.0252555436725,
+  0.0384328525208,0.0384328525208,0.0384328525208,0.0384328525208,
+  0.0384328525208,0.0384328525208,0.0329932912116,0.0329932912116,
+  0.0329932912116,0.0329932912116,0.0329932912116,0.0329932912116,
+  0.081415677215,0.081415677215,0.081415677215,0.081415677215,
+  0.081415677215,0.081415677215
+};
+static const double cubature_tri_17_locs[]={
+  -0.013565183960096,-0.972869632079808,-0.013565183960096,-0.918012666387151,
+  0.836025332774302,-0.918012666387151,-0.469265478050798,-0.061469043898404,
+  -0.469265478050798,-0.278161974512876,-0.443676050974249,-0.278161974512876,
+  -0.743831619059579,0.487663238119159,-0.743831619059579,-0.975086972700342,
+  0.950173945400684,-0.975086972700342,-0.331485915788080,0.305875449252880,
+  -0.974389533464800,0.305875449252880,-0.974389533464800,-0.331485915788080,
+  -0.617368143234940,0.598534426856625,-0.981166283621686,0.598534426856625,
+  -0.981166283621686,-0.617368143234940,-0.846737941679184,0.837351785097968,
+  -0.990613843418784,0.837351785097968,-0.990613843418784,-0.846737941679184,
+  -0.530582382227094,0.412831673770520,-0.882249291543426,0.412831673770520,
+  -0.882249291543426,-0.530582382227094,-0.230167008731505,0.092655855430620,
+  -0.862488846699115,0.092655855430620,-0.862488846699115,-0.230167008731505,
+  -0.769841956364772,0.681416462088999,-0.911574505724228,0.681416462088999,
+  -0.911574505724228,-0.769841956364772,-0.502901760016855,0.206946937904245,
+  -0.704045177887389,0.206946937904245,-0.704045177887389,-0.502901760016855,
+  -0.258115377755090,-0.067105414124881,-0.674779208120030,-0.067105414124880,
+  -0.674779208120030,-0.258115377755090,-0.013565183960096,-0.013565183960096,
+  -0.972869632079808,-0.918012666387151,-0.918012666387151,0.836025332774302,
+  -0.469265478050798,-0.469265478050798,-0.061469043898404,-0.278161974512876,
+  -0.278161974512876,-0.443676050974249,-0.743831619059579,-0.743831619059579,
+  0.487663238119159,-0.975086972700342,-0.975086972700342,0.950173945400684,
+  0.305875449252880,-0.331485915788080,0.305875449252880,-0.974389533464800,
+  -0.331485915788080,-0.974389533464800,0.598534426856625,-0.617368143234940,
+  0.598534426856625,-0.981166283621686,-0.617368143234940,-0.981166283621686,
+  0.837351785097968,-0.846737941679184,0.837351785097968,-0.990613843418784,
+  -0.846737941679184,-0.990613843418784,0.412831673770520,-0.530582382227094,
+  0.412831673770520,-0.882249291543426,-0.530582382227094,-0.882249291543426,
+  0.092655855430620,-0.230167008731505,0.092655855430620,-0.862488846699115,
+  -0.230167008731505,-0.862488846699115,0.681416462088999,-0.769841956364772,
+  0.681416462088999,-0.911574505724228,-0.769841956364772,-0.911574505724228,
+  0.206946937904245,-0.502901760016855,0.206946937904245,-0.704045177887389,
+  -0.502901760016855,-0.704045177887389,-0.067105414124881,-0.258115377755090,
+  -0.067105414124880,-0.674779208120030,-0.258115377755090,-0.674779208120030
+};
+static const double cubature_tri_17_weights[]={
+  0.0224484240772,0.0224484240772,0.0224484240772,0.0113778167667,
+  0.0113778167667,0.0113778167667,0.0561480787977,0.0561480787977,
+  0.0561480787977,0.0318047530507,0.0318047530507,0.0318047530507,
+  0.0429446041598,0.0429446041598,0.0429446041598,0.00413833626713,
+  0.00413833626713,0.00413833626713,0.0200941116705,0.0200941116705,
+  0.0200941116705,0.0200941116705,0.0200941116705,0.0200941116705,
+  0.013023443943,0.013023443943,0.013023443943,0.013023443943,
+  0.013023443943,0.013023443943,0.00585695436954,0.00585695436954,
+  0.00585695436954,0.00585695436954,0.00585695436954,0.00585695436954,
+  0.0377461726435,0.0377461726435,0.0377461726435,0.0377461726435,
+  0.0377461726435,0.0377461726435,0.0483627529886,0.0483627529886,
+  0.0483627529886,0.0483627529886,0.0483627529886,0.0483627529886,
+  0.0234671261694,0.0234671261694,0.0234671261694,0.0234671261694,
+  0.0234671261694,0.0234671261694,0.0547034288369,0.0547034288369,
+  0.0547034288369,0.0547034288369,0.0547034288369,0.0547034288369,
+  0.0456483361523,0.0456483361523,0.0456483361523,0.0456483361523,
+  0.0456483361523,0.0456483361523
+};
+static const double cubature_tri_18_locs[]={
+  -0.333333333333333,-0.012131216528029,-0.975737566943942,-0.012131216528029,
+  -0.230136518749796,-0.539726962500408,-0.230136518749796,-0.499402807850562,
+  -0.001194384298875,-0.499402807850563,-0.710045241598598,0.420090483197196,
+  -0.710045241598598,-0.903019171569391,0.806038343138783,-0.903019171569391,
+  -0.972866921676664,0.945733843353328,-0.972866921676664,-0.859848143426920,
+  0.852682278520227,-0.992834135093306,0.852682278520227,-0.992834135093306,
+  -0.859848143426920,-0.592208428296456,0.573110619333459,-0.980902191037003,
+  0.573110619333459,-0.980902191037003,-0.592208428296456,-0.316660705097116,
+  0.294011442575493,-0.977350737478378,0.294011442575493,-0.977350737478378,
+  -0.316660705097116,-0.762708275393600,0.720805143081058,-0.958096867687458,
+  0.720805143081058,-0.958096867687458,-0.762708275393600,-0.499464753852078,
+  0.389673957377540,-0.890209203525462,0.389673957377540,-0.890209203525462,
+  -0.499464753852078,-0.730193961187213,0.595225312221749,-0.865031351034536,
+  0.595225312221749,-0.865031351034535,-0.730193961187213,-0.213662181077459,
+  0.092159471784540,-0.878497290707081,0.092159471784540,-0.878497290707081,
+  -0.213662181077459,-0.268906542375276,-0.010964677486621,-0.720128780138103,
+  -0.010964677486621,-0.720128780138103,-0.268906542375276,-0.507963230765286,
+  0.233062121320884,-0.725098890555598,0.233062121320884,-0.725098890555598,
+  -0.507963230765286,-0.333333333333333,-0.012131216528029,-0.012131216528029,
+  -0.975737566943942,-0.230136518749796,-0.230136518749796,-0.539726962500408,
+  -0.499402807850562,-0.499402807850563,-0.001194384298875,-0.710045241598598,
+  -0.710045241598598,0.420090483197196,-0.903019171569391,-0.903019171569391,
+  0.806038343138783,-0.972866921676664,-0.972866921676664,0.945733843353328,
+  0.852682278520227,-0.859848143426920,0.852682278520227,-0.992834135093306,
+  -0.859848143426920,-0.992834135093306,0.573110619333459,-0.592208428296456,
+  0.573110619333459,-0.980902191037003,-0.592208428296456,-0.980902191037003,
+  0.294011442575493,-0.316660705097116,0.294011442575493,-0.977350737478378,
+  -0.316660705097116,-0.977350737478378,0.720805143081058,-0.762708275393600,
+  0.720805143081058,-0.958096867687458,-0.762708275393600,-0.958096867687458,
+  0.389673957377540,-0.499464753852078,0.389673957377540,-0.890209203525462,
+  -0.499464753852078,-0.890209203525462,0.595225312221749,-0.730193961187213,
+  0.595225312221749,-0.865031351034536,-0.730193961187213,-0.865031351034535,
+  0.092159471784540,-0.213662181077459,0.092159471784540,-0.878497290707081,
+  -0.213662181077459,-0.878497290707081,-0.010964677486621,-0.268906542375276,
+  -0.010964677486621,-0.720128780138103,-0.268906542375276,-0.720128780138103,
+  0.233062121320884,-0.507963230765286,0.233062121320884,-0.725098890555598,
+  -0.507963230765286,-0.725098890555598
+};
+static const double cubature_tri_18_weights[]={
+  0.0443659243781,0.0191188665586,0.0191188665586,0.0191188665586,
+  0.0492942822642,0.0492942822642,0.0492942822642,0.0606541259813,
+  0.0606541259813,0.0606541259813,0.0313662318445,0.0313662318445,
+  0.0313662318445,0.0161730356991,0.0161730356991,0.0161730356991,
+  0.00475007674342,0.00475007674342,0.00475007674342,0.00432999836405,
+  0.00432999836405,0.00432999836405,0.00432999836405,0.00432999836405,
+  0.00432999836405,0.0123001365922,0.0123001365922,0.0123001365922,
+  0.0123001365922,0.0123001365922,0.0123001365922,0.0171465504961,
+  0.0171465504961,0.0171465504961,0.0171465504961,0.0171465504961,
+  0.0171465504961,0.0109927843677,0.0109927843677,0.0109927843677,
+  0.0109927843677,0.0109927843677,0.0109927843677,0.0339884236275,
+  0.0339884236275,0.0339884236275,0.0339884236275,0.0339884236275,
+  0.0339884236275,0.02576877525,0.02576877525,0.02576877525,
+  0.02576877525,0.02576877525,0.02576877525,0.0400236987163,
+  0.0400236987163,0.0400236987163,0.0400236987163,0.0400236987163,
+  0.0400236987163,0.0452772480976,0.0452772480976,0.0452772480976,
+  0.0452772480976,0.0452772480976,0.0452772480976,0.0454330875467,
+  0.0454330875467,0.0454330875467,0.0454330875467,0.0454330875467,
+  0.0454330875467
+};
+static const double cubature_tri_19_locs[]={
+  -0.333333333333333,-0.121193890022463,-0.757612219955075,-0.121193890022463,
+  -0.227921589064499,-0.544156821871001,-0.227921589064499,-0.480832787187258,
+  -0.038334425625484,-0.480832787187258,-0.607587000462791,0.215174000925582,
+  -0.607587000462791,-0.728032884013154,0.456065768026307,-0.728032884013154,
+  -0.884999963315497,0.769999926630994,-0.884999963315497,-0.973927705240279,
+  0.947855410480559,-0.973927705240279,-0.419340397282846,0.418549313572482,
+  -0.999208916289636,0.418549313572482,-0.999208916289636,-0.419340397282846,
+  -0.154285565801825,0.131285016869205,-0.976999451067380,0.131285016869205,
+  -0.976999451067380,-0.154285565801825,-0.864328042937615,0.842262778125134,
+  -0.977934735187519,0.842262778125134,-0.977934735187519,-0.864328042937615,
+  -0.676980679779850,0.654351228666662,-0.977370548886812,0.654351228666662,
+  -0.977370548886812,-0.676980679779850,-0.451038034994882,0.391933493150074,
+  -0.940895458155192,0.391933493150074,-0.940895458155192,-0.451038034994882,
+  -0.755079003035426,0.643775758022122,-0.888696754986697,0.643775758022122,
+  -0.888696754986697,-0.755079003035426,-0.668500025831376,0.544622467980326,
+  -0.876122442148950,0.544622467980326,-0.876122442148950,-0.668500025831376,
+  -0.205954158284095,0.090524206162520,-0.884570047878425,0.090524206162520,
+  -0.884570047878425,-0.205954158284095,-0.488476686471250,0.295757669634562,
+  -0.807280983163311,0.295757669634562,-0.807280983163311,-0.488476686471250,
+  -0.342507806805715,0.042214391480752,-0.699706584675037,0.042214391480751,
+  -0.699706584675037,-0.342507806805715,-0.333333333333333,-0.121193890022463,
+  -0.121193890022463,-0.757612219955075,-0.227921589064499,-0.227921589064499,
+  -0.544156821871001,-0.480832787187258,-0.480832787187258,-0.038334425625484,
+  -0.607587000462791,-0.607587000462791,0.215174000925582,-0.728032884013154,
+  -0.728032884013154,0.456065768026307,-0.884999963315497,-0.884999963315497,
+  0.769999926630994,-0.973927705240279,-0.973927705240279,0.947855410480559,
+  0.418549313572482,-0.419340397282846,0.418549313572482,-0.999208916289636,
+  -0.419340397282846,-0.999208916289636,0.131285016869205,-0.154285565801825,
+  0.131285016869205,-0.976999451067380,-0.154285565801825,-0.976999451067380,
+  0.842262778125134,-0.864328042937615,0.842262778125134,-0.977934735187519,
+  -0.864328042937615,-0.977934735187519,0.654351228666662,-0.676980679779850,
+  0.654351228666662,-0.977370548886812,-0.676980679779850,-0.977370548886812,
+  0.391933493150074,-0.451038034994882,0.391933493150074,-0.940895458155192,
+  -0.451038034994882,-0.940895458155192,0.643775758022122,-0.755079003035426,
+  0.643775758022122,-0.888696754986697,-0.755079003035426,-0.888696754986697,
+  0.544622467980326,-0.668500025831376,0.544622467980326,-0.876122442148950,
+  -0.668500025831376,-0.876122442148950,0.090524206162520,-0.205954158284095,
+  0.090524206162520,-0.884570047878425,-0.205954158284095,-0.884570047878425,
+  0.295757669634562,-0.488476686471250,0.295757669634562,-0.807280983163311,
+  -0.488476686471250,-0.807280983163311,0.042214391480752,-0.342507806805715,
+  0.042214391480751,-0.699706584675037,-0.342507806805715,-0.699706584675037
+};
+static const double cubature_tri_19_weights[]={
+  0.041424760048,0.0317848553377,0.0317848553377,0.0317848553377,
+  0.0484065999099,0.0484065999099,0.0484065999099,0.0481776618585,
+  0.0481776618585,0.0481776618585,0.04269116249,0.04269116249,
+  0.04269116249,0.031889013978,0.031889013978,0.031889013978,
+  0.0155292729235,0.0155292729235,0.0155292729235,0.00444285287141,
+  0.00444285287141,0.00444285287141,0.00459940902456,0.00459940902456,
+  0.00459940902456,0.00459940902456,0.00459940902456,0.00459940902456,
+  0.0166083270013,0.0166083270013,0.0166083270013,0.0166083270013,
+  0.0166083270013,0.0166083270013,0.00850835066425,0.00850835066425,
+  0.00850835066425,0.00850835066425,0.00850835066425,0.00850835066425,
+  0.0127527605161,0.0127527605161,0.0127527605161,0.0127527605161,
+  0.0127527605161,0.0127527605161,0.0248647311372,0.0248647311372,
+  0.0248647311372,0.0248647311372,0.0248647311372,0.0248647311372,
+  0.0127794698784,0.0127794698784,0.0127794698784,0.0127794698784,
+  0.0127794698784,0.0127794698784,0.0178015029506,0.0178015029506,
+  0.0178015029506,0.0178015029506,0.0178015029506,0.0178015029506,
+  0.0357382332667,0.0357382332667,0.0357382332667,0.0357382332667,
+  0.0357382332667,0.0357382332667,0.0383441994045,0.0383441994045,
+  0.0383441994045,0.0383441994045,0.0383441994045,0.0383441994045,
+  0.0429715131306,0.0429715131306,0.0429715131306,0.0429715131306,
+  0.0429715131306,0.0429715131306
+};
+static const double cubature_tri_20_locs[]={
+  -0.333333333333333,-0.001500649324429,-0.996998701351142,-0.001500649324429,
+  -0.094139751938951,-0.811720496122098,-0.094139751938951,-0.204472124089526,
+  -0.591055751820947,-0.204472124089526,-0.470999594934425,-0.058000810131149,
+  -0.470999594934425,-0.577962071815846,0.155924143631693,-0.577962071815846,
+  -0.784528785657457,0.569057571314915,-0.784528785657457,-0.921861824324395,
+  0.843723648648789,-0.921861824324395,-0.977651240541341,0.955302481082681,
+  -0.977651240541341,-0.872900668183296,0.862201431808621,-0.989300763625325,
+  0.862201431808621,-0.989300763625325,-0.872900668183295,-0.685786162118586,
+  0.669876527986188,-0.984090365867602,0.669876527986188,-0.984090365867602,
+  -0.685786162118586,-0.208715771271252,0.187870974708724,-0.979155203437472,
+  0.187870974708724,-0.979155203437472,-0.208715771271252,-0.453664858574179,
+  0.431736028981932,-0.978071170407753,0.431736028981932,-0.978071170407753,
+  -0.453664858574179,-0.796429235029966,0.719295810859041,-0.922866575829075,
+  0.719295810859041,-0.922866575829075,-0.796429235029966,-0.106682901647172,
+  0.035521886012736,-0.928838984365563,0.035521886012736,-0.928838984365564,
+  -0.106682901647172,-0.601978411700994,0.502636778975466,-0.900658367274472,
+  0.502636778975466,-0.900658367274472,-0.601978411700994,-0.351477632615435,
+  0.234438182446771,-0.882960549831337,0.234438182446771,-0.882960549831337,
+  -0.351477632615435,-0.582937273579734,0.339941699570946,-0.757004425991211,
+  0.339941699570946,-0.757004425991211,-0.582937273579734,-0.353658866927485,
+  0.072237177039608,-0.718578310112123,0.072237177039608,-0.718578310112123,
+  -0.353658866927485,-0.333333333333333,-0.001500649324429,-0.001500649324429,
+  -0.996998701351142,-0.094139751938951,-0.094139751938951,-0.811720496122098,
+  -0.204472124089526,-0.204472124089526,-0.591055751820947,-0.470999594934425,
+  -0.470999594934425,-0.058000810131149,-0.577962071815846,-0.577962071815846,
+  0.155924143631693,-0.784528785657457,-0.784528785657457,0.569057571314915,
+  -0.921861824324395,-0.921861824324395,0.843723648648789,-0.977651240541341,
+  -0.977651240541341,0.955302481082681,0.862201431808621,-0.872900668183296,
+  0.862201431808621,-0.989300763625325,-0.872900668183295,-0.989300763625325,
+  0.669876527986188,-0.685786162118586,0.669876527986188,-0.984090365867602,
+  -0.685786162118586,-0.984090365867602,0.187870974708724,-0.208715771271252,
+  0.187870974708724,-0.979155203437472,-0.208715771271252,-0.979155203437472,
+  0.431736028981932,-0.453664858574179,0.431736028981932,-0.978071170407753,
+  -0.453664858574179,-0.978071170407753,0.719295810859041,-0.796429235029966,
+  0.719295810859041,-0.922866575829075,-0.796429235029966,-0.922866575829075,
+  0.035521886012736,-0.106682901647172,0.035521886012736,-0.928838984365563,
+  -0.106682901647172,-0.928838984365564,0.502636778975466,-0.601978411700994,
+  0.502636778975466,-0.900658367274472,-0.601978411700994,-0.900658367274472,
+  0.234438182446771,-0.351477632615435,0.234438182446771,-0.882960549831337,
+  -0.351477632615435,-0.882960549831337,0.339941699570946,-0.582937273579734,
+  0.339941699570946,-0.757004425991211,-0.582937273579734,-0.757004425991211,
+  0.072237177039608,-0.353658866927485,0.072237177039608,-0.718578310112123,
+  -0.353658866927485,-0.718578310112123
+};
+static const double cubature_tri_20_weights[]={
+  0.0552208539954,0.00355805909465,0.00355805909465,0.00355805909465,
+  0.0402247962279,0.0402247962279,0.0402247962279,0.0536356945187,
+  0.0536356945187,0.0536356945187,0.049046267603,0.049046267603,
+  0.049046267603,0.0327891568214,0.0327891568214,0.0327891568214,
+  0.0295918147973,0.0295918147973,0.0295918147973,0.00915856455541,
+  0.00915856455541,0.00915856455541,0.00330365303115,0.00330365303115,
+  0.00330365303115,0.00469834181715,0.00469834181715,0.00469834181715,
+  0.00469834181715,0.00469834181715,0.00469834181715,0.00893185150836,
+  0.00893185150836,0.00893185150836,0.00893185150836,0.00893185150836,
+  0.00893185150836,0.0121991336158,0.0121991336158,0.0121991336158,
+  0.0121991336158,0.0121991336158,0.0121991336158,0.0137821626544,
+  0.0137821626544,0.0137821626544,0.0137821626544,0.0137821626544,
+  0.0137821626544,0.015994950145,0.015994950145,0.015994950145,
+  0.015994950145,0.015994950145,0.015994950145,0.0147722685707,
+  0.0147722685707,0.0147722685707,0.0147722685707,0.0147722685707,
+  0.0147722685707,0.0255986637573,0.0255986637573,0.0255986637573,
+  0.0255986637573,0.0255986637573,0.0255986637573,0.0345161423514,
+  0.0345161423514,0.0345161423514,0.0345161423514,0.0345161423514,
+  0.0345161423514,0.0373458918059,0.0373458918059,0.0373458918059,
+  0.0373458918059,0.0373458918059,0.0373458918059,0.0456364481168,
+  0.0456364481168,0.0456364481168,0.0456364481168,0.0456364481168,
+  0.0456364481168
+};
+
+static const cubature_table cubature_tri_tables[]={
+  {2,3,cubature_tri_2_locs,cubature_tri_2_weights},
+  {3,6,cubature_tri_3_locs,cubature_tri_3_weights},
+  {4,6,cubature_tri_4_locs,cubature_tri_4_weights},
+  {5,7,cubature_tri_5_locs,cubature_tri_5_weights},
+  {6,12,cubature_tri_6_locs,cubature_tri_6_weights},
+  {7,15,cubature_tri_7_locs,cubature_tri_7_weights},
+  {8,16,cubature_tri_8_locs,cubature_tri_8_weights},
+  {9,19,cubature_tri_9_locs,cubature_tri_9_weights},
+  {10,25,cubature_tri_10_locs,cubature_tri_10_weights},
+  {11,28,cubature_tri_11_locs,cubature_tri_11_weights},
+  {12,36,cubature_tri_12_locs,cubature_tri_12_weights},
+  {13,40,cubature_tri_13_locs,cubature_tri_13_weights},
+  {14,46,cubature_tri_14_locs,cubature_tri_14_weights},
+  {15,54,cubature_tri_15_locs,cubature_tri_15_weights},
+  {16,58,cubature_tri_16_locs,cubature_tri_16_weights},
+  {17,66,cubature_tri_17_locs,cubature_tri_17_weights},
+  {18,73,cubature_tri_18_locs,cubature_tri_18_weights},
+  {19,82,cubature_tri_19_locs,cubature_tri_19_weights},
+  {20,85,cubature_tri_20_locs,cubature_tri_20_weights}
+};
+
+// cubature_quad.dat
+
+static const double cubature_quad_1_locs[]={
+  0.0,0.0
+};
+static const double cubature_quad_1_weights[]={
+  4.0
+};
+static const double cubature_quad_2_locs[]={
+  -0.577350269189626,0.577350269189626,-0.577350269189626,0.577350269189626,
+  -0.577350269189626,-0.577350269189626,0.577350269189626,0.577350269189626
+};
+static const double cubature_quad_2_weights[]={
+  1.0,1.0,1.0,1.0
+};
+static const double cubature_quad_3_locs[]={
+  -0.774596669241483,0E-15,0.774596669241483,-0.774596669241483,
+  0E-15,0.774596669241483,-0.774596669241483,0E-15,
+  0.774596669241483,-0.774596669241483,-0.774596669241483,-0.774596669241483,
+  0E-15,0E-15,0E-15,0.774596669241483,
+  0.774596669241483,0.774596669241483
+};
+static const double cubature_quad_3_weights[]={
+  0.308641975309,0.493827160494,0.308641975309,0.493827160494,
+  0.79012345679,0.493827160494,0.308641975309,0.493827160494,
+  0.308641975309
+};
+static const double cubature_quad_4_locs[]={
+  -0.861136311594052,-0.339981043584856,0.339981043584856,0.861136311594052,
+  -0.861136311594052,-0.339981043584856,0.339981043584856,0.861136311594052,
+  -0.861136311594052,-0.339981043584856,0.339981043584856,0.861136311594052,
+  -0.861136311594052,-0.339981043584856,0.339981043584856,0.861136311594052,
+  -0.861136311594052,-0.861136311594052,-0.861136311594052,-0.861136311594052,
+  -0.339981043584856,-0.339981043584856,-0.339981043584856,-0.339981043584856,
+  0.339981043584856,0.339981043584856,0.339981043584856,0.339981043584856,
+  0.861136311594052,0.861136311594052,0.861136311594052,0.861136311594052
+};
+static const double cubature_quad_4_weights[]={
+  0.121002993286,0.226851851852,0.226851851852,0.121002993286,
+  0.226851851852,0.425293303011,0.425293303011,0.226851851852,
+  0.226851851852,0.425293303011,0.425293303011,0.226851851852,
+  0.121002993286,0.226851851852,0.226851851852,0.121002993286
+};
+static const double cubature_quad_5_locs[]={
+  -0.906179845938664,-0.538469310105683,0E-15,0.538469310105683,
+  0.906179845938664,-0.906179845938664,-0.538469310105683,0E-15,
+  0.538469310105683,0.906179845938664,-0.906179845938664,-0.538469310105683,
+  0E-15,0.538469310105683,0.906179845938664,-0.906179845938664,
+  -0.538469310105683,0E-15,0.538469310105683,0.906179845938664,
+  -0.906179845938664,-0.538469310105683,0E-15,0.538469310105683,
+  0.906179845938664,-0.906179845938664,-0.906179845938664,-0.906179845938664,
+  -0.906179845938664,-0.906179845938664,-0.538469310105683,-0.538469310105683,
+  -0.538469310105683,-0.538469310105683,-0.538469310105683,0E-15,
+  0E-15,0E-15,0E-15,0E-15,
+  0.538469310105683,0.538469310105683,0.538469310105683,0.538469310105683,
+  0.538469310105683,0.906179845938664,0.906179845938664,0.906179845938664,
+  0.906179845938664,0.906179845938664
+};
+static const double cubature_quad_5_weights[]={
+  0.0561343488624,0.1134,0.134785072388,0.1134,
+  0.0561343488624,0.1134,0.229085404224,0.272286532551,
+  0.229085404224,0.1134,0.134785072388,0.272286532551,
+  0.323634567901,0.272286532551,0.134785072388,0.1134,
+  0.229085404224,0.272286532551,0.229085404224,0.1134,
+  0.0561343488624,0.1134,0.134785072388,0.1134,
+  0.0561343488624
+};
+static const double cubature_quad_6_locs[]={
+  -0.932469514203152,-0.661209386466264,-0.238619186083197,0.238619186083197,
+  0.661209386466264,0.932469514203152,-0.932469514203152,-0.661209386466264,
+  -0.238619186083197,0.238619186083197,0.661209386466264,0.932469514203152,
+  -0.932469514203152,-0.661209386466264,-0.238619186083197,0.238619186083197,
+  0.661209386466264,0.932469514203152,-0.932469514203152,-0.661209386466264,
+  -0.238619186083197,0.238619186083197,0.661209386466264,0.932469514203152,
+  -0.932469514203152,-0.661209386466264,-0.238619186083197,0.238619186083197,
+  0.661209386466264,0.932469514203152,-0.932469514203152,-0.661209386466264,
+  -0.238619186083197,0.238619186083197,0.661209386466264,0.932469514203152,
+  -0.932469514203152,-0.932469514203152,-0.932469514203152,-0.932469514203152,
+  -0.932469514203152,-0.932469514203152,-0.661209386466264,-0.661209386466264,
+  -0.661209386466264,-0.661209386466264,-0.661209386466264,-0.661209386466264,
+  -0.238619186083197,-0.238619186083197,-0.238619186083197,-0.238619186083197,
+  -0.238619186083197,-0.238619186083197,0.238619186083197,0.238619186083197,
+  0.238619186083197,0.238619186083197,0.238619186083197,0.238619186083197,
+  0.661209386466264,0.661209386466264,0.661209386466264,0.661209386466264,
+  0.661209386466264,0.661209386466264,0.932469514203152,0.932469514203152,
+  0.932469514203152,0.932469514203152,0.932469514203152,0.932469514203152
+};
+static const double cubature_quad_6_weights[]={
+  0.029352081689,0.0618072933724,0.0801651173178,0.0801651173178,
+  0.0618072933724,0.029352081689,0.0618072933724,0.130148912588,
+  0.168805367088,0.168805367088,0.130148912588,0.0618072933724,
+  0.0801651173178,0.168805367088,0.218943450167,0.218943450167,
+  0.168805367088,0.0801651173178,0.0801651173178,0.168805367088,
+  0.218943450167,0.218943450167,0.168805367088,0.0801651173178,
+  0.0618072933724,0.130148912588,0.168805367088,0.168805367088,
+  0.130148912588,0.0618072933724,0.029352081689,0.0618072933724,
+  0.0801651173178,0.0801651173178,0.0618072933724,0.029352081689
+};
+static const double cubature_quad_7_locs[]={
+  -0.949107912342758,-0.741531185599394,-0.405845151377397,0E-15,
+  0.405845151377397,0.741531185599394,0.949107912342758,-0.949107912342758,
+  -0.741531185599394,-0.405845151377397,0E-15,0.405845151377397,
+  0.741531185599394,0.949107912342758,-0.949107912342758,-0.741531185599394,
+  -0.405845151377397,0E-15,0.405845151377397,0.741531185599394,
+  0.949107912342758,-0.949107912342758,-0.741531185599394,-0.405845151377397,
+  0E-15,0.405845151377397,0.741531185599394,0.949107912342758,
+  -0.949107912342758,-0.741531185599394,-0.405845151377397,0E-15,
+  0.405845151377397,0.741531185599394,0.949107912342758,-0.949107912342758,
+  -0.741531185599394,-0.405845151377397,0E-15,0.405845151377397,
+  0.741531185599394,0.949107912342758,-0.949107912342758,-0.741531185599394,
+  -0.405845151377397,0E-15,0.405845151377397,0.741531185599394,
+  0.949107912342758,-0.949107912342758,-0.949107912342758,-0.949107912342758,
+  -0.949107912342758,-0.949107912342758,-0.949107912342758,-0.949107912342758,
+  -0.741531185599394,-0.741531185599394,-0.741531185599394,-0.741531185599394,
+  -0.741531185599394,-0.741531185599394,-0.741531185599394,-0.405845151377397,
+  -0.405845151377397,-0.405845151377397,-0.405845151377397,-0.405845151377397,
+  -0.405845151377397,-0.405845151377397,0E-15,0E-15,
+  0E-15,0E-15,0E-15,0E-15,
+  0E-15,0.405845151377397,0.405845151377397,0.405845151377397,
+  0.405845151377397,0.405845151377397,0.405845151377397,0.405845151377397,
+  0.741531185599394,0.741531185599394,0.741531185599394,0.741531185599394,
+  0.741531185599394,0.741531185599394,0.741531185599394,0.949107912342758,
+  0.949107912342758,0.949107912342758,0.949107912342758,0.949107912342758,
+  0.949107912342758,0.949107912342758
+};
+static const double cubature_quad_7_weights[]={
+  0.0167663564638,0.0362176431542,0.0494412511719,0.0541194307579,
+  0.0494412511719,0.0362176431542,0.0167663564638,0.0362176431542,
+  0.0782351060282,0.106799923759,0.116905437096,0.106799923759,
+  0.0782351060282,0.0362176431542,0.0494412511719,0.106799923759,
+  0.145794187469,0.159589376211,0.145794187469,0.106799923759,
+  0.0494412511719,0.0541194307579,0.116905437096,0.159589376211,
+  0.174689879217,0.159589376211,0.116905437096,0.0541194307579,
+  0.0494412511719,0.106799923759,0.145794187469,0.159589376211,
+  0.145794187469,0.106799923759,0.0494412511719,0.0362176431542,
+  0.0782351060282,0.106799923759,0.116905437096,0.106799923759,
+  0.0782351060282,0.0362176431542,0.0167663564638,0.0362176431542,
+  0.0494412511719,0.0541194307579,0.0494412511719,0.0362176431542,
+  0.0167663564638
+};
+static const double cubature_quad_8_locs[]={
+  -0.960289856497536,-0.796666477413627,-0.525532409916329,-0.183434642495650,
+  0.183434642495650,0.525532409916329,0.796666477413627,0.960289856497536,
+  -0.960289856497536,-0.796666477413627,-0.525532409916329,-0.183434642495650,
+  0.183434642495650,0.525532409916329,0.796666477413627,0.960289856497536,
+  -0.960289856497536,-0.796666477413627,-0.525532409916329,-0.183434642495650,
+  0.183434642495650,0.525532409916329,0.796666477413627,0.960289856497536,
+  -0.960289856497536,-0.796666477413627,-0.525532409916329,-0.183434642495650,
+  0.183434642495650,0.525532409916329,0.796666477413627,0.960289856497536,
+  -0.960289856497536,-0.796666477413627,-0.525532409916329,-0.183434642495650,
+  0.183434642495650,0.525532409916329,0.796666477413627,0.960289856497536,
+  -0.960289856497536,-0.796666477413627,-0.525532409916329,-0.183434642495650,
+  0.183434642495650,0.525532409916329,0.796666477413627,0.960289856497536,
+  -0.960289856497536,-0.796666477413627,-0.525532409916329,-0.183434642495650,
+  0.183434642495650,0.525532409916329,0.796666477413627,0.960289856497536,
+  -0.960289856497536,-0.796666477413627,-0.525532409916329,-0.183434642495650,
+  0.183434642495650,0.525532409916329,0.796666477413627,0.960289856497536,
+  -0.960289856497536,-0.960289856497536,-0.960289856497536,-0.960289856497536,
+  -0.960289856497536,-0.960289856497536,-0.960289856497536,-0.960289856497536,
+  -0.796666477413627,-0.796666477413627,-0.796666477413627,-0.796666477413627,
+  -0.796666477413627,-0.796666477413627,-0.796666477413627,-0.796666477413627,
+  -0.525532409916329,-0.525532409916329,-0.525532409916329,-0.525532409916329,
+  -0.525532409916329,-0.525532409916329,-0.525532409916329,-0.525532409916329,
+  -0.183434642495650,-0.183434642495650,-0.183434642495650,-0.183434642495650,
+  -0.183434642495650,-0.183434642495650,-0.183434642495650,-0.183434642495650,
+  0.183434642495650,0.183434642495650,0.183434642495650,0.183434642495650,
+  0.183434642495650,0.183434642495650,0.183434642495650,0.183434642495650,
+  0.525532409916329,0.525532409916329,0.525532409916329,0.525532409916329,
+  0.525532409916329,0.525532409916329,0.525532409916329,0.525532409916329,
+  0.796666477413627,0.796666477413627,0.796666477413627,0.796666477413627,
+  0.796666477413627,0.796666477413627,0.796666477413627,0.796666477413627,
+  0.960289856497536,0.960289856497536,0.960289856497536,0.960289856497536,
+  0.960289856497536,0.960289856497536,0.960289856497536,0.960289856497536
+};
+static const double cubature_quad_8_weights[]={
+  0.0102472165595,0.0225113066165,0.0317560645868,0.0367139485276,
+  0.0367139485276,0.0317560645868,0.0225113066165,0.0102472165595,
+  0.0225113066165,0.0494533244846,0.0697624084252,0.0806539949271,
+  0.0806539949271,0.0697624084252,0.0494533244846,0.0225113066165,
+  0.0317560645868,0.0697624084252,0.098411859668,0.113776313198,
+  0.113776313198,0.098411859668,0.0697624084252,0.0317560645868,
+  0.0367139485276,0.0806539949271,0.113776313198,0.131539526726,
+  0.131539526726,0.113776313198,0.0806539949271,0.0367139485276,
+  0.0367139485276,0.0806539949271,0.113776313198,0.131539526726,
+  0.131539526726,0.113776313198,0.0806539949271,0.0367139485276,
+  0.0317560645868,0.0697624084252,0.098411859668,0.113776313198,
+  0.113776313198,0.098411859668,0.0697624084252,0.0317560645868,
+  0.0225113066165,0.0494533244846,0.0697624084252,0.0806539949271,
+  0.0806539949271,0.0697624084252,0.0494533244846,0.0225113066165,
+  0.0102472165595,0.0225113066165,0.0317560645868,0.0367139485276,
+  0.0367139485276,0.0317560645868,0.0225113066165,0.0102472165595
+};
+static const double cubature_quad_9_locs[]={
+  -0.968160239507626,-0.836031107326636,-0.613371432700590,-0.324253423403809,
+  0E-15,0.324253423403809,0.613371432700590,0.836031107326636,
+  0.968160239507626,-0.968160239507626,-0.836031107326636,-0.613371432700590,
+  -0.324253423403809,0E-15,0.324253423403809,0.613371432700590,
+  0.836031107326636,0.968160239507626,-0.968160239507626,-0.836031107326636,
+  -0.613371432700590,-0.324253423403809,0E-15,0.324253423403809,
+  0.613371432700590,0.836031107326636,0.968160239507626,-0.968160239507626,
+  -0.836031107326636,-0.613371432700590,-0.324253423403809,0E-15,
+  0.324253423403809,0.613371432700590,0.836031107326636,0.968160239507626,
+  -0.968160239507626,-0.836031107326636,-0.613371432700590,-0.324253423403809,
+  0E-15,0.324253423403809,0.613371432700590,0.836031107326636,
+  0.968160239507626,-0.968160239507626,-0.836031107326636,-0.613371432700590,
+  -0.324253423403809,0E-15,0.324253423403809,0.613371432700590,
+  0.836031107326636,0.968160239507626,-0.968160239507626,-0.836031107326636,
+  -0.613371432700590,-0.324253423403809,0E-15,0.324253423403809,
+  0.613371432700590,0.836031107326636,0.968160239507626,-0.968160239507626,
+  -0.836031107326636,-0.613371432700590,-0.324253423403809,0E-15,
+  0.324253423403809,0.613371432700590,0.836031107326636,0.968160239507626,
+  -0.968160239507626,-0.836031107326636,-0.613371432700590,-0.324253423403809,
+  0E-15,0.324253423403809,0.613371432700590,0.836031107326636,
+  0.968160239507626,-0.968160239507626,-0.968160239507626,-0.968160239507626,
+  -0.968160239507626,-0.968160239507626,-0.968160239507626,-0.968160239507626,
+  -0.968160239507626,-0.968160239507626,-0.836031107326636,-0.836031107326636,
+  -0.836031107326636,-0.836031107326636,-0.836031107326636,-0.836031107326636,
+  -0.836031107326636,-0.836031107326636,-0.836031107326636,-0.613371432700590,
+  -0.613371432700590,-0.613371432700590,-0.613371432700590,-0.613371432700590,
+  -0.613371432700590,-0.613371432700590,-0.613371432700590,-0.613371432700590,
+  -0.324253423403809,-0.324253423403809,-0.324253423403809,-0.324253423403809,
+  -0.324253423403809,-0.324253423403809,-0.324253423403809,-0.324253423403809,
+  -0.324253423403809,0E-15,0E-15,0E-15,
+  0E-15,0E-15,0E-15,0E-15,
+  0E-15,0E-15,0.324253423403809,0.324253423403809,
+  0.324253423403809,0.324253423403809,0.324253423403809,0.324253423403809,
+  0.324253423403809,0.324253423403809,0.324253423403809,0.613371432700590,
+  0.613371432700590,0.613371432700590,0.613371432700590,0.613371432700590,
+  0.613371432700590,0.613371432700590,0.613371432700590,0.613371432700590,
+  0.836031107326636,0.836031107326636,0.836031107326636,0.836031107326636,
+  0.836031107326636,0.836031107326636,0.836031107326636,0.836031107326636,
+  0.836031107326636,0.968160239507626,0.968160239507626,0.968160239507626,
+  0.968160239507626,0.968160239507626,0.968160239507626,0.968160239507626,
+  0.968160239507626,0.968160239507626
+};
+static const double cubature_quad_9_weights[]={
+  0.00660552620355,0.0146820687691,0.0211809749506,0.025385817643,
+  0.0268400015906,0.025385817643,0.0211809749506,0.0146820687691,
+  0.00660552620355,0.0146820687691,0.0326337579624,0.0470788429626,
+  0.0564249249657,0.05965713207,0.0564249249657,0.0470788429626,
+  0.0326337579624,0.0146820687691,0.0211809749506,0.0470788429626,
+  0.0679179350796,0.0814009892668,0.0860639082865,0.0814009892668,
+  0.0679179350796,0.0470788429626,0.0211809749506,0.025385817643,
+  0.0564249249657,0.0814009892668,0.0975606965354,0.103149297258,
+  0.0975606965354,0.0814009892668,0.0564249249657,0.025385817643,
+  0.0268400015906,0.05965713207,0.0860639082865,0.103149297258,
+  0.109058031592,0.103149297258,0.0860639082865,0.05965713207,
+  0.0268400015906,0.025385817643,0.0564249249657,0.0814009892668,
+  0.0975606965354,0.103149297258,0.0975606965354,0.0814009892668,
+  0.0564249249657,0.025385817643,0.0211809749506,0.0470788429626,
+  0.0679179350796,0.0814009892668,0.0860639082865,0.0814009892668,
+  0.0679179350796,0.0470788429626,0.0211809749506,0.0146820687691,
+  0.0326337579624,0.0470788429626,0.0564249249657,0.05965713207,
+  0.0564249249657,0.0470788429626,0.0326337579624,0.0146820687691,
+  0.00660552620355,0.0146820687691,0.0211809749506,0.025385817643,
+  0.0268400015906,0.025385817643,0.0211809749506,0.0146820687691,
+  0.00660552620355
+};
+static const double cubature_quad_10_locs[]={
+  -0.973906528517172,-0.865063366688985,-0.679409568299024,-0.433395394129247,
+  -0.148874338981631,0.148874338981631,0.433395394129247,0.679409568299024,
+  0.865063366688985,0.973906528517172,-0.973906528517172,-0.865063366688985,
+  -0.679409568299024,-0.433395394129247,-0.148874338981631,0.148874338981631,
+  0.433395394129247,0.679409568299024,0.865063366688985,0.973906528517172,
+  -0.973906528517172,-0.865063366688985,-0.679409568299024,-0.433395394129247,
+  -0.148874338981631,0.148874338981631,0.433395394129247,0.679409568299024,
+  0.865063366688985,0.973906528517172,-0.973906528517172,-0.865063366688985,
+  -0.679409568299024,-0.433395394129247,-0.148874338981631,0.148874338981631,
+  0.433395394129247,0.679409568299024,0.865063366688985,0.973906528517172,
+  -0.973906528517172,-0.865063366688985,-0.679409568299024,-0.433395394129247,
+  -0.148874338981631,0.148874338981631,0.433395394129247,0.679409568299024,
+  0.865063366688985,0.973906528517172,-0.973906528517172,-0.865063366688985,
+  -0.679409568299024,-0.433395394129247,-0.148874338981631,0.148874338981631,
+  0.433395394129247,0.679409568299024,0.865063366688985,0.973906528517172,
+  -0.973906528517172,-0.865063366688985,-0.679409568299024,-0.433395394129247,
+  -0.148874338981631,0.148874338981631,0.433395394129247,0.679409568299024,
+  0.865063366688985,0.973906528517172,-0.973906528517172,-0.865063366688985,
+  -0.679409568299024,-0.433395394129247,-0.148874338981631,0.148874338981631,
+  0.433395394129247,0.679409568299024,0.865063366688985,0.973906528517172,
+  -0.973906528517172,-0.865063366688985,-0.679409568299024,-0.433395394129247,
+  -0.148874338981631,0.148874338981631,0.433395394129247,0.679409568299024,
+  0.865063366688985,0.973906528517172,-0.973906528517172,-0.865063366688985,
+  -0.679409568299024,-0.433395394129247,-0.148874338981631,0.148874338981631,
+  0.433395394129247,0.679409568299024,0.865063366688985,0.973906528517172,
+  -0.973906528517172,-0.973906528517172,-0.973906528517172,-0.973906528517172,
+  -0.973906528517172,-0.973906528517172,-0.973906528517172,-0.973906528517172,
+  -0.973906528517172,-0.973906528517172,-0.865063366688985,-0.865063366688985,
+  -0.865063366688985,-0.865063366688985,-0.865063366688985,-0.865063366688985,
+  -0.865063366688985,-0.865063366688985,-0.865063366688985,-0.865063366688985,
+  -0.679409568299024,-0.679409568299024,-0.679409568299024,-0.679409568299024,
+  -0.679409568299024,-0.679409568299024,-0.679409568299024,-0.679409568299024,
+  -0.679409568299024,-0.679409568299024,-0.433395394129247,-0.433395394129247,
+  -0.433395394129247,-0.433395394129247,-0.433395394129247,-0.433395394129247,
+  -0.433395394129247,-0.433395394129247,-0.433395394129247,-0.433395394129247,
+  -0.148874338981631,-0.148874338981631,-0.148874338981631,-0.148874338981631,
+  -0.148874338981631,-0.148874338981631,-0.148874338981631,-0.148874338981631,
+  -0.148874338981631,-0.148874338981631,0.148874338981631,0.148874338981631,
+  0.148874338981631,0.148874338981631,0.148874338981631,0.148874338981631,
+  0.148874338981631,0.148874338981631,0.148874338981631,0.148874338981631,
+  0.433395394129247,0.433395394129247,0.433395394129247,0.433395394129247,
+  0.433395394129247,0.433395394129247,0.433395394129247,0.433395394129247,
+  0.433395394129247,0.433395394129247,0.679409568299024,0.679409568299024,
+  0.679409568299024,0.679409568299024,0.679409568299024,0.679409568299024,
+  0.679409568299024,0.679409568299024,0.679409568299024,0.679409568299024,
+  0.865063366688985,0.865063366688985,0.865063366688985,0.865063366688985,
+  0.865063366688985,0.865063366688985,0.865063366688985,0.865063366688985,
+  0.865063366688985,0.865063366688985,0.973906528517172,0.973906528517172,
+  0.973906528517172,0.973906528517172,0.973906528517172,0.973906528517172,
+  0.973906528517172,0.973906528517172,0.973906528517172,0.973906528517172
+};
+static const double cubature_quad_10_weights[]={
+  0.00444506815193,0.00996412235662,0.0146067823086,0.017952374154,
+  0.0197029973375,0.0197029973375,0.017952374154,0.0146067823086,
+  0.00996412235662,0.00444506815193,0.00996412235662,0.0223357057629,
+  0.0327427524585,0.0402422744822,0.0441664940903,0.0441664940903,
+  0.0402422744822,0.0327427524585,0.0223357057629,0.00996412235662,
+  0.0146067823086,0.0327427524585,0.0479988342405,0.0589926660802,
+  0.0647453274281,0.0647453274281,0.0589926660802,0.0479988342405,
+  0.0327427524585,0.0146067823086,0.017952374154,0.0402422744822,
+  0.0589926660802,0.072504566128,0.0795748384656,0.0795748384656,
+  0.072504566128,0.0589926660802,0.0402422744822,0.017952374154,
+  0.0197029973375,0.0441664940903,0.0647453274281,0.0795748384656,
+  0.0873345673933,0.0873345673933,0.0795748384656,0.0647453274281,
+  0.0441664940903,0.0197029973375,0.0197029973375,0.0441664940903,
+  0.0647453274281,0.0795748384656,0.0873345673933,0.0873345673933,
+  0.0795748384656,0.0647453274281,0.0441664940903,0.0197029973375,
+  0.017952374154,0.0402422744822,0.0589926660802,0.072504566128,
+  0.0795748384656,0.0795748384656,0.072504566128,0.0589926660802,
+  0.0402422744822,0.017952374154,0.0146067823086,0.0327427524585,
+  0.0479988342405,0.0589926660802,0.0647453274281,0.0647453274281,
+  0.0589926660802,0.0479988342405,0.0327427524585,0.0146067823086,
+  0.00996412235662,0.0223357057629,0.0327427524585,0.0402422744822,
+  0.0441664940903,0.0441664940903,0.0402422744822,0.0327427524585,
+  0.0223357057629,0.00996412235662,0.00444506815193,0.00996412235662,
+  0.0146067823086,0.017952374154,0.0197029973375,0.0197029973375,
+  0.017952374154,0.0146067823086,0.00996412235662,0.00444506815193
+};
+static const double cubature_quad_11_locs[]={
+  -0.978228658146057,-0.887062599768095,-0.730152005574049,-0.519096129206812,
+  -0.269543155952345,0E-15,0.269543155952345,0.519096129206812,
+  0.730152005574049,0.887062599768095,0.978228658146057,-0.978228658146057,
+  -0.887062599768095,-0.730152005574049,-0.519096129206812,-0.269543155952345,
+  0E-15,0.269543155952345,0.519096129206812,0.730152005574049,
+  0.887062599768095,0.978228658146057,-0.978228658146057,-0.887062599768095,
+  -0.730152005574049,-0.519096129206812,-0.269543155952345,0E-15,
+  0.269543155952345,0.519096129206812,0.730152005574049,0.887062599768095,
+  0.978228658146057,-0.978228658146057,-0.887062599768095,-0.730152005574049,
+  -0.519096129206812,-0.269543155952345,0E-15,0.269543155952345,
+  0.519096129206812,0.730152005574049,0.887062599768095,0.978228658146057,
+  -0.978228658146057,-0.887062599768095,-0.730152005574049,-0.519096129206812,
+  -0.269543155952345,0E-15,0.269543155952345,0.519096129206812,
+  0.730152005574049,0.887062599768095,0.978228658146057,-0.978228658146057,
+  -0.887062599768095,-0.730152005574049,-0.519096129206812,-0.269543155952345,
+  0E-15,0.269543155952345,0.519096129206812,0.730152005574049,
+  0.887062599768095,0.978228658146057,-0.978228658146057,-0.887062599768095,
+  -0.730152005574049,-0.519096129206812,-0.269543155952345,0E-15,
+  0.269543155952345,0.519096129206812,0.730152005574049,0.887062599768095,
+  0.978228658146057,-0.978228658146057,-0.887062599768095,-0.730152005574049,
+  -0.519096129206812,-0.269543155952345,0E-15,0.269543155952345,
+  0.519096129206812,0.730152005574049,0.887062599768095,0.978228658146057,
+  -0.978228658146057,-0.887062599768095,-0.730152005574049,-0.519096129206812,
+  -0.269543155952345,0E-15,0.269543155952345,0.519096129206812,
+  0.730152005574049,0.887062599768095,0.978228658146057,-0.978228658146057,
+  -0.887062599768095,-0.730152005574049,-0.519096129206812,-0.269543155952345,
+  0E-15,0.269543155952345,0.519096129206812,0.730152005574049,
+  0.887062599768095,0.978228658146057,-0.978228658146057,-0.887062599768095,
+  -0.730152005574049,-0.519096129206812,-0.269543155952345,0E-15,
+  0.269543155952345,0.519096129206812,0.730152005574049,0.887062599768095,
+  0.978228658146057,-0.978228658146057,-0.978228658146057,-0.978228658146057,
+  -0.978228658146057,-0.978228658146057,-0.978228658146057,-0.978228658146057,
+  -0.978228658146057,-0.978228658146057,-0.978228658146057,-0.978228658146057,
+  -0.887062599768095,-0.887062599768095,-0.887062599768095,-0.887062599768095,
+  -0.887062599768095,-0.887062599768095,-0.887062599768095,-0.887062599768095,
+  -0.887062599768095,-0.887062599768095,-0.887062599768095,-0.730152005574049,
+  -0.730152005574049,-0.730152005574049,-0.730152005574049,-0.730152005574049,
+  -0.730152005574049,-0.730152005574049,-0.730152005574049,-0.730152005574049,
+  -0.730152005574049,-0.730152005574049,-0.519096129206812,-0.519096129206812,
+  -0.519096129206812,-0.519096129206812,-0.519096129206812,-0.519096129206812,
+  -0.519096129206812,-0.519096129206812,-0.519096129206812,-0.519096129206812,
+  -0.519096129206812,-0.269543155952345,-0.269543155952345,-0.269543155952345,
+  -0.269543155952345,-0.269543155952345,-0.269543155952345,-0.269543155952345,
+  -0.269543155952345,-0.269543155952345,-0.269543155952345,-0.269543155952345,
+  0E-15,0E-15,0E-15,0E-15,
+  0E-15,0E-15,0E-15,0E-15,
+  0E-15,0E-15,0E-15,0.269543155952345,
+  0.269543155952345,0.269543155952345,0.269543155952345,0.269543155952345,
+  0.269543155952345,0.269543155952345,0.269543155952345,0.269543155952345,
+  0.269543155952345,0.269543155952345,0.519096129206812,0.519096129206812,
+  0.519096129206812,0.519096129206812,0.519096129206812,0.519096129206812,
+  0.519096129206812,0.519096129206812,0.519096129206812,0.519096129206812,
+  0.519096129206812,0.730152005574049,0.730152005574049,0.730152005574049,
+  0.730152005574049,0.730152005574049,0.730152005574049,0.730152005574049,
+  0.730152005574049,0.730152005574049,0.730152005574049,0.730152005574049,
+  0.887062599768095,0.887062599768095,0.887062599768095,0.887062599768095,
+  0.887062599768095,0.887062599768095,0.887062599768095,0.887062599768095,
+  0.887062599768095,0.887062599768095,0.887062599768095,0.978228658146057,
+  0.978228658146057,0.978228658146057,0.978228658146057,0.978228658146057,
+  0.978228658146057,0.978228658146057,0.978228658146057,0.978228658146057,
+  0.978228658146057,0.978228658146057
+};
+static const double cubature_quad_11_weights[]={
+  0.00309898936477,0.00699087922603,0.0103705091101,0.0129815627353,
+  0.0146299524245,0.015193348511,0.0146299524245,0.0129815627353,
+  0.0103705091101,0.00699087922603,0.00309898936477,0.00699087922603,
+  0.0157704291949,0.023394393516,0.0292845591144,0.0330030917967,
+  0.0342740332338,0.0330030917967,0.0292845591144,0.023394393516,
+  0.0157704291949,0.00699087922603,0.0103705091101,0.023394393516,
+  0.0347040426875,0.0434417155929,0.0489579140296,0.0508432719833,
+  0.0489579140296,0.0434417155929,0.0347040426875,0.023394393516,
+  0.0103705091101,0.0129815627353,0.0292845591144,0.0434417155929,
+  0.0543793318446,0.0612843810862,0.0636444284373,0.0612843810862,
+  0.0543793318446,0.0434417155929,0.0292845591144,0.0129815627353,
+  0.0146299524245,0.0330030917967,0.0489579140296,0.0612843810862,
+  0.0690662286152,0.0717259531161,0.0690662286152,0.0612843810862,
+  0.0489579140296,0.0330030917967,0.0146299524245,0.015193348511,
+  0.0342740332338,0.0508432719833,0.0636444284373,0.0717259531161,
+  0.0744881029927,0.0717259531161,0.0636444284373,0.0508432719833,
+  0.0342740332338,0.015193348511,0.0146299524245,0.0330030917967,
+  0.0489579140296,0.0612843810862,0.0690662286152,0.0717259531161,
+  0.0690662286152,0.0612843810862,0.0489579140296,0.0330030917967,
+  0.0146299524245,0.0129815627353,0.0292845591144,0.0434417155929,
+  0.0543793318446,0.0612843810862,0.0636444284373,0.0612843810862,
+  0.0543793318446,0.0434417155929,0.0292845591144,0.0129815627353,
+  0.0103705091101,0.023394393516,0.0347040426875,0.0434417155929,
+  0.0489579140296,0.0508432719833,0.0489579140296,0.0434417155929,
+  0.0347040426875,0.023394393516,0.0103705091101,0.00699087922603,
+  0.0157704291949,0.023394393516,0.0292845591144,0.0330030917967,
+  0.0342740332338,0.0330030917967,0.0292845591144,0.023394393516,
+  0.0157704291949,0.00699087922603,0.00309898936477,0.00699087922603,
+  0.0103705091101,0.0129815627353,0.0146299524245,0.015193348511,
+  0.0146299524245,0.0129815627353,0.0103705091101,0.00699087922603,
+  0.00309898936477
+};
+static const double cubature_quad_12_locs[]={
+  -0.981560634246719,-0.904117256370475,-0.769902674194305,-0.587317954286617,
+  -0.367831498998180,-0.125233408511469,0.125233408511469,0.367831498998180,
+  0.587317954286617,0.769902674194305,0.904117256370475,0.981560634246719,
+  -0.981560634246719,-0.904117256370475,-0.769902674194305,-0.587317954286617,
+  -0.367831498998180,-0.125233408511469,0.125233408511469,0.367831498998180,
+  0.587317954286617,0.769902674194305,0.904117256370475,0.981560634246719,
+  -0.981560634246719,-0.904117256370475,-0.769902674194305,-0.587317954286617,
+  -0.367831498998180,-0.125233408511469,0.125233408511469,0.367831498998180,
+  0.587317954286617,0.769902674194305,0.904117256370475,0.981560634246719,
+  -0.981560634246719,-0.904117256370475,-0.769902674194305,-0.587317954286617,
+  -0.367831498998180,-0.125233408511469,0.125233408511469,0.367831498998180,
+  0.587317954286617,0.769902674194305,0.904117256370475,0.981560634246719,
+  -0.981560634246719,-0.904117256370475,-0.769902674194305,-0.587317954286617,
+  -0.367831498998180,-0.125233408511469,0.125233408511469,0.367831498998180,
+  0.587317954286617,0.769902674194305,0.904117256370475,0.981560634246719,
+  -0.981560634246719,-0.904117256370475,-0.769902674194305,-0.587317954286617,
+  -0.367831498998180,-0.125233408511469,0.125233408511469,0.367831498998180,
+  0.587317954286617,0.769902674194305,0.904117256370475,0.981560634246719,
+  -0.981560634246719,-0.904117256370475,-0.769902674194305,-0.587317954286617,
+  -0.367831498998180,-0.125233408511469,0.125233408511469,0.367831498998180,
+  0.587317954286617,0.769902674194305,0.904117256370475,0.981560634246719,
+  -0.981560634246719,-0.904117256370475,-0.769902674194305,-0.587317954286617,
+  -0.367831498998180,-0.125233408511469,0.125233408511469,0.367831498998180,
+  0.587317954286617,0.769902674194305,0.904117256370475,0.981560634246719,
+  -0.981560634246719,-0.904117256370475,-0.769902674194305,-0.587317954286617,
+  -0.367831498998180,-0.125233408511469,0.125233408511469,0.367831498998180,
+  0.587317954286617,0.769902674194305,0.904117256370475,0.981560634246719,
+  -0.981560634246719,-0.904117256370475,-0.769902674194305,-0.587317954286617,
+  -0.367831498998180,-0.125233408511469,0.125233408511469,0.367831498998180,
+  0.587317954286617,0.769902674194305,0.904117256370475,0.981560634246719,
+  -0.981560634246719,-0.904117256370475,-0.769902674194305,-0.587317954286617,
+  -0.367831498998180,-0.125233408511469,0.125233408511469,0.367831498998180,
+  0.587317954286617,0.769902674194305,0.904117256370475,0.981560634246719,
+  -0.981560634246719,-0.904117256370475,-0.769902674194305,-0.587317954286617,
+  -0.367831498998180,-0.125233408511469,0.125233408511469,0.367831498998180,
+  0.587317954286617,0.769902674194305,0.904117256370475,0.981560634246719,
+  -0.981560634246719,-0.981560634246719,-0.981560634246719,-0.981560634246719,
+  -0.981560634246719,-0.981560634246719,-0.981560634246719,-0.981560634246719,
+  -0.981560634246719,-0.981560634246719,-0.981560634246719,-0.981560634246719,
+  -0.904117256370475,-0.904117256370475,-0.904117256370475,-0.904117256370475,
+  -0.904117256370475,-0.904117256370475,-0.904117256370475,-0.904117256370475,
+  -0.904117256370475,-0.904117256370475,-0.904117256370475,-0.904117256370475,
+  -0.769902674194305,-0.769902674194305,-0.769902674194305,-0.769902674194305,
+  -0.769902674194305,-0.769902674194305,-0.769902674194305,-0.769902674194305,
+  -0.769902674194305,-0.769902674194305,-0.769902674194305,-0.769902674194305,
+  -0.587317954286617,-0.587317954286617,-0.587317954286617,-0.587317954286617,
+  -0.587317954286617,-0.587317954286617,-0.587317954286617,-0.587317954286617,
+  -0.587317954286617,-0.587317954286617,-0.587317954286617,-0.587317954286617,
+  -0.367831498998180,-0.367831498998180,-0.367831498998180,-0.367831498998180,
+  -0.367831498998180,-0.367831498998180,-0.367831498998180,-0.367831498998180,
+  -0.367831498998180,-0.367831498998180,-0.367831498998180,-0.367831498998180,
+  -0.125233408511469,-0.125233408511469,-0.125233408511469,-0.125233408511469,
+  -0.125233408511469,-0.125233408511469,-0.125233408511469,-0.125233408511469,
+  -0.125233408511469,-0.125233408511469,-0.125233408511469,-0.125233408511469,
+  0.125233408511469,0.125233408511469,0.125233408511469,0.125233408511469,
+  0.125233408511469,0.125233408511469,0.125233408511469,0.125233408511469,
+  0.125233408511469,0.125233408511469,0.125233408511469,0.125233408511469,
+  0.367831498998180,0.367831498998180,0.367831498998180,0.367831498998180,
+  0.367831498998180,0.367831498998180,0.367831498998180,0.367831498998180,
+  0.367831498998180,0.367831498998180,0.367831498998180,0.367831498998180,
+  0.587317954286617,0.587317954286617,0.587317954286617,0.587317954286617,
+  0.587317954286617,0.587317954286617,0.587317954286617,0.587317954286617,
+  0.587317954286617,0.587317954286617,0.587317954286617,0.587317954286617,
+  0.769902674194305,0.769902674194305,0.769902674194305,0.769902674194305,
+  0.769902674194305,0.769902674194305,0.769902674194305,0.769902674194305,
+  0.769902674194305,0.769902674194305,0.769902674194305,0.769902674194305,
+  0.904117256370475,0.904117256370475,0.904117256370475,0.904117256370475,
+  0.904117256370475,0.904117256370475,0.904117256370475,0.904117256370475,
+  0.904117256370475,0.904117256370475,0.904117256370475,0.904117256370475,
+  0.981560634246719,0.981560634246719,0.981560634246719,0.981560634246719,
+  0.981560634246719,0.981560634246719,0.981560634246719,0.981560634246719,
+  0.981560634246719,0.981560634246719,0.981560634246719,0.981560634246719
+};
+static const double cubature_quad_12_weights[]={
+  0.00222551236318,0.00504489867678,0.00755174899722,0.00958449169844,
+  0.0110150889549,0.011753595696,0.011753595696,0.0110150889549,
+  0.00958449169844,0.00755174899722,0.00504489867678,0.00222551236318,
+  0.00504489867678,0.0114360194443,0.0171186685609,0.021726587678,
+  0.0249695344823,0.026643617153,0.026643617153,0.0249695344823,
+  0.021726587678,0.0171186685609,0.0114360194443,0.00504489867678,
+  0.00755174899722,0.0171186685609,0.0256250712692,0.0325227020843,
+  0.0373770949764,0.0398830426553,0.0398830426553,0.0373770949764,
+  0.0325227020843,0.0256250712692,0.0171186685609,0.00755174899722,
+  0.00958449169844,0.021726587678,0.0325227020843,0.0412770032813,
+  0.0474380778075,0.0506185641736,0.0506185641736,0.0474380778075,
+  0.0412770032813,0.0325227020843,0.021726587678,0.00958449169844,
+  0.0110150889549,0.0249695344823,0.0373770949764,0.0474380778075,
+  0.0545187646191,0.058173975698,0.058173975698,0.0545187646191,
+  0.0474380778075,0.0373770949764,0.0249695344823,0.0110150889549,
+  0.011753595696,0.026643617153,0.0398830426553,0.0506185641736,
+  0.058173975698,0.0620742504375,0.0620742504375,0.058173975698,
+  0.0506185641736,0.0398830426553,0.026643617153,0.011753595696,
+  0.011753595696,0.026643617153,0.0398830426553,0.0506185641736,
+  0.058173975698,0.0620742504375,0.0620742504375,0.058173975698,
+  0.0506185641736,0.0398830426553,0.026643617153,0.011753595696,
+  0.0110150889549,0.0249695344823,0.0373770949764,0.0474380778075,
+  0.0545187646191,0.058173975698,0.058173975698,0.0545187646191,
+  0.0474380778075,0.0373770949764,0.0249695344823,0.0110150889549,
+  0.00958449169844,0.021726587678,0.0325227020843,0.0412770032813,
+  0.0474380778075,0.0506185641736,0.0506185641736,0.0474380778075,
+  0.0412770032813,0.0325227020843,0.021726587678,0.00958449169844,
+  0.00755174899722,0.0171186685609,0.0256250712692,0.0325227020843,
+  0.0373770949764,0.0398830426553,0.0398830426553,0.0373770949764,
+  0.0325227020843,0.0256250712692,0.0171186685609,0.00755174899722,
+  0.00504489867678,0.0114360194443,0.0171186685609,0.021726587678,
+  0.0249695344823,0.026643617153,0.026643617153,0.0249695344823,
+  0.021726587678,0.0171186685609,0.0114360194443,0.00504489867678,
+  0.00222551236318,0.00504489867678,0.00755174899722,0.00958449169844,
+  0.0110150889549,0.011753595696,0.011753595696,0.0110150889549,
+  0.00958449169844,0.00755174899722,0.00504489867678,0.00222551236318
+};
+static const double cubature_quad_13_locs[]={
+  -0.984183054718588,-0.917598399222978,-0.801578090733310,-0.642349339440340,
+  -0.448492751036447,-0.230458315955135,0E-15,0.230458315955135,
+  0.448492751036447,0.642349339440340,0.801578090733310,0.917598399222978,
+  0.984183054718588,-0.984183054718588,-0.917598399222978,-0.801578090733310,
+  -0.642349339440340,-0.448492751036447,-0.230458315955135,0E-15,
+  0.230458315955135,0.448492751036447,0.642349339440340,0.801578090733310,
+  0.917598399222978,0.984183054718588,-0.984183054718588,-0.917598399222978,
+  -0.801578090733310,-0.642349339440340,-0.448492751036447,-0.230458315955135,
+  0E-15,0.230458315955135,0.448492751036447,0.642349339440340,
+  0.801578090733310,0.917598399222978,0.984183054718588,-0.984183054718588,
+  -0.917598399222978,-0.801578090733310,-0.642349339440340,-0.448492751036447,
+  -0.230458315955135,0E-15,0.230458315955135,0.448492751036447,
+  0.642349339440340,0.801578090733310,0.917598399222978,0.984183054718588,
+  -0.984183054718588,-0.917598399222978,-0.801578090733310,-0.642349339440340,
+  -0.448492751036447,-0.230458315955135,0E-15,0.230458315955135,
+  0.448492751036447,0.642349339440340,0.801578090733310,0.917598399222978,
+  0.984183054718588,-0.984183054718588,-0.917598399222978,-0.801578090733310,
+  -0.642349339440340,-0.448492751036447,-0.230458315955135,0E-15,
+  0.230458315955135,0.448492751036447,0.642349339440340,0.801578090733310,
+  0.917598399222978,0.984183054718588,-0.984183054718588,-0.917598399222978,
+  -0.801578090733310,-0.642349339440340,-0.448492751036447,-0.230458315955135,
+  0E-15,0.230458315955135,0.448492751036447,0.642349339440340,
+  0.801578090733310,0.917598399222978,0.984183054718588,-0.984183054718588,
+  -0.917598399222978,-0.801578090733310,-0.642349339440340,-0.448492751036447,
+  -0.230458315955135,0E-15,0.230458315955135,0.448492751036447,
+  0.642349339440340,0.801578090733310,0.917598399222978,0.984183054718588,
+  -0.984183054718588,-0.917598399222978,-0.801578090733310,-0.642349339440340,
+  -0.448492751036447,-0.230458315955135,0E-15,0.230458315955135,
+  0.448492751036447,0.642349339440340,0.801578090733310,0.917598399222978,
+  0.984183054718588,-0.984183054718588,-0.917598399222978,-0.801578090733310,
+  -0.642349339440340,-0.448492751036447,-0.230458315955135,0E-15,
+  0.230458315955135,0.448492751036447,0.642349339440340,0.801578090733310,
+  0.917598399222978,0.984183054718588,-0.984183054718588,-0.917598399222978,
+  -0.801578090733310,-0.642349339440340,-0.448492751036447,-0.230458315955135,
+  0E-15,0.230458315955135,0.448492751036447,0.642349339440340,
+  0.801578090733310,0.917598399222978,0.984183054718588,-0.984183054718588,
+  -0.917598399222978,-0.801578090733310,-0.642349339440340,-0.448492751036447,
+  -0.230458315955135,0E-15,0.230458315955135,0.448492751036447,
+  0.642349339440340,0.801578090733310,0.917598399222978,0.984183054718588,
+  -0.984183054718588,-0.917598399222978,-0.801578090733310,-0.642349339440340,
+  -0.448492751036447,-0.230458315955135,0E-15,0.230458315955135,
+  0.448492751036447,0.642349339440340,0.801578090733310,0.917598399222978,
+  0.984183054718588,-0.984183054718588,-0.984183054718588,-0.984183054718588,
+  -0.984183054718588,-0.984183054718588,-0.984183054718588,-0.984183054718588,
+  -0.984183054718588,-0.984183054718588,-0.984183054718588,-0.984183054718588,
+  -0.984183054718588,-0.984183054718588,-0.917598399222978,-0.917598399222978,
+  -0.917598399222978,-0.917598399222978,-0.917598399222978,-0.917598399222978,
+  -0.917598399222978,-0.917598399222978,-0.917598399222978,-0.917598399222978,
+  -0.917598399222978,-0.917598399222978,-0.917598399222978,-0.801578090733310,
+  -0.801578090733310,-0.801578090733310,-0.801578090733310,-0.801578090733310,
+  -0.801578090733310,-0.801578090733310,-0.801578090733310,-0.801578090733310,
+  -0.801578090733310,-0.801578090733310,-0.801578090733310,-0.801578090733310,
+  -0.642349339440340,-0.642349339440340,-0.642349339440340,-0.642349339440340,
+  -0.642349339440340,-0.642349339440340,-0.642349339440340,-0.642349339440340,
+  -0.642349339440340,-0.642349339440340,-0.642349339440340,-0.642349339440340,
+  -0.642349339440340,-0.448492751036447,-0.448492751036447,-0.448492751036447,
+  -0.448492751036447,-0.448492751036447,-0.448492751036447,-0.448492751036447,
+  -0.448492751036447,-0.448492751036447,-0.448492751036447,-0.448492751036447,
+  -0.448492751036447,-0.448492751036447,-0.230458315955135,-0.230458315955135,
+  -0.230458315955135,-0.230458315955135,-0.230458315955135,-0.230458315955135,
+  -0.230458315955135,-0.230458315955135,-0.230458315955135,-0.230458315955135,
+  -0.230458315955135,-0.230458315955135,-0.230458315955135,0E-15,
+  0E-15,0E-15,0E-15,0E-15,
+  0E-15,0E-15,0E-15,0E-15,
+  0E-15,0E-15,0E-15,0E-15,
+  0.230458315955135,0.230458315955135,0.230458315955135,0.230458315955135,
+  0.230458315955135,0.230458315955135,0.230458315955135,0.230458315955135,
+  0.230458315955135,0.230458315955135,0.230458315955135,0.230458315955135,
+  0.230458315955135,0.448492751036447,0.448492751036447,0.448492751036447,
+  0.448492751036447,0.448492751036447,0.448492751036447,0.448492751036447,
+  0.448492751036447,0.448492751036447,0.448492751036447,0.448492751036447,
+  0.448492751036447,0.448492751036447,0.642349339440340,0.642349339440340,
+  0.642349339440340,0.642349339440340,0.642349339440340,0.642349339440340,
+  0.642349339440340,0.642349339440340,0.642349339440340,0.642349339440340,
+  0.642349339440340,0.642349339440340,0.642349339440340,0.801578090733310,
+  0.801578090733310,0.801578090733310,0.801578090733310,0.801578090733310,
+  0.801578090733310,0.801578090733310,0.801578090733310,0.801578090733310,
+  0.801578090733310,0.801578090733310,0.801578090733310,0.801578090733310,
+  0.917598399222978,0.917598399222978,0.917598399222978,0.917598399222978,
+  0.917598399222978,0.917598399222978,0.917598399222978,0.917598399222978,
+  0.917598399222978,0.917598399222978,0.917598399222978,0.917598399222978,
+  0.917598399222978,0.984183054718588,0.984183054718588,0.984183054718588,
+  0.984183054718588,0.984183054718588,0.984183054718588,0.984183054718588,
+  0.984183054718588,0.984183054718588,0.984183054718588,0.984183054718588,
+  0.984183054718588,0.984183054718588
+};
+static const double cubature_quad_13_weights[]={
+  0.00163895464184,0.00372944723842,0.00562215584951,0.00721206273409,
+  0.00841322585879,0.00916084934807,0.00941461818918,0.00916084934807,
+  0.00841322585879,0.00721206273409,0.00562215584951,0.00372944723842,
+  0.00163895464184,0.00372944723842,0.00848637073235,0.0127932360492,
+  0.0164110749379,0.0191443259894,0.0208455459539,0.0214229978732,
+  0.0208455459539,0.0191443259894,0.0164110749379,0.0127932360492,
+  0.00848637073235,0.00372944723842,0.00562215584951,0.0127932360492,
+  0.0192858518408,0.02473975768,0.0288601440015,0.0314247395468,
+  0.0322952505042,0.0314247395468,0.0288601440015,0.02473975768,
+  0.0192858518408,0.0127932360492,0.00562215584951,0.00721206273409,
+  0.0164110749379,0.02473975768,0.0317359904616,0.0370215936065,
+  0.0403114390779,0.041428124528,0.0403114390779,0.0370215936065,
+  0.0317359904616,0.02473975768,0.0164110749379,0.00721206273409,
+  0.00841322585879,0.0191443259894,0.0288601440015,0.0370215936065,
+  0.0431875096139,0.0470252761463,0.048327944641,0.0470252761463,
+  0.0431875096139,0.0370215936065,0.0288601440015,0.0191443259894,
+  0.00841322585879,0.00916084934807,0.0208455459539,0.0314247395468,
+  0.0403114390779,0.0470252761463,0.0512040776699,0.0526225050402,
+  0.0512040776699,0.0470252761463,0.0403114390779,0.0314247395468,
+  0.0208455459539,0.00916084934807,0.00941461818918,0.0214229978732,
+  0.0322952505042,0.041428124528,0.048327944641,0.0526225050402,
+  0.0540802249101,0.0526225050402,0.048327944641,0.041428124528,
+  0.0322952505042,0.0214229978732,0.00941461818918,0.00916084934807,
+  0.0208455459539,0.0314247395468,0.0403114390779,0.0470252761463,
+  0.0512040776699,0.0526225050402,0.0512040776699,0.0470252761463,
+  0.0403114390779,0.0314247395468,0.0208455459539,0.00916084934807,
+  0.00841322585879,0.0191443259894,0.0288601440015,0.0370215936065,
+  0.0431875096139,0.0470252761463,0.048327944641,0.0470252761463,
+  0.0431875096139,0.0370215936065,0.0288601440015,0.0191443259894,
+  0.00841322585879,0.00721206273409,0.0164110749379,0.02473975768,
+  0.0317359904616,0.0370215936065,0.0403114390779,0.041428124528,
+  0.0403114390779,0.0370215936065,0.0317359904616,0.02473975768,
+  0.0164110749379,0.00721206273409,0.00562215584951,0.0127932360492,
+  0.0192858518408,0.02473975768,0.0288601440015,0.0314247395468,
+  0.0322952505042,0.0314247395468,0.0288601440015,0.02473975768,
+  0.0192858518408,0.0127932360492,0.00562215584951,0.00372944723842,
+  0.00848637073235,0.0127932360492,0.0164110749379,0.0191443259894,
+  0.0208455459539,0.0214229978732,0.0208455459539,0.0191443259894,
+  0.0164110749379,0.0127932360492,0.00848637073235,0.00372944723842,
+  0.00163895464184,0.00372944723842,0.00562215584951,0.00721206273409,
+  0.00841322585879,0.00916084934807,0.00941461818918,0.00916084934807,
+  0.00841322585879,0.00721206273409,0.00562215584951,0.00372944723842,
+  0.00163895464184
+};
+static const double cubature_quad_14_locs[]={
+  -0.986283808696812,-0.928434883663574,-0.827201315069765,-0.687292904811685,
+  -0.515248636358154,-0.319112368927890,-0.108054948707344,0.108054948707344,
+  0.319112368927890,0.515248636358154,0.687292904811685,0.827201315069765,
+  0.928434883663574,0.986283808696812,-0.986283808696812,-0.928434883663574,
+  -0.827201315069765,-0.687292904811685,-0.515248636358154,-0.319112368927890,
+  -0.108054948707344,0.108054948707344,0.319112368927890,0.515248636358154,
+  0.687292904811685,0.827201315069765,0.928434883663574,0.986283808696812,
+  -0.986283808696812,-0.928434883663574,-0.827201315069765,-0.687292904811685,
+  -0.515248636358154,-0.319112368927890,-0.108054948707344,0.108054948707344,
+  0.319112368927890,0.515248636358154,0.687292904811685,0.827201315069765,
+  0.928434883663574,0.986283808696812,-0.986283808696812,-0.928434883663574,
+  -0.827201315069765,-0.687292904811685,-0.515248636358154,-0.319112368927890,
+  -0.108054948707344,0.108054948707344,0.319112368927890,0.515248636358154,
+  0.687292904811685,0.827201315069765,0.928434883663574,0.986283808696812,
+  -0.986283808696812,-0.928434883663574,-0.827201315069765,-0.687292904811685,
+  -0.515248636358154,-0.319112368927890,-0.108054948707344,0.108054948707344,
+  0.319112368927890,0.515248636358154,0.687292904811685,0.827201315069765,
+  0.928434883663574,0.986283808696812,-0.986283808696812,-0.928434883663574,
+  -0.827201315069765,-0.687292904811685,-0.515248636358154,-0.319112368927890,
+  -0.108054948707344,0.108054948707344,0.319112368927890,0.515248636358154,
+  0.687292904811685,0.827201315069765,0.928434883663574,0.986283808696812,
+  -0.986283808696812,-0.928434883663574,-0.827201315069765,-0.687292904811685,
+  -0.515248636358154,-0.319112368927890,-0.108054948707344,0.108054948707344,
+  0.319112368927890,0.515248636358154,0.687292904811685,0.827201315069765,
+  0.928434883663574,0.986283808696812,-0.986283808696812,-0.928434883663574,
+  -0.827201315069765,-0.687292904811685,-0.515248636358154,-0.319112368927890,
+  -0.108054948707344,0.108054948707344,0.319112368927890,0.515248636358154,
+  0.687292904811685,0.827201315069765,0.928434883663574,0.986283808696812,
+  -0.986283808696812,-0.928434883663574,-0.827201315069765,-0.687292904811685,
+  -0.515248636358154,-0.319112368927890,-0.108054948707344,0.108054948707344,
+  0.319112368927890,0.515248636358154,0.687292904811685,0.827201315069765,
+  0.928434883663574,0.986283808696812,-0.986283808696812,-0.928434883663574,
+  -0.827201315069765,-0.687292904811685,-0.515248636358154,-0.319112368927890,
+  -0.108054948707344,0.108054948707344,0.319112368927890,0.515248636358154,
+  0.687292904811685,0.827201315069765,0.928434883663574,0.986283808696812,
+  -0.986283808696812,-0.928434883663574,-0.827201315069765,-0.687292904811685,
+  -0.515248636358154,-0.319112368927890,-0.108054948707344,0.108054948707344,
+  0.319112368927890,0.515248636358154,0.687292904811685,0.827201315069765,
+  0.928434883663574,0.986283808696812,-0.986283808696812,-0.928434883663574,
+  -0.827201315069765,-0.687292904811685,-0.515248636358154,-0.319112368927890,
+  -0.108054948707344,0.108054948707344,0.319112368927890,0.515248636358154,
+  0.687292904811685,0.827201315069765,0.928434883663574,0.986283808696812,
+  -0.986283808696812,-0.928434883663574,-0.827201315069765,-0.687292904811685,
+  -0.515248636358154,-0.319112368927890,-0.108054948707344,0.108054948707344,
+  0.319112368927890,0.515248636358154,0.687292904811685,0.827201315069765,
+  0.928434883663574,0.986283808696812,-0.986283808696812,-0.928434883663574,
+  -0.827201315069765,-0.687292904811685,-0.515248636358154,-0.319112368927890,
+  -0.108054948707344,0.108054948707344,0.319112368927890,0.515248636358154,
+  0.687292904811685,0.827201315069765,0.928434883663574,0.986283808696812,
+  -0.986283808696812,-0.986283808696812,-0.986283808696812,-0.986283808696812,
+  -0.986283808696812,-0.986283808696812,-0.986283808696812,-0.986283808696812,
+  -0.986283808696812,-0.986283808696812,-0.986283808696812,-0.986283808696812,
+  -0.986283808696812,-0.986283808696812,-0.928434883663574,-0.928434883663574,
+  -0.928434883663574,-0.928434883663574,-0.928434883663574,-0.928434883663574,
+  -0.928434883663574,-0.928434883663574,-0.928434883663574,-0.928434883663574,
+  -0.928434883663574,-0.928434883663574,-0.928434883663574,-0.928434883663574,
+  -0.827201315069765,-0.827201315069765,-0.827201315069765,-0.827201315069765,
+  -0.827201315069765,-0.827201315069765,-0.827201315069765,-0.827201315069765,
+  -0.827201315069765,-0.827201315069765,-0.827201315069765,-0.827201315069765,
+  -0.827201315069765,-0.827201315069765,-0.687292904811685,-0.687292904811685,
+  -0.687292904811685,-0.687292904811685,-0.687292904811685,-0.687292904811685,
+  -0.687292904811685,-0.687292904811685,-0.687292904811685,-0.687292904811685,
+  -0.687292904811685,-0.687292904811685,-0.687292904811685,-0.687292904811685,
+  -0.515248636358154,-0.515248636358154,-0.515248636358154,-0.515248636358154,
+  -0.515248636358154,-0.515248636358154,-0.515248636358154,-0.515248636358154,
+  -0.515248636358154,-0.515248636358154,-0.515248636358154,-0.515248636358154,
+  -0.515248636358154,-0.515248636358154,-0.319112368927890,-0.319112368927890,
+  -0.319112368927890,-0.319112368927890,-0.319112368927890,-0.319112368927890,
+  -0.319112368927890,-0.319112368927890,-0.319112368927890,-0.319112368927890,
+  -0.319112368927890,-0.319112368927890,-0.319112368927890,-0.319112368927890,
+  -0.108054948707344,-0.108054948707344,-0.108054948707344,-0.108054948707344,
+  -0.108054948707344,-0.108054948707344,-0.108054948707344,-0.108054948707344,
+  -0.108054948707344,-0.108054948707344,-0.108054948707344,-0.108054948707344,
+  -0.108054948707344,-0.108054948707344,0.108054948707344,0.108054948707344,
+  0.108054948707344,0.108054948707344,0.108054948707344,0.108054948707344,
+  0.108054948707344,0.108054948707344,0.108054948707344,0.108054948707344,
+  0.108054948707344,0.108054948707344,0.108054948707344,0.108054948707344,
+  0.319112368927890,0.319112368927890,0.319112368927890,0.319112368927890,
+  0.319112368927890,0.319112368927890,0.319112368927890,0.319112368927890,
+  0.319112368927890,0.319112368927890,0.319112368927890,0.319112368927890,
+  0.319112368927890,0.319112368927890,0.515248636358154,0.515248636358154,
+  0.515248636358154,0.515248636358154,0.515248636358154,0.515248636358154,
+  0.515248636358154,0.515248636358154,0.515248636358154,0.515248636358154,
+  0.515248636358154,0.515248636358154,0.515248636358154,0.515248636358154,
+  0.687292904811685,0.687292904811685,0.687292904811685,0.687292904811685,
+  0.687292904811685,0.687292904811685,0.687292904811685,0.687292904811685,
+  0.687292904811685,0.687292904811685,0.687292904811685,0.687292904811685,
+  0.687292904811685,0.687292904811685,0.827201315069765,0.827201315069765,
+  0.827201315069765,0.827201315069765,0.827201315069765,0.827201315069765,
+  0.827201315069765,0.827201315069765,0.827201315069765,0.827201315069765,
+  0.827201315069765,0.827201315069765,0.827201315069765,0.827201315069765,
+  0.928434883663574,0.928434883663574,0.928434883663574,0.928434883663574,
+  0.928434883663574,0.928434883663574,0.928434883663574,0.928434883663574,
+  0.928434883663574,0.928434883663574,0.928434883663574,0.928434883663574,
+  0.928434883663574,0.928434883663574,0.986283808696812,0.986283808696812,
+  0.986283808696812,0.986283808696812,0.986283808696812,0.986283808696812,
+  0.986283808696812,0.986283808696812,0.986283808696812,0.986283808696812,
+  0.986283808696812,0.986283808696812,0.986283808696812,0.986283808696812
+};
+static const double cubature_quad_14_weights[]={
+  0.00123337649399,0.00281510876228,0.00426766662285,0.00552089039304,
+  0.00651600839024,0.0072064593068,0.00755995036256,0.00755995036256,
+  0.0072064593068,0.00651600839024,0.00552089039304,0.00426766662285,
+  0.00281510876228,0.00123337649399,0.00281510876228,0.00642531893711,
+  0.00974069618073,0.0126011051749,0.0148724030365,0.01644831634,
+  0.0172551387282,0.0172551387282,0.01644831634,0.0148724030365,
+  0.0126011051749,0.00974069618073,0.00642531893711,0.00281510876228,
+  0.00426766662285,0.00974069618073,0.014766763022,0.0191031041807,
+  0.0225463608692,0.0249354240188,0.0261585557936,0.0261585557936,
+  0.0249354240188,0.0225463608692,0.0191031041807,0.014766763022,
+  0.00974069618073,0.00426766662285,0.00552089039304,0.0126011051749,
+  0.0191031041807,0.0247128357646,0.029167223713,0.032257848393,
+  0.0338401595391,0.0338401595391,0.032257848393,0.029167223713,
+  0.0247128357646,0.0191031041807,0.0126011051749,0.00552089039304,
+  0.00651600839024,0.0148724030365,0.0225463608692,0.029167223713,
+  0.0344244969387,0.0380721941238,0.0399397104065,0.0399397104065,
+  0.0380721941238,0.0344244969387,0.029167223713,0.0225463608692,
+  0.0148724030365,0.00651600839024,0.0072064593068,0.01644831634,
+  0.0249354240188,0.032257848393,0.0380721941238,0.0421064095136,
+  0.0441718120254,0.0441718120254,0.0421064095136,0.0380721941238,
+  0.032257848393,0.0249354240188,0.01644831634,0.0072064593068,
+  0.00755995036256,0.0172551387282,0.0261585557936,0.0338401595391,
+  0.0399397104065,0.0441718120254,0.0463385266078,0.0463385266078,
+  0.0441718120254,0.0399397104065,0.0338401595391,0.0261585557936,
+  0.0172551387282,0.00755995036256,0.00755995036256,0.0172551387282,
+  0.0261585557936,0.0338401595391,0.0399397104065,0.0441718120254,
+  0.0463385266078,0.0463385266078,0.0441718120254,0.0399397104065,
+  0.0338401595391,0.0261585557936,0.0172551387282,0.00755995036256,
+  0.0072064593068,0.01644831634,0.0249354240188,0.032257848393,
+  0.0380721941238,0.0421064095136,0.0441718120254,0.0441718120254,
+  0.0421064095136,0.0380721941238,0.032257848393,0.0249354240188,
+  0.01644831634,0.0072064593068,0.00651600839024,0.0148724030365,
+  0.0225463608692,0.029167223713,0.0344244969387,0.0380721941238,
+  0.0399397104065,0.0399397104065,0.0380721941238,0.0344244969387,
+  0.029167223713,0.0225463608692,0.0148724030365,0.00651600839024,
+  0.00552089039304,0.0126011051749,0.0191031041807,0.0247128357646,
+  0.029167223713,0.032257848393,0.0338401595391,0.0338401595391,
+  0.032257848393,0.029167223713,0.0247128357646,0.0191031041807,
+  0.0126011051749,0.00552089039304,0.00426766662285,0.00974069618073,
+  0.014766763022,0.0191031041807,0.0225463608692,0.0249354240188,
+  0.0261585557936,0.0261585557936,0.0249354240188,0.0225463608692,
+  0.0191031041807,0.014766763022,0.00974069618073,0.00426766662285,
+  0.00281510876228,0.00642531893711,0.00974069618073,0.0126011051749,
+  0.0148724030365,0.01644831634,0.0172551387282,0.0172551387282,
+  0.01644831634,0.0148724030365,0.0126011051749,0.00974069618073,
+  0.00642531893711,0.00281510876228,0.00123337649399,0.00281510876228,
+  0.00426766662285,0.00552089039304,0.00651600839024,0.0072064593068,
+  0.00755995036256,0.00755995036256,0.0072064593068,0.00651600839024,
+  0.00552089039304,0.00426766662285,0.00281510876228,0.00123337649399
+};
+static const double cubature_quad_15_locs[]={
+  -0.987992518020485,-0.937273392400706,-0.848206583410427,-0.724417731360170,
+  -0.570972172608539,-0.394151347077563,-0.201194093997435,0E-15,
+  0.201194093997435,0.394151347077563,0.570972172608539,0.724417731360170,
+  0.848206583410427,0.937273392400706,0.987992518020485,-0.987992518020485,
+  -0.937273392400706,-0.848206583410427,-0.724417731360170,-0.570972172608539,
+  -0.394151347077563,-0.201194093997435,0E-15,0.201194093997435,
+  0.394151347077563,0.570972172608539,0.724417731360170,0.848206583410427,
+  0.937273392400706,0.987992518020485,-0.987992518020485,-0.937273392400706,
+  -0.848206583410427,-0.724417731360170,-0.570972172608539,-0.394151347077563,
+  -0.201194093997435,0E-15,0.201194093997435,0.394151347077563,
+  0.570972172608539,0.724417731360170,0.848206583410427,0.937273392400706,
+  0.987992518020485,-0.987992518020485,-0.937273392400706,-0.848206583410427,
+  -0.724417731360170,-0.570972172608539,-0.394151347077563,-0.201194093997435,
+  0E-15,0.201194093997435,0.394151347077563,0.570972172608539,
+  0.724417731360170,0.848206583410427,0.937273392400706,0.987992518020485,
+  -0.987992518020485,-0.937273392400706,-0.848206583410427,-0.724417731360170,
+  -0.570972172608539,-0.394151347077563,-0.201194093997435,0E-15,
+  0.201194093997435,0.394151347077563,0.570972172608539,0.724417731360170,
+  0.848206583410427,0.937273392400706,0.987992518020485,-0.987992518020485,
+  -0.937273392400706,-0.848206583410427,-0.724417731360170,-0.570972172608539,
+  -0.394151347077563,-0.201194093997435,0E-15,0.201194093997435,
+  0.394151347077563,0.570972172608539,0.724417731360170,0.848206583410427,
+  0.937273392400706,0.987992518020485,-0.987992518020485,-0.937273392400706,
+  -0.848206583410427,-0.724417731360170,-0.570972172608539,-0.394151347077563,
+  -0.201194093997435,0E-15,0.201194093997435,0.394151347077563,
+  0.570972172608539,0.724417731360170,0.848206583410427,0.937273392400706,
+  0.987992518020485,-0.987992518020485,-0.937273392400706,-0.848206583410427,
+  -0.724417731360170,-0.570972172608539,-0.394151347077563,-0.201194093997435,
+  0E-15,0.201194093997435,0.394151347077563,0.570972172608539,
+  0.724417731360170,0.848206583410427,0.937273392400706,0.987992518020485,
+  -0.987992518020485,-0.937273392400706,-0.848206583410427,-0.724417731360170,
+  -0.570972172608539,-0.394151347077563,-0.201194093997435,0E-15,
+  0.201194093997435,0.394151347077563,0.570972172608539,0.724417731360170,
+  0.848206583410427,0.937273392400706,0.987992518020485,-0.987992518020485,
+  -0.937273392400706,-0.848206583410427,-0.724417731360170,-0.570972172608539,
+  -0.394151347077563,-0.201194093997435,0E-15,0.201194093997435,
+  0.394151347077563,0.570972172608539,0.724417731360170,0.848206583410427,
+  0.937273392400706,0.987992518020485,-0.987992518020485,-0.937273392400706,
+  -0.848206583410427,-0.724417731360170,-0.570972172608539,-0.394151347077563,
+  -0.201194093997435,0E-15,0.201194093997435,0.394151347077563,
+  0.570972172608539,0.724417731360170,0.848206583410427,0.937273392400706,
+  0.987992518020485,-0.987992518020485,-0.937273392400706,-0.848206583410427,
+  -0.724417731360170,-0.570972172608539,-0.394151347077563,-0.201194093997435,
+  0E-15,0.201194093997435,0.394151347077563,0.570972172608539,
+  0.724417731360170,0.848206583410427,0.937273392400706,0.987992518020485,
+  -0.987992518020485,-0.937273392400706,-0.848206583410427,-0.724417731360170,
+  -0.570972172608539,-0.394151347077563,-0.201194093997435,0E-15,
+  0.201194093997435,0.394151347077563,0.570972172608539,0.724417731360170,
+  0.848206583410427,0.937273392400706,0.987992518020485,-0.987992518020485,
+  -0.937273392400706,-0.848206583410427,-0.724417731360170,-0.570972172608539,
+  -0.394151347077563,-0.201194093997435,0E-15,0.201194093997435,
+  0.394151347077563,0.570972172608539,0.724417731360170,0.848206583410427,
+  0.937273392400706,0.987992518020485,-0.987992518020485,-0.937273392400706,
+  -0.848206583410427,-0.724417731360170,-0.570972172608539,-0.394151347077563,
+  -0.201194093997435,0E-15,0.201194093997435,0.394151347077563,
+  0.570972172608539,0.724417731360170,0.848206583410427,0.937273392400706,
+  0.987992518020485,-0.987992518020485,-0.987992518020485,-0.987992518020485,
+  -0.987992518020485,-0.987992518020485,-0.987992518020485,-0.987992518020485,
+  -0.987992518020485,-0.987992518020485,-0.987992518020485,-0.987992518020485,
+  -0.987992518020485,-0.987992518020485,-0.987992518020485,-0.987992518020485,
+  -0.937273392400706,-0.937273392400706,-0.937273392400706,-0.937273392400706,
+  -0.937273392400706,-0.937273392400706,-0.937273392400706,-0.937273392400706,
+  -0.937273392400706,-0.937273392400706,-0.937273392400706,-0.937273392400706,
+  -0.937273392400706,-0.937273392400706,-0.937273392400706,-0.848206583410427,
+  -0.848206583410427,-0.848206583410427,-0.848206583410427,-0.848206583410427,
+  -0.848206583410427,-0.848206583410427,-0.848206583410427,-0.848206583410427,
+  -0.848206583410427,-0.848206583410427,-0.848206583410427,-0.848206583410427,
+  -0.848206583410427,-0.848206583410427,-0.724417731360170,-0.724417731360170,
+  -0.724417731360170,-0.724417731360170,-0.724417731360170,-0.724417731360170,
+  -0.724417731360170,-0.724417731360170,-0.724417731360170,-0.724417731360170,
+  -0.724417731360170,-0.724417731360170,-0.724417731360170,-0.724417731360170,
+  -0.724417731360170,-0.570972172608539,-0.570972172608539,-0.570972172608539,
+  -0.570972172608539,-0.570972172608539,-0.570972172608539,-0.570972172608539,
+  -0.570972172608539,-0.570972172608539,-0.570972172608539,-0.570972172608539,
+  -0.570972172608539,-0.570972172608539,-0.570972172608539,-0.570972172608539,
+  -0.394151347077563,-0.394151347077563,-0.394151347077563,-0.394151347077563,
+  -0.394151347077563,-0.394151347077563,-0.394151347077563,-0.394151347077563,
+  -0.394151347077563,-0.394151347077563,-0.394151347077563,-0.394151347077563,
+  -0.394151347077563,-0.394151347077563,-0.394151347077563,-0.201194093997435,
+  -0.201194093997435,-0.201194093997435,-0.201194093997435,-0.201194093997435,
+  -0.201194093997435,-0.201194093997435,-0.201194093997435,-0.201194093997435,
+  -0.201194093997435,-0.201194093997435,-0.201194093997435,-0.201194093997435,
+  -0.201194093997435,-0.201194093997435,0E-15,0E-15,
+  0E-15,0E-15,0E-15,0E-15,
+  0E-15,0E-15,0E-15,0E-15,
+  0E-15,0E-15,0E-15,0E-15,
+  0E-15,0.201194093997435,0.201194093997435,0.201194093997435,
+  0.201194093997435,0.201194093997435,0.201194093997435,0.201194093997435,
+  0.201194093997435,0.201194093997435,0.201194093997435,0.201194093997435,
+  0.201194093997435,0.201194093997435,0.201194093997435,0.201194093997435,
+  0.394151347077563,0.394151347077563,0.394151347077563,0.394151347077563,
+  0.394151347077563,0.394151347077563,0.394151347077563,0.394151347077563,
+  0.394151347077563,0.394151347077563,0.394151347077563,0.394151347077563,
+  0.394151347077563,0.394151347077563,0.394151347077563,0.570972172608539,
+  0.570972172608539,0.570972172608539,0.570972172608539,0.570972172608539,
+  0.570972172608539,0.570972172608539,0.570972172608539,0.570972172608539,
+  0.570972172608539,0.570972172608539,0.570972172608539,0.570972172608539,
+  0.570972172608539,0.570972172608539,0.724417731360170,0.724417731360170,
+  0.724417731360170,0.724417731360170,0.724417731360170,0.724417731360170,
+  0.724417731360170,0.724417731360170,0.724417731360170,0.724417731360170,
+  0.724417731360170,0.724417731360170,0.724417731360170,0.724417731360170,
+  0.724417731360170,0.848206583410427,0.848206583410427,0.848206583410427,
+  0.848206583410427,0.848206583410427,0.848206583410427,0.848206583410427,
+  0.848206583410427,0.848206583410427,0.848206583410427,0.848206583410427,
+  0.848206583410427,0.848206583410427,0.848206583410427,0.848206583410427,
+  0.937273392400706,0.937273392400706,0.937273392400706,0.937273392400706,
+  0.937273392400706,0.937273392400706,0.937273392400706,0.937273392400706,
+  0.937273392400706,0.937273392400706,0.937273392400706,0.937273392400706,
+  0.937273392400706,0.937273392400706,0.937273392400706,0.987992518020485,
+  0.987992518020485,0.987992518020485,0.987992518020485,0.987992518020485,
+  0.987992518020485,0.987992518020485,0.987992518020485,0.987992518020485,
+  0.987992518020485,0.987992518020485,0.987992518020485,0.987992518020485,
+  0.987992518020485,0.987992518020485
+};
+static const double cubature_quad_15_weights[]={
+  0.000945761893272,0.00216398408671,0.00329549343914,0.00429225083383,
+  0.00511331712299,0.00572505428372,0.00610241148791,0.00622993769708,
+  0.00610241148791,0.00572505428372,0.00511331712299,0.00429225083383,
+  0.00329549343914,0.00216398408671,0.000945761893272,0.00216398408671,
+  0.0049513806391,0.00754037079618,0.0098210369509,0.0116997068323,
+  0.0130994137675,0.0139628393197,0.0142546301914,0.0139628393197,
+  0.0130994137675,0.0116997068323,0.0098210369509,0.00754037079618,
+  0.0049513806391,0.00216398408671,0.00329549343914,0.00754037079618,
+  0.0114830985311,0.0149562850466,0.017817278483,0.0199488676431,
+  0.0212637632838,0.0217081264884,0.0212637632838,0.0199488676431,
+  0.017817278483,0.0149562850466,0.0114830985311,0.00754037079618,
+  0.00329549343914,0.00429225083383,0.0098210369509,0.0149562850466,
+  0.0194799741368,0.0232063057741,0.0259826169756,0.027695216929,
+  0.0282739825586,0.027695216929,0.0259826169756,0.0232063057741,
+  0.0194799741368,0.0149562850466,0.0098210369509,0.00429225083383,
+  0.00511331712299,0.0116997068323,0.017817278483,0.0232063057741,
+  0.027645448803,0.0309528416267,0.0329930454744,0.0336825234008,
+  0.0329930454744,0.0309528416267,0.027645448803,0.0232063057741,
+  0.017817278483,0.0116997068323,0.00511331712299,0.00572505428372,
+  0.0130994137675,0.0199488676431,0.0259826169756,0.0309528416267,
+  0.0346559179268,0.0369402037431,0.0377121680983,0.0369402037431,
+  0.0346559179268,0.0309528416267,0.0259826169756,0.0199488676431,
+  0.0130994137675,0.00572505428372,0.00610241148791,0.0139628393197,
+  0.0212637632838,0.027695216929,0.0329930454744,0.0369402037431,
+  0.0393750543691,0.0401979014402,0.0393750543691,0.0369402037431,
+  0.0329930454744,0.027695216929,0.0212637632838,0.0139628393197,
+  0.00610241148791,0.00622993769708,0.0142546301914,0.0217081264884,
+  0.0282739825586,0.0336825234008,0.0377121680983,0.0401979014402,
+  0.0410379441017,0.0401979014402,0.0377121680983,0.0336825234008,
+  0.0282739825586,0.0217081264884,0.0142546301914,0.00622993769708,
+  0.00610241148791,0.0139628393197,0.0212637632838,0.027695216929,
+  0.0329930454744,0.0369402037431,0.0393750543691,0.0401979014402,
+  0.0393750543691,0.0369402037431,0.0329930454744,0.027695216929,
+  0.0212637632838,0.0139628393197,0.00610241148791,0.00572505428372,
+  0.0130994137675,0.0199488676431,0.0259826169756,0.0309528416267,
+  0.0346559179268,0.0369402037431,0.0377121680983,0.0369402037431,
+  0.0346559179268,0.0309528416267,0.0259826169756,0.0199488676431,
+  0.0130994137675,0.00572505428372,0.00511331712299,0.0116997068323,
+  0.017817278483,0.0232063057741,0.027645448803,0.0309528416267,
+  0.0329930454744,0.0336825234008,0.0329930454744,0.0309528416267,
+  0.027645448803,0.0232063057741,0.017817278483,0.0116997068323,
+  0.00511331712299,0.00429225083383,0.0098210369509,0.0149562850466,
+  0.0194799741368,0.0232063057741,0.0259826169756,0.027695216929,
+  0.0282739825586,0.027695216929,0.0259826169756,0.0232063057741,
+  0.0194799741368,0.0149562850466,0.0098210369509,0.00429225083383,
+  0.00329549343914,0.00754037079618,0.0114830985311,0.0149562850466,
+  0.017817278483,0.0199488676431,0.0212637632838,0.0217081264884,
+  0.0212637632838,0.0199488676431,0.017817278483,0.0149562850466,
+  0.0114830985311,0.00754037079618,0.00329549343914,0.00216398408671,
+  0.0049513806391,0.00754037079618,0.0098210369509,0.0116997068323,
+  0.0130994137675,0.0139628393197,0.0142546301914,0.0139628393197,
+  0.0130994137675,0.0116997068323,0.0098210369509,0.00754037079618,
+  0.0049513806391,0.00216398408671,0.000945761893272,0.00216398408671,
+  0.00329549343914,0.00429225083383,0.00511331712299,0.00572505428372,
+  0.00610241148791,0.00622993769708,0.00610241148791,0.00572505428372,
+  0.00511331712299,0.00429225083383,0.00329549343914,0.00216398408671,
+  0.000945761893272
+};
+static const double cubature_quad_16_locs[]={
+  -0.989400934991650,-0.944575023073233,-0.865631202387832,-0.755404408355003,
+  -0.617876244402644,-0.458016777657227,-0.281603550779259,-0.095012509837637,
+  0.095012509837637,0.281603550779259,0.458016777657227,0.617876244402644,
+  0.755404408355003,0.865631202387832,0.944575023073233,0.989400934991650,
+  -0.989400934991650,-0.944575023073233,-0.865631202387832,-0.755404408355003,
+  -0.617876244402644,-0.458016777657227,-0.281603550779259,-0.095012509837637,
+  0.095012509837637,0.281603550779259,0.458016777657227,0.617876244402644,
+  0.755404408355003,0.865631202387832,0.944575023073233,0.989400934991650,
+  -0.989400934991650,-0.944575023073233,-0.865631202387832,-0.755404408355003,
+  -0.617876244402644,-0.458016777657227,-0.281603550779259,-0.095012509837637,
+  0.095012509837637,0.281603550779259,0.458016777657227,0.617876244402644,
+  0.755404408355003,0.865631202387832,0.944575023073233,0.989400934991650,
+  -0.989400934991650,-0.944575023073233,-0.865631202387832,-0.755404408355003,
+  -0.617876244402644,-0.458016777657227,-0.281603550779259,-0.095012509837637,
+  0.095012509837637,0.281603550779259,0.458016777657227,0.617876244402644,
+  0.755404408355003,0.865631202387832,0.944575023073233,0.989400934991650,
+  -0.989400934991650,-0.944575023073233,-0.865631202387832,-0.755404408355003,
+  -0.617876244402644,-0.458016777657227,-0.281603550779259,-0.095012509837637,
+  0.095012509837637,0.281603550779259,0.458016777657227,0.617876244402644,
+  0.755404408355003,0.865631202387832,0.944575023073233,0.989400934991650,
+  -0.989400934991650,-0.944575023073233,-0.865631202387832,-0.755404408355003,
+  -0.617876244402644,-0.458016777657227,-0.281603550779259,-0.095012509837637,
+  0.095012509837637,0.281603550779259,0.458016777657227,0.617876244402644,
+  0.755404408355003,0.865631202387832,0.944575023073233,0.989400934991650,
+  -0.989400934991650,-0.944575023073233,-0.865631202387832,-0.755404408355003,
+  -0.617876244402644,-0.458016777657227,-0.281603550779259,-0.095012509837637,
+  0.095012509837637,0.281603550779259,0.458016777657227,0.617876244402644,
+  0.755404408355003,0.865631202387832,0.944575023073233,0.989400934991650,
+  -0.989400934991650,-0.944575023073233,-0.865631202387832,-0.755404408355003,
+  -0.617876244402644,-0.458016777657227,-0.281603550779259,-0.095012509837637,
+  0.095012509837637,0.281603550779259,0.458016777657227,0.617876244402644,
+  0.755404408355003,0.865631202387832,0.944575023073233,0.989400934991650,
+  -0.989400934991650,-0.944575023073233,-0.865631202387832,-0.755404408355003,
+  -0.617876244402644,-0.458016777657227,-0.281603550779259,-0.095012509837637,
+  0.095012509837637,0.281603550779259,0.458016777657227,0.617876244402644,
+  0.755404408355003,0.865631202387832,0.944575023073233,0.989400934991650,
+  -0.989400934991650,-0.944575023073233,-0.865631202387832,-0.755404408355003,
+  -0.617876244402644,-0.458016777657227,-0.281603550779259,-0.095012509837637,
+  0.095012509837637,0.281603550779259,0.458016777657227,0.617876244402644,
+  0.755404408355003,0.865631202387832,0.944575023073233,0.989400934991650,
+  -0.989400934991650,-0.944575023073233,-0.865631202387832,-0.755404408355003,
+  -0.617876244402644,-0.458016777657227,-0.281603550779259,-0.095012509837637,
+  0.095012509837637,0.281603550779259,0.458016777657227,0.617876244402644,
+  0.755404408355003,0.865631202387832,0.944575023073233,0.989400934991650,
+  -0.989400934991650,-0.944575023073233,-0.865631202387832,-0.755404408355003,
+  -0.617876244402644,-0.458016777657227,-0.281603550779259,-0.095012509837637,
+  0.095012509837637,0.281603550779259,0.458016777657227,0.617876244402644,
+  0.755404408355003,0.865631202387832,0.944575023073233,0.989400934991650,
+  -0.989400934991650,-0.944575023073233,-0.865631202387832,-0.755404408355003,
+  -0.617876244402644,-0.458016777657227,-0.281603550779259,-0.095012509837637,
+  0.095012509837637,0.281603550779259,0.458016777657227,0.617876244402644,
+  0.755404408355003,0.865631202387832,0.944575023073233,0.989400934991650,
+  -0.989400934991650,-0.944575023073233,-0.865631202387832,-0.755404408355003,
+  -0.617876244402644,-0.458016777657227,-0.281603550779259,-0.095012509837637,
+  0.095012509837637,0.281603550779259,0.458016777657227,0.617876244402644,
+  0.755404408355003,0.865631202387832,0.944575023073233,0.989400934991650,
+  -0.989400934991650,-0.944575023073233,-0.865631202387832,-0.755404408355003,
+  -0.617876244402644,-0.458016777657227,-0.281603550779259,-0.095012509837637,
+  0.095012509837637,0.281603550779259,0.458016777657227,0.617876244402644,
+  0.755404408355003,0.865631202387832,0.944575023073233,0.989400934991650,
+  -0.989400934991650,-0.944575023073233,-0.865631202387832,-0.755404408355003,
+  -0.617876244402644,-0.458016777657227,-0.281603550779259,-0.095012509837637,
+  0.095012509837637,0.281603550779259,0.458016777657227,0.617876244402644,
+  0.755404408355003,0.865631202387832,0.944575023073233,0.989400934991650,
+  -0.989400934991650,-0.989400934991650,-0.989400934991650,-0.989400934991650,
+  -0.989400934991650,-0.989400934991650,-0.989400934991650,-0.989400934991650,
+  -0.989400934991650,-0.989400934991650,-0.989400934991650,-0.989400934991650,
+  -0.989400934991650,-0.989400934991650,-0.989400934991650,-0.989400934991650,
+  -0.944575023073233,-0.944575023073233,-0.944575023073233,-0.944575023073233,
+  -0.944575023073233,-0.944575023073233,-0.944575023073233,-0.944575023073233,
+  -0.944575023073233,-0.944575023073233,-0.944575023073233,-0.944575023073233,
+  -0.944575023073233,-0.944575023073233,-0.944575023073233,-0.944575023073233,
+  -0.865631202387832,-0.865631202387832,-0.865631202387832,-0.865631202387832,
+  -0.865631202387832,-0.865631202387832,-0.865631202387832,-0.865631202387832,
+  -0.865631202387832,-0.865631202387832,-0.865631202387832,-0.865631202387832,
+  -0.865631202387832,-0.865631202387832,-0.865631202387832,-0.865631202387832,
+  -0.755404408355003,-0.755404408355003,-0.755404408355003,-0.755404408355003,
+  -0.755404408355003,-0.755404408355003,-0.755404408355003,-0.755404408355003,
+  -0.755404408355003,-0.755404408355003,-0.755404408355003,-0.755404408355003,
+  -0.755404408355003,-0.755404408355003,-0.755404408355003,-0.755404408355003,
+  -0.617876244402644,-0.617876244402644,-0.617876244402644,-0.617876244402644,
+  -0.617876244402644,-0.617876244402644,-0.617876244402644,-0.617876244402644,
+  -0.617876244402644,-0.617876244402644,-0.617876244402644,-0.617876244402644,
+  -0.617876244402644,-0.617876244402644,-0.617876244402644,-0.617876244402644,
+  -0.458016777657227,-0.458016777657227,-0.458016777657227,-0.458016777657227,
+  -0.458016777657227,-0.458016777657227,-0.458016777657227,-0.458016777657227,
+  -0.458016777657227,-0.458016777657227,-0.458016777657227,-0.458016777657227,
+  -0.458016777657227,-0.458016777657227,-0.458016777657227,-0.458016777657227,
+  -0.281603550779259,-0.281603550779259,-0.281603550779259,-0.281603550779259,
+  -0.281603550779259,-0.281603550779259,-0.281603550779259,-0.281603550779259,
+  -0.281603550779259,-0.281603550779259,-0.281603550779259,-0.281603550779259,
+  -0.281603550779259,-0.281603550779259,-0.281603550779259,-0.281603550779259,
+  -0.095012509837637,-0.095012509837637,-0.095012509837637,-0.095012509837637,
+  -0.095012509837637,-0.095012509837637,-0.095012509837637,-0.095012509837637,
+  -0.095012509837637,-0.095012509837637,-0.095012509837637,-0.095012509837637,
+  -0.095012509837637,-0.095012509837637,-0.095012509837637,-0.095012509837637,
+  0.095012509837637,0.095012509837637,0.095012509837637,0.095012509837637,
+  0.095012509837637,0.095012509837637,0.095012509837637,0.095012509837637,
+  0.095012509837637,0.095012509837637,0.095012509837637,0.095012509837637,
+  0.095012509837637,0.095012509837637,0.095012509837637,0.095012509837637,
+  0.281603550779259,0.281603550779259,0.281603550779259,0.281603550779259,
+  0.281603550779259,0.281603550779259,0.281603550779259,0.281603550779259,
+  0.281603550779259,0.281603550779259,0.281603550779259,0.281603550779259,
+  0.281603550779259,0.281603550779259,0.281603550779259,0.281603550779259,
+  0.458016777657227,0.458016777657227,0.458016777657227,0.458016777657227,
+  0.458016777657227,0.458016777657227,0.458016777657227,0.458016777657227,
+  0.458016777657227,0.458016777657227,0.458016777657227,0.458016777657227,
+  0.458016777657227,0.458016777657227,0.458016777657227,0.458016777657227,
+  0.617876244402644,0.617876244402644,0.617876244402644,0.617876244402644,
+  0.617876244402644,0.617876244402644,0.617876244402644,0.617876244402644,
+  0.617876244402644,0.617876244402644,0.617876244402644,0.617876244402644,
+  0.617876244402644,0.617876244402644,0.617876244402644,0.617876244402644,
+  0.755404408355003,0.755404408355003,0.755404408355003,0.755404408355003,
+  0.755404408355003,0.755404408355003,0.755404408355003,0.755404408355003,
+  0.755404408355003,0.755404408355003,0.755404408355003,0.755404408355003,
+  0.755404408355003,0.755404408355003,0.755404408355003,0.755404408355003,
+  0.865631202387832,0.865631202387832,0.865631202387832,0.865631202387832,
+  0.865631202387832,0.865631202387832,0.865631202387832,0.865631202387832,
+  0.865631202387832,0.865631202387832,0.865631202387832,0.865631202387832,
+  0.865631202387832,0.865631202387832,0.865631202387832,0.865631202387832,
+  0.944575023073233,0.944575023073233,0.944575023073233,0.944575023073233,
+  0.944575023073233,0.944575023073233,0.944575023073233,0.944575023073233,
+  0.944575023073233,0.944575023073233,0.944575023073233,0.944575023073233,
+  0.944575023073233,0.944575023073233,0.944575023073233,0.944575023073233,
+  0.989400934991650,0.989400934991650,0.989400934991650,0.989400934991650,
+  0.989400934991650,0.989400934991650,0.989400934991650,0.989400934991650,
+  0.989400934991650,0.989400934991650,0.989400934991650,0.989400934991650,
+  0.989400934991650,0.989400934991650,0.989400934991650,0.989400934991650
+};
+static const double cubature_quad_16_weights[]={
+  0.000737256052107,0.00169033628198,0.00258378762614,0.00338398308355,
+  0.0040618990145,0.00459301552711,0.00495813181545,0.00514405001091,
+  0.00514405001091,0.00495813181545,0.00459301552711,0.0040618990145,
+  0.00338398308355,0.00258378762614,0.00169033628198,0.000737256052107,
+  0.00169033628198,0.00387550124278,0.00592395268499,0.00775859264551,
+  0.00931287747092,0.0105305894295,0.0113677060698,0.0117939681132,
+  0.0117939681132,0.0113677060698,0.0105305894295,0.00931287747092,
+  0.00775859264551,0.00592395268499,0.00387550124278,0.00169033628198,
+  0.00258378762614,0.00592395268499,0.00905514234563,0.0118595074172,
+  0.0142353316495,0.016096682627,0.0173762692038,0.0180278381282,
+  0.0180278381282,0.0173762692038,0.016096682627,0.0142353316495,
+  0.0118595074172,0.00905514234563,0.00592395268499,0.00258378762614,
+  0.00338398308355,0.00775859264551,0.0118595074172,0.0155323804762,
+  0.0186439941902,0.0210818029934,0.0227576757648,0.0236110346847,
+  0.0236110346847,0.0227576757648,0.0210818029934,0.0186439941902,
+  0.0155323804762,0.0118595074172,0.00775859264551,0.00338398308355,
+  0.0040618990145,0.00931287747092,0.0142353316495,0.0186439941902,
+  0.02237895987,0.0253051367837,0.0273167384349,0.0283410514029,
+  0.0283410514029,0.0273167384349,0.0253051367837,0.02237895987,
+  0.0186439941902,0.0142353316495,0.00931287747092,0.0040618990145,
+  0.00459301552711,0.0105305894295,0.016096682627,0.0210818029934,
+  0.0253051367837,0.0286139280538,0.0308885581186,0.0320468058618,
+  0.0320468058618,0.0308885581186,0.0286139280538,0.0253051367837,
+  0.0210818029934,0.016096682627,0.0105305894295,0.00459301552711,
+  0.00495813181545,0.0113677060698,0.0173762692038,0.0227576757648,
+  0.0273167384349,0.0308885581186,0.0333440071861,0.0345943284514,
+  0.0345943284514,0.0333440071861,0.0308885581186,0.0273167384349,
+  0.0227576757648,0.0173762692038,0.0113677060698,0.00495813181545,
+  0.00514405001091,0.0117939681132,0.0180278381282,0.0236110346847,
+  0.0283410514029,0.0320468058618,0.0345943284514,0.0358915338018,
+  0.0358915338018,0.0345943284514,0.0320468058618,0.0283410514029,
+  0.0236110346847,0.0180278381282,0.0117939681132,0.00514405001091,
+  0.00514405001091,0.0117939681132,0.0180278381282,0.0236110346847,
+  0.0283410514029,0.0320468058618,0.0345943284514,0.0358915338018,
+  0.0358915338018,0.0345943284514,0.0320468058618,0.0283410514029,
+  0.0236110346847,0.0180278381282,0.0117939681132,0.00514405001091,
+  0.00495813181545,0.0113677060698,0.0173762692038,0.0227576757648,
+  0.0273167384349,0.0308885581186,0.0333440071861,0.0345943284514,
+  0.0345943284514,0.0333440071861,0.0308885581186,0.0273167384349,
+  0.0227576757648,0.0173762692038,0.0113677060698,0.00495813181545,
+  0.00459301552711,0.0105305894295,0.016096682627,0.0210818029934,
+  0.0253051367837,0.0286139280538,0.0308885581186,0.0320468058618,
+  0.0320468058618,0.0308885581186,0.0286139280538,0.0253051367837,
+  0.0210818029934,0.016096682627,0.0105305894295,0.00459301552711,
+  0.0040618990145,0.00931287747092,0.0142353316495,0.0186439941902,
+  0.02237895987,0.0253051367837,0.0273167384349,0.0283410514029,
+  0.0283410514029,0.0273167384349,0.0253051367837,0.02237895987,
+  0.0186439941902,0.0142353316495,0.00931287747092,0.0040618990145,
+  0.00338398308355,0.00775859264551,0.0118595074172,0.0155323804762,
+  0.0186439941902,0.0210818029934,0.0227576757648,0.0236110346847,
+  0.0236110346847,0.0227576757648,0.0210818029934,0.0186439941902,
+  0.0155323804762,0.0118595074172,0.00775859264551,0.00338398308355,
+  0.00258378762614,0.00592395268499,0.00905514234563,0.0118595074172,
+  0.0142353316495,0.016096682627,0.0173762692038,0.0180278381282,
+  0.0180278381282,0.0173762692038,0.016096682627,0.0142353316495,
+  0.0118595074172,0.00905514234563,0.00592395268499,0.00258378762614,
+  0.00169033628198,0.00387550124278,0.00592395268499,0.00775859264551,
+  0.00931287747092,0.0105305894295,0.0113677060698,0.0117939681132,
+  0.0117939681132,0.0113677060698,0.0105305894295,0.00931287747092,
+  0.00775859264551,0.00592395268499,0.00387550124278,0.00169033628198,
+  0.000737256052107,0.00169033628198,0.00258378762614,0.00338398308355,
+  0.0040618990145,0.00459301552711,0.00495813181545,0.00514405001091,
+  0.00514405001091,0.00495813181545,0.00459301552711,0.0040618990145,
+  0.00338398308355,0.00258378762614,0.00169033628198,0.000737256052107
+};
+static const double cubature_quad_17_locs[]={
+  -0.990575475314417,-0.950675521768768,-0.880239153726986,-0.781514003896801,
+  -0.657671159216691,-0.512690537086477,-0.351231763453876,-0.178484181495848,
+  0E-15,0.178484181495848,0.351231763453876,0.512690537086477,
+  0.657671159216691,0.781514003896801,0.880239153726986,0.950675521768768,
+  0.990575475314417,-0.990575475314417,-0.950675521768768,-0.880239153726986,
+  -0.781514003896801,-0.657671159216691,-0.512690537086477,-0.351231763453876,
+  -0.178484181495848,0E-15,0.178484181495848,0.351231763453876,
+  0.512690537086477,0.657671159216691,0.781514003896801,0.880239153726986,
+  0.950675521768768,0.990575475314417,-0.990575475314417,-0.950675521768768,
+  -0.880239153726986,-0.781514003896801,-0.657671159216691,-0.512690537086477,
+  -0.351231763453876,-0.178484181495848,0E-15,0.178484181495848,
+  0.351231763453876,0.512690537086477,0.657671159216691,0.781514003896801,
+  0.880239153726986,0.950675521768768,0.990575475314417,-0.990575475314417,
+  -0.950675521768768,-0.880239153726986,-0.781514003896801,-0.657671159216691,
+  -0.512690537086477,-0.351231763453876,-0.178484181495848,0E-15,
+  0.178484181495848,0.351231763453876,0.512690537086477,0.657671159216691,
+  0.781514003896801,0.880239153726986,0.950675521768768,0.990575475314417,
+  -0.990575475314417,-0.950675521768768,-0.880239153726986,-0.781514003896801,
+  -0.657671159216691,-0.512690537086477,-0.351231763453876,-0.178484181495848,
+  0E-15,0.178484181495848,0.351231763453876,0.512690537086477,
+  0.657671159216691,0.781514003896801,0.880239153726986,0.950675521768768,
+  0.990575475314417,-0.990575475314417,-0.950675521768768,-0.880239153726986,
+  -0.781514003896801,-0.657671159216691,-0.512690537086477,-0.351231763453876,
+  -0.178484181495848,0E-15,0.178484181495848,0.351231763453876,
+  0.512690537086477,0.657671159216691,0.781514003896801,0.880239153726986,
+  0.950675521768768,0.990575475314417,-0.990575475314417,-0.950675521768768,
+  -0.880239153726986,-0.781514003896801,-0.657671159216691,-0.512690537086477,
+  -0.351231763453876,-0.178484181495848,0E-15,0.178484181495848,
+  0.351231763453876,0.512690537086477,0.657671159216691,0.781514003896801,
+  0.880239153726986,0.950675521768768,0.990575475314417,-0.990575475314417,
+  -0.950675521768768,-0.880239153726986,-0.781514003896801,-0.657671159216691,
+  -0.512690537086477,-0.351231763453876,-0.178484181495848,0E-15,
+  0.178484181495848,0.351231763453876,0.512690537086477,0.657671159216691,
+  0.781514003896801,0.880239153726986,0.950675521768768,0.990575475314417,
+  -0.990575475314417,-0.950675521768768,-0.880239153726986,-0.781514003896801,
+  -0.657671159216691,-0.512690537086477,-0.351231763453876,-0.178484181495848,
+  0E-15,0.178484181495848,0.351231763453876,0.512690537086477,
+  0.657671159216691,0.781514003896801,0.880239153726986,0.950675521768768,
+  0.990575475314417,-0.990575475314417,-0.950675521768768,-0.880239153726986,
+  -0.781514003896801,-0.657671159216691,-0.512690537086477,-0.351231763453876,
+  -0.178484181495848,0E-15,0.178484181495848,0.351231763453876,
+  0.512690537086477,0.657671159216691,0.781514003896801,0.880239153726986,
+  0.950675521768768,0.990575475314417,-0.990575475314417,-0.950675521768768,
+  -0.880239153726986,-0.781514003896801,-0.657671159216691,-0.512690537086477,
+  -0.351231763453876,-0.178484181495848,0E-15,0.178484181495848,
+  0.351231763453876,0.512690537086477,0.657671159216691,0.781514003896801,
+  0.880239153726986,0.950675521768768,0.990575475314417,-0.990575475314417,
+  -0.950675521768768,-0.880239153726986,-0.781514003896801,-0.657671159216691,
+  -0.512690537086477,-0.351231763453876,-0.178484181495848,0E-15,
+  0.178484181495848,0.351231763453876,0.512690537086477,0.657671159216691,
+  0.781514003896801,0.880239153726986,0.950675521768768,0.990575475314417,
+  -0.990575475314417,-0.950675521768768,-0.880239153726986,-0.781514003896801,
+  -0.657671159216691,-0.512690537086477,-0.351231763453876,-0.178484181495848,
+  0E-15,0.178484181495848,0.351231763453876,0.512690537086477,
+  0.657671159216691,0.781514003896801,0.880239153726986,0.950675521768768,
+  0.990575475314417,-0.990575475314417,-0.950675521768768,-0.880239153726986,
+  -0.781514003896801,-0.657671159216691,-0.512690537086477,-0.351231763453876,
+  -0.178484181495848,0E-15,0.178484181495848,0.351231763453876,
+  0.512690537086477,0.657671159216691,0.781514003896801,0.880239153726986,
+  0.950675521768768,0.990575475314417,-0.990575475314417,-0.950675521768768,
+  -0.880239153726986,-0.781514003896801,-0.657671159216691,-0.512690537086477,
+  -0.351231763453876,-0.178484181495848,0E-15,0.178484181495848,
+  0.351231763453876,0.512690537086477,0.657671159216691,0.781514003896801,
+  0.880239153726986,0.950675521768768,0.990575475314417,-0.990575475314417,
+  -0.950675521768768,-0.880239153726986,-0.781514003896801,-0.657671159216691,
+  -0.512690537086477,-0.351231763453876,-0.178484181495848,0E-15,
+  0.178484181495848,0.351231763453876,0.512690537086477,0.657671159216691,
+  0.781514003896801,0.880239153726986,0.950675521768768,0.990575475314417,
+  -0.990575475314417,-0.950675521768768,-0.880239153726986,-0.781514003896801,
+  -0.657671159216691,-0.512690537086477,-0.351231763453876,-0.178484181495848,
+  0E-15,0.178484181495848,0.351231763453876,0.512690537086477,
+  0.657671159216691,0.781514003896801,0.880239153726986,0.950675521768768,
+  0.990575475314417,-0.990575475314417,-0.990575475314417,-0.990575475314417,
+  -0.990575475314417,-0.990575475314417,-0.990575475314417,-0.990575475314417,
+  -0.990575475314417,-0.990575475314417,-0.990575475314417,-0.990575475314417,
+  -0.990575475314417,-0.990575475314417,-0.990575475314417,-0.990575475314417,
+  -0.990575475314417,-0.990575475314417,-0.950675521768768,-0.950675521768768,
+  -0.950675521768768,-0.950675521768768,-0.950675521768768,-0.950675521768768,
+  -0.950675521768768,-0.950675521768768,-0.950675521768768,-0.950675521768768,
+  -0.950675521768768,-0.950675521768768,-0.950675521768768,-0.950675521768768,
+  -0.950675521768768,-0.950675521768768,-0.950675521768768,-0.880239153726986,
+  -0.880239153726986,-0.880239153726986,-0.880239153726986,-0.880239153726986,
+  -0.880239153726986,-0.880239153726986,-0.880239153726986,-0.880239153726986,
+  -0.880239153726986,-0.880239153726986,-0.880239153726986,-0.880239153726986,
+  -0.880239153726986,-0.880239153726986,-0.880239153726986,-0.880239153726986,
+  -0.781514003896801,-0.781514003896801,-0.781514003896801,-0.781514003896801,
+  -0.781514003896801,-0.781514003896801,-0.781514003896801,-0.781514003896801,
+  -0.781514003896801,-0.781514003896801,-0.781514003896801,-0.781514003896801,
+  -0.781514003896801,-0.781514003896801,-0.781514003896801,-0.781514003896801,
+  -0.781514003896801,-0.657671159216691,-0.657671159216691,-0.657671159216691,
+  -0.657671159216691,-0.657671159216691,-0.657671159216691,-0.657671159216691,
+  -0.657671159216691,-0.657671159216691,-0.657671159216691,-0.657671159216691,
+  -0.657671159216691,-0.657671159216691,-0.657671159216691,-0.657671159216691,
+  -0.657671159216691,-0.657671159216691,-0.512690537086477,-0.512690537086477,
+  -0.512690537086477,-0.512690537086477,-0.512690537086477,-0.512690537086477,
+  -0.512690537086477,-0.512690537086477,-0.512690537086477,-0.512690537086477,
+  -0.512690537086477,-0.512690537086477,-0.512690537086477,-0.512690537086477,
+  -0.512690537086477,-0.512690537086477,-0.512690537086477,-0.351231763453876,
+  -0.351231763453876,-0.351231763453876,-0.351231763453876,-0.351231763453876,
+  -0.351231763453876,-0.351231763453876,-0.351231763453876,-0.351231763453876,
+  -0.351231763453876,-0.351231763453876,-0.351231763453876,-0.351231763453876,
+  -0.351231763453876,-0.351231763453876,-0.351231763453876,-0.351231763453876,
+  -0.178484181495848,-0.178484181495848,-0.178484181495848,-0.178484181495848,
+  -0.178484181495848,-0.178484181495848,-0.178484181495848,-0.178484181495848,
+  -0.178484181495848,-0.178484181495848,-0.178484181495848,-0.178484181495848,
+  -0.178484181495848,-0.178484181495848,-0.178484181495848,-0.178484181495848,
+  -0.178484181495848,0E-15,0E-15,0E-15,
+  0E-15,0E-15,0E-15,0E-15,
+  0E-15,0E-15,0E-15,0E-15,
+  0E-15,0E-15,0E-15,0E-15,
+  0E-15,0E-15,0.178484181495848,0.178484181495848,
+  0.178484181495848,0.178484181495848,0.178484181495848,0.178484181495848,
+  0.178484181495848,0.178484181495848,0.178484181495848,0.178484181495848,
+  0.178484181495848,0.178484181495848,0.178484181495848,0.178484181495848,
+  0.178484181495848,0.178484181495848,0.178484181495848,0.351231763453876,
+  0.351231763453876,0.351231763453876,0.351231763453876,0.351231763453876,
+  0.351231763453876,0.351231763453876,0.351231763453876,0.351231763453876,
+  0.351231763453876,0.351231763453876,0.351231763453876,0.351231763453876,
+  0.351231763453876,0.351231763453876,0.351231763453876,0.351231763453876,
+  0.512690537086477,0.512690537086477,0.512690537086477,0.512690537086477,
+  0.512690537086477,0.512690537086477,0.512690537086477,0.512690537086477,
+  0.512690537086477,0.512690537086477,0.512690537086477,0.512690537086477,
+  0.512690537086477,0.512690537086477,0.512690537086477,0.512690537086477,
+  0.512690537086477,0.657671159216691,0.657671159216691,0.657671159216691,
+  0.657671159216691,0.657671159216691,0.657671159216691,0.657671159216691,
+  0.657671159216691,0.657671159216691,0.657671159216691,0.657671159216691,
+  0.657671159216691,0.657671159216691,0.657671159216691,0.657671159216691,
+  0.657671159216691,0.657671159216691,0.781514003896801,0.781514003896801,
+  0.781514003896801,0.781514003896801,0.781514003896801,0.781514003896801,
+  0.781514003896801,0.781514003896801,0.781514003896801,0.781514003896801,
+  0.781514003896801,0.781514003896801,0.781514003896801,0.781514003896801,
+  0.781514003896801,0.781514003896801,0.781514003896801,0.880239153726986,
+  0.880239153726986,0.880239153726986,0.880239153726986,0.880239153726986,
+  0.880239153726986,0.880239153726986,0.880239153726986,0.880239153726986,
+  0.880239153726986,0.880239153726986,0.880239153726986,0.880239153726986,
+  0.880239153726986,0.880239153726986,0.880239153726986,0.880239153726986,
+  0.950675521768768,0.950675521768768,0.950675521768768,0.950675521768768,
+  0.950675521768768,0.950675521768768,0.950675521768768,0.950675521768768,
+  0.950675521768768,0.950675521768768,0.950675521768768,0.950675521768768,
+  0.950675521768768,0.950675521768768,0.950675521768768,0.950675521768768,
+  0.950675521768768,0.990575475314417,0.990575475314417,0.990575475314417,
+  0.990575475314417,0.990575475314417,0.990575475314417,0.990575475314417,
+  0.990575475314417,0.990575475314417,0.990575475314417,0.990575475314417,
+  0.990575475314417,0.990575475314417,0.990575475314417,0.990575475314417,
+  0.990575475314417,0.990575475314417
+};
+static const double cubature_quad_17_weights[]={
+  0.000583140531431,0.00133925351227,0.00205347866434,0.00270180502812,
+  0.00326331395433,0.0037199436941,0.00405701394203,0.00426368968449,
+  0.00433332771485,0.00426368968449,0.00405701394203,0.0037199436941,
+  0.00326331395433,0.00270180502812,0.00205347866434,0.00133925351227,
+  0.000583140531431,0.00133925351227,0.00307575939838,0.00471606476545,
+  0.0062050255099,0.00749459939657,0.00854330541138,0.0093174284385,
+  0.00979208454465,0.00995201679378,0.00979208454465,0.0093174284385,
+  0.00854330541138,0.00749459939657,0.0062050255099,0.00471606476545,
+  0.00307575939838,0.00133925351227,0.00205347866434,0.00471606476545,
+  0.00723114652062,0.00951417142423,0.0114914762721,0.0130994581866,
+  0.0142864217489,0.0150142124009,0.0152594366682,0.0150142124009,
+  0.0142864217489,0.0130994581866,0.0114914762721,0.00951417142423,
+  0.00723114652062,0.00471606476545,0.00205347866434,0.00270180502812,
+  0.0062050255099,0.00951417142423,0.0125179952628,0.0151195768,
+  0.0172352323931,0.0187969452935,0.0197545147473,0.0200771614687,
+  0.0197545147473,0.0187969452935,0.0172352323931,0.0151195768,
+  0.0125179952628,0.00951417142423,0.0062050255099,0.00270180502812,
+  0.00326331395433,0.00749459939657,0.0114914762721,0.0151195768,
+  0.0182618380829,0.0208171847299,0.0227034642532,0.0238600428103,
+  0.0242497443384,0.0238600428103,0.0227034642532,0.0208171847299,
+  0.0182618380829,0.0151195768,0.0114914762721,0.00749459939657,
+  0.00326331395433,0.0037199436941,0.00854330541138,0.0130994581866,
+  0.0172352323931,0.0208171847299,0.0237300965057,0.0258803197807,
+  0.027198736326,0.0276429680986,0.027198736326,0.0258803197807,
+  0.0237300965057,0.0208171847299,0.0172352323931,0.0130994581866,
+  0.00854330541138,0.0037199436941,0.00405701394203,0.0093174284385,
+  0.0142864217489,0.0187969452935,0.0227034642532,0.0258803197807,
+  0.0282253783414,0.0296632587895,0.0301477431373,0.0296632587895,
+  0.0282253783414,0.0258803197807,0.0227034642532,0.0187969452935,
+  0.0142864217489,0.0093174284385,0.00405701394203,0.00426368968449,
+  0.00979208454465,0.0150142124009,0.0197545147473,0.0238600428103,
+  0.027198736326,0.0296632587895,0.0311743889265,0.0316835542746,
+  0.0311743889265,0.0296632587895,0.027198736326,0.0238600428103,
+  0.0197545147473,0.0150142124009,0.00979208454465,0.00426368968449,
+  0.00433332771485,0.00995201679378,0.0152594366682,0.0200771614687,
+  0.0242497443384,0.0276429680986,0.0301477431373,0.0316835542746,
+  0.0322010357233,0.0316835542746,0.0301477431373,0.0276429680986,
+  0.0242497443384,0.0200771614687,0.0152594366682,0.00995201679378,
+  0.00433332771485,0.00426368968449,0.00979208454465,0.0150142124009,
+  0.0197545147473,0.0238600428103,0.027198736326,0.0296632587895,
+  0.0311743889265,0.0316835542746,0.0311743889265,0.0296632587895,
+  0.027198736326,0.0238600428103,0.0197545147473,0.0150142124009,
+  0.00979208454465,0.00426368968449,0.00405701394203,0.0093174284385,
+  0.0142864217489,0.0187969452935,0.0227034642532,0.0258803197807,
+  0.0282253783414,0.0296632587895,0.0301477431373,0.0296632587895,
+  0.0282253783414,0.0258803197807,0.0227034642532,0.0187969452935,
+  0.0142864217489,0.0093174284385,0.00405701394203,0.0037199436941,
+  0.00854330541138,0.0130994581866,0.0172352323931,0.0208171847299,
+  0.0237300965057,0.0258803197807,0.027198736326,0.0276429680986,
+  0.027198736326,0.0258803197807,0.0237300965057,0.0208171847299,
+  0.0172352323931,0.0130994581866,0.00854330541138,0.0037199436941,
+  0.00326331395433,0.00749459939657,0.0114914762721,0.0151195768,
+  0.0182618380829,0.0208171847299,0.0227034642532,0.0238600428103,
+  0.0242497443384,0.0238600428103,0.0227034642532,0.0208171847299,
+  0.0182618380829,0.0151195768,0.0114914762721,0.00749459939657,
+  0.00326331395433,0.00270180502812,0.0062050255099,0.00951417142423,
+  0.0125179952628,0.0151195768,0.0172352323931,0.0187969452935,
+  0.0197545147473,0.0200771614687,0.0197545147473,0.0187969452935,
+  0.0172352323931,0.0151195768,0.0125179952628,0.00951417142423,
+  0.0062050255099,0.00270180502812,0.00205347866434,0.00471606476545,
+  0.00723114652062,0.00951417142423,0.0114914762721,0.0130994581866,
+  0.0142864217489,0.0150142124009,0.0152594366682,0.0150142124009,
+  0.0142864217489,0.0130994581866,0.0114914762721,0.00951417142423,
+  0.00723114652062,0.00471606476545,0.00205347866434,0.00133925351227,
+  0.00307575939838,0.00471606476545,0.0062050255099,0.00749459939657,
+  0.00854330541138,0.0093174284385,0.00979208454465,0.00995201679378,
+  0.00979208454465,0.0093174284385,0.00854330541138,0.00749459939657,
+  0.0062050255099,0.00471606476545,0.00307575939838,0.00133925351227,
+  0.000583140531431,0.00133925351227,0.00205347866434,0.00270180502812,
+  0.00326331395433,0.0037199436941,0.00405701394203,0.00426368968449,
+  0.00433332771485,0.00426368968449,0.00405701394203,0.0037199436941,
+  0.00326331395433,0.00270180502812,0.00205347866434,0.00133925351227,
+  0.000583140531431
+};
+static const double cubature_quad_18_locs[]={
+  -0.991565168420931,-0.955823949571398,-0.892602466497556,-0.803704958972523,
+  -0.691687043060353,-0.559770831073948,-0.411751161462843,-0.251886225691506,
+  -0.084775013041735,0.084775013041735,0.251886225691506,0.411751161462843,
+  0.559770831073948,0.691687043060353,0.803704958972523,0.892602466497556,
+  0.955823949571398,0.991565168420931,-0.991565168420931,-0.955823949571398,
+  -0.892602466497556,-0.803704958972523,-0.691687043060353,-0.559770831073948,
+  -0.411751161462843,-0.251886225691506,-0.084775013041735,0.084775013041735,
+  0.251886225691506,0.411751161462843,0.559770831073948,0.691687043060353,
+  0.803704958972523,0.892602466497556,0.955823949571398,0.991565168420931,
+  -0.991565168420931,-0.955823949571398,-0.892602466497556,-0.803704958972523,
+  -0.691687043060353,-0.559770831073948,-0.411751161462843,-0.251886225691506,
+  -0.084775013041735,0.084775013041735,0.251886225691506,0.411751161462843,
+  0.559770831073948,0.691687043060353,0.803704958972523,0.892602466497556,
+  0.955823949571398,0.991565168420931,-0.991565168420931,-0.955823949571398,
+  -0.892602466497556,-0.803704958972523,-0.691687043060353,-0.559770831073948,
+  -0.411751161462843,-0.251886225691506,-0.084775013041735,0.084775013041735,
+  0.251886225691506,0.411751161462843,0.559770831073948,0.691687043060353,
+  0.803704958972523,0.892602466497556,0.955823949571398,0.991565168420931,
+  -0.991565168420931,-0.955823949571398,-0.892602466497556,-0.803704958972523,
+  -0.691687043060353,-0.559770831073948,-0.411751161462843,-0.251886225691506,
+  -0.084775013041735,0.084775013041735,0.251886225691506,0.411751161462843,
+  0.559770831073948,0.691687043060353,0.803704958972523,0.892602466497556,
+  0.955823949571398,0.991565168420931,-0.991565168420931,-0.955823949571398,
+  -0.892602466497556,-0.803704958972523,-0.691687043060353,-0.559770831073948,
+  -0.411751161462843,-0.251886225691506,-0.084775013041735,0.084775013041735,
+  0.251886225691506,0.411751161462843,0.559770831073948,0.691687043060353,
+  0.803704958972523,0.892602466497556,0.955823949571398,0.991565168420931,
+  -0.991565168420931,-0.955823949571398,-0.892602466497556,-0.803704958972523,
+  -0.691687043060353,-0.559770831073948,-0.411751161462843,-0.251886225691506,
+  -0.084775013041735,0.084775013041735,0.251886225691506,0.411751161462843,
+  0.559770831073948,0.691687043060353,0.803704958972523,0.892602466497556,
+  0.955823949571398,0.991565168420931,-0.991565168420931,-0.955823949571398,
+  -0.892602466497556,-0.803704958972523,-0.691687043060353,-0.559770831073948,
+  -0.411751161462843,-0.251886225691506,-0.084775013041735,0.084775013041735,
+  0.251886225691506,0.411751161462843,0.559770831073948,0.691687043060353,
+  0.803704958972523,0.892602466497556,0.955823949571398,0.991565168420931,
+  -0.991565168420931,-0.955823949571398,-0.892602466497556,-0.803704958972523,
+  -0.691687043060353,-0.559770831073948,-0.411751161462843,-0.251886225691506,
+  -0.084775013041735,0.084775013041735,0.251886225691506,0.411751161462843,
+  0.559770831073948,0.691687043060353,0.803704958972523,0.892602466497556,
+  0.955823949571398,0.991565168420931,-0.991565168420931,-0.955823949571398,
+  -0.892602466497556,-0.803704958972523,-0.691687043060353,-0.559770831073948,
+  -0.411751161462843,-0.251886225691506,-0.084775013041735,0.084775013041735,
+  0.251886225691506,0.411751161462843,0.559770831073948,0.691687043060353,
+  0.803704958972523,0.892602466497556,0.955823949571398,0.991565168420931,
+  -0.991565168420931,-0.955823949571398,-0.892602466497556,-0.803704958972523,
+  -0.691687043060353,-0.559770831073948,-0.411751161462843,-0.251886225691506,
+  -0.084775013041735,0.084775013041735,0.251886225691506,0.411751161462843,
+  0.559770831073948,0.691687043060353,0.803704958972523,0.892602466497556,
+  0.955823949571398,0.991565168420931,-0.991565168420931,-0.955823949571398,
+  -0.892602466497556,-0.803704958972523,-0.691687043060353,-0.559770831073948,
+  -0.411751161462843,-0.251886225691506,-0.084775013041735,0.084775013041735,
+  0.251886225691506,0.411751161462843,0.559770831073948,0.691687043060353,
+  0.803704958972523,0.892602466497556,0.955823949571398,0.991565168420931,
+  -0.991565168420931,-0.955823949571398,-0.892602466497556,-0.803704958972523,
+  -0.691687043060353,-0.559770831073948,-0.411751161462843,-0.251886225691506,
+  -0.084775013041735,0.084775013041735,0.251886225691506,0.411751161462843,
+  0.559770831073948,0.691687043060353,0.803704958972523,0.892602466497556,
+  0.955823949571398,0.991565168420931,-0.991565168420931,-0.955823949571398,
+  -0.892602466497556,-0.803704958972523,-0.691687043060353,-0.559770831073948,
+  -0.411751161462843,-0.251886225691506,-0.084775013041735,0.084775013041735,
+  0.251886225691506,0.411751161462843,0.559770831073948,0.691687043060353,
+  0.803704958972523,0.892602466497556,0.955823949571398,0.991565168420931,
+  -0.991565168420931,-0.955823949571398,-0.892602466497556,-0.803704958972523,
+  -0.691687043060353,-0.559770831073948,-0.411751161462843,-0.251886225691506,
+  -0.084775013041735,0.084775013041735,0.251886225691506,0.411751161462843,
+  0.559770831073948,0.691687043060353,0.803704958972523,0.892602466497556,
+  0.955823949571398,0.991565168420931,-0.991565168420931,-0.955823949571398,
+  -0.892602466497556,-0.803704958972523,-0.691687043060353,-0.559770831073948,
+  -0.411751161462843,-0.251886225691506,-0.084775013041735,0.084775013041735,
+  0.251886225691506,0.411751161462843,0.559770831073948,0.691687043060353,
+  0.803704958972523,0.892602466497556,0.955823949571398,0.991565168420931,
+  -0.991565168420931,-0.955823949571398,-0.892602466497556,-0.803704958972523,
+  -0.691687043060353,-0.559770831073948,-0.411751161462843,-0.251886225691506,
+  -0.084775013041735,0.084775013041735,0.251886225691506,0.411751161462843,
+  0.559770831073948,0.691687043060353,0.803704958972523,0.892602466497556,
+  0.955823949571398,0.991565168420931,-0.991565168420931,-0.955823949571398,
+  -0.892602466497556,-0.803704958972523,-0.691687043060353,-0.559770831073948,
+  -0.411751161462843,-0.251886225691506,-0.084775013041735,0.084775013041735,
+  0.251886225691506,0.411751161462843,0.559770831073948,0.691687043060353,
+  0.803704958972523,0.892602466497556,0.955823949571398,0.991565168420931,
+  -0.991565168420931,-0.991565168420931,-0.991565168420931,-0.991565168420931,
+  -0.991565168420931,-0.991565168420931,-0.991565168420931,-0.991565168420931,
+  -0.991565168420931,-0.991565168420931,-0.991565168420931,-0.991565168420931,
+  -0.991565168420931,-0.991565168420931,-0.991565168420931,-0.991565168420931,
+  -0.991565168420931,-0.991565168420931,-0.955823949571398,-0.955823949571398,
+  -0.955823949571398,-0.955823949571398,-0.955823949571398,-0.955823949571398,
+  -0.955823949571398,-0.955823949571398,-0.955823949571398,-0.955823949571398,
+  -0.955823949571398,-0.955823949571398,-0.955823949571398,-0.955823949571398,
+  -0.955823949571398,-0.955823949571398,-0.955823949571398,-0.955823949571398,
+  -0.892602466497556,-0.892602466497556,-0.892602466497556,-0.892602466497556,
+  -0.892602466497556,-0.892602466497556,-0.892602466497556,-0.892602466497556,
+  -0.892602466497556,-0.892602466497556,-0.892602466497556,-0.892602466497556,
+  -0.892602466497556,-0.892602466497556,-0.892602466497556,-0.892602466497556,
+  -0.892602466497556,-0.892602466497556,-0.803704958972523,-0.803704958972523,
+  -0.803704958972523,-0.803704958972523,-0.803704958972523,-0.803704958972523,
+  -0.803704958972523,-0.803704958972523,-0.803704958972523,-0.803704958972523,
+  -0.803704958972523,-0.803704958972523,-0.803704958972523,-0.803704958972523,
+  -0.803704958972523,-0.803704958972523,-0.803704958972523,-0.803704958972523,
+  -0.691687043060353,-0.691687043060353,-0.691687043060353,-0.691687043060353,
+  -0.691687043060353,-0.691687043060353,-0.691687043060353,-0.691687043060353,
+  -0.691687043060353,-0.691687043060353,-0.691687043060353,-0.691687043060353,
+  -0.691687043060353,-0.691687043060353,-0.691687043060353,-0.691687043060353,
+  -0.691687043060353,-0.691687043060353,-0.559770831073948,-0.559770831073948,
+  -0.559770831073948,-0.559770831073948,-0.559770831073948,-0.559770831073948,
+  -0.559770831073948,-0.559770831073948,-0.559770831073948,-0.559770831073948,
+  -0.559770831073948,-0.559770831073948,-0.559770831073948,-0.559770831073948,
+  -0.559770831073948,-0.559770831073948,-0.559770831073948,-0.559770831073948,
+  -0.411751161462843,-0.411751161462843,-0.411751161462843,-0.411751161462843,
+  -0.411751161462843,-0.411751161462843,-0.411751161462843,-0.411751161462843,
+  -0.411751161462843,-0.411751161462843,-0.411751161462843,-0.411751161462843,
+  -0.411751161462843,-0.411751161462843,-0.411751161462843,-0.411751161462843,
+  -0.411751161462843,-0.411751161462843,-0.251886225691506,-0.251886225691506,
+  -0.251886225691506,-0.251886225691506,-0.251886225691506,-0.251886225691506,
+  -0.251886225691506,-0.251886225691506,-0.251886225691506,-0.251886225691506,
+  -0.251886225691506,-0.251886225691506,-0.251886225691506,-0.251886225691506,
+  -0.251886225691506,-0.251886225691506,-0.251886225691506,-0.251886225691506,
+  -0.084775013041735,-0.084775013041735,-0.084775013041735,-0.084775013041735,
+  -0.084775013041735,-0.084775013041735,-0.084775013041735,-0.084775013041735,
+  -0.084775013041735,-0.084775013041735,-0.084775013041735,-0.084775013041735,
+  -0.084775013041735,-0.084775013041735,-0.084775013041735,-0.084775013041735,
+  -0.084775013041735,-0.084775013041735,0.084775013041735,0.084775013041735,
+  0.084775013041735,0.084775013041735,0.084775013041735,0.084775013041735,
+  0.084775013041735,0.084775013041735,0.084775013041735,0.084775013041735,
+  0.084775013041735,0.084775013041735,0.084775013041735,0.084775013041735,
+  0.084775013041735,0.084775013041735,0.084775013041735,0.084775013041735,
+  0.251886225691506,0.251886225691506,0.251886225691506,0.251886225691506,
+  0.251886225691506,0.251886225691506,0.251886225691506,0.251886225691506,
+  0.251886225691506,0.251886225691506,0.251886225691506,0.251886225691506,
+  0.251886225691506,0.251886225691506,0.251886225691506,0.251886225691506,
+  0.251886225691506,0.251886225691506,0.411751161462843,0.411751161462843,
+  0.411751161462843,0.411751161462843,0.411751161462843,0.411751161462843,
+  0.411751161462843,0.411751161462843,0.411751161462843,0.411751161462843,
+  0.411751161462843,0.411751161462843,0.411751161462843,0.411751161462843,
+  0.411751161462843,0.411751161462843,0.411751161462843,0.411751161462843,
+  0.559770831073948,0.559770831073948,0.559770831073948,0.559770831073948,
+  0.559770831073948,0.559770831073948,0.559770831073948,0.559770831073948,
+  0.559770831073948,0.559770831073948,0.559770831073948,0.559770831073948,
+  0.559770831073948,0.559770831073948,0.559770831073948,0.559770831073948,
+  0.559770831073948,0.559770831073948,0.691687043060353,0.691687043060353,
+  0.691687043060353,0.691687043060353,0.691687043060353,0.691687043060353,
+  0.691687043060353,0.691687043060353,0.691687043060353,0.691687043060353,
+  0.691687043060353,0.691687043060353,0.691687043060353,0.691687043060353,
+  0.691687043060353,0.691687043060353,0.691687043060353,0.691687043060353,
+  0.803704958972523,0.803704958972523,0.803704958972523,0.803704958972523,
+  0.803704958972523,0.803704958972523,0.803704958972523,0.803704958972523,
+  0.803704958972523,0.803704958972523,0.803704958972523,0.803704958972523,
+  0.803704958972523,0.803704958972523,0.803704958972523,0.803704958972523,
+  0.803704958972523,0.803704958972523,0.892602466497556,0.892602466497556,
+  0.892602466497556,0.892602466497556,0.892602466497556,0.892602466497556,
+  0.892602466497556,0.892602466497556,0.892602466497556,0.892602466497556,
+  0.892602466497556,0.892602466497556,0.892602466497556,0.892602466497556,
+  0.892602466497556,0.892602466497556,0.892602466497556,0.892602466497556,
+  0.955823949571398,0.955823949571398,0.955823949571398,0.955823949571398,
+  0.955823949571398,0.955823949571398,0.955823949571398,0.955823949571398,
+  0.955823949571398,0.955823949571398,0.955823949571398,0.955823949571398,
+  0.955823949571398,0.955823949571398,0.955823949571398,0.955823949571398,
+  0.955823949571398,0.955823949571398,0.991565168420931,0.991565168420931,
+  0.991565168420931,0.991565168420931,0.991565168420931,0.991565168420931,
+  0.991565168420931,0.991565168420931,0.991565168420931,0.991565168420931,
+  0.991565168420931,0.991565168420931,0.991565168420931,0.991565168420931,
+  0.991565168420931,0.991565168420931,0.991565168420931,0.991565168420931
+};
+static const double cubature_quad_18_weights[]={
+  0.000467252040777,0.00107463036138,0.00165201961896,0.00218196459079,
+  0.00264915500602,0.00304013914592,0.00334366602987,0.00355100269473,
+  0.00365618403803,0.00365618403803,0.00355100269473,0.00334366602987,
+  0.00304013914592,0.00264915500602,0.00218196459079,0.00165201961896,
+  0.00107463036138,0.000467252040777,0.00107463036138,0.00247153637183,
+  0.00379947070359,0.00501828818728,0.00609277681639,0.00699199905813,
+  0.00769007884487,0.00816693128348,0.00840883726803,0.00840883726803,
+  0.00816693128348,0.00769007884487,0.00699199905813,0.00609277681639,
+  0.00501828818728,0.00379947070359,0.00247153637183,0.00107463036138,
+  0.00165201961896,0.00379947070359,0.00584089224499,0.00771456943424,
+  0.00936637116946,0.0107487374589,0.0118218892558,0.012554950234,
+  0.012926830135,0.012926830135,0.012554950234,0.0118218892558,
+  0.0107487374589,0.00936637116946,0.00771456943424,0.00584089224499,
+  0.00379947070359,0.00165201961896,0.00218196459079,0.00501828818728,
+  0.00771456943424,0.0101892962684,0.0123709730813,0.0141967832959,
+  0.0156141872992,0.0165824040679,0.0170735778813,0.0170735778813,
+  0.0165824040679,0.0156141872992,0.0141967832959,0.0123709730813,
+  0.0101892962684,0.00771456943424,0.00501828818728,0.00218196459079,
+  0.00264915500602,0.00609277681639,0.00936637116946,0.0123709730813,
+  0.0150197786921,0.01723652148,0.0189574123352,0.0201329384233,
+  0.0207292797077,0.0207292797077,0.0201329384233,0.0189574123352,
+  0.01723652148,0.0150197786921,0.0123709730813,0.00936637116946,
+  0.00609277681639,0.00264915500602,0.00304013914592,0.00699199905813,
+  0.0107487374589,0.0141967832959,0.01723652148,0.0197804294471,
+  0.0217553035646,0.0231043234859,0.0237886777343,0.0237886777343,
+  0.0231043234859,0.0217553035646,0.0197804294471,0.01723652148,
+  0.0141967832959,0.0107487374589,0.00699199905813,0.00304013914592,
+  0.00334366602987,0.00769007884487,0.0118218892558,0.0156141872992,
+  0.0189574123352,0.0217553035646,0.0239273487189,0.0254110545191,
+  0.0261637345587,0.0261637345587,0.0254110545191,0.0239273487189,
+  0.0217553035646,0.0189574123352,0.0156141872992,0.0118218892558,
+  0.00769007884487,0.00334366602987,0.00355100269473,0.00816693128348,
+  0.012554950234,0.0165824040679,0.0201329384233,0.0231043234859,
+  0.0254110545191,0.0269867631119,0.0277861159256,0.0277861159256,
+  0.0269867631119,0.0254110545191,0.0231043234859,0.0201329384233,
+  0.0165824040679,0.012554950234,0.00816693128348,0.00355100269473,
+  0.00365618403803,0.00840883726803,0.012926830135,0.0170735778813,
+  0.0207292797077,0.0237886777343,0.0261637345587,0.0277861159256,
+  0.0286091457145,0.0286091457145,0.0277861159256,0.0261637345587,
+  0.0237886777343,0.0207292797077,0.0170735778813,0.012926830135,
+  0.00840883726803,0.00365618403803,0.00365618403803,0.00840883726803,
+  0.012926830135,0.0170735778813,0.0207292797077,0.0237886777343,
+  0.0261637345587,0.0277861159256,0.0286091457145,0.0286091457145,
+  0.0277861159256,0.0261637345587,0.0237886777343,0.0207292797077,
+  0.0170735778813,0.012926830135,0.00840883726803,0.00365618403803,
+  0.00355100269473,0.00816693128348,0.012554950234,0.0165824040679,
+  0.0201329384233,0.0231043234859,0.0254110545191,0.0269867631119,
+  0.0277861159256,0.0277861159256,0.0269867631119,0.0254110545191,
+  0.0231043234859,0.0201329384233,0.0165824040679,0.012554950234,
+  0.00816693128348,0.00355100269473,0.00334366602987,0.00769007884487,
+  0.0118218892558,0.0156141872992,0.0189574123352,0.0217553035646,
+  0.0239273487189,0.0254110545191,0.0261637345587,0.0261637345587,
+  0.0254110545191,0.0239273487189,0.0217553035646,0.0189574123352,
+  0.0156141872992,0.0118218892558,0.00769007884487,0.00334366602987,
+  0.00304013914592,0.00699199905813,0.0107487374589,0.0141967832959,
+  0.01723652148,0.0197804294471,0.0217553035646,0.0231043234859,
+  0.0237886777343,0.0237886777343,0.0231043234859,0.0217553035646,
+  0.0197804294471,0.01723652148,0.0141967832959,0.0107487374589,
+  0.00699199905813,0.00304013914592,0.00264915500602,0.00609277681639,
+  0.00936637116946,0.0123709730813,0.0150197786921,0.01723652148,
+  0.0189574123352,0.0201329384233,0.0207292797077,0.0207292797077,
+  0.0201329384233,0.0189574123352,0.01723652148,0.0150197786921,
+  0.0123709730813,0.00936637116946,0.00609277681639,0.00264915500602,
+  0.00218196459079,0.00501828818728,0.00771456943424,0.0101892962684,
+  0.0123709730813,0.0141967832959,0.0156141872992,0.0165824040679,
+  0.0170735778813,0.0170735778813,0.0165824040679,0.0156141872992,
+  0.0141967832959,0.0123709730813,0.0101892962684,0.00771456943424,
+  0.00501828818728,0.00218196459079,0.00165201961896,0.00379947070359,
+  0.00584089224499,0.00771456943424,0.00936637116946,0.0107487374589,
+  0.0118218892558,0.012554950234,0.012926830135,0.012926830135,
+  0.012554950234,0.0118218892558,0.0107487374589,0.00936637116946,
+  0.00771456943424,0.00584089224499,0.00379947070359,0.00165201961896,
+  0.00107463036138,0.00247153637183,0.00379947070359,0.00501828818728,
+  0.00609277681639,0.00699199905813,0.00769007884487,0.00816693128348,
+  0.00840883726803,0.00840883726803,0.00816693128348,0.00769007884487,
+  0.00699199905813,0.00609277681639,0.00501828818728,0.00379947070359,
+  0.00247153637183,0.00107463036138,0.000467252040777,0.00107463036138,
+  0.00165201961896,0.00218196459079,0.00264915500602,0.00304013914592,
+  0.00334366602987,0.00355100269473,0.00365618403803,0.00365618403803,
+  0.00355100269473,0.00334366602987,0.00304013914592,0.00264915500602,
+  0.00218196459079,0.00165201961896,0.00107463036138,0.000467252040777
+};
+static const double cubature_quad_19_locs[]={
+  -0.992406843843584,-0.960208152134830,-0.903155903614818,-0.822714656537143,
+  -0.720966177335229,-0.600545304661681,-0.464570741375961,-0.316564099963630,
+  -0.160358645640225,0E-15,0.160358645640225,0.316564099963630,
+  0.464570741375961,0.600545304661681,0.720966177335229,0.822714656537143,
+  0.903155903614818,0.960208152134830,0.992406843843584,-0.992406843843584,
+  -0.960208152134830,-0.903155903614818,-0.822714656537143,-0.720966177335229,
+  -0.600545304661681,-0.464570741375961,-0.316564099963630,-0.160358645640225,
+  0E-15,0.160358645640225,0.316564099963630,0.464570741375961,
+  0.600545304661681,0.720966177335229,0.822714656537143,0.903155903614818,
+  0.960208152134830,0.992406843843584,-0.992406843843584,-0.960208152134830,
+  -0.903155903614818,-0.822714656537143,-0.720966177335229,-0.600545304661681,
+  -0.464570741375961,-0.316564099963630,-0.160358645640225,0E-15,
+  0.160358645640225,0.316564099963630,0.464570741375961,0.600545304661681,
+  0.720966177335229,0.822714656537143,0.903155903614818,0.960208152134830,
+  0.992406843843584,-0.992406843843584,-0.960208152134830,-0.903155903614818,
+  -0.822714656537143,-0.720966177335229,-0.600545304661681,-0.464570741375961,
+  -0.316564099963630,-0.160358645640225,0E-15,0.160358645640225,
+  0.316564099963630,0.464570741375961,0.600545304661681,0.720966177335229,
+  0.822714656537143,0.903155903614818,0.960208152134830,0.992406843843584,
+  -0.992406843843584,-0.960208152134830,-0.903155903614818,-0.822714656537143,
+  -0.720966177335229,-0.600545304661681,-0.464570741375961,-0.316564099963630,
+  -0.160358645640225,0E-15,0.160358645640225,0.316564099963630,
+  0.464570741375961,0.600545304661681,0.720966177335229,0.822714656537143,
+  0.903155903614818,0.960208152134830,0.992406843843584,-0.992406843843584,
+  -0.960208152134830,-0.903155903614818,-0.822714656537143,-0.720966177335229,
+  -0.600545304661681,-0.464570741375961,-0.316564099963630,-0.160358645640225,
+  0E-15,0.160358645640225,0.316564099963630,0.464570741375961,
+  0.600545304661681,0.720966177335229,0.822714656537143,0.903155903614818,
+  0.960208152134830,0.992406843843584,-0.992406843843584,-0.960208152134830,
+  -0.903155903614818,-0.822714656537143,-0.720966177335229,-0.600545304661681,
+  -0.464570741375961,-0.316564099963630,-0.160358645640225,0E-15,
+  0.160358645640225,0.316564099963630,0.464570741375961,0.600545304661681,
+  0.720966177335229,0.822714656537143,0.903155903614818,0.960208152134830,
+  0.992406843843584,-0.992406843843584,-0.960208152134830,-0.903155903614818,
+  -0.822714656537143,-0.720966177335229,-0.600545304661681,-0.464570741375961,
+  -0.316564099963630,-0.160358645640225,0E-15,0.160358645640225,
+  0.316564099963630,0.464570741375961,0.600545304661681,0.720966177335229,
+  0.822714656537143,0.903155903614818,0.960208152134830,0.992406843843584,
+  -0.992406843843584,-0.960208152134830,-0.903155903614818,-0.822714656537143,
+  -0.720966177335229,-0.600545304661681,-0.464570741375961,-0.316564099963630,
+  -0.160358645640225,0E-15,0.160358645640225,0.316564099963630,
+  0.464570741375961,0.600545304661681,0.720966177335229,0.822714656537143,
+  0.903155903614818,0.960208152134830,0.992406843843584,-0.992406843843584,
+  -0.960208152134830,-0.903155903614818,-0.822714656537143,-0.720966177335229,
+  -0.600545304661681,-0.464570741375961,-0.316564099963630,-0.160358645640225,
+  0E-15,0.160358645640225,0.316564099963630,0.464570741375961,
+  0.600545304661681,0.720966177335229,0.822714656537143,0.903155903614818,
+  0.960208152134830,0.992406843843584,-0.992406843843584,-0.960208152134830,
+  -0.903155903614818,-0.822714656537143,-0.720966177335229,-0.600545304661681,
+  -0.464570741375961,-0.316564099963630,-0.160358645640225,0E-15,
+  0.160358645640225,0.316564099963630,0.464570741375961,0.600545304661681,
+  0.720966177335229,0.822714656537143,0.903155903614818,0.960208152134830,
+  0.992406843843584,-0.992406843843584,-0.960208152134830,-0.903155903614818,
+  -0.822714656537143,-0.720966177335229,-0.600545304661681,-0.464570741375961,
+  -0.316564099963630,-0.160358645640225,0E-15,0.160358645640225,
+  0.316564099963630,0.464570741375961,0.600545304661681,0.720966177335229,
+  0.822714656537143,0.903155903614818,0.960208152134830,0.992406843843584,
+  -0.992406843843584,-0.960208152134830,-0.903155903614818,-0.822714656537143,
+  -0.720966177335229,-0.600545304661681,-0.464570741375961,-0.316564099963630,
+  -0.160358645640225,0E-15,0.160358645640225,0.316564099963630,
+  0.464570741375961,0.600545304661681,0.720966177335229,0.822714656537143,
+  0.903155903614818,0.960208152134830,0.992406843843584,-0.992406843843584,
+  -0.960208152134830,-0.903155903614818,-0.822714656537143,-0.720966177335229,
+  -0.600545304661681,-0.464570741375961,-0.316564099963630,-0.160358645640225,
+  0E-15,0.160358645640225,0.316564099963630,0.464570741375961,
+  0.600545304661681,0.720966177335229,0.822714656537143,0.903155903614818,
+  0.960208152134830,0.992406843843584,-0.992406843843584,-0.960208152134830,
+  -0.903155903614818,-0.822714656537143,-0.720966177335229,-0.600545304661681,
+  -0.464570741375961,-0.316564099963630,-0.160358645640225,0E-15,
+  0.160358645640225,0.316564099963630,0.464570741375961,0.600545304661681,
+  0.720966177335229,0.822714656537143,0.903155903614818,0.960208152134830,
+  0.992406843843584,-0.992406843843584,-0.960208152134830,-0.903155903614818,
+  -0.822714656537143,-0.720966177335229,-0.600545304661681,-0.464570741375961,
+  -0.316564099963630,-0.160358645640225,0E-15,0.160358645640225,
+  0.316564099963630,0.464570741375961,0.600545304661681,0.720966177335229,
+  0.822714656537143,0.903155903614818,0.960208152134830,0.992406843843584,
+  -0.992406843843584,-0.960208152134830,-0.903155903614818,-0.822714656537143,
+  -0.720966177335229,-0.600545304661681,-0.464570741375961,-0.316564099963630,
+  -0.160358645640225,0E-15,0.160358645640225,0.316564099963630,
+  0.464570741375961,0.600545304661681,0.720966177335229,0.822714656537143,
+  0.903155903614818,0.960208152134830,0.992406843843584,-0.992406843843584,
+  -0.960208152134830,-0.903155903614818,-0.822714656537143,-0.720966177335229,
+  -0.600545304661681,-0.464570741375961,-0.316564099963630,-0.160358645640225,
+  0E-15,0.160358645640225,0.316564099963630,0.464570741375961,
+  0.600545304661681,0.720966177335229,0.822714656537143,0.903155903614818,
+  0.960208152134830,0.992406843843584,-0.992406843843584,-0.960208152134830,
+  -0.903155903614818,-0.822714656537143,-0.720966177335229,-0.600545304661681,
+  -0.464570741375961,-0.316564099963630,-0.160358645640225,0E-15,
+  0.160358645640225,0.316564099963630,0.464570741375961,0.600545304661681,
+  0.720966177335229,0.822714656537143,0.903155903614818,0.960208152134830,
+  0.992406843843584,-0.992406843843584,-0.992406843843584,-0.992406843843584,
+  -0.992406843843584,-0.992406843843584,-0.992406843843584,-0.992406843843584,
+  -0.992406843843584,-0.992406843843584,-0.992406843843584,-0.992406843843584,
+  -0.992406843843584,-0.992406843843584,-0.992406843843584,-0.992406843843584,
+  -0.992406843843584,-0.992406843843584,-0.992406843843584,-0.992406843843584,
+  -0.960208152134830,-0.960208152134830,-0.960208152134830,-0.960208152134830,
+  -0.960208152134830,-0.960208152134830,-0.960208152134830,-0.960208152134830,
+  -0.960208152134830,-0.960208152134830,-0.960208152134830,-0.960208152134830,
+  -0.960208152134830,-0.960208152134830,-0.960208152134830,-0.960208152134830,
+  -0.960208152134830,-0.960208152134830,-0.960208152134830,-0.903155903614818,
+  -0.903155903614818,-0.903155903614818,-0.903155903614818,-0.903155903614818,
+  -0.903155903614818,-0.903155903614818,-0.903155903614818,-0.903155903614818,
+  -0.903155903614818,-0.903155903614818,-0.903155903614818,-0.903155903614818,
+  -0.903155903614818,-0.903155903614818,-0.903155903614818,-0.903155903614818,
+  -0.903155903614818,-0.903155903614818,-0.822714656537143,-0.822714656537143,
+  -0.822714656537143,-0.822714656537143,-0.822714656537143,-0.822714656537143,
+  -0.822714656537143,-0.822714656537143,-0.822714656537143,-0.822714656537143,
+  -0.822714656537143,-0.822714656537143,-0.822714656537143,-0.822714656537143,
+  -0.822714656537143,-0.822714656537143,-0.822714656537143,-0.822714656537143,
+  -0.822714656537143,-0.720966177335229,-0.720966177335229,-0.720966177335229,
+  -0.720966177335229,-0.720966177335229,-0.720966177335229,-0.720966177335229,
+  -0.720966177335229,-0.720966177335229,-0.720966177335229,-0.720966177335229,
+  -0.720966177335229,-0.720966177335229,-0.720966177335229,-0.720966177335229,
+  -0.720966177335229,-0.720966177335229,-0.720966177335229,-0.720966177335229,
+  -0.600545304661681,-0.600545304661681,-0.600545304661681,-0.600545304661681,
+  -0.600545304661681,-0.600545304661681,-0.600545304661681,-0.600545304661681,
+  -0.600545304661681,-0.600545304661681,-0.600545304661681,-0.600545304661681,
+  -0.600545304661681,-0.600545304661681,-0.600545304661681,-0.600545304661681,
+  -0.600545304661681,-0.600545304661681,-0.600545304661681,-0.464570741375961,
+  -0.464570741375961,-0.464570741375961,-0.464570741375961,-0.464570741375961,
+  -0.464570741375961,-0.464570741375961,-0.464570741375961,-0.464570741375961,
+  -0.464570741375961,-0.464570741375961,-0.464570741375961,-0.464570741375961,
+  -0.464570741375961,-0.464570741375961,-0.464570741375961,-0.464570741375961,
+  -0.464570741375961,-0.464570741375961,-0.316564099963630,-0.316564099963630,
+  -0.316564099963630,-0.316564099963630,-0.316564099963630,-0.316564099963630,
+  -0.316564099963630,-0.316564099963630,-0.316564099963630,-0.316564099963630,
+  -0.316564099963630,-0.316564099963630,-0.316564099963630,-0.316564099963630,
+  -0.316564099963630,-0.316564099963630,-0.316564099963630,-0.316564099963630,
+  -0.316564099963630,-0.160358645640225,-0.160358645640225,-0.160358645640225,
+  -0.160358645640225,-0.160358645640225,-0.160358645640225,-0.160358645640225,
+  -0.160358645640225,-0.160358645640225,-0.160358645640225,-0.160358645640225,
+  -0.160358645640225,-0.160358645640225,-0.160358645640225,-0.160358645640225,
+  -0.160358645640225,-0.160358645640225,-0.160358645640225,-0.160358645640225,
+  0E-15,0E-15,0E-15,0E-15,
+  0E-15,0E-15,0E-15,0E-15,
+  0E-15,0E-15,0E-15,0E-15,
+  0E-15,0E-15,0E-15,0E-15,
+  0E-15,0E-15,0E-15,0.160358645640225,
+  0.160358645640225,0.160358645640225,0.160358645640225,0.160358645640225,
+  0.160358645640225,0.160358645640225,0.160358645640225,0.160358645640225,
+  0.160358645640225,0.160358645640225,0.160358645640225,0.160358645640225,
+  0.160358645640225,0.160358645640225,0.160358645640225,0.160358645640225,
+  0.160358645640225,0.160358645640225,0.316564099963630,0.316564099963630,
+  0.316564099963630,0.316564099963630,0.316564099963630,0.316564099963630,
+  0.316564099963630,0.316564099963630,0.316564099963630,0.316564099963630,
+  0.316564099963630,0.316564099963630,0.316564099963630,0.316564099963630,
+  0.316564099963630,0.316564099963630,0.316564099963630,0.316564099963630,
+  0.316564099963630,0.464570741375961,0.464570741375961,0.464570741375961,
+  0.464570741375961,0.464570741375961,0.464570741375961,0.464570741375961,
+  0.464570741375961,0.464570741375961,0.464570741375961,0.464570741375961,
+  0.464570741375961,0.464570741375961,0.464570741375961,0.464570741375961,
+  0.464570741375961,0.464570741375961,0.464570741375961,0.464570741375961,
+  0.600545304661681,0.600545304661681,0.600545304661681,0.600545304661681,
+  0.600545304661681,0.600545304661681,0.600545304661681,0.600545304661681,
+  0.600545304661681,0.600545304661681,0.600545304661681,0.600545304661681,
+  0.600545304661681,0.600545304661681,0.600545304661681,0.600545304661681,
+  0.600545304661681,0.600545304661681,0.600545304661681,0.720966177335229,
+  0.720966177335229,0.720966177335229,0.720966177335229,0.720966177335229,
+  0.720966177335229,0.720966177335229,0.720966177335229,0.720966177335229,
+  0.720966177335229,0.720966177335229,0.720966177335229,0.720966177335229,
+  0.720966177335229,0.720966177335229,0.720966177335229,0.720966177335229,
+  0.720966177335229,0.720966177335229,0.822714656537143,0.822714656537143,
+  0.822714656537143,0.822714656537143,0.822714656537143,0.822714656537143,
+  0.822714656537143,0.822714656537143,0.822714656537143,0.822714656537143,
+  0.822714656537143,0.822714656537143,0.822714656537143,0.822714656537143,
+  0.822714656537143,0.822714656537143,0.822714656537143,0.822714656537143,
+  0.822714656537143,0.903155903614818,0.903155903614818,0.903155903614818,
+  0.903155903614818,0.903155903614818,0.903155903614818,0.903155903614818,
+  0.903155903614818,0.903155903614818,0.903155903614818,0.903155903614818,
+  0.903155903614818,0.903155903614818,0.903155903614818,0.903155903614818,
+  0.903155903614818,0.903155903614818,0.903155903614818,0.903155903614818,
+  0.960208152134830,0.960208152134830,0.960208152134830,0.960208152134830,
+  0.960208152134830,0.960208152134830,0.960208152134830,0.960208152134830,
+  0.960208152134830,0.960208152134830,0.960208152134830,0.960208152134830,
+  0.960208152134830,0.960208152134830,0.960208152134830,0.960208152134830,
+  0.960208152134830,0.960208152134830,0.960208152134830,0.992406843843584,
+  0.992406843843584,0.992406843843584,0.992406843843584,0.992406843843584,
+  0.992406843843584,0.992406843843584,0.992406843843584,0.992406843843584,
+  0.992406843843584,0.992406843843584,0.992406843843584,0.992406843843584,
+  0.992406843843584,0.992406843843584,0.992406843843584,0.992406843843584,
+  0.992406843843584,0.992406843843584
+};
+static const double cubature_quad_19_weights[]={
+  0.000378761201099,0.000872164990993,0.00134373026918,0.00178055942595,
+  0.00217128642914,0.00250578235268,0.00277538143784,0.00297310035938,
+  0.00309381796526,0.00313440759641,0.00309381796526,0.00297310035938,
+  0.00277538143784,0.00250578235268,0.00217128642914,0.00178055942595,
+  0.00134373026918,0.000872164990993,0.000378761201099,0.000872164990993,
+  0.00200831492061,0.00309417779518,0.00410005457579,0.00499977295305,
+  0.00577000927422,0.00639080908952,0.00684609205124,0.00712406579654,
+  0.00721753063715,0.00712406579654,0.00684609205124,0.00639080908952,
+  0.00577000927422,0.00499977295305,0.00410005457579,0.00309417779518,
+  0.00200831492061,0.000872164990993,0.00134373026918,0.00309417779518,
+  0.00476714888185,0.00631688670798,0.00770306802659,0.00888975846919,
+  0.0098462145429,0.0105476615203,0.0109759311017,0.0111199308457,
+  0.0109759311017,0.0105476615203,0.0098462145429,0.00888975846919,
+  0.00770306802659,0.00631688670798,0.00476714888185,0.00309417779518,
+  0.00134373026918,0.00178055942595,0.00410005457579,0.00631688670798,
+  0.00837042405648,0.0102072348135,0.0117797028167,0.0130470902654,
+  0.0139765684918,0.0145440629194,0.0147348750991,0.0145440629194,
+  0.0139765684918,0.0130470902654,0.0117797028167,0.0102072348135,
+  0.00837042405648,0.00631688670798,0.00410005457579,0.00178055942595,
+  0.00217128642914,0.00499977295305,0.00770306802659,0.0102072348135,
+  0.0124471163987,0.0143646477014,0.0159101513941,0.0170435948668,
+  0.017735620604,0.0179683047201,0.017735620604,0.0170435948668,
+  0.0159101513941,0.0143646477014,0.0124471163987,0.0102072348135,
+  0.00770306802659,0.00499977295305,0.00217128642914,0.00250578235268,
+  0.00577000927422,0.00888975846919,0.0117797028167,0.0143646477014,
+  0.0165775828696,0.0183611779895,0.0196692332574,0.0204678685073,
+  0.0207363986026,0.0204678685073,0.0196692332574,0.0183611779895,
+  0.0165775828696,0.0143646477014,0.0117797028167,0.00888975846919,
+  0.00577000927422,0.00250578235268,0.00277538143784,0.00639080908952,
+  0.0098462145429,0.0130470902654,0.0159101513941,0.0183611779895,
+  0.0203366715048,0.0217854614631,0.0226700225048,0.0229674439633,
+  0.0226700225048,0.0217854614631,0.0203366715048,0.0183611779895,
+  0.0159101513941,0.0130470902654,0.0098462145429,0.00639080908952,
+  0.00277538143784,0.00297310035938,0.00684609205124,0.0105476615203,
+  0.0139765684918,0.0170435948668,0.0196692332574,0.0217854614631,
+  0.0233374636085,0.0242850410171,0.0246036508605,0.0242850410171,
+  0.0233374636085,0.0217854614631,0.0196692332574,0.0170435948668,
+  0.0139765684918,0.0105476615203,0.00684609205124,0.00297310035938,
+  0.00309381796526,0.00712406579654,0.0109759311017,0.0145440629194,
+  0.017735620604,0.0204678685073,0.0226700225048,0.0242850410171,
+  0.02527109317,0.0256026396159,0.02527109317,0.0242850410171,
+  0.0226700225048,0.0204678685073,0.017735620604,0.0145440629194,
+  0.0109759311017,0.00712406579654,0.00309381796526,0.00313440759641,
+  0.00721753063715,0.0111199308457,0.0147348750991,0.0179683047201,
+  0.0207363986026,0.0229674439633,0.0246036508605,0.0256026396159,
+  0.0259385358161,0.0256026396159,0.0246036508605,0.0229674439633,
+  0.0207363986026,0.0179683047201,0.0147348750991,0.0111199308457,
+  0.00721753063715,0.00313440759641,0.00309381796526,0.00712406579654,
+  0.0109759311017,0.0145440629194,0.017735620604,0.0204678685073,
+  0.0226700225048,0.0242850410171,0.02527109317,0.0256026396159,
+  0.02527109317,0.0242850410171,0.0226700225048,0.0204678685073,
+  0.017735620604,0.0145440629194,0.0109759311017,0.00712406579654,
+  0.00309381796526,0.00297310035938,0.00684609205124,0.0105476615203,
+  0.0139765684918,0.0170435948668,0.0196692332574,0.0217854614631,
+  0.0233374636085,0.0242850410171,0.0246036508605,0.0242850410171,
+  0.0233374636085,0.0217854614631,0.0196692332574,0.0170435948668,
+  0.0139765684918,0.0105476615203,0.00684609205124,0.00297310035938,
+  0.00277538143784,0.00639080908952,0.0098462145429,0.0130470902654,
+  0.0159101513941,0.0183611779895,0.0203366715048,0.0217854614631,
+  0.0226700225048,0.0229674439633,0.0226700225048,0.0217854614631,
+  0.0203366715048,0.0183611779895,0.0159101513941,0.0130470902654,
+  0.0098462145429,0.00639080908952,0.00277538143784,0.00250578235268,
+  0.00577000927422,0.00888975846919,0.0117797028167,0.0143646477014,
+  0.0165775828696,0.0183611779895,0.0196692332574,0.0204678685073,
+  0.0207363986026,0.0204678685073,0.0196692332574,0.0183611779895,
+  0.0165775828696,0.0143646477014,0.0117797028167,0.00888975846919,
+  0.00577000927422,0.00250578235268,0.00217128642914,0.00499977295305,
+  0.00770306802659,0.0102072348135,0.0124471163987,0.0143646477014,
+  0.0159101513941,0.0170435948668,0.017735620604,0.0179683047201,
+  0.017735620604,0.0170435948668,0.0159101513941,0.0143646477014,
+  0.0124471163987,0.0102072348135,0.00770306802659,0.00499977295305,
+  0.00217128642914,0.00178055942595,0.00410005457579,0.00631688670798,
+  0.00837042405648,0.0102072348135,0.0117797028167,0.0130470902654,
+  0.0139765684918,0.0145440629194,0.0147348750991,0.0145440629194,
+  0.0139765684918,0.0130470902654,0.0117797028167,0.0102072348135,
+  0.00837042405648,0.00631688670798,0.00410005457579,0.00178055942595,
+  0.00134373026918,0.00309417779518,0.00476714888185,0.00631688670798,
+  0.00770306802659,0.00888975846919,0.0098462145429,0.0105476615203,
+  0.0109759311017,0.0111199308457,0.0109759311017,0.0105476615203,
+  0.0098462145429,0.00888975846919,0.00770306802659,0.00631688670798,
+  0.00476714888185,0.00309417779518,0.00134373026918,0.000872164990993,
+  0.00200831492061,0.00309417779518,0.00410005457579,0.00499977295305,
+  0.00577000927422,0.00639080908952,0.00684609205124,0.00712406579654,
+  0.00721753063715,0.00712406579654,0.00684609205124,0.00639080908952,
+  0.00577000927422,0.00499977295305,0.00410005457579,0.00309417779518,
+  0.00200831492061,0.000872164990993,0.000378761201099,0.000872164990993,
+  0.00134373026918,0.00178055942595,0.00217128642914,0.00250578235268,
+  0.00277538143784,0.00297310035938,0.00309381796526,0.00313440759641,
+  0.00309381796526,0.00297310035938,0.00277538143784,0.00250578235268,
+  0.00217128642914,0.00178055942595,0.00134373026918,0.000872164990993,
+  0.000378761201099
+};
+static const double cubature_quad_20_locs[]={
+  -0.993128599185095,-0.963971927277914,-0.912234428251326,-0.839116971822219,
+  -0.746331906460151,-0.636053680726515,-0.510867001950827,-0.373706088715420,
+  -0.227785851141645,-0.076526521133497,0.076526521133497,0.227785851141645,
+  0.373706088715420,0.510867001950827,0.636053680726515,0.746331906460151,
+  0.839116971822219,0.912234428251326,0.963971927277914,0.993128599185095,
+  -0.993128599185095,-0.963971927277914,-0.912234428251326,-0.839116971822219,
+  -0.746331906460151,-0.636053680726515,-0.510867001950827,-0.373706088715420,
+  -0.227785851141645,-0.076526521133497,0.076526521133497,0.227785851141645,
+  0.373706088715420,0.510867001950827,0.636053680726515,0.746331906460151,
+  0.839116971822219,0.912234428251326,0.963971927277914,0.993128599185095,
+  -0.993128599185095,-0.963971927277914,-0.912234428251326,-0.839116971822219,
+  -0.746331906460151,-0.636053680726515,-0.510867001950827,-0.373706088715420,
+  -0.227785851141645,-0.076526521133497,0.076526521133497,0.227785851141645,
+  0.373706088715420,0.510867001950827,0.636053680726515,0.746331906460151,
+  0.839116971822219,0.912234428251326,0.963971927277914,0.993128599185095,
+  -0.993128599185095,-0.963971927277914,-0.912234428251326,-0.839116971822219,
+  -0.746331906460151,-0.636053680726515,-0.510867001950827,-0.373706088715420,
+  -0.227785851141645,-0.076526521133497,0.076526521133497,0.227785851141645,
+  0.373706088715420,0.510867001950827,0.636053680726515,0.746331906460151,
+  0.839116971822219,0.912234428251326,0.963971927277914,0.993128599185095,
+  -0.993128599185095,-0.963971927277914,-0.912234428251326,-0.839116971822219,
+  -0.746331906460151,-0.636053680726515,-0.510867001950827,-0.373706088715420,
+  -0.227785851141645,-0.076526521133497,0.076526521133497,0.227785851141645,
+  0.373706088715420,0.510867001950827,0.636053680726515,0.746331906460151,
+  0.839116971822219,0.912234428251326,0.963971927277914,0.993128599185095,
+  -0.993128599185095,-0.963971927277914,-0.912234428251326,-0.839116971822219,
+  -0.746331906460151,-0.636053680726515,-0.510867001950827,-0.373706088715420,
+  -0.227785851141645,-0.076526521133497,0.076526521133497,0.227785851141645,
+  0.373706088715420,0.510867001950827,0.636053680726515,0.746331906460151,
+  0.839116971822219,0.912234428251326,0.963971927277914,0.993128599185095,
+  -0.993128599185095,-0.963971927277914,-0.912234428251326,-0.839116971822219,
+  -0.746331906460151,-0.636053680726515,-0.510867001950827,-0.373706088715420,
+  -0.227785851141645,-0.076526521133497,0.076526521133497,0.227785851141645,
+  0.373706088715420,0.510867001950827,0.636053680726515,0.746331906460151,
+  0.839116971822219,0.912234428251326,0.963971927277914,0.993128599185095,
+  -0.993128599185095,-0.963971927277914,-0.912234428251326,-0.839116971822219,
+  -0.746331906460151,-0.636053680726515,-0.510867001950827,-0.373706088715420,
+  -0.227785851141645,-0.076526521133497,0.076526521133497,0.227785851141645,
+  0.373706088715420,0.510867001950827,0.636053680726515,0.746331906460151,
+  0.839116971822219,0.912234428251326,0.963971927277914,0.993128599185095,
+  -0.993128599185095,-0.963971927277914,-0.912234428251326,-0.839116971822219,
+  -0.746331906460151,-0.636053680726515,-0.510867001950827,-0.373706088715420,
+  -0.227785851141645,-0.076526521133497,0.076526521133497,0.227785851141645,
+  0.373706088715420,0.510867001950827,0.636053680726515,0.746331906460151,
+  0.839116971822219,0.912234428251326,0.963971927277914,0.993128599185095,
+  -0.993128599185095,-0.963971927277914,-0.912234428251326,-0.839116971822219,
+  -0.746331906460151,-0.636053680726515,-0.510867001950827,-0.373706088715420,
+  -0.227785851141645,-0.076526521133497,0.076526521133497,0.227785851141645,
+  0.373706088715420,0.510867001950827,0.636053680726515,0.746331906460151,
+  0.839116971822219,0.912234428251326,0.963971927277914,0.993128599185095,
+  -0.993128599185095,-0.963971927277914,-0.912234428251326,-0.839116971822219,
+  -0.746331906460151,-0.636053680726515,-0.510867001950827,-0.373706088715420,
+  -0.227785851141645,-0.076526521133497,0.076526521133497,0.227785851141645,
+  0.373706088715420,0.510867001950827,0.636053680726515,0.746331906460151,
+  0.839116971822219,0.912234428251326,0.963971927277914,0.993128599185095,
+  -0.993128599185095,-0.963971927277914,-0.912234428251326,-0.839116971822219,
+  -0.746331906460151,-0.636053680726515,-0.510867001950827,-0.373706088715420,
+  -0.227785851141645,-0.076526521133497,0.076526521133497,0.227785851141645,
+  0.373706088715420,0.510867001950827,0.636053680726515,0.746331906460151,
+  0.839116971822219,0.912234428251326,0.963971927277914,0.993128599185095,
+  -0.993128599185095,-0.963971927277914,-0.912234428251326,-0.839116971822219,
+  -0.746331906460151,-0.636053680726515,-0.510867001950827,-0.373706088715420,
+  -0.227785851141645,-0.076526521133497,0.076526521133497,0.227785851141645,
+  0.373706088715420,0.510867001950827,0.636053680726515,0.746331906460151,
+  0.839116971822219,0.912234428251326,0.963971927277914,0.993128599185095,
+  -0.993128599185095,-0.963971927277914,-0.912234428251326,-0.839116971822219,
+  -0.746331906460151,-0.636053680726515,-0.510867001950827,-0.373706088715420,
+  -0.227785851141645,-0.076526521133497,0.076526521133497,0.227785851141645,
+  0.373706088715420,0.510867001950827,0.636053680726515,0.746331906460151,
+  0.839116971822219,0.912234428251326,0.963971927277914,0.993128599185095,
+  -0.993128599185095,-0.963971927277914,-0.912234428251326,-0.839116971822219,
+  -0.746331906460151,-0.636053680726515,-0.510867001950827,-0.373706088715420,
+  -0.227785851141645,-0.076526521133497,0.076526521133497,0.227785851141645,
+  0.373706088715420,0.510867001950827,0.636053680726515,0.746331906460151,
+  0.839116971822219,0.912234428251326,0.963971927277914,0.993128599185095,
+  -0.993128599185095,-0.963971927277914,-0.912234428251326,-0.839116971822219,
+  -0.746331906460151,-0.636053680726515,-0.510867001950827,-0.373706088715420,
+  -0.227785851141645,-0.076526521133497,0.076526521133497,0.227785851141645,
+  0.373706088715420,0.510867001950827,0.636053680726515,0.746331906460151,
+  0.839116971822219,0.912234428251326,0.963971927277914,0.993128599185095,
+  -0.993128599185095,-0.963971927277914,-0.912234428251326,-0.839116971822219,
+  -0.746331906460151,-0.636053680726515,-0.510867001950827,-0.373706088715420,
+  -0.227785851141645,-0.076526521133497,0.076526521133497,0.227785851141645,
+  0.373706088715420,0.510867001950827,0.636053680726515,0.746331906460151,
+  0.839116971822219,0.912234428251326,0.963971927277914,0.993128599185095,
+  -0.993128599185095,-0.963971927277914,-0.912234428251326,-0.839116971822219,
+  -0.746331906460151,-0.636053680726515,-0.510867001950827,-0.373706088715420,
+  -0.227785851141645,-0.076526521133497,0.076526521133497,0.227785851141645,
+  0.373706088715420,0.510867001950827,0.636053680726515,0.746331906460151,
+  0.839116971822219,0.912234428251326,0.963971927277914,0.993128599185095,
+  -0.993128599185095,-0.963971927277914,-0.912234428251326,-0.839116971822219,
+  -0.746331906460151,-0.636053680726515,-0.510867001950827,-0.373706088715420,
+  -0.227785851141645,-0.076526521133497,0.076526521133497,0.227785851141645,
+  0.373706088715420,0.510867001950827,0.636053680726515,0.746331906460151,
+  0.839116971822219,0.912234428251326,0.963971927277914,0.993128599185095,
+  -0.993128599185095,-0.963971927277914,-0.912234428251326,-0.839116971822219,
+  -0.746331906460151,-0.636053680726515,-0.510867001950827,-0.373706088715420,
+  -0.227785851141645,-0.076526521133497,0.076526521133497,0.227785851141645,
+  0.373706088715420,0.510867001950827,0.636053680726515,0.746331906460151,
+  0.839116971822219,0.912234428251326,0.963971927277914,0.993128599185095,
+  -0.993128599185095,-0.993128599185095,-0.993128599185095,-0.993128599185095,
+  -0.993128599185095,-0.993128599185095,-0.993128599185095,-0.993128599185095,
+  -0.993128599185095,-0.993128599185095,-0.993128599185095,-0.993128599185095,
+  -0.993128599185095,-0.993128599185095,-0.993128599185095,-0.993128599185095,
+  -0.993128599185095,-0.993128599185095,-0.993128599185095,-0.993128599185095,
+  -0.963971927277914,-0.963971927277914,-0.963971927277914,-0.963971927277914,
+  -0.963971927277914,-0.963971927277914,-0.963971927277914,-0.963971927277914,
+  -0.963971927277914,-0.963971927277914,-0.963971927277914,-0.963971927277914,
+  -0.963971927277914,-0.963971927277914,-0.963971927277914,-0.963971927277914,
+  -0.963971927277914,-0.963971927277914,-0.963971927277914,-0.963971927277914,
+  -0.912234428251326,-0.912234428251326,-0.912234428251326,-0.912234428251326,
+  -0.912234428251326,-0.912234428251326,-0.912234428251326,-0.912234428251326,
+  -0.912234428251326,-0.912234428251326,-0.912234428251326,-0.912234428251326,
+  -0.912234428251326,-0.912234428251326,-0.912234428251326,-0.912234428251326,
+  -0.912234428251326,-0.912234428251326,-0.912234428251326,-0.912234428251326,
+  -0.839116971822219,-0.839116971822219,-0.839116971822219,-0.839116971822219,
+  -0.839116971822219,-0.839116971822219,-0.839116971822219,-0.839116971822219,
+  -0.839116971822219,-0.839116971822219,-0.839116971822219,-0.839116971822219,
+  -0.839116971822219,-0.839116971822219,-0.839116971822219,-0.839116971822219,
+  -0.839116971822219,-0.839116971822219,-0.839116971822219,-0.839116971822219,
+  -0.746331906460151,-0.746331906460151,-0.746331906460151,-0.746331906460151,
+  -0.746331906460151,-0.746331906460151,-0.746331906460151,-0.746331906460151,
+  -0.746331906460151,-0.746331906460151,-0.746331906460151,-0.746331906460151,
+  -0.746331906460151,-0.746331906460151,-0.746331906460151,-0.746331906460151,
+  -0.746331906460151,-0.746331906460151,-0.746331906460151,-0.746331906460151,
+  -0.636053680726515,-0.636053680726515,-0.636053680726515,-0.636053680726515,
+  -0.636053680726515,-0.636053680726515,-0.636053680726515,-0.636053680726515,
+  -0.636053680726515,-0.636053680726515,-0.636053680726515,-0.636053680726515,
+  -0.636053680726515,-0.636053680726515,-0.636053680726515,-0.636053680726515,
+  -0.636053680726515,-0.636053680726515,-0.636053680726515,-0.636053680726515,
+  -0.510867001950827,-0.510867001950827,-0.510867001950827,-0.510867001950827,
+  -0.510867001950827,-0.510867001950827,-0.510867001950827,-0.510867001950827,
+  -0.510867001950827,-0.510867001950827,-0.510867001950827,-0.510867001950827,
+  -0.510867001950827,-0.510867001950827,-0.510867001950827,-0.510867001950827,
+  -0.510867001950827,-0.510867001950827,-0.510867001950827,-0.510867001950827,
+  -0.373706088715420,-0.373706088715420,-0.373706088715420,-0.373706088715420,
+  -0.373706088715420,-0.373706088715420,-0.373706088715420,-0.373706088715420,
+  -0.373706088715420,-0.373706088715420,-0.373706088715420,-0.373706088715420,
+  -0.373706088715420,-0.373706088715420,-0.373706088715420,-0.373706088715420,
+  -0.373706088715420,-0.373706088715420,-0.373706088715420,-0.373706088715420,
+  -0.227785851141645,-0.227785851141645,-0.227785851141645,-0.227785851141645,
+  -0.227785851141645,-0.227785851141645,-0.227785851141645,-0.227785851141645,
+  -0.227785851141645,-0.227785851141645,-0.227785851141645,-0.227785851141645,
+  -0.227785851141645,-0.227785851141645,-0.227785851141645,-0.227785851141645,
+  -0.227785851141645,-0.227785851141645,-0.227785851141645,-0.227785851141645,
+  -0.076526521133497,-0.076526521133497,-0.076526521133497,-0.076526521133497,
+  -0.076526521133497,-0.076526521133497,-0.076526521133497,-0.076526521133497,
+  -0.076526521133497,-0.076526521133497,-0.076526521133497,-0.076526521133497,
+  -0.076526521133497,-0.076526521133497,-0.076526521133497,-0.076526521133497,
+  -0.076526521133497,-0.076526521133497,-0.076526521133497,-0.076526521133497,
+  0.076526521133497,0.076526521133497,0.076526521133497,0.076526521133497,
+  0.076526521133497,0.076526521133497,0.076526521133497,0.076526521133497,
+  0.076526521133497,0.076526521133497,0.076526521133497,0.076526521133497,
+  0.076526521133497,0.076526521133497,0.076526521133497,0.076526521133497,
+  0.076526521133497,0.076526521133497,0.076526521133497,0.076526521133497,
+  0.227785851141645,0.227785851141645,0.227785851141645,0.227785851141645,
+  0.227785851141645,0.227785851141645,0.227785851141645,0.227785851141645,
+  0.227785851141645,0.227785851141645,0.227785851141645,0.227785851141645,
+  0.227785851141645,0.227785851141645,0.227785851141645,0.227785851141645,
+  0.227785851141645,0.227785851141645,0.227785851141645,0.227785851141645,
+  0.373706088715420,0.373706088715420,0.373706088715420,0.373706088715420,
+  0.373706088715420,0.373706088715420,0.373706088715420,0.373706088715420,
+  0.373706088715420,0.373706088715420,0.373706088715420,0.373706088715420,
+  0.373706088715420,0.373706088715420,0.373706088715420,0.373706088715420,
+  0.373706088715420,0.373706088715420,0.373706088715420,0.373706088715420,
+  0.510867001950827,0.510867001950827,0.510867001950827,0.510867001950827,
+  0.510867001950827,0.510867001950827,0.510867001950827,0.510867001950827,
+  0.510867001950827,0.510867001950827,0.510867001950827,0.510867001950827,
+  0.510867001950827,0.510867001950827,0.510867001950827,0.510867001950827,
+  0.510867001950827,0.510867001950827,0.510867001950827,0.510867001950827,
+  0.636053680726515,0.636053680726515,0.636053680726515,0.636053680726515,
+  0.636053680726515,0.636053680726515,0.636053680726515,0.636053680726515,
+  0.636053680726515,0.636053680726515,0.636053680726515,0.636053680726515,
+  0.636053680726515,0.636053680726515,0.636053680726515,0.636053680726515,
+  0.636053680726515,0.636053680726515,0.636053680726515,0.636053680726515,
+  0.746331906460151,0.746331906460151,0.746331906460151,0.746331906460151,
+  0.746331906460151,0.746331906460151,0.746331906460151,0.746331906460151,
+  0.746331906460151,0.746331906460151,0.746331906460151,0.746331906460151,
+  0.746331906460151,0.746331906460151,0.746331906460151,0.746331906460151,
+  0.746331906460151,0.746331906460151,0.746331906460151,0.746331906460151,
+  0.839116971822219,0.839116971822219,0.839116971822219,0.839116971822219,
+  0.839116971822219,0.839116971822219,0.839116971822219,0.839116971822219,
+  0.839116971822219,0.839116971822219,0.839116971822219,0.839116971822219,
+  0.839116971822219,0.839116971822219,0.839116971822219,0.839116971822219,
+  0.839116971822219,0.839116971822219,0.839116971822219,0.839116971822219,
+  0.912234428251326,0.912234428251326,0.912234428251326,0.912234428251326,
+  0.912234428251326,0.912234428251326,0.912234428251326,0.912234428251326,
+  0.912234428251326,0.912234428251326,0.912234428251326,0.912234428251326,
+  0.912234428251326,0.912234428251326,0.912234428251326,0.912234428251326,
+  0.912234428251326,0.912234428251326,0.912234428251326,0.912234428251326,
+  0.963971927277914,0.963971927277914,0.963971927277914,0.963971927277914,
+  0.963971927277914,0.963971927277914,0.963971927277914,0.963971927277914,
+  0.963971927277914,0.963971927277914,0.963971927277914,0.963971927277914,
+  0.963971927277914,0.963971927277914,0.963971927277914,0.963971927277914,
+  0.963971927277914,0.963971927277914,0.963971927277914,0.963971927277914,
+  0.993128599185095,0.993128599185095,0.993128599185095,0.993128599185095,
+  0.993128599185095,0.993128599185095,0.993128599185095,0.993128599185095,
+  0.993128599185095,0.993128599185095,0.993128599185095,0.993128599185095,
+  0.993128599185095,0.993128599185095,0.993128599185095,0.993128599185095,
+  0.993128599185095,0.993128599185095,0.993128599185095,0.993128599185095
+};
+static const double cubature_quad_20_weights[]={
+  0.000310253247498,0.000715153874364,0.00110390590678,0.00146683712066,
+  0.00179539785815,0.00208187932978,0.00231956461779,0.00250288188398,
+  0.0026275340487,0.00269059925145,0.00269059925145,0.0026275340487,
+  0.00250288188398,0.00231956461779,0.00208187932978,0.00179539785815,
+  0.00146683712066,0.00110390590678,0.000715153874364,0.000310253247498,
+  0.000715153874364,0.00164847610184,0.00254457477088,0.00338115477713,
+  0.00413850860431,0.00479886699222,0.0053467470095,0.0057693052074,
+  0.00605663653838,0.00620200592436,0.00620200592436,0.00605663653838,
+  0.0057693052074,0.0053467470095,0.00479886699222,0.00413850860431,
+  0.00338115477713,0.00254457477088,0.00164847610184,0.000715153874364,
+  0.00110390590678,0.00254457477088,0.00392778564239,0.0052191239732,
+  0.00638816939589,0.00740749341992,0.00825319671394,0.00890545423129,
+  0.00934897661835,0.00957336766146,0.00957336766146,0.00934897661835,
+  0.00890545423129,0.00825319671394,0.00740749341992,0.00638816939589,
+  0.0052191239732,0.00392778564239,0.00254457477088,0.00110390590678,
+  0.00146683712066,0.00338115477713,0.0052191239732,0.00693501568763,
+  0.0084884082469,0.00984285549394,0.0109666007127,0.0118333009748,
+  0.0124226402447,0.0127208043451,0.0127208043451,0.0124226402447,
+  0.0118333009748,0.0109666007127,0.00984285549394,0.0084884082469,
+  0.00693501568763,0.0052191239732,0.00338115477713,0.00146683712066,
+  0.00179539785815,0.00413850860431,0.00638816939589,0.0084884082469,
+  0.010389749326,0.0120475828046,0.0134230386957,0.0144838734484,
+  0.0152052203846,0.0155701710527,0.0155701710527,0.0152052203846,
+  0.0144838734484,0.0134230386957,0.0120475828046,0.010389749326,
+  0.0084884082469,0.00638816939589,0.00413850860431,0.00179539785815,
+  0.00208187932978,0.00479886699222,0.00740749341992,0.00984285549394,
+  0.0120475828046,0.0139699473856,0.0155648769862,0.0167949831344,
+  0.0176314313174,0.0180546150975,0.0180546150975,0.0176314313174,
+  0.0167949831344,0.0155648769862,0.0139699473856,0.0120475828046,
+  0.00984285549394,0.00740749341992,0.00479886699222,0.00208187932978,
+  0.00231956461779,0.0053467470095,0.00825319671394,0.0109666007127,
+  0.0134230386957,0.0155648769862,0.0173418974966,0.0187124431651,
+  0.019644387482,0.0201158855697,0.0201158855697,0.019644387482,
+  0.0187124431651,0.0173418974966,0.0155648769862,0.0134230386957,
+  0.0109666007127,0.00825319671394,0.0053467470095,0.00231956461779,
+  0.00250288188398,0.0057693052074,0.00890545423129,0.0118333009748,
+  0.0144838734484,0.0167949831344,0.0187124431651,0.0201913042834,
+  0.0211969009932,0.0217056619965,0.0217056619965,0.0211969009932,
+  0.0201913042834,0.0187124431651,0.0167949831344,0.0144838734484,
+  0.0118333009748,0.00890545423129,0.0057693052074,0.00250288188398,
+  0.0026275340487,0.00605663653838,0.00934897661835,0.0124226402447,
+  0.0152052203846,0.0176314313174,0.019644387482,0.0211969009932,
+  0.0222525798932,0.0227866789521,0.0227866789521,0.0222525798932,
+  0.0211969009932,0.019644387482,0.0176314313174,0.0152052203846,
+  0.0124226402447,0.00934897661835,0.00605663653838,0.0026275340487,
+  0.00269059925145,0.00620200592436,0.00957336766146,0.0127208043451,
+  0.0155701710527,0.0180546150975,0.0201158855697,0.0217056619965,
+  0.0227866789521,0.0233335972799,0.0233335972799,0.0227866789521,
+  0.0217056619965,0.0201158855697,0.0180546150975,0.0155701710527,
+  0.0127208043451,0.00957336766146,0.00620200592436,0.00269059925145,
+  0.00269059925145,0.00620200592436,0.00957336766146,0.0127208043451,
+  0.0155701710527,0.0180546150975,0.0201158855697,0.0217056619965,
+  0.0227866789521,0.0233335972799,0.0233335972799,0.0227866789521,
+  0.0217056619965,0.0201158855697,0.0180546150975,0.0155701710527,
+  0.0127208043451,0.00957336766146,0.00620200592436,0.00269059925145,
+  0.0026275340487,0.00605663653838,0.00934897661835,0.0124226402447,
+  0.0152052203846,0.0176314313174,0.019644387482,0.0211969009932,
+  0.0222525798932,0.0227866789521,0.0227866789521,0.0222525798932,
+  0.0211969009932,0.019644387482,0.0176314313174,0.0152052203846,
+  0.0124226402447,0.00934897661835,0.00605663653838,0.0026275340487,
+  0.00250288188398,0.0057693052074,0.00890545423129,0.0118333009748,
+  0.0144838734484,0.0167949831344,0.0187124431651,0.0201913042834,
+  0.0211969009932,0.0217056619965,0.0217056619965,0.0211969009932,
+  0.0201913042834,0.0187124431651,0.0167949831344,0.0144838734484,
+  0.0118333009748,0.00890545423129,0.0057693052074,0.00250288188398,
+  0.00231956461779,0.0053467470095,0.00825319671394,0.0109666007127,
+  0.0134230386957,0.0155648769862,0.0173418974966,0.0187124431651,
+  0.019644387482,0.0201158855697,0.0201158855697,0.019644387482,
+  0.0187124431651,0.0173418974966,0.0155648769862,0.0134230386957,
+  0.0109666007127,0.00825319671394,0.0053467470095,0.00231956461779,
+  0.00208187932978,0.00479886699222,0.00740749341992,0.00984285549394,
+  0.0120475828046,0.0139699473856,0.0155648769862,0.0167949831344,
+  0.0176314313174,0.0180546150975,0.0180546150975,0.0176314313174,
+  0.0167949831344,0.0155648769862,0.0139699473856,0.0120475828046,
+  0.00984285549394,0.00740749341992,0.00479886699222,0.00208187932978,
+  0.00179539785815,0.00413850860431,0.00638816939589,0.0084884082469,
+  0.010389749326,0.0120475828046,0.0134230386957,0.0144838734484,
+  0.0152052203846,0.0155701710527,0.0155701710527,0.0152052203846,
+  0.0144838734484,0.0134230386957,0.0120475828046,0.010389749326,
+  0.0084884082469,0.00638816939589,0.00413850860431,0.00179539785815,
+  0.00146683712066,0.00338115477713,0.0052191239732,0.00693501568763,
+  0.0084884082469,0.00984285549394,0.0109666007127,0.0118333009748,
+  0.0124226402447,0.0127208043451,0.0127208043451,0.0124226402447,
+  0.0118333009748,0.0109666007127,0.00984285549394,0.0084884082469,
+  0.00693501568763,0.0052191239732,0.00338115477713,0.00146683712066,
+  0.00110390590678,0.00254457477088,0.00392778564239,0.0052191239732,
+  0.00638816939589,0.00740749341992,0.00825319671394,0.00890545423129,
+  0.00934897661835,0.00957336766146,0.00957336766146,0.00934897661835,
+  0.00890545423129,0.00825319671394,0.00740749341992,0.00638816939589,
+  0.0052191239732,0.00392778564239,0.00254457477088,0.00110390590678,
+  0.000715153874364,0.00164847610184,0.00254457477088,0.00338115477713,
+  0.00413850860431,0.00479886699222,0.0053467470095,0.0057693052074,
+  0.00605663653838,0.00620200592436,0.00620200592436,0.00605663653838,
+  0.0057693052074,0.0053467470095,0.00479886699222,0.00413850860431,
+  0.00338115477713,0.00254457477088,0.00164847610184,0.000715153874364,
+  0.000310253247498,0.000715153874364,0.00110390590678,0.00146683712066,
+  0.00179539785815,0.00208187932978,0.00231956461779,0.00250288188398,
+  0.0026275340487,0.00269059925145,0.00269059925145,0.0026275340487,
+  0.00250288188398,0.00231956461779,0.00208187932978,0.00179539785815,
+  0.00146683712066,0.00110390590678,0.000715153874364,0.000310253247498
+};
+
+static const cubature_table cubature_quad_tables[]={
+  {1,1,cubature_quad_1_locs,cubature_quad_1_weights},
+  {2,4,cubature_quad_2_locs,cubature_quad_2_weights},
+  {3,9,cubature_quad_3_locs,cubature_quad_3_weights},
+  {4,16,cubature_quad_4_locs,cubature_quad_4_weights},
+  {5,25,cubature_quad_5_locs,cubature_quad_5_weights},
+  {6,36,cubature_quad_6_locs,cubature_quad_6_weights},
+  {7,49,cubature_quad_7_locs,cubature_quad_7_weights},
+  {8,64,cubature_quad_8_locs,cubature_quad_8_weights},
+  {9,81,cubature_quad_9_locs,cubature_quad_9_weights},
+  {10,100,cubature_quad_10_locs,cubature_quad_10_weights},
+  {11,121,cubature_quad_11_locs,cubature_quad_11_weights},
+  {12,144,cubature_quad_12_locs,cubature_quad_12_weights},
+  {13,169,cubature_quad_13_locs,cubature_quad_13_weights},
+  {14,196,cubature_quad_14_locs,cubature_quad_14_weights},
+  {15,225,cubature_quad_15_locs,cubature_quad_15_weights},
+  {16,256,cubature_quad_16_locs,cubature_quad_16_weights},
+  {17,289,cubature_quad_17_locs,cubature_quad_17_weights},
+  {18,324,cubature_quad_18_locs,cubature_quad_18_weights},
+  {19,361,cubature_quad_19_locs,cubature_quad_19_weights},
+  {20,400,cubature_quad_20_locs,cubature_quad_20_weights}
+};
+
+// cubature_tet.dat
+
+static const double cubature_tet_2_locs[]={
+  -0.7236067977499790,-0.7236067977499790,0.1708203932499369,-0.7236067977499790,
+  -0.7236067977499790,0.1708203932499370,-0.7236067977499790,-0.7236067977499790,
+  0.1708203932499370,-0.7236067977499790,-0.7236067977499790,-0.7236067977499790
+};
+static const double cubature_tet_2_weights[]={
+  0.333333333333,0.333333333333,0.333333333333,0.333333333333
+};
+static const double cubature_tet_3_locs[]={
+  -0.3438906065771466,-0.9683281802685602,-0.3438906065771466,-0.3438906065771466,
+  -0.7860954521341387,-0.7860954521341387,0.3582863564024159,-0.7860954521341387,
+  -0.3438906065771466,-0.3438906065771466,-0.9683281802685602,-0.3438906065771466,
+  -0.7860954521341387,0.3582863564024160,-0.7860954521341387,-0.7860954521341387,
+  -0.3438906065771466,-0.3438906065771466,-0.3438906065771466,-0.9683281802685602,
+  0.3582863564024159,-0.7860954521341386,-0.7860954521341387,-0.7860954521341387
+};
+static const double cubature_tet_3_weights[]={
+  0.184703955349,0.184703955349,0.184703955349,0.184703955349,
+  0.148629377984,0.148629377984,0.148629377984,0.148629377984
+};
+static const double cubature_tet_4_locs[]={
+  -0.8145294993782176,-0.8145294993782176,0.4435884981346526,-0.8145294993782176,
+  -0.3782281614733988,-0.8653155155798036,-0.3782281614733988,-0.3782281614733988,
+  -0.9089925917487007,-0.0910074082512993,-0.0910074082512993,-0.9089925917487007,
+  -0.9089925917487007,-0.0910074082512993,-0.8145294993782176,0.4435884981346526,
+  -0.8145294993782176,-0.8145294993782176,-0.3782281614733988,-0.3782281614733988,
+  -0.8653155155798036,-0.3782281614733988,-0.0910074082512993,-0.9089925917487007,
+  -0.0910074082512993,-0.9089925917487007,-0.0910074082512993,-0.9089925917487007,
+  0.4435884981346527,-0.8145294993782176,-0.8145294993782176,-0.8145294993782176,
+  -0.3782281614733988,-0.3782281614733988,-0.3782281614733988,-0.8653155155798036,
+  -0.0910074082512993,-0.0910074082512993,-0.9089925917487007,-0.0910074082512993,
+  -0.9089925917487007,-0.9089925917487007
+};
+static const double cubature_tet_4_weights[]={
+  0.0979907241551,0.0979907241551,0.0979907241551,0.0979907241551,
+  0.150250567624,0.150250567624,0.150250567624,0.150250567624,
+  0.0567280277028,0.0567280277028,0.0567280277028,0.0567280277028,
+  0.0567280277028,0.0567280277028
+};
+static const double cubature_tet_5_locs[]={
+  -0.3782281614733988,-0.8653155155798036,-0.3782281614733988,-0.3782281614733988,
+  -0.8145294993782176,-0.8145294993782176,0.4435884981346526,-0.8145294993782176,
+  -0.9089925917487007,-0.0910074082512993,-0.0910074082512993,-0.9089925917487007,
+  -0.9089925917487007,-0.0910074082512993,-0.3782281614733988,-0.3782281614733988,
+  -0.8653155155798036,-0.3782281614733988,-0.8145294993782176,0.4435884981346526,
+  -0.8145294993782176,-0.8145294993782176,-0.0910074082512993,-0.9089925917487007,
+  -0.0910074082512993,-0.9089925917487007,-0.0910074082512993,-0.9089925917487007,
+  -0.3782281614733988,-0.3782281614733988,-0.3782281614733988,-0.8653155155798036,
+  0.4435884981346527,-0.8145294993782176,-0.8145294993782176,-0.8145294993782176,
+  -0.0910074082512993,-0.0910074082512993,-0.9089925917487007,-0.0910074082512993,
+  -0.9089925917487007,-0.9089925917487007
+};
+static const double cubature_tet_5_weights[]={
+  0.150250567624,0.150250567624,0.150250567624,0.150250567624,
+  0.0979907241551,0.0979907241551,0.0979907241551,0.0979907241551,
+  0.0567280277028,0.0567280277028,0.0567280277028,0.0567280277028,
+  0.0567280277028,0.0567280277028
+};
+static const double cubature_tet_6_locs[]={
+  -0.5707942574816959,-0.5707942574816959,-0.2876172275549123,-0.5707942574816959,
+  -0.9186520829307773,-0.9186520829307773,0.7559562487923320,-0.9186520829307773,
+  -0.3553242197154491,-0.9340273408536528,-0.3553242197154491,-0.3553242197154491,
+  -0.8726779962499649,-0.8726779962499649,-0.4606553370833685,-0.4606553370833686,
+  0.2060113295832984,0.2060113295832984,-0.8726779962499649,-0.8726779962499649,
+  0.2060113295832984,-0.8726779962499649,-0.8726779962499649,-0.4606553370833686,
+  -0.5707942574816959,-0.2876172275549123,-0.5707942574816959,-0.5707942574816959,
+  -0.9186520829307773,0.7559562487923319,-0.9186520829307773,-0.9186520829307773,
+  -0.3553242197154491,-0.3553242197154491,-0.9340273408536528,-0.3553242197154491,
+  -0.4606553370833685,0.2060113295832984,-0.8726779962499649,0.2060113295832984,
+  -0.8726779962499649,-0.4606553370833686,-0.8726779962499649,0.2060113295832984,
+  -0.8726779962499649,-0.8726779962499649,-0.4606553370833686,-0.8726779962499649,
+  -0.2876172275549123,-0.5707942574816959,-0.5707942574816959,-0.5707942574816959,
+  0.7559562487923319,-0.9186520829307774,-0.9186520829307773,-0.9186520829307773,
+  -0.3553242197154491,-0.3553242197154491,-0.3553242197154491,-0.9340273408536528,
+  0.2060113295832984,-0.4606553370833685,0.2060113295832984,-0.8726779962499649,
+  -0.4606553370833686,-0.8726779962499649,0.2060113295832984,-0.8726779962499649,
+  -0.8726779962499649,-0.4606553370833686,-0.8726779962499649,-0.8726779962499649
+};
+static const double cubature_tet_6_weights[]={
+  0.0532303336776,0.0532303336776,0.0532303336776,0.0532303336776,
+  0.0134362814071,0.0134362814071,0.0134362814071,0.0134362814071,
+  0.0738095753915,0.0738095753915,0.0738095753915,0.0738095753915,
+  0.0642857142857,0.0642857142857,0.0642857142857,0.0642857142857,
+  0.0642857142857,0.0642857142857,0.0642857142857,0.0642857142857,
+  0.0642857142857,0.0642857142857,0.0642857142857,0.0642857142857
+};
+static const double cubature_tet_7_locs[]={
+  -0.5000000000000000,-0.3685977004435944,-0.8942068986692169,-0.3685977004435944,
+  -0.3685977004435944,-0.8990203548032073,-0.1009796451967927,-0.1009796451967927,
+  -0.8990203548032073,-0.8990203548032073,-0.1009796451967927,-0.6223323379479979,
+  -0.6223323379479979,0.1503432751740001,-0.9056785992780043,-0.9056785992780043,
+  -0.6223323379479979,-0.6223323379479979,0.1503432751740001,0.1503432751740001,
+  -0.9056785992780043,-0.6223323379479979,-0.6223323379479979,-0.9574690549170335,
+  -0.9574690549170335,-0.7067223723630300,-0.7067223723630300,0.6216604821970970,
+  0.6216604821970970,-0.9574690549170335,-0.9574690549170335,0.6216604821970970,
+  -0.9574690549170335,-0.9574690549170335,-0.7067223723630300,-0.5000000000000000,
+  -0.3685977004435944,-0.3685977004435944,-0.8942068986692169,-0.3685977004435944,
+  -0.1009796451967928,-0.8990203548032073,-0.1009796451967927,-0.8990203548032073,
+  -0.1009796451967927,-0.8990203548032073,-0.6223323379479979,0.1503432751740001,
+  -0.6223323379479979,-0.6223323379479979,0.1503432751740001,-0.9056785992780043,
+  0.1503432751740001,-0.9056785992780043,-0.6223323379479979,-0.6223323379479979,
+  -0.9056785992780043,-0.6223323379479979,-0.7067223723630300,0.6216604821970970,
+  -0.9574690549170335,0.6216604821970970,-0.9574690549170335,-0.7067223723630300,
+  -0.9574690549170335,0.6216604821970970,-0.9574690549170335,-0.9574690549170335,
+  -0.7067223723630300,-0.9574690549170335,-0.5000000000000000,-0.3685977004435944,
+  -0.3685977004435944,-0.3685977004435944,-0.8942068986692169,-0.1009796451967928,
+  -0.1009796451967928,-0.8990203548032073,-0.1009796451967928,-0.8990203548032073,
+  -0.8990203548032073,0.1503432751740001,-0.6223323379479979,-0.6223323379479979,
+  0.1503432751740001,-0.6223323379479979,0.1503432751740001,-0.9056785992780043,
+  -0.6223323379479979,-0.9056785992780043,-0.6223323379479979,-0.6223323379479979,
+  -0.9056785992780043,0.6216604821970970,-0.7067223723630300,0.6216604821970970,
+  -0.9574690549170335,-0.7067223723630300,-0.9574690549170335,0.6216604821970970,
+  -0.9574690549170335,-0.9574690549170335,-0.7067223723630300,-0.9574690549170335,
+  -0.9574690549170335
+};
+static const double cubature_tet_7_weights[]={
+  0.127313719286,0.0564394416133,0.0564394416133,0.0564394416133,
+  0.0564394416133,0.0425292371105,0.0425292371105,0.0425292371105,
+  0.0425292371105,0.0425292371105,0.0425292371105,0.0496095076378,
+  0.0496095076378,0.0496095076378,0.0496095076378,0.0496095076378,
+  0.0496095076378,0.0496095076378,0.0496095076378,0.0496095076378,
+  0.0496095076378,0.0496095076378,0.0496095076378,0.0108143611065,
+  0.0108143611065,0.0108143611065,0.0108143611065,0.0108143611065,
+  0.0108143611065,0.0108143611065,0.0108143611065,0.0108143611065,
+  0.0108143611065,0.0108143611065,0.0108143611065
+};
+static const double cubature_tet_8_locs[]={
+  -0.9206491538592203,-0.9206491538592203,0.7619474615776605,-0.9206491538592203,
+  -0.3710243986038074,-0.8869268041885778,-0.3710243986038074,-0.3710243986038074,
+  -0.7960266138745935,-0.7960266138745935,0.3880798416237802,-0.7960266138745935,
+  -0.6315926061016169,-0.6315926061016169,-0.1052221816951490,-0.6315926061016169,
+  -0.8731274244909202,-0.1268725755090798,-0.1268725755090798,-0.8731274244909202,
+  -0.8731274244909202,-0.1268725755090798,-0.9566196758645440,-0.9566196758645440,
+  -0.5266244923498440,-0.5266244923498440,0.4398638440789320,0.4398638440789320,
+  -0.9566196758645440,-0.9566196758645440,0.4398638440789320,-0.9566196758645440,
+  -0.9566196758645440,-0.5266244923498440,-0.5910398387264086,-0.5910398387264086,
+  0.1611543802576185,-0.9790747028048012,-0.9790747028048012,-0.5910398387264086,
+  -0.5910398387264086,0.1611543802576185,0.1611543802576185,-0.9790747028048012,
+  -0.5910398387264086,-0.5910398387264086,-0.9206491538592203,0.7619474615776607,
+  -0.9206491538592203,-0.9206491538592203,-0.3710243986038074,-0.3710243986038074,
+  -0.8869268041885778,-0.3710243986038074,-0.7960266138745935,0.3880798416237802,
+  -0.7960266138745935,-0.7960266138745935,-0.6315926061016169,-0.1052221816951490,
+  -0.6315926061016169,-0.6315926061016169,-0.1268725755090798,-0.8731274244909202,
+  -0.1268725755090798,-0.8731274244909202,-0.1268725755090798,-0.8731274244909202,
+  -0.5266244923498440,0.4398638440789320,-0.9566196758645440,0.4398638440789320,
+  -0.9566196758645440,-0.5266244923498440,-0.9566196758645440,0.4398638440789320,
+  -0.9566196758645440,-0.9566196758645440,-0.5266244923498440,-0.9566196758645440,
+  -0.5910398387264086,0.1611543802576185,-0.5910398387264086,-0.5910398387264086,
+  0.1611543802576185,-0.9790747028048012,0.1611543802576185,-0.9790747028048012,
+  -0.5910398387264086,-0.5910398387264086,-0.9790747028048012,-0.5910398387264086,
+  0.7619474615776607,-0.9206491538592203,-0.9206491538592203,-0.9206491538592203,
+  -0.3710243986038074,-0.3710243986038074,-0.3710243986038074,-0.8869268041885778,
+  0.3880798416237802,-0.7960266138745935,-0.7960266138745935,-0.7960266138745935,
+  -0.1052221816951491,-0.6315926061016169,-0.6315926061016169,-0.6315926061016169,
+  -0.1268725755090798,-0.1268725755090798,-0.8731274244909202,-0.1268725755090798,
+  -0.8731274244909202,-0.8731274244909202,0.4398638440789320,-0.5266244923498440,
+  0.4398638440789320,-0.9566196758645440,-0.5266244923498440,-0.9566196758645440,
+  0.4398638440789320,-0.9566196758645440,-0.9566196758645440,-0.5266244923498440,
+  -0.9566196758645440,-0.9566196758645440,0.1611543802576185,-0.5910398387264086,
+  -0.5910398387264086,0.1611543802576185,-0.5910398387264086,0.1611543802576185,
+  -0.9790747028048012,-0.5910398387264086,-0.9790747028048012,-0.5910398387264086,
+  -0.5910398387264086,-0.9790747028048012
+};
+static const double cubature_tet_8_weights[]={
+  0.0085295303732,0.0085295303732,0.0085295303732,0.0085295303732,
+  0.053587264028,0.053587264028,0.053587264028,0.053587264028,
+  0.0324106340064,0.0324106340064,0.0324106340064,0.0324106340064,
+  0.0731451898849,0.0731451898849,0.0731451898849,0.0731451898849,
+  0.0476261496455,0.0476261496455,0.0476261496455,0.0476261496455,
+  0.0476261496455,0.0476261496455,0.00957758759714,0.00957758759714,
+  0.00957758759714,0.00957758759714,0.00957758759714,0.00957758759714,
+  0.00957758759714,0.00957758759714,0.00957758759714,0.00957758759714,
+  0.00957758759714,0.00957758759714,0.0218295759271,0.0218295759271,
+  0.0218295759271,0.0218295759271,0.0218295759271,0.0218295759271,
+  0.0218295759271,0.0218295759271,0.0218295759271,0.0218295759271,
+  0.0218295759271,0.0218295759271
+};
+static const double cubature_tet_9_locs[]={
+  -0.5000000000000000,-0.9319556459979103,-0.9319556459979103,0.7958669379937310,
+  -0.9319556459979103,-0.3544593329323990,-0.9366220012028030,-0.3544593329323990,
+  -0.3544593329323990,-0.8790858451484501,-0.8790858451484501,0.6372575354453506,
+  -0.8790858451484501,-0.8328183185194933,-0.0892740181055836,-0.0892740181055836,
+  -0.9886336452693396,-0.0892740181055836,-0.0892740181055835,-0.9886336452693396,
+  -0.9886336452693396,-0.8328183185194933,-0.8328183185194933,-0.0892740181055836,
+  -0.0892740181055836,-0.7609954892123484,-0.7609954892123484,-0.4042426865322831,
+  -0.4042426865322831,-0.0737663350430201,-0.0737663350430201,-0.7609954892123484,
+  -0.7609954892123485,-0.0737663350430201,-0.7609954892123484,-0.7609954892123485,
+  -0.4042426865322831,-0.9439560884331977,-0.9439560884331977,-0.5624999768133396,
+  -0.5624999768133396,0.4504121536797350,0.4504121536797350,-0.9439560884331977,
+  -0.9439560884331977,0.4504121536797350,-0.9439560884331977,-0.9439560884331977,
+  -0.5624999768133396,-0.6503339359768507,-0.6503339359768507,0.2333651435625128,
+  -0.9326972716088113,-0.9326972716088113,-0.6503339359768507,-0.6503339359768507,
+  0.2333651435625128,0.2333651435625128,-0.9326972716088113,-0.6503339359768507,
+  -0.6503339359768507,-0.5000000000000000,-0.9319556459979103,0.7958669379937309,
+  -0.9319556459979103,-0.9319556459979103,-0.3544593329323990,-0.3544593329323990,
+  -0.9366220012028030,-0.3544593329323990,-0.8790858451484501,0.6372575354453505,
+  -0.8790858451484501,-0.8790858451484501,-0.0892740181055836,-0.8328183185194933,
+  -0.0892740181055836,-0.0892740181055836,-0.9886336452693396,-0.0892740181055835,
+  -0.8328183185194933,-0.0892740181055836,-0.9886336452693396,-0.0892740181055835,
+  -0.9886336452693396,-0.8328183185194933,-0.4042426865322831,-0.0737663350430201,
+  -0.7609954892123484,-0.0737663350430201,-0.7609954892123484,-0.4042426865322831,
+  -0.7609954892123484,-0.0737663350430201,-0.7609954892123485,-0.7609954892123484,
+  -0.4042426865322831,-0.7609954892123485,-0.5624999768133396,0.4504121536797350,
+  -0.9439560884331977,0.4504121536797350,-0.9439560884331977,-0.5624999768133396,
+  -0.9439560884331977,0.4504121536797350,-0.9439560884331977,-0.9439560884331977,
+  -0.5624999768133396,-0.9439560884331977,-0.6503339359768507,0.2333651435625128,
+  -0.6503339359768507,-0.6503339359768507,0.2333651435625128,-0.9326972716088113,
+  0.2333651435625128,-0.9326972716088113,-0.6503339359768507,-0.6503339359768507,
+  -0.9326972716088113,-0.6503339359768507,-0.5000000000000000,0.7958669379937309,
+  -0.9319556459979104,-0.9319556459979103,-0.9319556459979103,-0.3544593329323990,
+  -0.3544593329323990,-0.3544593329323990,-0.9366220012028030,0.6372575354453505,
+  -0.8790858451484502,-0.8790858451484501,-0.8790858451484501,-0.0892740181055836,
+  -0.0892740181055836,-0.8328183185194933,-0.0892740181055836,-0.0892740181055836,
+  -0.9886336452693396,-0.0892740181055836,-0.8328183185194933,-0.0892740181055836,
+  -0.9886336452693396,-0.8328183185194933,-0.9886336452693396,-0.0737663350430200,
+  -0.4042426865322831,-0.0737663350430200,-0.7609954892123483,-0.4042426865322831,
+  -0.7609954892123483,-0.0737663350430200,-0.7609954892123483,-0.7609954892123483,
+  -0.4042426865322831,-0.7609954892123483,-0.7609954892123483,0.4504121536797350,
+  -0.5624999768133396,0.4504121536797350,-0.9439560884331977,-0.5624999768133396,
+  -0.9439560884331977,0.4504121536797350,-0.9439560884331977,-0.9439560884331977,
+  -0.5624999768133396,-0.9439560884331977,-0.9439560884331977,0.2333651435625128,
+  -0.6503339359768507,-0.6503339359768507,0.2333651435625128,-0.6503339359768507,
+  0.2333651435625128,-0.9326972716088113,-0.6503339359768507,-0.9326972716088113,
+  -0.6503339359768507,-0.6503339359768507,-0.9326972716088113
+};
+static const double cubature_tet_9_weights[]={
+  0.075235590906,0.00445479343295,0.00445479343295,0.00445479343295,
+  0.00445479343295,0.040151673025,0.040151673025,0.040151673025,
+  0.040151673025,0.00865461456008,0.00865461456008,0.00865461456008,
+  0.00865461456008,0.0130790478243,0.0130790478243,0.0130790478243,
+  0.0130790478243,0.0130790478243,0.0130790478243,0.0130790478243,
+  0.0130790478243,0.0130790478243,0.0130790478243,0.0130790478243,
+  0.0130790478243,0.0374922050978,0.0374922050978,0.0374922050978,
+  0.0374922050978,0.0374922050978,0.0374922050978,0.0374922050978,
+  0.0374922050978,0.0374922050978,0.0374922050978,0.0374922050978,
+  0.0374922050978,0.0105261158778,0.0105261158778,0.0105261158778,
+  0.0105261158778,0.0105261158778,0.0105261158778,0.0105261158778,
+  0.0105261158778,0.0105261158778,0.0105261158778,0.0105261158778,
+  0.0105261158778,0.025990416063,0.025990416063,0.025990416063,
+  0.025990416063,0.025990416063,0.025990416063,0.025990416063,
+  0.025990416063,0.025990416063,0.025990416063,0.025990416063,
+  0.025990416063
+};
+static const double cubature_tet_10_locs[]={
+  -0.5000000000000000,-0.3754998626096227,-0.8735004121711318,-0.3754998626096227,
+  -0.3754998626096227,-0.7713806922853077,-0.7713806922853077,0.3141420768559231,
+  -0.7713806922853077,-0.9877239823504185,-0.9877239823504185,-0.9105295699895728,
+  -0.9105295699895728,0.8859775346904097,0.8859775346904097,-0.9877239823504185,
+  -0.9877239823504185,0.8859775346904097,-0.9877239823504185,-0.9877239823504185,
+  -0.9105295699895728,-0.9344410635671148,-0.9344410635671148,-0.3196304118257848,
+  -0.3196304118257848,0.1885125389600142,0.1885125389600142,-0.9344410635671148,
+  -0.9344410635671146,0.1885125389600141,-0.9344410635671148,-0.9344410635671148,
+  -0.3196304118257848,-0.6690279487607780,-0.1791385215620690,-0.1791385215620690,
+  -0.9726950081150840,-0.1791385215620690,-0.1791385215620690,-0.9726950081150840,
+  -0.9726950081150841,-0.6690279487607780,-0.6690279487607780,-0.1791385215620690,
+  -0.1791385215620690,-0.9350294368703539,-0.9350294368703539,-0.7322956955759810,
+  -0.7322956955759808,0.6023545693166888,0.6023545693166888,-0.9350294368703539,
+  -0.9350294368703539,0.6023545693166888,-0.9350294368703539,-0.9350294368703539,
+  -0.7322956955759808,-0.7578996377088212,-0.7578996377088212,-0.4385814843909184,
+  -0.4385814843909184,-0.0456192401914393,-0.0456192401914393,-0.7578996377088212,
+  -0.7578996377088212,-0.0456192401914393,-0.7578996377088212,-0.7578996377088212,
+  -0.4385814843909184,-0.6500413156321220,-0.6500413156321220,0.2561436909507320,
+  -0.9560610596864880,-0.9560610596864880,-0.6500413156321220,-0.6500413156321220,
+  0.2561436909507320,0.2561436909507320,-0.9560610596864880,-0.6500413156321220,
+  -0.6500413156321220,-0.5000000000000000,-0.3754998626096227,-0.3754998626096227,
+  -0.8735004121711318,-0.3754998626096227,-0.7713806922853077,0.3141420768559231,
+  -0.7713806922853077,-0.7713806922853077,-0.9105295699895728,0.8859775346904097,
+  -0.9877239823504185,0.8859775346904097,-0.9877239823504185,-0.9105295699895728,
+  -0.9877239823504185,0.8859775346904097,-0.9877239823504185,-0.9877239823504185,
+  -0.9105295699895728,-0.9877239823504185,-0.3196304118257848,0.1885125389600141,
+  -0.9344410635671148,0.1885125389600141,-0.9344410635671148,-0.3196304118257848,
+  -0.9344410635671148,0.1885125389600141,-0.9344410635671148,-0.9344410635671148,
+  -0.3196304118257848,-0.9344410635671148,-0.1791385215620690,-0.6690279487607780,
+  -0.1791385215620690,-0.1791385215620690,-0.9726950081150840,-0.1791385215620690,
+  -0.6690279487607780,-0.1791385215620690,-0.9726950081150840,-0.1791385215620690,
+  -0.9726950081150840,-0.6690279487607780,-0.7322956955759810,0.6023545693166887,
+  -0.9350294368703539,0.6023545693166888,-0.9350294368703539,-0.7322956955759808,
+  -0.9350294368703539,0.6023545693166888,-0.9350294368703539,-0.9350294368703539,
+  -0.7322956955759808,-0.9350294368703539,-0.4385814843909184,-0.0456192401914393,
+  -0.7578996377088212,-0.0456192401914393,-0.7578996377088212,-0.4385814843909184,
+  -0.7578996377088212,-0.0456192401914393,-0.7578996377088212,-0.7578996377088212,
+  -0.4385814843909184,-0.7578996377088212,-0.6500413156321220,0.2561436909507320,
+  -0.6500413156321220,-0.6500413156321220,0.2561436909507320,-0.9560610596864880,
+  0.2561436909507320,-0.9560610596864880,-0.6500413156321220,-0.6500413156321220,
+  -0.9560610596864880,-0.6500413156321220,-0.5000000000000000,-0.3754998626096227,
+  -0.3754998626096227,-0.3754998626096227,-0.8735004121711318,0.3141420768559231,
+  -0.7713806922853077,-0.7713806922853077,-0.7713806922853077,0.8859775346904097,
+  -0.9105295699895728,0.8859775346904097,-0.9877239823504185,-0.9105295699895728,
+  -0.9877239823504185,0.8859775346904097,-0.9877239823504185,-0.9877239823504185,
+  -0.9105295699895728,-0.9877239823504185,-0.9877239823504185,0.1885125389600141,
+  -0.3196304118257848,0.1885125389600141,-0.9344410635671148,-0.3196304118257847,
+  -0.9344410635671148,0.1885125389600141,-0.9344410635671148,-0.9344410635671148,
+  -0.3196304118257847,-0.9344410635671148,-0.9344410635671148,-0.1791385215620691,
+  -0.1791385215620689,-0.6690279487607779,-0.1791385215620691,-0.1791385215620691,
+  -0.9726950081150840,-0.1791385215620689,-0.6690279487607779,-0.1791385215620691,
+  -0.9726950081150840,-0.6690279487607780,-0.9726950081150840,0.6023545693166887,
+  -0.7322956955759810,0.6023545693166887,-0.9350294368703539,-0.7322956955759808,
+  -0.9350294368703539,0.6023545693166887,-0.9350294368703539,-0.9350294368703539,
+  -0.7322956955759808,-0.9350294368703539,-0.9350294368703539,-0.0456192401914393,
+  -0.4385814843909184,-0.0456192401914393,-0.7578996377088212,-0.4385814843909184,
+  -0.7578996377088212,-0.0456192401914393,-0.7578996377088212,-0.7578996377088212,
+  -0.4385814843909184,-0.7578996377088212,-0.7578996377088212,0.2561436909507320,
+  -0.6500413156321221,-0.6500413156321221,0.2561436909507320,-0.6500413156321221,
+  0.2561436909507320,-0.9560610596864880,-0.6500413156321219,-0.9560610596864879,
+  -0.6500413156321221,-0.6500413156321219,-0.9560610596864879
+};
+static const double cubature_tet_10_weights[]={
+  0.0631996980747,0.0359160799897,0.0359160799897,0.0359160799897,
+  0.0359160799897,0.0131588796224,0.0131588796224,0.0131588796224,
+  0.0131588796224,0.000482592459119,0.000482592459119,0.000482592459119,
+  0.000482592459119,0.000482592459119,0.000482592459119,0.000482592459119,
+  0.000482592459119,0.000482592459119,0.000482592459119,0.000482592459119,
+  0.000482592459119,0.013514495573,0.013514495573,0.013514495573,
+  0.013514495573,0.013514495573,0.013514495573,0.013514495573,
+  0.013514495573,0.013514495573,0.013514495573,0.013514495573,
+  0.013514495573,0.0151918416269,0.0151918416269,0.0151918416269,
+  0.0151918416269,0.0151918416269,0.0151918416269,0.0151918416269,
+  0.0151918416269,0.0151918416269,0.0151918416269,0.0151918416269,
+  0.0151918416269,0.00876819636938,0.00876819636938,0.00876819636938,
+  0.00876819636938,0.00876819636938,0.00876819636938,0.00876819636938,
+  0.00876819636938,0.00876819636938,0.00876819636938,0.00876819636938,
+  0.00876819636938,0.0343196426406,0.0343196426406,0.0343196426406,
+  0.0343196426406,0.0343196426406,0.0343196426406,0.0343196426406,
+  0.0343196426406,0.0343196426406,0.0343196426406,0.0343196426406,
+  0.0343196426406,0.0172093810651,0.0172093810651,0.0172093810651,
+  0.0172093810651,0.0172093810651,0.0172093810651,0.0172093810651,
+  0.0172093810651,0.0172093810651,0.0172093810651,0.0172093810651,
+  0.0172093810651
+};
+static const double cubature_tet_11_locs[]={
+  -0.5000000000000000,-0.7570172644469324,-0.7570172644469324,0.2710517933407972,
+  -0.7570172644469324,-0.9353674816978542,-0.9353674816978542,0.8061024450935624,
+  -0.9353674816978542,-0.3501477004227864,-0.9495568987316407,-0.3501477004227864,
+  -0.3501477004227864,-0.9917032860566800,-0.9917032860566800,-0.2131254214670126,
+  -0.2131254214670127,0.1965319935803725,0.1965319935803726,-0.9917032860566800,
+  -0.9917032860566801,0.1965319935803726,-0.9917032860566800,-0.9917032860566800,
+  -0.2131254214670127,-0.5507507786472456,-0.5507507786472456,-0.0526754243353008,
+  -0.8458230183702078,-0.8458230183702079,-0.5507507786472456,-0.5507507786472456,
+  -0.0526754243353008,-0.0526754243353008,-0.8458230183702079,-0.5507507786472456,
+  -0.5507507786472456,-0.8961898244548686,-0.8961898244548686,-0.3339099069068225,
+  -0.3339099069068225,0.1262895558165597,0.1262895558165597,-0.8961898244548686,
+  -0.8961898244548687,0.1262895558165598,-0.8961898244548686,-0.8961898244548685,
+  -0.3339099069068225,-0.7301397375675196,-0.7301397375675196,0.4167176615716379,
+  -0.9564381864365987,-0.9564381864365987,-0.7301397375675196,-0.7301397375675196,
+  0.4167176615716379,0.4167176615716379,-0.9564381864365987,-0.7301397375675196,
+  -0.7301397375675196,-0.9496176157834950,-0.9496176157834950,-0.6682037831131646,
+  -0.6682037831131646,0.5674390146801547,0.5674390146801547,-0.9496176157834950,
+  -0.9496176157834950,0.5674390146801547,-0.9496176157834950,-0.9496176157834950,
+  -0.6682037831131646,-0.7304829357606660,-0.2693624404365328,-0.2693624404365328,
+  -0.7307921833662684,-0.2693624404365328,-0.2693624404365328,-0.7307921833662684,
+  -0.7307921833662683,-0.7304829357606660,-0.7304829357606659,-0.2693624404365328,
+  -0.2693624404365328,-0.7184927389126081,-0.7184927389126081,-0.3468472165001741,
+  -0.3468472165001741,0.0458150790198770,0.0458150790198771,-0.9804751236070948,
+  -0.9804751236070948,-0.3468472165001741,-0.3468472165001741,0.0458150790198770,
+  0.0458150790198770,-0.9804751236070948,-0.9804751236070948,-0.7184927389126081,
+  -0.7184927389126081,0.0458150790198771,0.0458150790198771,-0.9804751236070948,
+  -0.9804751236070948,-0.7184927389126081,-0.7184927389126081,-0.3468472165001741,
+  -0.3468472165001741,-0.5000000000000000,-0.7570172644469324,0.2710517933407972,
+  -0.7570172644469324,-0.7570172644469324,-0.9353674816978542,0.8061024450935625,
+  -0.9353674816978542,-0.9353674816978542,-0.3501477004227864,-0.3501477004227864,
+  -0.9495568987316407,-0.3501477004227864,-0.2131254214670127,0.1965319935803727,
+  -0.9917032860566800,0.1965319935803726,-0.9917032860566800,-0.2131254214670127,
+  -0.9917032860566800,0.1965319935803726,-0.9917032860566800,-0.9917032860566800,
+  -0.2131254214670127,-0.9917032860566800,-0.5507507786472456,-0.0526754243353007,
+  -0.5507507786472456,-0.5507507786472456,-0.0526754243353007,-0.8458230183702078,
+  -0.0526754243353008,-0.8458230183702078,-0.5507507786472456,-0.5507507786472456,
+  -0.8458230183702078,-0.5507507786472456,-0.3339099069068225,0.1262895558165598,
+  -0.8961898244548686,0.1262895558165598,-0.8961898244548686,-0.3339099069068226,
+  -0.8961898244548686,0.1262895558165598,-0.8961898244548687,-0.8961898244548686,
+  -0.3339099069068226,-0.8961898244548687,-0.7301397375675196,0.4167176615716379,
+  -0.7301397375675196,-0.7301397375675196,0.4167176615716379,-0.9564381864365987,
+  0.4167176615716379,-0.9564381864365987,-0.7301397375675196,-0.7301397375675196,
+  -0.9564381864365987,-0.7301397375675196,-0.6682037831131646,0.5674390146801547,
+  -0.9496176157834950,0.5674390146801547,-0.9496176157834950,-0.6682037831131646,
+  -0.9496176157834950,0.5674390146801547,-0.9496176157834950,-0.9496176157834950,
+  -0.6682037831131646,-0.9496176157834950,-0.2693624404365328,-0.7304829357606660,
+  -0.2693624404365328,-0.2693624404365328,-0.7307921833662684,-0.2693624404365328,
+  -0.7304829357606660,-0.2693624404365328,-0.7307921833662684,-0.2693624404365328,
+  -0.7307921833662683,-0.7304829357606659,-0.3468472165001741,0.0458150790198770,
+  -0.7184927389126081,0.0458150790198771,-0.7184927389126081,-0.3468472165001741,
+  -0.3468472165001741,0.0458150790198770,-0.9804751236070948,0.0458150790198770,
+  -0.9804751236070948,-0.3468472165001741,-0.7184927389126081,0.0458150790198771,
+  -0.9804751236070948,0.0458150790198770,-0.9804751236070948,-0.7184927389126081,
+  -0.7184927389126081,-0.3468472165001741,-0.9804751236070948,-0.3468472165001741,
+  -0.9804751236070948,-0.7184927389126081,-0.5000000000000000,0.2710517933407972,
+  -0.7570172644469324,-0.7570172644469324,-0.7570172644469324,0.8061024450935625,
+  -0.9353674816978541,-0.9353674816978542,-0.9353674816978542,-0.3501477004227864,
+  -0.3501477004227864,-0.3501477004227864,-0.9495568987316407,0.1965319935803726,
+  -0.2131254214670126,0.1965319935803727,-0.9917032860566799,-0.2131254214670127,
+  -0.9917032860566800,0.1965319935803727,-0.9917032860566799,-0.9917032860566800,
+  -0.2131254214670127,-0.9917032860566800,-0.9917032860566800,-0.0526754243353008,
+  -0.5507507786472456,-0.5507507786472456,-0.0526754243353008,-0.5507507786472456,
+  -0.0526754243353008,-0.8458230183702078,-0.5507507786472456,-0.8458230183702078,
+  -0.5507507786472456,-0.5507507786472456,-0.8458230183702078,0.1262895558165598,
+  -0.3339099069068225,0.1262895558165598,-0.8961898244548685,-0.3339099069068227,
+  -0.8961898244548687,0.1262895558165598,-0.8961898244548685,-0.8961898244548685,
+  -0.3339099069068227,-0.8961898244548687,-0.8961898244548685,0.4167176615716379,
+  -0.7301397375675196,-0.7301397375675196,0.4167176615716379,-0.7301397375675196,
+  0.4167176615716379,-0.9564381864365987,-0.7301397375675196,-0.9564381864365987,
+  -0.7301397375675196,-0.7301397375675196,-0.9564381864365987,0.5674390146801547,
+  -0.6682037831131646,0.5674390146801547,-0.9496176157834950,-0.6682037831131646,
+  -0.9496176157834950,0.5674390146801547,-0.9496176157834950,-0.9496176157834950,
+  -0.6682037831131646,-0.9496176157834950,-0.9496176157834950,-0.2693624404365327,
+  -0.2693624404365327,-0.7304829357606661,-0.2693624404365327,-0.2693624404365327,
+  -0.7307921833662685,-0.2693624404365327,-0.7304829357606661,-0.2693624404365327,
+  -0.7307921833662685,-0.7304829357606661,-0.7307921833662685,0.0458150790198770,
+  -0.3468472165001741,0.0458150790198770,-0.7184927389126081,-0.3468472165001741,
+  -0.7184927389126081,0.0458150790198770,-0.3468472165001741,0.0458150790198770,
+  -0.9804751236070948,-0.3468472165001741,-0.9804751236070948,0.0458150790198770,
+  -0.7184927389126081,0.0458150790198770,-0.9804751236070948,-0.7184927389126081,
+  -0.9804751236070948,-0.3468472165001741,-0.7184927389126081,-0.3468472165001741,
+  -0.9804751236070948,-0.7184927389126081,-0.9804751236070948
+};
+static const double cubature_tet_11_weights[]={
+  0.0525761440382,0.0208828349697,0.0208828349697,0.0208828349697,
+  0.0208828349697,0.00444289649987,0.00444289649987,0.00444289649987,
+  0.00444289649987,0.0187014365433,0.0187014365433,0.0187014365433,
+  0.0187014365433,0.00144787670578,0.00144787670578,0.00144787670578,
+  0.00144787670578,0.00144787670578,0.00144787670578,0.00144787670578,
+  0.00144787670578,0.00144787670578,0.00144787670578,0.00144787670578,
+  0.00144787670578,0.0269812805742,0.0269812805742,0.0269812805742,
+  0.0269812805742,0.0269812805742,0.0269812805742,0.0269812805742,
+  0.0269812805742,0.0269812805742,0.0269812805742,0.0269812805742,
+  0.0269812805742,0.0157202864962,0.0157202864962,0.0157202864962,
+  0.0157202864962,0.0157202864962,0.0157202864962,0.0157202864962,
+  0.0157202864962,0.0157202864962,0.0157202864962,0.0157202864962,
+  0.0157202864962,0.01025375331,0.01025375331,0.01025375331,
+  0.01025375331,0.01025375331,0.01025375331,0.01025375331,
+  0.01025375331,0.01025375331,0.01025375331,0.01025375331,
+  0.01025375331,0.00591640760461,0.00591640760461,0.00591640760461,
+  0.00591640760461,0.00591640760461,0.00591640760461,0.00591640760461,
+  0.00591640760461,0.00591640760461,0.00591640760461,0.00591640760461,
+  0.00591640760461,0.0152393979562,0.0152393979562,0.0152393979562,
+  0.0152393979562,0.0152393979562,0.0152393979562,0.0152393979562,
+  0.0152393979562,0.0152393979562,0.0152393979562,0.0152393979562,
+  0.0152393979562,0.00824752022829,0.00824752022829,0.00824752022829,
+  0.00824752022829,0.00824752022829,0.00824752022829,0.00824752022829,
+  0.00824752022829,0.00824752022829,0.00824752022829,0.00824752022829,
+  0.00824752022829,0.00824752022829,0.00824752022829,0.00824752022829,
+  0.00824752022829,0.00824752022829,0.00824752022829,0.00824752022829,
+  0.00824752022829,0.00824752022829,0.00824752022829,0.00824752022829,
+  0.00824752022829
+};
+static const double cubature_tet_12_locs[]={
+  -0.7694005112970398,-0.7694005112970398,0.3082015338911192,-0.7694005112970398,
+  -0.5953274355188182,-0.5953274355188182,-0.2140176934435453,-0.5953274355188182,
+  -0.9765648040847601,-0.9765648040847601,0.9296944122542803,-0.9765648040847601,
+  -0.3733871172643979,-0.8798386482068064,-0.3733871172643979,-0.3733871172643979,
+  -0.4999885397688326,-0.5000343806935021,-0.4999885397688326,-0.4999885397688326,
+  -0.9580090512984840,-0.0419909487015160,-0.0419909487015160,-0.9580090512984840,
+  -0.9580090512984840,-0.0419909487015160,-0.6964519635050999,-0.3035480364949002,
+  -0.3035480364949002,-0.6964519635050999,-0.6964519635050999,-0.3035480364949002,
+  -0.9511604425131293,-0.9511604425131293,-0.7943376843694872,-0.7943376843694872,
+  0.6966585693957457,0.6966585693957457,-0.9511604425131293,-0.9511604425131293,
+  0.6966585693957457,-0.9511604425131293,-0.9511604425131293,-0.7943376843694872,
+  -0.4875858029359634,-0.4875858029359634,-0.0350252522523024,-0.9898031418757709,
+  -0.9898031418757708,-0.4875858029359634,-0.4875858029359634,-0.0350252522523024,
+  -0.0350252522523024,-0.9898031418757708,-0.4875858029359634,-0.4875858029359634,
+  -0.9664193580407940,-0.9664193580407940,-0.4567051686499237,-0.4567051686499237,
+  0.3895438847315118,0.3895438847315118,-0.9664193580407940,-0.9664193580407940,
+  0.3895438847315118,-0.9664193580407940,-0.9664193580407940,-0.4567051686499237,
+  -0.7476783577202559,-0.7476783577202559,0.4508209786058963,-0.9554642631653845,
+  -0.9554642631653845,-0.7476783577202559,-0.7476783577202559,0.4508209786058963,
+  0.4508209786058963,-0.9554642631653845,-0.7476783577202559,-0.7476783577202559,
+  -0.7745561202142952,-0.1371296509472403,-0.1371296509472403,-0.9511845778912242,
+  -0.1371296509472403,-0.1371296509472403,-0.9511845778912242,-0.9511845778912242,
+  -0.7745561202142952,-0.7745561202142952,-0.1371296509472403,-0.1371296509472403,
+  -0.6924323882786539,-0.6924323882786539,-0.4550563942609552,-0.4550563942609552,
+  0.0033401249250113,0.0033401249250113,-0.8558513423854022,-0.8558513423854022,
+  -0.4550563942609552,-0.4550563942609552,0.0033401249250113,0.0033401249250113,
+  -0.8558513423854022,-0.8558513423854022,-0.6924323882786539,-0.6924323882786539,
+  0.0033401249250113,0.0033401249250113,-0.8558513423854022,-0.8558513423854022,
+  -0.6924323882786539,-0.6924323882786539,-0.4550563942609552,-0.4550563942609552,
+  -0.8274154161058767,-0.8274154161058767,-0.4767102909243626,-0.4767102909243626,
+  0.2629948857184869,0.2629948857184868,-0.9588691786882478,-0.9588691786882477,
+  -0.4767102909243626,-0.4767102909243626,0.2629948857184869,0.2629948857184869,
+  -0.9588691786882478,-0.9588691786882477,-0.8274154161058767,-0.8274154161058767,
+  0.2629948857184868,0.2629948857184868,-0.9588691786882477,-0.9588691786882477,
+  -0.8274154161058767,-0.8274154161058767,-0.4767102909243626,-0.4767102909243626,
+  -0.7694005112970398,0.3082015338911192,-0.7694005112970398,-0.7694005112970398,
+  -0.5953274355188182,-0.2140176934435453,-0.5953274355188182,-0.5953274355188182,
+  -0.9765648040847601,0.9296944122542803,-0.9765648040847601,-0.9765648040847601,
+  -0.3733871172643979,-0.3733871172643979,-0.8798386482068064,-0.3733871172643979,
+  -0.4999885397688326,-0.4999885397688326,-0.5000343806935021,-0.4999885397688326,
+  -0.0419909487015160,-0.9580090512984840,-0.0419909487015160,-0.9580090512984840,
+  -0.0419909487015160,-0.9580090512984840,-0.3035480364949002,-0.6964519635050999,
+  -0.3035480364949001,-0.6964519635050999,-0.3035480364949001,-0.6964519635050999,
+  -0.7943376843694872,0.6966585693957457,-0.9511604425131293,0.6966585693957457,
+  -0.9511604425131293,-0.7943376843694872,-0.9511604425131293,0.6966585693957457,
+  -0.9511604425131293,-0.9511604425131293,-0.7943376843694872,-0.9511604425131293,
+  -0.4875858029359634,-0.0350252522523024,-0.4875858029359634,-0.4875858029359634,
+  -0.0350252522523024,-0.9898031418757709,-0.0350252522523024,-0.9898031418757708,
+  -0.4875858029359634,-0.4875858029359634,-0.9898031418757708,-0.4875858029359634,
+  -0.4567051686499237,0.3895438847315118,-0.9664193580407940,0.3895438847315118,
+  -0.9664193580407940,-0.4567051686499237,-0.9664193580407940,0.3895438847315118,
+  -0.9664193580407940,-0.9664193580407940,-0.4567051686499237,-0.9664193580407940,
+  -0.7476783577202559,0.4508209786058963,-0.7476783577202559,-0.7476783577202559,
+  0.4508209786058963,-0.9554642631653845,0.4508209786058963,-0.9554642631653845,
+  -0.7476783577202559,-0.7476783577202559,-0.9554642631653845,-0.7476783577202559,
+  -0.1371296509472403,-0.7745561202142952,-0.1371296509472403,-0.1371296509472403,
+  -0.9511845778912242,-0.1371296509472403,-0.7745561202142952,-0.1371296509472403,
+  -0.9511845778912242,-0.1371296509472403,-0.9511845778912242,-0.7745561202142952,
+  -0.4550563942609552,0.0033401249250113,-0.6924323882786539,0.0033401249250113,
+  -0.6924323882786539,-0.4550563942609552,-0.4550563942609552,0.0033401249250113,
+  -0.8558513423854022,0.0033401249250113,-0.8558513423854022,-0.4550563942609553,
+  -0.6924323882786539,0.0033401249250113,-0.8558513423854022,0.0033401249250113,
+  -0.8558513423854022,-0.6924323882786538,-0.6924323882786539,-0.4550563942609552,
+  -0.8558513423854022,-0.4550563942609553,-0.8558513423854022,-0.6924323882786538,
+  -0.4767102909243626,0.2629948857184869,-0.8274154161058767,0.2629948857184868,
+  -0.8274154161058767,-0.4767102909243626,-0.4767102909243626,0.2629948857184869,
+  -0.9588691786882478,0.2629948857184868,-0.9588691786882477,-0.4767102909243625,
+  -0.8274154161058767,0.2629948857184868,-0.9588691786882478,0.2629948857184868,
+  -0.9588691786882477,-0.8274154161058767,-0.8274154161058767,-0.4767102909243626,
+  -0.9588691786882477,-0.4767102909243625,-0.9588691786882477,-0.8274154161058767,
+  0.3082015338911192,-0.7694005112970398,-0.7694005112970398,-0.7694005112970398,
+  -0.2140176934435454,-0.5953274355188182,-0.5953274355188182,-0.5953274355188182,
+  0.9296944122542803,-0.9765648040847601,-0.9765648040847601,-0.9765648040847601,
+  -0.3733871172643979,-0.3733871172643979,-0.3733871172643979,-0.8798386482068064,
+  -0.4999885397688326,-0.4999885397688326,-0.4999885397688326,-0.5000343806935021,
+  -0.0419909487015160,-0.0419909487015160,-0.9580090512984840,-0.0419909487015160,
+  -0.9580090512984840,-0.9580090512984840,-0.3035480364949001,-0.3035480364949001,
+  -0.6964519635050999,-0.3035480364949001,-0.6964519635050999,-0.6964519635050999,
+  0.6966585693957457,-0.7943376843694872,0.6966585693957457,-0.9511604425131293,
+  -0.7943376843694872,-0.9511604425131293,0.6966585693957457,-0.9511604425131293,
+  -0.9511604425131293,-0.7943376843694872,-0.9511604425131293,-0.9511604425131293,
+  -0.0350252522523023,-0.4875858029359634,-0.4875858029359634,-0.0350252522523023,
+  -0.4875858029359634,-0.0350252522523023,-0.9898031418757709,-0.4875858029359633,
+  -0.9898031418757707,-0.4875858029359634,-0.4875858029359633,-0.9898031418757707,
+  0.3895438847315118,-0.4567051686499237,0.3895438847315118,-0.9664193580407940,
+  -0.4567051686499237,-0.9664193580407940,0.3895438847315118,-0.9664193580407940,
+  -0.9664193580407940,-0.4567051686499237,-0.9664193580407940,-0.9664193580407940,
+  0.4508209786058963,-0.7476783577202559,-0.7476783577202559,0.4508209786058963,
+  -0.7476783577202559,0.4508209786058963,-0.9554642631653845,-0.7476783577202559,
+  -0.9554642631653845,-0.7476783577202559,-0.7476783577202559,-0.9554642631653845,
+  -0.1371296509472403,-0.1371296509472403,-0.7745561202142952,-0.1371296509472403,
+  -0.1371296509472403,-0.9511845778912242,-0.1371296509472403,-0.7745561202142952,
+  -0.1371296509472403,-0.9511845778912242,-0.7745561202142952,-0.9511845778912242,
+  0.0033401249250113,-0.4550563942609553,0.0033401249250113,-0.6924323882786538,
+  -0.4550563942609553,-0.6924323882786538,0.0033401249250113,-0.4550563942609553,
+  0.0033401249250113,-0.8558513423854022,-0.4550563942609553,-0.8558513423854022,
+  0.0033401249250113,-0.6924323882786538,0.0033401249250113,-0.8558513423854022,
+  -0.6924323882786538,-0.8558513423854022,-0.4550563942609553,-0.6924323882786538,
+  -0.4550563942609553,-0.8558513423854022,-0.6924323882786538,-0.8558513423854022,
+  0.2629948857184868,-0.4767102909243625,0.2629948857184868,-0.8274154161058767,
+  -0.4767102909243625,-0.8274154161058767,0.2629948857184868,-0.4767102909243625,
+  0.2629948857184868,-0.9588691786882478,-0.4767102909243625,-0.9588691786882477,
+  0.2629948857184868,-0.8274154161058767,0.2629948857184868,-0.9588691786882478,
+  -0.8274154161058767,-0.9588691786882477,-0.4767102909243625,-0.8274154161058767,
+  -0.4767102909243625,-0.9588691786882477,-0.8274154161058767,-0.9588691786882477
+};
+static const double cubature_tet_12_weights[]={
+  0.0170235169346,0.0170235169346,0.0170235169346,0.0170235169346,
+  0.0214948056505,0.0214948056505,0.0214948056505,0.0214948056505,
+  0.000495483598105,0.000495483598105,0.000495483598105,0.000495483598105,
+  0.0262899223822,0.0262899223822,0.0262899223822,0.0262899223822,
+  0.00342852124115,0.00342852124115,0.00342852124115,0.00342852124115,
+  0.00508966382735,0.00508966382735,0.00508966382735,0.00508966382735,
+  0.00508966382735,0.00508966382735,0.0161163027702,0.0161163027702,
+  0.0161163027702,0.0161163027702,0.0161163027702,0.0161163027702,
+  0.00414114821125,0.00414114821125,0.00414114821125,0.00414114821125,
+  0.00414114821125,0.00414114821125,0.00414114821125,0.00414114821125,
+  0.00414114821125,0.00414114821125,0.00414114821125,0.00414114821125,
+  0.00727937511529,0.00727937511529,0.00727937511529,0.00727937511529,
+  0.00727937511529,0.00727937511529,0.00727937511529,0.00727937511529,
+  0.00727937511529,0.00727937511529,0.00727937511529,0.00727937511529,
+  0.00285719966466,0.00285719966466,0.00285719966466,0.00285719966466,
+  0.00285719966466,0.00285719966466,0.00285719966466,0.00285719966466,
+  0.00285719966466,0.00285719966466,0.00285719966466,0.00285719966466,
+  0.00736622862301,0.00736622862301,0.00736622862301,0.00736622862301,
+  0.00736622862301,0.00736622862301,0.00736622862301,0.00736622862301,
+  0.00736622862301,0.00736622862301,0.00736622862301,0.00736622862301,
+  0.011382608926,0.011382608926,0.011382608926,0.011382608926,
+  0.011382608926,0.011382608926,0.011382608926,0.011382608926,
+  0.011382608926,0.011382608926,0.011382608926,0.011382608926,
+  0.0153469037978,0.0153469037978,0.0153469037978,0.0153469037978,
+  0.0153469037978,0.0153469037978,0.0153469037978,0.0153469037978,
+  0.0153469037978,0.0153469037978,0.0153469037978,0.0153469037978,
+  0.0153469037978,0.0153469037978,0.0153469037978,0.0153469037978,
+  0.0153469037978,0.0153469037978,0.0153469037978,0.0153469037978,
+  0.0153469037978,0.0153469037978,0.0153469037978,0.0153469037978,
+  0.00693850487051,0.00693850487051,0.00693850487051,0.00693850487051,
+  0.00693850487051,0.00693850487051,0.00693850487051,0.00693850487051,
+  0.00693850487051,0.00693850487051,0.00693850487051,0.00693850487051,
+  0.00693850487051,0.00693850487051,0.00693850487051,0.00693850487051,
+  0.00693850487051,0.00693850487051,0.00693850487051,0.00693850487051,
+  0.00693850487051,0.00693850487051,0.00693850487051,0.00693850487051
+};
+static const double cubature_tet_13_locs[]={
+  -0.5000000000000000,-0.6895678129618210,-0.6895678129618210,0.0687034388854630,
+  -0.6895678129618210,-0.3397546733206528,-0.9807359800380415,-0.3397546733206528,
+  -0.3397546733206528,-0.6663871922122750,-0.3336128077877250,-0.3336128077877250,
+  -0.6663871922122750,-0.6663871922122750,-0.3336128077877250,-0.9501524229044528,
+  -0.0498475770955472,-0.0498475770955472,-0.9501524229044528,-0.9501524229044528,
+  -0.0498475770955472,-0.8056047401684980,-0.1943952598315020,-0.1943952598315020,
+  -0.8056047401684980,-0.8056047401684980,-0.1943952598315020,-0.5042814196852748,
+  -0.5042814196852748,-0.1326935152862971,-0.8587436453431532,-0.8587436453431532,
+  -0.5042814196852748,-0.5042814196852748,-0.1326935152862971,-0.1326935152862971,
+  -0.8587436453431532,-0.5042814196852748,-0.5042814196852748,-0.9555368078362660,
+  -0.9555368078362660,-0.7627270251349358,-0.7627270251349358,0.6738006408074679,
+  0.6738006408074679,-0.9555368078362660,-0.9555368078362660,0.6738006408074679,
+  -0.9555368078362660,-0.9555368078362660,-0.7627270251349358,-0.7854426133738932,
+  -0.7854426133738932,0.5499606119500036,-0.9790753852022172,-0.9790753852022172,
+  -0.7854426133738932,-0.7854426133738932,0.5499606119500036,0.5499606119500036,
+  -0.9790753852022172,-0.7854426133738932,-0.7854426133738932,-0.6036463122320204,
+  -0.6036463122320204,0.1751386115644107,-0.9678459871003700,-0.9678459871003700,
+  -0.6036463122320204,-0.6036463122320204,0.1751386115644107,0.1751386115644107,
+  -0.9678459871003700,-0.6036463122320204,-0.6036463122320204,-0.8616415130452414,
+  -0.8616415130452414,-0.4851171072296501,-0.4851171072296501,0.2084001333201328,
+  0.2084001333201328,-0.8616415130452414,-0.8616415130452414,0.2084001333201329,
+  -0.8616415130452414,-0.8616415130452414,-0.4851171072296501,-0.9537705610561337,
+  -0.9537705610561337,0.8617515855848886,-0.9542104634726212,-0.9542104634726211,
+  -0.9537705610561337,-0.9537705610561337,0.8617515855848886,0.8617515855848886,
+  -0.9542104634726211,-0.9537705610561337,-0.9537705610561337,-0.7669692715491856,
+  -0.7669692715491856,-0.7642214249796078,-0.7642214249796078,0.4471426942777625,
+  0.4471426942777625,-0.9159519977489692,-0.9159519977489692,-0.7642214249796078,
+  -0.7642214249796078,0.4471426942777625,0.4471426942777625,-0.9159519977489692,
+  -0.9159519977489692,-0.7669692715491856,-0.7669692715491856,0.4471426942777625,
+  0.4471426942777625,-0.9159519977489692,-0.9159519977489692,-0.7669692715491856,
+  -0.7669692715491856,-0.7642214249796078,-0.7642214249796078,-0.9076692479507606,
+  -0.9076692479507606,-0.4480850298916180,-0.4480850298916180,0.3540655972045686,
+  0.3540655972045685,-0.9983113193621900,-0.9983113193621900,-0.4480850298916180,
+  -0.4480850298916180,0.3540655972045686,0.3540655972045686,-0.9983113193621900,
+  -0.9983113193621900,-0.9076692479507606,-0.9076692479507605,0.3540655972045685,
+  0.3540655972045685,-0.9983113193621900,-0.9983113193621900,-0.9076692479507606,
+  -0.9076692479507605,-0.4480850298916180,-0.4480850298916180,-0.7236343301647425,
+  -0.7236343301647425,-0.2822341140895960,-0.2822341140895960,-0.0302198226527337,
+  -0.0302198226527337,-0.9639117330929278,-0.9639117330929279,-0.2822341140895960,
+  -0.2822341140895960,-0.0302198226527337,-0.0302198226527337,-0.9639117330929278,
+  -0.9639117330929278,-0.7236343301647425,-0.7236343301647425,-0.0302198226527337,
+  -0.0302198226527337,-0.9639117330929279,-0.9639117330929278,-0.7236343301647425,
+  -0.7236343301647425,-0.2822341140895960,-0.2822341140895960,-0.5000000000000000,
+  -0.6895678129618210,0.0687034388854630,-0.6895678129618210,-0.6895678129618210,
+  -0.3397546733206528,-0.3397546733206528,-0.9807359800380415,-0.3397546733206528,
+  -0.3336128077877250,-0.6663871922122750,-0.3336128077877250,-0.6663871922122750,
+  -0.3336128077877250,-0.6663871922122750,-0.0498475770955472,-0.9501524229044528,
+  -0.0498475770955472,-0.9501524229044528,-0.0498475770955472,-0.9501524229044528,
+  -0.1943952598315020,-0.8056047401684980,-0.1943952598315020,-0.8056047401684980,
+  -0.1943952598315020,-0.8056047401684980,-0.5042814196852748,-0.1326935152862971,
+  -0.5042814196852748,-0.5042814196852748,-0.1326935152862971,-0.8587436453431532,
+  -0.1326935152862971,-0.8587436453431532,-0.5042814196852747,-0.5042814196852748,
+  -0.8587436453431532,-0.5042814196852747,-0.7627270251349358,0.6738006408074679,
+  -0.9555368078362660,0.6738006408074679,-0.9555368078362660,-0.7627270251349358,
+  -0.9555368078362660,0.6738006408074679,-0.9555368078362660,-0.9555368078362660,
+  -0.7627270251349358,-0.9555368078362660,-0.7854426133738932,0.5499606119500036,
+  -0.7854426133738932,-0.7854426133738932,0.5499606119500036,-0.9790753852022172,
+  0.5499606119500036,-0.9790753852022172,-0.7854426133738932,-0.7854426133738932,
+  -0.9790753852022172,-0.7854426133738932,-0.6036463122320204,0.1751386115644107,
+  -0.6036463122320204,-0.6036463122320204,0.1751386115644107,-0.9678459871003700,
+  0.1751386115644107,-0.9678459871003700,-0.6036463122320204,-0.6036463122320204,
+  -0.9678459871003700,-0.6036463122320204,-0.4851171072296501,0.2084001333201329,
+  -0.8616415130452414,0.2084001333201329,-0.8616415130452414,-0.4851171072296501,
+  -0.8616415130452414,0.2084001333201329,-0.8616415130452414,-0.8616415130452414,
+  -0.4851171072296501,-0.8616415130452414,-0.9537705610561337,0.8617515855848886,
+  -0.9537705610561337,-0.9537705610561337,0.8617515855848886,-0.9542104634726212,
+  0.8617515855848885,-0.9542104634726211,-0.9537705610561337,-0.9537705610561337,
+  -0.9542104634726211,-0.9537705610561337,-0.7642214249796078,0.4471426942777625,
+  -0.7669692715491856,0.4471426942777625,-0.7669692715491856,-0.7642214249796078,
+  -0.7642214249796078,0.4471426942777625,-0.9159519977489692,0.4471426942777625,
+  -0.9159519977489692,-0.7642214249796078,-0.7669692715491856,0.4471426942777625,
+  -0.9159519977489692,0.4471426942777625,-0.9159519977489692,-0.7669692715491856,
+  -0.7669692715491856,-0.7642214249796078,-0.9159519977489692,-0.7642214249796078,
+  -0.9159519977489692,-0.7669692715491856,-0.4480850298916180,0.3540655972045685,
+  -0.9076692479507605,0.3540655972045685,-0.9076692479507606,-0.4480850298916180,
+  -0.4480850298916180,0.3540655972045685,-0.9983113193621900,0.3540655972045685,
+  -0.9983113193621900,-0.4480850298916180,-0.9076692479507605,0.3540655972045685,
+  -0.9983113193621900,0.3540655972045685,-0.9983113193621899,-0.9076692479507605,
+  -0.9076692479507606,-0.4480850298916180,-0.9983113193621900,-0.4480850298916180,
+  -0.9983113193621899,-0.9076692479507605,-0.2822341140895960,-0.0302198226527337,
+  -0.7236343301647425,-0.0302198226527337,-0.7236343301647425,-0.2822341140895960,
+  -0.2822341140895960,-0.0302198226527337,-0.9639117330929278,-0.0302198226527337,
+  -0.9639117330929279,-0.2822341140895960,-0.7236343301647425,-0.0302198226527337,
+  -0.9639117330929278,-0.0302198226527337,-0.9639117330929278,-0.7236343301647425,
+  -0.7236343301647425,-0.2822341140895960,-0.9639117330929279,-0.2822341140895960,
+  -0.9639117330929278,-0.7236343301647425,-0.5000000000000000,0.0687034388854630,
+  -0.6895678129618210,-0.6895678129618210,-0.6895678129618210,-0.3397546733206528,
+  -0.3397546733206528,-0.3397546733206528,-0.9807359800380415,-0.3336128077877251,
+  -0.3336128077877250,-0.6663871922122750,-0.3336128077877250,-0.6663871922122750,
+  -0.6663871922122750,-0.0498475770955473,-0.0498475770955473,-0.9501524229044528,
+  -0.0498475770955473,-0.9501524229044528,-0.9501524229044528,-0.1943952598315020,
+  -0.1943952598315020,-0.8056047401684980,-0.1943952598315020,-0.8056047401684980,
+  -0.8056047401684980,-0.1326935152862971,-0.5042814196852747,-0.5042814196852747,
+  -0.1326935152862971,-0.5042814196852747,-0.1326935152862971,-0.8587436453431532,
+  -0.5042814196852747,-0.8587436453431532,-0.5042814196852747,-0.5042814196852747,
+  -0.8587436453431532,0.6738006408074679,-0.7627270251349358,0.6738006408074679,
+  -0.9555368078362660,-0.7627270251349358,-0.9555368078362660,0.6738006408074679,
+  -0.9555368078362660,-0.9555368078362660,-0.7627270251349358,-0.9555368078362660,
+  -0.9555368078362660,0.5499606119500036,-0.7854426133738932,-0.7854426133738932,
+  0.5499606119500036,-0.7854426133738932,0.5499606119500036,-0.9790753852022172,
+  -0.7854426133738932,-0.9790753852022172,-0.7854426133738932,-0.7854426133738932,
+  -0.9790753852022172,0.1751386115644107,-0.6036463122320204,-0.6036463122320204,
+  0.1751386115644107,-0.6036463122320204,0.1751386115644107,-0.9678459871003700,
+  -0.6036463122320204,-0.9678459871003700,-0.6036463122320204,-0.6036463122320204,
+  -0.9678459871003700,0.2084001333201329,-0.4851171072296501,0.2084001333201329,
+  -0.8616415130452414,-0.4851171072296502,-0.8616415130452414,0.2084001333201329,
+  -0.8616415130452414,-0.8616415130452414,-0.4851171072296502,-0.8616415130452414,
+  -0.8616415130452414,0.8617515855848885,-0.9537705610561337,-0.9537705610561337,
+  0.8617515855848885,-0.9537705610561337,0.8617515855848885,-0.9542104634726212,
+  -0.9537705610561337,-0.9542104634726211,-0.9537705610561337,-0.9537705610561337,
+  -0.9542104634726211,0.4471426942777625,-0.7642214249796078,0.4471426942777625,
+  -0.7669692715491856,-0.7642214249796078,-0.7669692715491856,0.4471426942777625,
+  -0.7642214249796078,0.4471426942777625,-0.9159519977489692,-0.7642214249796078,
+  -0.9159519977489692,0.4471426942777625,-0.7669692715491856,0.4471426942777625,
+  -0.9159519977489692,-0.7669692715491856,-0.9159519977489692,-0.7642214249796078,
+  -0.7669692715491856,-0.7642214249796078,-0.9159519977489692,-0.7669692715491856,
+  -0.9159519977489692,0.3540655972045685,-0.4480850298916181,0.3540655972045685,
+  -0.9076692479507606,-0.4480850298916180,-0.9076692479507606,0.3540655972045685,
+  -0.4480850298916181,0.3540655972045685,-0.9983113193621900,-0.4480850298916180,
+  -0.9983113193621899,0.3540655972045685,-0.9076692479507606,0.3540655972045685,
+  -0.9983113193621900,-0.9076692479507605,-0.9983113193621899,-0.4480850298916180,
+  -0.9076692479507606,-0.4480850298916180,-0.9983113193621899,-0.9076692479507605,
+  -0.9983113193621899,-0.0302198226527337,-0.2822341140895959,-0.0302198226527337,
+  -0.7236343301647425,-0.2822341140895960,-0.7236343301647427,-0.0302198226527337,
+  -0.2822341140895959,-0.0302198226527337,-0.9639117330929277,-0.2822341140895959,
+  -0.9639117330929277,-0.0302198226527337,-0.7236343301647425,-0.0302198226527337,
+  -0.9639117330929277,-0.7236343301647427,-0.9639117330929279,-0.2822341140895960,
+  -0.7236343301647427,-0.2822341140895959,-0.9639117330929277,-0.7236343301647427,
+  -0.9639117330929279
+};
+static const double cubature_tet_13_weights[]={
+  0.0200182503641,0.0243002790402,0.0243002790402,0.0243002790402,
+  0.0243002790402,0.00934147895699,0.00934147895699,0.00934147895699,
+  0.00934147895699,0.0218980663253,0.0218980663253,0.0218980663253,
+  0.0218980663253,0.0218980663253,0.0218980663253,0.00682748012848,
+  0.00682748012848,0.00682748012848,0.00682748012848,0.00682748012848,
+  0.00682748012848,0.0149289315372,0.0149289315372,0.0149289315372,
+  0.0149289315372,0.0149289315372,0.0149289315372,0.0208255329778,
+  0.0208255329778,0.0208255329778,0.0208255329778,0.0208255329778,
+  0.0208255329778,0.0208255329778,0.0208255329778,0.0208255329778,
+  0.0208255329778,0.0208255329778,0.0208255329778,0.00331256401776,
+  0.00331256401776,0.00331256401776,0.00331256401776,0.00331256401776,
+  0.00331256401776,0.00331256401776,0.00331256401776,0.00331256401776,
+  0.00331256401776,0.00331256401776,0.00331256401776,0.00218479804642,
+  0.00218479804642,0.00218479804642,0.00218479804642,0.00218479804642,
+  0.00218479804642,0.00218479804642,0.00218479804642,0.00218479804642,
+  0.00218479804642,0.00218479804642,0.00218479804642,0.0078707072535,
+  0.0078707072535,0.0078707072535,0.0078707072535,0.0078707072535,
+  0.0078707072535,0.0078707072535,0.0078707072535,0.0078707072535,
+  0.0078707072535,0.0078707072535,0.0078707072535,0.0146961099443,
+  0.0146961099443,0.0146961099443,0.0146961099443,0.0146961099443,
+  0.0146961099443,0.0146961099443,0.0146961099443,0.0146961099443,
+  0.0146961099443,0.0146961099443,0.0146961099443,0.000541935786619,
+  0.000541935786619,0.000541935786619,0.000541935786619,0.000541935786619,
+  0.000541935786619,0.000541935786619,0.000541935786619,0.000541935786619,
+  0.000541935786619,0.000541935786619,0.000541935786619,0.00358395996396,
+  0.00358395996396,0.00358395996396,0.00358395996396,0.00358395996396,
+  0.00358395996396,0.00358395996396,0.00358395996396,0.00358395996396,
+  0.00358395996396,0.00358395996396,0.00358395996396,0.00358395996396,
+  0.00358395996396,0.00358395996396,0.00358395996396,0.00358395996396,
+  0.00358395996396,0.00358395996396,0.00358395996396,0.00358395996396,
+  0.00358395996396,0.00358395996396,0.00358395996396,0.0026393397407,
+  0.0026393397407,0.0026393397407,0.0026393397407,0.0026393397407,
+  0.0026393397407,0.0026393397407,0.0026393397407,0.0026393397407,
+  0.0026393397407,0.0026393397407,0.0026393397407,0.0026393397407,
+  0.0026393397407,0.0026393397407,0.0026393397407,0.0026393397407,
+  0.0026393397407,0.0026393397407,0.0026393397407,0.0026393397407,
+  0.0026393397407,0.0026393397407,0.0026393397407,0.00726175890857,
+  0.00726175890857,0.00726175890857,0.00726175890857,0.00726175890857,
+  0.00726175890857,0.00726175890857,0.00726175890857,0.00726175890857,
+  0.00726175890857,0.00726175890857,0.00726175890857,0.00726175890857,
+  0.00726175890857,0.00726175890857,0.00726175890857,0.00726175890857,
+  0.00726175890857,0.00726175890857,0.00726175890857,0.00726175890857,
+  0.00726175890857,0.00726175890857,0.00726175890857
+};
+static const double cubature_tet_14_locs[]={
+  -0.3454932749523028,-0.9635201751430915,-0.3454932749523028,-0.3454932749523028,
+  -0.9104773910666297,-0.9104773910666297,0.7314321731998896,-0.9104773910666297,
+  -0.8277193377951273,-0.8277193377951273,0.4831580133853819,-0.8277193377951273,
+  -0.5824747149991354,-0.5824747149991354,-0.2525758550025938,-0.5824747149991354,
+  -0.9717900523941581,-0.9717900523941581,0.9153701571824742,-0.9717900523941581,
+  -0.7956693516384463,-0.7956693516384463,-0.5565540319117750,-0.5565540319117750,
+  0.1478927351886676,0.1478927351886677,-0.7956693516384463,-0.7956693516384463,
+  0.1478927351886677,-0.7956693516384463,-0.7956693516384463,-0.5565540319117750,
+  -0.8147359469180830,-0.1848598966799786,-0.1848598966799786,-0.8155442597219598,
+  -0.1848598966799786,-0.1848598966799786,-0.8155442597219598,-0.8155442597219598,
+  -0.8147359469180830,-0.8147359469180830,-0.1848598966799786,-0.1848598966799786,
+  -0.9686719985194393,-0.9686719985194393,-0.4652181948790095,-0.4652181948790095,
+  0.4025621919178880,0.4025621919178881,-0.9686719985194393,-0.9686719985194394,
+  0.4025621919178881,-0.9686719985194393,-0.9686719985194393,-0.4652181948790095,
+  -0.5490072874949942,-0.5490072874949942,-0.0461872051158225,-0.8557982198941891,
+  -0.8557982198941891,-0.5490072874949942,-0.5490072874949942,-0.0461872051158225,
+  -0.0461872051158225,-0.8557982198941891,-0.5490072874949942,-0.5490072874949942,
+  -0.5972818911752156,-0.5972818911752156,-0.2188031437437084,-0.2188031437437084,
+  -0.2161395412231362,-0.2161395412231362,-0.9677754238579399,-0.9677754238579399,
+  -0.2188031437437084,-0.2188031437437084,-0.2161395412231362,-0.2161395412231362,
+  -0.9677754238579399,-0.9677754238579399,-0.5972818911752156,-0.5972818911752156,
+  -0.2161395412231362,-0.2161395412231362,-0.9677754238579399,-0.9677754238579399,
+  -0.5972818911752156,-0.5972818911752156,-0.2188031437437084,-0.2188031437437084,
+  -0.9345283626365462,-0.9345283626365462,-0.7877298640021957,-0.7877298640021957,
+  0.7150624113312876,0.7150624113312876,-0.9928041846925457,-0.9928041846925457,
+  -0.7877298640021957,-0.7877298640021957,0.7150624113312876,0.7150624113312876,
+  -0.9928041846925457,-0.9928041846925457,-0.9345283626365462,-0.9345283626365462,
+  0.7150624113312876,0.7150624113312876,-0.9928041846925457,-0.9928041846925457,
+  -0.9345283626365462,-0.9345283626365462,-0.7877298640021957,-0.7877298640021957,
+  -0.6185601316512896,-0.6185601316512896,-0.5394158555398685,-0.5394158555398685,
+  0.1272767463395488,0.1272767463395488,-0.9693007591483906,-0.9693007591483906,
+  -0.5394158555398685,-0.5394158555398685,0.1272767463395488,0.1272767463395488,
+  -0.9693007591483906,-0.9693007591483906,-0.6185601316512896,-0.6185601316512896,
+  0.1272767463395488,0.1272767463395488,-0.9693007591483906,-0.9693007591483906,
+  -0.6185601316512896,-0.6185601316512896,-0.5394158555398685,-0.5394158555398685,
+  -0.5842297239539911,-0.5842297239539911,-0.3375790229613101,-0.3375790229613101,
+  -0.2647489809348278,-0.2647489809348278,-0.8134422721498710,-0.8134422721498711,
+  -0.3375790229613101,-0.3375790229613101,-0.2647489809348278,-0.2647489809348278,
+  -0.8134422721498710,-0.8134422721498710,-0.5842297239539911,-0.5842297239539911,
+  -0.2647489809348278,-0.2647489809348278,-0.8134422721498711,-0.8134422721498710,
+  -0.5842297239539911,-0.5842297239539911,-0.3375790229613101,-0.3375790229613101,
+  -0.8326410340815870,-0.8326410340815870,-0.6473441763961341,-0.6473441763961341,
+  0.4384647379634590,0.4384647379634590,-0.9584795274857379,-0.9584795274857379,
+  -0.6473441763961341,-0.6473441763961341,0.4384647379634590,0.4384647379634589,
+  -0.9584795274857381,-0.9584795274857381,-0.8326410340815870,-0.8326410340815869,
+  0.4384647379634590,0.4384647379634590,-0.9584795274857381,-0.9584795274857381,
+  -0.8326410340815869,-0.8326410340815869,-0.6473441763961341,-0.6473441763961341,
+  -0.9486684992426094,-0.9486684992426094,-0.1254218215593164,-0.1254218215593164,
+  0.0556499904305974,0.0556499904305974,-0.9815596696286716,-0.9815596696286716,
+  -0.1254218215593164,-0.1254218215593164,0.0556499904305973,0.0556499904305973,
+  -0.9815596696286716,-0.9815596696286716,-0.9486684992426094,-0.9486684992426094,
+  0.0556499904305974,0.0556499904305974,-0.9815596696286717,-0.9815596696286717,
+  -0.9486684992426093,-0.9486684992426093,-0.1254218215593164,-0.1254218215593164,
+  -0.8265565433355569,-0.8265565433355568,-0.3104368987656717,-0.3104368987656717,
+  0.0967349089896381,0.0967349089896381,-0.9597414668884094,-0.9597414668884094,
+  -0.3104368987656717,-0.3104368987656717,0.0967349089896381,0.0967349089896381,
+  -0.9597414668884094,-0.9597414668884096,-0.8265565433355569,-0.8265565433355569,
+  0.0967349089896381,0.0967349089896381,-0.9597414668884094,-0.9597414668884096,
+  -0.8265565433355569,-0.8265565433355569,-0.3104368987656717,-0.3104368987656717,
+  -0.3454932749523028,-0.3454932749523028,-0.9635201751430915,-0.3454932749523028,
+  -0.9104773910666297,0.7314321731998894,-0.9104773910666297,-0.9104773910666297,
+  -0.8277193377951273,0.4831580133853819,-0.8277193377951273,-0.8277193377951273,
+  -0.5824747149991354,-0.2525758550025938,-0.5824747149991354,-0.5824747149991354,
+  -0.9717900523941581,0.9153701571824742,-0.9717900523941581,-0.9717900523941581,
+  -0.5565540319117750,0.1478927351886677,-0.7956693516384463,0.1478927351886677,
+  -0.7956693516384463,-0.5565540319117750,-0.7956693516384463,0.1478927351886677,
+  -0.7956693516384463,-0.7956693516384463,-0.5565540319117750,-0.7956693516384463,
+  -0.1848598966799786,-0.8147359469180830,-0.1848598966799786,-0.1848598966799786,
+  -0.8155442597219598,-0.1848598966799786,-0.8147359469180830,-0.1848598966799786,
+  -0.8155442597219598,-0.1848598966799786,-0.8155442597219598,-0.8147359469180830,
+  -0.4652181948790095,0.4025621919178881,-0.9686719985194393,0.4025621919178881,
+  -0.9686719985194393,-0.4652181948790096,-0.9686719985194393,0.4025621919178881,
+  -0.9686719985194393,-0.9686719985194393,-0.4652181948790096,-0.9686719985194393,
+  -0.5490072874949942,-0.0461872051158225,-0.5490072874949942,-0.5490072874949942,
+  -0.0461872051158225,-0.8557982198941891,-0.0461872051158225,-0.8557982198941891,
+  -0.5490072874949941,-0.5490072874949942,-0.8557982198941891,-0.5490072874949941,
+  -0.2188031437437084,-0.2161395412231362,-0.5972818911752156,-0.2161395412231362,
+  -0.5972818911752156,-0.2188031437437084,-0.2188031437437084,-0.2161395412231362,
+  -0.9677754238579399,-0.2161395412231362,-0.9677754238579399,-0.2188031437437084,
+  -0.5972818911752156,-0.2161395412231362,-0.9677754238579399,-0.2161395412231362,
+  -0.9677754238579399,-0.5972818911752156,-0.5972818911752156,-0.2188031437437084,
+  -0.9677754238579399,-0.2188031437437084,-0.9677754238579399,-0.5972818911752156,
+  -0.7877298640021957,0.7150624113312876,-0.9345283626365462,0.7150624113312876,
+  -0.9345283626365462,-0.7877298640021957,-0.7877298640021957,0.7150624113312876,
+  -0.9928041846925457,0.7150624113312876,-0.9928041846925457,-0.7877298640021957,
+  -0.9345283626365462,0.7150624113312876,-0.9928041846925457,0.7150624113312876,
+  -0.9928041846925457,-0.9345283626365462,-0.9345283626365462,-0.7877298640021957,
+  -0.9928041846925457,-0.7877298640021957,-0.9928041846925457,-0.9345283626365462,
+  -0.5394158555398685,0.1272767463395488,-0.6185601316512896,0.1272767463395488,
+  -0.6185601316512896,-0.5394158555398685,-0.5394158555398685,0.1272767463395488,
+  -0.9693007591483906,0.1272767463395488,-0.9693007591483906,-0.5394158555398685,
+  -0.6185601316512896,0.1272767463395488,-0.9693007591483906,0.1272767463395488,
+  -0.9693007591483906,-0.6185601316512896,-0.6185601316512896,-0.5394158555398685,
+  -0.9693007591483906,-0.5394158555398685,-0.9693007591483906,-0.6185601316512896,
+  -0.3375790229613102,-0.2647489809348278,-0.5842297239539911,-0.2647489809348278,
+  -0.5842297239539911,-0.3375790229613101,-0.3375790229613102,-0.2647489809348278,
+  -0.8134422721498711,-0.2647489809348278,-0.8134422721498710,-0.3375790229613101,
+  -0.5842297239539911,-0.2647489809348278,-0.8134422721498711,-0.2647489809348278,
+  -0.8134422721498709,-0.5842297239539911,-0.5842297239539911,-0.3375790229613101,
+  -0.8134422721498710,-0.3375790229613101,-0.8134422721498709,-0.5842297239539911,
+  -0.6473441763961341,0.4384647379634590,-0.8326410340815870,0.4384647379634590,
+  -0.8326410340815869,-0.6473441763961341,-0.6473441763961341,0.4384647379634590,
+  -0.9584795274857379,0.4384647379634590,-0.9584795274857381,-0.6473441763961341,
+  -0.8326410340815870,0.4384647379634590,-0.9584795274857379,0.4384647379634590,
+  -0.9584795274857381,-0.8326410340815869,-0.8326410340815869,-0.6473441763961341,
+  -0.9584795274857381,-0.6473441763961341,-0.9584795274857381,-0.8326410340815869,
+  -0.1254218215593164,0.0556499904305974,-0.9486684992426094,0.0556499904305974,
+  -0.9486684992426093,-0.1254218215593163,-0.1254218215593164,0.0556499904305974,
+  -0.9815596696286716,0.0556499904305974,-0.9815596696286717,-0.1254218215593164,
+  -0.9486684992426094,0.0556499904305974,-0.9815596696286716,0.0556499904305974,
+  -0.9815596696286717,-0.9486684992426093,-0.9486684992426093,-0.1254218215593163,
+  -0.9815596696286717,-0.1254218215593164,-0.9815596696286717,-0.9486684992426093,
+  -0.3104368987656717,0.0967349089896381,-0.8265565433355569,0.0967349089896381,
+  -0.8265565433355569,-0.3104368987656717,-0.3104368987656717,0.0967349089896381,
+  -0.9597414668884094,0.0967349089896381,-0.9597414668884094,-0.3104368987656718,
+  -0.8265565433355569,0.0967349089896381,-0.9597414668884094,0.0967349089896381,
+  -0.9597414668884096,-0.8265565433355569,-0.8265565433355569,-0.3104368987656717,
+  -0.9597414668884094,-0.3104368987656718,-0.9597414668884096,-0.8265565433355569,
+  -0.3454932749523028,-0.3454932749523028,-0.3454932749523028,-0.9635201751430915,
+  0.7314321731998894,-0.9104773910666297,-0.9104773910666297,-0.9104773910666297,
+  0.4831580133853819,-0.8277193377951273,-0.8277193377951273,-0.8277193377951273,
+  -0.2525758550025938,-0.5824747149991354,-0.5824747149991354,-0.5824747149991354,
+  0.9153701571824742,-0.9717900523941581,-0.9717900523941581,-0.9717900523941581,
+  0.1478927351886677,-0.5565540319117749,0.1478927351886676,-0.7956693516384463,
+  -0.5565540319117750,-0.7956693516384463,0.1478927351886676,-0.7956693516384463,
+  -0.7956693516384463,-0.5565540319117750,-0.7956693516384463,-0.7956693516384463,
+  -0.1848598966799786,-0.1848598966799786,-0.8147359469180830,-0.1848598966799786,
+  -0.1848598966799786,-0.8155442597219598,-0.1848598966799786,-0.8147359469180830,
+  -0.1848598966799786,-0.8155442597219598,-0.8147359469180830,-0.8155442597219598,
+  0.4025621919178881,-0.4652181948790095,0.4025621919178881,-0.9686719985194392,
+  -0.4652181948790096,-0.9686719985194393,0.4025621919178881,-0.9686719985194392,
+  -0.9686719985194393,-0.4652181948790096,-0.9686719985194393,-0.9686719985194393,
+  -0.0461872051158225,-0.5490072874949941,-0.5490072874949941,-0.0461872051158225,
+  -0.5490072874949941,-0.0461872051158225,-0.8557982198941891,-0.5490072874949941,
+  -0.8557982198941891,-0.5490072874949941,-0.5490072874949941,-0.8557982198941891,
+  -0.2161395412231362,-0.2188031437437084,-0.2161395412231362,-0.5972818911752156,
+  -0.2188031437437084,-0.5972818911752156,-0.2161395412231362,-0.2188031437437084,
+  -0.2161395412231362,-0.9677754238579399,-0.2188031437437084,-0.9677754238579399,
+  -0.2161395412231362,-0.5972818911752156,-0.2161395412231362,-0.9677754238579399,
+  -0.5972818911752156,-0.9677754238579399,-0.2188031437437084,-0.5972818911752156,
+  -0.2188031437437084,-0.9677754238579399,-0.5972818911752156,-0.9677754238579399,
+  0.7150624113312876,-0.7877298640021957,0.7150624113312876,-0.9345283626365462,
+  -0.7877298640021957,-0.9345283626365462,0.7150624113312876,-0.7877298640021957,
+  0.7150624113312876,-0.9928041846925457,-0.7877298640021957,-0.9928041846925457,
+  0.7150624113312876,-0.9345283626365462,0.7150624113312876,-0.9928041846925457,
+  -0.9345283626365462,-0.9928041846925457,-0.7877298640021957,-0.9345283626365462,
+  -0.7877298640021957,-0.9928041846925457,-0.9345283626365462,-0.9928041846925457,
+  0.1272767463395488,-0.5394158555398685,0.1272767463395488,-0.6185601316512896,
+  -0.5394158555398685,-0.6185601316512896,0.1272767463395488,-0.5394158555398685,
+  0.1272767463395488,-0.9693007591483906,-0.5394158555398685,-0.9693007591483906,
+  0.1272767463395488,-0.6185601316512896,0.1272767463395488,-0.9693007591483906,
+  -0.6185601316512896,-0.9693007591483906,-0.5394158555398685,-0.6185601316512896,
+  -0.5394158555398685,-0.9693007591483906,-0.6185601316512896,-0.9693007591483906,
+  -0.2647489809348279,-0.3375790229613102,-0.2647489809348278,-0.5842297239539911,
+  -0.3375790229613102,-0.5842297239539911,-0.2647489809348279,-0.3375790229613102,
+  -0.2647489809348279,-0.8134422721498711,-0.3375790229613101,-0.8134422721498709,
+  -0.2647489809348278,-0.5842297239539911,-0.2647489809348279,-0.8134422721498711,
+  -0.5842297239539911,-0.8134422721498709,-0.3375790229613102,-0.5842297239539911,
+  -0.3375790229613101,-0.8134422721498709,-0.5842297239539911,-0.8134422721498709,
+  0.4384647379634590,-0.6473441763961341,0.4384647379634590,-0.8326410340815869,
+  -0.6473441763961341,-0.8326410340815869,0.4384647379634590,-0.6473441763961341,
+  0.4384647379634590,-0.9584795274857379,-0.6473441763961341,-0.9584795274857381,
+  0.4384647379634590,-0.8326410340815869,0.4384647379634590,-0.9584795274857379,
+  -0.8326410340815869,-0.9584795274857381,-0.6473441763961341,-0.8326410340815869,
+  -0.6473441763961341,-0.9584795274857381,-0.8326410340815869,-0.9584795274857381,
+  0.0556499904305974,-0.1254218215593164,0.0556499904305974,-0.9486684992426094,
+  -0.1254218215593164,-0.9486684992426093,0.0556499904305974,-0.1254218215593164,
+  0.0556499904305974,-0.9815596696286716,-0.1254218215593164,-0.9815596696286717,
+  0.0556499904305974,-0.9486684992426094,0.0556499904305974,-0.9815596696286716,
+  -0.9486684992426093,-0.9815596696286717,-0.1254218215593164,-0.9486684992426093,
+  -0.1254218215593164,-0.9815596696286717,-0.9486684992426093,-0.9815596696286717,
+  0.0967349089896381,-0.3104368987656718,0.0967349089896381,-0.8265565433355569,
+  -0.3104368987656718,-0.8265565433355569,0.0967349089896381,-0.3104368987656718,
+  0.0967349089896381,-0.9597414668884094,-0.3104368987656718,-0.9597414668884094,
+  0.0967349089896381,-0.8265565433355569,0.0967349089896381,-0.9597414668884094,
+  -0.8265565433355569,-0.9597414668884096,-0.3104368987656718,-0.8265565433355569,
+  -0.3104368987656718,-0.9597414668884094,-0.8265565433355569,-0.9597414668884096
+};
+static const double cubature_tet_14_weights[]={
+  0.00542015155369,0.00542015155369,0.00542015155369,0.00542015155369,
+  0.00295271804459,0.00295271804459,0.00295271804459,0.00295271804459,
+  0.00775125102385,0.00775125102385,0.00775125102385,0.00775125102385,
+  0.0261673911811,0.0261673911811,0.0261673911811,0.0261673911811,
+  0.000516765054121,0.000516765054121,0.000516765054121,0.000516765054121,
+  0.0155239626296,0.0155239626296,0.0155239626296,0.0155239626296,
+  0.0155239626296,0.0155239626296,0.0155239626296,0.0155239626296,
+  0.0155239626296,0.0155239626296,0.0155239626296,0.0155239626296,
+  0.00705205731771,0.00705205731771,0.00705205731771,0.00705205731771,
+  0.00705205731771,0.00705205731771,0.00705205731771,0.00705205731771,
+  0.00705205731771,0.00705205731771,0.00705205731771,0.00705205731771,
+  0.00244144722181,0.00244144722181,0.00244144722181,0.00244144722181,
+  0.00244144722181,0.00244144722181,0.00244144722181,0.00244144722181,
+  0.00244144722181,0.00244144722181,0.00244144722181,0.00244144722181,
+  0.0109995298363,0.0109995298363,0.0109995298363,0.0109995298363,
+  0.0109995298363,0.0109995298363,0.0109995298363,0.0109995298363,
+  0.0109995298363,0.0109995298363,0.0109995298363,0.0109995298363,
+  0.00401323271294,0.00401323271294,0.00401323271294,0.00401323271294,
+  0.00401323271294,0.00401323271294,0.00401323271294,0.00401323271294,
+  0.00401323271294,0.00401323271294,0.00401323271294,0.00401323271294,
+  0.00401323271294,0.00401323271294,0.00401323271294,0.00401323271294,
+  0.00401323271294,0.00401323271294,0.00401323271294,0.00401323271294,
+  0.00401323271294,0.00401323271294,0.00401323271294,0.00401323271294,
+  0.00107295541565,0.00107295541565,0.00107295541565,0.00107295541565,
+  0.00107295541565,0.00107295541565,0.00107295541565,0.00107295541565,
+  0.00107295541565,0.00107295541565,0.00107295541565,0.00107295541565,
+  0.00107295541565,0.00107295541565,0.00107295541565,0.00107295541565,
+  0.00107295541565,0.00107295541565,0.00107295541565,0.00107295541565,
+  0.00107295541565,0.00107295541565,0.00107295541565,0.00107295541565,
+  0.0039800550118,0.0039800550118,0.0039800550118,0.0039800550118,
+  0.0039800550118,0.0039800550118,0.0039800550118,0.0039800550118,
+  0.0039800550118,0.0039800550118,0.0039800550118,0.0039800550118,
+  0.0039800550118,0.0039800550118,0.0039800550118,0.0039800550118,
+  0.0039800550118,0.0039800550118,0.0039800550118,0.0039800550118,
+  0.0039800550118,0.0039800550118,0.0039800550118,0.0039800550118,
+  0.00758613365583,0.00758613365583,0.00758613365583,0.00758613365583,
+  0.00758613365583,0.00758613365583,0.00758613365583,0.00758613365583,
+  0.00758613365583,0.00758613365583,0.00758613365583,0.00758613365583,
+  0.00758613365583,0.00758613365583,0.00758613365583,0.00758613365583,
+  0.00758613365583,0.00758613365583,0.00758613365583,0.00758613365583,
+  0.00758613365583,0.00758613365583,0.00758613365583,0.00758613365583,
+  0.00554544878381,0.00554544878381,0.00554544878381,0.00554544878381,
+  0.00554544878381,0.00554544878381,0.00554544878381,0.00554544878381,
+  0.00554544878381,0.00554544878381,0.00554544878381,0.00554544878381,
+  0.00554544878381,0.00554544878381,0.00554544878381,0.00554544878381,
+  0.00554544878381,0.00554544878381,0.00554544878381,0.00554544878381,
+  0.00554544878381,0.00554544878381,0.00554544878381,0.00554544878381,
+  0.000970985227276,0.000970985227276,0.000970985227276,0.000970985227276,
+  0.000970985227276,0.000970985227276,0.000970985227276,0.000970985227276,
+  0.000970985227276,0.000970985227276,0.000970985227276,0.000970985227276,
+  0.000970985227276,0.000970985227276,0.000970985227276,0.000970985227276,
+  0.000970985227276,0.000970985227276,0.000970985227276,0.000970985227276,
+  0.000970985227276,0.000970985227276,0.000970985227276,0.000970985227276,
+  0.00724353343599,0.00724353343599,0.00724353343599,0.00724353343599,
+  0.00724353343599,0.00724353343599,0.00724353343599,0.00724353343599,
+  0.00724353343599,0.00724353343599,0.00724353343599,0.00724353343599,
+  0.00724353343599,0.00724353343599,0.00724353343599,0.00724353343599,
+  0.00724353343599,0.00724353343599,0.00724353343599,0.00724353343599,
+  0.00724353343599,0.00724353343599,0.00724353343599,0.00724353343599
+};
+
+static const cubature_table cubature_tet_tables[]={
+  {2,4,cubature_tet_2_locs,cubature_tet_2_weights},
+  {3,8,cubature_tet_3_locs,cubature_tet_3_weights},
+  {4,14,cubature_tet_4_locs,cubature_tet_4_weights},
+  {5,14,cubature_tet_5_locs,cubature_tet_5_weights},
+  {6,24,cubature_tet_6_locs,cubature_tet_6_weights},
+  {7,35,cubature_tet_7_locs,cubature_tet_7_weights},
+  {8,46,cubature_tet_8_locs,cubature_tet_8_weights},
+  {9,61,cubature_tet_9_locs,cubature_tet_9_weights},
+  {10,81,cubature_tet_10_locs,cubature_tet_10_weights},
+  {11,109,cubature_tet_11_locs,cubature_tet_11_weights},
+  {12,140,cubature_tet_12_locs,cubature_tet_12_weights},
+  {13,171,cubature_tet_13_locs,cubature_tet_13_weights},
+  {14,236,cubature_tet_14_locs,cubature_tet_14_weights}
+};
+
+// cubature_hexa.dat
+
+static const double cubature_hexa_1_locs[]={
+  0.0,0.0,0.0
+};
+static const double cubature_hexa_1_weights[]={
+  8.0
+};
+static const double cubature_hexa_2_locs[]={
+  -0.577350269190,-0.577350269190,-0.577350269190,-0.577350269190,
+  0.577350269190,0.577350269190,0.577350269190,0.577350269190,
+  -0.577350269190,-0.577350269190,0.577350269190,0.577350269190,
+  -0.577350269190,-0.577350269190,0.577350269190,0.577350269190,
+  -0.577350269190,0.577350269190,-0.577350269190,0.577350269190,
+  -0.577350269190,0.577350269190,-0.577350269190,0.577350269190
+};
+static const double cubature_hexa_2_weights[]={
+  1.0,1.0,1.0,1.0,
+  1.0,1.0,1.0,1.0
+};
+static const double cubature_hexa_3_locs[]={
+  -0.774596669241,-0.774596669241,-0.774596669241,-0.774596669241,
+  -0.774596669241,-0.774596669241,-0.774596669241,-0.774596669241,
+  -0.774596669241,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,0.774596669241,0.774596669241,
+  0.774596669241,0.774596669241,0.774596669241,0.774596669241,
+  0.774596669241,0.774596669241,0.774596669241,-0.774596669241,
+  -0.774596669241,-0.774596669241,-0E-12,-0E-12,
+  -0E-12,0.774596669241,0.774596669241,0.774596669241,
+  -0.774596669241,-0.774596669241,-0.774596669241,-0E-12,
+  -0E-12,-0E-12,0.774596669241,0.774596669241,
+  0.774596669241,-0.774596669241,-0.774596669241,-0.774596669241,
+  -0E-12,-0E-12,-0E-12,0.774596669241,
+  0.774596669241,0.774596669241,-0.774596669241,-0E-12,
+  0.774596669241,-0.774596669241,-0E-12,0.774596669241,
+  -0.774596669241,-0E-12,0.774596669241,-0.774596669241,
+  -0E-12,0.774596669241,-0.774596669241,-0E-12,
+  0.774596669241,-0.774596669241,-0E-12,0.774596669241,
+  -0.774596669241,-0E-12,0.774596669241,-0.774596669241,
+  -0E-12,0.774596669241,-0.774596669241,-0E-12,
+  0.774596669241
+};
+static const double cubature_hexa_3_weights[]={
+  0.17146776406,0.274348422497,0.17146776406,0.274348422497,
+  0.438957475995,0.274348422497,0.17146776406,0.274348422497,
+  0.17146776406,0.274348422497,0.438957475995,0.274348422497,
+  0.438957475995,0.702331961591,0.438957475995,0.274348422497,
+  0.438957475995,0.274348422497,0.17146776406,0.274348422497,
+  0.17146776406,0.274348422497,0.438957475995,0.274348422497,
+  0.17146776406,0.274348422497,0.17146776406
+};
+static const double cubature_hexa_4_locs[]={
+  -0.861136311594,-0.861136311594,-0.861136311594,-0.861136311594,
+  -0.861136311594,-0.861136311594,-0.861136311594,-0.861136311594,
+  -0.861136311594,-0.861136311594,-0.861136311594,-0.861136311594,
+  -0.861136311594,-0.861136311594,-0.861136311594,-0.861136311594,
+  -0.339981043585,-0.339981043585,-0.339981043585,-0.339981043585,
+  -0.339981043585,-0.339981043585,-0.339981043585,-0.339981043585,
+  -0.339981043585,-0.339981043585,-0.339981043585,-0.339981043585,
+  -0.339981043585,-0.339981043585,-0.339981043585,-0.339981043585,
+  0.339981043585,0.339981043585,0.339981043585,0.339981043585,
+  0.339981043585,0.339981043585,0.339981043585,0.339981043585,
+  0.339981043585,0.339981043585,0.339981043585,0.339981043585,
+  0.339981043585,0.339981043585,0.339981043585,0.339981043585,
+  0.861136311594,0.861136311594,0.861136311594,0.861136311594,
+  0.861136311594,0.861136311594,0.861136311594,0.861136311594,
+  0.861136311594,0.861136311594,0.861136311594,0.861136311594,
+  0.861136311594,0.861136311594,0.861136311594,0.861136311594,
+  -0.861136311594,-0.861136311594,-0.861136311594,-0.861136311594,
+  -0.339981043585,-0.339981043585,-0.339981043585,-0.339981043585,
+  0.339981043585,0.339981043585,0.339981043585,0.339981043585,
+  0.861136311594,0.861136311594,0.861136311594,0.861136311594,
+  -0.861136311594,-0.861136311594,-0.861136311594,-0.861136311594,
+  -0.339981043585,-0.339981043585,-0.339981043585,-0.339981043585,
+  0.339981043585,0.339981043585,0.339981043585,0.339981043585,
+  0.861136311594,0.861136311594,0.861136311594,0.861136311594,
+  -0.861136311594,-0.861136311594,-0.861136311594,-0.861136311594,
+  -0.339981043585,-0.339981043585,-0.339981043585,-0.339981043585,
+  0.339981043585,0.339981043585,0.339981043585,0.339981043585,
+  0.861136311594,0.861136311594,0.861136311594,0.861136311594,
+  -0.861136311594,-0.861136311594,-0.861136311594,-0.861136311594,
+  -0.339981043585,-0.339981043585,-0.339981043585,-0.339981043585,
+  0.339981043585,0.339981043585,0.339981043585,0.339981043585,
+  0.861136311594,0.861136311594,0.861136311594,0.861136311594,
+  -0.861136311594,-0.339981043585,0.339981043585,0.861136311594,
+  -0.861136311594,-0.339981043585,0.339981043585,0.861136311594,
+  -0.861136311594,-0.339981043585,0.339981043585,0.861136311594,
+  -0.861136311594,-0.339981043585,0.339981043585,0.861136311594,
+  -0.861136311594,-0.339981043585,0.339981043585,0.861136311594,
+  -0.861136311594,-0.339981043585,0.339981043585,0.861136311594,
+  -0.861136311594,-0.339981043585,0.339981043585,0.861136311594,
+  -0.861136311594,-0.339981043585,0.339981043585,0.861136311594,
+  -0.861136311594,-0.339981043585,0.339981043585,0.861136311594,
+  -0.861136311594,-0.339981043585,0.339981043585,0.861136311594,
+  -0.861136311594,-0.339981043585,0.339981043585,0.861136311594,
+  -0.861136311594,-0.339981043585,0.339981043585,0.861136311594,
+  -0.861136311594,-0.339981043585,0.339981043585,0.861136311594,
+  -0.861136311594,-0.339981043585,0.339981043585,0.861136311594,
+  -0.861136311594,-0.339981043585,0.339981043585,0.861136311594,
+  -0.861136311594,-0.339981043585,0.339981043585,0.861136311594
+};
+static const double cubature_hexa_4_weights[]={
+  0.042091477491,0.078911515795,0.078911515795,0.042091477491,
+  0.078911515795,0.147940336057,0.147940336057,0.078911515795,
+  0.078911515795,0.147940336057,0.147940336057,0.078911515795,
+  0.042091477491,0.078911515795,0.078911515795,0.042091477491,
+  0.078911515795,0.147940336057,0.147940336057,0.078911515795,
+  0.147940336057,0.277352966954,0.277352966954,0.147940336057,
+  0.147940336057,0.277352966954,0.277352966954,0.147940336057,
+  0.078911515795,0.147940336057,0.147940336057,0.078911515795,
+  0.078911515795,0.147940336057,0.147940336057,0.078911515795,
+  0.147940336057,0.277352966954,0.277352966954,0.147940336057,
+  0.147940336057,0.277352966954,0.277352966954,0.147940336057,
+  0.078911515795,0.147940336057,0.147940336057,0.078911515795,
+  0.042091477491,0.078911515795,0.078911515795,0.042091477491,
+  0.078911515795,0.147940336057,0.147940336057,0.078911515795,
+  0.078911515795,0.147940336057,0.147940336057,0.078911515795,
+  0.042091477491,0.078911515795,0.078911515795,0.042091477491
+};
+static const double cubature_hexa_5_locs[]={
+  -0.906179845939,-0.906179845939,-0.906179845939,-0.906179845939,
+  -0.906179845939,-0.906179845939,-0.906179845939,-0.906179845939,
+  -0.906179845939,-0.906179845939,-0.906179845939,-0.906179845939,
+  -0.906179845939,-0.906179845939,-0.906179845939,-0.906179845939,
+  -0.906179845939,-0.906179845939,-0.906179845939,-0.906179845939,
+  -0.906179845939,-0.906179845939,-0.906179845939,-0.906179845939,
+  -0.906179845939,-0.538469310106,-0.538469310106,-0.538469310106,
+  -0.538469310106,-0.538469310106,-0.538469310106,-0.538469310106,
+  -0.538469310106,-0.538469310106,-0.538469310106,-0.538469310106,
+  -0.538469310106,-0.538469310106,-0.538469310106,-0.538469310106,
+  -0.538469310106,-0.538469310106,-0.538469310106,-0.538469310106,
+  -0.538469310106,-0.538469310106,-0.538469310106,-0.538469310106,
+  -0.538469310106,-0.538469310106,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,0.538469310106,
+  0.538469310106,0.538469310106,0.538469310106,0.538469310106,
+  0.538469310106,0.538469310106,0.538469310106,0.538469310106,
+  0.538469310106,0.538469310106,0.538469310106,0.538469310106,
+  0.538469310106,0.538469310106,0.538469310106,0.538469310106,
+  0.538469310106,0.538469310106,0.538469310106,0.538469310106,
+  0.538469310106,0.538469310106,0.538469310106,0.538469310106,
+  0.906179845939,0.906179845939,0.906179845939,0.906179845939,
+  0.906179845939,0.906179845939,0.906179845939,0.906179845939,
+  0.906179845939,0.906179845939,0.906179845939,0.906179845939,
+  0.906179845939,0.906179845939,0.906179845939,0.906179845939,
+  0.906179845939,0.906179845939,0.906179845939,0.906179845939,
+  0.906179845939,0.906179845939,0.906179845939,0.906179845939,
+  0.906179845939,-0.906179845939,-0.906179845939,-0.906179845939,
+  -0.906179845939,-0.906179845939,-0.538469310106,-0.538469310106,
+  -0.538469310106,-0.538469310106,-0.538469310106,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  0.538469310106,0.538469310106,0.538469310106,0.538469310106,
+  0.538469310106,0.906179845939,0.906179845939,0.906179845939,
+  0.906179845939,0.906179845939,-0.906179845939,-0.906179845939,
+  -0.906179845939,-0.906179845939,-0.906179845939,-0.538469310106,
+  -0.538469310106,-0.538469310106,-0.538469310106,-0.538469310106,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,0.538469310106,0.538469310106,0.538469310106,
+  0.538469310106,0.538469310106,0.906179845939,0.906179845939,
+  0.906179845939,0.906179845939,0.906179845939,-0.906179845939,
+  -0.906179845939,-0.906179845939,-0.906179845939,-0.906179845939,
+  -0.538469310106,-0.538469310106,-0.538469310106,-0.538469310106,
+  -0.538469310106,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,0.538469310106,0.538469310106,
+  0.538469310106,0.538469310106,0.538469310106,0.906179845939,
+  0.906179845939,0.906179845939,0.906179845939,0.906179845939,
+  -0.906179845939,-0.906179845939,-0.906179845939,-0.906179845939,
+  -0.906179845939,-0.538469310106,-0.538469310106,-0.538469310106,
+  -0.538469310106,-0.538469310106,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,0.538469310106,
+  0.538469310106,0.538469310106,0.538469310106,0.538469310106,
+  0.906179845939,0.906179845939,0.906179845939,0.906179845939,
+  0.906179845939,-0.906179845939,-0.906179845939,-0.906179845939,
+  -0.906179845939,-0.906179845939,-0.538469310106,-0.538469310106,
+  -0.538469310106,-0.538469310106,-0.538469310106,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  0.538469310106,0.538469310106,0.538469310106,0.538469310106,
+  0.538469310106,0.906179845939,0.906179845939,0.906179845939,
+  0.906179845939,0.906179845939,-0.906179845939,-0.538469310106,
+  -0E-12,0.538469310106,0.906179845939,-0.906179845939,
+  -0.538469310106,-0E-12,0.538469310106,0.906179845939,
+  -0.906179845939,-0.538469310106,-0E-12,0.538469310106,
+  0.906179845939,-0.906179845939,-0.538469310106,-0E-12,
+  0.538469310106,0.906179845939,-0.906179845939,-0.538469310106,
+  -0E-12,0.538469310106,0.906179845939,-0.906179845939,
+  -0.538469310106,-0E-12,0.538469310106,0.906179845939,
+  -0.906179845939,-0.538469310106,-0E-12,0.538469310106,
+  0.906179845939,-0.906179845939,-0.538469310106,-0E-12,
+  0.538469310106,0.906179845939,-0.906179845939,-0.538469310106,
+  -0E-12,0.538469310106,0.906179845939,-0.906179845939,
+  -0.538469310106,-0E-12,0.538469310106,0.906179845939,
+  -0.906179845939,-0.538469310106,-0E-12,0.538469310106,
+  0.906179845939,-0.906179845939,-0.538469310106,-0E-12,
+  0.538469310106,0.906179845939,-0.906179845939,-0.538469310106,
+  -0E-12,0.538469310106,0.906179845939,-0.906179845939,
+  -0.538469310106,-0E-12,0.538469310106,0.906179845939,
+  -0.906179845939,-0.538469310106,-0E-12,0.538469310106,
+  0.906179845939,-0.906179845939,-0.538469310106,-0E-12,
+  0.538469310106,0.906179845939,-0.906179845939,-0.538469310106,
+  -0E-12,0.538469310106,0.906179845939,-0.906179845939,
+  -0.538469310106,-0E-12,0.538469310106,0.906179845939,
+  -0.906179845939,-0.538469310106,-0E-12,0.538469310106,
+  0.906179845939,-0.906179845939,-0.538469310106,-0E-12,
+  0.538469310106,0.906179845939,-0.906179845939,-0.538469310106,
+  -0E-12,0.538469310106,0.906179845939,-0.906179845939,
+  -0.538469310106,-0E-12,0.538469310106,0.906179845939,
+  -0.906179845939,-0.538469310106,-0E-12,0.538469310106,
+  0.906179845939,-0.906179845939,-0.538469310106,-0E-12,
+  0.538469310106,0.906179845939,-0.906179845939,-0.538469310106,
+  -0E-12,0.538469310106,0.906179845939
+};
+static const double cubature_hexa_5_weights[]={
+  0.013299736421,0.026867508765,0.031934207353,0.026867508765,
+  0.013299736421,0.026867508765,0.054276491235,0.064512,
+  0.054276491235,0.026867508765,0.031934207353,0.064512,
+  0.076677730069,0.064512,0.031934207353,0.026867508765,
+  0.054276491235,0.064512,0.054276491235,0.026867508765,
+  0.013299736421,0.026867508765,0.031934207353,0.026867508765,
+  0.013299736421,0.026867508765,0.054276491235,0.064512,
+  0.054276491235,0.026867508765,0.054276491235,0.109646842455,
+  0.13032414107,0.109646842455,0.054276491235,0.064512,
+  0.13032414107,0.154900782962,0.13032414107,0.064512,
+  0.054276491235,0.109646842455,0.13032414107,0.109646842455,
+  0.054276491235,0.026867508765,0.054276491235,0.064512,
+  0.054276491235,0.026867508765,0.031934207353,0.064512,
+  0.076677730069,0.064512,0.031934207353,0.064512,
+  0.13032414107,0.154900782962,0.13032414107,0.064512,
+  0.076677730069,0.154900782962,0.184112109739,0.154900782962,
+  0.076677730069,0.064512,0.13032414107,0.154900782962,
+  0.13032414107,0.064512,0.031934207353,0.064512,
+  0.076677730069,0.064512,0.031934207353,0.026867508765,
+  0.054276491235,0.064512,0.054276491235,0.026867508765,
+  0.054276491235,0.109646842455,0.13032414107,0.109646842455,
+  0.054276491235,0.064512,0.13032414107,0.154900782962,
+  0.13032414107,0.064512,0.054276491235,0.109646842455,
+  0.13032414107,0.109646842455,0.054276491235,0.026867508765,
+  0.054276491235,0.064512,0.054276491235,0.026867508765,
+  0.013299736421,0.026867508765,0.031934207353,0.026867508765,
+  0.013299736421,0.026867508765,0.054276491235,0.064512,
+  0.054276491235,0.026867508765,0.031934207353,0.064512,
+  0.076677730069,0.064512,0.031934207353,0.026867508765,
+  0.054276491235,0.064512,0.054276491235,0.026867508765,
+  0.013299736421,0.026867508765,0.031934207353,0.026867508765,
+  0.013299736421
+};
+static const double cubature_hexa_6_locs[]={
+  -0.932469514203,-0.932469514203,-0.932469514203,-0.932469514203,
+  -0.932469514203,-0.932469514203,-0.932469514203,-0.932469514203,
+  -0.932469514203,-0.932469514203,-0.932469514203,-0.932469514203,
+  -0.932469514203,-0.932469514203,-0.932469514203,-0.932469514203,
+  -0.932469514203,-0.932469514203,-0.932469514203,-0.932469514203,
+  -0.932469514203,-0.932469514203,-0.932469514203,-0.932469514203,
+  -0.932469514203,-0.932469514203,-0.932469514203,-0.932469514203,
+  -0.932469514203,-0.932469514203,-0.932469514203,-0.932469514203,
+  -0.932469514203,-0.932469514203,-0.932469514203,-0.932469514203,
+  -0.661209386466,-0.661209386466,-0.661209386466,-0.661209386466,
+  -0.661209386466,-0.661209386466,-0.661209386466,-0.661209386466,
+  -0.661209386466,-0.661209386466,-0.661209386466,-0.661209386466,
+  -0.661209386466,-0.661209386466,-0.661209386466,-0.661209386466,
+  -0.661209386466,-0.661209386466,-0.661209386466,-0.661209386466,
+  -0.661209386466,-0.661209386466,-0.661209386466,-0.661209386466,
+  -0.661209386466,-0.661209386466,-0.661209386466,-0.661209386466,
+  -0.661209386466,-0.661209386466,-0.661209386466,-0.661209386466,
+  -0.661209386466,-0.661209386466,-0.661209386466,-0.661209386466,
+  -0.238619186083,-0.238619186083,-0.238619186083,-0.238619186083,
+  -0.238619186083,-0.238619186083,-0.238619186083,-0.238619186083,
+  -0.238619186083,-0.238619186083,-0.238619186083,-0.238619186083,
+  -0.238619186083,-0.238619186083,-0.238619186083,-0.238619186083,
+  -0.238619186083,-0.238619186083,-0.238619186083,-0.238619186083,
+  -0.238619186083,-0.238619186083,-0.238619186083,-0.238619186083,
+  -0.238619186083,-0.238619186083,-0.238619186083,-0.238619186083,
+  -0.238619186083,-0.238619186083,-0.238619186083,-0.238619186083,
+  -0.238619186083,-0.238619186083,-0.238619186083,-0.238619186083,
+  0.238619186083,0.238619186083,0.238619186083,0.238619186083,
+  0.238619186083,0.238619186083,0.238619186083,0.238619186083,
+  0.238619186083,0.238619186083,0.238619186083,0.238619186083,
+  0.238619186083,0.238619186083,0.238619186083,0.238619186083,
+  0.238619186083,0.238619186083,0.238619186083,0.238619186083,
+  0.238619186083,0.238619186083,0.238619186083,0.238619186083,
+  0.238619186083,0.238619186083,0.238619186083,0.238619186083,
+  0.238619186083,0.238619186083,0.238619186083,0.238619186083,
+  0.238619186083,0.238619186083,0.238619186083,0.238619186083,
+  0.661209386466,0.661209386466,0.661209386466,0.661209386466,
+  0.661209386466,0.661209386466,0.661209386466,0.661209386466,
+  0.661209386466,0.661209386466,0.661209386466,0.661209386466,
+  0.661209386466,0.661209386466,0.661209386466,0.661209386466,
+  0.661209386466,0.661209386466,0.661209386466,0.661209386466,
+  0.661209386466,0.661209386466,0.661209386466,0.661209386466,
+  0.661209386466,0.661209386466,0.661209386466,0.661209386466,
+  0.661209386466,0.661209386466,0.661209386466,0.661209386466,
+  0.661209386466,0.661209386466,0.661209386466,0.661209386466,
+  0.932469514203,0.932469514203,0.932469514203,0.932469514203,
+  0.932469514203,0.932469514203,0.932469514203,0.932469514203,
+  0.932469514203,0.932469514203,0.932469514203,0.932469514203,
+  0.932469514203,0.932469514203,0.932469514203,0.932469514203,
+  0.932469514203,0.932469514203,0.932469514203,0.932469514203,
+  0.932469514203,0.932469514203,0.932469514203,0.932469514203,
+  0.932469514203,0.932469514203,0.932469514203,0.932469514203,
+  0.932469514203,0.932469514203,0.932469514203,0.932469514203,
+  0.932469514203,0.932469514203,0.932469514203,0.932469514203,
+  -0.932469514203,-0.932469514203,-0.932469514203,-0.932469514203,
+  -0.932469514203,-0.932469514203,-0.661209386466,-0.661209386466,
+  -0.661209386466,-0.661209386466,-0.661209386466,-0.661209386466,
+  -0.238619186083,-0.238619186083,-0.238619186083,-0.238619186083,
+  -0.238619186083,-0.238619186083,0.238619186083,0.238619186083,
+  0.238619186083,0.238619186083,0.238619186083,0.238619186083,
+  0.661209386466,0.661209386466,0.661209386466,0.661209386466,
+  0.661209386466,0.661209386466,0.932469514203,0.932469514203,
+  0.932469514203,0.932469514203,0.932469514203,0.932469514203,
+  -0.932469514203,-0.932469514203,-0.932469514203,-0.932469514203,
+  -0.932469514203,-0.932469514203,-0.661209386466,-0.661209386466,
+  -0.661209386466,-0.661209386466,-0.661209386466,-0.661209386466,
+  -0.238619186083,-0.238619186083,-0.238619186083,-0.238619186083,
+  -0.238619186083,-0.238619186083,0.238619186083,0.238619186083,
+  0.238619186083,0.238619186083,0.238619186083,0.238619186083,
+  0.661209386466,0.661209386466,0.661209386466,0.661209386466,
+  0.661209386466,0.661209386466,0.932469514203,0.932469514203,
+  0.932469514203,0.932469514203,0.932469514203,0.932469514203,
+  -0.932469514203,-0.932469514203,-0.932469514203,-0.932469514203,
+  -0.932469514203,-0.932469514203,-0.661209386466,-0.661209386466,
+  -0.661209386466,-0.661209386466,-0.661209386466,-0.661209386466,
+  -0.238619186083,-0.238619186083,-0.238619186083,-0.238619186083,
+  -0.238619186083,-0.238619186083,0.238619186083,0.238619186083,
+  0.238619186083,0.238619186083,0.238619186083,0.238619186083,
+  0.661209386466,0.661209386466,0.661209386466,0.661209386466,
+  0.661209386466,0.661209386466,0.932469514203,0.932469514203,
+  0.932469514203,0.932469514203,0.932469514203,0.932469514203,
+  -0.932469514203,-0.932469514203,-0.932469514203,-0.932469514203,
+  -0.932469514203,-0.932469514203,-0.661209386466,-0.661209386466,
+  -0.661209386466,-0.661209386466,-0.661209386466,-0.661209386466,
+  -0.238619186083,-0.238619186083,-0.238619186083,-0.238619186083,
+  -0.238619186083,-0.238619186083,0.238619186083,0.238619186083,
+  0.238619186083,0.238619186083,0.238619186083,0.238619186083,
+  0.661209386466,0.661209386466,0.661209386466,0.661209386466,
+  0.661209386466,0.661209386466,0.932469514203,0.932469514203,
+  0.932469514203,0.932469514203,0.932469514203,0.932469514203,
+  -0.932469514203,-0.932469514203,-0.932469514203,-0.932469514203,
+  -0.932469514203,-0.932469514203,-0.661209386466,-0.661209386466,
+  -0.661209386466,-0.661209386466,-0.661209386466,-0.661209386466,
+  -0.238619186083,-0.238619186083,-0.238619186083,-0.238619186083,
+  -0.238619186083,-0.238619186083,0.238619186083,0.238619186083,
+  0.238619186083,0.238619186083,0.238619186083,0.238619186083,
+  0.661209386466,0.661209386466,0.661209386466,0.661209386466,
+  0.661209386466,0.661209386466,0.932469514203,0.932469514203,
+  0.932469514203,0.932469514203,0.932469514203,0.932469514203,
+  -0.932469514203,-0.932469514203,-0.932469514203,-0.932469514203,
+  -0.932469514203,-0.932469514203,-0.661209386466,-0.661209386466,
+  -0.661209386466,-0.661209386466,-0.661209386466,-0.661209386466,
+  -0.238619186083,-0.238619186083,-0.238619186083,-0.238619186083,
+  -0.238619186083,-0.238619186083,0.238619186083,0.238619186083,
+  0.238619186083,0.238619186083,0.238619186083,0.238619186083,
+  0.661209386466,0.661209386466,0.661209386466,0.661209386466,
+  0.661209386466,0.661209386466,0.932469514203,0.932469514203,
+  0.932469514203,0.932469514203,0.932469514203,0.932469514203,
+  -0.932469514203,-0.661209386466,-0.238619186083,0.238619186083,
+  0.661209386466,0.932469514203,-0.932469514203,-0.661209386466,
+  -0.238619186083,0.238619186083,0.661209386466,0.932469514203,
+  -0.932469514203,-0.661209386466,-0.238619186083,0.238619186083,
+  0.661209386466,0.932469514203,-0.932469514203,-0.661209386466,
+  -0.238619186083,0.238619186083,0.661209386466,0.932469514203,
+  -0.932469514203,-0.661209386466,-0.238619186083,0.238619186083,
+  0.661209386466,0.932469514203,-0.932469514203,-0.661209386466,
+  -0.238619186083,0.238619186083,0.661209386466,0.932469514203,
+  -0.932469514203,-0.661209386466,-0.238619186083,0.238619186083,
+  0.661209386466,0.932469514203,-0.932469514203,-0.661209386466,
+  -0.238619186083,0.238619186083,0.661209386466,0.932469514203,
+  -0.932469514203,-0.661209386466,-0.238619186083,0.238619186083,
+  0.661209386466,0.932469514203,-0.932469514203,-0.661209386466,
+  -0.238619186083,0.238619186083,0.661209386466,0.932469514203,
+  -0.932469514203,-0.661209386466,-0.238619186083,0.238619186083,
+  0.661209386466,0.932469514203,-0.932469514203,-0.661209386466,
+  -0.238619186083,0.238619186083,0.661209386466,0.932469514203,
+  -0.932469514203,-0.661209386466,-0.238619186083,0.238619186083,
+  0.661209386466,0.932469514203,-0.932469514203,-0.661209386466,
+  -0.238619186083,0.238619186083,0.661209386466,0.932469514203,
+  -0.932469514203,-0.661209386466,-0.238619186083,0.238619186083,
+  0.661209386466,0.932469514203,-0.932469514203,-0.661209386466,
+  -0.238619186083,0.238619186083,0.661209386466,0.932469514203,
+  -0.932469514203,-0.661209386466,-0.238619186083,0.238619186083,
+  0.661209386466,0.932469514203,-0.932469514203,-0.661209386466,
+  -0.238619186083,0.238619186083,0.661209386466,0.932469514203,
+  -0.932469514203,-0.661209386466,-0.238619186083,0.238619186083,
+  0.661209386466,0.932469514203,-0.932469514203,-0.661209386466,
+  -0.238619186083,0.238619186083,0.661209386466,0.932469514203,
+  -0.932469514203,-0.661209386466,-0.238619186083,0.238619186083,
+  0.661209386466,0.932469514203,-0.932469514203,-0.661209386466,
+  -0.238619186083,0.238619186083,0.661209386466,0.932469514203,
+  -0.932469514203,-0.661209386466,-0.238619186083,0.238619186083,
+  0.661209386466,0.932469514203,-0.932469514203,-0.661209386466,
+  -0.238619186083,0.238619186083,0.661209386466,0.932469514203,
+  -0.932469514203,-0.661209386466,-0.238619186083,0.238619186083,
+  0.661209386466,0.932469514203,-0.932469514203,-0.661209386466,
+  -0.238619186083,0.238619186083,0.661209386466,0.932469514203,
+  -0.932469514203,-0.661209386466,-0.238619186083,0.238619186083,
+  0.661209386466,0.932469514203,-0.932469514203,-0.661209386466,
+  -0.238619186083,0.238619186083,0.661209386466,0.932469514203,
+  -0.932469514203,-0.661209386466,-0.238619186083,0.238619186083,
+  0.661209386466,0.932469514203,-0.932469514203,-0.661209386466,
+  -0.238619186083,0.238619186083,0.661209386466,0.932469514203,
+  -0.932469514203,-0.661209386466,-0.238619186083,0.238619186083,
+  0.661209386466,0.932469514203,-0.932469514203,-0.661209386466,
+  -0.238619186083,0.238619186083,0.661209386466,0.932469514203,
+  -0.932469514203,-0.661209386466,-0.238619186083,0.238619186083,
+  0.661209386466,0.932469514203,-0.932469514203,-0.661209386466,
+  -0.238619186083,0.238619186083,0.661209386466,0.932469514203,
+  -0.932469514203,-0.661209386466,-0.238619186083,0.238619186083,
+  0.661209386466,0.932469514203,-0.932469514203,-0.661209386466,
+  -0.238619186083,0.238619186083,0.661209386466,0.932469514203
+};
+static const double cubature_hexa_6_weights[]={
+  0.005028730496,0.010589103162,0.013734248031,0.013734248031,
+  0.010589103162,0.005028730496,0.010589103162,0.022297696383,
+  0.028920493827,0.028920493827,0.022297696383,0.010589103162,
+  0.013734248031,0.028920493827,0.03751037546,0.03751037546,
+  0.028920493827,0.013734248031,0.013734248031,0.028920493827,
+  0.03751037546,0.03751037546,0.028920493827,0.013734248031,
+  0.010589103162,0.022297696383,0.028920493827,0.028920493827,
+  0.022297696383,0.010589103162,0.005028730496,0.010589103162,
+  0.013734248031,0.013734248031,0.010589103162,0.005028730496,
+  0.010589103162,0.022297696383,0.028920493827,0.028920493827,
+  0.022297696383,0.010589103162,0.022297696383,0.046952726436,
+  0.060898489769,0.060898489769,0.046952726436,0.022297696383,
+  0.028920493827,0.060898489769,0.078986383491,0.078986383491,
+  0.060898489769,0.028920493827,0.028920493827,0.060898489769,
+  0.078986383491,0.078986383491,0.060898489769,0.028920493827,
+  0.022297696383,0.046952726436,0.060898489769,0.060898489769,
+  0.046952726436,0.022297696383,0.010589103162,0.022297696383,
+  0.028920493827,0.028920493827,0.022297696383,0.010589103162,
+  0.013734248031,0.028920493827,0.03751037546,0.03751037546,
+  0.028920493827,0.013734248031,0.028920493827,0.060898489769,
+  0.078986383491,0.078986383491,0.060898489769,0.028920493827,
+  0.03751037546,0.078986383491,0.102446691217,0.102446691217,
+  0.078986383491,0.03751037546,0.03751037546,0.078986383491,
+  0.102446691217,0.102446691217,0.078986383491,0.03751037546,
+  0.028920493827,0.060898489769,0.078986383491,0.078986383491,
+  0.060898489769,0.028920493827,0.013734248031,0.028920493827,
+  0.03751037546,0.03751037546,0.028920493827,0.013734248031,
+  0.013734248031,0.028920493827,0.03751037546,0.03751037546,
+  0.028920493827,0.013734248031,0.028920493827,0.060898489769,
+  0.078986383491,0.078986383491,0.060898489769,0.028920493827,
+  0.03751037546,0.078986383491,0.102446691217,0.102446691217,
+  0.078986383491,0.03751037546,0.03751037546,0.078986383491,
+  0.102446691217,0.102446691217,0.078986383491,0.03751037546,
+  0.028920493827,0.060898489769,0.078986383491,0.078986383491,
+  0.060898489769,0.028920493827,0.013734248031,0.028920493827,
+  0.03751037546,0.03751037546,0.028920493827,0.013734248031,
+  0.010589103162,0.022297696383,0.028920493827,0.028920493827,
+  0.022297696383,0.010589103162,0.022297696383,0.046952726436,
+  0.060898489769,0.060898489769,0.046952726436,0.022297696383,
+  0.028920493827,0.060898489769,0.078986383491,0.078986383491,
+  0.060898489769,0.028920493827,0.028920493827,0.060898489769,
+  0.078986383491,0.078986383491,0.060898489769,0.028920493827,
+  0.022297696383,0.046952726436,0.060898489769,0.060898489769,
+  0.046952726436,0.022297696383,0.010589103162,0.022297696383,
+  0.028920493827,0.028920493827,0.022297696383,0.010589103162,
+  0.005028730496,0.010589103162,0.013734248031,0.013734248031,
+  0.010589103162,0.005028730496,0.010589103162,0.022297696383,
+  0.028920493827,0.028920493827,0.022297696383,0.010589103162,
+  0.013734248031,0.028920493827,0.03751037546,0.03751037546,
+  0.028920493827,0.013734248031,0.013734248031,0.028920493827,
+  0.03751037546,0.03751037546,0.028920493827,0.013734248031,
+  0.010589103162,0.022297696383,0.028920493827,0.028920493827,
+  0.022297696383,0.010589103162,0.005028730496,0.010589103162,
+  0.013734248031,0.013734248031,0.010589103162,0.005028730496
+};
+static const double cubature_hexa_7_locs[]={
+  -0.949107912343,-0.949107912343,-0.949107912343,-0.949107912343,
+  -0.949107912343,-0.949107912343,-0.949107912343,-0.949107912343,
+  -0.949107912343,-0.949107912343,-0.949107912343,-0.949107912343,
+  -0.949107912343,-0.949107912343,-0.949107912343,-0.949107912343,
+  -0.949107912343,-0.949107912343,-0.949107912343,-0.949107912343,
+  -0.949107912343,-0.949107912343,-0.949107912343,-0.949107912343,
+  -0.949107912343,-0.949107912343,-0.949107912343,-0.949107912343,
+  -0.949107912343,-0.949107912343,-0.949107912343,-0.949107912343,
+  -0.949107912343,-0.949107912343,-0.949107912343,-0.949107912343,
+  -0.949107912343,-0.949107912343,-0.949107912343,-0.949107912343,
+  -0.949107912343,-0.949107912343,-0.949107912343,-0.949107912343,
+  -0.949107912343,-0.949107912343,-0.949107912343,-0.949107912343,
+  -0.949107912343,-0.741531185599,-0.741531185599,-0.741531185599,
+  -0.741531185599,-0.741531185599,-0.741531185599,-0.741531185599,
+  -0.741531185599,-0.741531185599,-0.741531185599,-0.741531185599,
+  -0.741531185599,-0.741531185599,-0.741531185599,-0.741531185599,
+  -0.741531185599,-0.741531185599,-0.741531185599,-0.741531185599,
+  -0.741531185599,-0.741531185599,-0.741531185599,-0.741531185599,
+  -0.741531185599,-0.741531185599,-0.741531185599,-0.741531185599,
+  -0.741531185599,-0.741531185599,-0.741531185599,-0.741531185599,
+  -0.741531185599,-0.741531185599,-0.741531185599,-0.741531185599,
+  -0.741531185599,-0.741531185599,-0.741531185599,-0.741531185599,
+  -0.741531185599,-0.741531185599,-0.741531185599,-0.741531185599,
+  -0.741531185599,-0.741531185599,-0.741531185599,-0.741531185599,
+  -0.741531185599,-0.741531185599,-0.405845151377,-0.405845151377,
+  -0.405845151377,-0.405845151377,-0.405845151377,-0.405845151377,
+  -0.405845151377,-0.405845151377,-0.405845151377,-0.405845151377,
+  -0.405845151377,-0.405845151377,-0.405845151377,-0.405845151377,
+  -0.405845151377,-0.405845151377,-0.405845151377,-0.405845151377,
+  -0.405845151377,-0.405845151377,-0.405845151377,-0.405845151377,
+  -0.405845151377,-0.405845151377,-0.405845151377,-0.405845151377,
+  -0.405845151377,-0.405845151377,-0.405845151377,-0.405845151377,
+  -0.405845151377,-0.405845151377,-0.405845151377,-0.405845151377,
+  -0.405845151377,-0.405845151377,-0.405845151377,-0.405845151377,
+  -0.405845151377,-0.405845151377,-0.405845151377,-0.405845151377,
+  -0.405845151377,-0.405845151377,-0.405845151377,-0.405845151377,
+  -0.405845151377,-0.405845151377,-0.405845151377,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0.405845151377,0.405845151377,0.405845151377,0.405845151377,
+  0.405845151377,0.405845151377,0.405845151377,0.405845151377,
+  0.405845151377,0.405845151377,0.405845151377,0.405845151377,
+  0.405845151377,0.405845151377,0.405845151377,0.405845151377,
+  0.405845151377,0.405845151377,0.405845151377,0.405845151377,
+  0.405845151377,0.405845151377,0.405845151377,0.405845151377,
+  0.405845151377,0.405845151377,0.405845151377,0.405845151377,
+  0.405845151377,0.405845151377,0.405845151377,0.405845151377,
+  0.405845151377,0.405845151377,0.405845151377,0.405845151377,
+  0.405845151377,0.405845151377,0.405845151377,0.405845151377,
+  0.405845151377,0.405845151377,0.405845151377,0.405845151377,
+  0.405845151377,0.405845151377,0.405845151377,0.405845151377,
+  0.405845151377,0.741531185599,0.741531185599,0.741531185599,
+  0.741531185599,0.741531185599,0.741531185599,0.741531185599,
+  0.741531185599,0.741531185599,0.741531185599,0.741531185599,
+  0.741531185599,0.741531185599,0.741531185599,0.741531185599,
+  0.741531185599,0.741531185599,0.741531185599,0.741531185599,
+  0.741531185599,0.741531185599,0.741531185599,0.741531185599,
+  0.741531185599,0.741531185599,0.741531185599,0.741531185599,
+  0.741531185599,0.741531185599,0.741531185599,0.741531185599,
+  0.741531185599,0.741531185599,0.741531185599,0.741531185599,
+  0.741531185599,0.741531185599,0.741531185599,0.741531185599,
+  0.741531185599,0.741531185599,0.741531185599,0.741531185599,
+  0.741531185599,0.741531185599,0.741531185599,0.741531185599,
+  0.741531185599,0.741531185599,0.949107912343,0.949107912343,
+  0.949107912343,0.949107912343,0.949107912343,0.949107912343,
+  0.949107912343,0.949107912343,0.949107912343,0.949107912343,
+  0.949107912343,0.949107912343,0.949107912343,0.949107912343,
+  0.949107912343,0.949107912343,0.949107912343,0.949107912343,
+  0.949107912343,0.949107912343,0.949107912343,0.949107912343,
+  0.949107912343,0.949107912343,0.949107912343,0.949107912343,
+  0.949107912343,0.949107912343,0.949107912343,0.949107912343,
+  0.949107912343,0.949107912343,0.949107912343,0.949107912343,
+  0.949107912343,0.949107912343,0.949107912343,0.949107912343,
+  0.949107912343,0.949107912343,0.949107912343,0.949107912343,
+  0.949107912343,0.949107912343,0.949107912343,0.949107912343,
+  0.949107912343,0.949107912343,0.949107912343,-0.949107912343,
+  -0.949107912343,-0.949107912343,-0.949107912343,-0.949107912343,
+  -0.949107912343,-0.949107912343,-0.741531185599,-0.741531185599,
+  -0.741531185599,-0.741531185599,-0.741531185599,-0.741531185599,
+  -0.741531185599,-0.405845151377,-0.405845151377,-0.405845151377,
+  -0.405845151377,-0.405845151377,-0.405845151377,-0.405845151377,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0.405845151377,
+  0.405845151377,0.405845151377,0.405845151377,0.405845151377,
+  0.405845151377,0.405845151377,0.741531185599,0.741531185599,
+  0.741531185599,0.741531185599,0.741531185599,0.741531185599,
+  0.741531185599,0.949107912343,0.949107912343,0.949107912343,
+  0.949107912343,0.949107912343,0.949107912343,0.949107912343,
+  -0.949107912343,-0.949107912343,-0.949107912343,-0.949107912343,
+  -0.949107912343,-0.949107912343,-0.949107912343,-0.741531185599,
+  -0.741531185599,-0.741531185599,-0.741531185599,-0.741531185599,
+  -0.741531185599,-0.741531185599,-0.405845151377,-0.405845151377,
+  -0.405845151377,-0.405845151377,-0.405845151377,-0.405845151377,
+  -0.405845151377,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0.405845151377,0.405845151377,0.405845151377,0.405845151377,
+  0.405845151377,0.405845151377,0.405845151377,0.741531185599,
+  0.741531185599,0.741531185599,0.741531185599,0.741531185599,
+  0.741531185599,0.741531185599,0.949107912343,0.949107912343,
+  0.949107912343,0.949107912343,0.949107912343,0.949107912343,
+  0.949107912343,-0.949107912343,-0.949107912343,-0.949107912343,
+  -0.949107912343,-0.949107912343,-0.949107912343,-0.949107912343,
+  -0.741531185599,-0.741531185599,-0.741531185599,-0.741531185599,
+  -0.741531185599,-0.741531185599,-0.741531185599,-0.405845151377,
+  -0.405845151377,-0.405845151377,-0.405845151377,-0.405845151377,
+  -0.405845151377,-0.405845151377,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0.405845151377,0.405845151377,0.405845151377,
+  0.405845151377,0.405845151377,0.405845151377,0.405845151377,
+  0.741531185599,0.741531185599,0.741531185599,0.741531185599,
+  0.741531185599,0.741531185599,0.741531185599,0.949107912343,
+  0.949107912343,0.949107912343,0.949107912343,0.949107912343,
+  0.949107912343,0.949107912343,-0.949107912343,-0.949107912343,
+  -0.949107912343,-0.949107912343,-0.949107912343,-0.949107912343,
+  -0.949107912343,-0.741531185599,-0.741531185599,-0.741531185599,
+  -0.741531185599,-0.741531185599,-0.741531185599,-0.741531185599,
+  -0.405845151377,-0.405845151377,-0.405845151377,-0.405845151377,
+  -0.405845151377,-0.405845151377,-0.405845151377,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0.405845151377,0.405845151377,
+  0.405845151377,0.405845151377,0.405845151377,0.405845151377,
+  0.405845151377,0.741531185599,0.741531185599,0.741531185599,
+  0.741531185599,0.741531185599,0.741531185599,0.741531185599,
+  0.949107912343,0.949107912343,0.949107912343,0.949107912343,
+  0.949107912343,0.949107912343,0.949107912343,-0.949107912343,
+  -0.949107912343,-0.949107912343,-0.949107912343,-0.949107912343,
+  -0.949107912343,-0.949107912343,-0.741531185599,-0.741531185599,
+  -0.741531185599,-0.741531185599,-0.741531185599,-0.741531185599,
+  -0.741531185599,-0.405845151377,-0.405845151377,-0.405845151377,
+  -0.405845151377,-0.405845151377,-0.405845151377,-0.405845151377,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0.405845151377,
+  0.405845151377,0.405845151377,0.405845151377,0.405845151377,
+  0.405845151377,0.405845151377,0.741531185599,0.741531185599,
+  0.741531185599,0.741531185599,0.741531185599,0.741531185599,
+  0.741531185599,0.949107912343,0.949107912343,0.949107912343,
+  0.949107912343,0.949107912343,0.949107912343,0.949107912343,
+  -0.949107912343,-0.949107912343,-0.949107912343,-0.949107912343,
+  -0.949107912343,-0.949107912343,-0.949107912343,-0.741531185599,
+  -0.741531185599,-0.741531185599,-0.741531185599,-0.741531185599,
+  -0.741531185599,-0.741531185599,-0.405845151377,-0.405845151377,
+  -0.405845151377,-0.405845151377,-0.405845151377,-0.405845151377,
+  -0.405845151377,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0.405845151377,0.405845151377,0.405845151377,0.405845151377,
+  0.405845151377,0.405845151377,0.405845151377,0.741531185599,
+  0.741531185599,0.741531185599,0.741531185599,0.741531185599,
+  0.741531185599,0.741531185599,0.949107912343,0.949107912343,
+  0.949107912343,0.949107912343,0.949107912343,0.949107912343,
+  0.949107912343,-0.949107912343,-0.949107912343,-0.949107912343,
+  -0.949107912343,-0.949107912343,-0.949107912343,-0.949107912343,
+  -0.741531185599,-0.741531185599,-0.741531185599,-0.741531185599,
+  -0.741531185599,-0.741531185599,-0.741531185599,-0.405845151377,
+  -0.405845151377,-0.405845151377,-0.405845151377,-0.405845151377,
+  -0.405845151377,-0.405845151377,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0.405845151377,0.405845151377,0.405845151377,
+  0.405845151377,0.405845151377,0.405845151377,0.405845151377,
+  0.741531185599,0.741531185599,0.741531185599,0.741531185599,
+  0.741531185599,0.741531185599,0.741531185599,0.949107912343,
+  0.949107912343,0.949107912343,0.949107912343,0.949107912343,
+  0.949107912343,0.949107912343,-0.949107912343,-0.741531185599,
+  -0.405845151377,0E-12,0.405845151377,0.741531185599,
+  0.949107912343,-0.949107912343,-0.741531185599,-0.405845151377,
+  0E-12,0.405845151377,0.741531185599,0.949107912343,
+  -0.949107912343,-0.741531185599,-0.405845151377,0E-12,
+  0.405845151377,0.741531185599,0.949107912343,-0.949107912343,
+  -0.741531185599,-0.405845151377,0E-12,0.405845151377,
+  0.741531185599,0.949107912343,-0.949107912343,-0.741531185599,
+  -0.405845151377,0E-12,0.405845151377,0.741531185599,
+  0.949107912343,-0.949107912343,-0.741531185599,-0.405845151377,
+  0E-12,0.405845151377,0.741531185599,0.949107912343,
+  -0.949107912343,-0.741531185599,-0.405845151377,0E-12,
+  0.405845151377,0.741531185599,0.949107912343,-0.949107912343,
+  -0.741531185599,-0.405845151377,0E-12,0.405845151377,
+  0.741531185599,0.949107912343,-0.949107912343,-0.741531185599,
+  -0.405845151377,0E-12,0.405845151377,0.741531185599,
+  0.949107912343,-0.949107912343,-0.741531185599,-0.405845151377,
+  0E-12,0.405845151377,0.741531185599,0.949107912343,
+  -0.949107912343,-0.741531185599,-0.405845151377,0E-12,
+  0.405845151377,0.741531185599,0.949107912343,-0.949107912343,
+  -0.741531185599,-0.405845151377,0E-12,0.405845151377,
+  0.741531185599,0.949107912343,-0.949107912343,-0.741531185599,
+  -0.405845151377,0E-12,0.405845151377,0.741531185599,
+  0.949107912343,-0.949107912343,-0.741531185599,-0.405845151377,
+  0E-12,0.405845151377,0.741531185599,0.949107912343,
+  -0.949107912343,-0.741531185599,-0.405845151377,0E-12,
+  0.405845151377,0.741531185599,0.949107912343,-0.949107912343,
+  -0.741531185599,-0.405845151377,0E-12,0.405845151377,
+  0.741531185599,0.949107912343,-0.949107912343,-0.741531185599,
+  -0.405845151377,0E-12,0.405845151377,0.741531185599,
+  0.949107912343,-0.949107912343,-0.741531185599,-0.405845151377,
+  0E-12,0.405845151377,0.741531185599,0.949107912343,
+  -0.949107912343,-0.741531185599,-0.405845151377,0E-12,
+  0.405845151377,0.741531185599,0.949107912343,-0.949107912343,
+  -0.741531185599,-0.405845151377,0E-12,0.405845151377,
+  0.741531185599,0.949107912343,-0.949107912343,-0.741531185599,
+  -0.405845151377,0E-12,0.405845151377,0.741531185599,
+  0.949107912343,-0.949107912343,-0.741531185599,-0.405845151377,
+  0E-12,0.405845151377,0.741531185599,0.949107912343,
+  -0.949107912343,-0.741531185599,-0.405845151377,0E-12,
+  0.405845151377,0.741531185599,0.949107912343,-0.949107912343,
+  -0.741531185599,-0.405845151377,0E-12,0.405845151377,
+  0.741531185599,0.949107912343,-0.949107912343,-0.741531185599,
+  -0.405845151377,0E-12,0.405845151377,0.741531185599,
+  0.949107912343,-0.949107912343,-0.741531185599,-0.405845151377,
+  0E-12,0.405845151377,0.741531185599,0.949107912343,
+  -0.949107912343,-0.741531185599,-0.405845151377,0E-12,
+  0.405845151377,0.741531185599,0.949107912343,-0.949107912343,
+  -0.741531185599,-0.405845151377,0E-12,0.405845151377,
+  0.741531185599,0.949107912343,-0.949107912343,-0.741531185599,
+  -0.405845151377,0E-12,0.405845151377,0.741531185599,
+  0.949107912343,-0.949107912343,-0.741531185599,-0.405845151377,
+  0E-12,0.405845151377,0.741531185599,0.949107912343,
+  -0.949107912343,-0.741531185599,-0.405845151377,0E-12,
+  0.405845151377,0.741531185599,0.949107912343,-0.949107912343,
+  -0.741531185599,-0.405845151377,0E-12,0.405845151377,
+  0.741531185599,0.949107912343,-0.949107912343,-0.741531185599,
+  -0.405845151377,0E-12,0.405845151377,0.741531185599,
+  0.949107912343,-0.949107912343,-0.741531185599,-0.405845151377,
+  0E-12,0.405845151377,0.741531185599,0.949107912343,
+  -0.949107912343,-0.741531185599,-0.405845151377,0E-12,
+  0.405845151377,0.741531185599,0.949107912343,-0.949107912343,
+  -0.741531185599,-0.405845151377,0E-12,0.405845151377,
+  0.741531185599,0.949107912343,-0.949107912343,-0.741531185599,
+  -0.405845151377,0E-12,0.405845151377,0.741531185599,
+  0.949107912343,-0.949107912343,-0.741531185599,-0.405845151377,
+  0E-12,0.405845151377,0.741531185599,0.949107912343,
+  -0.949107912343,-0.741531185599,-0.405845151377,0E-12,
+  0.405845151377,0.741531185599,0.949107912343,-0.949107912343,
+  -0.741531185599,-0.405845151377,0E-12,0.405845151377,
+  0.741531185599,0.949107912343,-0.949107912343,-0.741531185599,
+  -0.405845151377,0E-12,0.405845151377,0.741531185599,
+  0.949107912343,-0.949107912343,-0.741531185599,-0.405845151377,
+  0E-12,0.405845151377,0.741531185599,0.949107912343,
+  -0.949107912343,-0.741531185599,-0.405845151377,0E-12,
+  0.405845151377,0.741531185599,0.949107912343,-0.949107912343,
+  -0.741531185599,-0.405845151377,0E-12,0.405845151377,
+  0.741531185599,0.949107912343,-0.949107912343,-0.741531185599,
+  -0.405845151377,0E-12,0.405845151377,0.741531185599,
+  0.949107912343,-0.949107912343,-0.741531185599,-0.405845151377,
+  0E-12,0.405845151377,0.741531185599,0.949107912343,
+  -0.949107912343,-0.741531185599,-0.405845151377,0E-12,
+  0.405845151377,0.741531185599,0.949107912343,-0.949107912343,
+  -0.741531185599,-0.405845151377,0E-12,0.405845151377,
+  0.741531185599,0.949107912343,-0.949107912343,-0.741531185599,
+  -0.405845151377,0E-12,0.405845151377,0.741531185599,
+  0.949107912343
+};
+static const double cubature_hexa_7_weights[]={
+  0.002170991099,0.004689640299,0.006401898735,0.007007652661,
+  0.006401898735,0.004689640299,0.002170991099,0.004689640299,
+  0.010130270057,0.013828984515,0.015137496567,0.013828984515,
+  0.010130270057,0.004689640299,0.006401898735,0.013828984515,
+  0.018878155432,0.02066442498,0.018878155432,0.013828984515,
+  0.006401898735,0.007007652661,0.015137496567,0.02066442498,
+  0.0226197131,0.02066442498,0.015137496567,0.007007652661,
+  0.006401898735,0.013828984515,0.018878155432,0.02066442498,
+  0.018878155432,0.013828984515,0.006401898735,0.004689640299,
+  0.010130270057,0.013828984515,0.015137496567,0.013828984515,
+  0.010130270057,0.004689640299,0.002170991099,0.004689640299,
+  0.006401898735,0.007007652661,0.006401898735,0.004689640299,
+  0.002170991099,0.004689640299,0.010130270057,0.013828984515,
+  0.015137496567,0.013828984515,0.010130270057,0.004689640299,
+  0.010130270057,0.02188278096,0.029872514486,0.03269908105,
+  0.029872514486,0.02188278096,0.010130270057,0.013828984515,
+  0.029872514486,0.040779420283,0.044638008951,0.040779420283,
+  0.029872514486,0.013828984515,0.015137496567,0.03269908105,
+  0.044638008951,0.048861701056,0.044638008951,0.03269908105,
+  0.015137496567,0.013828984515,0.029872514486,0.040779420283,
+  0.044638008951,0.040779420283,0.029872514486,0.013828984515,
+  0.010130270057,0.02188278096,0.029872514486,0.03269908105,
+  0.029872514486,0.02188278096,0.010130270057,0.004689640299,
+  0.010130270057,0.013828984515,0.015137496567,0.013828984515,
+  0.010130270057,0.004689640299,0.006401898735,0.013828984515,
+  0.018878155432,0.02066442498,0.018878155432,0.013828984515,
+  0.006401898735,0.013828984515,0.029872514486,0.040779420283,
+  0.044638008951,0.040779420283,0.029872514486,0.013828984515,
+  0.018878155432,0.040779420283,0.055668601965,0.060936019579,
+  0.055668601965,0.040779420283,0.018878155432,0.02066442498,
+  0.044638008951,0.060936019579,0.066701845404,0.060936019579,
+  0.044638008951,0.02066442498,0.018878155432,0.040779420283,
+  0.055668601965,0.060936019579,0.055668601965,0.040779420283,
+  0.018878155432,0.013828984515,0.029872514486,0.040779420283,
+  0.044638008951,0.040779420283,0.029872514486,0.013828984515,
+  0.006401898735,0.013828984515,0.018878155432,0.02066442498,
+  0.018878155432,0.013828984515,0.006401898735,0.007007652661,
+  0.015137496567,0.02066442498,0.0226197131,0.02066442498,
+  0.015137496567,0.007007652661,0.015137496567,0.03269908105,
+  0.044638008951,0.048861701056,0.044638008951,0.03269908105,
+  0.015137496567,0.02066442498,0.044638008951,0.060936019579,
+  0.066701845404,0.060936019579,0.044638008951,0.02066442498,
+  0.0226197131,0.048861701056,0.066701845404,0.073013239314,
+  0.066701845404,0.048861701056,0.0226197131,0.02066442498,
+  0.044638008951,0.060936019579,0.066701845404,0.060936019579,
+  0.044638008951,0.02066442498,0.015137496567,0.03269908105,
+  0.044638008951,0.048861701056,0.044638008951,0.03269908105,
+  0.015137496567,0.007007652661,0.015137496567,0.02066442498,
+  0.0226197131,0.02066442498,0.015137496567,0.007007652661,
+  0.006401898735,0.013828984515,0.018878155432,0.02066442498,
+  0.018878155432,0.013828984515,0.006401898735,0.013828984515,
+  0.029872514486,0.040779420283,0.044638008951,0.040779420283,
+  0.029872514486,0.013828984515,0.018878155432,0.040779420283,
+  0.055668601965,0.060936019579,0.055668601965,0.040779420283,
+  0.018878155432,0.02066442498,0.044638008951,0.060936019579,
+  0.066701845404,0.060936019579,0.044638008951,0.02066442498,
+  0.018878155432,0.040779420283,0.055668601965,0.060936019579,
+  0.055668601965,0.040779420283,0.018878155432,0.013828984515,
+  0.029872514486,0.040779420283,0.044638008951,0.040779420283,
+  0.029872514486,0.013828984515,0.006401898735,0.013828984515,
+  0.018878155432,0.02066442498,0.018878155432,0.013828984515,
+  0.006401898735,0.004689640299,0.010130270057,0.013828984515,
+  0.015137496567,0.013828984515,0.010130270057,0.004689640299,
+  0.010130270057,0.02188278096,0.029872514486,0.03269908105,
+  0.029872514486,0.02188278096,0.010130270057,0.013828984515,
+  0.029872514486,0.040779420283,0.044638008951,0.040779420283,
+  0.029872514486,0.013828984515,0.015137496567,0.03269908105,
+  0.044638008951,0.048861701056,0.044638008951,0.03269908105,
+  0.015137496567,0.013828984515,0.029872514486,0.040779420283,
+  0.044638008951,0.040779420283,0.029872514486,0.013828984515,
+  0.010130270057,0.02188278096,0.029872514486,0.03269908105,
+  0.029872514486,0.02188278096,0.010130270057,0.004689640299,
+  0.010130270057,0.013828984515,0.015137496567,0.013828984515,
+  0.010130270057,0.004689640299,0.002170991099,0.004689640299,
+  0.006401898735,0.007007652661,0.006401898735,0.004689640299,
+  0.002170991099,0.004689640299,0.010130270057,0.013828984515,
+  0.015137496567,0.013828984515,0.010130270057,0.004689640299,
+  0.006401898735,0.013828984515,0.018878155432,0.02066442498,
+  0.018878155432,0.013828984515,0.006401898735,0.007007652661,
+  0.015137496567,0.02066442498,0.0226197131,0.02066442498,
+  0.015137496567,0.007007652661,0.006401898735,0.013828984515,
+  0.018878155432,0.02066442498,0.018878155432,0.013828984515,
+  0.006401898735,0.004689640299,0.010130270057,0.013828984515,
+  0.015137496567,0.013828984515,0.010130270057,0.004689640299,
+  0.002170991099,0.004689640299,0.006401898735,0.007007652661,
+  0.006401898735,0.004689640299,0.002170991099
+};
+static const double cubature_hexa_8_locs[]={
+  -0.960289856498,-0.960289856498,-0.960289856498,-0.960289856498,
+  -0.960289856498,-0.960289856498,-0.960289856498,-0.960289856498,
+  -0.960289856498,-0.960289856498,-0.960289856498,-0.960289856498,
+  -0.960289856498,-0.960289856498,-0.960289856498,-0.960289856498,
+  -0.960289856498,-0.960289856498,-0.960289856498,-0.960289856498,
+  -0.960289856498,-0.960289856498,-0.960289856498,-0.960289856498,
+  -0.960289856498,-0.960289856498,-0.960289856498,-0.960289856498,
+  -0.960289856498,-0.960289856498,-0.960289856498,-0.960289856498,
+  -0.960289856498,-0.960289856498,-0.960289856498,-0.960289856498,
+  -0.960289856498,-0.960289856498,-0.960289856498,-0.960289856498,
+  -0.960289856498,-0.960289856498,-0.960289856498,-0.960289856498,
+  -0.960289856498,-0.960289856498,-0.960289856498,-0.960289856498,
+  -0.960289856498,-0.960289856498,-0.960289856498,-0.960289856498,
+  -0.960289856498,-0.960289856498,-0.960289856498,-0.960289856498,
+  -0.960289856498,-0.960289856498,-0.960289856498,-0.960289856498,
+  -0.960289856498,-0.960289856498,-0.960289856498,-0.960289856498,
+  -0.796666477414,-0.796666477414,-0.796666477414,-0.796666477414,
+  -0.796666477414,-0.796666477414,-0.796666477414,-0.796666477414,
+  -0.796666477414,-0.796666477414,-0.796666477414,-0.796666477414,
+  -0.796666477414,-0.796666477414,-0.796666477414,-0.796666477414,
+  -0.796666477414,-0.796666477414,-0.796666477414,-0.796666477414,
+  -0.796666477414,-0.796666477414,-0.796666477414,-0.796666477414,
+  -0.796666477414,-0.796666477414,-0.796666477414,-0.796666477414,
+  -0.796666477414,-0.796666477414,-0.796666477414,-0.796666477414,
+  -0.796666477414,-0.796666477414,-0.796666477414,-0.796666477414,
+  -0.796666477414,-0.796666477414,-0.796666477414,-0.796666477414,
+  -0.796666477414,-0.796666477414,-0.796666477414,-0.796666477414,
+  -0.796666477414,-0.796666477414,-0.796666477414,-0.796666477414,
+  -0.796666477414,-0.796666477414,-0.796666477414,-0.796666477414,
+  -0.796666477414,-0.796666477414,-0.796666477414,-0.796666477414,
+  -0.796666477414,-0.796666477414,-0.796666477414,-0.796666477414,
+  -0.796666477414,-0.796666477414,-0.796666477414,-0.796666477414,
+  -0.525532409916,-0.525532409916,-0.525532409916,-0.525532409916,
+  -0.525532409916,-0.525532409916,-0.525532409916,-0.525532409916,
+  -0.525532409916,-0.525532409916,-0.525532409916,-0.525532409916,
+  -0.525532409916,-0.525532409916,-0.525532409916,-0.525532409916,
+  -0.525532409916,-0.525532409916,-0.525532409916,-0.525532409916,
+  -0.525532409916,-0.525532409916,-0.525532409916,-0.525532409916,
+  -0.525532409916,-0.525532409916,-0.525532409916,-0.525532409916,
+  -0.525532409916,-0.525532409916,-0.525532409916,-0.525532409916,
+  -0.525532409916,-0.525532409916,-0.525532409916,-0.525532409916,
+  -0.525532409916,-0.525532409916,-0.525532409916,-0.525532409916,
+  -0.525532409916,-0.525532409916,-0.525532409916,-0.525532409916,
+  -0.525532409916,-0.525532409916,-0.525532409916,-0.525532409916,
+  -0.525532409916,-0.525532409916,-0.525532409916,-0.525532409916,
+  -0.525532409916,-0.525532409916,-0.525532409916,-0.525532409916,
+  -0.525532409916,-0.525532409916,-0.525532409916,-0.525532409916,
+  -0.525532409916,-0.525532409916,-0.525532409916,-0.525532409916,
+  -0.183434642496,-0.183434642496,-0.183434642496,-0.183434642496,
+  -0.183434642496,-0.183434642496,-0.183434642496,-0.183434642496,
+  -0.183434642496,-0.183434642496,-0.183434642496,-0.183434642496,
+  -0.183434642496,-0.183434642496,-0.183434642496,-0.183434642496,
+  -0.183434642496,-0.183434642496,-0.183434642496,-0.183434642496,
+  -0.183434642496,-0.183434642496,-0.183434642496,-0.183434642496,
+  -0.183434642496,-0.183434642496,-0.183434642496,-0.183434642496,
+  -0.183434642496,-0.183434642496,-0.183434642496,-0.183434642496,
+  -0.183434642496,-0.183434642496,-0.183434642496,-0.183434642496,
+  -0.183434642496,-0.183434642496,-0.183434642496,-0.183434642496,
+  -0.183434642496,-0.183434642496,-0.183434642496,-0.183434642496,
+  -0.183434642496,-0.183434642496,-0.183434642496,-0.183434642496,
+  -0.183434642496,-0.183434642496,-0.183434642496,-0.183434642496,
+  -0.183434642496,-0.183434642496,-0.183434642496,-0.183434642496,
+  -0.183434642496,-0.183434642496,-0.183434642496,-0.183434642496,
+  -0.183434642496,-0.183434642496,-0.183434642496,-0.183434642496,
+  0.183434642496,0.183434642496,0.183434642496,0.183434642496,
+  0.183434642496,0.183434642496,0.183434642496,0.183434642496,
+  0.183434642496,0.183434642496,0.183434642496,0.183434642496,
+  0.183434642496,0.183434642496,0.183434642496,0.183434642496,
+  0.183434642496,0.183434642496,0.183434642496,0.183434642496,
+  0.183434642496,0.183434642496,0.183434642496,0.183434642496,
+  0.183434642496,0.183434642496,0.183434642496,0.183434642496,
+  0.183434642496,0.183434642496,0.183434642496,0.183434642496,
+  0.183434642496,0.183434642496,0.183434642496,0.183434642496,
+  0.183434642496,0.183434642496,0.183434642496,0.183434642496,
+  0.183434642496,0.183434642496,0.183434642496,0.183434642496,
+  0.183434642496,0.183434642496,0.183434642496,0.183434642496,
+  0.183434642496,0.183434642496,0.183434642496,0.183434642496,
+  0.183434642496,0.183434642496,0.183434642496,0.183434642496,
+  0.183434642496,0.183434642496,0.183434642496,0.183434642496,
+  0.183434642496,0.183434642496,0.183434642496,0.183434642496,
+  0.525532409916,0.525532409916,0.525532409916,0.525532409916,
+  0.525532409916,0.525532409916,0.525532409916,0.525532409916,
+  0.525532409916,0.525532409916,0.525532409916,0.525532409916,
+  0.525532409916,0.525532409916,0.525532409916,0.525532409916,
+  0.525532409916,0.525532409916,0.525532409916,0.525532409916,
+  0.525532409916,0.525532409916,0.525532409916,0.525532409916,
+  0.525532409916,0.525532409916,0.525532409916,0.525532409916,
+  0.525532409916,0.525532409916,0.525532409916,0.525532409916,
+  0.525532409916,0.525532409916,0.525532409916,0.525532409916,
+  0.525532409916,0.525532409916,0.525532409916,0.525532409916,
+  0.525532409916,0.525532409916,0.525532409916,0.525532409916,
+  0.525532409916,0.525532409916,0.525532409916,0.525532409916,
+  0.525532409916,0.525532409916,0.525532409916,0.525532409916,
+  0.525532409916,0.525532409916,0.525532409916,0.525532409916,
+  0.525532409916,0.525532409916,0.525532409916,0.525532409916,
+  0.525532409916,0.525532409916,0.525532409916,0.525532409916,
+  0.796666477414,0.796666477414,0.796666477414,0.796666477414,
+  0.796666477414,0.796666477414,0.796666477414,0.796666477414,
+  0.796666477414,0.796666477414,0.796666477414,0.796666477414,
+  0.796666477414,0.796666477414,0.796666477414,0.796666477414,
+  0.796666477414,0.796666477414,0.796666477414,0.796666477414,
+  0.796666477414,0.796666477414,0.796666477414,0.796666477414,
+  0.796666477414,0.796666477414,0.796666477414,0.796666477414,
+  0.796666477414,0.796666477414,0.796666477414,0.796666477414,
+  0.796666477414,0.796666477414,0.796666477414,0.796666477414,
+  0.796666477414,0.796666477414,0.796666477414,0.796666477414,
+  0.796666477414,0.796666477414,0.796666477414,0.796666477414,
+  0.796666477414,0.796666477414,0.796666477414,0.796666477414,
+  0.796666477414,0.796666477414,0.796666477414,0.796666477414,
+  0.796666477414,0.796666477414,0.796666477414,0.796666477414,
+  0.796666477414,0.796666477414,0.796666477414,0.796666477414,
+  0.796666477414,0.796666477414,0.796666477414,0.796666477414,
+  0.960289856498,0.960289856498,0.960289856498,0.960289856498,
+  0.960289856498,0.960289856498,0.960289856498,0.960289856498,
+  0.960289856498,0.960289856498,0.960289856498,0.960289856498,
+  0.960289856498,0.960289856498,0.960289856498,0.960289856498,
+  0.960289856498,0.960289856498,0.960289856498,0.960289856498,
+  0.960289856498,0.960289856498,0.960289856498,0.960289856498,
+  0.960289856498,0.960289856498,0.960289856498,0.960289856498,
+  0.960289856498,0.960289856498,0.960289856498,0.960289856498,
+  0.960289856498,0.960289856498,0.960289856498,0.960289856498,
+  0.960289856498,0.960289856498,0.960289856498,0.960289856498,
+  0.960289856498,0.960289856498,0.960289856498,0.960289856498,
+  0.960289856498,0.960289856498,0.960289856498,0.960289856498,
+  0.960289856498,0.960289856498,0.960289856498,0.960289856498,
+  0.960289856498,0.960289856498,0.960289856498,0.960289856498,
+  0.960289856498,0.960289856498,0.960289856498,0.960289856498,
+  0.960289856498,0.960289856498,0.960289856498,0.960289856498,
+  -0.960289856498,-0.960289856498,-0.960289856498,-0.960289856498,
+  -0.960289856498,-0.960289856498,-0.960289856498,-0.960289856498,
+  -0.796666477414,-0.796666477414,-0.796666477414,-0.796666477414,
+  -0.796666477414,-0.796666477414,-0.796666477414,-0.796666477414,
+  -0.525532409916,-0.525532409916,-0.525532409916,-0.525532409916,
+  -0.525532409916,-0.525532409916,-0.525532409916,-0.525532409916,
+  -0.183434642496,-0.183434642496,-0.183434642496,-0.183434642496,
+  -0.183434642496,-0.183434642496,-0.183434642496,-0.183434642496,
+  0.183434642496,0.183434642496,0.183434642496,0.183434642496,
+  0.183434642496,0.183434642496,0.183434642496,0.183434642496,
+  0.525532409916,0.525532409916,0.525532409916,0.525532409916,
+  0.525532409916,0.525532409916,0.525532409916,0.525532409916,
+  0.796666477414,0.796666477414,0.796666477414,0.796666477414,
+  0.796666477414,0.796666477414,0.796666477414,0.796666477414,
+  0.960289856498,0.960289856498,0.960289856498,0.960289856498,
+  0.960289856498,0.960289856498,0.960289856498,0.960289856498,
+  -0.960289856498,-0.960289856498,-0.960289856498,-0.960289856498,
+  -0.960289856498,-0.960289856498,-0.960289856498,-0.960289856498,
+  -0.796666477414,-0.796666477414,-0.796666477414,-0.796666477414,
+  -0.796666477414,-0.796666477414,-0.796666477414,-0.796666477414,
+  -0.525532409916,-0.525532409916,-0.525532409916,-0.525532409916,
+  -0.525532409916,-0.525532409916,-0.525532409916,-0.525532409916,
+  -0.183434642496,-0.183434642496,-0.183434642496,-0.183434642496,
+  -0.183434642496,-0.183434642496,-0.183434642496,-0.183434642496,
+  0.183434642496,0.183434642496,0.183434642496,0.183434642496,
+  0.183434642496,0.183434642496,0.183434642496,0.183434642496,
+  0.525532409916,0.525532409916,0.525532409916,0.525532409916,
+  0.525532409916,0.525532409916,0.525532409916,0.525532409916,
+  0.796666477414,0.796666477414,0.796666477414,0.796666477414,
+  0.796666477414,0.796666477414,0.796666477414,0.796666477414,
+  0.960289856498,0.960289856498,0.960289856498,0.960289856498,
+  0.960289856498,0.960289856498,0.960289856498,0.960289856498,
+  -0.960289856498,-0.960289856498,-0.960289856498,-0.960289856498,
+  -0.960289856498,-0.960289856498,-0.960289856498,-0.960289856498,
+  -0.796666477414,-0.796666477414,-0.796666477414,-0.796666477414,
+  -0.796666477414,-0.796666477414,-0.796666477414,-0.796666477414,
+  -0.525532409916,-0.525532409916,-0.525532409916,-0.525532409916,
+  -0.525532409916,-0.525532409916,-0.525532409916,-0.525532409916,
+  -0.183434642496,-0.183434642496,-0.183434642496,-0.183434642496,
+  -0.183434642496,-0.183434642496,-0.183434642496,-0.183434642496,
+  0.183434642496,0.183434642496,0.183434642496,0.183434642496,
+  0.183434642496,0.183434642496,0.183434642496,0.183434642496,
+  0.525532409916,0.525532409916,0.525532409916,0.525532409916,
+  0.525532409916,0.525532409916,0.525532409916,0.525532409916,
+  0.796666477414,0.796666477414,0.796666477414,0.796666477414,
+  0.796666477414,0.796666477414,0.796666477414,0.796666477414,
+  0.960289856498,0.960289856498,0.960289856498,0.960289856498,
+  0.960289856498,0.960289856498,0.960289856498,0.960289856498,
+  -0.960289856498,-0.960289856498,-0.960289856498,-0.960289856498,
+  -0.960289856498,-0.960289856498,-0.960289856498,-0.960289856498,
+  -0.796666477414,-0.796666477414,-0.796666477414,-0.796666477414,
+  -0.796666477414,-0.796666477414,-0.796666477414,-0.796666477414,
+  -0.525532409916,-0.525532409916,-0.525532409916,-0.525532409916,
+  -0.525532409916,-0.525532409916,-0.525532409916,-0.525532409916,
+  -0.183434642496,-0.183434642496,-0.183434642496,-0.183434642496,
+  -0.183434642496,-0.183434642496,-0.183434642496,-0.183434642496,
+  0.183434642496,0.183434642496,0.183434642496,0.183434642496,
+  0.183434642496,0.183434642496,0.183434642496,0.183434642496,
+  0.525532409916,0.525532409916,0.525532409916,0.525532409916,
+  0.525532409916,0.525532409916,0.525532409916,0.525532409916,
+  0.796666477414,0.796666477414,0.796666477414,0.796666477414,
+  0.796666477414,0.796666477414,0.796666477414,0.796666477414,
+  0.960289856498,0.960289856498,0.960289856498,0.960289856498,
+  0.960289856498,0.960289856498,0.960289856498,0.960289856498,
+  -0.960289856498,-0.960289856498,-0.960289856498,-0.960289856498,
+  -0.960289856498,-0.960289856498,-0.960289856498,-0.960289856498,
+  -0.796666477414,-0.796666477414,-0.796666477414,-0.796666477414,
+  -0.796666477414,-0.796666477414,-0.796666477414,-0.796666477414,
+  -0.525532409916,-0.525532409916,-0.525532409916,-0.525532409916,
+  -0.525532409916,-0.525532409916,-0.525532409916,-0.525532409916,
+  -0.183434642496,-0.183434642496,-0.183434642496,-0.183434642496,
+  -0.183434642496,-0.183434642496,-0.183434642496,-0.183434642496,
+  0.183434642496,0.183434642496,0.183434642496,0.183434642496,
+  0.183434642496,0.183434642496,0.183434642496,0.183434642496,
+  0.525532409916,0.525532409916,0.525532409916,0.525532409916,
+  0.525532409916,0.525532409916,0.525532409916,0.525532409916,
+  0.796666477414,0.796666477414,0.796666477414,0.796666477414,
+  0.796666477414,0.796666477414,0.796666477414,0.796666477414,
+  0.960289856498,0.960289856498,0.960289856498,0.960289856498,
+  0.960289856498,0.960289856498,0.960289856498,0.960289856498,
+  -0.960289856498,-0.960289856498,-0.960289856498,-0.960289856498,
+  -0.960289856498,-0.960289856498,-0.960289856498,-0.960289856498,
+  -0.796666477414,-0.796666477414,-0.796666477414,-0.796666477414,
+  -0.796666477414,-0.796666477414,-0.796666477414,-0.796666477414,
+  -0.525532409916,-0.525532409916,-0.525532409916,-0.525532409916,
+  -0.525532409916,-0.525532409916,-0.525532409916,-0.525532409916,
+  -0.183434642496,-0.183434642496,-0.183434642496,-0.183434642496,
+  -0.183434642496,-0.183434642496,-0.183434642496,-0.183434642496,
+  0.183434642496,0.183434642496,0.183434642496,0.183434642496,
+  0.183434642496,0.183434642496,0.183434642496,0.183434642496,
+  0.525532409916,0.525532409916,0.525532409916,0.525532409916,
+  0.525532409916,0.525532409916,0.525532409916,0.525532409916,
+  0.796666477414,0.796666477414,0.796666477414,0.796666477414,
+  0.796666477414,0.796666477414,0.796666477414,0.796666477414,
+  0.960289856498,0.960289856498,0.960289856498,0.960289856498,
+  0.960289856498,0.960289856498,0.960289856498,0.960289856498,
+  -0.960289856498,-0.960289856498,-0.960289856498,-0.960289856498,
+  -0.960289856498,-0.960289856498,-0.960289856498,-0.960289856498,
+  -0.796666477414,-0.796666477414,-0.796666477414,-0.796666477414,
+  -0.796666477414,-0.796666477414,-0.796666477414,-0.796666477414,
+  -0.525532409916,-0.525532409916,-0.525532409916,-0.525532409916,
+  -0.525532409916,-0.525532409916,-0.525532409916,-0.525532409916,
+  -0.183434642496,-0.183434642496,-0.183434642496,-0.183434642496,
+  -0.183434642496,-0.183434642496,-0.183434642496,-0.183434642496,
+  0.183434642496,0.183434642496,0.183434642496,0.183434642496,
+  0.183434642496,0.183434642496,0.183434642496,0.183434642496,
+  0.525532409916,0.525532409916,0.525532409916,0.525532409916,
+  0.525532409916,0.525532409916,0.525532409916,0.525532409916,
+  0.796666477414,0.796666477414,0.796666477414,0.796666477414,
+  0.796666477414,0.796666477414,0.796666477414,0.796666477414,
+  0.960289856498,0.960289856498,0.960289856498,0.960289856498,
+  0.960289856498,0.960289856498,0.960289856498,0.960289856498,
+  -0.960289856498,-0.960289856498,-0.960289856498,-0.960289856498,
+  -0.960289856498,-0.960289856498,-0.960289856498,-0.960289856498,
+  -0.796666477414,-0.796666477414,-0.796666477414,-0.796666477414,
+  -0.796666477414,-0.796666477414,-0.796666477414,-0.796666477414,
+  -0.525532409916,-0.525532409916,-0.525532409916,-0.525532409916,
+  -0.525532409916,-0.525532409916,-0.525532409916,-0.525532409916,
+  -0.183434642496,-0.183434642496,-0.183434642496,-0.183434642496,
+  -0.183434642496,-0.183434642496,-0.183434642496,-0.183434642496,
+  0.183434642496,0.183434642496,0.183434642496,0.183434642496,
+  0.183434642496,0.183434642496,0.183434642496,0.183434642496,
+  0.525532409916,0.525532409916,0.525532409916,0.525532409916,
+  0.525532409916,0.525532409916,0.525532409916,0.525532409916,
+  0.796666477414,0.796666477414,0.796666477414,0.796666477414,
+  0.796666477414,0.796666477414,0.796666477414,0.796666477414,
+  0.960289856498,0.960289856498,0.960289856498,0.960289856498,
+  0.960289856498,0.960289856498,0.960289856498,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498,
+  -0.960289856498,-0.796666477414,-0.525532409916,-0.183434642496,
+  0.183434642496,0.525532409916,0.796666477414,0.960289856498
+};
+static const double cubature_hexa_8_weights[]={
+  0.001037310733,0.002278786619,0.003214619936,0.003716499271,
+  0.003716499271,0.003214619936,0.002278786619,0.001037310733,
+  0.002278786619,0.005006087652,0.007061946493,0.008164485852,
+  0.008164485852,0.007061946493,0.005006087652,0.002278786619,
+  0.003214619936,0.007061946493,0.009962088508,0.01151740965,
+  0.01151740965,0.009962088508,0.007061946493,0.003214619936,
+  0.003716499271,0.008164485852,0.01151740965,0.013315553755,
+  0.013315553755,0.01151740965,0.008164485852,0.003716499271,
+  0.003716499271,0.008164485852,0.01151740965,0.013315553755,
+  0.013315553755,0.01151740965,0.008164485852,0.003716499271,
+  0.003214619936,0.007061946493,0.009962088508,0.01151740965,
+  0.01151740965,0.009962088508,0.007061946493,0.003214619936,
+  0.002278786619,0.005006087652,0.007061946493,0.008164485852,
+  0.008164485852,0.007061946493,0.005006087652,0.002278786619,
+  0.001037310733,0.002278786619,0.003214619936,0.003716499271,
+  0.003716499271,0.003214619936,0.002278786619,0.001037310733,
+  0.002278786619,0.005006087652,0.007061946493,0.008164485852,
+  0.008164485852,0.007061946493,0.005006087652,0.002278786619,
+  0.005006087652,0.010997481456,0.015513836552,0.017935918825,
+  0.017935918825,0.015513836552,0.010997481456,0.005006087652,
+  0.007061946493,0.015513836552,0.021884931155,0.025301694225,
+  0.025301694225,0.021884931155,0.015513836552,0.007061946493,
+  0.008164485852,0.017935918825,0.025301694225,0.029251896025,
+  0.029251896025,0.025301694225,0.017935918825,0.008164485852,
+  0.008164485852,0.017935918825,0.025301694225,0.029251896025,
+  0.029251896025,0.025301694225,0.017935918825,0.008164485852,
+  0.007061946493,0.015513836552,0.021884931155,0.025301694225,
+  0.025301694225,0.021884931155,0.015513836552,0.007061946493,
+  0.005006087652,0.010997481456,0.015513836552,0.017935918825,
+  0.017935918825,0.015513836552,0.010997481456,0.005006087652,
+  0.002278786619,0.005006087652,0.007061946493,0.008164485852,
+  0.008164485852,0.007061946493,0.005006087652,0.002278786619,
+  0.003214619936,0.007061946493,0.009962088508,0.01151740965,
+  0.01151740965,0.009962088508,0.007061946493,0.003214619936,
+  0.007061946493,0.015513836552,0.021884931155,0.025301694225,
+  0.025301694225,0.021884931155,0.015513836552,0.007061946493,
+  0.009962088508,0.021884931155,0.030872454411,0.035692385594,
+  0.035692385594,0.030872454411,0.021884931155,0.009962088508,
+  0.01151740965,0.025301694225,0.035692385594,0.041264823729,
+  0.041264823729,0.035692385594,0.025301694225,0.01151740965,
+  0.01151740965,0.025301694225,0.035692385594,0.041264823729,
+  0.041264823729,0.035692385594,0.025301694225,0.01151740965,
+  0.009962088508,0.021884931155,0.030872454411,0.035692385594,
+  0.035692385594,0.030872454411,0.021884931155,0.009962088508,
+  0.007061946493,0.015513836552,0.021884931155,0.025301694225,
+  0.025301694225,0.021884931155,0.015513836552,0.007061946493,
+  0.003214619936,0.007061946493,0.009962088508,0.01151740965,
+  0.01151740965,0.009962088508,0.007061946493,0.003214619936,
+  0.003716499271,0.008164485852,0.01151740965,0.013315553755,
+  0.013315553755,0.01151740965,0.008164485852,0.003716499271,
+  0.008164485852,0.017935918825,0.025301694225,0.029251896025,
+  0.029251896025,0.025301694225,0.017935918825,0.008164485852,
+  0.01151740965,0.025301694225,0.035692385594,0.041264823729,
+  0.041264823729,0.035692385594,0.025301694225,0.01151740965,
+  0.013315553755,0.029251896025,0.041264823729,0.047707253217,
+  0.047707253217,0.041264823729,0.029251896025,0.013315553755,
+  0.013315553755,0.029251896025,0.041264823729,0.047707253217,
+  0.047707253217,0.041264823729,0.029251896025,0.013315553755,
+  0.01151740965,0.025301694225,0.035692385594,0.041264823729,
+  0.041264823729,0.035692385594,0.025301694225,0.01151740965,
+  0.008164485852,0.017935918825,0.025301694225,0.029251896025,
+  0.029251896025,0.025301694225,0.017935918825,0.008164485852,
+  0.003716499271,0.008164485852,0.01151740965,0.013315553755,
+  0.013315553755,0.01151740965,0.008164485852,0.003716499271,
+  0.003716499271,0.008164485852,0.01151740965,0.013315553755,
+  0.013315553755,0.01151740965,0.008164485852,0.003716499271,
+  0.008164485852,0.017935918825,0.025301694225,0.029251896025,
+  0.029251896025,0.025301694225,0.017935918825,0.008164485852,
+  0.01151740965,0.025301694225,0.035692385594,0.041264823729,
+  0.041264823729,0.035692385594,0.025301694225,0.01151740965,
+  0.013315553755,0.029251896025,0.041264823729,0.047707253217,
+  0.047707253217,0.041264823729,0.029251896025,0.013315553755,
+  0.013315553755,0.029251896025,0.041264823729,0.047707253217,
+  0.047707253217,0.041264823729,0.029251896025,0.013315553755,
+  0.01151740965,0.025301694225,0.035692385594,0.041264823729,
+  0.041264823729,0.035692385594,0.025301694225,0.01151740965,
+  0.008164485852,0.017935918825,0.025301694225,0.029251896025,
+  0.029251896025,0.025301694225,0.017935918825,0.008164485852,
+  0.003716499271,0.008164485852,0.01151740965,0.013315553755,
+  0.013315553755,0.01151740965,0.008164485852,0.003716499271,
+  0.003214619936,0.007061946493,0.009962088508,0.01151740965,
+  0.01151740965,0.009962088508,0.007061946493,0.003214619936,
+  0.007061946493,0.015513836552,0.021884931155,0.025301694225,
+  0.025301694225,0.021884931155,0.015513836552,0.007061946493,
+  0.009962088508,0.021884931155,0.030872454411,0.035692385594,
+  0.035692385594,0.030872454411,0.021884931155,0.009962088508,
+  0.01151740965,0.025301694225,0.035692385594,0.041264823729,
+  0.041264823729,0.035692385594,0.025301694225,0.01151740965,
+  0.01151740965,0.025301694225,0.035692385594,0.041264823729,
+  0.041264823729,0.035692385594,0.025301694225,0.01151740965,
+  0.009962088508,0.021884931155,0.030872454411,0.035692385594,
+  0.035692385594,0.030872454411,0.021884931155,0.009962088508,
+  0.007061946493,0.015513836552,0.021884931155,0.025301694225,
+  0.025301694225,0.021884931155,0.015513836552,0.007061946493,
+  0.003214619936,0.007061946493,0.009962088508,0.01151740965,
+  0.01151740965,0.009962088508,0.007061946493,0.003214619936,
+  0.002278786619,0.005006087652,0.007061946493,0.008164485852,
+  0.008164485852,0.007061946493,0.005006087652,0.002278786619,
+  0.005006087652,0.010997481456,0.015513836552,0.017935918825,
+  0.017935918825,0.015513836552,0.010997481456,0.005006087652,
+  0.007061946493,0.015513836552,0.021884931155,0.025301694225,
+  0.025301694225,0.021884931155,0.015513836552,0.007061946493,
+  0.008164485852,0.017935918825,0.025301694225,0.029251896025,
+  0.029251896025,0.025301694225,0.017935918825,0.008164485852,
+  0.008164485852,0.017935918825,0.025301694225,0.029251896025,
+  0.029251896025,0.025301694225,0.017935918825,0.008164485852,
+  0.007061946493,0.015513836552,0.021884931155,0.025301694225,
+  0.025301694225,0.021884931155,0.015513836552,0.007061946493,
+  0.005006087652,0.010997481456,0.015513836552,0.017935918825,
+  0.017935918825,0.015513836552,0.010997481456,0.005006087652,
+  0.002278786619,0.005006087652,0.007061946493,0.008164485852,
+  0.008164485852,0.007061946493,0.005006087652,0.002278786619,
+  0.001037310733,0.002278786619,0.003214619936,0.003716499271,
+  0.003716499271,0.003214619936,0.002278786619,0.001037310733,
+  0.002278786619,0.005006087652,0.007061946493,0.008164485852,
+  0.008164485852,0.007061946493,0.005006087652,0.002278786619,
+  0.003214619936,0.007061946493,0.009962088508,0.01151740965,
+  0.01151740965,0.009962088508,0.007061946493,0.003214619936,
+  0.003716499271,0.008164485852,0.01151740965,0.013315553755,
+  0.013315553755,0.01151740965,0.008164485852,0.003716499271,
+  0.003716499271,0.008164485852,0.01151740965,0.013315553755,
+  0.013315553755,0.01151740965,0.008164485852,0.003716499271,
+  0.003214619936,0.007061946493,0.009962088508,0.01151740965,
+  0.01151740965,0.009962088508,0.007061946493,0.003214619936,
+  0.002278786619,0.005006087652,0.007061946493,0.008164485852,
+  0.008164485852,0.007061946493,0.005006087652,0.002278786619,
+  0.001037310733,0.002278786619,0.003214619936,0.003716499271,
+  0.003716499271,0.003214619936,0.002278786619,0.001037310733
+};
+static const double cubature_hexa_9_locs[]={
+  -0.968160239508,-0.968160239508,-0.968160239508,-0.968160239508,
+  -0.968160239508,-0.968160239508,-0.968160239508,-0.968160239508,
+  -0.968160239508,-0.968160239508,-0.968160239508,-0.968160239508,
+  -0.968160239508,-0.968160239508,-0.968160239508,-0.968160239508,
+  -0.968160239508,-0.968160239508,-0.968160239508,-0.968160239508,
+  -0.968160239508,-0.968160239508,-0.968160239508,-0.968160239508,
+  -0.968160239508,-0.968160239508,-0.968160239508,-0.968160239508,
+  -0.968160239508,-0.968160239508,-0.968160239508,-0.968160239508,
+  -0.968160239508,-0.968160239508,-0.968160239508,-0.968160239508,
+  -0.968160239508,-0.968160239508,-0.968160239508,-0.968160239508,
+  -0.968160239508,-0.968160239508,-0.968160239508,-0.968160239508,
+  -0.968160239508,-0.968160239508,-0.968160239508,-0.968160239508,
+  -0.968160239508,-0.968160239508,-0.968160239508,-0.968160239508,
+  -0.968160239508,-0.968160239508,-0.968160239508,-0.968160239508,
+  -0.968160239508,-0.968160239508,-0.968160239508,-0.968160239508,
+  -0.968160239508,-0.968160239508,-0.968160239508,-0.968160239508,
+  -0.968160239508,-0.968160239508,-0.968160239508,-0.968160239508,
+  -0.968160239508,-0.968160239508,-0.968160239508,-0.968160239508,
+  -0.968160239508,-0.968160239508,-0.968160239508,-0.968160239508,
+  -0.968160239508,-0.968160239508,-0.968160239508,-0.968160239508,
+  -0.968160239508,-0.836031107327,-0.836031107327,-0.836031107327,
+  -0.836031107327,-0.836031107327,-0.836031107327,-0.836031107327,
+  -0.836031107327,-0.836031107327,-0.836031107327,-0.836031107327,
+  -0.836031107327,-0.836031107327,-0.836031107327,-0.836031107327,
+  -0.836031107327,-0.836031107327,-0.836031107327,-0.836031107327,
+  -0.836031107327,-0.836031107327,-0.836031107327,-0.836031107327,
+  -0.836031107327,-0.836031107327,-0.836031107327,-0.836031107327,
+  -0.836031107327,-0.836031107327,-0.836031107327,-0.836031107327,
+  -0.836031107327,-0.836031107327,-0.836031107327,-0.836031107327,
+  -0.836031107327,-0.836031107327,-0.836031107327,-0.836031107327,
+  -0.836031107327,-0.836031107327,-0.836031107327,-0.836031107327,
+  -0.836031107327,-0.836031107327,-0.836031107327,-0.836031107327,
+  -0.836031107327,-0.836031107327,-0.836031107327,-0.836031107327,
+  -0.836031107327,-0.836031107327,-0.836031107327,-0.836031107327,
+  -0.836031107327,-0.836031107327,-0.836031107327,-0.836031107327,
+  -0.836031107327,-0.836031107327,-0.836031107327,-0.836031107327,
+  -0.836031107327,-0.836031107327,-0.836031107327,-0.836031107327,
+  -0.836031107327,-0.836031107327,-0.836031107327,-0.836031107327,
+  -0.836031107327,-0.836031107327,-0.836031107327,-0.836031107327,
+  -0.836031107327,-0.836031107327,-0.836031107327,-0.836031107327,
+  -0.836031107327,-0.836031107327,-0.613371432701,-0.613371432701,
+  -0.613371432701,-0.613371432701,-0.613371432701,-0.613371432701,
+  -0.613371432701,-0.613371432701,-0.613371432701,-0.613371432701,
+  -0.613371432701,-0.613371432701,-0.613371432701,-0.613371432701,
+  -0.613371432701,-0.613371432701,-0.613371432701,-0.613371432701,
+  -0.613371432701,-0.613371432701,-0.613371432701,-0.613371432701,
+  -0.613371432701,-0.613371432701,-0.613371432701,-0.613371432701,
+  -0.613371432701,-0.613371432701,-0.613371432701,-0.613371432701,
+  -0.613371432701,-0.613371432701,-0.613371432701,-0.613371432701,
+  -0.613371432701,-0.613371432701,-0.613371432701,-0.613371432701,
+  -0.613371432701,-0.613371432701,-0.613371432701,-0.613371432701,
+  -0.613371432701,-0.613371432701,-0.613371432701,-0.613371432701,
+  -0.613371432701,-0.613371432701,-0.613371432701,-0.613371432701,
+  -0.613371432701,-0.613371432701,-0.613371432701,-0.613371432701,
+  -0.613371432701,-0.613371432701,-0.613371432701,-0.613371432701,
+  -0.613371432701,-0.613371432701,-0.613371432701,-0.613371432701,
+  -0.613371432701,-0.613371432701,-0.613371432701,-0.613371432701,
+  -0.613371432701,-0.613371432701,-0.613371432701,-0.613371432701,
+  -0.613371432701,-0.613371432701,-0.613371432701,-0.613371432701,
+  -0.613371432701,-0.613371432701,-0.613371432701,-0.613371432701,
+  -0.613371432701,-0.613371432701,-0.613371432701,-0.324253423404,
+  -0.324253423404,-0.324253423404,-0.324253423404,-0.324253423404,
+  -0.324253423404,-0.324253423404,-0.324253423404,-0.324253423404,
+  -0.324253423404,-0.324253423404,-0.324253423404,-0.324253423404,
+  -0.324253423404,-0.324253423404,-0.324253423404,-0.324253423404,
+  -0.324253423404,-0.324253423404,-0.324253423404,-0.324253423404,
+  -0.324253423404,-0.324253423404,-0.324253423404,-0.324253423404,
+  -0.324253423404,-0.324253423404,-0.324253423404,-0.324253423404,
+  -0.324253423404,-0.324253423404,-0.324253423404,-0.324253423404,
+  -0.324253423404,-0.324253423404,-0.324253423404,-0.324253423404,
+  -0.324253423404,-0.324253423404,-0.324253423404,-0.324253423404,
+  -0.324253423404,-0.324253423404,-0.324253423404,-0.324253423404,
+  -0.324253423404,-0.324253423404,-0.324253423404,-0.324253423404,
+  -0.324253423404,-0.324253423404,-0.324253423404,-0.324253423404,
+  -0.324253423404,-0.324253423404,-0.324253423404,-0.324253423404,
+  -0.324253423404,-0.324253423404,-0.324253423404,-0.324253423404,
+  -0.324253423404,-0.324253423404,-0.324253423404,-0.324253423404,
+  -0.324253423404,-0.324253423404,-0.324253423404,-0.324253423404,
+  -0.324253423404,-0.324253423404,-0.324253423404,-0.324253423404,
+  -0.324253423404,-0.324253423404,-0.324253423404,-0.324253423404,
+  -0.324253423404,-0.324253423404,-0.324253423404,-0.324253423404,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0.324253423404,0.324253423404,0.324253423404,
+  0.324253423404,0.324253423404,0.324253423404,0.324253423404,
+  0.324253423404,0.324253423404,0.324253423404,0.324253423404,
+  0.324253423404,0.324253423404,0.324253423404,0.324253423404,
+  0.324253423404,0.324253423404,0.324253423404,0.324253423404,
+  0.324253423404,0.324253423404,0.324253423404,0.324253423404,
+  0.324253423404,0.324253423404,0.324253423404,0.324253423404,
+  0.324253423404,0.324253423404,0.324253423404,0.324253423404,
+  0.324253423404,0.324253423404,0.324253423404,0.324253423404,
+  0.324253423404,0.324253423404,0.324253423404,0.324253423404,
+  0.324253423404,0.324253423404,0.324253423404,0.324253423404,
+  0.324253423404,0.324253423404,0.324253423404,0.324253423404,
+  0.324253423404,0.324253423404,0.324253423404,0.324253423404,
+  0.324253423404,0.324253423404,0.324253423404,0.324253423404,
+  0.324253423404,0.324253423404,0.324253423404,0.324253423404,
+  0.324253423404,0.324253423404,0.324253423404,0.324253423404,
+  0.324253423404,0.324253423404,0.324253423404,0.324253423404,
+  0.324253423404,0.324253423404,0.324253423404,0.324253423404,
+  0.324253423404,0.324253423404,0.324253423404,0.324253423404,
+  0.324253423404,0.324253423404,0.324253423404,0.324253423404,
+  0.324253423404,0.324253423404,0.613371432701,0.613371432701,
+  0.613371432701,0.613371432701,0.613371432701,0.613371432701,
+  0.613371432701,0.613371432701,0.613371432701,0.613371432701,
+  0.613371432701,0.613371432701,0.613371432701,0.613371432701,
+  0.613371432701,0.613371432701,0.613371432701,0.613371432701,
+  0.613371432701,0.613371432701,0.613371432701,0.613371432701,
+  0.613371432701,0.613371432701,0.613371432701,0.613371432701,
+  0.613371432701,0.613371432701,0.613371432701,0.613371432701,
+  0.613371432701,0.613371432701,0.613371432701,0.613371432701,
+  0.613371432701,0.613371432701,0.613371432701,0.613371432701,
+  0.613371432701,0.613371432701,0.613371432701,0.613371432701,
+  0.613371432701,0.613371432701,0.613371432701,0.613371432701,
+  0.613371432701,0.613371432701,0.613371432701,0.613371432701,
+  0.613371432701,0.613371432701,0.613371432701,0.613371432701,
+  0.613371432701,0.613371432701,0.613371432701,0.613371432701,
+  0.613371432701,0.613371432701,0.613371432701,0.613371432701,
+  0.613371432701,0.613371432701,0.613371432701,0.613371432701,
+  0.613371432701,0.613371432701,0.613371432701,0.613371432701,
+  0.613371432701,0.613371432701,0.613371432701,0.613371432701,
+  0.613371432701,0.613371432701,0.613371432701,0.613371432701,
+  0.613371432701,0.613371432701,0.613371432701,0.836031107327,
+  0.836031107327,0.836031107327,0.836031107327,0.836031107327,
+  0.836031107327,0.836031107327,0.836031107327,0.836031107327,
+  0.836031107327,0.836031107327,0.836031107327,0.836031107327,
+  0.836031107327,0.836031107327,0.836031107327,0.836031107327,
+  0.836031107327,0.836031107327,0.836031107327,0.836031107327,
+  0.836031107327,0.836031107327,0.836031107327,0.836031107327,
+  0.836031107327,0.836031107327,0.836031107327,0.836031107327,
+  0.836031107327,0.836031107327,0.836031107327,0.836031107327,
+  0.836031107327,0.836031107327,0.836031107327,0.836031107327,
+  0.836031107327,0.836031107327,0.836031107327,0.836031107327,
+  0.836031107327,0.836031107327,0.836031107327,0.836031107327,
+  0.836031107327,0.836031107327,0.836031107327,0.836031107327,
+  0.836031107327,0.836031107327,0.836031107327,0.836031107327,
+  0.836031107327,0.836031107327,0.836031107327,0.836031107327,
+  0.836031107327,0.836031107327,0.836031107327,0.836031107327,
+  0.836031107327,0.836031107327,0.836031107327,0.836031107327,
+  0.836031107327,0.836031107327,0.836031107327,0.836031107327,
+  0.836031107327,0.836031107327,0.836031107327,0.836031107327,
+  0.836031107327,0.836031107327,0.836031107327,0.836031107327,
+  0.836031107327,0.836031107327,0.836031107327,0.836031107327,
+  0.968160239508,0.968160239508,0.968160239508,0.968160239508,
+  0.968160239508,0.968160239508,0.968160239508,0.968160239508,
+  0.968160239508,0.968160239508,0.968160239508,0.968160239508,
+  0.968160239508,0.968160239508,0.968160239508,0.968160239508,
+  0.968160239508,0.968160239508,0.968160239508,0.968160239508,
+  0.968160239508,0.968160239508,0.968160239508,0.968160239508,
+  0.968160239508,0.968160239508,0.968160239508,0.968160239508,
+  0.968160239508,0.968160239508,0.968160239508,0.968160239508,
+  0.968160239508,0.968160239508,0.968160239508,0.968160239508,
+  0.968160239508,0.968160239508,0.968160239508,0.968160239508,
+  0.968160239508,0.968160239508,0.968160239508,0.968160239508,
+  0.968160239508,0.968160239508,0.968160239508,0.968160239508,
+  0.968160239508,0.968160239508,0.968160239508,0.968160239508,
+  0.968160239508,0.968160239508,0.968160239508,0.968160239508,
+  0.968160239508,0.968160239508,0.968160239508,0.968160239508,
+  0.968160239508,0.968160239508,0.968160239508,0.968160239508,
+  0.968160239508,0.968160239508,0.968160239508,0.968160239508,
+  0.968160239508,0.968160239508,0.968160239508,0.968160239508,
+  0.968160239508,0.968160239508,0.968160239508,0.968160239508,
+  0.968160239508,0.968160239508,0.968160239508,0.968160239508,
+  0.968160239508,-0.968160239508,-0.968160239508,-0.968160239508,
+  -0.968160239508,-0.968160239508,-0.968160239508,-0.968160239508,
+  -0.968160239508,-0.968160239508,-0.836031107327,-0.836031107327,
+  -0.836031107327,-0.836031107327,-0.836031107327,-0.836031107327,
+  -0.836031107327,-0.836031107327,-0.836031107327,-0.613371432701,
+  -0.613371432701,-0.613371432701,-0.613371432701,-0.613371432701,
+  -0.613371432701,-0.613371432701,-0.613371432701,-0.613371432701,
+  -0.324253423404,-0.324253423404,-0.324253423404,-0.324253423404,
+  -0.324253423404,-0.324253423404,-0.324253423404,-0.324253423404,
+  -0.324253423404,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0.324253423404,0.324253423404,
+  0.324253423404,0.324253423404,0.324253423404,0.324253423404,
+  0.324253423404,0.324253423404,0.324253423404,0.613371432701,
+  0.613371432701,0.613371432701,0.613371432701,0.613371432701,
+  0.613371432701,0.613371432701,0.613371432701,0.613371432701,
+  0.836031107327,0.836031107327,0.836031107327,0.836031107327,
+  0.836031107327,0.836031107327,0.836031107327,0.836031107327,
+  0.836031107327,0.968160239508,0.968160239508,0.968160239508,
+  0.968160239508,0.968160239508,0.968160239508,0.968160239508,
+  0.968160239508,0.968160239508,-0.968160239508,-0.968160239508,
+  -0.968160239508,-0.968160239508,-0.968160239508,-0.968160239508,
+  -0.968160239508,-0.968160239508,-0.968160239508,-0.836031107327,
+  -0.836031107327,-0.836031107327,-0.836031107327,-0.836031107327,
+  -0.836031107327,-0.836031107327,-0.836031107327,-0.836031107327,
+  -0.613371432701,-0.613371432701,-0.613371432701,-0.613371432701,
+  -0.613371432701,-0.613371432701,-0.613371432701,-0.613371432701,
+  -0.613371432701,-0.324253423404,-0.324253423404,-0.324253423404,
+  -0.324253423404,-0.324253423404,-0.324253423404,-0.324253423404,
+  -0.324253423404,-0.324253423404,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0.324253423404,
+  0.324253423404,0.324253423404,0.324253423404,0.324253423404,
+  0.324253423404,0.324253423404,0.324253423404,0.324253423404,
+  0.613371432701,0.613371432701,0.613371432701,0.613371432701,
+  0.613371432701,0.613371432701,0.613371432701,0.613371432701,
+  0.613371432701,0.836031107327,0.836031107327,0.836031107327,
+  0.836031107327,0.836031107327,0.836031107327,0.836031107327,
+  0.836031107327,0.836031107327,0.968160239508,0.968160239508,
+  0.968160239508,0.968160239508,0.968160239508,0.968160239508,
+  0.968160239508,0.968160239508,0.968160239508,-0.968160239508,
+  -0.968160239508,-0.968160239508,-0.968160239508,-0.968160239508,
+  -0.968160239508,-0.968160239508,-0.968160239508,-0.968160239508,
+  -0.836031107327,-0.836031107327,-0.836031107327,-0.836031107327,
+  -0.836031107327,-0.836031107327,-0.836031107327,-0.836031107327,
+  -0.836031107327,-0.613371432701,-0.613371432701,-0.613371432701,
+  -0.613371432701,-0.613371432701,-0.613371432701,-0.613371432701,
+  -0.613371432701,-0.613371432701,-0.324253423404,-0.324253423404,
+  -0.324253423404,-0.324253423404,-0.324253423404,-0.324253423404,
+  -0.324253423404,-0.324253423404,-0.324253423404,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0.324253423404,0.324253423404,0.324253423404,0.324253423404,
+  0.324253423404,0.324253423404,0.324253423404,0.324253423404,
+  0.324253423404,0.613371432701,0.613371432701,0.613371432701,
+  0.613371432701,0.613371432701,0.613371432701,0.613371432701,
+  0.613371432701,0.613371432701,0.836031107327,0.836031107327,
+  0.836031107327,0.836031107327,0.836031107327,0.836031107327,
+  0.836031107327,0.836031107327,0.836031107327,0.968160239508,
+  0.968160239508,0.968160239508,0.968160239508,0.968160239508,
+  0.968160239508,0.968160239508,0.968160239508,0.968160239508,
+  -0.968160239508,-0.968160239508,-0.968160239508,-0.968160239508,
+  -0.968160239508,-0.968160239508,-0.968160239508,-0.968160239508,
+  -0.968160239508,-0.836031107327,-0.836031107327,-0.836031107327,
+  -0.836031107327,-0.836031107327,-0.836031107327,-0.836031107327,
+  -0.836031107327,-0.836031107327,-0.613371432701,-0.613371432701,
+  -0.613371432701,-0.613371432701,-0.613371432701,-0.613371432701,
+  -0.613371432701,-0.613371432701,-0.613371432701,-0.324253423404,
+  -0.324253423404,-0.324253423404,-0.324253423404,-0.324253423404,
+  -0.324253423404,-0.324253423404,-0.324253423404,-0.324253423404,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0.324253423404,0.324253423404,0.324253423404,
+  0.324253423404,0.324253423404,0.324253423404,0.324253423404,
+  0.324253423404,0.324253423404,0.613371432701,0.613371432701,
+  0.613371432701,0.613371432701,0.613371432701,0.613371432701,
+  0.613371432701,0.613371432701,0.613371432701,0.836031107327,
+  0.836031107327,0.836031107327,0.836031107327,0.836031107327,
+  0.836031107327,0.836031107327,0.836031107327,0.836031107327,
+  0.968160239508,0.968160239508,0.968160239508,0.968160239508,
+  0.968160239508,0.968160239508,0.968160239508,0.968160239508,
+  0.968160239508,-0.968160239508,-0.968160239508,-0.968160239508,
+  -0.968160239508,-0.968160239508,-0.968160239508,-0.968160239508,
+  -0.968160239508,-0.968160239508,-0.836031107327,-0.836031107327,
+  -0.836031107327,-0.836031107327,-0.836031107327,-0.836031107327,
+  -0.836031107327,-0.836031107327,-0.836031107327,-0.613371432701,
+  -0.613371432701,-0.613371432701,-0.613371432701,-0.613371432701,
+  -0.613371432701,-0.613371432701,-0.613371432701,-0.613371432701,
+  -0.324253423404,-0.324253423404,-0.324253423404,-0.324253423404,
+  -0.324253423404,-0.324253423404,-0.324253423404,-0.324253423404,
+  -0.324253423404,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0.324253423404,0.324253423404,
+  0.324253423404,0.324253423404,0.324253423404,0.324253423404,
+  0.324253423404,0.324253423404,0.324253423404,0.613371432701,
+  0.613371432701,0.613371432701,0.613371432701,0.613371432701,
+  0.613371432701,0.613371432701,0.613371432701,0.613371432701,
+  0.836031107327,0.836031107327,0.836031107327,0.836031107327,
+  0.836031107327,0.836031107327,0.836031107327,0.836031107327,
+  0.836031107327,0.968160239508,0.968160239508,0.968160239508,
+  0.968160239508,0.968160239508,0.968160239508,0.968160239508,
+  0.968160239508,0.968160239508,-0.968160239508,-0.968160239508,
+  -0.968160239508,-0.968160239508,-0.968160239508,-0.968160239508,
+  -0.968160239508,-0.968160239508,-0.968160239508,-0.836031107327,
+  -0.836031107327,-0.836031107327,-0.836031107327,-0.836031107327,
+  -0.836031107327,-0.836031107327,-0.836031107327,-0.836031107327,
+  -0.613371432701,-0.613371432701,-0.613371432701,-0.613371432701,
+  -0.613371432701,-0.613371432701,-0.613371432701,-0.613371432701,
+  -0.613371432701,-0.324253423404,-0.324253423404,-0.324253423404,
+  -0.324253423404,-0.324253423404,-0.324253423404,-0.324253423404,
+  -0.324253423404,-0.324253423404,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0.324253423404,
+  0.324253423404,0.324253423404,0.324253423404,0.324253423404,
+  0.324253423404,0.324253423404,0.324253423404,0.324253423404,
+  0.613371432701,0.613371432701,0.613371432701,0.613371432701,
+  0.613371432701,0.613371432701,0.613371432701,0.613371432701,
+  0.613371432701,0.836031107327,0.836031107327,0.836031107327,
+  0.836031107327,0.836031107327,0.836031107327,0.836031107327,
+  0.836031107327,0.836031107327,0.968160239508,0.968160239508,
+  0.968160239508,0.968160239508,0.968160239508,0.968160239508,
+  0.968160239508,0.968160239508,0.968160239508,-0.968160239508,
+  -0.968160239508,-0.968160239508,-0.968160239508,-0.968160239508,
+  -0.968160239508,-0.968160239508,-0.968160239508,-0.968160239508,
+  -0.836031107327,-0.836031107327,-0.836031107327,-0.836031107327,
+  -0.836031107327,-0.836031107327,-0.836031107327,-0.836031107327,
+  -0.836031107327,-0.613371432701,-0.613371432701,-0.613371432701,
+  -0.613371432701,-0.613371432701,-0.613371432701,-0.613371432701,
+  -0.613371432701,-0.613371432701,-0.324253423404,-0.324253423404,
+  -0.324253423404,-0.324253423404,-0.324253423404,-0.324253423404,
+  -0.324253423404,-0.324253423404,-0.324253423404,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0.324253423404,0.324253423404,0.324253423404,0.324253423404,
+  0.324253423404,0.324253423404,0.324253423404,0.324253423404,
+  0.324253423404,0.613371432701,0.613371432701,0.613371432701,
+  0.613371432701,0.613371432701,0.613371432701,0.613371432701,
+  0.613371432701,0.613371432701,0.836031107327,0.836031107327,
+  0.836031107327,0.836031107327,0.836031107327,0.836031107327,
+  0.836031107327,0.836031107327,0.836031107327,0.968160239508,
+  0.968160239508,0.968160239508,0.968160239508,0.968160239508,
+  0.968160239508,0.968160239508,0.968160239508,0.968160239508,
+  -0.968160239508,-0.968160239508,-0.968160239508,-0.968160239508,
+  -0.968160239508,-0.968160239508,-0.968160239508,-0.968160239508,
+  -0.968160239508,-0.836031107327,-0.836031107327,-0.836031107327,
+  -0.836031107327,-0.836031107327,-0.836031107327,-0.836031107327,
+  -0.836031107327,-0.836031107327,-0.613371432701,-0.613371432701,
+  -0.613371432701,-0.613371432701,-0.613371432701,-0.613371432701,
+  -0.613371432701,-0.613371432701,-0.613371432701,-0.324253423404,
+  -0.324253423404,-0.324253423404,-0.324253423404,-0.324253423404,
+  -0.324253423404,-0.324253423404,-0.324253423404,-0.324253423404,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0.324253423404,0.324253423404,0.324253423404,
+  0.324253423404,0.324253423404,0.324253423404,0.324253423404,
+  0.324253423404,0.324253423404,0.613371432701,0.613371432701,
+  0.613371432701,0.613371432701,0.613371432701,0.613371432701,
+  0.613371432701,0.613371432701,0.613371432701,0.836031107327,
+  0.836031107327,0.836031107327,0.836031107327,0.836031107327,
+  0.836031107327,0.836031107327,0.836031107327,0.836031107327,
+  0.968160239508,0.968160239508,0.968160239508,0.968160239508,
+  0.968160239508,0.968160239508,0.968160239508,0.968160239508,
+  0.968160239508,-0.968160239508,-0.968160239508,-0.968160239508,
+  -0.968160239508,-0.968160239508,-0.968160239508,-0.968160239508,
+  -0.968160239508,-0.968160239508,-0.836031107327,-0.836031107327,
+  -0.836031107327,-0.836031107327,-0.836031107327,-0.836031107327,
+  -0.836031107327,-0.836031107327,-0.836031107327,-0.613371432701,
+  -0.613371432701,-0.613371432701,-0.613371432701,-0.613371432701,
+  -0.613371432701,-0.613371432701,-0.613371432701,-0.613371432701,
+  -0.324253423404,-0.324253423404,-0.324253423404,-0.324253423404,
+  -0.324253423404,-0.324253423404,-0.324253423404,-0.324253423404,
+  -0.324253423404,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0E-12,0E-12,
+  0E-12,0E-12,0.324253423404,0.324253423404,
+  0.324253423404,0.324253423404,0.324253423404,0.324253423404,
+  0.324253423404,0.324253423404,0.324253423404,0.613371432701,
+  0.613371432701,0.613371432701,0.613371432701,0.613371432701,
+  0.613371432701,0.613371432701,0.613371432701,0.613371432701,
+  0.836031107327,0.836031107327,0.836031107327,0.836031107327,
+  0.836031107327,0.836031107327,0.836031107327,0.836031107327,
+  0.836031107327,0.968160239508,0.968160239508,0.968160239508,
+  0.968160239508,0.968160239508,0.968160239508,0.968160239508,
+  0.968160239508,0.968160239508,-0.968160239508,-0.836031107327,
+  -0.613371432701,-0.324253423404,0E-12,0.324253423404,
+  0.613371432701,0.836031107327,0.968160239508,-0.968160239508,
+  -0.836031107327,-0.613371432701,-0.324253423404,0E-12,
+  0.324253423404,0.613371432701,0.836031107327,0.968160239508,
+  -0.968160239508,-0.836031107327,-0.613371432701,-0.324253423404,
+  0E-12,0.324253423404,0.613371432701,0.836031107327,
+  0.968160239508,-0.968160239508,-0.836031107327,-0.613371432701,
+  -0.324253423404,0E-12,0.324253423404,0.613371432701,
+  0.836031107327,0.968160239508,-0.968160239508,-0.836031107327,
+  -0.613371432701,-0.324253423404,0E-12,0.324253423404,
+  0.613371432701,0.836031107327,0.968160239508,-0.968160239508,
+  -0.836031107327,-0.613371432701,-0.324253423404,0E-12,
+  0.324253423404,0.613371432701,0.836031107327,0.968160239508,
+  -0.968160239508,-0.836031107327,-0.613371432701,-0.324253423404,
+  0E-12,0.324253423404,0.613371432701,0.836031107327,
+  0.968160239508,-0.968160239508,-0.836031107327,-0.613371432701,
+  -0.324253423404,0E-12,0.324253423404,0.613371432701,
+  0.836031107327,0.968160239508,-0.968160239508,-0.836031107327,
+  -0.613371432701,-0.324253423404,0E-12,0.324253423404,
+  0.613371432701,0.836031107327,0.968160239508,-0.968160239508,
+  -0.836031107327,-0.613371432701,-0.324253423404,0E-12,
+  0.324253423404,0.613371432701,0.836031107327,0.968160239508,
+  -0.968160239508,-0.836031107327,-0.613371432701,-0.324253423404,
+  0E-12,0.324253423404,0.613371432701,0.836031107327,
+  0.968160239508,-0.968160239508,-0.836031107327,-0.613371432701,
+  -0.324253423404,0E-12,0.324253423404,0.613371432701,
+  0.836031107327,0.968160239508,-0.968160239508,-0.836031107327,
+  -0.613371432701,-0.324253423404,0E-12,0.324253423404,
+  0.613371432701,0.836031107327,0.968160239508,-0.968160239508,
+  -0.836031107327,-0.613371432701,-0.324253423404,0E-12,
+  0.324253423404,0.613371432701,0.836031107327,0.968160239508,
+  -0.968160239508,-0.836031107327,-0.613371432701,-0.324253423404,
+  0E-12,0.324253423404,0.613371432701,0.836031107327,
+  0.968160239508,-0.968160239508,-0.836031107327,-0.613371432701,
+  -0.324253423404,0E-12,0.324253423404,0.613371432701,
+  0.836031107327,0.968160239508,-0.968160239508,-0.836031107327,
+  -0.613371432701,-0.324253423404,0E-12,0.324253423404,
+  0.613371432701,0.836031107327,0.968160239508,-0.968160239508,
+  -0.836031107327,-0.613371432701,-0.324253423404,0E-12,
+  0.324253423404,0.613371432701,0.836031107327,0.968160239508,
+  -0.968160239508,-0.836031107327,-0.613371432701,-0.324253423404,
+  0E-12,0.324253423404,0.613371432701,0.836031107327,
+  0.968160239508,-0.968160239508,-0.836031107327,-0.613371432701,
+  -0.324253423404,0E-12,0.324253423404,0.613371432701,
+  0.836031107327,0.968160239508,-0.968160239508,-0.836031107327,
+  -0.613371432701,-0.324253423404,0E-12,0.324253423404,
+  0.613371432701,0.836031107327,0.968160239508,-0.968160239508,
+  -0.836031107327,-0.613371432701,-0.324253423404,0E-12,
+  0.324253423404,0.613371432701,0.836031107327,0.968160239508,
+  -0.968160239508,-0.836031107327,-0.613371432701,-0.324253423404,
+  0E-12,0.324253423404,0.613371432701,0.836031107327,
+  0.968160239508,-0.968160239508,-0.836031107327,-0.613371432701,
+  -0.324253423404,0E-12,0.324253423404,0.613371432701,
+  0.836031107327,0.968160239508,-0.968160239508,-0.836031107327,
+  -0.613371432701,-0.324253423404,0E-12,0.324253423404,
+  0.613371432701,0.836031107327,0.968160239508,-0.968160239508,
+  -0.836031107327,-0.613371432701,-0.324253423404,0E-12,
+  0.324253423404,0.613371432701,0.836031107327,0.968160239508,
+  -0.968160239508,-0.836031107327,-0.613371432701,-0.324253423404,
+  0E-12,0.324253423404,0.613371432701,0.836031107327,
+  0.968160239508,-0.968160239508,-0.836031107327,-0.613371432701,
+  -0.324253423404,0E-12,0.324253423404,0.613371432701,
+  0.836031107327,0.968160239508,-0.968160239508,-0.836031107327,
+  -0.613371432701,-0.324253423404,0E-12,0.324253423404,
+  0.613371432701,0.836031107327,0.968160239508,-0.968160239508,
+  -0.836031107327,-0.613371432701,-0.324253423404,0E-12,
+  0.324253423404,0.613371432701,0.836031107327,0.968160239508,
+  -0.968160239508,-0.836031107327,-0.613371432701,-0.324253423404,
+  0E-12,0.324253423404,0.613371432701,0.836031107327,
+  0.968160239508,-0.968160239508,-0.836031107327,-0.613371432701,
+  -0.324253423404,0E-12,0.324253423404,0.613371432701,
+  0.836031107327,0.968160239508,-0.968160239508,-0.836031107327,
+  -0.613371432701,-0.324253423404,0E-12,0.324253423404,
+  0.613371432701,0.836031107327,0.968160239508,-0.968160239508,
+  -0.836031107327,-0.613371432701,-0.324253423404,0E-12,
+  0.324253423404,0.613371432701,0.836031107327,0.968160239508,
+  -0.968160239508,-0.836031107327,-0.613371432701,-0.324253423404,
+  0E-12,0.324253423404,0.613371432701,0.836031107327,
+  0.968160239508,-0.968160239508,-0.836031107327,-0.613371432701,
+  -0.324253423404,0E-12,0.324253423404,0.613371432701,
+  0.836031107327,0.968160239508,-0.968160239508,-0.836031107327,
+  -0.613371432701,-0.324253423404,0E-12,0.324253423404,
+  0.613371432701,0.836031107327,0.968160239508,-0.968160239508,
+  -0.836031107327,-0.613371432701,-0.324253423404,0E-12,
+  0.324253423404,0.613371432701,0.836031107327,0.968160239508,
+  -0.968160239508,-0.836031107327,-0.613371432701,-0.324253423404,
+  0E-12,0.324253423404,0.613371432701,0.836031107327,
+  0.968160239508,-0.968160239508,-0.836031107327,-0.613371432701,
+  -0.324253423404,0E-12,0.324253423404,0.613371432701,
+  0.836031107327,0.968160239508,-0.968160239508,-0.836031107327,
+  -0.613371432701,-0.324253423404,0E-12,0.324253423404,
+  0.613371432701,0.836031107327,0.968160239508,-0.968160239508,
+  -0.836031107327,-0.613371432701,-0.324253423404,0E-12,
+  0.324253423404,0.613371432701,0.836031107327,0.968160239508,
+  -0.968160239508,-0.836031107327,-0.613371432701,-0.324253423404,
+  0E-12,0.324253423404,0.613371432701,0.836031107327,
+  0.968160239508,-0.968160239508,-0.836031107327,-0.613371432701,
+  -0.324253423404,0E-12,0.324253423404,0.613371432701,
+  0.836031107327,0.968160239508,-0.968160239508,-0.836031107327,
+  -0.613371432701,-0.324253423404,0E-12,0.324253423404,
+  0.613371432701,0.836031107327,0.968160239508,-0.968160239508,
+  -0.836031107327,-0.613371432701,-0.324253423404,0E-12,
+  0.324253423404,0.613371432701,0.836031107327,0.968160239508,
+  -0.968160239508,-0.836031107327,-0.613371432701,-0.324253423404,
+  0E-12,0.324253423404,0.613371432701,0.836031107327,
+  0.968160239508,-0.968160239508,-0.836031107327,-0.613371432701,
+  -0.324253423404,0E-12,0.324253423404,0.613371432701,
+  0.836031107327,0.968160239508,-0.968160239508,-0.836031107327,
+  -0.613371432701,-0.324253423404,0E-12,0.324253423404,
+  0.613371432701,0.836031107327,0.968160239508,-0.968160239508,
+  -0.836031107327,-0.613371432701,-0.324253423404,0E-12,
+  0.324253423404,0.613371432701,0.836031107327,0.968160239508,
+  -0.968160239508,-0.836031107327,-0.613371432701,-0.324253423404,
+  0E-12,0.324253423404,0.613371432701,0.836031107327,
+  0.968160239508,-0.968160239508,-0.836031107327,-0.613371432701,
+  -0.324253423404,0E-12,0.324253423404,0.613371432701,
+  0.836031107327,0.968160239508,-0.968160239508,-0.836031107327,
+  -0.613371432701,-0.324253423404,0E-12,0.324253423404,
+  0.613371432701,0.836031107327,0.968160239508,-0.968160239508,
+  -0.836031107327,-0.613371432701,-0.324253423404,0E-12,
+  0.324253423404,0.613371432701,0.836031107327,0.968160239508,
+  -0.968160239508,-0.836031107327,-0.613371432701,-0.324253423404,
+  0E-12,0.324253423404,0.613371432701,0.836031107327,
+  0.968160239508,-0.968160239508,-0.836031107327,-0.613371432701,
+  -0.324253423404,0E-12,0.324253423404,0.613371432701,
+  0.836031107327,0.968160239508,-0.968160239508,-0.836031107327,
+  -0.613371432701,-0.324253423404,0E-12,0.324253423404,
+  0.613371432701,0.836031107327,0.968160239508,-0.968160239508,
+  -0.836031107327,-0.613371432701,-0.324253423404,0E-12,
+  0.324253423404,0.613371432701,0.836031107327,0.968160239508,
+  -0.968160239508,-0.836031107327,-0.613371432701,-0.324253423404,
+  0E-12,0.324253423404,0.613371432701,0.836031107327,
+  0.968160239508,-0.968160239508,-0.836031107327,-0.613371432701,
+  -0.324253423404,0E-12,0.324253423404,0.613371432701,
+  0.836031107327,0.968160239508,-0.968160239508,-0.836031107327,
+  -0.613371432701,-0.324253423404,0E-12,0.324253423404,
+  0.613371432701,0.836031107327,0.968160239508,-0.968160239508,
+  -0.836031107327,-0.613371432701,-0.324253423404,0E-12,
+  0.324253423404,0.613371432701,0.836031107327,0.968160239508,
+  -0.968160239508,-0.836031107327,-0.613371432701,-0.324253423404,
+  0E-12,0.324253423404,0.613371432701,0.836031107327,
+  0.968160239508,-0.968160239508,-0.836031107327,-0.613371432701,
+  -0.324253423404,0E-12,0.324253423404,0.613371432701,
+  0.836031107327,0.968160239508,-0.968160239508,-0.836031107327,
+  -0.613371432701,-0.324253423404,0E-12,0.324253423404,
+  0.613371432701,0.836031107327,0.968160239508,-0.968160239508,
+  -0.836031107327,-0.613371432701,-0.324253423404,0E-12,
+  0.324253423404,0.613371432701,0.836031107327,0.968160239508,
+  -0.968160239508,-0.836031107327,-0.613371432701,-0.324253423404,
+  0E-12,0.324253423404,0.613371432701,0.836031107327,
+  0.968160239508,-0.968160239508,-0.836031107327,-0.613371432701,
+  -0.324253423404,0E-12,0.324253423404,0.613371432701,
+  0.836031107327,0.968160239508,-0.968160239508,-0.836031107327,
+  -0.613371432701,-0.324253423404,0E-12,0.324253423404,
+  0.613371432701,0.836031107327,0.968160239508,-0.968160239508,
+  -0.836031107327,-0.613371432701,-0.324253423404,0E-12,
+  0.324253423404,0.613371432701,0.836031107327,0.968160239508,
+  -0.968160239508,-0.836031107327,-0.613371432701,-0.324253423404,
+  0E-12,0.324253423404,0.613371432701,0.836031107327,
+  0.968160239508,-0.968160239508,-0.836031107327,-0.613371432701,
+  -0.324253423404,0E-12,0.324253423404,0.613371432701,
+  0.836031107327,0.968160239508,-0.968160239508,-0.836031107327,
+  -0.613371432701,-0.324253423404,0E-12,0.324253423404,
+  0.613371432701,0.836031107327,0.968160239508,-0.968160239508,
+  -0.836031107327,-0.613371432701,-0.324253423404,0E-12,
+  0.324253423404,0.613371432701,0.836031107327,0.968160239508,
+  -0.968160239508,-0.836031107327,-0.613371432701,-0.324253423404,
+  0E-12,0.324253423404,0.613371432701,0.836031107327,
+  0.968160239508,-0.968160239508,-0.836031107327,-0.613371432701,
+  -0.324253423404,0E-12,0.324253423404,0.613371432701,
+  0.836031107327,0.968160239508,-0.968160239508,-0.836031107327,
+  -0.613371432701,-0.324253423404,0E-12,0.324253423404,
+  0.613371432701,0.836031107327,0.968160239508,-0.968160239508,
+  -0.836031107327,-0.613371432701,-0.324253423404,0E-12,
+  0.324253423404,0.613371432701,0.836031107327,0.968160239508,
+  -0.968160239508,-0.836031107327,-0.613371432701,-0.324253423404,
+  0E-12,0.324253423404,0.613371432701,0.836031107327,
+  0.968160239508,-0.968160239508,-0.836031107327,-0.613371432701,
+  -0.324253423404,0E-12,0.324253423404,0.613371432701,
+  0.836031107327,0.968160239508,-0.968160239508,-0.836031107327,
+  -0.613371432701,-0.324253423404,0E-12,0.324253423404,
+  0.613371432701,0.836031107327,0.968160239508
+};
+static const double cubature_hexa_9_weights[]={
+  0.000536860102,0.001193276159,0.001721470784,0.002063216802,
+  0.002181404713,0.002063216802,0.001721470784,0.001193276159,
+  0.000536860102,0.001193276159,0.002652288718,0.003826304167,
+  0.004585901265,0.00484859692,0.004585901265,0.003826304167,
+  0.002652288718,0.001193276159,0.001721470784,0.003826304167,
+  0.005519988632,0.006615815615,0.006994791506,0.006615815615,
+  0.005519988632,0.003826304167,0.001721470784,0.002063216802,
+  0.004585901265,0.006615815615,0.007929185939,0.008383396045,
+  0.007929185939,0.006615815615,0.004585901265,0.002063216802,
+  0.002181404713,0.00484859692,0.006994791506,0.008383396045,
+  0.008863624814,0.008383396045,0.006994791506,0.00484859692,
+  0.002181404713,0.002063216802,0.004585901265,0.006615815615,
+  0.007929185939,0.008383396045,0.007929185939,0.006615815615,
+  0.004585901265,0.002063216802,0.001721470784,0.003826304167,
+  0.005519988632,0.006615815615,0.006994791506,0.006615815615,
+  0.005519988632,0.003826304167,0.001721470784,0.001193276159,
+  0.002652288718,0.003826304167,0.004585901265,0.00484859692,
+  0.004585901265,0.003826304167,0.002652288718,0.001193276159,
+  0.000536860102,0.001193276159,0.001721470784,0.002063216802,
+  0.002181404713,0.002063216802,0.001721470784,0.001193276159,
+  0.000536860102,0.001193276159,0.002652288718,0.003826304167,
+  0.004585901265,0.00484859692,0.004585901265,0.003826304167,
+  0.002652288718,0.001193276159,0.002652288718,0.005895228352,
+  0.008504706389,0.010193058912,0.010776951181,0.010193058912,
+  0.008504706389,0.005895228352,0.002652288718,0.003826304167,
+  0.008504706389,0.01226925005,0.01470493899,0.015547286734,
+  0.01470493899,0.01226925005,0.008504706389,0.003826304167,
+  0.004585901265,0.010193058912,0.01470493899,0.017624160385,
+  0.018633730827,0.017624160385,0.01470493899,0.010193058912,
+  0.004585901265,0.00484859692,0.010776951181,0.015547286734,
+  0.018633730827,0.019701132816,0.018633730827,0.015547286734,
+  0.010776951181,0.00484859692,0.004585901265,0.010193058912,
+  0.01470493899,0.017624160385,0.018633730827,0.017624160385,
+  0.01470493899,0.010193058912,0.004585901265,0.003826304167,
+  0.008504706389,0.01226925005,0.01470493899,0.015547286734,
+  0.01470493899,0.01226925005,0.008504706389,0.003826304167,
+  0.002652288718,0.005895228352,0.008504706389,0.010193058912,
+  0.010776951181,0.010193058912,0.008504706389,0.005895228352,
+  0.002652288718,0.001193276159,0.002652288718,0.003826304167,
+  0.004585901265,0.00484859692,0.004585901265,0.003826304167,
+  0.002652288718,0.001193276159,0.001721470784,0.003826304167,
+  0.005519988632,0.006615815615,0.006994791506,0.006615815615,
+  0.005519988632,0.003826304167,0.001721470784,0.003826304167,
+  0.008504706389,0.01226925005,0.01470493899,0.015547286734,
+  0.01470493899,0.01226925005,0.008504706389,0.003826304167,
+  0.005519988632,0.01226925005,0.017700140359,0.021213968501,
+  0.022429175074,0.021213968501,0.017700140359,0.01226925005,
+  0.005519988632,0.006615815615,0.01470493899,0.021213968501,
+  0.025425361066,0.026881810192,0.025425361066,0.021213968501,
+  0.01470493899,0.006615815615,0.006994791506,0.015547286734,
+  0.022429175074,0.026881810192,0.028421689561,0.026881810192,
+  0.022429175074,0.015547286734,0.006994791506,0.006615815615,
+  0.01470493899,0.021213968501,0.025425361066,0.026881810192,
+  0.025425361066,0.021213968501,0.01470493899,0.006615815615,
+  0.005519988632,0.01226925005,0.017700140359,0.021213968501,
+  0.022429175074,0.021213968501,0.017700140359,0.01226925005,
+  0.005519988632,0.003826304167,0.008504706389,0.01226925005,
+  0.01470493899,0.015547286734,0.01470493899,0.01226925005,
+  0.008504706389,0.003826304167,0.001721470784,0.003826304167,
+  0.005519988632,0.006615815615,0.006994791506,0.006615815615,
+  0.005519988632,0.003826304167,0.001721470784,0.002063216802,
+  0.004585901265,0.006615815615,0.007929185939,0.008383396045,
+  0.007929185939,0.006615815615,0.004585901265,0.002063216802,
+  0.004585901265,0.010193058912,0.01470493899,0.017624160385,
+  0.018633730827,0.017624160385,0.01470493899,0.010193058912,
+  0.004585901265,0.006615815615,0.01470493899,0.021213968501,
+  0.025425361066,0.026881810192,0.025425361066,0.021213968501,
+  0.01470493899,0.006615815615,0.007929185939,0.017624160385,
+  0.025425361066,0.030472798397,0.032218381497,0.030472798397,
+  0.025425361066,0.017624160385,0.007929185939,0.008383396045,
+  0.018633730827,0.026881810192,0.032218381497,0.034063957395,
+  0.032218381497,0.026881810192,0.018633730827,0.008383396045,
+  0.007929185939,0.017624160385,0.025425361066,0.030472798397,
+  0.032218381497,0.030472798397,0.025425361066,0.017624160385,
+  0.007929185939,0.006615815615,0.01470493899,0.021213968501,
+  0.025425361066,0.026881810192,0.025425361066,0.021213968501,
+  0.01470493899,0.006615815615,0.004585901265,0.010193058912,
+  0.01470493899,0.017624160385,0.018633730827,0.017624160385,
+  0.01470493899,0.010193058912,0.004585901265,0.002063216802,
+  0.004585901265,0.006615815615,0.007929185939,0.008383396045,
+  0.007929185939,0.006615815615,0.004585901265,0.002063216802,
+  0.002181404713,0.00484859692,0.006994791506,0.008383396045,
+  0.008863624814,0.008383396045,0.006994791506,0.00484859692,
+  0.002181404713,0.00484859692,0.010776951181,0.015547286734,
+  0.018633730827,0.019701132816,0.018633730827,0.015547286734,
+  0.010776951181,0.00484859692,0.006994791506,0.015547286734,
+  0.022429175074,0.026881810192,0.028421689561,0.026881810192,
+  0.022429175074,0.015547286734,0.006994791506,0.008383396045,
+  0.018633730827,0.026881810192,0.032218381497,0.034063957395,
+  0.032218381497,0.026881810192,0.018633730827,0.008383396045,
+  0.008863624814,0.019701132816,0.028421689561,0.034063957395,
+  0.036015254011,0.034063957395,0.028421689561,0.019701132816,
+  0.008863624814,0.008383396045,0.018633730827,0.026881810192,
+  0.032218381497,0.034063957395,0.032218381497,0.026881810192,
+  0.018633730827,0.008383396045,0.006994791506,0.015547286734,
+  0.022429175074,0.026881810192,0.028421689561,0.026881810192,
+  0.022429175074,0.015547286734,0.006994791506,0.00484859692,
+  0.010776951181,0.015547286734,0.018633730827,0.019701132816,
+  0.018633730827,0.015547286734,0.010776951181,0.00484859692,
+  0.002181404713,0.00484859692,0.006994791506,0.008383396045,
+  0.008863624814,0.008383396045,0.006994791506,0.00484859692,
+  0.002181404713,0.002063216802,0.004585901265,0.006615815615,
+  0.007929185939,0.008383396045,0.007929185939,0.006615815615,
+  0.004585901265,0.002063216802,0.004585901265,0.010193058912,
+  0.01470493899,0.017624160385,0.018633730827,0.017624160385,
+  0.01470493899,0.010193058912,0.004585901265,0.006615815615,
+  0.01470493899,0.021213968501,0.025425361066,0.026881810192,
+  0.025425361066,0.021213968501,0.01470493899,0.006615815615,
+  0.007929185939,0.017624160385,0.025425361066,0.030472798397,
+  0.032218381497,0.030472798397,0.025425361066,0.017624160385,
+  0.007929185939,0.008383396045,0.018633730827,0.026881810192,
+  0.032218381497,0.034063957395,0.032218381497,0.026881810192,
+  0.018633730827,0.008383396045,0.007929185939,0.017624160385,
+  0.025425361066,0.030472798397,0.032218381497,0.030472798397,
+  0.025425361066,0.017624160385,0.007929185939,0.006615815615,
+  0.01470493899,0.021213968501,0.025425361066,0.026881810192,
+  0.025425361066,0.021213968501,0.01470493899,0.006615815615,
+  0.004585901265,0.010193058912,0.01470493899,0.017624160385,
+  0.018633730827,0.017624160385,0.01470493899,0.010193058912,
+  0.004585901265,0.002063216802,0.004585901265,0.006615815615,
+  0.007929185939,0.008383396045,0.007929185939,0.006615815615,
+  0.004585901265,0.002063216802,0.001721470784,0.003826304167,
+  0.005519988632,0.006615815615,0.006994791506,0.006615815615,
+  0.005519988632,0.003826304167,0.001721470784,0.003826304167,
+  0.008504706389,0.01226925005,0.01470493899,0.015547286734,
+  0.01470493899,0.01226925005,0.008504706389,0.003826304167,
+  0.005519988632,0.01226925005,0.017700140359,0.021213968501,
+  0.022429175074,0.021213968501,0.017700140359,0.01226925005,
+  0.005519988632,0.006615815615,0.01470493899,0.021213968501,
+  0.025425361066,0.026881810192,0.025425361066,0.021213968501,
+  0.01470493899,0.006615815615,0.006994791506,0.015547286734,
+  0.022429175074,0.026881810192,0.028421689561,0.026881810192,
+  0.022429175074,0.015547286734,0.006994791506,0.006615815615,
+  0.01470493899,0.021213968501,0.025425361066,0.026881810192,
+  0.025425361066,0.021213968501,0.01470493899,0.006615815615,
+  0.005519988632,0.01226925005,0.017700140359,0.021213968501,
+  0.022429175074,0.021213968501,0.017700140359,0.01226925005,
+  0.005519988632,0.003826304167,0.008504706389,0.01226925005,
+  0.01470493899,0.015547286734,0.01470493899,0.01226925005,
+  0.008504706389,0.003826304167,0.001721470784,0.003826304167,
+  0.005519988632,0.006615815615,0.006994791506,0.006615815615,
+  0.005519988632,0.003826304167,0.001721470784,0.001193276159,
+  0.002652288718,0.003826304167,0.004585901265,0.00484859692,
+  0.004585901265,0.003826304167,0.002652288718,0.001193276159,
+  0.002652288718,0.005895228352,0.008504706389,0.010193058912,
+  0.010776951181,0.010193058912,0.008504706389,0.005895228352,
+  0.002652288718,0.003826304167,0.008504706389,0.01226925005,
+  0.01470493899,0.015547286734,0.01470493899,0.01226925005,
+  0.008504706389,0.003826304167,0.004585901265,0.010193058912,
+  0.01470493899,0.017624160385,0.018633730827,0.017624160385,
+  0.01470493899,0.010193058912,0.004585901265,0.00484859692,
+  0.010776951181,0.015547286734,0.018633730827,0.019701132816,
+  0.018633730827,0.015547286734,0.010776951181,0.00484859692,
+  0.004585901265,0.010193058912,0.01470493899,0.017624160385,
+  0.018633730827,0.017624160385,0.01470493899,0.010193058912,
+  0.004585901265,0.003826304167,0.008504706389,0.01226925005,
+  0.01470493899,0.015547286734,0.01470493899,0.01226925005,
+  0.008504706389,0.003826304167,0.002652288718,0.005895228352,
+  0.008504706389,0.010193058912,0.010776951181,0.010193058912,
+  0.008504706389,0.005895228352,0.002652288718,0.001193276159,
+  0.002652288718,0.003826304167,0.004585901265,0.00484859692,
+  0.004585901265,0.003826304167,0.002652288718,0.001193276159,
+  0.000536860102,0.001193276159,0.001721470784,0.002063216802,
+  0.002181404713,0.002063216802,0.001721470784,0.001193276159,
+  0.000536860102,0.001193276159,0.002652288718,0.003826304167,
+  0.004585901265,0.00484859692,0.004585901265,0.003826304167,
+  0.002652288718,0.001193276159,0.001721470784,0.003826304167,
+  0.005519988632,0.006615815615,0.006994791506,0.006615815615,
+  0.005519988632,0.003826304167,0.001721470784,0.002063216802,
+  0.004585901265,0.006615815615,0.007929185939,0.008383396045,
+  0.007929185939,0.006615815615,0.004585901265,0.002063216802,
+  0.002181404713,0.00484859692,0.006994791506,0.008383396045,
+  0.008863624814,0.008383396045,0.006994791506,0.00484859692,
+  0.002181404713,0.002063216802,0.004585901265,0.006615815615,
+  0.007929185939,0.008383396045,0.007929185939,0.006615815615,
+  0.004585901265,0.002063216802,0.001721470784,0.003826304167,
+  0.005519988632,0.006615815615,0.006994791506,0.006615815615,
+  0.005519988632,0.003826304167,0.001721470784,0.001193276159,
+  0.002652288718,0.003826304167,0.004585901265,0.00484859692,
+  0.004585901265,0.003826304167,0.002652288718,0.001193276159,
+  0.000536860102,0.001193276159,0.001721470784,0.002063216802,
+  0.002181404713,0.002063216802,0.001721470784,0.001193276159,
+  0.000536860102
+};
+static const double cubature_hexa_10_locs[]={
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.973906528517,-0.973906528517,-0.865063366689,-0.865063366689,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.679409568299,-0.679409568299,-0.433395394129,-0.433395394129,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  -0.148874338982,-0.148874338982,0.148874338982,0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.433395394129,0.433395394129,0.679409568299,0.679409568299,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.865063366689,0.865063366689,0.973906528517,0.973906528517,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.973906528517,-0.973906528517,-0.865063366689,-0.865063366689,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.679409568299,-0.679409568299,-0.433395394129,-0.433395394129,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  -0.148874338982,-0.148874338982,0.148874338982,0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.433395394129,0.433395394129,0.679409568299,0.679409568299,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.865063366689,0.865063366689,0.973906528517,0.973906528517,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.973906528517,-0.973906528517,-0.865063366689,-0.865063366689,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.679409568299,-0.679409568299,-0.433395394129,-0.433395394129,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  -0.148874338982,-0.148874338982,0.148874338982,0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.433395394129,0.433395394129,0.679409568299,0.679409568299,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.865063366689,0.865063366689,0.973906528517,0.973906528517,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.973906528517,-0.973906528517,-0.865063366689,-0.865063366689,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.679409568299,-0.679409568299,-0.433395394129,-0.433395394129,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  -0.148874338982,-0.148874338982,0.148874338982,0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.433395394129,0.433395394129,0.679409568299,0.679409568299,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.865063366689,0.865063366689,0.973906528517,0.973906528517,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.973906528517,-0.973906528517,-0.865063366689,-0.865063366689,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.679409568299,-0.679409568299,-0.433395394129,-0.433395394129,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  -0.148874338982,-0.148874338982,0.148874338982,0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.433395394129,0.433395394129,0.679409568299,0.679409568299,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.865063366689,0.865063366689,0.973906528517,0.973906528517,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.973906528517,-0.973906528517,-0.865063366689,-0.865063366689,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.679409568299,-0.679409568299,-0.433395394129,-0.433395394129,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  -0.148874338982,-0.148874338982,0.148874338982,0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.433395394129,0.433395394129,0.679409568299,0.679409568299,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.865063366689,0.865063366689,0.973906528517,0.973906528517,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.973906528517,-0.973906528517,-0.865063366689,-0.865063366689,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.679409568299,-0.679409568299,-0.433395394129,-0.433395394129,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  -0.148874338982,-0.148874338982,0.148874338982,0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.433395394129,0.433395394129,0.679409568299,0.679409568299,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.865063366689,0.865063366689,0.973906528517,0.973906528517,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.973906528517,-0.973906528517,-0.865063366689,-0.865063366689,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.679409568299,-0.679409568299,-0.433395394129,-0.433395394129,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  -0.148874338982,-0.148874338982,0.148874338982,0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.433395394129,0.433395394129,0.679409568299,0.679409568299,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.865063366689,0.865063366689,0.973906528517,0.973906528517,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.973906528517,-0.973906528517,-0.865063366689,-0.865063366689,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.679409568299,-0.679409568299,-0.433395394129,-0.433395394129,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  -0.148874338982,-0.148874338982,0.148874338982,0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.433395394129,0.433395394129,0.679409568299,0.679409568299,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.865063366689,0.865063366689,0.973906528517,0.973906528517,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.973906528517,-0.973906528517,-0.973906528517,-0.973906528517,
+  -0.973906528517,-0.973906528517,-0.865063366689,-0.865063366689,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.865063366689,-0.865063366689,-0.865063366689,-0.865063366689,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.679409568299,-0.679409568299,-0.679409568299,-0.679409568299,
+  -0.679409568299,-0.679409568299,-0.433395394129,-0.433395394129,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.433395394129,-0.433395394129,-0.433395394129,-0.433395394129,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  -0.148874338982,-0.148874338982,-0.148874338982,-0.148874338982,
+  -0.148874338982,-0.148874338982,0.148874338982,0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.148874338982,0.148874338982,0.148874338982,0.148874338982,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.433395394129,0.433395394129,0.433395394129,0.433395394129,
+  0.433395394129,0.433395394129,0.679409568299,0.679409568299,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.679409568299,0.679409568299,0.679409568299,0.679409568299,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.865063366689,0.865063366689,0.865063366689,0.865063366689,
+  0.865063366689,0.865063366689,0.973906528517,0.973906528517,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  0.973906528517,0.973906528517,0.973906528517,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517,
+  -0.973906528517,-0.865063366689,-0.679409568299,-0.433395394129,
+  -0.148874338982,0.148874338982,0.433395394129,0.679409568299,
+  0.865063366689,0.973906528517,-0.973906528517,-0.865063366689,
+  -0.679409568299,-0.433395394129,-0.148874338982,0.148874338982,
+  0.433395394129,0.679409568299,0.865063366689,0.973906528517
+};
+static const double cubature_hexa_10_weights[]={
+  0.000296358669,0.000664321432,0.000973853813,0.001196908918,
+  0.001313625319,0.001313625319,0.001196908918,0.000973853813,
+  0.000664321432,0.000296358669,0.000664321432,0.001489151529,
+  0.002183003323,0.002683006538,0.002944639534,0.002944639534,
+  0.002683006538,0.002183003323,0.001489151529,0.000664321432,
+  0.000973853813,0.002183003323,0.003200146804,0.003933120352,
+  0.004316658017,0.004316658017,0.003933120352,0.003200146804,
+  0.002183003323,0.000973853813,0.001196908918,0.002683006538,
+  0.003933120352,0.004833976892,0.005305361454,0.005305361454,
+  0.004833976892,0.003933120352,0.002683006538,0.001196908918,
+  0.001313625319,0.002944639534,0.004316658017,0.005305361454,
+  0.005822713013,0.005822713013,0.005305361454,0.004316658017,
+  0.002944639534,0.001313625319,0.001313625319,0.002944639534,
+  0.004316658017,0.005305361454,0.005822713013,0.005822713013,
+  0.005305361454,0.004316658017,0.002944639534,0.001313625319,
+  0.001196908918,0.002683006538,0.003933120352,0.004833976892,
+  0.005305361454,0.005305361454,0.004833976892,0.003933120352,
+  0.002683006538,0.001196908918,0.000973853813,0.002183003323,
+  0.003200146804,0.003933120352,0.004316658017,0.004316658017,
+  0.003933120352,0.003200146804,0.002183003323,0.000973853813,
+  0.000664321432,0.001489151529,0.002183003323,0.002683006538,
+  0.002944639534,0.002944639534,0.002683006538,0.002183003323,
+  0.001489151529,0.000664321432,0.000296358669,0.000664321432,
+  0.000973853813,0.001196908918,0.001313625319,0.001313625319,
+  0.001196908918,0.000973853813,0.000664321432,0.000296358669,
+  0.000664321432,0.001489151529,0.002183003323,0.002683006538,
+  0.002944639534,0.002944639534,0.002683006538,0.002183003323,
+  0.001489151529,0.000664321432,0.001489151529,0.003338101361,
+  0.00489344853,0.006014262214,0.006600742129,0.006600742129,
+  0.006014262214,0.00489344853,0.003338101361,0.001489151529,
+  0.002183003323,0.00489344853,0.007173490535,0.008816533536,
+  0.009676276535,0.009676276535,0.008816533536,0.007173490535,
+  0.00489344853,0.002183003323,0.002683006538,0.006014262214,
+  0.008816533536,0.010835905227,0.011892566967,0.011892566967,
+  0.010835905227,0.008816533536,0.006014262214,0.002683006538,
+  0.002944639534,0.006600742129,0.009676276535,0.011892566967,
+  0.013052268924,0.013052268924,0.011892566967,0.009676276535,
+  0.006600742129,0.002944639534,0.002944639534,0.006600742129,
+  0.009676276535,0.011892566967,0.013052268924,0.013052268924,
+  0.011892566967,0.009676276535,0.006600742129,0.002944639534,
+  0.002683006538,0.006014262214,0.008816533536,0.010835905227,
+  0.011892566967,0.011892566967,0.010835905227,0.008816533536,
+  0.006014262214,0.002683006538,0.002183003323,0.00489344853,
+  0.007173490535,0.008816533536,0.009676276535,0.009676276535,
+  0.008816533536,0.007173490535,0.00489344853,0.002183003323,
+  0.001489151529,0.003338101361,0.00489344853,0.006014262214,
+  0.006600742129,0.006600742129,0.006014262214,0.00489344853,
+  0.003338101361,0.001489151529,0.000664321432,0.001489151529,
+  0.002183003323,0.002683006538,0.002944639534,0.002944639534,
+  0.002683006538,0.002183003323,0.001489151529,0.000664321432,
+  0.000973853813,0.002183003323,0.003200146804,0.003933120352,
+  0.004316658017,0.004316658017,0.003933120352,0.003200146804,
+  0.002183003323,0.000973853813,0.002183003323,0.00489344853,
+  0.007173490535,0.008816533536,0.009676276535,0.009676276535,
+  0.008816533536,0.007173490535,0.00489344853,0.002183003323,
+  0.003200146804,0.007173490535,0.010515889999,0.012924488627,
+  0.014184818276,0.014184818276,0.012924488627,0.010515889999,
+  0.007173490535,0.003200146804,0.003933120352,0.008816533536,
+  0.012924488627,0.015884761659,0.017433761907,0.017433761907,
+  0.015884761659,0.012924488627,0.008816533536,0.003933120352,
+  0.004316658017,0.009676276535,0.014184818276,0.017433761907,
+  0.019133812692,0.019133812692,0.017433761907,0.014184818276,
+  0.009676276535,0.004316658017,0.004316658017,0.009676276535,
+  0.014184818276,0.017433761907,0.019133812692,0.019133812692,
+  0.017433761907,0.014184818276,0.009676276535,0.004316658017,
+  0.003933120352,0.008816533536,0.012924488627,0.015884761659,
+  0.017433761907,0.017433761907,0.015884761659,0.012924488627,
+  0.008816533536,0.003933120352,0.003200146804,0.007173490535,
+  0.010515889999,0.012924488627,0.014184818276,0.014184818276,
+  0.012924488627,0.010515889999,0.007173490535,0.003200146804,
+  0.002183003323,0.00489344853,0.007173490535,0.008816533536,
+  0.009676276535,0.009676276535,0.008816533536,0.007173490535,
+  0.00489344853,0.002183003323,0.000973853813,0.002183003323,
+  0.003200146804,0.003933120352,0.004316658017,0.004316658017,
+  0.003933120352,0.003200146804,0.002183003323,0.000973853813,
+  0.001196908918,0.002683006538,0.003933120352,0.004833976892,
+  0.005305361454,0.005305361454,0.004833976892,0.003933120352,
+  0.002683006538,0.001196908918,0.002683006538,0.006014262214,
+  0.008816533536,0.010835905227,0.011892566967,0.011892566967,
+  0.010835905227,0.008816533536,0.006014262214,0.002683006538,
+  0.003933120352,0.008816533536,0.012924488627,0.015884761659,
+  0.017433761907,0.017433761907,0.015884761659,0.012924488627,
+  0.008816533536,0.003933120352,0.004833976892,0.010835905227,
+  0.015884761659,0.019523066656,0.021426855693,0.021426855693,
+  0.019523066656,0.015884761659,0.010835905227,0.004833976892,
+  0.005305361454,0.011892566967,0.017433761907,0.021426855693,
+  0.023516292444,0.023516292444,0.021426855693,0.017433761907,
+  0.011892566967,0.005305361454,0.005305361454,0.011892566967,
+  0.017433761907,0.021426855693,0.023516292444,0.023516292444,
+  0.021426855693,0.017433761907,0.011892566967,0.005305361454,
+  0.004833976892,0.010835905227,0.015884761659,0.019523066656,
+  0.021426855693,0.021426855693,0.019523066656,0.015884761659,
+  0.010835905227,0.004833976892,0.003933120352,0.008816533536,
+  0.012924488627,0.015884761659,0.017433761907,0.017433761907,
+  0.015884761659,0.012924488627,0.008816533536,0.003933120352,
+  0.002683006538,0.006014262214,0.008816533536,0.010835905227,
+  0.011892566967,0.011892566967,0.010835905227,0.008816533536,
+  0.006014262214,0.002683006538,0.001196908918,0.002683006538,
+  0.003933120352,0.004833976892,0.005305361454,0.005305361454,
+  0.004833976892,0.003933120352,0.002683006538,0.001196908918,
+  0.001313625319,0.002944639534,0.004316658017,0.005305361454,
+  0.005822713013,0.005822713013,0.005305361454,0.004316658017,
+  0.002944639534,0.001313625319,0.002944639534,0.006600742129,
+  0.009676276535,0.011892566967,0.013052268924,0.013052268924,
+  0.011892566967,0.009676276535,0.006600742129,0.002944639534,
+  0.004316658017,0.009676276535,0.014184818276,0.017433761907,
+  0.019133812692,0.019133812692,0.017433761907,0.014184818276,
+  0.009676276535,0.004316658017,0.005305361454,0.011892566967,
+  0.017433761907,0.021426855693,0.023516292444,0.023516292444,
+  0.021426855693,0.017433761907,0.011892566967,0.005305361454,
+  0.005822713013,0.013052268924,0.019133812692,0.023516292444,
+  0.02580948032,0.02580948032,0.023516292444,0.019133812692,
+  0.013052268924,0.005822713013,0.005822713013,0.013052268924,
+  0.019133812692,0.023516292444,0.02580948032,0.02580948032,
+  0.023516292444,0.019133812692,0.013052268924,0.005822713013,
+  0.005305361454,0.011892566967,0.017433761907,0.021426855693,
+  0.023516292444,0.023516292444,0.021426855693,0.017433761907,
+  0.011892566967,0.005305361454,0.004316658017,0.009676276535,
+  0.014184818276,0.017433761907,0.019133812692,0.019133812692,
+  0.017433761907,0.014184818276,0.009676276535,0.004316658017,
+  0.002944639534,0.006600742129,0.009676276535,0.011892566967,
+  0.013052268924,0.013052268924,0.011892566967,0.009676276535,
+  0.006600742129,0.002944639534,0.001313625319,0.002944639534,
+  0.004316658017,0.005305361454,0.005822713013,0.005822713013,
+  0.005305361454,0.004316658017,0.002944639534,0.001313625319,
+  0.001313625319,0.002944639534,0.004316658017,0.005305361454,
+  0.005822713013,0.005822713013,0.005305361454,0.004316658017,
+  0.002944639534,0.001313625319,0.002944639534,0.006600742129,
+  0.009676276535,0.011892566967,0.013052268924,0.013052268924,
+  0.011892566967,0.009676276535,0.006600742129,0.002944639534,
+  0.004316658017,0.009676276535,0.014184818276,0.017433761907,
+  0.019133812692,0.019133812692,0.017433761907,0.014184818276,
+  0.009676276535,0.004316658017,0.005305361454,0.011892566967,
+  0.017433761907,0.021426855693,0.023516292444,0.023516292444,
+  0.021426855693,0.017433761907,0.011892566967,0.005305361454,
+  0.005822713013,0.013052268924,0.019133812692,0.023516292444,
+  0.02580948032,0.02580948032,0.023516292444,0.019133812692,
+  0.013052268924,0.005822713013,0.005822713013,0.013052268924,
+  0.019133812692,0.023516292444,0.02580948032,0.02580948032,
+  0.023516292444,0.019133812692,0.013052268924,0.005822713013,
+  0.005305361454,0.011892566967,0.017433761907,0.021426855693,
+  0.023516292444,0.023516292444,0.021426855693,0.017433761907,
+  0.011892566967,0.005305361454,0.004316658017,0.009676276535,
+  0.014184818276,0.017433761907,0.019133812692,0.019133812692,
+  0.017433761907,0.014184818276,0.009676276535,0.004316658017,
+  0.002944639534,0.006600742129,0.009676276535,0.011892566967,
+  0.013052268924,0.013052268924,0.011892566967,0.009676276535,
+  0.006600742129,0.002944639534,0.001313625319,0.002944639534,
+  0.004316658017,0.005305361454,0.005822713013,0.005822713013,
+  0.005305361454,0.004316658017,0.002944639534,0.001313625319,
+  0.001196908918,0.002683006538,0.003933120352,0.004833976892,
+  0.005305361454,0.005305361454,0.004833976892,0.003933120352,
+  0.002683006538,0.001196908918,0.002683006538,0.006014262214,
+  0.008816533536,0.010835905227,0.011892566967,0.011892566967,
+  0.010835905227,0.008816533536,0.006014262214,0.002683006538,
+  0.003933120352,0.008816533536,0.012924488627,0.015884761659,
+  0.017433761907,0.017433761907,0.015884761659,0.012924488627,
+  0.008816533536,0.003933120352,0.004833976892,0.010835905227,
+  0.015884761659,0.019523066656,0.021426855693,0.021426855693,
+  0.019523066656,0.015884761659,0.010835905227,0.004833976892,
+  0.005305361454,0.011892566967,0.017433761907,0.021426855693,
+  0.023516292444,0.023516292444,0.021426855693,0.017433761907,
+  0.011892566967,0.005305361454,0.005305361454,0.011892566967,
+  0.017433761907,0.021426855693,0.023516292444,0.023516292444,
+  0.021426855693,0.017433761907,0.011892566967,0.005305361454,
+  0.004833976892,0.010835905227,0.015884761659,0.019523066656,
+  0.021426855693,0.021426855693,0.019523066656,0.015884761659,
+  0.010835905227,0.004833976892,0.003933120352,0.008816533536,
+  0.012924488627,0.015884761659,0.017433761907,0.017433761907,
+  0.015884761659,0.012924488627,0.008816533536,0.003933120352,
+  0.002683006538,0.006014262214,0.008816533536,0.010835905227,
+  0.011892566967,0.011892566967,0.010835905227,0.008816533536,
+  0.006014262214,0.002683006538,0.001196908918,0.002683006538,
+  0.003933120352,0.004833976892,0.005305361454,0.005305361454,
+  0.004833976892,0.003933120352,0.002683006538,0.001196908918,
+  0.000973853813,0.002183003323,0.003200146804,0.003933120352,
+  0.004316658017,0.004316658017,0.003933120352,0.003200146804,
+  0.002183003323,0.000973853813,0.002183003323,0.00489344853,
+  0.007173490535,0.008816533536,0.009676276535,0.009676276535,
+  0.008816533536,0.007173490535,0.00489344853,0.002183003323,
+  0.003200146804,0.007173490535,0.010515889999,0.012924488627,
+  0.014184818276,0.014184818276,0.012924488627,0.010515889999,
+  0.007173490535,0.003200146804,0.003933120352,0.008816533536,
+  0.012924488627,0.015884761659,0.017433761907,0.017433761907,
+  0.015884761659,0.012924488627,0.008816533536,0.003933120352,
+  0.004316658017,0.009676276535,0.014184818276,0.017433761907,
+  0.019133812692,0.019133812692,0.017433761907,0.014184818276,
+  0.009676276535,0.004316658017,0.004316658017,0.009676276535,
+  0.014184818276,0.017433761907,0.019133812692,0.019133812692,
+  0.017433761907,0.014184818276,0.009676276535,0.004316658017,
+  0.003933120352,0.008816533536,0.012924488627,0.015884761659,
+  0.017433761907,0.017433761907,0.015884761659,0.012924488627,
+  0.008816533536,0.003933120352,0.003200146804,0.007173490535,
+  0.010515889999,0.012924488627,0.014184818276,0.014184818276,
+  0.012924488627,0.010515889999,0.007173490535,0.003200146804,
+  0.002183003323,0.00489344853,0.007173490535,0.008816533536,
+  0.009676276535,0.009676276535,0.008816533536,0.007173490535,
+  0.00489344853,0.002183003323,0.000973853813,0.002183003323,
+  0.003200146804,0.003933120352,0.004316658017,0.004316658017,
+  0.003933120352,0.003200146804,0.002183003323,0.000973853813,
+  0.000664321432,0.001489151529,0.002183003323,0.002683006538,
+  0.002944639534,0.002944639534,0.002683006538,0.002183003323,
+  0.001489151529,0.000664321432,0.001489151529,0.003338101361,
+  0.00489344853,0.006014262214,0.006600742129,0.006600742129,
+  0.006014262214,0.00489344853,0.003338101361,0.001489151529,
+  0.002183003323,0.00489344853,0.007173490535,0.008816533536,
+  0.009676276535,0.009676276535,0.008816533536,0.007173490535,
+  0.00489344853,0.002183003323,0.002683006538,0.006014262214,
+  0.008816533536,0.010835905227,0.011892566967,0.011892566967,
+  0.010835905227,0.008816533536,0.006014262214,0.002683006538,
+  0.002944639534,0.006600742129,0.009676276535,0.011892566967,
+  0.013052268924,0.013052268924,0.011892566967,0.009676276535,
+  0.006600742129,0.002944639534,0.002944639534,0.006600742129,
+  0.009676276535,0.011892566967,0.013052268924,0.013052268924,
+  0.011892566967,0.009676276535,0.006600742129,0.002944639534,
+  0.002683006538,0.006014262214,0.008816533536,0.010835905227,
+  0.011892566967,0.011892566967,0.010835905227,0.008816533536,
+  0.006014262214,0.002683006538,0.002183003323,0.00489344853,
+  0.007173490535,0.008816533536,0.009676276535,0.009676276535,
+  0.008816533536,0.007173490535,0.00489344853,0.002183003323,
+  0.001489151529,0.003338101361,0.00489344853,0.006014262214,
+  0.006600742129,0.006600742129,0.006014262214,0.00489344853,
+  0.003338101361,0.001489151529,0.000664321432,0.001489151529,
+  0.002183003323,0.002683006538,0.002944639534,0.002944639534,
+  0.002683006538,0.002183003323,0.001489151529,0.000664321432,
+  0.000296358669,0.000664321432,0.000973853813,0.001196908918,
+  0.001313625319,0.001313625319,0.001196908918,0.000973853813,
+  0.000664321432,0.000296358669,0.000664321432,0.001489151529,
+  0.002183003323,0.002683006538,0.002944639534,0.002944639534,
+  0.002683006538,0.002183003323,0.001489151529,0.000664321432,
+  0.000973853813,0.002183003323,0.003200146804,0.003933120352,
+  0.004316658017,0.004316658017,0.003933120352,0.003200146804,
+  0.002183003323,0.000973853813,0.001196908918,0.002683006538,
+  0.003933120352,0.004833976892,0.005305361454,0.005305361454,
+  0.004833976892,0.003933120352,0.002683006538,0.001196908918,
+  0.001313625319,0.002944639534,0.004316658017,0.005305361454,
+  0.005822713013,0.005822713013,0.005305361454,0.004316658017,
+  0.002944639534,0.001313625319,0.001313625319,0.002944639534,
+  0.004316658017,0.005305361454,0.005822713013,0.005822713013,
+  0.005305361454,0.004316658017,0.002944639534,0.001313625319,
+  0.001196908918,0.002683006538,0.003933120352,0.004833976892,
+  0.005305361454,0.005305361454,0.004833976892,0.003933120352,
+  0.002683006538,0.001196908918,0.000973853813,0.002183003323,
+  0.003200146804,0.003933120352,0.004316658017,0.004316658017,
+  0.003933120352,0.003200146804,0.002183003323,0.000973853813,
+  0.000664321432,0.001489151529,0.002183003323,0.002683006538,
+  0.002944639534,0.002944639534,0.002683006538,0.002183003323,
+  0.001489151529,0.000664321432,0.000296358669,0.000664321432,
+  0.000973853813,0.001196908918,0.001313625319,0.001313625319,
+  0.001196908918,0.000973853813,0.000664321432,0.000296358669
+};
+static const double cubature_hexa_11_locs[]={
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.978228658146,-0.978228658146,-0.978228658146,-0.978228658146,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.887062599768,
+  -0.887062599768,-0.887062599768,-0.887062599768,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.730152005574,-0.730152005574,
+  -0.730152005574,-0.730152005574,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.519096129207,-0.519096129207,-0.519096129207,
+  -0.519096129207,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0.269543155952,-0.269543155952,-0.269543155952,-0.269543155952,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,-0E-12,
+  -0E-12,-0E-12,-0E-12,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.269543155952,0.269543155952,
+  0.269543155952,0.269543155952,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.519096129207,0.519096129207,0.519096129207,
+  0.519096129207,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.730152005574,0.730152005574,0.730152005574,0.730152005574,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.887062599768,
+  0.887062599768,0.887062599768,0.887062599768,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,0.978228658146,0.978228658146,
+  0.978228658146,0.978228658146,-0.978228658146,-0.887062599768,
+  -0.730152005574,-0.519096129207,-0.269543155952,-0E-12,
+  0.269543155952,0.519096129207,0.730152005574,0.887062599768,
+  0.978228658146,-0.978228658146,-0.887062599768,-0.730152005574,
+  -0.519096129207,-0.269543155952,-0E-12,0.269543155952,
+  0.519096129207,0.730152005574,0.887062599768,0.978228658146,
+  -0.978228658146,-0.887062599768,-0.730152005574,-0.519096129207,
+  -0.269543155952,-0E-12,0.269543155952,0.519096129207,
+  0.730152005574,0.887062599768,0.978228658146,-0.978228658146,
+  -0.887062599768,-0.730152005574,-0.519096129207,-0.269543155952,
+  -0E-12,0.269543155952,0.519096129207,0.730152005574,
+  0.887062599768,0.978228658146,-0.978228658146,-0.887062599768,
+  -0.730152005574,-0.519096129207,-0.269543155952,-0E-12,
+  0.269543155952,0.519096129207,0.730152005574,0.887062599768,
+  0.978228658146,-0.978228658146,-0.887062599768,-0.730152005574,
+  -0.519096129207,-0.269543155952,-0E-12,0.269543155952,
+  0.519096129207,0.730152005574,0.887062599768,0.978228658146,
+  -0.978228658146,-0.887062599768,-0.730152005574,-0.519096129207,
+  -0.269543155952,-0E-12,0.269543155952,0.519096129207,
+  0.730152005574,0.887062599768,0.978228658146,-0.978228658146,
+  -0.887062599768,-0.730152005574,-0.519096129207,-0.269543155952,
+  -0E-12,0.269543155952,0.519096129207,0.730152005574,
+  0.887062599768,0.978228658146,-0.978228658146,-0.887062599768,
+  -0.730152005574,-0.519096129207,-0.269543155952,-0E-12,
+  0.269543155952,0.519096129207,0.730152005574,0.887062599768,
+  0.978228658146,-0.978228658146,-0.887062599768,-0.730152005574,
+  -0.519096129207,-0.269543155952,-0E-12,0.269543155952,
+  0.519096129207,0.730152005574,0.887062599768,0.978228658146,
+  -0.978228658146,-0.887062599768,-0.730152005574,-0.519096129207,
+  -0.269543155952,-0E-12,0.269543155952,0.519096129207,
+  0.730152005574,0.887062599768,0.978228658146,-0.978228658146,
+  -0.887062599768,-0.730152005574,-0.519096129207,-0.269543155952,
+  -0E-12,0.269543155952,0.519096129207,0.730152005574,
+  0.887062599768,0.978228658146,-0.978228658146,-0.887062599768,
+  -0.730152005574,-0.519096129207,-0.269543155952,-0E-12,
+  0.269543155952,0.519096129207,0.730152005574,0.887062599768,
+  0.978228658146,-0.978228658146,-0.887062599768,-0.730152005574,
+  -0.519096129207,-0.269543155952,-0E-12,0.269543155952,
+  0.519096129207,0.730152005574,0.887062599768,0.978228658146,
+  -0.978228658146,-0.887062599768,-0.730152005574,-0.519096129207,
+  -0.269543155952,-0E-12,0.269543155952,0.519096129207,
+  0.730152005574,0.887062599768,0.978228658146,-0.978228658146,
+  -0.887062599768,-0.730152005574,-0.519096129207,-0.269543155952,
+  -0E-12,0.269543155952,0.519096129207,0.730152005574,
+  0.887062599768,0.978228658146,-0.978228658146,-0.887062599768,
+  -0.730152005574,-0.519096129207,-0.269543155952,-0E-12,
+  0.269543155952,0.519096129207,0.730152005574,0.887062599768,
+  0.978228658146,-0.978228658146,-0.887062599768,-0.730152005574,
+  -0.519096129207,-0.269543155952,-0E-12,0.269543155952,
+  0.519096129207,0.730152005574,0.887062599768,0.978228658146,
+  -0.978228658146,-0.887062599768,-0.730152005574,-0.519096129207,
+  -0.269543155952,-0E-12,0.269543155952,0.519096129207,
+  0.730152005574,0.887062599768,0.978228658146,-0.978228658146,
+  -0.887062599768,-0.730152005574,-0.519096129207,-0.269543155952,
+  -0E-12,0.269543155952,0.519096129207,0.730152005574,
+  0.887062599768,0.978228658146,-0.978228658146,-0.887062599768,
+  -0.730152005574,-0.519096129207,-0.269543155952,-0E-12,
+  0.269543155952,0.519096129207,0.730152005574,0.887062599768,
+  0.978228658146,-0.978228658146,-0.887062599768,-0.730152005574,
+  -0.519096129207,-0.269543155952,-0E-12,0.269543155952,
+  0.519096129207,0.730152005574,0.887062599768,0.978228658146,
+  -0.978228658146,-0.887062599768,-0.730152005574,-0.519096129207,
+  -0.269543155952,-0E-12,0.269543155952,0.519096129207,
+  0.730152005574,0.887062599768,0.978228658146,-0.978228658146,
+  -0.887062599768,-0.730152005574,-0.519096129207,-0.269543155952,
+  -0E-12,0.269543155952,0.519096129207,0.730152005574,
+  0.887062599768,0.978228658146,-0.978228658146,-0.887062599768,
+  -0.730152005574,-0.519096129207,-0.269543155952,-0E-12,
+  0.269543155952,0.519096129207,0.730152005574,0.887062599768,
+  0.978228658146,-0.978228658146,-0.887062599768,-0.730152005574,
+  -0.519096129207,-0.269543155952,-0E-12,0.269543155952,
+  0.519096129207,0.730152005574,0.887062599768,0.978228658146,
+  -0.978228658146,-0.887062599768,-0.730152005574,-0.519096129207,
+  -0.269543155952,-0E-12,0.269543155952,0.519096129207,
+  0.730152005574,0.887062599768,0.978228658146,-0.978228658146,
+  -0.887062599768,-0.730152005574,-0.519096129207,-0.269543155952,
+  -0E-12,0.269543155952,0.519096129207,0.730152005574,
+  0.887062599768,0.978228658146,-0.978228658146,-0.887062599768,
+  -0.730152005574,-0.519096129207,-0.269543155952,-0E-12,
+  0.269543155952,0.519096129207,0.730152005574,0.887062599768,
+  0.978228658146,-0.978228658146,-0.887062599768,-0.730152005574,
+  -0.519096129207,-0.269543155952,-0E-12,0.269543155952,
+  0.519096129207,0.730152005574,0.887062599768,0.978228658146,
+  -0.978228658146,-0.887062599768,-0.730152005574,-0.519096129207,
+  -0.269543155952,-0E-12,0.269543155952,0.519096129207,
+  0.730152005574,0.887062599768,0.978228658146,-0.978228658146,
+  -0.887062599768,-0.730152005574,-0.519096129207,-0.269543155952,
+  -0E-12,0.269543155952,0.519096129207,0.730152005574,
+  0.887062599768,0.978228658146,-0.978228658146,-0.887062599768,
+  -0.730152005574,-0.519096129207,-0.269543155952,-0E-12,
+  0.269543155952,0.519096129207,0.730152005574,0.887062599768,
+  0.978228658146,-0.978228658146,-0.887062599768,-0.730152005574,
+  -0.519096129207,-0.269543155952,-0E-12,0.269543155952,
+  0.519096129207,0.730152005574,0.887062599768,0.978228658146,
+  -0.978228658146,-0.887062599768,-0.730152005574,-0.519096129207,
+  -0.269543155952,-0E-12,0.269543155952,0.519096129207,
+  0.730152005574,0.887062599768,0.978228658146,-0.978228658146,
+  -0.887062599768,-0.730152005574,-0.519096129207,-0.269543155952,
+  -0E-12,0.269543155952,0.519096129207,0.730152005574,
+  0.887062599768,0.978228658146,-0.978228658146,-0.887062599768,
+  -0.730152005574,-0.519096129207,-0.269543155952,-0E-12,
+  0.269543155952,0.519096129207,0.730152005574,0.887062599768,
+  0.978228658146,-0.978228658146,-0.887062599768,-0.730152005574,
+  -0.519096129207,-0.269543155952,-0E-12,0.269543155952,
+  0.519096129207,0.730152005574,0.887062599768,0.978228658146,
+  -0.978228658146,-0.887062599768,-0.730152005574,-0.519096129207,
+  -0.269543155952,-0E-12,0.269543155952,0.519096129207,
+  0.730152005574,0.887062599768,0.978228658146,-0.978228658146,
+  -0.887062599768,-0.730152005574,-0.519096129207,-0.269543155952,
+  -0E-12,0.269543155952,0.519096129207,0.730152005574,
+  0.887062599768,0.978228658146,-0.978228658146,-0.887062599768,
+  -0.730152005574,-0.519096129207,-0.269543155952,-0E-12,
+  0.269543155952,0.519096129207,0.730152005574,0.887062599768,
+  0.978228658146,-0.978228658146,-0.887062599768,-0.730152005574,
+  -0.519096129207,-0.269543155952,-0E-12,0.269543155952,
+  0.519096129207,0.730152005574,0.887062599768,0.978228658146,
+  -0.978228658146,-0.887062599768,-0.730152005574,-0.519096129207,
+  -0.269543155952,-0E-12,0.269543155952,0.519096129207,
+  0.730152005574,0.887062599768,0.978228658146,-0.978228658146,
+  -0.887062599768,-0.730152005574,-0.519096129207,-0.269543155952,
+  -0E-12,0.269543155952,0.519096129207,0.730152005574,
+  0.887062599768,0.978228658146,-0.978228658146,-0.887062599768,
+  -0.730152005574,-0.519096129207,-0.269543155952,-0E-12,
+  0.269543155952,0.519096129207,0.730152005574,0.887062599768,
+  0.978228658146,-0.978228658146,-0.887062599768,-0.730152005574,
+  -0.519096129207,-0.269543155952,-0E-12,0.269543155952,
+  0.519096129207,0.730152005574,0.887062599768,0.978228658146,
+  -0.978228658146,-0.887062599768,-0.730152005574,-0.519096129207,
+  -0.269543155952,-0E-12,0.269543155952,0.519096129207,
+  0.730152005574,0.887062599768,0.978228658146,-0.978228658146,
+  -0.887062599768,-0.730152005574,-0.519096129207,-0.269543155952,
+  -0E-12,0.269543155952,0.519096129207,0.730152005574,
+  0.887062599768,0.978228658146,-0.978228658146,-0.887062599768,
+  -0.730152005574,-0.519096129207,-0.269543155952,-0E-12,
+  0.269543155952,0.519096129207,0.730152005574,0.887062599768,
+  0.978228658146,-0.978228658146,-0.887062599768,-0.730152005574,
+  -0.519096129207,-0.269543155952,-0E-12,0.269543155952,
+  0.519096129207,0.730152005574,0.887062599768,0.978228658146,
+  -0.978228658146,-0.887062599768,-0.730152005574,-0.519096129207,
+  -0.269543155952,-0E-12,0.269543155952,0.519096129207,
+  0.730152005574,0.887062599768,0.978228658146,-0.978228658146,
+  -0.887062599768,-0.730152005574,-0.519096129207,-0.269543155952,
+  -0E-12,0.269543155952,0.519096129207,0.730152005574,
+  0.887062599768,0.978228658146,-0.978228658146,-0.887062599768,
+  -0.730152005574,-0.519096129207,-0.269543155952,-0E-12,
+  0.269543155952,0.519096129207,0.730152005574,0.887062599768,
+  0.978228658146,-0.978228658146,-0.887062599768,-0.730152005574,
+  -0.519096129207,-0.269543155952,-0E-12,0.269543155952,
+  0.519096129207,0.730152005574,0.887062599768,0.978228658146,
+  -0.978228658146,-0.887062599768,-0.730152005574,-0.519096129207,
+  -0.269543155952,-0E-12,0.269543155952,0.519096129207,
+  0.730152005574,0.887062599768,0.978228658146,-0.978228658146,
+  -0.887062599768,-0.730152005574,-0.519096129207,-0.269543155952,
+  -0E-12,0.269543155952,0.519096129207,0.730152005574,
+  0.887062599768,0.978228658146,-0.978228658146,-0.887062599768,
+  -0.730152005574,-0.519096129207,-0.269543155952,-0E-12,
+  0.269543155952,0.519096129207,0.730152005574,0.887062599768,
+  0.978228658146,-0.978228658146,-0.887062599768,-0.730152005574,
+  -0.519096129207,-0.269543155952,-0E-12,0.269543155952,
+  0.519096129207,0.730152005574,0.887062599768,0.978228658146,
+  -0.978228658146,-0.887062599768,-0.730152005574,-0.519096129207,
+  -0.269543155952,-0E-12,0.269543155952,0.519096129207,
+  0.730152005574,0.887062599768,0.978228658146,-0.978228658146,
+  -0.887062599768,-0.730152005574,-0.519096129207,-0.269543155952,
+  -0E-12,0.269543155952,0.519096129207,0.730152005574,
+  0.887062599768,0.978228658146,-0.978228658146,-0.887062599768,
+  -0.730152005574,-0.519096129207,-0.269543155952,-0E-12,
+  0.269543155952,0.519096129207,0.730152005574,0.887062599768,
+  0.978228658146,-0.978228658146,-0.887062599768,-0.730152005574,
+  -0.519096129207,-0.269543155952,-0E-12,0.269543155952,
+  0.519096129207,0.730152005574,0.887062599768,0.978228658146,
+  -0.978228658146,-0.887062599768,-0.730152005574,-0.519096129207,
+  -0.269543155952,-0E-12,0.269543155952,0.519096129207,
+  0.730152005574,0.887062599768,0.978228658146,-0.978228658146,
+  -0.887062599768,-0.730152005574,-0.519096129207,-0.269543155952,
+  -0E-12,0.269543155952,0.519096129207,0.730152005574,
+  0.887062599768,0.978228658146,-0.978228658146,-0.887062599768,
+  -0.730152005574,-0.519096129207,-0.269543155952,-0E-12,
+  0.269543155952,0.519096129207,0.730152005574,0.887062599768,
+  0.978228658146,-0.978228658146,-0.887062599768,-0.730152005574,
+  -0.519096129207,-0.269543155952,-0E-12,0.269543155952,
+  0.519096129207,0.730152005574,0.887062599768,0.978228658146,
+  -0.978228658146,-0.887062599768,-0.730152005574,-0.519096129207,
+  -0.269543155952,-0E-12,0.269543155952,0.519096129207,
+  0.730152005574,0.887062599768,0.978228658146,-0.978228658146,
+  -0.887062599768,-0.730152005574,-0.519096129207,-0.269543155952,
+  -0E-12,0.269543155952,0.519096129207,0.730152005574,
+  0.887062599768,0.978228658146,-0.978228658146,-0.887062599768,
+  -0.730152005574,-0.519096129207,-0.269543155952,-0E-12,
+  0.269543155952,0.519096129207,0.730152005574,0.887062599768,
+  0.978228658146,-0.978228658146,-0.887062599768,-0.730152005574,
+  -0.519096129207,-0.269543155952,-0E-12,0.269543155952,
+  0.519096129207,0.730152005574,0.887062599768,0.978228658146,
+  -0.978228658146,-0.887062599768,-0.730152005574,-0.519096129207,
+  -0.269543155952,-0E-12,0.269543155952,0.519096129207,
+  0.730152005574,0.887062599768,0.978228658146,-0.978228658146,
+  -0.887062599768,-0.730152005574,-0.519096129207,-0.269543155952,
+  -0E-12,0.269543155952,0.519096129207,0.730152005574,
+  0.887062599768,0.978228658146,-0.978228658146,-0.887062599768,
+  -0.730152005574,-0.519096129207,-0.269543155952,-0E-12,
+  0.269543155952,0.519096129207,0.730152005574,0.887062599768,
+  0.978228658146,-0.978228658146,-0.887062599768,-0.730152005574,
+  -0.519096129207,-0.269543155952,-0E-12,0.269543155952,
+  0.519096129207,0.730152005574,0.887062599768,0.978228658146,
+  -0.978228658146,-0.887062599768,-0.730152005574,-0.519096129207,
+  -0.269543155952,-0E-12,0.269543155952,0.519096129207,
+  0.730152005574,0.887062599768,0.978228658146,-0.978228658146,
+  -0.887062599768,-0.730152005574,-0.519096129207,-0.269543155952,
+  -0E-12,0.269543155952,0.519096129207,0.730152005574,
+  0.887062599768,0.978228658146,-0.978228658146,-0.887062599768,
+  -0.730152005574,-0.519096129207,-0.269543155952,-0E-12,
+  0.269543155952,0.519096129207,0.730152005574,0.887062599768,
+  0.978228658146,-0.978228658146,-0.887062599768,-0.730152005574,
+  -0.519096129207,-0.269543155952,-0E-12,0.269543155952,
+  0.519096129207,0.730152005574,0.887062599768,0.978228658146,
+  -0.978228658146,-0.887062599768,-0.730152005574,-0.519096129207,
+  -0.269543155952,-0E-12,0.269543155952,0.519096129207,
+  0.730152005574,0.887062599768,0.978228658146,-0.978228658146,
+  -0.887062599768,-0.730152005574,-0.519096129207,-0.269543155952,
+  -0E-12,0.269543155952,0.519096129207,0.730152005574,
+  0.887062599768,0.978228658146,-0.978228658146,-0.887062599768,
+  -0.730152005574,-0.519096129207,-0.269543155952,-0E-12,
+  0.269543155952,0.519096129207,0.730152005574,0.887062599768,
+  0.978228658146,-0.978228658146,-0.887062599768,-0.730152005574,
+  -0.519096129207,-0.269543155952,-0E-12,0.269543155952,
+  0.519096129207,0.730152005574,0.887062599768,0.978228658146,
+  -0.978228658146,-0.887062599768,-0.730152005574,-0.519096129207,
+  -0.269543155952,-0E-12,0.269543155952,0.519096129207,
+  0.730152005574,0.887062599768,0.978228658146,-0.978228658146,
+  -0.887062599768,-0.730152005574,-0.519096129207,-0.269543155952,
+  -0E-12,0.269543155952,0.519096129207,0.730152005574,
+  0.887062599768,0.978228658146,-0.978228658146,-0.887062599768,
+  -0.730152005574,-0.519096129207,-0.269543155952,-0E-12,
+  0.269543155952,0.519096129207,0.730152005574,0.887062599768,
+  0.978228658146,-0.978228658146,-0.887062599768,-0.730152005574,
+  -0.519096129207,-0.269543155952,-0E-12,0.269543155952,
+  0.519096129207,0.730152005574,0.887062599768,0.978228658146,
+  -0.978228658146,-0.887062599768,-0.730152005574,-0.519096129207,
+  -0.269543155952,-0E-12,0.269543155952,0.519096129207,
+  0.730152005574,0.887062599768,0.978228658146,-0.978228658146,
+  -0.887062599768,-0.730152005574,-0.519096129207,-0.269543155952,
+  -0E-12,0.269543155952,0.519096129207,0.730152005574,
+  0.887062599768,0.978228658146,-0.978228658146,-0.887062599768,
+  -0.730152005574,-0.519096129207,-0.269543155952,-0E-12,
+  0.269543155952,0.519096129207,0.730152005574,0.887062599768,
+  0.978228658146,-0.978228658146,-0.887062599768,-0.730152005574,
+  -0.519096129207,-0.269543155952,-0E-12,0.269543155952,
+  0.519096129207,0.730152005574,0.887062599768,0.978228658146,
+  -0.978228658146,-0.887062599768,-0.730152005574,-0.519096129207,
+  -0.269543155952,-0E-12,0.269543155952,0.519096129207,
+  0.730152005574,0.887062599768,0.978228658146,-0.978228658146,
+  -0.887062599768,-0.730152005574,-0.519096129207,-0.269543155952,
+  -0E-12,0.269543155952,0.519096129207,0.730152005574,
+  0.887062599768,0.978228658146,-0.978228658146,-0.887062599768,
+  -0.730152005574,-0.519096129207,-0.269543155952,-0E-12,
+  0.269543155952,0.519096129207,0.730152005574,0.887062599768,
+  0.978228658146,-0.978228658146,-0.887062599768,-0.730152005574,
+  -0.519096129207,-0.269543155952,-0E-12,0.269543155952,
+  0.519096129207,0.730152005574,0.887062599768,0.978228658146,
+  -0.978228658146,-0.887062599768,-0.730152005574,-0.519096129207,
+  -0.269543155952,-0E-12,0.269543155952,0.519096129207,
+  0.730152005574,0.887062599768,0.978228658146,-0.978228658146,
+  -0.887062599768,-0.730152005574,-0.519096129207,-0.269543155952,
+  -0E-12,0.269543155952,0.519096129207,0.730152005574,
+  0.887062599768,0.978228658146,-0.978228658146,-0.887062599768,
+  -0.730152005574,-0.519096129207,-0.269543155952,-0E-12,
+  0.269543155952,0.519096129207,0.730152005574,0.887062599768,
+  0.978228658146,-0.978228658146,-0.887062599768,-0.730152005574,
+  -0.519096129207,-0.269543155952,-0E-12,0.269543155952,
+  0.519096129207,0.730152005574,0.887062599768,0.978228658146,
+  -0.978228658146,-0.887062599768,-0.730152005574,-0.519096129207,
+  -0.269543155952,-0E-12,0.269543155952,0.519096129207,
+  0.730152005574,0.887062599768,0.978228658146,-0.978228658146,
+  -0.887062599768,-0.730152005574,-0.519096129207,-0.269543155952,
+  -0E-12,0.269543155952,0.519096129207,0.730152005574,
+  0.887062599768,0.978228658146,-0.978228658146,-0.887062599768,
+  -0.730152005574,-0.519096129207,-0.269543155952,-0E-12,
+  0.269543155952,0.519096129207,0.730152005574,0.887062599768,
+  0.978228658146,-0.978228658146,-0.887062599768,-0.730152005574,
+  -0.519096129207,-0.269543155952,-0E-12,0.269543155952,
+  0.519096129207,0.730152005574,0.887062599768,0.978228658146,
+  -0.978228658146,-0.887062599768,-0.730152005574,-0.519096129207,
+  -0.269543155952,-0E-12,0.269543155952,0.519096129207,
+  0.730152005574,0.887062599768,0.978228658146,-0.978228658146,
+  -0.887062599768,-0.730152005574,-0.519096129207,-0.269543155952,
+  -0E-12,0.269543155952,0.519096129207,0.730152005574,
+  0.887062599768,0.978228658146,-0.978228658146,-0.887062599768,
+  -0.730152005574,-0.519096129207,-0.269543155952,-0E-12,
+  0.269543155952,0.519096129207,0.730152005574,0.887062599768,
+  0.978228658146,-0.978228658146,-0.887062599768,-0.730152005574,
+  -0.519096129207,-0.269543155952,-0E-12,0.269543155952,
+  0.519096129207,0.730152005574,0.887062599768,0.978228658146,
+  -0.978228658146,-0.887062599768,-0.730152005574,-0.519096129207,
+  -0.269543155952,-0E-12,0.269543155952,0.519096129207,
+  0.730152005574,0.887062599768,0.978228658146,-0.978228658146,
+  -0.887062599768,-0.730152005574,-0.519096129207,-0.269543155952,
+  -0E-12,0.269543155952,0.519096129207,0.730152005574,
+  0.887062599768,0.978228658146,-0.978228658146,-0.887062599768,
+  -0.730152005574,-0.519096129207,-0.269543155952,-0E-12,
+  0.269543155952,0.519096129207,0.730152005574,0.887062599768,
+  0.978228658146,-0.978228658146,-0.887062599768,-0.730152005574,
+  -0.519096129207,-0.269543155952,-0E-12,0.269543155952,
+  0.519096129207,0.730152005574,0.887062599768,0.978228658146,
+  -0.978228658146,-0.887062599768,-0.730152005574,-0.519096129207,
+  -0.269543155952,-0E-12,0.269543155952,0.519096129207,
+  0.730152005574,0.887062599768,0.978228658146,-0.978228658146,
+  -0.887062599768,-0.730152005574,-0.519096129207,-0.269543155952,
+  -0E-12,0.269543155952,0.519096129207,0.730152005574,
+  0.887062599768,0.978228658146,-0.978228658146,-0.887062599768,
+  -0.730152005574,-0.519096129207,-0.269543155952,-0E-12,
+  0.269543155952,0.519096129207,0.730152005574,0.887062599768,
+  0.978228658146,-0.978228658146,-0.887062599768,-0.730152005574,
+  -0.519096129207,-0.269543155952,-0E-12,0.269543155952,
+  0.519096129207,0.730152005574,0.887062599768,0.978228658146,
+  -0.978228658146,-0.887062599768,-0.730152005574,-0.519096129207,
+  -0.269543155952,-0E-12,0.269543155952,0.519096129207,
+  0.730152005574,0.887062599768,0.978228658146,-0.978228658146,
+  -0.887062599768,-0.730152005574,-0.519096129207,-0.269543155952,
+  -0E-12,0.269543155952,0.519096129207,0.730152005574,
+  0.887062599768,0.978228658146,-0.978228658146,-0.887062599768,
+  -0.730152005574,-0.519096129207,-0.269543155952,-0E-12,
+  0.269543155952,0.519096129207,0.730152005574,0.887062599768,
+  0.978228658146,-0.978228658146,-0.887062599768,-0.730152005574,
+  -0.519096129207,-0.269543155952,-0E-12,0.269543155952,
+  0.519096129207,0.730152005574,0.887062599768,0.978228658146,
+  -0.978228658146,-0.887062599768,-0.730152005574,-0.519096129207,
+  -0.269543155952,-0E-12,0.269543155952,0.519096129207,
+  0.730152005574,0.887062599768,0.978228658146,-0.978228658146,
+  -0.887062599768,-0.730152005574,-0.519096129207,-0.269543155952,
+  -0E-12,0.269543155952,0.519096129207,0.730152005574,
+  0.887062599768,0.978228658146,-0.978228658146,-0.887062599768,
+  -0.730152005574,-0.519096129207,-0.269543155952,-0E-12,
+  0.269543155952,0.519096129207,0.730152005574,0.887062599768,
+  0.978228658146
+};
+static const double cubature_hexa_11_weights[]={
+  0.000172516297,0.000389172229,0.000577311382,0.000722664996,
+  0.000814428488,0.000845791941,0.000814428488,0.000722664996,
+  0.000577311382,0.000389172229,0.000172516297,0.000389172229,
+  0.000877917196,0.001302332366,0.001630229445,0.001837234831,
+  0.001907986319,0.001837234831,0.001630229445,0.001302332366,
+  0.000877917196,0.000389172229,0.000577311382,0.001302332366,
+  0.00193192433,0.00241833806,0.002725416923,0.002830372099,
+  0.002725416923,0.00241833806,0.00193192433,0.001302332366,
+  0.000577311382,0.000722664996,0.001630229445,0.00241833806,
+  0.003027219485,0.003411613682,0.003542994136,0.003411613682,
+  0.003027219485,0.00241833806,0.001630229445,0.000722664996,
+  0.000814428488,0.001837234831,0.002725416923,0.003411613682,
+  0.003844817983,0.003992881035,0.003844817983,0.003411613682,
+  0.002725416923,0.001837234831,0.000814428488,0.000845791941,
+  0.001907986319,0.002830372099,0.003542994136,0.003992881035,
+  0.004146645961,0.003992881035,0.003542994136,0.002830372099,
+  0.001907986319,0.000845791941,0.000814428488,0.001837234831,
+  0.002725416923,0.003411613682,0.003844817983,0.003992881035,
+  0.003844817983,0.003411613682,0.002725416923,0.001837234831,
+  0.000814428488,0.000722664996,0.001630229445,0.00241833806,
+  0.003027219485,0.003411613682,0.003542994136,0.003411613682,
+  0.003027219485,0.00241833806,0.001630229445,0.000722664996,
+  0.000577311382,0.001302332366,0.00193192433,0.00241833806,
+  0.002725416923,0.002830372099,0.002725416923,0.00241833806,
+  0.00193192433,0.001302332366,0.000577311382,0.000389172229,
+  0.000877917196,0.001302332366,0.001630229445,0.001837234831,
+  0.001907986319,0.001837234831,0.001630229445,0.001302332366,
+  0.000877917196,0.000389172229,0.000172516297,0.000389172229,
+  0.000577311382,0.000722664996,0.000814428488,0.000845791941,
+  0.000814428488,0.000722664996,0.000577311382,0.000389172229,
+  0.000172516297,0.000389172229,0.000877917196,0.001302332366,
+  0.001630229445,0.001837234831,0.001907986319,0.001837234831,
+  0.001630229445,0.001302332366,0.000877917196,0.000389172229,
+  0.000877917196,0.001980456325,0.002937876581,0.003677565753,
+  0.004144540461,0.004304145757,0.004144540461,0.003677565753,
+  0.002937876581,0.001980456325,0.000877917196,0.001302332366,
+  0.002937876581,0.004358146503,0.005455426694,0.006148152932,
+  0.00638491688,0.006148152932,0.005455426694,0.004358146503,
+  0.002937876581,0.001302332366,0.001630229445,0.003677565753,
+  0.005455426694,0.006828976584,0.007696115219,0.007992490838,
+  0.007696115219,0.006828976584,0.005455426694,0.003677565753,
+  0.001630229445,0.001837234831,0.004144540461,0.006148152932,
+  0.007696115219,0.008673362507,0.009007371693,0.008673362507,
+  0.007696115219,0.006148152932,0.004144540461,0.001837234831,
+  0.001907986319,0.004304145757,0.00638491688,0.007992490838,
+  0.009007371693,0.009354243495,0.009007371693,0.007992490838,
+  0.00638491688,0.004304145757,0.001907986319,0.001837234831,
+  0.004144540461,0.006148152932,0.007696115219,0.008673362507,
+  0.009007371693,0.008673362507,0.007696115219,0.006148152932,
+  0.004144540461,0.001837234831,0.001630229445,0.003677565753,
+  0.005455426694,0.006828976584,0.007696115219,0.007992490838,
+  0.007696115219,0.006828976584,0.005455426694,0.003677565753,
+  0.001630229445,0.001302332366,0.002937876581,0.004358146503,
+  0.005455426694,0.006148152932,0.00638491688,0.006148152932,
+  0.005455426694,0.004358146503,0.002937876581,0.001302332366,
+  0.000877917196,0.001980456325,0.002937876581,0.003677565753,
+  0.004144540461,0.004304145757,0.004144540461,0.003677565753,
+  0.002937876581,0.001980456325,0.000877917196,0.000389172229,
+  0.000877917196,0.001302332366,0.001630229445,0.001837234831,
+  0.001907986319,0.001837234831,0.001630229445,0.001302332366,
+  0.000877917196,0.000389172229,0.000577311382,0.001302332366,
+  0.00193192433,0.00241833806,0.002725416923,0.002830372099,
+  0.002725416923,0.00241833806,0.00193192433,0.001302332366,
+  0.000577311382,0.001302332366,0.002937876581,0.004358146503,
+  0.005455426694,0.006148152932,0.00638491688,0.006148152932,
+  0.005455426694,0.004358146503,0.002937876581,0.001302332366,
+  0.00193192433,0.004358146503,0.006465023432,0.008092766361,
+  0.009120380131,0.009471603862,0.009120380131,0.008092766361,
+  0.006465023432,0.004358146503,0.00193192433,0.00241833806,
+  0.005455426694,0.008092766361,0.010130337199,0.011416680279,
+  0.011856333998,0.011416680279,0.010130337199,0.008092766361,
+  0.005455426694,0.00241833806,0.002725416923,0.006148152932,
+  0.009120380131,0.011416680279,0.012866362297,0.013361842935,
+  0.012866362297,0.011416680279,0.009120380131,0.006148152932,
+  0.002725416923,0.002830372099,0.00638491688,0.009471603862,
+  0.011856333998,0.013361842935,0.013876404418,0.013361842935,
+  0.011856333998,0.009471603862,0.00638491688,0.002830372099,
+  0.002725416923,0.006148152932,0.009120380131,0.011416680279,
+  0.012866362297,0.013361842935,0.012866362297,0.011416680279,
+  0.009120380131,0.006148152932,0.002725416923,0.00241833806,
+  0.005455426694,0.008092766361,0.010130337199,0.011416680279,
+  0.011856333998,0.011416680279,0.010130337199,0.008092766361,
+  0.005455426694,0.00241833806,0.00193192433,0.004358146503,
+  0.006465023432,0.008092766361,0.009120380131,0.009471603862,
+  0.009120380131,0.008092766361,0.006465023432,0.004358146503,
+  0.00193192433,0.001302332366,0.002937876581,0.004358146503,
+  0.005455426694,0.006148152932,0.00638491688,0.006148152932,
+  0.005455426694,0.004358146503,0.002937876581,0.001302332366,
+  0.000577311382,0.001302332366,0.00193192433,0.00241833806,
+  0.002725416923,0.002830372099,0.002725416923,0.00241833806,
+  0.00193192433,0.001302332366,0.000577311382,0.000722664996,
+  0.001630229445,0.00241833806,0.003027219485,0.003411613682,
+  0.003542994136,0.003411613682,0.003027219485,0.00241833806,
+  0.001630229445,0.000722664996,0.001630229445,0.003677565753,
+  0.005455426694,0.006828976584,0.007696115219,0.007992490838,
+  0.007696115219,0.006828976584,0.005455426694,0.003677565753,
+  0.001630229445,0.00241833806,0.005455426694,0.008092766361,
+  0.010130337199,0.011416680279,0.011856333998,0.011416680279,
+  0.010130337199,0.008092766361,0.005455426694,0.00241833806,
+  0.003027219485,0.006828976584,0.010130337199,0.012680921109,
+  0.014291135536,0.014841483863,0.014291135536,0.012680921109,
+  0.010130337199,0.006828976584,0.003027219485,0.003411613682,
+  0.007696115219,0.011416680279,0.014291135536,0.016105813857,
+  0.016726045026,0.016105813857,0.014291135536,0.011416680279,
+  0.007696115219,0.003411613682,0.003542994136,0.007992490838,
+  0.011856333998,0.014841483863,0.016726045026,0.017370161154,
+  0.016726045026,0.014841483863,0.011856333998,0.007992490838,
+  0.003542994136,0.003411613682,0.007696115219,0.011416680279,
+  0.014291135536,0.016105813857,0.016726045026,0.016105813857,
+  0.014291135536,0.011416680279,0.007696115219,0.003411613682,
+  0.003027219485,0.006828976584,0.010130337199,0.012680921109,
+  0.014291135536,0.014841483863,0.014291135536,0.012680921109,
+  0.010130337199,0.006828976584,0.003027219485,0.00241833806,
+  0.005455426694,0.008092766361,0.010130337199,0.011416680279,
+  0.011856333998,0.011416680279,0.010130337199,0.008092766361,
+  0.005455426694,0.00241833806,0.001630229445,0.003677565753,
+  0.005455426694,0.006828976584,0.007696115219,0.007992490838,
+  0.007696115219,0.006828976584,0.005455426694,0.003677565753,
+  0.001630229445,0.000722664996,0.001630229445,0.00241833806,
+  0.003027219485,0.003411613682,0.003542994136,0.003411613682,
+  0.003027219485,0.00241833806,0.001630229445,0.000722664996,
+  0.000814428488,0.001837234831,0.002725416923,0.003411613682,
+  0.003844817983,0.003992881035,0.003844817983,0.003411613682,
+  0.002725416923,0.001837234831,0.000814428488,0.001837234831,
+  0.004144540461,0.006148152932,0.007696115219,0.008673362507,
+  0.009007371693,0.008673362507,0.007696115219,0.006148152932,
+  0.004144540461,0.001837234831,0.002725416923,0.006148152932,
+  0.009120380131,0.011416680279,0.012866362297,0.013361842935,
+  0.012866362297,0.011416680279,0.009120380131,0.006148152932,
+  0.002725416923,0.003411613682,0.007696115219,0.011416680279,
+  0.014291135536,0.016105813857,0.016726045026,0.016105813857,
+  0.014291135536,0.011416680279,0.007696115219,0.003411613682,
+  0.003844817983,0.008673362507,0.012866362297,0.016105813857,
+  0.018150918752,0.018849906438,0.018150918752,0.016105813857,
+  0.012866362297,0.008673362507,0.003844817983,0.003992881035,
+  0.009007371693,0.013361842935,0.016726045026,0.018849906438,
+  0.019575811978,0.018849906438,0.016726045026,0.013361842935,
+  0.009007371693,0.003992881035,0.003844817983,0.008673362507,
+  0.012866362297,0.016105813857,0.018150918752,0.018849906438,
+  0.018150918752,0.016105813857,0.012866362297,0.008673362507,
+  0.003844817983,0.003411613682,0.007696115219,0.011416680279,
+  0.014291135536,0.016105813857,0.016726045026,0.016105813857,
+  0.014291135536,0.011416680279,0.007696115219,0.003411613682,
+  0.002725416923,0.006148152932,0.009120380131,0.011416680279,
+  0.012866362297,0.013361842935,0.012866362297,0.011416680279,
+  0.009120380131,0.006148152932,0.002725416923,0.001837234831,
+  0.004144540461,0.006148152932,0.007696115219,0.008673362507,
+  0.009007371693,0.008673362507,0.007696115219,0.006148152932,
+  0.004144540461,0.001837234831,0.000814428488,0.001837234831,
+  0.002725416923,0.003411613682,0.003844817983,0.003992881035,
+  0.003844817983,0.003411613682,0.002725416923,0.001837234831,
+  0.000814428488,0.000845791941,0.001907986319,0.002830372099,
+  0.003542994136,0.003992881035,0.004146645961,0.003992881035,
+  0.003542994136,0.002830372099,0.001907986319,0.000845791941,
+  0.001907986319,0.004304145757,0.00638491688,0.007992490838,
+  0.009007371693,0.009354243495,0.009007371693,0.007992490838,
+  0.00638491688,0.004304145757,0.001907986319,0.002830372099,
+  0.00638491688,0.009471603862,0.011856333998,0.013361842935,
+  0.013876404418,0.013361842935,0.011856333998,0.009471603862,
+  0.00638491688,0.002830372099,0.003542994136,0.007992490838,
+  0.011856333998,0.014841483863,0.016726045026,0.017370161154,
+  0.016726045026,0.014841483863,0.011856333998,0.007992490838,
+  0.003542994136,0.003992881035,0.009007371693,0.013361842935,
+  0.016726045026,0.018849906438,0.019575811978,0.018849906438,
+  0.016726045026,0.013361842935,0.009007371693,0.003992881035,
+  0.004146645961,0.009354243495,0.013876404418,0.017370161154,
+  0.019575811978,0.020329671973,0.019575811978,0.017370161154,
+  0.013876404418,0.009354243495,0.004146645961,0.003992881035,
+  0.009007371693,0.013361842935,0.016726045026,0.018849906438,
+  0.019575811978,0.018849906438,0.016726045026,0.013361842935,
+  0.009007371693,0.003992881035,0.003542994136,0.007992490838,
+  0.011856333998,0.014841483863,0.016726045026,0.017370161154,
+  0.016726045026,0.014841483863,0.011856333998,0.007992490838,
+  0.003542994136,0.002830372099,0.00638491688,0.009471603862,
+  0.011856333998,0.013361842935,0.013876404418,0.013361842935,
+  0.011856333998,0.009471603862,0.00638491688,0.002830372099,
+  0.001907986319,0.004304145757,0.00638491688,0.007992490838,
+  0.009007371693,0.009354243495,0.009007371693,0.007992490838,
+  0.00638491688,0.004304145757,0.001907986319,0.000845791941,
+  0.001907986319,0.002830372099,0.003542994136,0.003992881035,
+  0.004146645961,0.003992881035,0.003542994136,0.002830372099,
+  0.001907986319,0.000845791941,0.000814428488,0.001837234831,
+  0.002725416923,0.003411613682,0.003844817983,0.003992881035,
+  0.003844817983,0.003411613682,0.002725416923,0.001837234831,
+  0.000814428488,0.001837234831,0.004144540461,0.006148152932,
+  0.007696115219,0.008673362507,0.009007371693,0.008673362507,
+  0.007696115219,0.006148152932,0.004144540461,0.001837234831,
+  0.002725416923,0.006148152932,0.009120380131,0.011416680279,
+  0.012866362297,0.013361842935,0.012866362297,0.011416680279,
+  0.009120380131,0.006148152932,0.002725416923,0.003411613682,
+  0.007696115219,0.011416680279,0.014291135536,0.016105813857,
+  0.016726045026,0.016105813857,0.014291135536,0.011416680279,
+  0.007696115219,0.003411613682,0.003844817983,0.008673362507,
+  0.012866362297,0.016105813857,0.018150918752,0.018849906438,
+  0.018150918752,0.016105813857,0.012866362297,0.008673362507,
+  0.003844817983,0.003992881035,0.009007371693,0.013361842935,
+  0.016726045026,0.018849906438,0.019575811978,0.018849906438,
+  0.016726045026,0.013361842935,0.009007371693,0.003992881035,
+  0.003844817983,0.008673362507,0.012866362297,0.016105813857,
+  0.018150918752,0.018849906438,0.018150918752,0.016105813857,
+  0.012866362297,0.008673362507,0.003844817983,0.003411613682,
+  0.007696115219,0.011416680279,0.014291135536,0.016105813857,
+  0.016726045026,0.016105813857,0.014291135536,0.011416680279,
+  0.007696115219,0.003411613682,0.002725416923,0.006148152932,
+  0.009120380131,0.011416680279,0.012866362297,0.013361842935,
+  0.012866362297,0.011416680279,0.009120380131,0.006148152932,
+  0.002725416923,0.001837234831,0.004144540461,0.006148152932,
+  0.007696115219,0.008673362507,0.009007371693,0.008673362507,
+  0.007696115219,0.006148152932,0.004144540461,0.001837234831,
+  0.000814428488,0.001837234831,0.002725416923,0.003411613682,
+  0.003844817983,0.003992881035,0.003844817983,0.003411613682,
+  0.002725416923,0.001837234831,0.000814428488,0.000722664996,
+  0.001630229445,0.00241833806,0.003027219485,0.003411613682,
+  0.003542994136,0.003411613682,0.003027219485,0.00241833806,
+  0.001630229445,0.000722664996,0.001630229445,0.003677565753,
+  0.005455426694,0.006828976584,0.007696115219,0.007992490838,
+  0.007696115219,0.006828976584,0.005455426694,0.003677565753,
+  0.001630229445,0.00241833806,0.005455426694,0.008092766361,
+  0.010130337199,0.011416680279,0.011856333998,0.011416680279,
+  0.010130337199,0.008092766361,0.005455426694,0.00241833806,
+  0.003027219485,0.006828976584,0.010130337199,0.012680921109,
+  0.014291135536,0.014841483863,0.014291135536,0.012680921109,
+  0.010130337199,0.006828976584,0.003027219485,0.003411613682,
+  0.007696115219,0.011416680279,0.014291135536,0.016105813857,
+  0.016726045026,0.016105813857,0.014291135536,0.011416680279,
+  0.007696115219,0.003411613682,0.003542994136,0.007992490838,
+  0.011856333998,0.014841483863,0.016726045026,0.017370161154,
+  0.016726045026,0.014841483863,0.011856333998,0.007992490838,
+  0.003542994136,0.003411613682,0.007696115219,0.011416680279,
+  0.014291135536,0.016105813857,0.016726045026,0.016105813857,
+  0.014291135536,0.011416680279,0.007696115219,0.003411613682,
+  0.003027219485,0.006828976584,0.010130337199,0.012680921109,
+  0.014291135536,0.014841483863,0.014291135536,0.012680921109,
+  0.010130337199,0.006828976584,0.003027219485,0.00241833806,
+  0.005455426694,0.008092766361,0.010130337199,0.011416680279,
+  0.011856333998,0.011416680279,0.010130337199,0.008092766361,
+  0.005455426694,0.00241833806,0.001630229445,0.003677565753,
+  0.005455426694,0.006828976584,0.007696115219,0.007992490838,
+  0.007696115219,0.006828976584,0.005455426694,0.003677565753,
+  0.001630229445,0.000722664996,0.001630229445,0.00241833806,
+  0.003027219485,0.003411613682,0.003542994136,0.003411613682,
+  0.003027219485,0.00241833806,0.001630229445,0.000722664996,
+  0.000577311382,0.001302332366,0.00193192433,0.00241833806,
+  0.002725416923,0.002830372099,0.002725416923,0.00241833806,
+  0.00193192433,0.001302332366,0.000577311382,0.001302332366,
+  0.002937876581,0.004358146503,0.005455426694,0.006148152932,
+  0.00638491688,0.006148152932,0.005455426694,0.004358146503,
+  0.002937876581,0.001302332366,0.00193192433,0.004358146503,
+  0.006465023432,0.008092766361,0.009120380131,0.009471603862,
+  0.009120380131,0.008092766361,0.006465023432,0.004358146503,
+  0.00193192433,0.00241833806,0.005455426694,0.008092766361,
+  0.010130337199,0.011416680279,0.011856333998,0.011416680279,
+  0.010130337199,0.008092766361,0.005455426694,0.00241833806,
+  0.002725416923,0.006148152932,0.009120380131,0.011416680279,
+  0.012866362297,0.013361842935,0.012866362297,0.011416680279,
+  0.009120380131,0.006148152932,0.002725416923,0.002830372099,
+  0.00638491688,0.009471603862,0.011856333998,0.013361842935,
+  0.013876404418,0.013361842935,0.011856333998,0.009471603862,
+  0.00638491688,0.002830372099,0.002725416923,0.006148152932,
+  0.009120380131,0.011416680279,0.012866362297,0.013361842935,
+  0.012866362297,0.011416680279,0.009120380131,0.006148152932,
+  0.002725416923,0.00241833806,0.005455426694,0.008092766361,
+  0.010130337199,0.011416680279,0.011856333998,0.011416680279,
+  0.010130337199,0.008092766361,0.005455426694,0.00241833806,
+  0.00193192433,0.004358146503,0.006465023432,0.008092766361,
+  0.009120380131,0.009471603862,0.009120380131,0.008092766361,
+  0.006465023432,0.004358146503,0.00193192433,0.001302332366,
+  0.002937876581,0.004358146503,0.005455426694,0.006148152932,
+  0.00638491688,0.006148152932,0.005455426694,0.004358146503,
+  0.002937876581,0.001302332366,0.000577311382,0.001302332366,
+  0.00193192433,0.00241833806,0.002725416923,0.002830372099,
+  0.002725416923,0.00241833806,0.00193192433,0.001302332366,
+  0.000577311382,0.000389172229,0.000877917196,0.001302332366,
+  0.001630229445,0.001837234831,0.001907986319,0.001837234831,
+  0.001630229445,0.001302332366,0.000877917196,0.000389172229,
+  0.000877917196,0.001980456325,0.002937876581,0.003677565753,
+  0.004144540461,0.004304145757,0.004144540461,0.003677565753,
+  0.002937876581,0.001980456325,0.000877917196,0.001302332366,
+  0.002937876581,0.004358146503,0.005455426694,0.006148152932,
+  0.00638491688,0.006148152932,0.005455426694,0.004358146503,
+  0.002937876581,0.001302332366,0.001630229445,0.003677565753,
+  0.005455426694,0.006828976584,0.007696115219,0.007992490838,
+  0.007696115219,0.006828976584,0.005455426694,0.003677565753,
+  0.001630229445,0.001837234831,0.004144540461,0.006148152932,
+  0.007696115219,0.008673362507,0.009007371693,0.008673362507,
+  0.007696115219,0.006148152932,0.004144540461,0.001837234831,
+  0.001907986319,0.004304145757,0.00638491688,0.007992490838,
+  0.009007371693,0.009354243495,0.009007371693,0.007992490838,
+  0.00638491688,0.004304145757,0.001907986319,0.001837234831,
+  0.004144540461,0.006148152932,0.007696115219,0.008673362507,
+  0.009007371693,0.008673362507,0.007696115219,0.006148152932,
+  0.004144540461,0.001837234831,0.001630229445,0.003677565753,
+  0.005455426694,0.006828976584,0.007696115219,0.007992490838,
+  0.007696115219,0.006828976584,0.005455426694,0.003677565753,
+  0.001630229445,0.001302332366,0.002937876581,0.004358146503,
+  0.005455426694,0.006148152932,0.00638491688,0.006148152932,
+  0.005455426694,0.004358146503,0.002937876581,0.001302332366,
+  0.000877917196,0.001980456325,0.002937876581,0.003677565753,
+  0.004144540461,0.004304145757,0.004144540461,0.003677565753,
+  0.002937876581,0.001980456325,0.000877917196,0.000389172229,
+  0.000877917196,0.001302332366,0.001630229445,0.001837234831,
+  0.001907986319,0.001837234831,0.001630229445,0.001302332366,
+  0.000877917196,0.000389172229,0.000172516297,0.000389172229,
+  0.000577311382,0.000722664996,0.000814428488,0.000845791941,
+  0.000814428488,0.000722664996,0.000577311382,0.000389172229,
+  0.000172516297,0.000389172229,0.000877917196,0.001302332366,
+  0.001630229445,0.001837234831,0.001907986319,0.001837234831,
+  0.001630229445,0.001302332366,0.000877917196,0.000389172229,
+  0.000577311382,0.001302332366,0.00193192433,0.00241833806,
+  0.002725416923,0.002830372099,0.002725416923,0.00241833806,
+  0.00193192433,0.001302332366,0.000577311382,0.000722664996,
+  0.001630229445,0.00241833806,0.003027219485,0.003411613682,
+  0.003542994136,0.003411613682,0.003027219485,0.00241833806,
+  0.001630229445,0.000722664996,0.000814428488,0.001837234831,
+  0.002725416923,0.003411613682,0.003844817983,0.003992881035,
+  0.003844817983,0.003411613682,0.002725416923,0.001837234831,
+  0.000814428488,0.000845791941,0.001907986319,0.002830372099,
+  0.003542994136,0.003992881035,0.004146645961,0.003992881035,
+  0.003542994136,0.002830372099,0.001907986319,0.000845791941,
+  0.000814428488,0.001837234831,0.002725416923,0.003411613682,
+  0.003844817983,0.003992881035,0.003844817983,0.003411613682,
+  0.002725416923,0.001837234831,0.000814428488,0.000722664996,
+  0.001630229445,0.00241833806,0.003027219485,0.003411613682,
+  0.003542994136,0.003411613682,0.003027219485,0.00241833806,
+  0.001630229445,0.000722664996,0.000577311382,0.001302332366,
+  0.00193192433,0.00241833806,0.002725416923,0.002830372099,
+  0.002725416923,0.00241833806,0.00193192433,0.001302332366,
+  0.000577311382,0.000389172229,0.000877917196,0.001302332366,
+  0.001630229445,0.001837234831,0.001907986319,0.001837234831,
+  0.001630229445,0.001302332366,0.000877917196,0.000389172229,
+  0.000172516297,0.000389172229,0.000577311382,0.000722664996,
+  0.000814428488,0.000845791941,0.000814428488,0.000722664996,
+  0.000577311382,0.000389172229,0.000172516297
+};
+static const double cubature_hexa_12_locs[]={
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.981560634247,-0.981560634247,-0.981560634247,-0.981560634247,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.904117256370,-0.904117256370,-0.904117256370,-0.904117256370,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.769902674194,-0.769902674194,-0.769902674194,-0.769902674194,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.587317954287,-0.587317954287,-0.587317954287,-0.587317954287,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.367831498998,-0.367831498998,-0.367831498998,-0.367831498998,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  -0.125233408511,-0.125233408511,-0.125233408511,-0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.125233408511,0.125233408511,0.125233408511,0.125233408511,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.367831498998,0.367831498998,0.367831498998,0.367831498998,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.587317954287,0.587317954287,0.587317954287,0.587317954287,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.769902674194,0.769902674194,0.769902674194,0.769902674194,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.904117256370,0.904117256370,0.904117256370,0.904117256370,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  0.981560634247,0.981560634247,0.981560634247,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247,
+  -0.981560634247,-0.904117256370,-0.769902674194,-0.587317954287,
+  -0.367831498998,-0.125233408511,0.125233408511,0.367831498998,
+  0.587317954287,0.769902674194,0.904117256370,0.981560634247
+};
+static const double cubature_hexa_12_weights[]={
+  0.000104989294,0.000237994792,0.000356256299,0.00045215162,
+  0.000519640527,0.000554479831,0.000554479831,0.000519640527,
+  0.00045215162,0.000356256299,0.000237994792,0.000104989294,
+  0.000237994792,0.000539498064,0.000807578948,0.001024959082,
+  0.001177946189,0.001256921602,0.001256921602,0.001177946189,
+  0.001024959082,0.000807578948,0.000539498064,0.000237994792,
+  0.000356256299,0.000807578948,0.001208871357,0.001534269411,
+  0.001763277029,0.001881495953,0.001881495953,0.001763277029,
+  0.001534269411,0.001208871357,0.000807578948,0.000356256299,
+  0.00045215162,0.001024959082,0.001534269411,0.001947256515,
+  0.002237907278,0.002387947792,0.002387947792,0.002237907278,
+  0.001947256515,0.001534269411,0.001024959082,0.00045215162,
+  0.000519640527,0.001177946189,0.001763277029,0.002237907278,
+  0.00257194106,0.002744376872,0.002744376872,0.00257194106,
+  0.002237907278,0.001763277029,0.001177946189,0.000519640527,
+  0.000554479831,0.001256921602,0.001881495953,0.002387947792,
+  0.002744376872,0.002928373645,0.002928373645,0.002744376872,
+  0.002387947792,0.001881495953,0.001256921602,0.000554479831,
+  0.000554479831,0.001256921602,0.001881495953,0.002387947792,
+  0.002744376872,0.002928373645,0.002928373645,0.002744376872,
+  0.002387947792,0.001881495953,0.001256921602,0.000554479831,
+  0.000519640527,0.001177946189,0.001763277029,0.002237907278,
+  0.00257194106,0.002744376872,0.002744376872,0.00257194106,
+  0.002237907278,0.001763277029,0.001177946189,0.000519640527,
+  0.00045215162,0.001024959082,0.001534269411,0.001947256515,
+  0.002237907278,0.002387947792,0.002387947792,0.002237907278,
+  0.001947256515,0.001534269411,0.001024959082,0.00045215162,
+  0.000356256299,0.000807578948,0.001208871357,0.001534269411,
+  0.001763277029,0.001881495953,0.001881495953,0.001763277029,
+  0.001534269411,0.001208871357,0.000807578948,0.000356256299,
+  0.000237994792,0.000539498064,0.000807578948,0.001024959082,
+  0.001177946189,0.001256921602,0.001256921602,0.001177946189,
+  0.001024959082,0.000807578948,0.000539498064,0.000237994792,
+  0.000104989294,0.000237994792,0.000356256299,0.00045215162,
+  0.000519640527,0.000554479831,0.000554479831,0.000519640527,
+  0.00045215162,0.000356256299,0.000237994792,0.000104989294,
+  0.000237994792,0.000539498064,0.000807578948,0.001024959082,
+  0.001177946189,0.001256921602,0.001256921602,0.001177946189,
+  0.001024959082,0.000807578948,0.000539498064,0.000237994792,
+  0.000539498064,0.001222960211,0.001830658878,0.002323426642,
+  0.002670225188,0.00284925046,0.00284925046,0.002670225188,
+  0.002323426642,0.001830658878,0.001222960211,0.000539498064,
+  0.000807578948,0.001830658878,0.00274032785,0.00347795584,
+  0.003997081344,0.0042650657,0.0042650657,0.003997081344,
+  0.00347795584,0.00274032785,0.001830658878,0.000807578948,
+  0.001024959082,0.002323426642,0.00347795584,0.00441413491,
+  0.005072996067,0.005413115136,0.005413115136,0.005072996067,
+  0.00441413491,0.00347795584,0.002323426642,0.001024959082,
+  0.001177946189,0.002670225188,0.003997081344,0.005072996067,
+  0.005830199942,0.006221085752,0.006221085752,0.005830199942,
+  0.005072996067,0.003997081344,0.002670225188,0.001177946189,
+  0.001256921602,0.00284925046,0.0042650657,0.005413115136,
+  0.006221085752,0.006638178503,0.006638178503,0.006221085752,
+  0.005413115136,0.0042650657,0.00284925046,0.001256921602,
+  0.001256921602,0.00284925046,0.0042650657,0.005413115136,
+  0.006221085752,0.006638178503,0.006638178503,0.006221085752,
+  0.005413115136,0.0042650657,0.00284925046,0.001256921602,
+  0.001177946189,0.002670225188,0.003997081344,0.005072996067,
+  0.005830199942,0.006221085752,0.006221085752,0.005830199942,
+  0.005072996067,0.003997081344,0.002670225188,0.001177946189,
+  0.001024959082,0.002323426642,0.00347795584,0.00441413491,
+  0.005072996067,0.005413115136,0.005413115136,0.005072996067,
+  0.00441413491,0.00347795584,0.002323426642,0.001024959082,
+  0.000807578948,0.001830658878,0.00274032785,0.00347795584,
+  0.003997081344,0.0042650657,0.0042650657,0.003997081344,
+  0.00347795584,0.00274032785,0.001830658878,0.000807578948,
+  0.000539498064,0.001222960211,0.001830658878,0.002323426642,
+  0.002670225188,0.00284925046,0.00284925046,0.002670225188,
+  0.002323426642,0.001830658878,0.001222960211,0.000539498064,
+  0.000237994792,0.000539498064,0.000807578948,0.001024959082,
+  0.001177946189,0.001256921602,0.001256921602,0.001177946189,
+  0.001024959082,0.000807578948,0.000539498064,0.000237994792,
+  0.000356256299,0.000807578948,0.001208871357,0.001534269411,
+  0.001763277029,0.001881495953,0.001881495953,0.001763277029,
+  0.001534269411,0.001208871357,0.000807578948,0.000356256299,
+  0.000807578948,0.001830658878,0.00274032785,0.00347795584,
+  0.003997081344,0.0042650657,0.0042650657,0.003997081344,
+  0.00347795584,0.00274032785,0.001830658878,0.000807578948,
+  0.001208871357,0.00274032785,0.004102018578,0.005206179789,
+  0.00598326289,0.006384410805,0.006384410805,0.00598326289,
+  0.005206179789,0.004102018578,0.00274032785,0.001208871357,
+  0.001534269411,0.00347795584,0.005206179789,0.006607553693,
+  0.007593808205,0.008102935146,0.008102935146,0.007593808205,
+  0.006607553693,0.005206179789,0.00347795584,0.001534269411,
+  0.001763277029,0.003997081344,0.00598326289,0.007593808205,
+  0.008727272714,0.009312392794,0.009312392794,0.008727272714,
+  0.007593808205,0.00598326289,0.003997081344,0.001763277029,
+  0.001881495953,0.0042650657,0.006384410805,0.008102935146,
+  0.009312392794,0.009936742256,0.009936742256,0.009312392794,
+  0.008102935146,0.006384410805,0.0042650657,0.001881495953,
+  0.001881495953,0.0042650657,0.006384410805,0.008102935146,
+  0.009312392794,0.009936742256,0.009936742256,0.009312392794,
+  0.008102935146,0.006384410805,0.0042650657,0.001881495953,
+  0.001763277029,0.003997081344,0.00598326289,0.007593808205,
+  0.008727272714,0.009312392794,0.009312392794,0.008727272714,
+  0.007593808205,0.00598326289,0.003997081344,0.001763277029,
+  0.001534269411,0.00347795584,0.005206179789,0.006607553693,
+  0.007593808205,0.008102935146,0.008102935146,0.007593808205,
+  0.006607553693,0.005206179789,0.00347795584,0.001534269411,
+  0.001208871357,0.00274032785,0.004102018578,0.005206179789,
+  0.00598326289,0.006384410805,0.006384410805,0.00598326289,
+  0.005206179789,0.004102018578,0.00274032785,0.001208871357,
+  0.000807578948,0.001830658878,0.00274032785,0.00347795584,
+  0.003997081344,0.0042650657,0.0042650657,0.003997081344,
+  0.00347795584,0.00274032785,0.001830658878,0.000807578948,
+  0.000356256299,0.000807578948,0.001208871357,0.001534269411,
+  0.001763277029,0.001881495953,0.001881495953,0.001763277029,
+  0.001534269411,0.001208871357,0.000807578948,0.000356256299,
+  0.00045215162,0.001024959082,0.001534269411,0.001947256515,
+  0.002237907278,0.002387947792,0.002387947792,0.002237907278,
+  0.001947256515,0.001534269411,0.001024959082,0.00045215162,
+  0.001024959082,0.002323426642,0.00347795584,0.00441413491,
+  0.005072996067,0.005413115136,0.005413115136,0.005072996067,
+  0.00441413491,0.00347795584,0.002323426642,0.001024959082,
+  0.001534269411,0.00347795584,0.005206179789,0.006607553693,
+  0.007593808205,0.008102935146,0.008102935146,0.007593808205,
+  0.006607553693,0.005206179789,0.00347795584,0.001534269411,
+  0.001947256515,0.00441413491,0.006607553693,0.008386142539,
+  0.009637872197,0.010284043428,0.010284043428,0.009637872197,
+  0.008386142539,0.006607553693,0.00441413491,0.001947256515,
+  0.002237907278,0.005072996067,0.007593808205,0.009637872197,
+  0.011076437116,0.011819056945,0.011819056945,0.011076437116,
+  0.009637872197,0.007593808205,0.005072996067,0.002237907278,
+  0.002387947792,0.005413115136,0.008102935146,0.010284043428,
+  0.011819056945,0.012611465727,0.012611465727,0.011819056945,
+  0.010284043428,0.008102935146,0.005413115136,0.002387947792,
+  0.002387947792,0.005413115136,0.008102935146,0.010284043428,
+  0.011819056945,0.012611465727,0.012611465727,0.011819056945,
+  0.010284043428,0.008102935146,0.005413115136,0.002387947792,
+  0.002237907278,0.005072996067,0.007593808205,0.009637872197,
+  0.011076437116,0.011819056945,0.011819056945,0.011076437116,
+  0.009637872197,0.007593808205,0.005072996067,0.002237907278,
+  0.001947256515,0.00441413491,0.006607553693,0.008386142539,
+  0.009637872197,0.010284043428,0.010284043428,0.009637872197,
+  0.008386142539,0.006607553693,0.00441413491,0.001947256515,
+  0.001534269411,0.00347795584,0.005206179789,0.006607553693,
+  0.007593808205,0.008102935146,0.008102935146,0.007593808205,
+  0.006607553693,0.005206179789,0.00347795584,0.001534269411,
+  0.001024959082,0.002323426642,0.00347795584,0.00441413491,
+  0.005072996067,0.005413115136,0.005413115136,0.005072996067,
+  0.00441413491,0.00347795584,0.002323426642,0.001024959082,
+  0.00045215162,0.001024959082,0.001534269411,0.001947256515,
+  0.002237907278,0.002387947792,0.002387947792,0.002237907278,
+  0.001947256515,0.001534269411,0.001024959082,0.00045215162,
+  0.000519640527,0.001177946189,0.001763277029,0.002237907278,
+  0.00257194106,0.002744376872,0.002744376872,0.00257194106,
+  0.002237907278,0.001763277029,0.001177946189,0.000519640527,
+  0.001177946189,0.002670225188,0.003997081344,0.005072996067,
+  0.005830199942,0.006221085752,0.006221085752,0.005830199942,
+  0.005072996067,0.003997081344,0.002670225188,0.001177946189,
+  0.001763277029,0.003997081344,0.00598326289,0.007593808205,
+  0.008727272714,0.009312392794,0.009312392794,0.008727272714,
+  0.007593808205,0.00598326289,0.003997081344,0.001763277029,
+  0.002237907278,0.005072996067,0.007593808205,0.009637872197,
+  0.011076437116,0.011819056945,0.011819056945,0.011076437116,
+  0.009637872197,0.007593808205,0.005072996067,0.002237907278,
+  0.00257194106,0.005830199942,0.008727272714,0.011076437116,
+  0.01272972464,0.013583189146,0.013583189146,0.01272972464,
+  0.011076437116,0.008727272714,0.005830199942,0.00257194106,
+  0.002744376872,0.006221085752,0.009312392794,0.011819056945,
+  0.013583189146,0.014493874188,0.014493874188,0.013583189146,
+  0.011819056945,0.009312392794,0.006221085752,0.002744376872,
+  0.002744376872,0.006221085752,0.009312392794,0.011819056945,
+  0.013583189146,0.014493874188,0.014493874188,0.013583189146,
+  0.011819056945,0.009312392794,0.006221085752,0.002744376872,
+  0.00257194106,0.005830199942,0.008727272714,0.011076437116,
+  0.01272972464,0.013583189146,0.013583189146,0.01272972464,
+  0.011076437116,0.008727272714,0.005830199942,0.00257194106,
+  0.002237907278,0.005072996067,0.007593808205,0.009637872197,
+  0.011076437116,0.011819056945,0.011819056945,0.011076437116,
+  0.009637872197,0.007593808205,0.005072996067,0.002237907278,
+  0.001763277029,0.003997081344,0.00598326289,0.007593808205,
+  0.008727272714,0.009312392794,0.009312392794,0.008727272714,
+  0.007593808205,0.00598326289,0.003997081344,0.001763277029,
+  0.001177946189,0.002670225188,0.003997081344,0.005072996067,
+  0.005830199942,0.006221085752,0.006221085752,0.005830199942,
+  0.005072996067,0.003997081344,0.002670225188,0.001177946189,
+  0.000519640527,0.001177946189,0.001763277029,0.002237907278,
+  0.00257194106,0.002744376872,0.002744376872,0.00257194106,
+  0.002237907278,0.001763277029,0.001177946189,0.000519640527,
+  0.000554479831,0.001256921602,0.001881495953,0.002387947792,
+  0.002744376872,0.002928373645,0.002928373645,0.002744376872,
+  0.002387947792,0.001881495953,0.001256921602,0.000554479831,
+  0.001256921602,0.00284925046,0.0042650657,0.005413115136,
+  0.006221085752,0.006638178503,0.006638178503,0.006221085752,
+  0.005413115136,0.0042650657,0.00284925046,0.001256921602,
+  0.001881495953,0.0042650657,0.006384410805,0.008102935146,
+  0.009312392794,0.009936742256,0.009936742256,0.009312392794,
+  0.008102935146,0.006384410805,0.0042650657,0.001881495953,
+  0.002387947792,0.005413115136,0.008102935146,0.010284043428,
+  0.011819056945,0.012611465727,0.012611465727,0.011819056945,
+  0.010284043428,0.008102935146,0.005413115136,0.002387947792,
+  0.002744376872,0.006221085752,0.009312392794,0.011819056945,
+  0.013583189146,0.014493874188,0.014493874188,0.013583189146,
+  0.011819056945,0.009312392794,0.006221085752,0.002744376872,
+  0.002928373645,0.006638178503,0.009936742256,0.012611465727,
+  0.014493874188,0.015465616118,0.015465616118,0.014493874188,
+  0.012611465727,0.009936742256,0.006638178503,0.002928373645,
+  0.002928373645,0.006638178503,0.009936742256,0.012611465727,
+  0.014493874188,0.015465616118,0.015465616118,0.014493874188,
+  0.012611465727,0.009936742256,0.006638178503,0.002928373645,
+  0.002744376872,0.006221085752,0.009312392794,0.011819056945,
+  0.013583189146,0.014493874188,0.014493874188,0.013583189146,
+  0.011819056945,0.009312392794,0.006221085752,0.002744376872,
+  0.002387947792,0.005413115136,0.008102935146,0.010284043428,
+  0.011819056945,0.012611465727,0.012611465727,0.011819056945,
+  0.010284043428,0.008102935146,0.005413115136,0.002387947792,
+  0.001881495953,0.0042650657,0.006384410805,0.008102935146,
+  0.009312392794,0.009936742256,0.009936742256,0.009312392794,
+  0.008102935146,0.006384410805,0.0042650657,0.001881495953,
+  0.001256921602,0.00284925046,0.0042650657,0.005413115136,
+  0.006221085752,0.006638178503,0.006638178503,0.006221085752,
+  0.005413115136,0.0042650657,0.00284925046,0.001256921602,
+  0.000554479831,0.001256921602,0.001881495953,0.002387947792,
+  0.002744376872,0.002928373645,0.002928373645,0.002744376872,
+  0.002387947792,0.001881495953,0.001256921602,0.000554479831,
+  0.000554479831,0.001256921602,0.001881495953,0.002387947792,
+  0.002744376872,0.002928373645,0.002928373645,0.002744376872,
+  0.002387947792,0.001881495953,0.001256921602,0.000554479831,
+  0.001256921602,0.00284925046,0.0042650657,0.005413115136,
+  0.006221085752,0.006638178503,0.006638178503,0.006221085752,
+  0.005413115136,0.0042650657,0.00284925046,0.001256921602,
+  0.001881495953,0.0042650657,0.006384410805,0.008102935146,
+  0.009312392794,0.009936742256,0.009936742256,0.009312392794,
+  0.008102935146,0.006384410805,0.0042650657,0.001881495953,
+  0.002387947792,0.005413115136,0.008102935146,0.010284043428,
+  0.011819056945,0.012611465727,0.012611465727,0.011819056945,
+  0.010284043428,0.008102935146,0.005413115136,0.002387947792,
+  0.002744376872,0.006221085752,0.009312392794,0.011819056945,
+  0.013583189146,0.014493874188,0.014493874188,0.013583189146,
+  0.011819056945,0.009312392794,0.006221085752,0.002744376872,
+  0.002928373645,0.006638178503,0.009936742256,0.012611465727,
+  0.014493874188,0.015465616118,0.015465616118,0.014493874188,
+  0.012611465727,0.009936742256,0.006638178503,0.002928373645,
+  0.002928373645,0.006638178503,0.009936742256,0.012611465727,
+  0.014493874188,0.015465616118,0.015465616118,0.014493874188,
+  0.012611465727,0.009936742256,0.006638178503,0.002928373645,
+  0.002744376872,0.006221085752,0.009312392794,0.011819056945,
+  0.013583189146,0.014493874188,0.014493874188,0.013583189146,
+  0.011819056945,0.009312392794,0.006221085752,0.002744376872,
+  0.002387947792,0.005413115136,0.008102935146,0.010284043428,
+  0.011819056945,0.012611465727,0.012611465727,0.011819056945,
+  0.010284043428,0.008102935146,0.005413115136,0.002387947792,
+  0.001881495953,0.0042650657,0.006384410805,0.008102935146,
+  0.009312392794,0.009936742256,0.009936742256,0.009312392794,
+  0.008102935146,0.006384410805,0.0042650657,0.001881495953,
+  0.001256921602,0.00284925046,0.0042650657,0.005413115136,
+  0.006221085752,0.006638178503,0.006638178503,0.006221085752,
+  0.005413115136,0.0042650657,0.00284925046,0.001256921602,
+  0.000554479831,0.001256921602,0.001881495953,0.002387947792,
+  0.002744376872,0.002928373645,0.002928373645,0.002744376872,
+  0.002387947792,0.001881495953,0.001256921602,0.000554479831,
+  0.000519640527,0.001177946189,0.001763277029,0.002237907278,
+  0.00257194106,0.002744376872,0.002744376872,0.00257194106,
+  0.002237907278,0.001763277029,0.001177946189,0.000519640527,
+  0.001177946189,0.002670225188,0.003997081344,0.005072996067,
+  0.005830199942,0.006221085752,0.006221085752,0.005830199942,
+  0.005072996067,0.003997081344,0.002670225188,0.001177946189,
+  0.001763277029,0.003997081344,0.00598326289,0.007593808205,
+  0.008727272714,0.009312392794,0.009312392794,0.008727272714,
+  0.007593808205,0.00598326289,0.003997081344,0.001763277029,
+  0.002237907278,0.005072996067,0.007593808205,0.009637872197,
+  0.011076437116,0.011819056945,0.011819056945,0.011076437116,
+  0.009637872197,0.007593808205,0.005072996067,0.002237907278,
+  0.00257194106,0.005830199942,0.008727272714,0.011076437116,
+  0.01272972464,0.013583189146,0.013583189146,0.01272972464,
+  0.011076437116,0.008727272714,0.005830199942,0.00257194106,
+  0.002744376872,0.006221085752,0.009312392794,0.011819056945,
+  0.013583189146,0.014493874188,0.014493874188,0.013583189146,
+  0.011819056945,0.009312392794,0.006221085752,0.002744376872,
+  0.002744376872,0.006221085752,0.009312392794,0.011819056945,
+  0.013583189146,0.014493874188,0.014493874188,0.013583189146,
+  0.011819056945,0.009312392794,0.006221085752,0.002744376872,
+  0.00257194106,0.005830199942,0.008727272714,0.011076437116,
+  0.01272972464,0.013583189146,0.013583189146,0.01272972464,
+  0.011076437116,0.008727272714,0.005830199942,0.00257194106,
+  0.002237907278,0.005072996067,0.007593808205,0.009637872197,
+  0.011076437116,0.011819056945,0.011819056945,0.011076437116,
+  0.009637872197,0.007593808205,0.005072996067,0.002237907278,
+  0.001763277029,0.003997081344,0.00598326289,0.007593808205,
+  0.008727272714,0.009312392794,0.009312392794,0.008727272714,
+  0.007593808205,0.00598326289,0.003997081344,0.001763277029,
+  0.001177946189,0.002670225188,0.003997081344,0.005072996067,
+  0.005830199942,0.006221085752,0.006221085752,0.005830199942,
+  0.005072996067,0.003997081344,0.002670225188,0.001177946189,
+  0.000519640527,0.001177946189,0.001763277029,0.002237907278,
+  0.00257194106,0.002744376872,0.002744376872,0.00257194106,
+  0.002237907278,0.001763277029,0.001177946189,0.000519640527,
+  0.00045215162,0.001024959082,0.001534269411,0.001947256515,
+  0.002237907278,0.002387947792,0.002387947792,0.002237907278,
+  0.001947256515,0.001534269411,0.001024959082,0.00045215162,
+  0.001024959082,0.002323426642,0.00347795584,0.00441413491,
+  0.005072996067,0.005413115136,0.005413115136,0.005072996067,
+  0.00441413491,0.00347795584,0.002323426642,0.001024959082,
+  0.001534269411,0.00347795584,0.005206179789,0.006607553693,
+  0.007593808205,0.008102935146,0.008102935146,0.007593808205,
+  0.006607553693,0.005206179789,0.00347795584,0.001534269411,
+  0.001947256515,0.00441413491,0.006607553693,0.008386142539,
+  0.009637872197,0.010284043428,0.010284043428,0.009637872197,
+  0.008386142539,0.006607553693,0.00441413491,0.001947256515,
+  0.002237907278,0.005072996067,0.007593808205,0.009637872197,
+  0.011076437116,0.011819056945,0.011819056945,0.011076437116,
+  0.009637872197,0.007593808205,0.005072996067,0.002237907278,
+  0.002387947792,0.005413115136,0.008102935146,0.010284043428,
+  0.011819056945,0.012611465727,0.012611465727,0.011819056945,
+  0.010284043428,0.008102935146,0.005413115136,0.002387947792,
+  0.002387947792,0.005413115136,0.008102935146,0.010284043428,
+  0.011819056945,0.012611465727,0.012611465727,0.011819056945,
+  0.010284043428,0.008102935146,0.005413115136,0.002387947792,
+  0.002237907278,0.005072996067,0.007593808205,0.009637872197,
+  0.011076437116,0.011819056945,0.011819056945,0.011076437116,
+  0.009637872197,0.007593808205,0.005072996067,0.002237907278,
+  0.001947256515,0.00441413491,0.006607553693,0.008386142539,
+  0.009637872197,0.010284043428,0.010284043428,0.009637872197,
+  0.008386142539,0.006607553693,0.00441413491,0.001947256515,
+  0.001534269411,0.00347795584,0.005206179789,0.006607553693,
+  0.007593808205,0.008102935146,0.008102935146,0.007593808205,
+  0.006607553693,0.005206179789,0.00347795584,0.001534269411,
+  0.001024959082,0.002323426642,0.00347795584,0.00441413491,
+  0.005072996067,0.005413115136,0.005413115136,0.005072996067,
+  0.00441413491,0.00347795584,0.002323426642,0.001024959082,
+  0.00045215162,0.001024959082,0.001534269411,0.001947256515,
+  0.002237907278,0.002387947792,0.002387947792,0.002237907278,
+  0.001947256515,0.001534269411,0.001024959082,0.00045215162,
+  0.000356256299,0.000807578948,0.001208871357,0.001534269411,
+  0.001763277029,0.001881495953,0.001881495953,0.001763277029,
+  0.001534269411,0.001208871357,0.000807578948,0.000356256299,
+  0.000807578948,0.001830658878,0.00274032785,0.00347795584,
+  0.003997081344,0.0042650657,0.0042650657,0.003997081344,
+  0.00347795584,0.00274032785,0.001830658878,0.000807578948,
+  0.001208871357,0.00274032785,0.004102018578,0.005206179789,
+  0.00598326289,0.006384410805,0.006384410805,0.00598326289,
+  0.005206179789,0.004102018578,0.00274032785,0.001208871357,
+  0.001534269411,0.00347795584,0.005206179789,0.006607553693,
+  0.007593808205,0.008102935146,0.008102935146,0.007593808205,
+  0.006607553693,0.005206179789,0.00347795584,0.001534269411,
+  0.001763277029,0.003997081344,0.00598326289,0.007593808205,
+  0.008727272714,0.009312392794,0.009312392794,0.008727272714,
+  0.007593808205,0.00598326289,0.003997081344,0.001763277029,
+  0.001881495953,0.0042650657,0.006384410805,0.008102935146,
+  0.009312392794,0.009936742256,0.009936742256,0.009312392794,
+  0.008102935146,0.006384410805,0.0042650657,0.001881495953,
+  0.001881495953,0.0042650657,0.006384410805,0.008102935146,
+  0.009312392794,0.009936742256,0.009936742256,0.009312392794,
+  0.008102935146,0.006384410805,0.0042650657,0.001881495953,
+  0.001763277029,0.003997081344,0.00598326289,0.007593808205,
+  0.008727272714,0.009312392794,0.009312392794,0.008727272714,
+  0.007593808205,0.00598326289,0.003997081344,0.001763277029,
+  0.001534269411,0.00347795584,0.005206179789,0.006607553693,
+  0.007593808205,0.008102935146,0.008102935146,0.007593808205,
+  0.006607553693,0.005206179789,0.00347795584,0.001534269411,
+  0.001208871357,0.00274032785,0.004102018578,0.005206179789,
+  0.00598326289,0.006384410805,0.006384410805,0.00598326289,
+  0.005206179789,0.004102018578,0.00274032785,0.001208871357,
+  0.000807578948,0.001830658878,0.00274032785,0.00347795584,
+  0.003997081344,0.0042650657,0.0042650657,0.003997081344,
+  0.00347795584,0.00274032785,0.001830658878,0.000807578948,
+  0.000356256299,0.000807578948,0.001208871357,0.001534269411,
+  0.001763277029,0.001881495953,0.001881495953,0.001763277029,
+  0.001534269411,0.001208871357,0.000807578948,0.000356256299,
+  0.000237994792,0.000539498064,0.000807578948,0.001024959082,
+  0.001177946189,0.001256921602,0.001256921602,0.001177946189,
+  0.001024959082,0.000807578948,0.000539498064,0.000237994792,
+  0.000539498064,0.001222960211,0.001830658878,0.002323426642,
+  0.002670225188,0.00284925046,0.00284925046,0.002670225188,
+  0.002323426642,0.001830658878,0.001222960211,0.000539498064,
+  0.000807578948,0.001830658878,0.00274032785,0.00347795584,
+  0.003997081344,0.0042650657,0.0042650657,0.003997081344,
+  0.00347795584,0.00274032785,0.001830658878,0.000807578948,
+  0.001024959082,0.002323426642,0.00347795584,0.00441413491,
+  0.005072996067,0.005413115136,0.005413115136,0.005072996067,
+  0.00441413491,0.00347795584,0.002323426642,0.001024959082,
+  0.001177946189,0.002670225188,0.003997081344,0.005072996067,
+  0.005830199942,0.006221085752,0.006221085752,0.005830199942,
+  0.005072996067,0.003997081344,0.002670225188,0.001177946189,
+  0.001256921602,0.00284925046,0.0042650657,0.005413115136,
+  0.006221085752,0.006638178503,0.006638178503,0.006221085752,
+  0.005413115136,0.0042650657,0.00284925046,0.001256921602,
+  0.001256921602,0.00284925046,0.0042650657,0.005413115136,
+  0.006221085752,0.006638178503,0.006638178503,0.006221085752,
+  0.005413115136,0.0042650657,0.00284925046,0.001256921602,
+  0.001177946189,0.002670225188,0.003997081344,0.005072996067,
+  0.005830199942,0.006221085752,0.006221085752,0.005830199942,
+  0.005072996067,0.003997081344,0.002670225188,0.001177946189,
+  0.001024959082,0.002323426642,0.00347795584,0.00441413491,
+  0.005072996067,0.005413115136,0.005413115136,0.005072996067,
+  0.00441413491,0.00347795584,0.002323426642,0.001024959082,
+  0.000807578948,0.001830658878,0.00274032785,0.00347795584,
+  0.003997081344,0.0042650657,0.0042650657,0.003997081344,
+  0.00347795584,0.00274032785,0.001830658878,0.000807578948,
+  0.000539498064,0.001222960211,0.001830658878,0.002323426642,
+  0.002670225188,0.00284925046,0.00284925046,0.002670225188,
+  0.002323426642,0.001830658878,0.001222960211,0.000539498064,
+  0.000237994792,0.000539498064,0.000807578948,0.001024959082,
+  0.001177946189,0.001256921602,0.001256921602,0.001177946189,
+  0.001024959082,0.000807578948,0.000539498064,0.000237994792,
+  0.000104989294,0.000237994792,0.000356256299,0.00045215162,
+  0.000519640527,0.000554479831,0.000554479831,0.000519640527,
+  0.00045215162,0.000356256299,0.000237994792,0.000104989294,
+  0.000237994792,0.000539498064,0.000807578948,0.001024959082,
+  0.001177946189,0.001256921602,0.001256921602,0.001177946189,
+  0.001024959082,0.000807578948,0.000539498064,0.000237994792,
+  0.000356256299,0.000807578948,0.001208871357,0.001534269411,
+  0.001763277029,0.001881495953,0.001881495953,0.001763277029,
+  0.001534269411,0.001208871357,0.000807578948,0.000356256299,
+  0.00045215162,0.001024959082,0.001534269411,0.001947256515,
+  0.002237907278,0.002387947792,0.002387947792,0.002237907278,
+  0.001947256515,0.001534269411,0.001024959082,0.00045215162,
+  0.000519640527,0.001177946189,0.001763277029,0.002237907278,
+  0.00257194106,0.002744376872,0.002744376872,0.00257194106,
+  0.002237907278,0.001763277029,0.001177946189,0.000519640527,
+  0.000554479831,0.001256921602,0.001881495953,0.002387947792,
+  0.002744376872,0.002928373645,0.002928373645,0.002744376872,
+  0.002387947792,0.001881495953,0.001256921602,0.000554479831,
+  0.000554479831,0.001256921602,0.001881495953,0.002387947792,
+  0.002744376872,0.002928373645,0.002928373645,0.002744376872,
+  0.002387947792,0.001881495953,0.001256921602,0.000554479831,
+  0.000519640527,0.001177946189,0.001763277029,0.002237907278,
+  0.00257194106,0.002744376872,0.002744376872,0.00257194106,
+  0.002237907278,0.001763277029,0.001177946189,0.000519640527,
+  0.00045215162,0.001024959082,0.001534269411,0.001947256515,
+  0.002237907278,0.002387947792,0.002387947792,0.002237907278,
+  0.001947256515,0.001534269411,0.001024959082,0.00045215162,
+  0.000356256299,0.000807578948,0.001208871357,0.001534269411,
+  0.001763277029,0.001881495953,0.001881495953,0.001763277029,
+  0.001534269411,0.001208871357,0.000807578948,0.000356256299,
+  0.000237994792,0.000539498064,0.000807578948,0.001024959082,
+  0.001177946189,0.001256921602,0.001256921602,0.001177946189,
+  0.001024959082,0.000807578948,0.000539498064,0.000237994792,
+  0.000104989294,0.000237994792,0.000356256299,0.00045215162,
+  0.000519640527,0.000554479831,0.000554479831,0.000519640527,
+  0.00045215162,0.000356256299,0.000237994792,0.000104989294
+};
+
+static const cubature_table cubature_hexa_tables[]={
+  {1,1,cubature_hexa_1_locs,cubature_hexa_1_weights},
+  {2,8,cubature_hexa_2_locs,cubature_hexa_2_weights},
+  {3,27,cubature_hexa_3_locs,cubature_hexa_3_weights},
+  {4,64,cubature_hexa_4_locs,cubature_hexa_4_weights},
+  {5,125,cubature_hexa_5_locs,cubature_hexa_5_weights},
+  {6,216,cubature_hexa_6_locs,cubature_hexa_6_weights},
+  {7,343,cubature_hexa_7_locs,cubature_hexa_7_weights},
+  {8,512,cubature_hexa_8_locs,cubature_hexa_8_weights},
+  {9,729,cubature_hexa_9_locs,cubature_hexa_9_weights},
+  {10,1000,cubature_hexa_10_locs,cubature_hexa_10_weights},
+  {11,1331,cubature_hexa_11_locs,cubature_hexa_11_weights},
+  {12,1728,cubature_hexa_12_locs,cubature_hexa_12_weights}
+};
+
+// look up rule in_key of shape in_shape
+
+const cubature_table* get_cubature_table(int in_shape, int in_key)
+{
+  const cubature_table* tables[5]={cubature_1d_tables,cubature_tri_tables,cubature_quad_tables,cubature_tet_tables,cubature_hexa_tables};
+  const int n_tables[5]={(int)(sizeof(cubature_1d_tables)/sizeof(cubature_table)),(int)(sizeof(cubature_tri_tables)/sizeof(cubature_table)),(int)(sizeof(cubature_quad_tables)/sizeof(cubature_table)),(int)(sizeof(cubature_tet_tables)/sizeof(cubature_table)),(int)(sizeof(cubature_hexa_tables)/sizeof(cubature_table))};
+
+  if(in_shape<0 || in_shape>4)
+    return NULL;
+
+  for(int i=0;i<n_tables[in_shape];i++)
+    if(tables[in_shape][i].key==in_key)
+      return &tables[in_shape][i];
+
+  return NULL;
+}
@@ -30,6 +30,7 @@
 
 #include "../include/global.h"
 #include "../include/cubature_tet.h"
+#include "../include/cubature_tables.h"
 
 using namespace std;
 
@@ -48,14 +49,8 @@ cubature_tet::cubature_tet()
 // constructor 1
 
 cubature_tet::cubature_tet(int in_rule) // set by rule
-{	
-  ifstream datfile;
-  char buf[BUFSIZ]={""};
-  char section_TXT[100], param_TXT[100];
-  char* f;
-  string filename, param_name, param, ord;
-  istringstream strbuf;
-  int rule_file;
+{
+  const cubature_table* table;
 
   rule=in_rule;
 
@@ -63,118 +58,25 @@ cubature_tet::cubature_tet(int in_rule) // set by rule
   //"A Set of Symmetric Quadrature rules on Triangles and Tetrahedra,"
   //Journal of Computational Mathematics, 2009
 
-  if (rule==2)
-    n_pts=4;
-  else if (rule==3)
-    n_pts=8;
-  else if (rule==4)
-    n_pts=14;
-  else if (rule==5)
-    n_pts=14;
-  else if (rule==6)
-    n_pts=24;
-  else if (rule==7)
-    n_pts=35;
-  else if (rule==8)
-    n_pts=46;
-  else if (rule==9)
-    n_pts=61;
-  else if (rule==10)
-    n_pts=81;
-  else if (rule==11)
-    n_pts=109;
-  else if (rule==12)
-    n_pts=140;
-  else if (rule==13)
-    n_pts=171;
-  else if (rule==14)
-    n_pts=236;
-  else {
+  table=get_cubature_table(CUBATURE_TET,rule);
+  if (table==NULL) {
     rule=0;
     n_pts=0;
     locs.setup(0,0);
     weights.setup(0);
-    
+
     FatalError("ERROR: Cubature rule currently not implemented ....");
   }
 
+  n_pts=table->n_pts;
   locs.setup(n_pts,3);
   weights.setup(n_pts);
 
-  if(rule < 15) {
-    
-    if (HIFILES_DIR == NULL)
-      FatalError("environment variable HIFILES_HOME is undefined");
-    
-    filename = HIFILES_DIR;
-    filename += "/data/cubature_tet.dat";
-    f = (char*)filename.c_str();
-    datfile.open(f, ifstream::in);
-    if (!datfile) FatalError("Unable to open cubature file");
-
-    // read data from file to arrays
-    while(datfile.getline(buf,BUFSIZ))
-    {
-      sscanf(buf,"%s",section_TXT);
-      param_name.assign(section_TXT,0,99);
-      
-      if(!param_name.compare(0,4,"rule"))
-      {
-        // get no. of pts
-        ord = param_name.substr(5);
-        stringstream str(ord);
-        str >> rule_file;
-        
-        // if pts matches order, read locs and weights
-        if (rule_file == rule) {
-          
-          // skip next line
-          datfile.getline(buf,BUFSIZ);
-          
-          for(int i=0;i<n_pts;++i) {
-            datfile.getline(buf,BUFSIZ);
-            sscanf(buf,"%s",param_TXT);
-            param.assign(param_TXT,0,99);
-            strbuf.str(param);
-            locs(i,0) = atof(param.c_str());
-          }
-          
-          // skip next line
-          datfile.getline(buf,BUFSIZ);
-          
-          for(int i=0;i<n_pts;++i) {
-            datfile.getline(buf,BUFSIZ);
-            sscanf(buf,"%s",param_TXT);
-            param.assign(param_TXT,0,99);
-            strbuf.str(param);
-            locs(i,1) = atof(param.c_str());
-          }
-
-          // skip next line
-          datfile.getline(buf,BUFSIZ);
-          
-          for(int i=0;i<n_pts;++i) {
-            datfile.getline(buf,BUFSIZ);
-            sscanf(buf,"%s",param_TXT);
-            param.assign(param_TXT,0,99);
-            strbuf.str(param);
-            locs(i,2) = atof(param.c_str());
-          }
-
-          // skip next line
-          datfile.getline(buf,BUFSIZ);
-          
-          for(int i=0;i<n_pts;++i) {
-            datfile.getline(buf,BUFSIZ);
-            sscanf(buf,"%s",param_TXT);
-            param.assign(param_TXT,0,99);
-            strbuf.str(param);
-            weights(i) = atof(param.c_str());
-          }
-          break;
-        }
-      }
-    }
+  for(int i=0;i<n_pts;++i) {
+    locs(i,0) = table->locs[i];
+    locs(i,1) = table->locs[n_pts+i];
+    locs(i,2) = table->locs[2*n_pts+i];
+    weights(i) = table->weights[i];
   }
 }
 
@@ -26,6 +26,7 @@
 #include <iostream>
 #include <iomanip>
 #include <cmath>
+#include <sstream>
 
 #if defined _ACCELERATE_BLAS
 #include <Accelerate/Accelerate.h>
@@ -65,12 +66,21 @@ extern "C"
 
 using namespace std;
 
+// number of element/field columns rounded to single precision together by apply_opp_single
+
+#define OPP_SP_CHUNK 32
+
 // #### constructors ####
 
 // default constructor
 
 eles::eles()
 {
+  basis_memo_order=-1;
+  d_basis_memo_order=-1;
+  n_dual_levels=0;
+  dual_time_res=0.;
+  mg_forcing=0;
 }
 
 // default destructor
@@ -139,6 +149,8 @@ void eles::setup(int in_n_eles, int in_max_n_spts_per_ele)
     // Initialize the element specific static members
     (*this).setup_ele_type_specific();
 
+    cached_opps.write(rank);
+
     if(run_input.adv_type==0)
     {
       n_adv_levels=1;
@@ -151,20 +163,50 @@ void eles::setup(int in_n_eles, int in_max_n_spts_per_ele)
     {
       n_adv_levels=4;
     }
-    else if(run_input.adv_type==3)
+    else if(run_input.adv_type==3 || run_input.adv_type==5)
     {
       n_adv_levels=2;
     }
+    else if(run_input.adv_type==4)
+    {
+      // the implicit solver keeps its own copies of the solution
+      n_adv_levels=1;
+    }
     else
     {
       cout << "ERROR: Type of time integration scheme not recongized ... " << endl;
     }
 
+    // Leading dimension of the solution point arrays, padded to a whole number of 64-byte cache lines if requested
+    if (run_input.pad_upts)
+      n_upts_ld = ((n_upts_per_ele+7)/8)*8;
+    else
+      n_upts_ld = n_upts_per_ele;
+
+    // Elements per block of the solution point arrays, 1 for the structure of arrays layout
+    if (run_input.upts_layout==1)
+      upts_width = run_input.aosoa_width;
+    else
+      upts_width = 1;
+
     // Allocate storage for solution
     disu_upts.setup(n_adv_levels);
     for(int i=0;i<n_adv_levels;i++)
     {
-      disu_upts(i).setup(n_upts_per_ele,n_eles,n_fields);
+      disu_upts(i).setup_layout(n_upts_per_ele,n_upts_ld,n_eles,n_fields,1,upts_width);
+      if (n_upts_ld!=n_upts_per_ele)
+        disu_upts(i).initialize_to_zero();
+    }
+
+    // Dual time stepping keeps the solution at the last two physical time levels
+    if(run_input.adv_type==5)
+    {
+      disu_upts_dual.setup(2);
+      for(int i=0;i<2;i++)
+      {
+        disu_upts_dual(i).setup_layout(n_upts_per_ele,n_upts_ld,n_eles,n_fields,1,upts_width);
+        disu_upts_dual(i).initialize_to_zero();
+      }
     }
 
     // Allocate storage for timestep
@@ -273,20 +315,36 @@ void eles::setup(int in_n_eles, int in_max_n_spts_per_ele)
       twall.setup(1);
     }
     
-    // Allocate SGS flux array if using LES or wall model
-    if(LES != 0 || wall_model != 0) {
-      temp_sgsf.setup(n_fields,n_dims);
-      if(motion)
-        temp_sgsf_ref.setup(n_fields,n_dims);
-    }
-
     // Initialize source term
     src_upts.setup(n_upts_per_ele, n_eles, n_fields);
     zero_array(src_upts);
 
+    // Allocate per-thread scratch for the pointwise kernels
+    setup_thread_scratch();
+
+    // Size the blocks of the blocked residual so that the arrays one block streams fit in 256 kB
+    if (run_input.ele_block_size>0) {
+      ele_block_size = run_input.ele_block_size;
+    }
+    else {
+      int n_doubles = n_fields*(n_upts_per_ele*(2+n_dims) + 2*n_fpts_per_ele) + n_upts_per_ele*(n_dims*n_dims+1);
+      if (viscous)
+        n_doubles += n_fields*(n_dims*(n_upts_per_ele+n_fpts_per_ele) + n_fpts_per_ele);
+      ele_block_size = max(1,(256*1024)/(8*n_doubles));
+    }
+
+    // Blocks of the blocked residual hold whole AoSoA element blocks
+    ele_block_size = ((ele_block_size+upts_width-1)/upts_width)*upts_width;
+
+    // Select a specialized inviscid flux kernel for Euler and NS on static meshes in the structure of arrays layout
+    if (run_input.equation==0 && run_input.turb_model==0 && !motion && upts_width==1)
+      invFlux_fn = get_invFlux_kernel(n_dims,n_fields);
+    else
+      invFlux_fn = NULL;
+
+    aosoa_opp_fn = get_aosoa_opp_kernel(upts_width);
+
     // Allocate array for grid velocity
-    temp_v.setup(n_dims);
-    temp_v.initialize_to_zero();
     temp_v_ref.setup(n_dims);
     temp_v_ref.initialize_to_zero();
 
@@ -331,7 +389,7 @@ void eles::setup(int in_n_eles, int in_max_n_spts_per_ele)
     div_tconf_upts.setup(n_adv_levels);
     for(int i=0;i<n_adv_levels;i++)
     {
-      div_tconf_upts(i).setup(n_upts_per_ele,n_eles,n_fields);
+      div_tconf_upts(i).setup_layout(n_upts_per_ele,n_upts_ld,n_eles,n_fields,1,upts_width);
     }
     
     // Initialize to zero
@@ -339,9 +397,25 @@ void eles::setup(int in_n_eles, int in_max_n_spts_per_ele)
       div_tconf_upts(m).initialize_to_zero();
     
     disu_fpts.setup(n_fpts_per_ele,n_eles,n_fields);
-    tdisf_upts.setup(n_upts_per_ele,n_eles,n_fields,n_dims);
+    tdisf_upts.setup_layout(n_upts_per_ele,n_upts_ld,n_eles,n_fields,n_dims,upts_width);
+    if (n_upts_ld!=n_upts_per_ele || upts_width>1)
+      tdisf_upts.initialize_to_zero();
     norm_tdisf_fpts.setup(n_fpts_per_ele,n_eles,n_fields);
     norm_tconf_fpts.setup(n_fpts_per_ele,n_eles,n_fields);
+
+    // Local time stepping keeps the solution at both ends of each element's timestep and its flux difference
+    if (run_input.lts_levels>1)
+    {
+      lts_level.setup(n_eles);
+      lts_level.initialize_to_zero();
+
+      disu_upts_lts.setup(2);
+      for(int i=0;i<2;i++)
+        disu_upts_lts(i).setup_layout(n_upts_per_ele,n_upts_ld,n_eles,n_fields,1,upts_width);
+
+      lts_flux_fpts.setup(n_fpts_per_ele,n_eles,n_fields);
+      lts_flux_fpts.initialize_to_zero();
+    }
     
     if (motion && run_input.GCL) {
       tdisf_GCL_upts.setup(n_upts_per_ele,n_eles,n_dims);
@@ -373,7 +447,9 @@ void eles::setup(int in_n_eles, int in_max_n_spts_per_ele)
     if(viscous)
     {
       delta_disu_fpts.setup(n_fpts_per_ele,n_eles,n_fields);
-      grad_disu_upts.setup(n_upts_per_ele,n_eles,n_fields,n_dims);
+      grad_disu_upts.setup_layout(n_upts_per_ele,n_upts_ld,n_eles,n_fields,n_dims,upts_width);
+      if (n_upts_ld!=n_upts_per_ele || upts_width>1)
+        grad_disu_upts.initialize_to_zero();
       grad_disu_fpts.setup(n_fpts_per_ele,n_eles,n_fields,n_dims);
     }
 
@@ -659,10 +735,24 @@ void eles::read_restart_data(ifstream& restart_file)
   array<double> disu_upts_rest;
   disu_upts_rest.setup(n_upts_per_ele_rest,n_fields);
   
+  // Global elements in increasing order and their local element, as the elements may be stored in another order (reorder_eles)
+  array<int> global_ele(2,n_eles), sorted_global_ele(n_eles);
+  for (int i=0;i<n_eles;i++)
+  {
+    global_ele(0,i) = ele2global_ele(i);
+    global_ele(1,i) = i;
+  }
+  qsort(global_ele.get_ptr_cpu(),n_eles,2*sizeof(int),compare_ints);
+  for (int i=0;i<n_eles;i++)
+    sorted_global_ele(i) = global_ele(0,i);
+  
   for (int i=0;i<num_eles_to_read;i++)
   {
     restart_file >> ele ;
-    index = index_locate_int(ele,ele2global_ele.get_ptr_cpu(),n_eles);
+    index = index_locate_int(ele,sorted_global_ele.get_ptr_cpu(),n_eles);
+    
+    if (index!=-1)
+      index = global_ele(1,index);
     
     if (index!=-1) // Ele belongs to processor
     {
@@ -1001,7 +1091,16 @@ void eles::rm_detjac_upts_cpu(void)
 // advance solution
 
 void eles::AdvanceSolution(int in_step, int adv_type) {
+  AdvanceSolution(in_step,adv_type,0,n_eles);
+}
+
+// advance the solution of elements in_ele_start to in_ele_end-1. With local time stepping the timesteps are those of
+// the element levels, set by set_lts_levels, and the solution time is left to the caller
+
+void eles::AdvanceSolution(int in_step, int adv_type, int in_ele_start, int in_ele_end) {
   
+  bool lts = (run_input.lts_levels>1);
+
   if (n_eles!=0)
   {
     
@@ -1017,67 +1116,46 @@ void eles::AdvanceSolution(int in_step, int adv_type) {
        */
       
 #ifdef _CPU
-      // If using global minimum timestep based on CFL, determine
-      // global minimum
-      if (run_input.dt_type == 1)
+      set_dt_local();
+      
+#pragma omp parallel for schedule(static)
+      for (int ic=in_ele_start;ic<in_ele_end;ic++)
       {
-        // Find minimum timestep
-        dt_local(0) = 1e12; // Set to large value
-        
-        for (int ic=0; ic<n_eles; ic++)
+        // User supplied timestep
+        double dt = run_input.dt;
+
+        if (run_input.dt_type != 0)
         {
-          dt_local_new = calc_dt_local(ic);
-          
-          if (dt_local_new < dt_local(0))
-            dt_local(0) = dt_local_new;
-        }
-        
-        // If running in parallel, gather minimum timestep values from
-        // each partition and find global minumum across partitions
-#ifdef _MPI
-        MPI_Barrier(MPI_COMM_WORLD);
-        MPI_Allgather(&dt_local(0),1,MPI_DOUBLE,dt_local_mpi.get_ptr_cpu(),
-                      1, MPI_DOUBLE, MPI_COMM_WORLD);
-        MPI_Barrier(MPI_COMM_WORLD);
+          // Global minimum timestep
+          if (run_input.dt_type == 1)
+            dt = dt_local(0);
         
-        dt_local(0) = dt_local_mpi.get_min();
-#endif
-      }
-      
-      // If using local timestepping, just compute and store all local
-      // timesteps
-      if (run_input.dt_type == 2)
-      {
-        for (int ic=0; ic<n_eles; ic++)
-          dt_local(ic) = calc_dt_local(ic);
-      }
-      
-      for (int i=0;i<n_fields;i++)
-      {
-        for (int ic=0;ic<n_eles;ic++)
+          // Element local timestep
+          else if (run_input.dt_type == 2)
+            dt = dt_local(ic);
+
+          else
+            FatalError("ERROR: dt_type not recognized!")
+        }
+
+        for (int i=0;i<n_fields;i++)
         {
           for (int inp=0;inp<n_upts_per_ele;inp++)
           {
-            // User supplied timestep
-            if (run_input.dt_type != 0)
-            {
-              // Global minimum timestep
-              if (run_input.dt_type == 1)
-                run_input.dt = dt_local(0);
-            
-              // Element local timestep
-              else if (run_input.dt_type == 2)
-                run_input.dt = dt_local(ic);
+            disu_upts(0)(inp,ic,i) -= dt*(div_tconf_upts(0)(inp,ic,i)/detjac_upts(inp,ic) - run_input.const_src - src_upts(inp,ic,i));
 
-              else
-                FatalError("ERROR: dt_type not recognized!")
-            }
-              
-            disu_upts(0)(inp,ic,i) -= run_input.dt*(div_tconf_upts(0)(inp,ic,i)/detjac_upts(inp,ic) - run_input.const_src - src_upts(inp,ic,i));
+            if (mg_forcing)
+              disu_upts(0)(inp,ic,i) += dt*mg_src_upts(inp,ic,i);
           }
         }
       }
 
+      // Leave run_input.dt at the last timestep applied (used to advance the solution time)
+      if (run_input.dt_type == 1)
+        run_input.dt = dt_local(0);
+      else if (run_input.dt_type == 2)
+        run_input.dt = dt_local(n_eles-1);
+
 #endif
       
 #ifdef _GPU
@@ -1086,9 +1164,10 @@ void eles::AdvanceSolution(int in_step, int adv_type) {
       
     }
     
-    /*! Time integration using a RK45 method. */
+    /*! Time integration using a RK45 method, in physical time (adv_type 3) or in the pseudo time of dual time
+     stepping (adv_type 5). */
     
-    else if (adv_type == 3) {
+    else if (adv_type == 3 || adv_type == 5) {
       
       double rk4a, rk4b;
       if (in_step==0) {
@@ -1114,68 +1193,85 @@ void eles::AdvanceSolution(int in_step, int adv_type) {
       
 #ifdef _CPU
       // for first stage only, compute timestep
-      if (in_step == 0)
+      if (in_step == 0 && !lts)
+        set_dt_local();
+
+      // Dual time stepping adds the BDF2 physical time derivative of the solution at the end of the physical
+      // timestep run_input.dt to the right-hand side (BDF1 until two earlier time levels are known)
+      double bdf0=0., bdf1=0., bdf2=0.;
+      if (adv_type == 5)
       {
-        // For global timestepping, find minimum timestep
-        if (run_input.dt_type == 1)
+        if (n_dual_levels == 2)
         {
-          dt_local(0) = 1e12;
-          
-          for (int ic=0; ic<n_eles; ic++)
-          {
-            dt_local_new = calc_dt_local(ic);
-            
-            if (dt_local_new < dt_local(0))
-            {
-              dt_local(0) = dt_local_new;
-            }
-          }
-          
-          
-          // If using MPI, find minimum across partitions
-#ifdef _MPI
-          MPI_Barrier(MPI_COMM_WORLD);
-          MPI_Allgather(&dt_local(0),1,MPI_DOUBLE,dt_local_mpi.get_ptr_cpu(),1,MPI_DOUBLE,MPI_COMM_WORLD);
-          MPI_Barrier(MPI_COMM_WORLD);
-          
-          dt_local(0) = dt_local_mpi.get_min();
-#endif
+          bdf0 = 1.5/run_input.dt;
+          bdf1 = -2.0/run_input.dt;
+          bdf2 = 0.5/run_input.dt;
         }
-        
-        // For local timestepping, find element local timesteps
-        if (run_input.dt_type == 2)
+        else
         {
-          for (int ic=0; ic<n_eles; ic++)
-          {
-            dt_local(ic) = calc_dt_local(ic);
-          }
+          bdf0 = 1.0/run_input.dt;
+          bdf1 = -1.0/run_input.dt;
         }
       }
-      
-      double res, rhs;
-      for (int ic=0;ic<n_eles;ic++)
+
+      double res_sum = 0.;
+
+#pragma omp parallel for reduction(+:res_sum) schedule(static)
+      for (int ic=in_ele_start;ic<in_ele_end;ic++)
       {
+        double res, rhs;
+        double dt = run_input.dt;
+
+        if (lts)
+          dt = dt_local(0)*(1<<lts_level(ic));
+        else if (run_input.dt_type != 0)
+        {
+          if (run_input.dt_type == 1)
+            dt = dt_local(0);
+          else if (run_input.dt_type == 2)
+            dt = dt_local(ic);
+        }
+
+        // the pseudo timestep is kept below the physical one, so that the RK45 stages stay stable for the
+        // physical time derivative
+        if (adv_type == 5 && dt > run_input.dt)
+          dt = run_input.dt;
+
         for (int i=0;i<n_fields;i++)
         {
           for (int inp=0;inp<n_upts_per_ele;inp++)
           {
             rhs = -div_tconf_upts(0)(inp,ic,i)/detjac_upts(inp,ic) + run_input.const_src + src_upts(inp,ic,i);
-            res = disu_upts(1)(inp,ic,i);
-            
-            if (run_input.dt_type != 0)
+
+            if (mg_forcing)
+              rhs += mg_src_upts(inp,ic,i);
+
+            if (adv_type == 5)
             {
-              if (run_input.dt_type == 1)
-                run_input.dt = dt_local(0);
-              else if (run_input.dt_type == 2)
-                run_input.dt = dt_local(ic);
+              rhs -= bdf0*disu_upts(0)(inp,ic,i) + bdf1*disu_upts_dual(0)(inp,ic,i) + bdf2*disu_upts_dual(1)(inp,ic,i);
+
+              if (in_step == 0 && i == run_input.res_norm_field)
+                res_sum += rhs*rhs;
             }
+
+            res = disu_upts(1)(inp,ic,i);
             
-            res = rk4a*res + run_input.dt*rhs;
+            res = rk4a*res + dt*rhs;
             disu_upts(1)(inp,ic,i) = res;
             disu_upts(0)(inp,ic,i) += rk4b*res;
           }
         }
       }
+
+      if (adv_type == 5 && in_step == 0)
+        dual_time_res = res_sum;
+
+      // Leave run_input.dt at the last timestep applied (used to advance the solution time), dual time stepping
+      // and local time stepping keep theirs
+      if (adv_type == 3 && !lts && run_input.dt_type == 1)
+        run_input.dt = dt_local(0);
+      else if (adv_type == 3 && !lts && run_input.dt_type == 2)
+        run_input.dt = dt_local(n_eles-1);
       
 #endif
       
@@ -1197,6 +1293,244 @@ void eles::AdvanceSolution(int in_step, int adv_type) {
   
 }
 
+// compute the element timesteps of dt_type 1 (global minimum over all partitions, in dt_local(0)) or 2 (one per element)
+
+void eles::set_dt_local(void)
+{
+  // If using global minimum timestep based on CFL, determine
+  // global minimum
+  if (run_input.dt_type == 1)
+  {
+    // Find minimum timestep
+    double dt_min = 1e12; // Set to large value
+    
+#pragma omp parallel for reduction(min:dt_min) schedule(static)
+    for (int ic=0; ic<n_eles; ic++)
+    {
+      double dt_local_new = calc_dt_local(ic);
+      
+      if (dt_local_new < dt_min)
+        dt_min = dt_local_new;
+    }
+    
+    dt_local(0) = dt_min;
+    
+    // If running in parallel, gather minimum timestep values from
+    // each partition and find global minumum across partitions
+#ifdef _MPI
+    MPI_Barrier(MPI_COMM_WORLD);
+    MPI_Allgather(&dt_local(0),1,MPI_DOUBLE,dt_local_mpi.get_ptr_cpu(),
+                  1, MPI_DOUBLE, MPI_COMM_WORLD);
+    MPI_Barrier(MPI_COMM_WORLD);
+    
+    dt_local(0) = dt_local_mpi.get_min();
+#endif
+  }
+  
+  // If using local timestepping, just compute and store all local
+  // timesteps
+  if (run_input.dt_type == 2)
+  {
+#pragma omp parallel for schedule(static)
+    for (int ic=0; ic<n_eles; ic++)
+      dt_local(ic) = calc_dt_local(ic);
+  }
+}
+
+// the solution becomes the latest physical time level of dual time stepping, the one before it the previous
+
+void eles::shift_dual_time_levels(void)
+{
+#pragma omp parallel for schedule(static)
+  for (int ic=0;ic<n_eles;ic++)
+    for (int i=0;i<n_fields;i++)
+      for (int inp=0;inp<n_upts_per_ele;inp++)
+      {
+        disu_upts_dual(1)(inp,ic,i) = disu_upts_dual(0)(inp,ic,i);
+        disu_upts_dual(0)(inp,ic,i) = disu_upts(0)(inp,ic,i);
+      }
+
+  if (n_dual_levels < 2)
+    n_dual_levels++;
+}
+
+double eles::get_dual_time_res(void)
+{
+  return dual_time_res;
+}
+
+// timestep of element in_ele for the dt_type in use
+
+double eles::get_dt_ele(int in_ele)
+{
+  if (run_input.dt_type == 1)
+    return dt_local(0);
+  else if (run_input.dt_type == 2)
+    return dt_local(in_ele);
+  else
+    return run_input.dt;
+}
+
+// set the levels of local time stepping and the timestep of level 0, the global minimum of dt_type 1
+
+void eles::set_lts_levels(int* in_levels, double in_dt_min)
+{
+  for (int ic=0;ic<n_eles;ic++)
+    lts_level(ic) = in_levels[ic];
+
+  if (n_eles!=0)
+    dt_local(0) = in_dt_min;
+}
+
+// keep the solution at the start or the end of the local timestep of the elements, for the finer levels that advance
+// in between
+
+void eles::save_lts_solution(int in_end, int in_ele_start, int in_ele_end)
+{
+#pragma omp parallel for schedule(static)
+  for (int ic=in_ele_start;ic<in_ele_end;ic++)
+    for (int i=0;i<n_fields;i++)
+    {
+      for (int inp=0;inp<n_upts_per_ele;inp++)
+        disu_upts_lts(in_end)(inp,ic,i) = disu_upts(0)(inp,ic,i);
+
+      if (in_end == 0)
+        for (int fpt=0;fpt<n_fpts_per_ele;fpt++)
+          lts_flux_fpts(fpt,ic,i) = 0.;
+    }
+}
+
+void eles::restore_lts_solution(int in_ele_start, int in_ele_end)
+{
+#pragma omp parallel for schedule(static)
+  for (int ic=in_ele_start;ic<in_ele_end;ic++)
+    for (int i=0;i<n_fields;i++)
+      for (int inp=0;inp<n_upts_per_ele;inp++)
+        disu_upts(0)(inp,ic,i) = disu_upts_lts(1)(inp,ic,i);
+}
+
+// linear interpolation in time between the solution at the start and at the end of the local timestep, for the
+// residual of a finer level that reaches into the element
+
+void eles::interpolate_lts_solution(int in_n_list, int* in_list, double* in_theta)
+{
+#pragma omp parallel for schedule(static)
+  for (int l=0;l<in_n_list;l++)
+  {
+    int ic = in_list[l];
+    double theta = in_theta[lts_level(ic)];
+
+    for (int i=0;i<n_fields;i++)
+      for (int inp=0;inp<n_upts_per_ele;inp++)
+        disu_upts(0)(inp,ic,i) = (1.-theta)*disu_upts_lts(0)(inp,ic,i) + theta*disu_upts_lts(1)(inp,ic,i);
+  }
+}
+
+// add the weighted normal flux on faces between levels to the flux difference of the coarser element, with sign -1
+// for a stage of its own and +1 for a stage of the finer neighbour
+
+void eles::accumulate_lts_flux(int in_n_list, int* in_list, double in_weight)
+{
+  for (int l=0;l<in_n_list;l++)
+  {
+    int ic = in_list[3*l];
+    int face = in_list[3*l+1];
+    double weight = in_list[3*l+2]*in_weight;
+
+    int fpt_start = 0;
+    for (int j=0;j<face;j++)
+      fpt_start += n_fpts_per_inter(j);
+
+    for (int i=0;i<n_fields;i++)
+      for (int fpt=fpt_start;fpt<fpt_start+n_fpts_per_inter(face);fpt++)
+        lts_flux_fpts(fpt,ic,i) += weight*norm_tconf_fpts(fpt,ic,i);
+  }
+}
+
+// replace the flux on the faces to finer neighbours, as seen by the element's own stages, by the flux the neighbours
+// saw over their steps: the correction of the flux difference divided by the Jacobian is taken from the solution
+
+void eles::apply_lts_flux(int in_ele_start, int in_ele_end)
+{
+#ifdef _CPU
+  for (int i=0;i<n_fields;i++)
+    for (int ic=in_ele_start;ic<in_ele_end;ic++)
+      for (int inp=0;inp<n_upts_per_ele;inp++)
+        div_tconf_upts(0)(inp,ic,i) = 0.;
+
+  add_corrected_divergence(lts_flux_fpts.get_ptr_cpu(),0,in_ele_start,in_ele_end);
+
+  for (int ic=in_ele_start;ic<in_ele_end;ic++)
+    for (int i=0;i<n_fields;i++)
+      for (int inp=0;inp<n_upts_per_ele;inp++)
+        disu_upts(0)(inp,ic,i) -= div_tconf_upts(0)(inp,ic,i)/detjac_upts(inp,ic);
+#endif
+}
+
+int eles::get_n_dofs_per_ele(void)
+{
+  return n_upts_per_ele*n_fields;
+}
+
+// copy the solution to a vector, the unknowns of one element are contiguous
+
+void eles::get_disu_upts_dofs(double* out_dofs)
+{
+  int n_dofs_per_ele = n_upts_per_ele*n_fields;
+
+#pragma omp parallel for schedule(static)
+  for (int ic=0;ic<n_eles;ic++)
+    for (int i=0;i<n_fields;i++)
+      for (int inp=0;inp<n_upts_per_ele;inp++)
+        out_dofs[ic*n_dofs_per_ele+i*n_upts_per_ele+inp] = disu_upts(0)(inp,ic,i);
+}
+
+// copy the solution from a vector ordered as in get_disu_upts_dofs
+
+void eles::set_disu_upts_dofs(double* in_dofs)
+{
+  int n_dofs_per_ele = n_upts_per_ele*n_fields;
+
+#pragma omp parallel for schedule(static)
+  for (int ic=0;ic<n_eles;ic++)
+    for (int i=0;i<n_fields;i++)
+      for (int inp=0;inp<n_upts_per_ele;inp++)
+        disu_upts(0)(inp,ic,i) = in_dofs[ic*n_dofs_per_ele+i*n_upts_per_ele+inp];
+}
+
+// copy the right-hand side of du/dt, as applied by AdvanceSolution, to a vector ordered as in get_disu_upts_dofs
+
+void eles::get_rhs_upts_dofs(double* out_dofs)
+{
+  int n_dofs_per_ele = n_upts_per_ele*n_fields;
+
+#pragma omp parallel for schedule(static)
+  for (int ic=0;ic<n_eles;ic++)
+    for (int i=0;i<n_fields;i++)
+      for (int inp=0;inp<n_upts_per_ele;inp++)
+        out_dofs[ic*n_dofs_per_ele+i*n_upts_per_ele+inp] = -div_tconf_upts(0)(inp,ic,i)/detjac_upts(inp,ic) + run_input.const_src + src_upts(inp,ic,i);
+}
+
+// set the forcing of p-multigrid from a vector ordered as in get_disu_upts_dofs
+
+void eles::set_mg_src_upts_dofs(double* in_dofs)
+{
+  int n_dofs_per_ele = n_upts_per_ele*n_fields;
+
+  if (!mg_forcing)
+  {
+    mg_src_upts.setup_layout(n_upts_per_ele,n_upts_ld,n_eles,n_fields,1,upts_width);
+    mg_src_upts.initialize_to_zero();
+    mg_forcing=1;
+  }
+
+#pragma omp parallel for schedule(static)
+  for (int ic=0;ic<n_eles;ic++)
+    for (int i=0;i<n_fields;i++)
+      for (int inp=0;inp<n_upts_per_ele;inp++)
+        mg_src_upts(inp,ic,i) = in_dofs[ic*n_dofs_per_ele+i*n_upts_per_ele+inp];
+}
+
 double eles::calc_dt_local(int in_ele)
 {
   double lam_inv, lam_inv_new;
@@ -1232,13 +1566,13 @@ double eles::calc_dt_local(int in_ele)
 
     if (viscous)
     {
-      dt_visc = (run_input.CFL * 0.25 * h_ref(0,in_ele) * h_ref(0,in_ele))/(lam_visc) * 1.0/(2.0*run_input.order+1.0);
-      dt_inv = run_input.CFL*h_ref(0,in_ele)/lam_inv*1.0/(2.0*run_input.order + 1.0);
+      dt_visc = (run_input.CFL * 0.25 * h_ref(0,in_ele) * h_ref(0,in_ele))/(lam_visc) * 1.0/(2.0*order+1.0);
+      dt_inv = run_input.CFL*h_ref(0,in_ele)/lam_inv*1.0/(2.0*order + 1.0);
     }
     else
     {
       dt_visc = 1e16;
-      dt_inv = run_input.CFL*h_ref(0,in_ele)/lam_inv * 1.0/(2.0*run_input.order + 1.0);
+      dt_inv = run_input.CFL*h_ref(0,in_ele)/lam_inv * 1.0/(2.0*order + 1.0);
     }
       out_dt_local = min(dt_visc,dt_inv);
   }
@@ -1254,6 +1588,11 @@ double eles::calc_dt_local(int in_ele)
 // calculate the discontinuous solution at the flux points
 
 void eles::extrapolate_solution(int in_disu_upts_from)
+{
+  extrapolate_solution(in_disu_upts_from,0,n_eles);
+}
+
+void eles::extrapolate_solution(int in_disu_upts_from, int in_ele_start, int in_ele_end)
 {
   if (n_eles!=0) {
     
@@ -1286,22 +1625,21 @@ void eles::extrapolate_solution(int in_disu_upts_from)
     
 #ifdef _CPU
     
-    if(opp_0_sparse==0) // dense
+    if(upts_width>1) // dense, on the element blocks of the AoSoA layout
     {
-#if defined _ACCELERATE_BLAS || defined _MKL_BLAS || defined _STANDARD_BLAS
-      cblas_dgemm(CblasColMajor,CblasNoTrans,CblasNoTrans,Arows,Bcols,Acols,1.0,opp_0.get_ptr_cpu(),Astride,disu_upts(in_disu_upts_from).get_ptr_cpu(),Bstride,0.0,disu_fpts.get_ptr_cpu(),Cstride);
-      
-#elif defined _NO_BLAS
-      dgemm(Arows,Bcols,Acols,1.0,0.0,opp_0.get_ptr_cpu(),disu_upts(in_disu_upts_from).get_ptr_cpu(),disu_fpts.get_ptr_cpu());
-      
-#endif
+      apply_opp_aosoa(opp_0,disu_upts(in_disu_upts_from).get_ptr_cpu(),disu_upts(in_disu_upts_from).get_blk_stride(),0.0,disu_fpts.get_ptr_cpu(),0,in_ele_start,in_ele_end);
     }
-    else if(opp_0_sparse==1) // mkl blas four-array csr format
+    else if(collocated_fpts) // flux points coincide with solution points
     {
-#if defined _MKL_BLAS
-      mkl_dcsrmm(&transa,&n_fpts_per_ele,&n_fields_mul_n_eles,&n_upts_per_ele,&one,matdescra,opp_0_data.get_ptr_cpu(),opp_0_cols.get_ptr_cpu(),opp_0_b.get_ptr_cpu(),opp_0_e.get_ptr_cpu(),disu_upts(in_disu_upts_from).get_ptr_cpu(),&n_upts_per_ele,&zero,disu_fpts.get_ptr_cpu(),&n_fpts_per_ele);
-      
-#endif
+      gather_fpts(fpt_upt.get_ptr_cpu(),n_fpts_per_ele,disu_upts(in_disu_upts_from).get_ptr_cpu(),n_upts_ld,disu_fpts.get_ptr_cpu(),n_eles,n_fields,in_ele_start,in_ele_end);
+    }
+    else if(opp_0_sparse==0 || opp_0_sparse==1 || opp_0_sparse==3) // dense, mkl blas four-array csr format or packed dense
+    {
+      apply_opp(opp_0_sparse,opp_0,opp_0_data,opp_0_cols,opp_0_b,opp_0_e,disu_upts(in_disu_upts_from).get_ptr_cpu(),n_upts_ld,0.0,disu_fpts.get_ptr_cpu(),n_fpts_per_ele,in_ele_start,in_ele_end);
+    }
+    else if(opp_0_sparse==2) // sum-factorized tensor product
+    {
+      apply_tensor_extrap(opp_0_tensor,disu_upts(in_disu_upts_from).get_ptr_cpu(),n_upts_ld,0,disu_fpts.get_ptr_cpu(),in_ele_start,in_ele_end);
     }
     else { cout << "ERROR: Unknown storage for opp_0 ... " << endl; }
     
@@ -1329,80 +1667,132 @@ void eles::extrapolate_solution(int in_disu_upts_from)
 // calculate the transformed discontinuous inviscid flux at the solution points
 
 void eles::evaluate_invFlux(int in_disu_upts_from)
+{
+  evaluate_invFlux(in_disu_upts_from,0,n_eles);
+}
+
+void eles::evaluate_invFlux(int in_disu_upts_from, int in_ele_start, int in_ele_end)
 {
   if (n_eles!=0)
   {
     
 #ifdef _CPU
     
+    // Specialized kernel selected at setup
+    if (invFlux_fn!=NULL) {
+      invFlux_fn(disu_upts(in_disu_upts_from).get_ptr_cpu(),JGinv_upts.get_ptr_cpu(),tdisf_upts.get_ptr_cpu(),n_upts_ld,run_input.gamma,n_upts_per_ele,n_eles,in_ele_start,in_ele_end);
+      return;
+    }
+
+    // Batched flux over the element blocks of the AoSoA layout
+    if (upts_width>1 && !motion) {
+      evaluate_flux_aosoa(in_disu_upts_from,false,in_ele_start,in_ele_end);
+      return;
+    }
+
     int i,j,k,l,m;
     
-    for(i=0;i<n_eles;i++)
+#pragma omp parallel private(i,j,k,l,m)
     {
-      for(j=0;j<n_upts_per_ele;j++)
+      // Scratch storage private to this thread
+      int thr = get_thread_num();
+      array<double>& temp_u = this->temp_u(thr);
+      array<double>& temp_v = this->temp_v(thr);
+      array<double>& temp_f = this->temp_f(thr);
+      array<double>& temp_f_ref = this->temp_f_ref(thr);
+      array<double>& temp_f_upts = this->temp_f_upts(thr);
+
+#pragma omp for schedule(static)
+      for(i=in_ele_start;i<in_ele_end;i++)
       {
-        for(k=0;k<n_fields;k++)
+        if (!motion)
         {
-          temp_u(k)=disu_upts(in_disu_upts_from)(j,i,k);
-        }
+          // Batched flux at all solution points of the element
+          if(n_dims==2)
+            calc_invf_2d_batch(n_upts_per_ele,n_fields,disu_upts(in_disu_upts_from).get_ptr_cpu(0,i,0),n_upts_ld*n_eles,temp_f_upts.get_ptr_cpu(),n_upts_per_ele);
+          else if(n_dims==3)
+            calc_invf_3d_batch(n_upts_per_ele,n_fields,disu_upts(in_disu_upts_from).get_ptr_cpu(0,i,0),n_upts_ld*n_eles,temp_f_upts.get_ptr_cpu(),n_upts_per_ele);
+          else
+            FatalError("Invalid number of dimensions!");
 
-        if (motion) {
-          // Transform solution from static frame to dynamic frame
-          for (k=0; k<n_fields; k++) {
-            temp_u(k) /= J_dyn_upts(j,i);
-          }
-          // Get mesh velocity in dynamic frame
-          for (k=0; k<n_dims; k++) {
-            temp_v(k) = grid_vel_upts(j,i,k);
+          // Transform from static physical space to computational space
+          for(k=0;k<n_fields;k++) {
+            for(l=0;l<n_dims;l++) {
+              for(j=0;j<n_upts_per_ele;j++) {
+                tdisf_upts(j,i,k,l)=0.;
+                for(m=0;m<n_dims;m++) {
+                  tdisf_upts(j,i,k,l) += JGinv_upts(l,m,j,i)*temp_f_upts(j,k,m);
+                }
+              }
+            }
           }
-          // Temporary flux vector for dynamic->static transformation
-          temp_f_ref.setup(n_fields,n_dims);
-        }else{
-          temp_v.initialize_to_zero();
-        }
-        
-        if(n_dims==2)
-        {
-          calc_invf_2d(temp_u,temp_f);
-          if (motion)
-            calc_alef_2d(temp_u, temp_v, temp_f);
-        }
-        else if(n_dims==3)
-        {
-          calc_invf_3d(temp_u,temp_f);
-          if (motion)
-            calc_alef_3d(temp_u, temp_v, temp_f);
         }
         else
         {
-          FatalError("Invalid number of dimensions!");
-        }
-
-        // Transform from dynamic-physical space to static-physical space
-        if (motion) {
-          for(k=0; k<n_fields; k++) {
-            for(l=0; l<n_dims; l++) {
-              temp_f_ref(k,l)=0.;
-              for(m=0; m<n_dims; m++) {
-                temp_f_ref(k,l) += JGinv_dyn_upts(l,m,j,i)*temp_f(k,m);
-              }
+          for(j=0;j<n_upts_per_ele;j++)
+          {
+            for(k=0;k<n_fields;k++)
+            {
+              temp_u(k)=disu_upts(in_disu_upts_from)(j,i,k);
             }
-          }
 
-          // Copy Static-Physical Domain flux back to temp_f
-          for (k=0; k<n_fields; k++) {
-            for (l=0; l<n_dims; l++) {
-              temp_f(k,l) = temp_f_ref(k,l);
+            if (motion) {
+              // Transform solution from static frame to dynamic frame
+              for (k=0; k<n_fields; k++) {
+                temp_u(k) /= J_dyn_upts(j,i);
+              }
+              // Get mesh velocity in dynamic frame
+              for (k=0; k<n_dims; k++) {
+                temp_v(k) = grid_vel_upts(j,i,k);
+              }
+            }else{
+              temp_v.initialize_to_zero();
             }
-          }
-        }
         
-        // Transform from static physical space to computational space
-        for(k=0;k<n_fields;k++) {
-          for(l=0;l<n_dims;l++) {
-            tdisf_upts(j,i,k,l)=0.;
-            for(m=0;m<n_dims;m++) {
-              tdisf_upts(j,i,k,l) += JGinv_upts(l,m,j,i)*temp_f(k,m);//JGinv_upts(j,i,l,m)*temp_f(k,m);
+            if(n_dims==2)
+            {
+              calc_invf_2d(temp_u,temp_f);
+              if (motion)
+                calc_alef_2d(temp_u, temp_v, temp_f);
+            }
+            else if(n_dims==3)
+            {
+              calc_invf_3d(temp_u,temp_f);
+              if (motion)
+                calc_alef_3d(temp_u, temp_v, temp_f);
+            }
+            else
+            {
+              FatalError("Invalid number of dimensions!");
+            }
+
+            // Transform from dynamic-physical space to static-physical space
+            if (motion) {
+              for(k=0; k<n_fields; k++) {
+                for(l=0; l<n_dims; l++) {
+                  temp_f_ref(k,l)=0.;
+                  for(m=0; m<n_dims; m++) {
+                    temp_f_ref(k,l) += JGinv_dyn_upts(l,m,j,i)*temp_f(k,m);
+                  }
+                }
+              }
+
+              // Copy Static-Physical Domain flux back to temp_f
+              for (k=0; k<n_fields; k++) {
+                for (l=0; l<n_dims; l++) {
+                  temp_f(k,l) = temp_f_ref(k,l);
+                }
+              }
+            }
+        
+            // Transform from static physical space to computational space
+            for(k=0;k<n_fields;k++) {
+              for(l=0;l<n_dims;l++) {
+                tdisf_upts(j,i,k,l)=0.;
+                for(m=0;m<n_dims;m++) {
+                  tdisf_upts(j,i,k,l) += JGinv_upts(l,m,j,i)*temp_f(k,m);//JGinv_upts(j,i,l,m)*temp_f(k,m);
+                }
+              }
             }
           }
         }
@@ -1418,43 +1808,111 @@ void eles::evaluate_invFlux(int in_disu_upts_from)
 }
 
 
+// calculate the inviscid, or add the viscous, transformed flux on a static mesh in the AoSoA layout. The batched
+// flux kernels run over all the solution points of an element block at once, as they are contiguous for each field
+
+void eles::evaluate_flux_aosoa(int in_disu_upts_from, bool in_viscous, int in_ele_start, int in_ele_end)
+{
+  int w=upts_width;
+  int blk_start=in_ele_start/w;
+  int blk_end=(in_ele_end+w-1)/w;
+  int n_pts=w*n_upts_per_ele;
+  int stride=disu_upts(in_disu_upts_from).get_field_stride();
+
+#pragma omp parallel
+  {
+    array<double>& temp_f_upts = this->temp_f_upts(get_thread_num());
+
+#pragma omp for schedule(static)
+    for(int blk=blk_start;blk<blk_end;blk++)
+    {
+      int e0=blk*w;
+      int lo=max(in_ele_start-e0,0);
+      int hi=min(in_ele_end-e0,w);
+      double* u=disu_upts(in_disu_upts_from).get_ptr_cpu(0,e0,0);
+      double* grad_u=(in_viscous ? grad_disu_upts.get_ptr_cpu(0,e0,0,0) : NULL);
+      double* f=temp_f_upts.get_ptr_cpu();
+
+      // A partial block is done one solution point at a time, so that no padding lane is evaluated
+      int n_calls=(lo==0 && hi==w ? 1 : n_upts_per_ele);
+      for(int c=0;c<n_calls;c++)
+      {
+        int p0=(n_calls==1 ? 0 : w*c+lo);
+        int n=(n_calls==1 ? n_pts : hi-lo);
+
+        if(in_viscous)
+        {
+          if(n_dims==2)
+            calc_visf_2d_batch(n,n_fields,u+p0,stride,grad_u+p0,stride,f+p0,n_pts);
+          else
+            calc_visf_3d_batch(n,n_fields,u+p0,stride,grad_u+p0,stride,f+p0,n_pts);
+        }
+        else
+        {
+          if(n_dims==2)
+            calc_invf_2d_batch(n,n_fields,u+p0,stride,f+p0,n_pts);
+          else
+            calc_invf_3d_batch(n,n_fields,u+p0,stride,f+p0,n_pts);
+        }
+      }
+
+      // Transform from static physical space to computational space
+      for(int k=0;k<n_fields;k++) {
+        for(int l=0;l<n_dims;l++) {
+          for(int j=0;j<n_upts_per_ele;j++) {
+            for(int e=lo;e<hi;e++) {
+              double& tf=tdisf_upts(j,e0+e,k,l);
+              if(!in_viscous)
+                tf=0.;
+              for(int m=0;m<n_dims;m++)
+                tf+=JGinv_upts(l,m,j,e0+e)*temp_f_upts(w*j+e,k,m);
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
 // calculate the normal transformed discontinuous flux at the flux points
 
 void eles::extrapolate_totalFlux()
+{
+  extrapolate_totalFlux(0,n_eles);
+}
+
+void eles::extrapolate_totalFlux(int in_ele_start, int in_ele_end)
 {
   if (n_eles!=0)
   {
 #ifdef _CPU
     
-    if(opp_1_sparse==0) // dense
+    if(upts_width>1) // dense, on the element blocks of the AoSoA layout
     {
-#if defined _ACCELERATE_BLAS || defined _MKL_BLAS || defined _STANDARD_BLAS
-      
-      cblas_dgemm(CblasColMajor,CblasNoTrans,CblasNoTrans,n_fpts_per_ele,n_fields*n_eles,n_upts_per_ele,1.0,opp_1(0).get_ptr_cpu(),n_fpts_per_ele,tdisf_upts.get_ptr_cpu(0,0,0,0),n_upts_per_ele,0.0,norm_tdisf_fpts.get_ptr_cpu(),n_fpts_per_ele);
+      apply_opp_aosoa(opp_1(0),tdisf_upts.get_ptr_cpu(0,0,0,0),tdisf_upts.get_blk_stride(),0.0,norm_tdisf_fpts.get_ptr_cpu(),0,in_ele_start,in_ele_end);
       for (int i=1;i<n_dims;i++)
       {
-        cblas_dgemm(CblasColMajor,CblasNoTrans,CblasNoTrans,n_fpts_per_ele,n_fields*n_eles,n_upts_per_ele,1.0,opp_1(i).get_ptr_cpu(),n_fpts_per_ele,tdisf_upts.get_ptr_cpu(0,0,0,i),n_upts_per_ele,1.0,norm_tdisf_fpts.get_ptr_cpu(),n_fpts_per_ele);
+        apply_opp_aosoa(opp_1(i),tdisf_upts.get_ptr_cpu(0,0,0,i),tdisf_upts.get_blk_stride(),1.0,norm_tdisf_fpts.get_ptr_cpu(),0,in_ele_start,in_ele_end);
       }
-      
-#elif defined _NO_BLAS
-      dgemm(n_fpts_per_ele,n_fields*n_eles,n_upts_per_ele,1.0,0.0,opp_1(0).get_ptr_cpu(),tdisf_upts.get_ptr_cpu(0,0,0,0),norm_tdisf_fpts.get_ptr_cpu());
+    }
+    else if(opp_1_sparse==3) // packed dense, all dimensions in one pass
+    {
+      double* packed=opp_1_stacked.get_ptr_cpu();
+      double* out_ptr=norm_tdisf_fpts.get_ptr_cpu();
+
+      stacked_opp(1,&packed,&n_fpts_per_ele,n_upts_per_ele,n_dims,tdisf_upts.get_ptr_cpu(),n_upts_ld,n_upts_ld*n_eles*n_fields,0.0,&out_ptr,&n_fpts_per_ele,n_eles,n_fields,in_ele_start,in_ele_end);
+    }
+    else if(opp_1_sparse==0 || opp_1_sparse==1) // dense or mkl blas four-array csr format
+    {
+      apply_opp(opp_1_sparse,opp_1(0),opp_1_data(0),opp_1_cols(0),opp_1_b(0),opp_1_e(0),tdisf_upts.get_ptr_cpu(0,0,0,0),n_upts_ld,0.0,norm_tdisf_fpts.get_ptr_cpu(),n_fpts_per_ele,in_ele_start,in_ele_end);
       for (int i=1;i<n_dims;i++)
       {
-        dgemm(n_fpts_per_ele,n_fields*n_eles,n_upts_per_ele,1.0,1.0,opp_1(i).get_ptr_cpu(),tdisf_upts.get_ptr_cpu(0,0,0,i),norm_tdisf_fpts.get_ptr_cpu());
+        apply_opp(opp_1_sparse,opp_1(i),opp_1_data(i),opp_1_cols(i),opp_1_b(i),opp_1_e(i),tdisf_upts.get_ptr_cpu(0,0,0,i),n_upts_ld,1.0,norm_tdisf_fpts.get_ptr_cpu(),n_fpts_per_ele,in_ele_start,in_ele_end);
       }
-#endif
     }
-    else if(opp_1_sparse==1) // mkl blas four-array csr format
+    else if(opp_1_sparse==2) // sum-factorized tensor product
     {
-#if defined _MKL_BLAS
-      
-      mkl_dcsrmm(&transa,&n_fpts_per_ele,&n_fields_mul_n_eles,&n_upts_per_ele,&one,matdescra,opp_1_data(0).get_ptr_cpu(),opp_1_cols(0).get_ptr_cpu(),opp_1_b(0).get_ptr_cpu(),opp_1_e(0).get_ptr_cpu(),tdisf_upts.get_ptr_cpu(0,0,0,0),&n_upts_per_ele,&zero,norm_tdisf_fpts.get_ptr_cpu,&n_fpts_per_ele);
-      
-      for (int i=1;i<n_dims;i++) {
-        mkl_dcsrmm(&transa,&n_fpts_per_ele,&n_fields_mul_n_eles,&n_upts_per_ele,&one,matdescra,opp_1_data(i).get_ptr_cpu(),opp_1_cols(i).get_ptr_cpu(),opp_1_b(i).get_ptr_cpu(),opp_1_e(i).get_ptr_cpu(),tdisf_upts.get_ptr_cpu(0,0,0,i),&n_upts_per_ele,&one,norm_tdisf_fpts.get_ptr_cpu(),&n_fpts_per_ele);
-      }
-      
-#endif
+      apply_tensor_extrap(opp_1_tensor,tdisf_upts.get_ptr_cpu(),n_upts_ld,n_upts_ld*n_eles*n_fields,norm_tdisf_fpts.get_ptr_cpu(),in_ele_start,in_ele_end);
     }
     else
     {
@@ -1515,41 +1973,46 @@ void eles::extrapolate_totalFlux()
 // calculate the divergence of the transformed discontinuous flux at the solution points
 
 void eles::calculate_divergence(int in_div_tconf_upts_to)
+{
+  calculate_divergence(in_div_tconf_upts_to,0,n_eles);
+}
+
+void eles::calculate_divergence(int in_div_tconf_upts_to, int in_ele_start, int in_ele_end)
 {
   if (n_eles!=0)
   {
 #ifdef _CPU
     
-    if(opp_2_sparse==0) // dense
+    if(upts_width>1) // dense, on the element blocks of the AoSoA layout
     {
-#if defined _ACCELERATE_BLAS || defined _MKL_BLAS || defined _STANDARD_BLAS
-      
-      cblas_dgemm(CblasColMajor,CblasNoTrans,CblasNoTrans,n_upts_per_ele,n_fields*n_eles,n_upts_per_ele,1.0,opp_2(0).get_ptr_cpu(),n_upts_per_ele,tdisf_upts.get_ptr_cpu(0,0,0,0),n_upts_per_ele,0.0,div_tconf_upts(in_div_tconf_upts_to).get_ptr_cpu(),n_upts_per_ele);
+      apply_opp_aosoa(opp_2(0),tdisf_upts.get_ptr_cpu(0,0,0,0),tdisf_upts.get_blk_stride(),0.0,div_tconf_upts(in_div_tconf_upts_to).get_ptr_cpu(),div_tconf_upts(in_div_tconf_upts_to).get_blk_stride(),in_ele_start,in_ele_end);
       for (int i=1;i<n_dims;i++)
       {
-        cblas_dgemm(CblasColMajor,CblasNoTrans,CblasNoTrans,n_upts_per_ele,n_fields*n_eles,n_upts_per_ele,1.0,opp_2(i).get_ptr_cpu(),n_upts_per_ele,tdisf_upts.get_ptr_cpu(0,0,0,i),n_upts_per_ele,1.0,div_tconf_upts(in_div_tconf_upts_to).get_ptr_cpu(),n_upts_per_ele);
+        apply_opp_aosoa(opp_2(i),tdisf_upts.get_ptr_cpu(0,0,0,i),tdisf_upts.get_blk_stride(),1.0,div_tconf_upts(in_div_tconf_upts_to).get_ptr_cpu(),div_tconf_upts(in_div_tconf_upts_to).get_blk_stride(),in_ele_start,in_ele_end);
       }
-      
-#elif defined _NO_BLAS
-      dgemm(n_upts_per_ele,n_fields*n_eles,n_upts_per_ele,1.0,0.0,opp_2(0).get_ptr_cpu(),tdisf_upts.get_ptr_cpu(0,0,0,0),div_tconf_upts(in_div_tconf_upts_to).get_ptr_cpu());
+    }
+    else if(opp_2_sparse==3) // packed dense, all dimensions in one pass
+    {
+      double* packed=opp_2_stacked.get_ptr_cpu();
+      double* out_ptr=div_tconf_upts(in_div_tconf_upts_to).get_ptr_cpu();
+
+      stacked_opp(1,&packed,&n_upts_per_ele,n_upts_per_ele,n_dims,tdisf_upts.get_ptr_cpu(),n_upts_ld,n_upts_ld*n_eles*n_fields,0.0,&out_ptr,&n_upts_ld,n_eles,n_fields,in_ele_start,in_ele_end);
+    }
+    else if(opp_2_sparse==0 || opp_2_sparse==1) // dense or mkl blas four-array csr format
+    {
+      apply_opp(opp_2_sparse,opp_2(0),opp_2_data(0),opp_2_cols(0),opp_2_b(0),opp_2_e(0),tdisf_upts.get_ptr_cpu(0,0,0,0),n_upts_ld,0.0,div_tconf_upts(in_div_tconf_upts_to).get_ptr_cpu(),n_upts_ld,in_ele_start,in_ele_end);
       for (int i=1;i<n_dims;i++)
       {
-        dgemm(n_upts_per_ele,n_fields*n_eles,n_upts_per_ele,1.0,1.0,opp_2(i).get_ptr_cpu(),tdisf_upts.get_ptr_cpu(0,0,0,i),div_tconf_upts(in_div_tconf_upts_to).get_ptr_cpu());
+        apply_opp(opp_2_sparse,opp_2(i),opp_2_data(i),opp_2_cols(i),opp_2_b(i),opp_2_e(i),tdisf_upts.get_ptr_cpu(0,0,0,i),n_upts_ld,1.0,div_tconf_upts(in_div_tconf_upts_to).get_ptr_cpu(),n_upts_ld,in_ele_start,in_ele_end);
       }
-      
-#endif
     }
-    else if(opp_2_sparse==1) // mkl blas four-array csr format
+    else if(opp_2_sparse==2) // sum-factorized tensor product
     {
-#if defined _MKL_BLAS
-      
-      mkl_dcsrmm(&transa,&n_upts_per_ele,&n_fields_mul_n_eles,&n_upts_per_ele,&one,matdescra,opp_2_data(0).get_ptr_cpu(),opp_2_cols(0).get_ptr_cpu(),opp_2_b(0).get_ptr_cpu(),opp_2_e(0).get_ptr_cpu(),tdisf_upts.get_ptr_cpu(0,0,0,0),&n_upts_per_ele,&zero,div_tconf_upts(in_div_tconf_upts_to).get_ptr_cpu(),&n_upts_per_ele);
+      apply_tensor_deriv(opp_2_tensor(0),0,tdisf_upts.get_ptr_cpu(0,0,0,0),div_tconf_upts(in_div_tconf_upts_to).get_ptr_cpu(),n_upts_ld,0.0,in_ele_start,in_ele_end);
       for (int i=1;i<n_dims;i++)
       {
-        mkl_dcsrmm(&transa,&n_upts_per_ele,&n_fields_mul_n_eles,&n_upts_per_ele,&one,matdescra,opp_2_data(i).get_ptr_cpu(),opp_2_cols(i).get_ptr_cpu(),opp_2_b(i).get_ptr_cpu(),opp_2_e(i).get_ptr_cpu(),tdisf_upts.get_ptr_cpu(0,0,0,i),&n_upts_per_ele,&one,div_tconf_upts(in_div_tconf_upts_to).get_ptr_cpu(),&n_upts_per_ele);
+        apply_tensor_deriv(opp_2_tensor(i),i,tdisf_upts.get_ptr_cpu(0,0,0,i),div_tconf_upts(in_div_tconf_upts_to).get_ptr_cpu(),n_upts_ld,1.0,in_ele_start,in_ele_end);
       }
-      
-#endif
     }
     else
     {
@@ -1592,49 +2055,35 @@ void eles::calculate_divergence(int in_div_tconf_upts_to)
 // calculate divergence of the transformed continuous flux at the solution points
 
 void eles::calculate_corrected_divergence(int in_div_tconf_upts_to)
+{
+  calculate_corrected_divergence(in_div_tconf_upts_to,0,n_eles);
+}
+
+void eles::calculate_corrected_divergence(int in_div_tconf_upts_to, int in_ele_start, int in_ele_end)
 {
   if (n_eles!=0)
   {
 #ifdef _CPU
     
-#if defined _ACCELERATE_BLAS || defined _MKL_BLAS || defined _STANDARD_BLAS
-    
-    cblas_daxpy(n_eles*n_fields*n_fpts_per_ele,-1.0,norm_tdisf_fpts.get_ptr_cpu(),1,norm_tconf_fpts.get_ptr_cpu(),1);
-    
-#elif defined _NO_BLAS
-    
-    daxpy(n_eles*n_fields*n_fpts_per_ele,-1.0,norm_tdisf_fpts.get_ptr_cpu(),norm_tconf_fpts.get_ptr_cpu());
-    
-#endif
-    
-    if(opp_3_sparse==0) // dense
+    for (int k=0;k<n_fields;k++)
     {
 #if defined _ACCELERATE_BLAS || defined _MKL_BLAS || defined _STANDARD_BLAS
       
-      cblas_dgemm(CblasColMajor,CblasNoTrans,CblasNoTrans,n_upts_per_ele,n_fields*n_eles,n_fpts_per_ele,1.0,opp_3.get_ptr_cpu(),n_upts_per_ele,norm_tconf_fpts.get_ptr_cpu(),n_fpts_per_ele,1.0,div_tconf_upts(in_div_tconf_upts_to).get_ptr_cpu(),n_upts_per_ele);
+      cblas_daxpy((in_ele_end-in_ele_start)*n_fpts_per_ele,-1.0,norm_tdisf_fpts.get_ptr_cpu(0,in_ele_start,k),1,norm_tconf_fpts.get_ptr_cpu(0,in_ele_start,k),1);
       
 #elif defined _NO_BLAS
-      dgemm(n_upts_per_ele,n_fields*n_eles,n_fpts_per_ele,1.0,1.0,opp_3.get_ptr_cpu(),norm_tconf_fpts.get_ptr_cpu(),div_tconf_upts(in_div_tconf_upts_to).get_ptr_cpu());
-      
-#endif
-    }
-    else if(opp_3_sparse==1) // mkl blas four-array csr format
-    {
-#if defined _MKL_BLAS
       
-      mkl_dcsrmm(&transa,&n_upts_per_ele,&n_fields_mul_n_eles,&n_fpts_per_ele,&one,matdescra,opp_3_data.get_ptr_cpu(),opp_3_cols.get_ptr_cpu(),opp_3_b.get_ptr_cpu(),opp_3_e.get_ptr_cpu(),norm_tconf_fpts.get_ptr_cpu(),&n_fpts_per_ele,&one,div_tconf_upts(in_div_tconf_upts_to).get_ptr_cpu(),&n_upts_per_ele);
+      daxpy((in_ele_end-in_ele_start)*n_fpts_per_ele,-1.0,norm_tdisf_fpts.get_ptr_cpu(0,in_ele_start,k),norm_tconf_fpts.get_ptr_cpu(0,in_ele_start,k));
       
 #endif
     }
-    else
-    {
-      cout << "ERROR: Unknown storage for opp_3 ... " << endl;
-    }
+    
+    add_corrected_divergence(norm_tconf_fpts.get_ptr_cpu(),in_div_tconf_upts_to,in_ele_start,in_ele_end);
     
     for (int i=0;i<n_upts_per_ele;i++)
-      for (int j=0;j<n_eles;j++)
+      for (int j=in_ele_start;j<in_ele_end;j++)
         for (int k=0;k<n_fields;k++)
-          if (isnan(div_tconf_upts(in_div_tconf_upts_to)(j,i,k)))
+          if (isnan(div_tconf_upts(in_div_tconf_upts_to)(i,j,k)))
             FatalError("NaN in residual, exiting.");
 
 #endif
@@ -1660,11 +2109,68 @@ void eles::calculate_corrected_divergence(int in_div_tconf_upts_to)
   }
 }
 
+// add opp_3 applied to flux point values laid out as norm_tconf_fpts to the divergence at the solution points
+
+void eles::add_corrected_divergence(double* in_fpts_ptr, int in_div_tconf_upts_to, int in_ele_start, int in_ele_end)
+{
+#ifdef _CPU
+  if(upts_width>1) // dense, on the element blocks of the AoSoA layout
+  {
+    apply_opp_aosoa(opp_3,in_fpts_ptr,0,1.0,div_tconf_upts(in_div_tconf_upts_to).get_ptr_cpu(),div_tconf_upts(in_div_tconf_upts_to).get_blk_stride(),in_ele_start,in_ele_end);
+  }
+  else if(opp_3_sparse==0 || opp_3_sparse==1 || opp_3_sparse==3) // dense, mkl blas four-array csr format or packed dense
+  {
+    apply_opp(opp_3_sparse,opp_3,opp_3_data,opp_3_cols,opp_3_b,opp_3_e,in_fpts_ptr,n_fpts_per_ele,1.0,div_tconf_upts(in_div_tconf_upts_to).get_ptr_cpu(),n_upts_ld,in_ele_start,in_ele_end);
+  }
+  else if(opp_3_sparse==2) // sum-factorized tensor product
+  {
+    apply_tensor_correct(opp_3_tensor,-1,in_fpts_ptr,div_tconf_upts(in_div_tconf_upts_to).get_ptr_cpu(),n_upts_ld,in_ele_start,in_ele_end);
+  }
+  else
+  {
+    cout << "ERROR: Unknown storage for opp_3 ... " << endl;
+  }
+#endif
+}
+
+
+// calculate the normal transformed discontinuous flux at the flux points and the divergence of the transformed
+// discontinuous flux at the solution points. With opp_1 and opp_2 both packed dense, the flux of all dimensions is
+// read once for both, in the same order of operations as the two separate passes
+
+void eles::calculate_totalFlux_divergence(int in_div_tconf_upts_to)
+{
+  calculate_totalFlux_divergence(in_div_tconf_upts_to,0,n_eles);
+}
+
+void eles::calculate_totalFlux_divergence(int in_div_tconf_upts_to, int in_ele_start, int in_ele_end)
+{
+#ifdef _CPU
+  if(n_eles!=0 && upts_width==1 && opp_1_sparse==3 && opp_2_sparse==3)
+  {
+    double* packed[2]={opp_1_stacked.get_ptr_cpu(),opp_2_stacked.get_ptr_cpu()};
+    int n_rows[2]={n_fpts_per_ele,n_upts_per_ele};
+    double* out_ptr[2]={norm_tdisf_fpts.get_ptr_cpu(),div_tconf_upts(in_div_tconf_upts_to).get_ptr_cpu()};
+    int out_ld[2]={n_fpts_per_ele,n_upts_ld};
+
+    stacked_opp(2,packed,n_rows,n_upts_per_ele,n_dims,tdisf_upts.get_ptr_cpu(),n_upts_ld,n_upts_ld*n_eles*n_fields,0.0,out_ptr,out_ld,n_eles,n_fields,in_ele_start,in_ele_end);
+    return;
+  }
+#endif
+
+  extrapolate_totalFlux(in_ele_start,in_ele_end);
+  calculate_divergence(in_div_tconf_upts_to,in_ele_start,in_ele_end);
+}
 
 // calculate uncorrected transformed gradient of the discontinuous solution at the solution points
 // (mixed derivative)
 
 void eles::calculate_gradient(int in_disu_upts_from)
+{
+  calculate_gradient(in_disu_upts_from,0,n_eles);
+}
+
+void eles::calculate_gradient(int in_disu_upts_from, int in_ele_start, int in_ele_end)
 {
   if (n_eles!=0)
   {
@@ -1700,27 +2206,39 @@ void eles::calculate_gradient(int in_disu_upts_from)
     
 #ifdef _CPU
     
-    if(opp_4_sparse==0) // dense
+    if(upts_width>1) // dense, on the element blocks of the AoSoA layout
     {
-#if defined _ACCELERATE_BLAS || defined _MKL_BLAS || defined _STANDARD_BLAS
       for (int i=0;i<n_dims;i++) {
-        cblas_dgemm(CblasColMajor,CblasNoTrans,CblasNoTrans,Arows,Bcols,Acols,1.0,opp_4(i).get_ptr_cpu(),Astride,disu_upts(in_disu_upts_from).get_ptr_cpu(),Bstride,0.0,grad_disu_upts.get_ptr_cpu(0,0,0,i),Cstride);
+        apply_opp_aosoa(opp_4(i),disu_upts(in_disu_upts_from).get_ptr_cpu(),disu_upts(in_disu_upts_from).get_blk_stride(),0.0,grad_disu_upts.get_ptr_cpu(0,0,0,i),grad_disu_upts.get_blk_stride(),in_ele_start,in_ele_end);
       }
-      
-#elif defined _NO_BLAS
+    }
+    else if(opp_4_sparse==3) // packed dense, all dimensions in one pass
+    {
+      double* packed[3];
+      int n_rows[3];
+      double* out_ptr[3];
+      int out_ld[3];
+
       for (int i=0;i<n_dims;i++) {
-        dgemm(Arows,Bcols,Acols,1.0,0.0,opp_4(i).get_ptr_cpu(),disu_upts(in_disu_upts_from).get_ptr_cpu(),grad_disu_upts.get_ptr_cpu(0,0,0,i));
+        packed[i]=opp_4_data(i).get_ptr_cpu();
+        n_rows[i]=n_upts_per_ele;
+        out_ptr[i]=grad_disu_upts.get_ptr_cpu(0,0,0,i);
+        out_ld[i]=n_upts_ld;
       }
-      
-#endif
+
+      stacked_opp(n_dims,packed,n_rows,n_upts_per_ele,1,disu_upts(in_disu_upts_from).get_ptr_cpu(),n_upts_ld,0,0.0,out_ptr,out_ld,n_eles,n_fields,in_ele_start,in_ele_end);
     }
-    else if(opp_4_sparse==1) // mkl blas four-array csr format
+    else if(opp_4_sparse==0 || opp_4_sparse==1) // dense or mkl blas four-array csr format
     {
-#if defined _MKL_BLAS
-      
-      // implement
-      
-#endif
+      for (int i=0;i<n_dims;i++) {
+        apply_opp(opp_4_sparse,opp_4(i),opp_4_data(i),opp_4_cols(i),opp_4_b(i),opp_4_e(i),disu_upts(in_disu_upts_from).get_ptr_cpu(),n_upts_ld,0.0,grad_disu_upts.get_ptr_cpu(0,0,0,i),n_upts_ld,in_ele_start,in_ele_end);
+      }
+    }
+    else if(opp_4_sparse==2) // sum-factorized tensor product
+    {
+      for (int i=0;i<n_dims;i++) {
+        apply_tensor_deriv(opp_4_tensor(i),i,disu_upts(in_disu_upts_from).get_ptr_cpu(),grad_disu_upts.get_ptr_cpu(0,0,0,i),n_upts_ld,0.0,in_ele_start,in_ele_end);
+      }
     }
     else
     {
@@ -1768,6 +2286,11 @@ void eles::calculate_gradient(int in_disu_upts_from)
 // calculate corrected gradient of the discontinuous solution at solution points
 
 void eles::correct_gradient(void)
+{
+  correct_gradient(0,n_eles);
+}
+
+void eles::correct_gradient(int in_ele_start, int in_ele_end)
 {
   if (n_eles!=0)
   {
@@ -1783,29 +2306,39 @@ void eles::correct_gradient(void)
     
 #ifdef _CPU
     
-    if(opp_5_sparse==0) // dense
+    if(upts_width>1) // dense, on the element blocks of the AoSoA layout
     {
-#if defined _ACCELERATE_BLAS || defined _MKL_BLAS || defined _STANDARD_BLAS
-      
-      for (int i=0;i<n_dims;i++)
-      {
-        cblas_dgemm(CblasColMajor,CblasNoTrans,CblasNoTrans,Arows,Bcols,Acols,1.0,opp_5(i).get_ptr_cpu(),Astride,delta_disu_fpts.get_ptr_cpu(),Bstride,1.0,grad_disu_upts.get_ptr_cpu(0,0,0,i),Cstride);
+      for (int i=0;i<n_dims;i++) {
+        apply_opp_aosoa(opp_5(i),delta_disu_fpts.get_ptr_cpu(),0,1.0,grad_disu_upts.get_ptr_cpu(0,0,0,i),grad_disu_upts.get_blk_stride(),in_ele_start,in_ele_end);
       }
-      
-#elif defined _NO_BLAS
+    }
+    else if(opp_5_sparse==3) // packed dense, all dimensions in one pass
+    {
+      double* packed[3];
+      int n_rows[3];
+      double* out_ptr[3];
+      int out_ld[3];
+
       for (int i=0;i<n_dims;i++) {
-        dgemm(Arows,Bcols,Acols,1.0,1.0,opp_5(i).get_ptr_cpu(),delta_disu_fpts.get_ptr_cpu(),grad_disu_upts.get_ptr_cpu(0,0,0,i));
+        packed[i]=opp_5_data(i).get_ptr_cpu();
+        n_rows[i]=n_upts_per_ele;
+        out_ptr[i]=grad_disu_upts.get_ptr_cpu(0,0,0,i);
+        out_ld[i]=n_upts_ld;
       }
-      
-#endif
+
+      stacked_opp(n_dims,packed,n_rows,n_fpts_per_ele,1,delta_disu_fpts.get_ptr_cpu(),n_fpts_per_ele,0,1.0,out_ptr,out_ld,n_eles,n_fields,in_ele_start,in_ele_end);
     }
-    else if(opp_5_sparse==1) // mkl blas four-array csr format
+    else if(opp_5_sparse==0 || opp_5_sparse==1) // dense or mkl blas four-array csr format
     {
-#if defined _MKL_BLAS
-      
-      // impelement
-      
-#endif
+      for (int i=0;i<n_dims;i++) {
+        apply_opp(opp_5_sparse,opp_5(i),opp_5_data(i),opp_5_cols(i),opp_5_b(i),opp_5_e(i),delta_disu_fpts.get_ptr_cpu(),n_fpts_per_ele,1.0,grad_disu_upts.get_ptr_cpu(0,0,0,i),n_upts_ld,in_ele_start,in_ele_end);
+      }
+    }
+    else if(opp_5_sparse==2) // sum-factorized tensor product
+    {
+      for (int i=0;i<n_dims;i++) {
+        apply_tensor_correct(opp_5_tensor,i,delta_disu_fpts.get_ptr_cpu(),grad_disu_upts.get_ptr_cpu(0,0,0,i),n_upts_ld,in_ele_start,in_ele_end);
+      }
     }
     else
     {
@@ -1819,7 +2352,7 @@ void eles::correct_gradient(void)
     double Xx,Xy,Xz,Yx,Yy,Yz,Zx,Zy,Zz;
     double ur,us,ut,uX,uY,uZ;
     
-    for (int i=0;i<n_eles;i++)
+    for (int i=in_ele_start;i<in_ele_end;i++)
     {
       for (int j=0;j<n_upts_per_ele;j++)
       {
@@ -1872,7 +2405,7 @@ void eles::correct_gradient(void)
 
           Xx = JGinv_dyn_upts(0,0,j,i)*inv_detjac;
           Xy = JGinv_dyn_upts(0,1,j,i)*inv_detjac;
-          Yx = JGinv_dyn_upts(1,1,j,i)*inv_detjac;
+          Yx = JGinv_dyn_upts(1,0,j,i)*inv_detjac;
           Yy = JGinv_dyn_upts(1,1,j,i)*inv_detjac;
 
           //physical gradient
@@ -1889,12 +2422,12 @@ void eles::correct_gradient(void)
           }
           if (n_dims==3)
           {
-            Xz = JGinv_dyn_upts(j,i,0,2)*inv_detjac;
-            Yz = JGinv_dyn_upts(j,i,1,2)*inv_detjac;
+            Xz = JGinv_dyn_upts(0,2,j,i)*inv_detjac;
+            Yz = JGinv_dyn_upts(1,2,j,i)*inv_detjac;
 
-            Zx = JGinv_dyn_upts(j,i,2,0)*inv_detjac;
-            Zy = JGinv_dyn_upts(j,i,2,1)*inv_detjac;
-            Zz = JGinv_dyn_upts(j,i,2,2)*inv_detjac;
+            Zx = JGinv_dyn_upts(2,0,j,i)*inv_detjac;
+            Zy = JGinv_dyn_upts(2,1,j,i)*inv_detjac;
+            Zz = JGinv_dyn_upts(2,2,j,i)*inv_detjac;
 
             for (int k=0;k<n_fields;k++)
             {
@@ -1971,6 +2504,11 @@ void eles::correct_gradient(void)
 // calculate corrected gradient of the discontinuous solution at flux points
 
 void eles::extrapolate_corrected_gradient(void)
+{
+  extrapolate_corrected_gradient(0,n_eles);
+}
+
+void eles::extrapolate_corrected_gradient(int in_ele_start, int in_ele_end)
 {
   if (n_eles!=0)
   {
@@ -1986,28 +2524,29 @@ void eles::extrapolate_corrected_gradient(void)
     
 #ifdef _CPU
     
-    if(opp_6_sparse==0) // dense
+    if(upts_width>1) // dense, on the element blocks of the AoSoA layout
     {
-#if defined _ACCELERATE_BLAS || defined _MKL_BLAS || defined _STANDARD_BLAS
-      
-      for (int i=0;i<n_dims;i++)
-      {
-        cblas_dgemm(CblasColMajor,CblasNoTrans,CblasNoTrans,Arows,Bcols,Acols,1.0,opp_6.get_ptr_cpu(),Astride,grad_disu_upts.get_ptr_cpu(0,0,0,i),Bstride,0.0,grad_disu_fpts.get_ptr_cpu(0,0,0,i),Cstride);
+      for (int i=0;i<n_dims;i++) {
+        apply_opp_aosoa(opp_6,grad_disu_upts.get_ptr_cpu(0,0,0,i),grad_disu_upts.get_blk_stride(),0.0,grad_disu_fpts.get_ptr_cpu(0,0,0,i),0,in_ele_start,in_ele_end);
       }
-      
-#elif defined _NO_BLAS
+    }
+    else if(collocated_fpts) // flux points coincide with solution points, opp_6 is opp_0
+    {
       for (int i=0;i<n_dims;i++) {
-        dgemm(Arows,Bcols,Acols,1.0,0.0,opp_6.get_ptr_cpu(),grad_disu_upts.get_ptr_cpu(0,0,0,i),grad_disu_fpts.get_ptr_cpu(0,0,0,i));
+        gather_fpts(fpt_upt.get_ptr_cpu(),n_fpts_per_ele,grad_disu_upts.get_ptr_cpu(0,0,0,i),n_upts_ld,grad_disu_fpts.get_ptr_cpu(0,0,0,i),n_eles,n_fields,in_ele_start,in_ele_end);
       }
-#endif
     }
-    else if(opp_6_sparse==1) // mkl blas four-array csr format
+    else if(opp_6_sparse==0 || opp_6_sparse==1 || opp_6_sparse==3) // dense, mkl blas four-array csr format or packed dense
     {
-#if defined _MKL_BLAS
-      
-      // implement
-      
-#endif
+      for (int i=0;i<n_dims;i++) {
+        apply_opp(opp_6_sparse,opp_6,opp_6_data,opp_6_cols,opp_6_b,opp_6_e,grad_disu_upts.get_ptr_cpu(0,0,0,i),n_upts_ld,0.0,grad_disu_fpts.get_ptr_cpu(0,0,0,i),n_fpts_per_ele,in_ele_start,in_ele_end);
+      }
+    }
+    else if(opp_6_sparse==2) // sum-factorized tensor product
+    {
+      for (int i=0;i<n_dims;i++) {
+        apply_tensor_extrap(opp_6_tensor,grad_disu_upts.get_ptr_cpu(0,0,0,i),n_upts_ld,0,grad_disu_fpts.get_ptr_cpu(0,0,0,i),in_ele_start,in_ele_end);
+      }
     }
     else
     {
@@ -2051,6 +2590,54 @@ void eles::extrapolate_corrected_gradient(void)
    */
 }
 
+// calculate the inviscid flux, and the uncorrected gradient if viscous, one block of elements at a time
+
+void eles::evaluate_invFlux_blocked(int in_disu_upts_from)
+{
+  for (int i=0;i<n_eles;i+=ele_block_size)
+  {
+    int end = min(i+ele_block_size,n_eles);
+
+    extrapolate_solution(in_disu_upts_from,i,end);
+
+    if (viscous)
+      calculate_gradient(in_disu_upts_from,i,end);
+
+    evaluate_invFlux(in_disu_upts_from,i,end);
+  }
+}
+
+// correct the gradient at the solution and flux points one block of elements at a time
+
+void eles::correct_gradient_blocked(void)
+{
+  for (int i=0;i<n_eles;i+=ele_block_size)
+  {
+    int end = min(i+ele_block_size,n_eles);
+
+    correct_gradient(i,end);
+    extrapolate_corrected_gradient(i,end);
+  }
+}
+
+// calculate the total flux and its divergence one block of elements at a time
+
+void eles::calculate_divergence_blocked(int in_disu_upts_from, int in_div_tconf_upts_to)
+{
+  for (int i=0;i<n_eles;i+=ele_block_size)
+  {
+    int end = min(i+ele_block_size,n_eles);
+
+    if (viscous)
+      evaluate_viscFlux(in_disu_upts_from,i,end);
+
+    if (LES)
+      evaluate_sgsFlux(i,end);
+
+    calculate_totalFlux_divergence(in_div_tconf_upts_to,i,end);
+  }
+}
+
 /*! If at first RK step and using certain LES models, compute some model-related quantities.
  If using similarity or WALE-similarity (WSM) models, compute filtered solution and Leonard tensors.
  If using spectral vanishing viscosity (SVV) model, compute filtered solution. */
@@ -2062,7 +2649,6 @@ void eles::calc_sgs_terms(int in_disu_upts_from)
     int i,j,k,l;
     int dim3;
     double diag, rsq;
-    array <double> utemp(n_fields);
     
     /*! Filter solution */
     
@@ -2072,7 +2658,7 @@ void eles::calc_sgs_terms(int in_disu_upts_from)
     Bcols = n_fields*n_eles;
     
     Astride = Arows;
-    Bstride = Brows;
+    Bstride = n_upts_ld;
     Cstride = Arows;
     
 #ifdef _CPU
@@ -2082,7 +2668,7 @@ void eles::calc_sgs_terms(int in_disu_upts_from)
     cblas_dgemm(CblasColMajor,CblasNoTrans,CblasNoTrans,Arows,Bcols,Acols,1.0,filter_upts.get_ptr_cpu(),Astride,disu_upts(in_disu_upts_from).get_ptr_cpu(),Bstride,0.0,disuf_upts.get_ptr_cpu(),Cstride);
     
 #elif defined _NO_BLAS
-    dgemm(Arows,Bcols,Acols,1.0,0.0,filter_upts.get_ptr_cpu(),disu_upts(in_disu_upts_from).get_ptr_cpu(),disuf_upts.get_ptr_cpu());
+    dgemm(Arows,Bcols,Acols,1.0,0.0,filter_upts.get_ptr_cpu(),Astride,disu_upts(in_disu_upts_from).get_ptr_cpu(),Bstride,disuf_upts.get_ptr_cpu(),Cstride);
     
 #else
     
@@ -2101,18 +2687,21 @@ void eles::calc_sgs_terms(int in_disu_upts_from)
 #endif
     
     /*! Check for NaNs */
-    for(i=0;i<n_upts_per_ele;i++)
-      for(j=0;j<n_eles;j++)
-        for(k=0;k<n_fields;k++)
+#pragma omp parallel for private(i,j,k) schedule(static)
+    for(j=0;j<n_eles;j++)
+      for(k=0;k<n_fields;k++)
+        for(i=0;i<n_upts_per_ele;i++)
           if(isnan(disuf_upts(i,j,k)))
             FatalError("nan in filtered solution");
     
     /*! If SVV model, copy filtered solution back to solution */
-    if(sgs_model==3)
-      for(i=0;i<n_upts_per_ele;i++)
-        for(j=0;j<n_eles;j++)
-          for(k=0;k<n_fields;k++)
+    if(sgs_model==3) {
+#pragma omp parallel for private(i,j,k) schedule(static)
+      for(j=0;j<n_eles;j++)
+        for(k=0;k<n_fields;k++)
+          for(i=0;i<n_upts_per_ele;i++)
             disu_upts(in_disu_upts_from)(i,j,k) = disuf_upts(i,j,k);
+    }
     
     /*! If Similarity model, compute product terms and Leonard tensors */
     else if(sgs_model==2 || sgs_model==4) {
@@ -2122,42 +2711,48 @@ void eles::calc_sgs_terms(int in_disu_upts_from)
       else if(n_dims==3) dim3 = 6;
       
       /*! Calculate velocity and energy product arrays uu, ue */
-      for(i=0;i<n_upts_per_ele;i++) {
+#pragma omp parallel private(i,j,k,rsq)
+      {
+        array<double>& utemp = temp_u(get_thread_num());
+
+#pragma omp for schedule(static)
         for(j=0;j<n_eles;j++) {
-          for(k=0;k<n_fields;k++) {
-            utemp(k) = disu_upts(in_disu_upts_from)(i,j,k);
-          }
+          for(i=0;i<n_upts_per_ele;i++) {
+            for(k=0;k<n_fields;k++) {
+              utemp(k) = disu_upts(in_disu_upts_from)(i,j,k);
+            }
           
-          rsq = utemp(0)*utemp(0);
+            rsq = utemp(0)*utemp(0);
           
-          /*! note that product arrays are symmetric */
-          if(n_dims==2) {
-            /*! velocity-velocity product */
-            uu(i,j,0) = utemp(1)*utemp(1)/rsq;
-            uu(i,j,1) = utemp(2)*utemp(2)/rsq;
-            uu(i,j,2) = utemp(1)*utemp(2)/rsq;
+            /*! note that product arrays are symmetric */
+            if(n_dims==2) {
+              /*! velocity-velocity product */
+              uu(i,j,0) = utemp(1)*utemp(1)/rsq;
+              uu(i,j,1) = utemp(2)*utemp(2)/rsq;
+              uu(i,j,2) = utemp(1)*utemp(2)/rsq;
             
-            /*! velocity-energy product */
-            utemp(3) -= 0.5*(utemp(1)*utemp(1)+utemp(2)*utemp(2))/utemp(0); // internal energy*rho
+              /*! velocity-energy product */
+              utemp(3) -= 0.5*(utemp(1)*utemp(1)+utemp(2)*utemp(2))/utemp(0); // internal energy*rho
             
-            ue(i,j,0) = utemp(1)*utemp(3)/rsq;
-            ue(i,j,1) = utemp(2)*utemp(3)/rsq;
-          }
-          else if(n_dims==3) {
-            /*! velocity-velocity product */
-            uu(i,j,0) = utemp(1)*utemp(1)/rsq;
-            uu(i,j,1) = utemp(2)*utemp(2)/rsq;
-            uu(i,j,2) = utemp(3)*utemp(3)/rsq;
-            uu(i,j,3) = utemp(1)*utemp(2)/rsq;
-            uu(i,j,4) = utemp(1)*utemp(3)/rsq;
-            uu(i,j,5) = utemp(2)*utemp(3)/rsq;
+              ue(i,j,0) = utemp(1)*utemp(3)/rsq;
+              ue(i,j,1) = utemp(2)*utemp(3)/rsq;
+            }
+            else if(n_dims==3) {
+              /*! velocity-velocity product */
+              uu(i,j,0) = utemp(1)*utemp(1)/rsq;
+              uu(i,j,1) = utemp(2)*utemp(2)/rsq;
+              uu(i,j,2) = utemp(3)*utemp(3)/rsq;
+              uu(i,j,3) = utemp(1)*utemp(2)/rsq;
+              uu(i,j,4) = utemp(1)*utemp(3)/rsq;
+              uu(i,j,5) = utemp(2)*utemp(3)/rsq;
             
-            /*! velocity-energy product */
-            utemp(4) -= 0.5*(utemp(1)*utemp(1)+utemp(2)*utemp(2)+utemp(3)*utemp(3))/utemp(0); // internal energy*rho
+              /*! velocity-energy product */
+              utemp(4) -= 0.5*(utemp(1)*utemp(1)+utemp(2)*utemp(2)+utemp(3)*utemp(3))/utemp(0); // internal energy*rho
             
-            ue(i,j,0) = utemp(1)*utemp(4)/rsq;
-            ue(i,j,1) = utemp(2)*utemp(4)/rsq;
-            ue(i,j,2) = utemp(3)*utemp(4)/rsq;
+              ue(i,j,0) = utemp(1)*utemp(4)/rsq;
+              ue(i,j,1) = utemp(2)*utemp(4)/rsq;
+              ue(i,j,2) = utemp(3)*utemp(4)/rsq;
+            }
           }
         }
       }
@@ -2204,53 +2799,59 @@ void eles::calc_sgs_terms(int in_disu_upts_from)
 #endif
       
       /*! Subtract product of unfiltered quantities from Leonard tensors */
-      for(i=0;i<n_upts_per_ele;i++) {
+#pragma omp parallel private(i,j,k,rsq,diag)
+      {
+        array<double>& utemp = temp_u(get_thread_num());
+
+#pragma omp for schedule(static)
         for(j=0;j<n_eles;j++) {
+          for(i=0;i<n_upts_per_ele;i++) {
           
-          // filtered solution
-          for(k=0;k<n_fields;k++)
-            utemp(k) = disuf_upts(i,j,k);
+            // filtered solution
+            for(k=0;k<n_fields;k++)
+              utemp(k) = disuf_upts(i,j,k);
           
-          rsq = utemp(0)*utemp(0);
+            rsq = utemp(0)*utemp(0);
           
-          if(n_dims==2) {
+            if(n_dims==2) {
             
-            Lu(i,j,0) -= (utemp(1)*utemp(1))/rsq;
-            Lu(i,j,1) -= (utemp(2)*utemp(2))/rsq;
-            Lu(i,j,2) -= (utemp(1)*utemp(2))/rsq;
+              Lu(i,j,0) -= (utemp(1)*utemp(1))/rsq;
+              Lu(i,j,1) -= (utemp(2)*utemp(2))/rsq;
+              Lu(i,j,2) -= (utemp(1)*utemp(2))/rsq;
             
-            diag = (Lu(i,j,0)+Lu(i,j,1))/3.0;
+              diag = (Lu(i,j,0)+Lu(i,j,1))/3.0;
             
-            // internal energy*rho
-            utemp(3) -= 0.5*(utemp(1)*utemp(1)+utemp(2)*utemp(2))/utemp(0);
+              // internal energy*rho
+              utemp(3) -= 0.5*(utemp(1)*utemp(1)+utemp(2)*utemp(2))/utemp(0);
             
-            Le(i,j,0) = (Le(i,j,0) - utemp(1)*utemp(3))/rsq;
-            Le(i,j,1) = (Le(i,j,1) - utemp(2)*utemp(3))/rsq;
+              Le(i,j,0) = (Le(i,j,0) - utemp(1)*utemp(3))/rsq;
+              Le(i,j,1) = (Le(i,j,1) - utemp(2)*utemp(3))/rsq;
             
-          }
-          else if(n_dims==3) {
+            }
+            else if(n_dims==3) {
             
-            Lu(i,j,0) -= (utemp(1)*utemp(1))/rsq;
-            Lu(i,j,1) -= (utemp(2)*utemp(2))/rsq;
-            Lu(i,j,2) -= (utemp(3)*utemp(3))/rsq;
-            Lu(i,j,3) -= (utemp(1)*utemp(2))/rsq;
-            Lu(i,j,4) -= (utemp(1)*utemp(3))/rsq;
-            Lu(i,j,5) -= (utemp(2)*utemp(3))/rsq;
+              Lu(i,j,0) -= (utemp(1)*utemp(1))/rsq;
+              Lu(i,j,1) -= (utemp(2)*utemp(2))/rsq;
+              Lu(i,j,2) -= (utemp(3)*utemp(3))/rsq;
+              Lu(i,j,3) -= (utemp(1)*utemp(2))/rsq;
+              Lu(i,j,4) -= (utemp(1)*utemp(3))/rsq;
+              Lu(i,j,5) -= (utemp(2)*utemp(3))/rsq;
             
-            diag = (Lu(i,j,0)+Lu(i,j,1)+Lu(i,j,2))/3.0;
+              diag = (Lu(i,j,0)+Lu(i,j,1)+Lu(i,j,2))/3.0;
             
-            // internal energy*rho
-            utemp(4) -= 0.5*(utemp(1)*utemp(1)+utemp(2)*utemp(2)+utemp(3)*utemp(3))/utemp(0);
+              // internal energy*rho
+              utemp(4) -= 0.5*(utemp(1)*utemp(1)+utemp(2)*utemp(2)+utemp(3)*utemp(3))/utemp(0);
             
-            Le(i,j,0) = (Le(i,j,0) - utemp(1)*utemp(4))/rsq;
-            Le(i,j,1) = (Le(i,j,1) - utemp(2)*utemp(4))/rsq;
-            Le(i,j,2) = (Le(i,j,2) - utemp(3)*utemp(4))/rsq;
+              Le(i,j,0) = (Le(i,j,0) - utemp(1)*utemp(4))/rsq;
+              Le(i,j,1) = (Le(i,j,1) - utemp(2)*utemp(4))/rsq;
+              Le(i,j,2) = (Le(i,j,2) - utemp(3)*utemp(4))/rsq;
             
-          }
+            }
           
-          /*! subtract diagonal from Lu */
-          for (k=0;k<n_dims;++k) Lu(i,j,k) -= diag;
+            /*! subtract diagonal from Lu */
+            for (k=0;k<n_dims;++k) Lu(i,j,k) -= diag;
           
+          }
         }
       }
     }
@@ -2319,123 +2920,172 @@ void eles::calc_sgs_terms(int in_disu_upts_from)
 // calculate transformed discontinuous viscous flux at solution points
 
 void eles::evaluate_viscFlux(int in_disu_upts_from)
+{
+  evaluate_viscFlux(in_disu_upts_from,0,n_eles);
+}
+
+void eles::evaluate_viscFlux(int in_disu_upts_from, int in_ele_start, int in_ele_end)
 {
   if (n_eles!=0)
   {
 #ifdef _CPU
+
+    // Batched flux over the element blocks of the AoSoA layout
+    if (upts_width>1 && !motion && LES == 0 && wall_model == 0) {
+      evaluate_flux_aosoa(in_disu_upts_from,true,in_ele_start,in_ele_end);
+      return;
+    }
     
     int i,j,k,l,m;
     double detjac;
 
-    for(i=0;i<n_eles;i++) {
-      
-      // Calculate viscous flux
-      for(j=0;j<n_upts_per_ele;j++)
-      {
-        detjac = detjac_upts(j,i);
-        
-        // solution in static-physical domain
-        for(k=0;k<n_fields;k++)
+#pragma omp parallel private(i,j,k,l,m,detjac)
+    {
+      // Scratch storage private to this thread
+      int thr = get_thread_num();
+      array<double>& temp_u = this->temp_u(thr);
+      array<double>& temp_grad_u = this->temp_grad_u(thr);
+      array<double>& temp_f = this->temp_f(thr);
+      array<double>& temp_f_ref = this->temp_f_ref(thr);
+      array<double>& temp_sgsf = this->temp_sgsf(thr);
+      array<double>& temp_sgsf_ref = this->temp_sgsf_ref(thr);
+      array<double>& temp_f_upts = this->temp_f_upts(thr);
+
+#pragma omp for schedule(static)
+      for(i=in_ele_start;i<in_ele_end;i++) {
+      
+        if (!motion && LES == 0 && wall_model == 0)
         {
-          temp_u(k)=disu_upts(in_disu_upts_from)(j,i,k);
-          
-          // gradient in dynamic-physical domain
-          for (m=0;m<n_dims;m++)
-          {
-            temp_grad_u(k,m) = grad_disu_upts(j,i,k,m);
-          }
-        }
+          // Batched viscous flux at all solution points of the element
+          if(n_dims==2)
+            calc_visf_2d_batch(n_upts_per_ele,n_fields,disu_upts(in_disu_upts_from).get_ptr_cpu(0,i,0),n_upts_ld*n_eles,grad_disu_upts.get_ptr_cpu(0,i,0,0),n_upts_ld*n_eles,temp_f_upts.get_ptr_cpu(),n_upts_per_ele);
+          else if(n_dims==3)
+            calc_visf_3d_batch(n_upts_per_ele,n_fields,disu_upts(in_disu_upts_from).get_ptr_cpu(0,i,0),n_upts_ld*n_eles,grad_disu_upts.get_ptr_cpu(0,i,0,0),n_upts_ld*n_eles,temp_f_upts.get_ptr_cpu(),n_upts_per_ele);
+          else
+            cout << "ERROR: Invalid number of dimensions ... " << endl;
 
-        // Transform to dynamic-physical domain
-        if (motion) {
-          for (k=0; k<n_fields; k++) {
-            temp_u(k) /= J_dyn_upts(j,i);
+          // Transform viscous flux
+          for(k=0;k<n_fields;k++) {
+            for(l=0;l<n_dims;l++) {
+              for(j=0;j<n_upts_per_ele;j++) {
+                for(m=0;m<n_dims;m++) {
+                  tdisf_upts(j,i,k,l)+=JGinv_upts(l,m,j,i)*temp_f_upts(j,k,m);
+                }
+              }
+            }
           }
         }
-
-        if(n_dims==2)
-        {
-          calc_visf_2d(temp_u,temp_grad_u,temp_f);
-        }
-        else if(n_dims==3)
-        {
-          calc_visf_3d(temp_u,temp_grad_u,temp_f);
-        }
         else
         {
-          cout << "ERROR: Invalid number of dimensions ... " << endl;
-        }
+          // Calculate viscous flux
+          for(j=0;j<n_upts_per_ele;j++)
+          {
+            detjac = detjac_upts(j,i);
+        
+            // solution in static-physical domain
+            for(k=0;k<n_fields;k++)
+            {
+              temp_u(k)=disu_upts(in_disu_upts_from)(j,i,k);
+          
+              // gradient in dynamic-physical domain
+              for (m=0;m<n_dims;m++)
+              {
+                temp_grad_u(k,m) = grad_disu_upts(j,i,k,m);
+              }
+            }
+
+            // Transform to dynamic-physical domain
+            if (motion) {
+              for (k=0; k<n_fields; k++) {
+                temp_u(k) /= J_dyn_upts(j,i);
+              }
+            }
+
+            if(n_dims==2)
+            {
+              calc_visf_2d(temp_u,temp_grad_u,temp_f);
+            }
+            else if(n_dims==3)
+            {
+              calc_visf_3d(temp_u,temp_grad_u,temp_f);
+            }
+            else
+            {
+              cout << "ERROR: Invalid number of dimensions ... " << endl;
+            }
         
-        // If LES or wall model, calculate SGS viscous flux
-        if(LES != 0 || wall_model != 0) {
+            // If LES or wall model, calculate SGS viscous flux
+            if(LES != 0 || wall_model != 0) {
           
-          calc_sgsf_upts(temp_u,temp_grad_u,detjac,i,j,temp_sgsf);
+              calc_sgsf_upts(temp_u,temp_grad_u,detjac,i,j,temp_sgsf);
           
-          // Add SGS or wall flux to viscous flux
-          for(k=0;k<n_fields;k++)
-            for(l=0;l<n_dims;l++)
-              temp_f(k,l) += temp_sgsf(k,l);
+              // Add SGS or wall flux to viscous flux
+              for(k=0;k<n_fields;k++)
+                for(l=0;l<n_dims;l++)
+                  temp_f(k,l) += temp_sgsf(k,l);
           
-        }
+            }
         
-        // If LES, add SGS flux to global array (needed for interface flux calc)
-        if(LES > 0) {
-
-          // Transfer back to static-phsycial domain
-          if (motion) {
-            temp_sgsf_ref.initialize_to_zero();
-            for(k=0;k<n_fields;k++) {
-              for(l=0;l<n_dims;l++) {
-                for(m=0;m<n_dims;m++) {
-                  temp_sgsf_ref(k,l)+=JGinv_dyn_upts(l,m,j,i)*temp_sgsf(k,m);
+            // If LES, add SGS flux to global array (needed for interface flux calc)
+            if(LES > 0) {
+
+              // Transfer back to static-phsycial domain
+              if (motion) {
+                temp_sgsf_ref.initialize_to_zero();
+                for(k=0;k<n_fields;k++) {
+                  for(l=0;l<n_dims;l++) {
+                    for(m=0;m<n_dims;m++) {
+                      temp_sgsf_ref(k,l)+=JGinv_dyn_upts(l,m,j,i)*temp_sgsf(k,m);
+                    }
+                  }
+                }
+                // Copy back to original flux array
+                for (k=0; k<n_fields; k++) {
+                  for(l=0; l<n_dims; l++) {
+                    temp_sgsf(k,l) = temp_sgsf_ref(k,l);
+                  }
                 }
               }
-            }
-            // Copy back to original flux array
-            for (k=0; k<n_fields; k++) {
-              for(l=0; l<n_dims; l++) {
-                temp_sgsf(k,l) = temp_sgsf_ref(k,l);
-              }
-            }
-          }
 
-          // Transfer back to computational domain
-          for(k=0;k<n_fields;k++) {
-            for(l=0;l<n_dims;l++) {
-              sgsf_upts(j,i,k,l) = 0.0;
-              for(m=0;m<n_dims;m++) {
-                sgsf_upts(j,i,k,l)+=JGinv_upts(l,m,j,i)*temp_sgsf(k,m);
+              // Transfer back to computational domain
+              for(k=0;k<n_fields;k++) {
+                for(l=0;l<n_dims;l++) {
+                  sgsf_upts(j,i,k,l) = 0.0;
+                  for(m=0;m<n_dims;m++) {
+                    sgsf_upts(j,i,k,l)+=JGinv_upts(l,m,j,i)*temp_sgsf(k,m);
+                  }
+                }
               }
             }
-          }
-        }
 
-        // Transfer back to static-phsycial domain
-        if (motion) {
-          temp_f_ref.initialize_to_zero();
-          for(k=0;k<n_fields;k++) {
-            for(l=0;l<n_dims;l++) {
-              for(m=0;m<n_dims;m++) {
-                temp_f_ref(k,l)+=JGinv_dyn_upts(l,m,j,i)*temp_f(k,m);
+            // Transfer back to static-phsycial domain
+            if (motion) {
+              temp_f_ref.initialize_to_zero();
+              for(k=0;k<n_fields;k++) {
+                for(l=0;l<n_dims;l++) {
+                  for(m=0;m<n_dims;m++) {
+                    temp_f_ref(k,l)+=JGinv_dyn_upts(l,m,j,i)*temp_f(k,m);
+                  }
+                }
+              }
+              // Copy back to original flux array
+              for(l=0; l<n_dims; l++) {
+                for (k=0; k<n_fields; k++) {
+                  temp_f(k,l) = temp_f_ref(k,l);
+                }
               }
             }
-          }
-          // Copy back to original flux array
-          for(l=0; l<n_dims; l++) {
-            for (k=0; k<n_fields; k++) {
-              temp_f(k,l) = temp_f_ref(k,l);
-            }
-          }
-        }
         
-        // Transform viscous flux
-        for(k=0;k<n_fields;k++)
-        {
-          for(l=0;l<n_dims;l++)
-          {
-            for(m=0;m<n_dims;m++)
+            // Transform viscous flux
+            for(k=0;k<n_fields;k++)
             {
-              tdisf_upts(j,i,k,l)+=JGinv_upts(l,m,j,i)*temp_f(k,m);
+              for(l=0;l<n_dims;l++)
+              {
+                for(m=0;m<n_dims;m++)
+                {
+                  tdisf_upts(j,i,k,l)+=JGinv_upts(l,m,j,i)*temp_f(k,m);
+                }
+              }
             }
           }
         }
@@ -2464,17 +3114,21 @@ void eles::calc_sgsf_upts(array<double>& temp_u, array<double>& temp_grad_u, dou
   double Pr=0.5; // turbulent Prandtl number
   double delta, mu, mu_t, vol;
   double rho, inte, rt_ratio;
-  array<double> u(n_dims);
-  array<double> drho(n_dims), dene(n_dims), dke(n_dims), de(n_dims);
-  array<double> dmom(n_dims,n_dims), du(n_dims,n_dims), S(n_dims,n_dims);
+
+  // storage for the temporary arrays below, so that no allocation is made per solution point
+  array_pool<double,96> pool;
+
+  array<double> u(pool.take(n_dims),n_dims);
+  array<double> drho(pool.take(n_dims),n_dims), dene(pool.take(n_dims),n_dims), dke(pool.take(n_dims),n_dims), de(pool.take(n_dims),n_dims);
+  array<double> dmom(pool.take(n_dims*n_dims),n_dims,n_dims), du(pool.take(n_dims*n_dims),n_dims,n_dims), S(pool.take(n_dims*n_dims),n_dims,n_dims);
   
   // quantities for wall model
-  array<double> norm(n_dims);
-  array<double> tau(n_dims,n_dims);
-  array<double> Mrot(n_dims,n_dims);
-  array<double> temp(n_dims,n_dims);
-  array<double> urot(n_dims);
-  array<double> tw(n_dims);
+  array<double> norm(pool.take(n_dims),n_dims);
+  array<double> tau(pool.take(n_dims*n_dims),n_dims,n_dims);
+  array<double> Mrot(pool.take(n_dims*n_dims),n_dims,n_dims);
+  array<double> temp(pool.take(n_dims*n_dims),n_dims,n_dims);
+  array<double> urot(pool.take(n_dims),n_dims);
+  array<double> tw(pool.take(n_dims),n_dims);
   double y, qw, utau, yplus;
   
   // primitive variables
@@ -2534,7 +3188,7 @@ void eles::calc_sgsf_upts(array<double>& temp_u, array<double>& temp_grad_u, dou
     qw = twall(upt,ele,n_fields-1);
     
     // Calculate local rotation matrix
-    Mrot = calc_rotation_matrix(norm);
+    calc_rotation_matrix(norm,Mrot);
     
     // Rotate velocity to surface
     if(n_dims==2) {
@@ -2706,7 +3360,7 @@ void eles::calc_sgsf_upts(array<double>& temp_u, array<double>& temp_grad_u, dou
         double num=0.0;
         double denom=0.0;
         double eps=1.e-12;
-        array<double> Sq(n_dims,n_dims);
+        array<double> Sq(pool.take(n_dims*n_dims),n_dims,n_dims);
         diag = 0.0;
         
         // Square of gradient tensor
@@ -2787,28 +3441,37 @@ void eles::calc_src_upts_SA(int in_disu_upts_from)
 
     int i,j,k,l,m;
 
-    for(i=0; i<n_eles; i++) {
-      for(j=0; j<n_upts_per_ele; j++) {
+#pragma omp parallel private(i,j,k,l,m)
+    {
+      // Scratch storage private to this thread
+      int thr = get_thread_num();
+      array<double>& temp_u = this->temp_u(thr);
+      array<double>& temp_grad_u = this->temp_grad_u(thr);
 
-        // physical solution
-        for(k=0; k<n_fields; k++) {
-          temp_u(k)=disu_upts(in_disu_upts_from)(j,i,k);
-        }
+#pragma omp for schedule(static)
+      for(i=0; i<n_eles; i++) {
+        for(j=0; j<n_upts_per_ele; j++) {
 
-        // physical gradient
-        for(k=0; k<n_fields; k++) {
-          for (m=0; m<n_dims; m++) {
-            temp_grad_u(k,m) = grad_disu_upts(j,i,k,m);
+          // physical solution
+          for(k=0; k<n_fields; k++) {
+            temp_u(k)=disu_upts(in_disu_upts_from)(j,i,k);
           }
-        }
 
-        // source term
-        if(n_dims==2)
-          calc_source_SA_2d(temp_u, temp_grad_u, wall_distance_mag(j,i), src_upts(j,i,n_fields-1));
-        else if(n_dims==3)
-          calc_source_SA_3d(temp_u, temp_grad_u, wall_distance_mag(j,i), src_upts(j,i,n_fields-1));
-        else
-          cout << "ERROR: Invalid number of dimensions ... " << endl;
+          // physical gradient
+          for(k=0; k<n_fields; k++) {
+            for (m=0; m<n_dims; m++) {
+              temp_grad_u(k,m) = grad_disu_upts(j,i,k,m);
+            }
+          }
+
+          // source term
+          if(n_dims==2)
+            calc_source_SA_2d(temp_u, temp_grad_u, wall_distance_mag(j,i), src_upts(j,i,n_fields-1));
+          else if(n_dims==3)
+            calc_source_SA_3d(temp_u, temp_grad_u, wall_distance_mag(j,i), src_upts(j,i,n_fields-1));
+          else
+            cout << "ERROR: Invalid number of dimensions ... " << endl;
+        }
       }
     }
 
@@ -3034,9 +3697,8 @@ void eles::calc_wall_distance_parallel(array<int> n_seg_inters_array, array<int>
 
 #endif
 
-array<double> eles::calc_rotation_matrix(array<double>& norm)
+void eles::calc_rotation_matrix(array<double>& norm, array<double>& mrot)
 {
-  array <double> mrot(n_dims,n_dims);
   double nn;
   
   // Create rotation matrix
@@ -3082,8 +3744,6 @@ array<double> eles::calc_rotation_matrix(array<double>& norm)
       mrot(2,2) = -nn;
     }
   }
-  
-  return mrot;
 }
 
 void eles::calc_wall_stress(double rho, array<double>& urot, double ene, double mu, double Pr, double gamma, double y, array<double>& tau_wall, double q_wall)
@@ -3292,6 +3952,11 @@ double eles::wallfn_br(double yplus, double A, double B, double E, double kappa)
 
 /*! Calculate SGS flux at solution points */
 void eles::evaluate_sgsFlux(void)
+{
+  evaluate_sgsFlux(0,n_eles);
+}
+
+void eles::evaluate_sgsFlux(int in_ele_start, int in_ele_end)
 {
   if (n_eles!=0) {
     
@@ -3316,30 +3981,23 @@ void eles::evaluate_sgsFlux(void)
     
 #ifdef _CPU
     
-    if(opp_0_sparse==0) // dense
+    if(collocated_fpts) // flux points coincide with solution points
     {
-#if defined _ACCELERATE_BLAS || defined _MKL_BLAS || defined _STANDARD_BLAS
-      
       for (int i=0;i<n_dims;i++) {
-        cblas_dgemm(CblasColMajor,CblasNoTrans,CblasNoTrans,Arows,Bcols,Acols,1.0,opp_0.get_ptr_cpu(),Astride,sgsf_upts.get_ptr_cpu(0,0,0,i),Bstride,0.0,sgsf_fpts.get_ptr_cpu(0,0,0,i),Cstride);
+        gather_fpts(fpt_upt.get_ptr_cpu(),n_fpts_per_ele,sgsf_upts.get_ptr_cpu(0,0,0,i),n_upts_per_ele,sgsf_fpts.get_ptr_cpu(0,0,0,i),n_eles,n_fields,in_ele_start,in_ele_end);
       }
-      
-#elif defined _NO_BLAS
+    }
+    else if(opp_0_sparse==0 || opp_0_sparse==1 || opp_0_sparse==3) // dense, mkl blas four-array csr format or packed dense
+    {
       for (int i=0;i<n_dims;i++) {
-        dgemm(Arows,Bcols,Acols,1.0,0.0,opp_0.get_ptr_cpu(),sgsf_upts.get_ptr_cpu(0,0,0,i),sgsf_fpts.get_ptr_cpu(0,0,0,i));
+        apply_opp(opp_0_sparse,opp_0,opp_0_data,opp_0_cols,opp_0_b,opp_0_e,sgsf_upts.get_ptr_cpu(0,0,0,i),n_upts_per_ele,0.0,sgsf_fpts.get_ptr_cpu(0,0,0,i),n_fpts_per_ele,in_ele_start,in_ele_end);
       }
-      
-#endif
     }
-    else if(opp_0_sparse==1) // mkl blas four-array csr format
+    else if(opp_0_sparse==2) // sum-factorized tensor product
     {
-#if defined _MKL_BLAS
-      
       for (int i=0;i<n_dims;i++) {
-        mkl_dcsrmm(&transa, &n_fpts_per_ele, &n_fields_mul_n_eles, &n_upts_per_ele, &one, matdescra, opp_0_data.get_ptr_cpu(), opp_0_cols.get_ptr_cpu(), opp_0_b.get_ptr_cpu(), opp_0_e.get_ptr_cpu(), sgsf_upts.get_ptr_cpu(0,0,0,i), &n_upts_per_ele, &zero, sgsf_fpts.get_ptr_cpu(0,0,0,i), &n_fpts_per_ele);
+        apply_tensor_extrap(opp_0_tensor,sgsf_upts.get_ptr_cpu(0,0,0,i),n_upts_per_ele,0,sgsf_fpts.get_ptr_cpu(0,0,0,i),in_ele_start,in_ele_end);
       }
-      
-#endif
     }
     else { cout << "ERROR: Unknown storage for opp_0 ... " << endl; }
     
@@ -3377,14 +4035,14 @@ void eles::shock_capture_concentration(int in_disu_upts_from)
     #endif
 
     #ifdef _CPU
-        shock_capture_concentration_cpu(n_eles, n_upts_per_ele, n_fields, order, ele_type, run_input.artif_type, run_input.s0, run_input.kappa, disu_upts(in_disu_upts_from).get_ptr_cpu(), inv_vandermonde.get_ptr_cpu(), inv_vandermonde2D.get_ptr_cpu(), vandermonde2D.get_ptr_cpu(), concentration_array.get_ptr_cpu(), sensor.get_ptr_cpu(), sigma.get_ptr_cpu());
+        shock_capture_concentration_cpu(n_eles, n_upts_per_ele, n_upts_ld, n_fields, order, ele_type, run_input.artif_type, run_input.s0, run_input.kappa, disu_upts(in_disu_upts_from).get_ptr_cpu(), inv_vandermonde.get_ptr_cpu(), inv_vandermonde2D.get_ptr_cpu(), vandermonde2D.get_ptr_cpu(), concentration_array.get_ptr_cpu(), sensor.get_ptr_cpu(), sigma.get_ptr_cpu());
     #endif
   }
 }
 
-void eles::shock_capture_concentration_cpu(int in_n_eles, int in_n_upts_per_ele, int in_n_fields, int in_order, int in_ele_type, int in_artif_type, double s0, double kappa, double* in_disu_upts_ptr, double* in_inv_vandermonde_ptr, double* in_inv_vandermonde2D_ptr, double* in_vandermonde2D_ptr, double* concentration_array_ptr, double* out_sensor, double* sigma)
+void eles::shock_capture_concentration_cpu(int in_n_eles, int in_n_upts_per_ele, int in_ld, int in_n_fields, int in_order, int in_ele_type, int in_artif_type, double s0, double kappa, double* in_disu_upts_ptr, double* in_inv_vandermonde_ptr, double* in_inv_vandermonde2D_ptr, double* in_vandermonde2D_ptr, double* concentration_array_ptr, double* out_sensor, double* sigma)
 {
-    int stride = in_n_upts_per_ele*in_n_eles;
+    int stride = in_ld*in_n_eles;
     double tmp_sensor = 0;
 
     double nodal_rho[8];  // Array allocated so that it can handle upto p=7
@@ -3403,7 +4061,7 @@ void eles::shock_capture_concentration_cpu(int in_n_eles, int in_n_upts_per_ele,
             for(int i=0; i<in_order+1; i++)
             {
                 for(int j=0; j<in_order+1; j++){
-                    nodal_rho[j] = in_disu_upts_ptr[m*in_n_upts_per_ele + i*(in_order+1) + j];
+                    nodal_rho[j] = in_disu_upts_ptr[m*in_ld + i*(in_order+1) + j];
                 }
 
                 for(int j=0; j<in_order+1; j++){
@@ -3434,7 +4092,7 @@ void eles::shock_capture_concentration_cpu(int in_n_eles, int in_n_upts_per_ele,
             for(int i=0; i<in_order+1; i++)
             {
                 for(int j=0; j<in_order+1; j++){
-                    nodal_rho[j] = in_disu_upts_ptr[m*in_n_upts_per_ele + j*(in_order+1) + i];
+                    nodal_rho[j] = in_disu_upts_ptr[m*in_ld + j*(in_order+1) + i];
                 }
 
                 for(int j=0; j<in_order+1; j++){
@@ -3471,7 +4129,7 @@ void eles::shock_capture_concentration_cpu(int in_n_eles, int in_n_upts_per_ele,
                 for(int k=0; k<in_n_fields; k++) {
 
                     for(int i=0; i<in_n_upts_per_ele; i++){
-                        nodal_sol[i] = in_disu_upts_ptr[m*in_n_upts_per_ele + k*stride + i];
+                        nodal_sol[i] = in_disu_upts_ptr[m*in_ld + k*stride + i];
                     }
 
                     // Nodal to modal only upto 1st order
@@ -3490,7 +4148,7 @@ void eles::shock_capture_concentration_cpu(int in_n_eles, int in_n_upts_per_ele,
                         for(int j=0; j<in_n_upts_per_ele; j++)
                             nodal_sol[i] += in_vandermonde2D_ptr[i + j*in_n_upts_per_ele]*modal_sol[j];
 
-                        in_disu_upts_ptr[m*in_n_upts_per_ele + k*stride + i] = nodal_sol[i];
+                        in_disu_upts_ptr[m*in_ld + k*stride + i] = nodal_sol[i];
                     }
                 }
             }
@@ -3512,6 +4170,25 @@ int eles::get_n_eles(void)
   return n_eles;
 }
 
+// get number of flux points per element
+
+int eles::get_n_fpts_per_ele(void)
+{
+  return n_fpts_per_ele;
+}
+
+// get the first flux point of a local interface
+
+int eles::get_first_fpt(int in_ele_local_inter)
+{
+  int fpt=0;
+
+  for(int i=0;i<in_ele_local_inter;i++)
+    fpt+=n_fpts_per_inter(i);
+
+  return fpt;
+}
+
 // get number of ppts_per_ele
 int eles::get_n_ppts_per_ele(void)
 {
@@ -3625,8 +4302,9 @@ void eles::set_opp_0(int in_sparse)
   
   opp_0.setup(n_fpts_per_ele,n_upts_per_ele);
   
-  for(i=0;i<n_upts_per_ele;i++)
+  if(!cached_opps.get("opp_0",opp_0))
   {
+    // all basis functions at one location, so the orthonormal basis there is evaluated once
     for(j=0;j<n_fpts_per_ele;j++)
     {
       for(k=0;k<n_dims;k++)
@@ -3634,8 +4312,12 @@ void eles::set_opp_0(int in_sparse)
         loc(k)=tloc_fpts(k,j);
       }
       
-      opp_0(j,i)=eval_nodal_basis(i,loc);
+      for(i=0;i<n_upts_per_ele;i++)
+      {
+        opp_0(j,i)=eval_nodal_basis(i,loc);
+      }
     }
+    cached_opps.put("opp_0",opp_0);
   }
   
 #ifdef _GPU
@@ -3646,7 +4328,12 @@ void eles::set_opp_0(int in_sparse)
   //cout << "ele_type=" << ele_type << endl;
   //opp_0.print();
   //cout << endl;
+
+  set_fpt_upt();
   
+  if(in_sparse==4) // automatic
+    in_sparse=select_opp_sparse("opp_0",&opp_0,1);
+
   if(in_sparse==0)
   {
     opp_0_sparse=0;
@@ -3666,6 +4353,19 @@ void eles::set_opp_0(int in_sparse)
 #endif
     
   }
+  else if(in_sparse==3) // dense, packed for the small matrix multiply
+  {
+    opp_0_sparse=3;
+
+#ifdef _CPU
+    opp_0_data.setup(get_small_gemm_size(n_fpts_per_ele,n_upts_per_ele));
+    pack_small_gemm(opp_0.get_ptr_cpu(),n_fpts_per_ele,n_upts_per_ele,opp_0_data.get_ptr_cpu());
+#endif
+  }
+  else if(in_sparse==2) // sum-factorized, see set_opp_tensor
+  {
+    opp_0_sparse=2;
+  }
   else
   {
     cout << "ERROR: Invalid sparse matrix form ... " << endl;
@@ -3683,12 +4383,16 @@ void eles::set_opp_1(int in_sparse)
   array<double> loc(n_dims);
   
   opp_1.setup(n_dims);
+  opp_1_data.setup(n_dims);
+  opp_1_cols.setup(n_dims);
+  opp_1_b.setup(n_dims);
+  opp_1_e.setup(n_dims);
   for (int i=0;i<n_dims;i++)
     opp_1(i).setup(n_fpts_per_ele,n_upts_per_ele);
   
-  for(i=0;i<n_dims;i++)
+  if(!cached_opps.get("opp_1",opp_1))
   {
-    for(j=0;j<n_upts_per_ele;j++)
+    for(i=0;i<n_dims;i++)
     {
       for(k=0;k<n_fpts_per_ele;k++)
       {
@@ -3697,13 +4401,17 @@ void eles::set_opp_1(int in_sparse)
           loc(l)=tloc_fpts(l,k);
         }
         
-        opp_1(i)(k,j)=eval_nodal_basis(j,loc)*tnorm_fpts(i,k);
+        for(j=0;j<n_upts_per_ele;j++)
+        {
+          opp_1(i)(k,j)=eval_nodal_basis(j,loc)*tnorm_fpts(i,k);
+        }
       }
+      //cout << "opp_1,i =" << i << endl;
+      //cout << "ele_type=" << ele_type << endl;
+      //opp_1(i).print();
+      //cout << endl;
     }
-    //cout << "opp_1,i =" << i << endl;
-    //cout << "ele_type=" << ele_type << endl;
-    //opp_1(i).print();
-    //cout << endl;
+    cached_opps.put("opp_1",opp_1);
   }
   
 #ifdef _GPU
@@ -3712,6 +4420,9 @@ void eles::set_opp_1(int in_sparse)
 #endif
   
   
+  if(in_sparse==4) // automatic
+    in_sparse=select_opp_sparse("opp_1",opp_1.get_ptr_cpu(),n_dims);
+
   if(in_sparse==0)
   {
     opp_1_sparse=0;
@@ -3738,6 +4449,19 @@ void eles::set_opp_1(int in_sparse)
 #endif
     
   }
+  else if(in_sparse==3) // dense, packed for the small matrix multiply
+  {
+    opp_1_sparse=3;
+
+#ifdef _CPU
+    // all dimensions side by side, to extrapolate the flux of every dimension in one pass
+    pack_opp_stacked(opp_1.get_ptr_cpu(),n_dims,opp_1_stacked);
+#endif
+  }
+  else if(in_sparse==2) // sum-factorized, see set_opp_tensor
+  {
+    opp_1_sparse=2;
+  }
   else
   {
     cout << "ERROR: Invalid sparse matrix form ... " << endl;
@@ -3754,12 +4478,16 @@ void eles::set_opp_2(int in_sparse)
   array<double> loc(n_dims);
   
   opp_2.setup(n_dims);
+  opp_2_data.setup(n_dims);
+  opp_2_cols.setup(n_dims);
+  opp_2_b.setup(n_dims);
+  opp_2_e.setup(n_dims);
   for (int i=0;i<n_dims;i++)
     opp_2(i).setup(n_upts_per_ele,n_upts_per_ele);
   
-  for(i=0;i<n_dims;i++)
+  if(!cached_opps.get("opp_2",opp_2))
   {
-    for(j=0;j<n_upts_per_ele;j++)
+    for(i=0;i<n_dims;i++)
     {
       for(k=0;k<n_upts_per_ele;k++)
       {
@@ -3768,18 +4496,22 @@ void eles::set_opp_2(int in_sparse)
           loc(l)=loc_upts(l,k);
         }
         
-        opp_2(i)(k,j)=eval_d_nodal_basis(j,i,loc);
+        for(j=0;j<n_upts_per_ele;j++)
+        {
+          opp_2(i)(k,j)=eval_d_nodal_basis(j,i,loc);
+        }
       }
-    }
     
-    //cout << "opp_2,i =" << i << endl;
-    //cout << "ele_type=" << ele_type << endl;
-    //opp_2(i).print();
-    //cout << endl;
+      //cout << "opp_2,i =" << i << endl;
+      //cout << "ele_type=" << ele_type << endl;
+      //opp_2(i).print();
+      //cout << endl;
     
-    //cout << "opp_2,i=" << i << endl;
-    //opp_2(i).print();
+      //cout << "opp_2,i=" << i << endl;
+      //opp_2(i).print();
     
+    }
+    cached_opps.put("opp_2",opp_2);
   }
   
 #ifdef _GPU
@@ -3790,6 +4522,9 @@ void eles::set_opp_2(int in_sparse)
   //cout << "opp 2" << endl;
   //opp_2.print();
   
+  if(in_sparse==4) // automatic
+    in_sparse=select_opp_sparse("opp_2",opp_2.get_ptr_cpu(),n_dims);
+
   if(in_sparse==0)
   {
     opp_2_sparse=0;
@@ -3815,6 +4550,19 @@ void eles::set_opp_2(int in_sparse)
     }
 #endif
   }
+  else if(in_sparse==3) // dense, packed for the small matrix multiply
+  {
+    opp_2_sparse=3;
+
+#ifdef _CPU
+    // all dimensions side by side, to take the divergence of the flux of every dimension in one pass
+    pack_opp_stacked(opp_2.get_ptr_cpu(),n_dims,opp_2_stacked);
+#endif
+  }
+  else if(in_sparse==2) // sum-factorized, see set_opp_tensor
+  {
+    opp_2_sparse=2;
+  }
   else
   {
     cout << "ERROR: Invalid sparse matrix form ... " << endl;
@@ -3827,7 +4575,11 @@ void eles::set_opp_3(int in_sparse)
 {
   
   opp_3.setup(n_upts_per_ele,n_fpts_per_ele);
-  (*this).fill_opp_3(opp_3);
+  if(!cached_opps.get("opp_3",opp_3))
+  {
+    (*this).fill_opp_3(opp_3);
+    cached_opps.put("opp_3",opp_3);
+  }
   
   //cout << "OPP_3" << endl;
   //cout << "ele_type=" << ele_type << endl;
@@ -3838,6 +4590,9 @@ void eles::set_opp_3(int in_sparse)
   opp_3.cp_cpu_gpu();
 #endif
   
+  if(in_sparse==4) // automatic
+    in_sparse=select_opp_sparse("opp_3",&opp_3,1);
+
   if(in_sparse==0)
   {
     opp_3_sparse=0;
@@ -3856,6 +4611,19 @@ void eles::set_opp_3(int in_sparse)
     opp_3_ell_indices.cp_cpu_gpu();
 #endif
   }
+  else if(in_sparse==3) // dense, packed for the small matrix multiply
+  {
+    opp_3_sparse=3;
+
+#ifdef _CPU
+    opp_3_data.setup(get_small_gemm_size(n_upts_per_ele,n_fpts_per_ele));
+    pack_small_gemm(opp_3.get_ptr_cpu(),n_upts_per_ele,n_fpts_per_ele,opp_3_data.get_ptr_cpu());
+#endif
+  }
+  else if(in_sparse==2) // sum-factorized, see set_opp_tensor
+  {
+    opp_3_sparse=2;
+  }
   else
   {
     cout << "ERROR: Invalid sparse matrix form ... " << endl;
@@ -3871,184 +4639,909 @@ void eles::set_opp_4(int in_sparse)
   array<double> loc(n_dims);
   
   opp_4.setup(n_dims);
+  opp_4_data.setup(n_dims);
+  opp_4_cols.setup(n_dims);
+  opp_4_b.setup(n_dims);
+  opp_4_e.setup(n_dims);
   for (int i=0;i<n_dims;i++)
     opp_4(i).setup(n_upts_per_ele, n_upts_per_ele);
   
-  for(i=0; i<n_dims; i++)
+  if(!cached_opps.get("opp_4",opp_4))
   {
-    for(j=0; j<n_upts_per_ele; j++)
+    for(i=0; i<n_dims; i++)
     {
       for(k=0; k<n_upts_per_ele; k++)
       {
-        for(l=0; l<n_dims; l++)
+        for(l=0; l<n_dims; l++)
+        {
+          loc(l)=loc_upts(l,k);
+        }
+        
+        for(j=0; j<n_upts_per_ele; j++)
+        {
+          opp_4(i)(k,j) = eval_d_nodal_basis(j,i,loc);
+        }
+      }
+    }
+    cached_opps.put("opp_4",opp_4);
+  }
+  
+#ifdef _GPU
+  for (int i=0;i<n_dims;i++)
+    opp_4(i).cp_cpu_gpu();
+#endif
+  
+  if(in_sparse==4) // automatic
+    in_sparse=select_opp_sparse("opp_4",opp_4.get_ptr_cpu(),n_dims);
+
+  if(in_sparse==0)
+  {
+    opp_4_sparse=0;
+  }
+  else if(in_sparse==1)
+  {
+    opp_4_sparse=1;
+    
+#ifdef _CPU
+    for (int i=0;i<n_dims;i++)
+    {
+      array_to_mklcsr(opp_4(i),opp_4_data(i),opp_4_cols(i),opp_4_b(i),opp_4_e(i));
+    }
+#endif
+    
+#ifdef _GPU
+    opp_4_ell_data.setup(n_dims);
+    opp_4_ell_indices.setup(n_dims);
+    opp_4_nnz_per_row.setup(n_dims);
+    for (int i=0;i<n_dims;i++) {
+      array_to_ellpack(opp_4(i), opp_4_ell_data(i), opp_4_ell_indices(i), opp_4_nnz_per_row(i));
+      opp_4_ell_data(i).cp_cpu_gpu();
+      opp_4_ell_indices(i).cp_cpu_gpu();
+    }
+#endif
+  }
+  else if(in_sparse==3) // dense, packed for the small matrix multiply
+  {
+    opp_4_sparse=3;
+
+#ifdef _CPU
+    for (int i=0;i<n_dims;i++) {
+      opp_4_data(i).setup(get_small_gemm_size(n_upts_per_ele,n_upts_per_ele));
+      pack_small_gemm(opp_4(i).get_ptr_cpu(),n_upts_per_ele,n_upts_per_ele,opp_4_data(i).get_ptr_cpu());
+    }
+#endif
+  }
+  else if(in_sparse==2) // sum-factorized, see set_opp_tensor
+  {
+    opp_4_sparse=2;
+  }
+  else
+  {
+    cout << "ERROR: Invalid sparse matrix form ... " << endl;
+  }
+}
+
+// transformed solution correction at flux points to transformed gradient correction at solution points
+
+void eles::set_opp_5(int in_sparse)
+{
+  int i,j,k,l;
+  
+  array<double> loc(n_dims);
+  
+  opp_5.setup(n_dims);
+  opp_5_data.setup(n_dims);
+  opp_5_cols.setup(n_dims);
+  opp_5_b.setup(n_dims);
+  opp_5_e.setup(n_dims);
+  for (int i=0;i<n_dims;i++)
+    opp_5(i).setup(n_upts_per_ele, n_fpts_per_ele);
+
+  for(i=0;i<n_dims;i++)
+  {
+    for(j=0;j<n_fpts_per_ele;j++)
+    {
+      for(k=0;k<n_upts_per_ele;k++)
+      {
+        /*
+         for(l=0;l<n_dims;l++)
+         {
+         loc(l)=loc_upts(l,k);
+         }
+         */
+        
+        //opp_5(i)(k,j) = eval_div_vcjh_basis(j,loc)*tnorm_fpts(i,j);
+        opp_5(i)(k,j) = opp_3(k,j)*tnorm_fpts(i,j);
+      }
+    }
+  }
+  
+#ifdef _GPU
+  for (int i=0;i<n_dims;i++)
+    opp_5(i).cp_cpu_gpu();
+#endif
+  
+  //cout << "opp_5" << endl;
+  //opp_5.print();
+  
+  if(in_sparse==4) // automatic
+    in_sparse=select_opp_sparse("opp_5",opp_5.get_ptr_cpu(),n_dims);
+
+  if(in_sparse==0)
+  {
+    opp_5_sparse=0;
+  }
+  else if(in_sparse==1)
+  {
+    opp_5_sparse=1;
+    
+#ifdef _CPU
+    for (int i=0;i<n_dims;i++) {
+      array_to_mklcsr(opp_5(i),opp_5_data(i),opp_5_cols(i),opp_5_b(i),opp_5_e(i));
+    }
+#endif
+    
+#ifdef _GPU
+    opp_5_ell_data.setup(n_dims);
+    opp_5_ell_indices.setup(n_dims);
+    opp_5_nnz_per_row.setup(n_dims);
+    for (int i=0;i<n_dims;i++) {
+      array_to_ellpack(opp_5(i), opp_5_ell_data(i), opp_5_ell_indices(i), opp_5_nnz_per_row(i));
+      opp_5_ell_data(i).cp_cpu_gpu();
+      opp_5_ell_indices(i).cp_cpu_gpu();
+    }
+#endif
+  }
+  else if(in_sparse==3) // dense, packed for the small matrix multiply
+  {
+    opp_5_sparse=3;
+
+#ifdef _CPU
+    for (int i=0;i<n_dims;i++) {
+      opp_5_data(i).setup(get_small_gemm_size(n_upts_per_ele,n_fpts_per_ele));
+      pack_small_gemm(opp_5(i).get_ptr_cpu(),n_upts_per_ele,n_fpts_per_ele,opp_5_data(i).get_ptr_cpu());
+    }
+#endif
+  }
+  else if(in_sparse==2) // sum-factorized, see set_opp_tensor
+  {
+    opp_5_sparse=2;
+  }
+  else
+  {
+    cout << "ERROR: Invalid sparse matrix form ... " << endl;
+  }
+}
+
+// transformed gradient at solution points to transformed gradient at flux points
+
+void eles::set_opp_6(int in_sparse)
+{
+  int i,j,k,l,m;
+  
+  array<double> loc(n_dims);
+  
+  opp_6.setup(n_fpts_per_ele, n_upts_per_ele);
+  
+  if(!cached_opps.get("opp_6",opp_6))
+  {
+    for(l=0; l<n_fpts_per_ele; l++)
+    {
+      for(m=0; m<n_dims; m++)
+      {
+        loc(m) = tloc_fpts(m,l);
+      }
+      for(j=0; j<n_upts_per_ele; j++)
+      {
+        opp_6(l,j) = eval_nodal_basis(j,loc);
+      }
+    }
+    cached_opps.put("opp_6",opp_6);
+  }
+  
+  //cout << "opp_6" << endl;
+  //opp_6.print();
+  
+#ifdef _GPU
+  opp_6.cp_cpu_gpu();
+#endif
+  
+  if(in_sparse==4) // automatic
+    in_sparse=select_opp_sparse("opp_6",&opp_6,1);
+
+  if(in_sparse==0)
+  {
+    opp_6_sparse=0;
+  }
+  else if(in_sparse==1)
+  {
+    opp_6_sparse=1;
+    
+#ifdef _CPU
+    array_to_mklcsr(opp_6,opp_6_data,opp_6_cols,opp_6_b,opp_6_e);
+#endif
+    
+#ifdef _GPU
+    array_to_ellpack(opp_6, opp_6_ell_data, opp_6_ell_indices, opp_6_nnz_per_row);
+    opp_6_ell_data.cp_cpu_gpu();
+    opp_6_ell_indices.cp_cpu_gpu();
+#endif
+    
+  }
+  else if(in_sparse==3) // dense, packed for the small matrix multiply
+  {
+    opp_6_sparse=3;
+
+#ifdef _CPU
+    opp_6_data.setup(get_small_gemm_size(n_fpts_per_ele,n_upts_per_ele));
+    pack_small_gemm(opp_6.get_ptr_cpu(),n_fpts_per_ele,n_upts_per_ele,opp_6_data.get_ptr_cpu());
+#endif
+  }
+  else if(in_sparse==2) // sum-factorized, see set_opp_tensor
+  {
+    opp_6_sparse=2;
+  }
+  else
+  {
+    cout << "ERROR: Invalid sparse matrix form ... " << endl;
+  }
+}
+
+// multiply the columns of elements in_ele_start to in_ele_end-1 by a dense, csr or packed dense operator,
+// C = A*B + beta*C. Columns of B and C are in_ld and out_ld apart, which is more than the operator size if they are padded
+
+void eles::apply_opp(int in_sparse, array<double>& in_opp, array<double>& in_data, array<int>& in_cols, array<int>& in_b, array<int>& in_e, double* in_ptr, int in_ld, double in_beta, double* out_ptr, int out_ld, int in_ele_start, int in_ele_end)
+{
+  int n_cols, n_blocks;
+
+  // with all elements, the columns of every field form one block
+  if(in_ele_start==0 && in_ele_end==n_eles)
+  {
+    n_cols=n_fields*n_eles;
+    n_blocks=1;
+  }
+  else
+  {
+    n_cols=in_ele_end-in_ele_start;
+    n_blocks=n_fields;
+  }
+
+  if(in_sparse==0 && run_input.precision==1)
+  {
+    apply_opp_single(in_opp,in_ptr,in_ld,in_beta,out_ptr,out_ld,in_ele_start,in_ele_end);
+    return;
+  }
+
+  for(int k=0;k<n_blocks;k++)
+    apply_opp_cols(in_sparse,in_opp,in_data,in_cols,in_b,in_e,n_cols,in_ptr+(k*n_eles+in_ele_start)*in_ld,in_ld,in_beta,out_ptr+(k*n_eles+in_ele_start)*out_ld,out_ld);
+}
+
+// multiply in_n_cols consecutive columns by an operator in storage in_sparse, in double precision
+
+void eles::apply_opp_cols(int in_sparse, array<double>& in_opp, array<double>& in_data, array<int>& in_cols, array<int>& in_b, array<int>& in_e, int in_n_cols, double* in_ptr, int in_ld, double in_beta, double* out_ptr, int out_ld)
+{
+  int n_rows=in_opp.get_dim(0);
+  int n_inner=in_opp.get_dim(1);
+
+  if(in_sparse==0) // dense
+  {
+#if defined _ACCELERATE_BLAS || defined _MKL_BLAS || defined _STANDARD_BLAS
+    cblas_dgemm(CblasColMajor,CblasNoTrans,CblasNoTrans,n_rows,in_n_cols,n_inner,1.0,in_opp.get_ptr_cpu(),n_rows,in_ptr,in_ld,in_beta,out_ptr,out_ld);
+
+#elif defined _NO_BLAS
+    dgemm(n_rows,in_n_cols,n_inner,1.0,in_beta,in_opp.get_ptr_cpu(),n_rows,in_ptr,in_ld,out_ptr,out_ld);
+
+#endif
+  }
+  else if(in_sparse==1) // four-array csr format
+  {
+#if defined _MKL_BLAS
+    mkl_dcsrmm(&transa,&n_rows,&in_n_cols,&n_inner,&one,matdescra,in_data.get_ptr_cpu(),in_cols.get_ptr_cpu(),in_b.get_ptr_cpu(),in_e.get_ptr_cpu(),in_ptr,&in_ld,&in_beta,out_ptr,&out_ld);
+
+#else
+    csr_opp(in_data.get_ptr_cpu(),in_cols.get_ptr_cpu(),in_b.get_ptr_cpu(),in_e.get_ptr_cpu(),n_rows,in_ptr,in_ld,in_n_cols,in_beta,out_ptr,out_ld);
+
+#endif
+  }
+  else if(in_sparse==3) // dense, packed for the small matrix multiply
+  {
+    get_small_gemm_kernel(n_rows)(in_data.get_ptr_cpu(),n_rows,n_inner,in_ptr,in_ld,in_n_cols,in_beta,out_ptr,out_ld);
+  }
+  else
+  {
+    cout << "ERROR: Unknown storage for operator ... " << endl;
+  }
+}
+
+// find whether opp_0 only selects solution point values, as when the flux points of quads and hexas lie on Gauss-Lobatto
+// solution points, and if so the solution point at each flux point. The extrapolations by opp_0 and opp_6 are then copies
+
+void eles::set_fpt_upt(void)
+{
+  collocated_fpts=0;
+  fpt_upt.setup(n_fpts_per_ele);
+
+  for(int j=0;j<n_fpts_per_ele;j++)
+  {
+    int n_ones=0;
+
+    for(int i=0;i<n_upts_per_ele;i++)
+    {
+      if(fabs(opp_0(j,i)-1.)<1e-12)
+      {
+        fpt_upt(j)=i;
+        n_ones++;
+      }
+      else if(fabs(opp_0(j,i))>1e-12)
+        return;
+    }
+
+    if(n_ones!=1)
+      return;
+  }
+
+  collocated_fpts=1;
+}
+
+// pack the in_n_opps operators at in_opp side by side for stacked_opp, as one operator with in_n_opps times the columns
+
+void eles::pack_opp_stacked(array<double>* in_opp, int in_n_opps, array<double>& out_packed)
+{
+  int n_rows=in_opp[0].get_dim(0);
+  int n_inner=in_opp[0].get_dim(1);
+
+  array<double> opp_side(n_rows,n_inner*in_n_opps);
+
+  for(int m=0;m<in_n_opps;m++)
+    for(int l=0;l<n_inner;l++)
+      for(int i=0;i<n_rows;i++)
+        opp_side(i,l+n_inner*m)=in_opp[m](i,l);
+
+  out_packed.setup(get_small_gemm_size(n_rows,n_inner*in_n_opps));
+  pack_small_gemm(opp_side.get_ptr_cpu(),n_rows,n_inner*in_n_opps,out_packed.get_ptr_cpu());
+}
+
+// choose the storage of operators in_opp(0..in_n_opps-1) for sparse_* 4. The dense, csr and packed dense forms are
+// timed on the columns of all elements in double precision, the csr form only if at most half of the entries are
+// non-zero, and the fastest is returned. The operators are left in the form chosen by the set_opp_* method
+
+int eles::select_opp_sparse(const char* in_name, array<double>* in_opp, int in_n_opps)
+{
+  int n_cols=n_fields*n_eles;
+  int nnz=0, n_entries=0, n_max=0;
+
+  for(int m=0;m<in_n_opps;m++)
+  {
+    for(int i=0;i<in_opp[m].get_dim(0)*in_opp[m].get_dim(1);i++)
+      if(in_opp[m](i)*in_opp[m](i)>1e-24)
+        nnz++;
+
+    n_entries+=in_opp[m].get_dim(0)*in_opp[m].get_dim(1);
+    n_max=max(n_max,max(in_opp[m].get_dim(0),in_opp[m].get_dim(1)));
+  }
+
+  double fill=nnz/(double)n_entries;
+
+  array<double> in(n_max,n_cols), out(n_max,n_cols);
+  in.initialize_to_value(1.);
+  out.initialize_to_zero();
+
+  array< array<double> > data(in_n_opps);
+  array< array<int> > cols(in_n_opps), b(in_n_opps), e(in_n_opps);
+
+  int sparse_best=0;
+  double t_best=0.;
+
+  for(int sparse=0;sparse<=3;sparse++)
+  {
+    if(sparse==2 || (sparse==1 && fill>0.5))
+      continue;
+
+    for(int m=0;m<in_n_opps;m++)
+    {
+      if(sparse==1)
+        array_to_mklcsr(in_opp[m],data(m),cols(m),b(m),e(m));
+      else if(sparse==3)
+      {
+        data(m).setup(get_small_gemm_size(in_opp[m].get_dim(0),in_opp[m].get_dim(1)));
+        pack_small_gemm(in_opp[m].get_ptr_cpu(),in_opp[m].get_dim(0),in_opp[m].get_dim(1),data(m).get_ptr_cpu());
+      }
+    }
+
+    // best of 3, after one untimed application
+    double t_sparse=0.;
+    for(int r=0;r<4;r++)
+    {
+      double t_start=get_wall_time();
+
+      for(int m=0;m<in_n_opps;m++)
+        apply_opp_cols(sparse,in_opp[m],data(m),cols(m),b(m),e(m),n_cols,in.get_ptr_cpu(),n_max,0.,out.get_ptr_cpu(),n_max);
+
+      double t=get_wall_time()-t_start;
+
+      if(r==1 || (r>1 && t<t_sparse))
+        t_sparse=t;
+    }
+
+    if(sparse==0 || t_sparse<t_best)
+    {
+      sparse_best=sparse;
+      t_best=t_sparse;
+    }
+  }
+
+#ifndef _MPI
+  cout << "  " << in_name << ": fill " << fill << ", storage " << sparse_best << endl;
+#endif
+
+  return sparse_best;
+}
+
+// apply a dense operator in single precision, for the mixed precision mode. The operator and chunks of
+// OPP_SP_CHUNK columns are rounded to float in per-thread scratch and multiplied with sgemm. The products are
+// added to out in double, so sums of operators (over dimensions, or the correction) are accumulated in double
+
+void eles::apply_opp_single(array<double>& in_opp, double* in_ptr, int in_ld, double in_beta, double* out_ptr, int out_ld, int in_ele_start, int in_ele_end)
+{
+  int n_rows=in_opp.get_dim(0);
+  int n_inner=in_opp.get_dim(1);
+  int n_cols=in_ele_end-in_ele_start;
+  int n_chunks=(n_cols+OPP_SP_CHUNK-1)/OPP_SP_CHUNK;
+  double* a=in_opp.get_ptr_cpu();
+
+#pragma omp parallel
+  {
+    float* a_sp=temp_opp_sp(get_thread_num()).get_ptr_cpu();
+    float* b_sp=a_sp+n_rows*n_inner;
+    float* c_sp=b_sp+n_inner*OPP_SP_CHUNK;
+
+    for(int i=0;i<n_rows*n_inner;i++)
+      a_sp[i]=(float)a[i];
+
+#pragma omp for schedule(static)
+    for(int kc=0;kc<n_fields*n_chunks;kc++)
+    {
+      int k=kc/n_chunks;
+      int j0=(kc%n_chunks)*OPP_SP_CHUNK;
+      int nc=min(OPP_SP_CHUNK,n_cols-j0);
+      double* b=in_ptr+(k*n_eles+in_ele_start+j0)*in_ld;
+      double* c=out_ptr+(k*n_eles+in_ele_start+j0)*out_ld;
+
+      for(int j=0;j<nc;j++)
+        for(int l=0;l<n_inner;l++)
+          b_sp[l+n_inner*j]=(float)b[l+in_ld*j];
+
+#if defined _ACCELERATE_BLAS || defined _MKL_BLAS || defined _STANDARD_BLAS
+      cblas_sgemm(CblasColMajor,CblasNoTrans,CblasNoTrans,n_rows,nc,n_inner,1.0f,a_sp,n_rows,b_sp,n_inner,0.0f,c_sp,n_rows);
+#elif defined _NO_BLAS
+      sgemm(n_rows,nc,n_inner,1.0f,0.0f,a_sp,n_rows,b_sp,n_inner,c_sp,n_rows);
+#endif
+
+      for(int j=0;j<nc;j++)
+      {
+        if(in_beta==0.)
+          for(int i=0;i<n_rows;i++)
+            c[i+out_ld*j]=c_sp[i+n_rows*j];
+        else
+          for(int i=0;i<n_rows;i++)
+            c[i+out_ld*j]=in_beta*c[i+out_ld*j]+c_sp[i+n_rows*j];
+      }
+    }
+  }
+}
+
+// apply a dense operator to the element blocks of the AoSoA layout. Each column of the operator is applied to the
+// upts_width elements of a block at once, lane fastest. Flux point arrays keep the (fpt,ele,field) layout for the
+// interfaces, so their columns are transposed through per-thread scratch on the way in and out
+
+void eles::apply_opp_aosoa(array<double>& in_opp, double* in_ptr, int in_blk, double in_beta, double* out_ptr, int out_blk, int in_ele_start, int in_ele_end)
+{
+  int n_rows=in_opp.get_dim(0);
+  int n_inner=in_opp.get_dim(1);
+  int w=upts_width;
+  int blk_start=in_ele_start/w;
+  int n_blks=(in_ele_end+w-1)/w-blk_start;
+  double* a=in_opp.get_ptr_cpu();
+
+  // distance between fields of the operands
+  int in_field=(in_blk ? w*n_inner : n_inner*n_eles);
+  int out_field=(out_blk ? w*n_rows : n_rows*n_eles);
+
+#pragma omp parallel
+  {
+    array<double>& temp_blk_fpts = this->temp_blk_fpts(get_thread_num());
+
+#pragma omp for schedule(static)
+    for(int kb=0;kb<n_blks*n_fields;kb++)
+    {
+      int blk=blk_start+kb/n_fields;
+      int k=kb%n_fields;
+      int e0=blk*w;
+      int lo=max(in_ele_start-e0,0);
+      int hi=min(in_ele_end-e0,w);
+      int e,i,l;
+      double* b;
+      double* c;
+
+      if(in_blk)
+      {
+        b=in_ptr+blk*in_blk+k*in_field;
+      }
+      else
+      {
+        b=temp_blk_fpts.get_ptr_cpu(0,0);
+        for(e=lo;e<hi;e++)
+          for(l=0;l<n_inner;l++)
+            b[e+w*l]=in_ptr[l+n_inner*(e0+e)+k*in_field];
+      }
+
+      if(out_blk)
+      {
+        c=out_ptr+blk*out_blk+k*out_field;
+      }
+      else
+      {
+        c=temp_blk_fpts.get_ptr_cpu(0,1);
+        if(in_beta!=0.)
+          for(e=lo;e<hi;e++)
+            for(i=0;i<n_rows;i++)
+              c[e+w*i]=out_ptr[i+n_rows*(e0+e)+k*out_field];
+      }
+
+      // same order of operations as dgemm, so both layouts give the same result
+      if(aosoa_opp_fn!=NULL && lo==0 && hi==w)
+      {
+        aosoa_opp_fn(a,n_rows,n_inner,b,in_beta,c);
+      }
+      else
+      {
+        if(in_beta==0.)
+        {
+          for(i=0;i<n_rows;i++)
+            for(e=lo;e<hi;e++)
+              c[e+w*i]=0.;
+        }
+        else if(in_beta!=1.)
+        {
+          for(i=0;i<n_rows;i++)
+            for(e=lo;e<hi;e++)
+              c[e+w*i]*=in_beta;
+        }
+
+        for(l=0;l<n_inner;l++)
+        {
+          for(i=0;i<n_rows;i++)
+          {
+            double a_il=a[i+n_rows*l];
+            for(e=lo;e<hi;e++)
+              c[e+w*i]+=b[e+w*l]*a_il;
+          }
+        }
+      }
+
+      if(!out_blk)
+      {
+        for(e=lo;e<hi;e++)
+          for(i=0;i<n_rows;i++)
+            out_ptr[i+n_rows*(e0+e)+k*out_field]=c[e+w*i];
+      }
+    }
+  }
+}
+
+// set the 1D factors of opp_0 to opp_6 for tensor-product elements. Each flux point only sees the line of
+// solution points normal to its face, and each derivative only the line of solution points along its direction
+
+void eles::set_opp_tensor(void)
+{
+  int i,j,k,l,m;
+  int dir,base,stride,n_upts_tensor;
+  bool on_line;
+  double tol=1.e-12;
+
+  n_upts_1d=order+1;
+
+  n_upts_tensor=1;
+  for(k=0;k<n_dims;k++)
+    n_upts_tensor*=n_upts_1d;
+
+  if(n_upts_tensor!=n_upts_per_ele)
+    FatalError("Sum factorization requires a tensor-product element");
+
+  tensor_fpt_dir.setup(n_fpts_per_ele);
+  tensor_fpt_base.setup(n_fpts_per_ele);
+  tensor_fpt_stride.setup(n_fpts_per_ele);
+
+  for(i=0;i<n_fpts_per_ele;i++)
+  {
+    // direction of the face normal
+    dir=0;
+    for(k=1;k<n_dims;k++)
+    {
+      if(fabs(tnorm_fpts(k,i))>fabs(tnorm_fpts(dir,i)))
+        dir=k;
+    }
+
+    // solution points sharing the tangential coordinates of the flux point
+    base=-1;
+    stride=1;
+    m=0;
+    for(j=0;j<n_upts_per_ele;j++)
+    {
+      on_line=true;
+      for(k=0;k<n_dims;k++)
+      {
+        if(k!=dir && fabs(loc_upts(k,j)-tloc_fpts(k,i))>tol)
+          on_line=false;
+      }
+
+      if(on_line)
+      {
+        if(m==0)
+          base=j;
+        else if(m==1)
+          stride=j-base;
+        else if(j!=base+m*stride)
+          FatalError("Solution points normal to a face are not equally strided");
+        m++;
+      }
+    }
+
+    if(m!=n_upts_1d)
+      FatalError("Flux point does not lie on a line of solution points");
+
+    tensor_fpt_dir(i)=dir;
+    tensor_fpt_base(i)=base;
+    tensor_fpt_stride(i)=stride;
+  }
+
+  // 1D extrapolation and correction factors
+  opp_0_tensor.setup(n_upts_1d,n_fpts_per_ele);
+  opp_1_tensor.setup(n_upts_1d,n_fpts_per_ele);
+  opp_3_tensor.setup(n_upts_1d,n_fpts_per_ele);
+
+  if(viscous)
+  {
+    opp_5_tensor.setup(n_upts_1d,n_fpts_per_ele);
+    opp_6_tensor.setup(n_upts_1d,n_fpts_per_ele);
+  }
+
+  for(i=0;i<n_fpts_per_ele;i++)
+  {
+    dir=tensor_fpt_dir(i);
+    for(l=0;l<n_upts_1d;l++)
+    {
+      j=tensor_fpt_base(i)+l*tensor_fpt_stride(i);
+
+      opp_0_tensor(l,i)=opp_0(i,j);
+      opp_1_tensor(l,i)=opp_1(dir)(i,j);
+      opp_3_tensor(l,i)=opp_3(j,i);
+
+      if(viscous)
+      {
+        opp_5_tensor(l,i)=opp_5(dir)(j,i);
+        opp_6_tensor(l,i)=opp_6(i,j);
+      }
+    }
+  }
+
+  // 1D derivative factors, taken from the line through the first solution point
+  opp_2_tensor.setup(n_dims);
+  if(viscous)
+    opp_4_tensor.setup(n_dims);
+
+  stride=1;
+  for(k=0;k<n_dims;k++)
+  {
+    opp_2_tensor(k).setup(n_upts_1d,n_upts_1d);
+    if(viscous)
+      opp_4_tensor(k).setup(n_upts_1d,n_upts_1d);
+
+    for(l=0;l<n_upts_1d;l++)
+    {
+      for(m=0;m<n_upts_1d;m++)
+      {
+        opp_2_tensor(k)(l,m)=opp_2(k)(l*stride,m*stride);
+        if(viscous)
+          opp_4_tensor(k)(l,m)=opp_4(k)(l*stride,m*stride);
+      }
+    }
+
+    stride*=n_upts_1d;
+  }
+
+  // check the factors reproduce the full operators
+  int a_j,a_l;
+  double ref;
+  bool match=true;
+
+  for(i=0;i<n_fpts_per_ele;i++)
+  {
+    dir=tensor_fpt_dir(i);
+    for(j=0;j<n_upts_per_ele;j++)
+    {
+      a_j=-1;
+      for(l=0;l<n_upts_1d;l++)
+      {
+        if(j==tensor_fpt_base(i)+l*tensor_fpt_stride(i))
+          a_j=l;
+      }
+
+      ref=(a_j<0) ? 0. : opp_0_tensor(a_j,i);
+      if(fabs(opp_0(i,j)-ref)>tol) match=false;
+
+      ref=(a_j<0) ? 0. : opp_3_tensor(a_j,i);
+      if(fabs(opp_3(j,i)-ref)>tol) match=false;
+
+      if(viscous)
+      {
+        ref=(a_j<0) ? 0. : opp_6_tensor(a_j,i);
+        if(fabs(opp_6(i,j)-ref)>tol) match=false;
+      }
+
+      for(k=0;k<n_dims;k++)
+      {
+        ref=(a_j<0 || k!=dir) ? 0. : opp_1_tensor(a_j,i);
+        if(fabs(opp_1(k)(i,j)-ref)>tol) match=false;
+
+        if(viscous)
         {
-          loc(l)=loc_upts(l,k);
+          ref=(a_j<0 || k!=dir) ? 0. : opp_5_tensor(a_j,i);
+          if(fabs(opp_5(k)(j,i)-ref)>tol) match=false;
         }
-        
-        opp_4(i)(k,j) = eval_d_nodal_basis(j,i,loc);
       }
     }
   }
-  
-#ifdef _GPU
-  for (int i=0;i<n_dims;i++)
-    opp_4(i).cp_cpu_gpu();
-#endif
-  
-  if(in_sparse==0)
-  {
-    opp_4_sparse=0;
-  }
-  else if(in_sparse==1)
+
+  stride=1;
+  for(k=0;k<n_dims;k++)
   {
-    opp_4_sparse=1;
-    
-#ifdef _CPU
-    for (int i=0;i<n_dims;i++)
+    for(j=0;j<n_upts_per_ele;j++)
     {
-      array_to_mklcsr(opp_4(i),opp_4_data(i),opp_4_cols(i),opp_4_b(i),opp_4_e(i));
-    }
-#endif
-    
-#ifdef _GPU
-    opp_4_ell_data.setup(n_dims);
-    opp_4_ell_indices.setup(n_dims);
-    opp_4_nnz_per_row.setup(n_dims);
-    for (int i=0;i<n_dims;i++) {
-      array_to_ellpack(opp_4(i), opp_4_ell_data(i), opp_4_ell_indices(i), opp_4_nnz_per_row(i));
-      opp_4_ell_data(i).cp_cpu_gpu();
-      opp_4_ell_indices(i).cp_cpu_gpu();
+      for(l=0;l<n_upts_per_ele;l++)
+      {
+        a_j=(j/stride)%n_upts_1d;
+        a_l=(l/stride)%n_upts_1d;
+
+        ref=(j-a_j*stride==l-a_l*stride) ? opp_2_tensor(k)(a_j,a_l) : 0.;
+        if(fabs(opp_2(k)(j,l)-ref)>tol) match=false;
+
+        if(viscous)
+        {
+          ref=(j-a_j*stride==l-a_l*stride) ? opp_4_tensor(k)(a_j,a_l) : 0.;
+          if(fabs(opp_4(k)(j,l)-ref)>tol) match=false;
+        }
+      }
     }
-#endif
-  }
-  else
-  {
-    cout << "ERROR: Invalid sparse matrix form ... " << endl;
+    stride*=n_upts_1d;
   }
+
+  if(!match)
+    FatalError("Element operators are not separable, use dense or sparse storage instead");
+
+  // specialized kernels for this number of points, if any
+  tensor_deriv_fn=get_tensor_deriv_kernel(n_dims,n_upts_1d);
+  tensor_extrap_fn=get_tensor_extrap_kernel(n_dims,n_upts_1d);
+  tensor_correct_fn=get_tensor_correct_kernel(n_dims,n_upts_1d);
 }
 
-// transformed solution correction at flux points to transformed gradient correction at solution points
+// apply a 1D derivative along in_dim to every field of elements in_ele_start to in_ele_end-1, out = in_beta*out + D*in
 
-void eles::set_opp_5(int in_sparse)
+void eles::apply_tensor_deriv(array<double>& in_deriv, int in_dim, double* in_ptr, double* out_ptr, int in_ld, double in_beta, int in_ele_start, int in_ele_end)
 {
-  int i,j,k,l;
-  
-  array<double> loc(n_dims);
-  
-  opp_5.setup(n_dims);
-  for (int i=0;i<n_dims;i++)
-    opp_5(i).setup(n_upts_per_ele, n_fpts_per_ele);
+  if(tensor_deriv_fn!=NULL)
+  {
+    tensor_deriv_fn(in_deriv.get_ptr_cpu(),in_dim,in_ptr,out_ptr,in_ld,in_beta,n_eles,n_fields,in_ele_start,in_ele_end);
+    return;
+  }
 
-  for(i=0;i<n_dims;i++)
+  int n_block=in_ele_end-in_ele_start;
+
+  int stride=1;
+  for(int k=0;k<in_dim;k++)
+    stride*=n_upts_1d;
+
+  double* deriv=in_deriv.get_ptr_cpu();
+
+#pragma omp parallel for schedule(static)
+  for(int i=0;i<n_fields*n_block;i++)
   {
-    for(j=0;j<n_fpts_per_ele;j++)
+    int col=(i/n_block)*n_eles+in_ele_start+i%n_block;
+    double* in_col=in_ptr+col*in_ld;
+    double* out_col=out_ptr+col*in_ld;
+
+    for(int j=0;j<n_upts_per_ele;j++)
     {
-      for(k=0;k<n_upts_per_ele;k++)
-      {
-        /*
-         for(l=0;l<n_dims;l++)
-         {
-         loc(l)=loc_upts(l,k);
-         }
-         */
-        
-        //opp_5(i)(k,j) = eval_div_vcjh_basis(j,loc)*tnorm_fpts(i,j);
-        opp_5(i)(k,j) = opp_3(k,j)*tnorm_fpts(i,j);
-      }
+      int a=(j/stride)%n_upts_1d;
+      double* line=in_col+j-a*stride;
+      double sum;
+
+      if(in_beta==0.)
+        sum=0.;
+      else
+        sum=in_beta*out_col[j];
+
+      for(int q=0;q<n_upts_1d;q++)
+        sum+=line[q*stride]*deriv[a+q*n_upts_1d];
+
+      out_col[j]=sum;
     }
   }
-  
-#ifdef _GPU
-  for (int i=0;i<n_dims;i++)
-    opp_5(i).cp_cpu_gpu();
-#endif
-  
-  //cout << "opp_5" << endl;
-  //opp_5.print();
-  
-  if(in_sparse==0)
+}
+
+// extrapolate every field of elements in_ele_start to in_ele_end-1 to the flux points, out = W*in. If
+// in_dim_stride is non-zero, each flux point reads the component of in_ptr in the direction of its face normal
+
+void eles::apply_tensor_extrap(array<double>& in_coeff, double* in_ptr, int in_ld, int in_dim_stride, double* out_ptr, int in_ele_start, int in_ele_end)
+{
+  if(tensor_extrap_fn!=NULL)
   {
-    opp_5_sparse=0;
+    tensor_extrap_fn(in_coeff.get_ptr_cpu(),tensor_fpt_dir.get_ptr_cpu(),tensor_fpt_base.get_ptr_cpu(),tensor_fpt_stride.get_ptr_cpu(),in_ptr,in_ld,in_dim_stride,out_ptr,n_eles,n_fields,in_ele_start,in_ele_end);
+    return;
   }
-  else if(in_sparse==1)
+
+  int n_block=in_ele_end-in_ele_start;
+
+  double* coeff=in_coeff.get_ptr_cpu();
+
+#pragma omp parallel for schedule(static)
+  for(int i=0;i<n_fields*n_block;i++)
   {
-    opp_5_sparse=1;
-    
-#ifdef _CPU
-    for (int i=0;i<n_dims;i++) {
-      array_to_mklcsr(opp_5(i),opp_5_data(i),opp_5_cols(i),opp_5_b(i),opp_5_e(i));
-    }
-#endif
-    
-#ifdef _GPU
-    opp_5_ell_data.setup(n_dims);
-    opp_5_ell_indices.setup(n_dims);
-    opp_5_nnz_per_row.setup(n_dims);
-    for (int i=0;i<n_dims;i++) {
-      array_to_ellpack(opp_5(i), opp_5_ell_data(i), opp_5_ell_indices(i), opp_5_nnz_per_row(i));
-      opp_5_ell_data(i).cp_cpu_gpu();
-      opp_5_ell_indices(i).cp_cpu_gpu();
+    int col=(i/n_block)*n_eles+in_ele_start+i%n_block;
+    double* in_col=in_ptr+col*in_ld;
+    double* out_col=out_ptr+col*n_fpts_per_ele;
+
+    for(int j=0;j<n_fpts_per_ele;j++)
+    {
+      double* line=in_col+tensor_fpt_dir(j)*in_dim_stride+tensor_fpt_base(j);
+      double* w=coeff+j*n_upts_1d;
+      int stride=tensor_fpt_stride(j);
+      double sum=0.;
+
+      for(int q=0;q<n_upts_1d;q++)
+        sum+=line[q*stride]*w[q];
+
+      out_col[j]=sum;
     }
-#endif
-  }
-  else
-  {
-    cout << "ERROR: Invalid sparse matrix form ... " << endl;
   }
 }
 
-// transformed gradient at solution points to transformed gradient at flux points
+// add the correction from every flux point to its line of solution points for elements in_ele_start to
+// in_ele_end-1, out += C*in
 
-void eles::set_opp_6(int in_sparse)
+void eles::apply_tensor_correct(array<double>& in_coeff, int in_dim, double* in_ptr, double* out_ptr, int in_ld, int in_ele_start, int in_ele_end)
 {
-  int i,j,k,l,m;
-  
-  array<double> loc(n_dims);
-  
-  opp_6.setup(n_fpts_per_ele, n_upts_per_ele);
-  
-  for(j=0; j<n_upts_per_ele; j++)
+  if(tensor_correct_fn!=NULL)
   {
-    for(l=0; l<n_fpts_per_ele; l++)
+    tensor_correct_fn(in_coeff.get_ptr_cpu(),in_dim,tensor_fpt_dir.get_ptr_cpu(),tensor_fpt_base.get_ptr_cpu(),tensor_fpt_stride.get_ptr_cpu(),in_ptr,out_ptr,in_ld,n_eles,n_fields,in_ele_start,in_ele_end);
+    return;
+  }
+
+  int n_block=in_ele_end-in_ele_start;
+
+  double* coeff=in_coeff.get_ptr_cpu();
+
+#pragma omp parallel for schedule(static)
+  for(int i=0;i<n_fields*n_block;i++)
+  {
+    int col=(i/n_block)*n_eles+in_ele_start+i%n_block;
+    double* in_col=in_ptr+col*n_fpts_per_ele;
+    double* out_col=out_ptr+col*in_ld;
+
+    for(int j=0;j<n_fpts_per_ele;j++)
     {
-      for(m=0; m<n_dims; m++)
+      if(in_dim<0 || tensor_fpt_dir(j)==in_dim)
       {
-        loc(m) = tloc_fpts(m,l);
+        double* line=out_col+tensor_fpt_base(j);
+        double* c=coeff+j*n_upts_1d;
+        int stride=tensor_fpt_stride(j);
+        double val=in_col[j];
+
+        for(int q=0;q<n_upts_1d;q++)
+          line[q*stride]+=val*c[q];
       }
-      opp_6(l,j) = eval_nodal_basis(j,loc);
     }
   }
-  
-  //cout << "opp_6" << endl;
-  //opp_6.print();
-  
-#ifdef _GPU
-  opp_6.cp_cpu_gpu();
-#endif
-  
-  if(in_sparse==0)
-  {
-    opp_6_sparse=0;
-  }
-  else if(in_sparse==1)
-  {
-    opp_6_sparse=1;
-    
-#ifdef _CPU
-    array_to_mklcsr(opp_6,opp_6_data,opp_6_cols,opp_6_b,opp_6_e);
-#endif
-    
-#ifdef _GPU
-    array_to_ellpack(opp_6, opp_6_ell_data, opp_6_ell_indices, opp_6_nnz_per_row);
-    opp_6_ell_data.cp_cpu_gpu();
-    opp_6_ell_indices.cp_cpu_gpu();
-#endif
-    
-  }
-  else
-  {
-    cout << "ERROR: Invalid sparse matrix form ... " << endl;
-  }
 }
 
 // set opp_p (solution at solution points to solution at plot points)
@@ -4061,7 +5554,7 @@ void eles::set_opp_p(void)
   
   opp_p.setup(n_ppts_per_ele,n_upts_per_ele);
   
-  for(i=0;i<n_upts_per_ele;i++)
+  if(!cached_opps.get("opp_p",opp_p))
   {
     for(j=0;j<n_ppts_per_ele;j++)
     {
@@ -4070,8 +5563,12 @@ void eles::set_opp_p(void)
         loc(k)=loc_ppts(k,j);
       }
       
-      opp_p(j,i)=eval_nodal_basis(i,loc);
+      for(i=0;i<n_upts_per_ele;i++)
+      {
+        opp_p(j,i)=eval_nodal_basis(i,loc);
+      }
     }
+    cached_opps.put("opp_p",opp_p);
   }
   
 }
@@ -4092,15 +5589,15 @@ void eles::set_opp_inters_cubpts(void)
   
   for(l=0;l<n_inters_per_ele;l++)
   {
-    for(i=0;i<n_upts_per_ele;i++)
+    for(j=0;j<n_cubpts_per_inter(l);j++)
     {
-      for(j=0;j<n_cubpts_per_inter(l);j++)
+      for(k=0;k<n_dims;k++)
+      {
+        loc(k)=loc_inters_cubpts(l)(k,j);
+      }
+      
+      for(i=0;i<n_upts_per_ele;i++)
       {
-        for(k=0;k<n_dims;k++)
-        {
-          loc(k)=loc_inters_cubpts(l)(k,j);
-        }
-        
         opp_inters_cubpts(l)(j,i)=eval_nodal_basis(i,loc);
       }
     }
@@ -4115,15 +5612,15 @@ void eles::set_opp_volume_cubpts(void)
   array<double> loc(n_dims);
   opp_volume_cubpts.setup(n_cubpts_per_ele,n_upts_per_ele);
   
-  for(i=0;i<n_upts_per_ele;i++)
+  for(j=0;j<n_cubpts_per_ele;j++)
   {
-    for(j=0;j<n_cubpts_per_ele;j++)
+    for(k=0;k<n_dims;k++)
+    {
+      loc(k)=loc_volume_cubpts(k,j);
+    }
+    
+    for(i=0;i<n_upts_per_ele;i++)
     {
-      for(k=0;k<n_dims;k++)
-      {
-        loc(k)=loc_volume_cubpts(k,j);
-      }
-      
       opp_volume_cubpts(j,i)=eval_nodal_basis(i,loc);
     }
   }
@@ -4140,15 +5637,13 @@ void eles::set_opp_r(void)
   
   opp_r.setup(n_upts_per_ele,n_upts_per_ele_rest);
   
-  for(i=0;i<n_upts_per_ele_rest;i++)
+  for(j=0;j<n_upts_per_ele;j++)
   {
-    for(j=0;j<n_upts_per_ele;j++)
-    {
-      for(k=0;k<n_dims;k++)
-        loc(k)=loc_upts(k,j);
-      
+    for(k=0;k<n_dims;k++)
+      loc(k)=loc_upts(k,j);
+    
+    for(i=0;i<n_upts_per_ele_rest;i++)
       opp_r(j,i)=eval_nodal_basis_restart(i,loc);
-    }
   }
 }
 
@@ -4875,9 +6370,10 @@ void eles::set_transforms_dynamic(void)
     else if(n_dims == 3)
       n_comp = 6;
 
-    array<double> pos(n_dims);
-    array<double> d_pos(n_dims,n_dims);
-    array<double> norm_dot_JGinv(n_dims);  // un-normalized normal vector in moving-physical domain
+    double pos_data[3], d_pos_data[9], norm_dot_JGinv_data[3];
+    array<double> pos(pos_data,n_dims);
+    array<double> d_pos(d_pos_data,n_dims,n_dims);
+    array<double> norm_dot_JGinv(norm_dot_JGinv_data,n_dims);  // un-normalized normal vector in moving-physical domain
 
     double xr, xs, xt;
     double yr, ys, yt;
@@ -4924,7 +6420,7 @@ void eles::set_transforms_dynamic(void)
           // store determinant of jacobian multiplied by inverse of jacobian at the solution point
           JGinv_dyn_upts(0,0,j,i)=  ys;
           JGinv_dyn_upts(0,1,j,i)= -xs;
-          JGinv_dyn_upts(1,1,j,i)= -yr;
+          JGinv_dyn_upts(1,0,j,i)= -yr;
           JGinv_dyn_upts(1,1,j,i)=  xr;
         }
         else if(n_dims==3)
@@ -4948,7 +6444,7 @@ void eles::set_transforms_dynamic(void)
           JGinv_dyn_upts(0,0,j,i) = (ys*zt - yt*zs);
           JGinv_dyn_upts(0,1,j,i) = (xt*zs - xs*zt);
           JGinv_dyn_upts(0,2,j,i) = (xs*yt - xt*ys);
-          JGinv_dyn_upts(1,1,j,i) = (yt*zr - yr*zt);
+          JGinv_dyn_upts(1,0,j,i) = (yt*zr - yr*zt);
           JGinv_dyn_upts(1,1,j,i) = (xr*zt - xt*zr);
           JGinv_dyn_upts(1,2,j,i) = (xt*yr - xr*yt);
           JGinv_dyn_upts(2,0,j,i) = (yr*zs - ys*zr);
@@ -5635,7 +7131,7 @@ double* eles::get_grad_disu_fpts_ptr(int in_inter_local_fpt, int in_ele_local_in
 #endif
 }
 
-double* eles::get_normal_disu_fpts_ptr(int in_inter_local_fpt, int in_ele_local_inter, int in_field, int in_ele, array<double> temp_loc, double temp_pos[3])
+double* eles::get_normal_disu_fpts_ptr(int in_inter_local_fpt, int in_ele_local_inter, int in_field, int in_ele, array<double>& temp_loc, double temp_pos[3])
 {
   
   array<double> pos(n_dims);
@@ -5741,7 +7237,7 @@ double* eles::get_sgsf_fpts_ptr(int in_inter_local_fpt, int in_ele_local_inter,
 
 // calculate position
 
-void eles::calc_pos(array<double> in_loc, int in_ele, array<double>& out_pos)
+void eles::calc_pos(array<double>& in_loc, int in_ele, array<double>& out_pos)
 {
   int i,j;
   
@@ -5877,6 +7373,147 @@ void eles::calc_d_pos_upt(int in_upt, int in_ele, array<double>& out_d_pos)
   }
 }
 
+void eles::setup_thread_scratch(void)
+{
+  n_threads = get_n_threads();
+
+  temp_u.setup(n_threads);
+  temp_v.setup(n_threads);
+  temp_grad_u.setup(n_threads);
+  temp_f.setup(n_threads);
+  temp_f_ref.setup(n_threads);
+  temp_sgsf.setup(n_threads);
+  temp_sgsf_ref.setup(n_threads);
+  temp_f_upts.setup(n_threads);
+  temp_blk_fpts.setup(n_threads);
+  temp_opp_sp.setup(n_threads);
+
+  for (int t=0; t<n_threads; t++)
+  {
+    temp_u(t).setup(n_fields);
+    temp_v(t).setup(n_dims);
+    temp_v(t).initialize_to_zero();
+    temp_f(t).setup(n_fields,n_dims);
+    temp_f_ref(t).setup(n_fields,n_dims);
+    temp_f_upts(t).setup(upts_width*n_upts_per_ele,n_fields,n_dims);
+
+    if (upts_width>1)
+      temp_blk_fpts(t).setup(upts_width*max(n_upts_per_ele,n_fpts_per_ele),2);
+
+    if (run_input.precision==1) {
+      int n_max = max(n_upts_per_ele,n_fpts_per_ele);
+      temp_opp_sp(t).setup(n_max*(n_max+2*OPP_SP_CHUNK));
+    }
+
+    if (viscous)
+      temp_grad_u(t).setup(n_fields,n_dims);
+
+    // SGS flux arrays are only needed if using LES or wall model
+    if (LES != 0 || wall_model != 0) {
+      temp_sgsf(t).setup(n_fields,n_dims);
+      if (motion)
+        temp_sgsf_ref(t).setup(n_fields,n_dims);
+    }
+  }
+}
+
+// set up the operator cache of this element type, keyed by the element type, order and the inputs its operators depend on
+
+void eles::setup_opp_cache(void)
+{
+  if(run_input.opp_cache==0)
+  {
+    array<int> key_int(1);
+    array<double> key_double(1);
+    cached_opps.setup(string(""),key_int,key_double);
+    return;
+  }
+
+  const char* ele_names[5]={"tri","quad","tet","pri","hex"};
+
+  array<int> key_int(11);
+  array<double> key_double(3);
+
+  key_int.initialize_to_zero();
+  key_double.initialize_to_zero();
+
+  key_int(0)=ele_type;
+  key_int(1)=n_dims;
+  key_int(2)=order;
+  key_int(3)=p_res;
+  key_int(4)=filter;
+  key_int(5)=run_input.filter_type;
+  key_double(0)=run_input.filter_ratio;
+
+  if(ele_type==0)
+  {
+    key_int(6)=run_input.upts_type_tri;
+    key_int(7)=run_input.fpts_type_tri;
+    key_int(8)=run_input.vcjh_scheme_tri;
+    key_double(1)=run_input.c_tri;
+  }
+  else if(ele_type==1)
+  {
+    key_int(6)=run_input.upts_type_quad;
+    key_int(8)=run_input.vcjh_scheme_quad;
+    key_double(1)=run_input.eta_quad;
+    key_double(2)=run_input.c_quad;
+  }
+  else if(ele_type==2)
+  {
+    key_int(6)=run_input.upts_type_tet;
+    key_int(7)=run_input.fpts_type_tet;
+    key_int(8)=run_input.vcjh_scheme_tet;
+    key_double(1)=run_input.c_tet;
+    key_double(2)=run_input.eta_tet;
+  }
+  else if(ele_type==3)
+  {
+    key_int(6)=run_input.upts_type_pri_tri;
+    key_int(7)=run_input.fpts_type_tet;
+    key_int(8)=run_input.vcjh_scheme_tri;
+    key_int(9)=run_input.upts_type_pri_1d;
+    key_int(10)=run_input.vcjh_scheme_pri_1d;
+    key_double(1)=run_input.c_tri;
+    key_double(2)=run_input.eta_pri;
+  }
+  else if(ele_type==4)
+  {
+    key_int(6)=run_input.upts_type_hexa;
+    key_int(8)=run_input.vcjh_scheme_hexa;
+    key_double(1)=run_input.eta_hexa;
+  }
+
+  stringstream file_name;
+  file_name << run_input.opp_cache_dir << "/opp_" << ele_names[ele_type] << "_p" << order << ".bin";
+
+  cached_opps.setup(file_name.str(),key_int,key_double);
+}
+
+// true if the basis memo was filled at in_loc with in_order, otherwise record in_loc and in_order so the caller can fill it
+
+bool eles::check_basis_memo(array<double>& in_loc, int in_n_dims, int in_order, array<double>& in_memo_loc, int& in_memo_order)
+{
+  bool hit=(in_memo_order==in_order && in_memo_loc.get_dim(0)==in_n_dims);
+
+  for(int i=0;i<in_n_dims && hit;i++)
+    if(in_memo_loc(i)!=in_loc(i))
+      hit=false;
+
+  if(!hit)
+  {
+    if(in_memo_loc.get_dim(0)!=in_n_dims)
+      in_memo_loc.setup(in_n_dims);
+
+    for(int i=0;i<in_n_dims;i++)
+      in_memo_loc(i)=in_loc(i);
+
+    in_memo_order=in_order;
+  }
+
+  return hit;
+}
+
 /**
  * Calculate derivative of static position wrt computational-space position at fpt
  * Uses pre-computed nodal shape basis derivatives for efficiency
@@ -5945,7 +7582,8 @@ void eles::calc_d_pos_dyn_fpt(int in_fpt, int in_ele, array<double>& out_d_pos)
     int i,j,k;
 
     // Calculate dx/dr
-    array<double> dxdr(n_dims,n_dims);
+    double dxdr_data[9];
+    array<double> dxdr(dxdr_data,n_dims,n_dims);
     dxdr.initialize_to_zero();
     for(i=0; i<n_dims; i++) {
       for(j=0; j<n_dims; j++) {
@@ -5990,7 +7628,8 @@ void eles::calc_d_pos_dyn_upt(int in_upt, int in_ele, array<double>& out_d_pos)
     int i,j,k;
 
     // Calculate dx/dr
-    array<double> dxdr(n_dims,n_dims);
+    double dxdr_data[9];
+    array<double> dxdr(dxdr_data,n_dims,n_dims);
     dxdr.initialize_to_zero();
     for(i=0; i<n_dims; i++) {
       for(j=0; j<n_dims; j++) {
@@ -7008,7 +8647,7 @@ void eles::compute_wall_forces( array<double>& inv_force, array<double>& vis_for
 
 /*! Set the grid velocity at one shape point
  *  TODO: CUDA */
-void eles::set_grid_vel_spt(int in_ele, int in_spt, array<double> in_vel)
+void eles::set_grid_vel_spt(int in_ele, int in_spt, array<double>& in_vel)
 {
   for (int i=0; i<n_dims; i++)
     vel_spts(i,in_spt,in_ele) = in_vel(i);
@@ -73,6 +73,8 @@ void eles_hexas::setup_ele_type_specific()
   ele_type=4;
   n_dims=3;
 
+  setup_opp_cache();
+
   if (run_input.equation==0)
     n_fields=5;
   else if (run_input.equation==1)
@@ -130,12 +132,10 @@ void eles_hexas::setup_ele_type_specific()
       set_opp_4(run_input.sparse_hexa);
       set_opp_5(run_input.sparse_hexa);
       set_opp_6(run_input.sparse_hexa);
-
-      temp_grad_u.setup(n_fields,n_dims);
     }
 
-  temp_u.setup(n_fields);
-  temp_f.setup(n_fields,n_dims);
+  if(run_input.sparse_hexa==2)
+    set_opp_tensor();
 }
 
 // #### methods ####
@@ -439,7 +439,7 @@ void eles_hexas::set_volume_cubpts(void)
 }
 
 // Compute the surface jacobian determinant on a face
-double eles_hexas::compute_inter_detjac_inters_cubpts(int in_inter,array<double> d_pos)
+double eles_hexas::compute_inter_detjac_inters_cubpts(int in_inter,array<double>& d_pos)
 {
   double output = 0.;
   double xr, xs, xt;
@@ -914,7 +914,7 @@ void eles_hexas::set_vandermonde(void)
 
 // evaluate nodal basis
 
-double eles_hexas::eval_nodal_basis(int in_index, array<double> in_loc)
+double eles_hexas::eval_nodal_basis(int in_index, array<double>& in_loc)
 {
   int i,j,k;
 
@@ -931,7 +931,7 @@ double eles_hexas::eval_nodal_basis(int in_index, array<double> in_loc)
 
 // evaluate nodal basis using restart points
 //
-double eles_hexas::eval_nodal_basis_restart(int in_index, array<double> in_loc)
+double eles_hexas::eval_nodal_basis_restart(int in_index, array<double>& in_loc)
 {
   int i,j,k;
 
@@ -948,7 +948,7 @@ double eles_hexas::eval_nodal_basis_restart(int in_index, array<double> in_loc)
 
 // evaluate derivative of nodal basis
 
-double eles_hexas::eval_d_nodal_basis(int in_index, int in_cpnt, array<double> in_loc)
+double eles_hexas::eval_d_nodal_basis(int in_index, int in_cpnt, array<double>& in_loc)
 {
   int i,j,k;
 
@@ -980,7 +980,7 @@ double eles_hexas::eval_d_nodal_basis(int in_index, int in_cpnt, array<double> i
 
 // evaluate nodal shape basis
 
-double eles_hexas::eval_nodal_s_basis(int in_index, array<double> in_loc, int in_n_spts)
+double eles_hexas::eval_nodal_s_basis(int in_index, array<double>& in_loc, int in_n_spts)
 {
   int i,j,k;
   double nodal_s_basis;
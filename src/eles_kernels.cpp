@@ -0,0 +1,617 @@
+/*!
+ * \file eles_kernels.cpp
+ * \author - Original code: SD++ developed by Patrice Castonguay, Antony Jameson,
+ *                          Peter Vincent, David Williams (alphabetical by surname).
+ *         - Current development: Aerospace Computing Laboratory (ACL)
+ *                                Aero/Astro Department. Stanford University.
+ * \version 0.1.0
+ *
+ * High Fidelity Large Eddy Simulation (HiFiLES) Code.
+ * Copyright (C) 2014 Aerospace Computing Laboratory (ACL).
+ *
+ * HiFiLES is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * HiFiLES is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with HiFiLES.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstddef>
+
+#include "../include/eles_kernels.h"
+
+using namespace std;
+
+// integer power, evaluated at compile time
+
+template<int BASE, int EXP>
+struct int_pow
+{
+  enum { value = BASE*int_pow<BASE,EXP-1>::value };
+};
+
+template<int BASE>
+struct int_pow<BASE,0>
+{
+  enum { value = 1 };
+};
+
+// 1D derivative along DIM, applied to each line of N1 solution points of each element and field
+
+template<int N1, int N_DIMS, int DIM>
+void tensor_deriv_dim(double* in_deriv, double* in_ptr, double* out_ptr, int in_ld, double in_beta, int in_n_eles, int in_n_fields, int in_ele_start, int in_ele_end)
+{
+  const int n_upts = int_pow<N1,N_DIMS>::value;
+  const int stride = int_pow<N1,DIM>::value;
+  const int n_hi = n_upts/(stride*N1);
+
+  int n_block=in_ele_end-in_ele_start;
+
+  double deriv[N1*N1];
+  for(int i=0;i<N1*N1;i++)
+    deriv[i]=in_deriv[i];
+
+#pragma omp parallel for schedule(static)
+  for(int i=0;i<in_n_fields*n_block;i++)
+  {
+    int col=(i/n_block)*in_n_eles+in_ele_start+i%n_block;
+    double* in_col=in_ptr+col*in_ld;
+    double* out_col=out_ptr+col*in_ld;
+
+    for(int hi=0;hi<n_hi;hi++)
+    {
+      for(int a=0;a<N1;a++)
+      {
+        for(int lo=0;lo<stride;lo++)
+        {
+          int j=hi*stride*N1+a*stride+lo;
+          double* line=in_col+hi*stride*N1+lo;
+          double sum;
+
+          if(in_beta==0.)
+            sum=0.;
+          else
+            sum=in_beta*out_col[j];
+
+          for(int q=0;q<N1;q++)
+            sum+=line[q*stride]*deriv[a+q*N1];
+
+          out_col[j]=sum;
+        }
+      }
+    }
+  }
+}
+
+template<int N1, int N_DIMS>
+void tensor_deriv(double* in_deriv, int in_dim, double* in_ptr, double* out_ptr, int in_ld, double in_beta, int in_n_eles, int in_n_fields, int in_ele_start, int in_ele_end)
+{
+  if(in_dim==0)
+    tensor_deriv_dim<N1,N_DIMS,0>(in_deriv,in_ptr,out_ptr,in_ld,in_beta,in_n_eles,in_n_fields,in_ele_start,in_ele_end);
+  else if(in_dim==1)
+    tensor_deriv_dim<N1,N_DIMS,1>(in_deriv,in_ptr,out_ptr,in_ld,in_beta,in_n_eles,in_n_fields,in_ele_start,in_ele_end);
+  else
+    tensor_deriv_dim<N1,N_DIMS,N_DIMS-1>(in_deriv,in_ptr,out_ptr,in_ld,in_beta,in_n_eles,in_n_fields,in_ele_start,in_ele_end);
+}
+
+// extrapolation to each flux point from the line of N1 solution points normal to its face
+
+template<int N1, int N_DIMS>
+void tensor_extrap(double* in_coeff, int* in_fpt_dir, int* in_fpt_base, int* in_fpt_stride, double* in_ptr, int in_ld, int in_dim_stride, double* out_ptr, int in_n_eles, int in_n_fields, int in_ele_start, int in_ele_end)
+{
+  const int n_fpts = 2*N_DIMS*int_pow<N1,N_DIMS-1>::value;
+
+  int n_block=in_ele_end-in_ele_start;
+
+#pragma omp parallel for schedule(static)
+  for(int i=0;i<in_n_fields*n_block;i++)
+  {
+    int col=(i/n_block)*in_n_eles+in_ele_start+i%n_block;
+    double* in_col=in_ptr+col*in_ld;
+    double* out_col=out_ptr+col*n_fpts;
+
+    for(int j=0;j<n_fpts;j++)
+    {
+      double* line=in_col+in_fpt_dir[j]*in_dim_stride+in_fpt_base[j];
+      double* w=in_coeff+j*N1;
+      int stride=in_fpt_stride[j];
+      double sum=0.;
+
+      for(int q=0;q<N1;q++)
+        sum+=line[q*stride]*w[q];
+
+      out_col[j]=sum;
+    }
+  }
+}
+
+// correction from each flux point to the line of N1 solution points normal to its face
+
+template<int N1, int N_DIMS>
+void tensor_correct(double* in_coeff, int in_dim, int* in_fpt_dir, int* in_fpt_base, int* in_fpt_stride, double* in_ptr, double* out_ptr, int in_ld, int in_n_eles, int in_n_fields, int in_ele_start, int in_ele_end)
+{
+  const int n_fpts = 2*N_DIMS*int_pow<N1,N_DIMS-1>::value;
+
+  int n_block=in_ele_end-in_ele_start;
+
+#pragma omp parallel for schedule(static)
+  for(int i=0;i<in_n_fields*n_block;i++)
+  {
+    int col=(i/n_block)*in_n_eles+in_ele_start+i%n_block;
+    double* in_col=in_ptr+col*n_fpts;
+    double* out_col=out_ptr+col*in_ld;
+
+    for(int j=0;j<n_fpts;j++)
+    {
+      if(in_dim<0 || in_fpt_dir[j]==in_dim)
+      {
+        double* line=out_col+in_fpt_base[j];
+        double* c=in_coeff+j*N1;
+        int stride=in_fpt_stride[j];
+        double val=in_col[j];
+
+        for(int q=0;q<N1;q++)
+          line[q*stride]+=val*c[q];
+      }
+    }
+  }
+}
+
+// Euler flux transformed to computational space, same operations as calc_invf_2d/3d followed by the
+// transformation in eles::evaluate_invFlux. The solution and flux have leading dimension in_ld
+
+template<int N_DIMS>
+void invFlux_euler(double* in_disu_upts, double* in_JGinv_upts, double* out_tdisf_upts, int in_ld, double in_gamma, int in_n_upts_per_ele, int in_n_eles, int in_ele_start, int in_ele_end)
+{
+  const int n_fields = N_DIMS+2;
+
+  int n_upts_eles=in_ld*in_n_eles;
+
+#pragma omp parallel for schedule(static)
+  for(int i=in_ele_start;i<in_ele_end;i++)
+  {
+    for(int j=0;j<in_n_upts_per_ele;j++)
+    {
+      int upt=j+in_ld*i;
+      double* JGinv=in_JGinv_upts+N_DIMS*N_DIMS*(j+in_n_upts_per_ele*i);
+
+      double u[n_fields];
+      double v[N_DIMS];
+      double f[n_fields][N_DIMS];
+
+      for(int k=0;k<n_fields;k++)
+        u[k]=in_disu_upts[upt+n_upts_eles*k];
+
+      double ke=0.;
+      for(int l=0;l<N_DIMS;l++)
+      {
+        v[l]=u[l+1]/u[0];
+        ke+=v[l]*v[l];
+      }
+
+      double p=(in_gamma-1.0)*(u[n_fields-1]-(0.5*u[0]*ke));
+
+      for(int l=0;l<N_DIMS;l++)
+      {
+        f[0][l]=u[l+1];
+        for(int k=1;k<=N_DIMS;k++)
+          f[k][l]=u[k]*v[l];
+        f[l+1][l]+=p;
+        f[n_fields-1][l]=v[l]*(u[n_fields-1]+p);
+      }
+
+      for(int k=0;k<n_fields;k++)
+      {
+        for(int l=0;l<N_DIMS;l++)
+        {
+          double sum=0.;
+          for(int m=0;m<N_DIMS;m++)
+            sum+=JGinv[l+N_DIMS*m]*f[k][m];
+
+          out_tdisf_upts[upt+n_upts_eles*(k+n_fields*l)]=sum;
+        }
+      }
+    }
+  }
+}
+
+// dense operator on a block of W elements in the AoSoA layout. Rows of the output are accumulated R at a time over
+// the operator columns in registers, each in the same order as dgemm. The loops over the lanes and rows have a
+// fixed length, so they become whole vector instructions
+
+template<int W, int R>
+void aosoa_opp_rows(double* in_opp, int in_n_rows, int in_n_inner, double* in_ptr, double in_beta, double* out_ptr)
+{
+  double c[R][W];
+
+  for(int r=0;r<R;r++)
+  {
+    if(in_beta==0.)
+      for(int e=0;e<W;e++)
+        c[r][e]=0.;
+    else if(in_beta!=1.)
+      for(int e=0;e<W;e++)
+        c[r][e]=in_beta*out_ptr[e+W*r];
+    else
+      for(int e=0;e<W;e++)
+        c[r][e]=out_ptr[e+W*r];
+  }
+
+  for(int l=0;l<in_n_inner;l++)
+  {
+    for(int r=0;r<R;r++)
+    {
+      double a_rl=in_opp[r+in_n_rows*l];
+      for(int e=0;e<W;e++)
+        c[r][e]+=in_ptr[e+W*l]*a_rl;
+    }
+  }
+
+  for(int r=0;r<R;r++)
+    for(int e=0;e<W;e++)
+      out_ptr[e+W*r]=c[r][e];
+}
+
+template<int W>
+void aosoa_opp(double* in_opp, int in_n_rows, int in_n_inner, double* in_ptr, double in_beta, double* out_ptr)
+{
+  const int R=(W>4 ? 2 : 4);
+
+  int i=0;
+  for(;i+R<=in_n_rows;i+=R)
+    aosoa_opp_rows<W,R>(in_opp+i,in_n_rows,in_n_inner,in_ptr,in_beta,out_ptr+W*i);
+  for(;i<in_n_rows;i++)
+    aosoa_opp_rows<W,1>(in_opp+i,in_n_rows,in_n_inner,in_ptr,in_beta,out_ptr+W*i);
+}
+
+// dense operator packed in panels of SMALL_GEMM_MR rows, each panel stored column by column so that the rows of
+// a panel are contiguous for every operator column. A column of the output is accumulated a panel at a time in
+// registers, in the same order as dgemm. The last panel holds the REM remaining rows, its kernel is chosen from
+// the number of rows of the operator. A panel of 2, 4 or 8 rows has a zero row added: gcc vectorizes the loop
+// over the operator columns instead for those, with interleaved loads that are much slower
+
+template<int REM>
+struct small_gemm_pad
+{
+  enum { value = (REM>1 && (REM&(REM-1))==0) ? REM+1 : REM };
+};
+
+template<int R, int N_OUT>
+inline void small_gemm_panel(double* in_panel, int in_n_inner, int in_n_in, int in_stride, double* in_col, double in_beta, double* out_col)
+{
+  double c[R];
+
+  for(int r=0;r<R;r++)
+  {
+    if(in_beta==0. || r>=N_OUT)
+      c[r]=0.;
+    else if(in_beta!=1.)
+      c[r]=in_beta*out_col[r];
+    else
+      c[r]=out_col[r];
+  }
+
+  for(int s=0;s<in_n_in;s++)
+  {
+    double* panel=in_panel+R*in_n_inner*s;
+    double* col=in_col+in_stride*s;
+
+    for(int l=0;l<in_n_inner;l++)
+    {
+      double b_l=col[l];
+      for(int r=0;r<R;r++)
+        c[r]+=b_l*panel[r+R*l];
+    }
+  }
+
+  for(int r=0;r<N_OUT;r++)
+    out_col[r]=c[r];
+}
+
+// in_n_cols columns of a stacked operator, the in_n_in operators side by side applied to inputs in_stride apart and
+// summed in a single accumulation, which is the order of one dgemm per input with beta 1 after the first
+
+template<int REM>
+void small_gemm_block(double* in_packed, int in_n_rows, int in_n_inner, int in_n_in, int in_stride, double* in_ptr, int in_ld, int in_n_cols, double in_beta, double* out_ptr, int out_ld)
+{
+  const int MR=SMALL_GEMM_MR;
+  const int R=(REM>0 ? REM : 1);
+  int n_full=in_n_rows-REM;
+  int n_packed_inner=in_n_inner*in_n_in;
+
+  for(int j=0;j<in_n_cols;j++)
+  {
+    double* in_col=in_ptr+j*in_ld;
+    double* out_col=out_ptr+j*out_ld;
+
+    for(int i=0;i<n_full;i+=MR)
+      small_gemm_panel<MR,MR>(in_packed+i*n_packed_inner,in_n_inner,in_n_in,in_stride,in_col,in_beta,out_col+i);
+
+    if(REM>0)
+      small_gemm_panel<small_gemm_pad<R>::value,R>(in_packed+n_full*n_packed_inner,in_n_inner,in_n_in,in_stride,in_col,in_beta,out_col+n_full);
+  }
+}
+
+template<int REM>
+void small_gemm(double* in_packed, int in_n_rows, int in_n_inner, double* in_ptr, int in_ld, int in_n_cols, double in_beta, double* out_ptr, int out_ld)
+{
+#pragma omp parallel for schedule(static)
+  for(int j=0;j<in_n_cols;j++)
+    small_gemm_block<REM>(in_packed,in_n_rows,in_n_inner,1,0,in_ptr+j*in_ld,in_ld,1,in_beta,out_ptr+j*out_ld,out_ld);
+}
+
+// in_n_out stacked operators applied to the columns of elements in_ele_start to in_ele_end-1, SMALL_GEMM_NC columns
+// of a field at a time so that the inputs of a chunk are read from memory once for all outputs
+
+void stacked_opp(int in_n_out, double** in_packed, int* in_n_rows, int in_n_inner, int in_n_in, double* in_ptr, int in_ld, int in_stride, double in_beta, double** out_ptr, int* out_ld, int in_n_eles, int in_n_fields, int in_ele_start, int in_ele_end)
+{
+  small_gemm_block_kernel block_kernel[SMALL_GEMM_MAX_OUT];
+
+  for(int o=0;o<in_n_out;o++)
+    block_kernel[o]=get_small_gemm_block_kernel(in_n_rows[o]);
+
+  int n_block=in_ele_end-in_ele_start;
+  int n_chunks=(n_block+SMALL_GEMM_NC-1)/SMALL_GEMM_NC;
+
+#pragma omp parallel for schedule(static)
+  for(int i=0;i<in_n_fields*n_chunks;i++)
+  {
+    int start=(i%n_chunks)*SMALL_GEMM_NC;
+    int n_cols=(n_block-start<SMALL_GEMM_NC ? n_block-start : SMALL_GEMM_NC);
+    int col=(i/n_chunks)*in_n_eles+in_ele_start+start;
+
+    for(int o=0;o<in_n_out;o++)
+      block_kernel[o](in_packed[o],in_n_rows[o],in_n_inner,in_n_in,in_stride,in_ptr+col*in_ld,in_ld,n_cols,in_beta,out_ptr[o]+col*out_ld[o],out_ld[o]);
+  }
+}
+
+// rows of the packed operator, with the last panel padded as in small_gemm
+
+int get_small_gemm_rows(int in_n_rows)
+{
+  int rem=in_n_rows%SMALL_GEMM_MR;
+
+  if(rem>1 && (rem&(rem-1))==0)
+    return in_n_rows+1;
+
+  return in_n_rows;
+}
+
+int get_small_gemm_size(int in_n_rows, int in_n_inner)
+{
+  return get_small_gemm_rows(in_n_rows)*in_n_inner;
+}
+
+void pack_small_gemm(double* in_opp, int in_n_rows, int in_n_inner, double* out_packed)
+{
+  int n_rows_packed=get_small_gemm_rows(in_n_rows);
+
+  for(int i=0;i<n_rows_packed;i+=SMALL_GEMM_MR)
+  {
+    int n_panel=(n_rows_packed-i<SMALL_GEMM_MR ? n_rows_packed-i : SMALL_GEMM_MR);
+
+    for(int l=0;l<in_n_inner;l++)
+      for(int r=0;r<n_panel;r++)
+        out_packed[i*in_n_inner+r+n_panel*l]=(i+r<in_n_rows ? in_opp[i+r+in_n_rows*l] : 0.);
+  }
+}
+
+// sparse operator in the one-based four-array csr format of array_to_mklcsr, applied column by column. Each row
+// is accumulated over its non-zeros in increasing column order, so skipping the zeros is the only difference
+// from dgemm
+
+void csr_opp(double* in_data, int* in_cols, int* in_b, int* in_e, int in_n_rows, double* in_ptr, int in_ld, int in_n_cols, double in_beta, double* out_ptr, int out_ld)
+{
+  // shift to one-based indexing
+  double* data=in_data-1;
+  int* cols=in_cols-1;
+
+#pragma omp parallel for schedule(static)
+  for(int j=0;j<in_n_cols;j++)
+  {
+    double* in_col=in_ptr+j*in_ld-1;
+    double* out_col=out_ptr+j*out_ld;
+
+    for(int i=0;i<in_n_rows;i++)
+    {
+      double sum;
+
+      if(in_beta==0.)
+        sum=0.;
+      else if(in_beta!=1.)
+        sum=in_beta*out_col[i];
+      else
+        sum=out_col[i];
+
+      for(int k=in_b[i];k<in_e[i];k++)
+        sum+=in_col[cols[k]]*data[k];
+
+      out_col[i]=sum;
+    }
+  }
+}
+
+// flux point values copied from the solution points they coincide with
+
+void gather_fpts(int* in_fpt_upt, int in_n_fpts, double* in_ptr, int in_ld, double* out_ptr, int in_n_eles, int in_n_fields, int in_ele_start, int in_ele_end)
+{
+  int n_block=in_ele_end-in_ele_start;
+
+#pragma omp parallel for schedule(static)
+  for(int i=0;i<in_n_fields*n_block;i++)
+  {
+    int col=(i/n_block)*in_n_eles+in_ele_start+i%n_block;
+    double* in_col=in_ptr+col*in_ld;
+    double* out_col=out_ptr+col*in_n_fpts;
+
+    for(int j=0;j<in_n_fpts;j++)
+      out_col[j]=in_col[in_fpt_upt[j]];
+  }
+}
+
+// kernel selection
+
+tensor_deriv_kernel get_tensor_deriv_kernel(int in_n_dims, int in_n_upts_1d)
+{
+  if(in_n_dims==2)
+  {
+    switch(in_n_upts_1d)
+    {
+      case 2: return &tensor_deriv<2,2>;
+      case 3: return &tensor_deriv<3,2>;
+      case 4: return &tensor_deriv<4,2>;
+      case 5: return &tensor_deriv<5,2>;
+      case 6: return &tensor_deriv<6,2>;
+      case 7: return &tensor_deriv<7,2>;
+      case 8: return &tensor_deriv<8,2>;
+    }
+  }
+  else if(in_n_dims==3)
+  {
+    switch(in_n_upts_1d)
+    {
+      case 2: return &tensor_deriv<2,3>;
+      case 3: return &tensor_deriv<3,3>;
+      case 4: return &tensor_deriv<4,3>;
+      case 5: return &tensor_deriv<5,3>;
+      case 6: return &tensor_deriv<6,3>;
+      case 7: return &tensor_deriv<7,3>;
+    }
+  }
+
+  return NULL;
+}
+
+tensor_extrap_kernel get_tensor_extrap_kernel(int in_n_dims, int in_n_upts_1d)
+{
+  if(in_n_dims==2)
+  {
+    switch(in_n_upts_1d)
+    {
+      case 2: return &tensor_extrap<2,2>;
+      case 3: return &tensor_extrap<3,2>;
+      case 4: return &tensor_extrap<4,2>;
+      case 5: return &tensor_extrap<5,2>;
+      case 6: return &tensor_extrap<6,2>;
+      case 7: return &tensor_extrap<7,2>;
+      case 8: return &tensor_extrap<8,2>;
+    }
+  }
+  else if(in_n_dims==3)
+  {
+    switch(in_n_upts_1d)
+    {
+      case 2: return &tensor_extrap<2,3>;
+      case 3: return &tensor_extrap<3,3>;
+      case 4: return &tensor_extrap<4,3>;
+      case 5: return &tensor_extrap<5,3>;
+      case 6: return &tensor_extrap<6,3>;
+      case 7: return &tensor_extrap<7,3>;
+    }
+  }
+
+  return NULL;
+}
+
+tensor_correct_kernel get_tensor_correct_kernel(int in_n_dims, int in_n_upts_1d)
+{
+  if(in_n_dims==2)
+  {
+    switch(in_n_upts_1d)
+    {
+      case 2: return &tensor_correct<2,2>;
+      case 3: return &tensor_correct<3,2>;
+      case 4: return &tensor_correct<4,2>;
+      case 5: return &tensor_correct<5,2>;
+      case 6: return &tensor_correct<6,2>;
+      case 7: return &tensor_correct<7,2>;
+      case 8: return &tensor_correct<8,2>;
+    }
+  }
+  else if(in_n_dims==3)
+  {
+    switch(in_n_upts_1d)
+    {
+      case 2: return &tensor_correct<2,3>;
+      case 3: return &tensor_correct<3,3>;
+      case 4: return &tensor_correct<4,3>;
+      case 5: return &tensor_correct<5,3>;
+      case 6: return &tensor_correct<6,3>;
+      case 7: return &tensor_correct<7,3>;
+    }
+  }
+
+  return NULL;
+}
+
+invFlux_kernel get_invFlux_kernel(int in_n_dims, int in_n_fields)
+{
+  if(in_n_dims==2 && in_n_fields==4)
+    return &invFlux_euler<2>;
+  else if(in_n_dims==3 && in_n_fields==5)
+    return &invFlux_euler<3>;
+
+  return NULL;
+}
+
+aosoa_opp_kernel get_aosoa_opp_kernel(int in_width)
+{
+  switch(in_width)
+  {
+    case 2: return &aosoa_opp<2>;
+    case 4: return &aosoa_opp<4>;
+    case 8: return &aosoa_opp<8>;
+    case 16: return &aosoa_opp<16>;
+  }
+
+  return NULL;
+}
+
+small_gemm_kernel get_small_gemm_kernel(int in_n_rows)
+{
+  switch(in_n_rows%SMALL_GEMM_MR)
+  {
+    case 0: return &small_gemm<0>;
+    case 1: return &small_gemm<1>;
+    case 2: return &small_gemm<2>;
+    case 3: return &small_gemm<3>;
+    case 4: return &small_gemm<4>;
+    case 5: return &small_gemm<5>;
+    case 6: return &small_gemm<6>;
+    case 7: return &small_gemm<7>;
+    case 8: return &small_gemm<8>;
+    case 9: return &small_gemm<9>;
+    case 10: return &small_gemm<10>;
+    case 11: return &small_gemm<11>;
+  }
+
+  return NULL;
+}
+
+small_gemm_block_kernel get_small_gemm_block_kernel(int in_n_rows)
+{
+  switch(in_n_rows%SMALL_GEMM_MR)
+  {
+    case 0: return &small_gemm_block<0>;
+    case 1: return &small_gemm_block<1>;
+    case 2: return &small_gemm_block<2>;
+    case 3: return &small_gemm_block<3>;
+    case 4: return &small_gemm_block<4>;
+    case 5: return &small_gemm_block<5>;
+    case 6: return &small_gemm_block<6>;
+    case 7: return &small_gemm_block<7>;
+    case 8: return &small_gemm_block<8>;
+    case 9: return &small_gemm_block<9>;
+    case 10: return &small_gemm_block<10>;
+    case 11: return &small_gemm_block<11>;
+  }
+
+  return NULL;
+}
@@ -58,6 +58,8 @@ void eles_pris::setup_ele_type_specific()
   ele_type=3;
   n_dims=3;
 
+  setup_opp_cache();
+
   if (run_input.equation==0)
     n_fields=5;
   else if (run_input.equation==1)
@@ -117,12 +119,7 @@ void eles_pris::setup_ele_type_specific()
       set_opp_4(run_input.sparse_pri);
       set_opp_5(run_input.sparse_pri);
       set_opp_6(run_input.sparse_pri);
-
-      temp_grad_u.setup(n_fields,n_dims);
     }
-
-  temp_u.setup(n_fields);
-  temp_f.setup(n_fields,n_dims);
 }
 
 // set shape
@@ -449,7 +446,7 @@ void eles_pris::set_inters_cubpts(void)
 
 
 // Compute the surface jacobian determinant on a face
-double eles_pris::compute_inter_detjac_inters_cubpts(int in_inter,array<double> d_pos)
+double eles_pris::compute_inter_detjac_inters_cubpts(int in_inter,array<double>& d_pos)
 {
   double output = 0.;
   double xr, xs, xt;
@@ -628,13 +625,25 @@ void eles_pris::set_vandermonde_tri()
 {
   vandermonde_tri.setup(n_upts_tri,n_upts_tri);
 
-  // create the vandermonde matrix
-  for (int i=0;i<n_upts_tri;i++)
-    for (int j=0;j<n_upts_tri;j++)
-      vandermonde_tri(i,j) = eval_dubiner_basis_2d(loc_upts_pri_tri(0,i),loc_upts_pri_tri(1,i),j,order);
+  if(!cached_opps.get("vandermonde_tri",vandermonde_tri))
+  {
+    // create the vandermonde matrix
+    array<double> dubiner_basis_at_loc;
+    for (int i=0;i<n_upts_tri;i++) {
+        eval_dubiner_basis_2d_modes(loc_upts_pri_tri(0,i),loc_upts_pri_tri(1,i),order,dubiner_basis_at_loc);
+        for (int j=0;j<n_upts_tri;j++)
+          vandermonde_tri(i,j) = dubiner_basis_at_loc(j);
+      }
+    cached_opps.put("vandermonde_tri",vandermonde_tri);
+  }
 
   // Store its inverse
-  inv_vandermonde_tri = inv_array(vandermonde_tri);
+  inv_vandermonde_tri.setup(vandermonde_tri.get_dim(0),vandermonde_tri.get_dim(1));
+  if(!cached_opps.get("inv_vandermonde_tri",inv_vandermonde_tri))
+  {
+    inv_vandermonde_tri = inv_array(vandermonde_tri);
+    cached_opps.put("inv_vandermonde_tri",inv_vandermonde_tri);
+  }
 }
 
 // initialize the vandermonde matrix
@@ -644,9 +653,12 @@ void eles_pris::set_vandermonde_tri_restart()
   vandermonde_tri_rest.setup(n_upts_tri_rest,n_upts_tri_rest);
 
   // create the vandermonde matrix
-  for (int i=0;i<n_upts_tri_rest;i++)
-    for (int j=0;j<n_upts_tri_rest;j++)
-      vandermonde_tri_rest(i,j) = eval_dubiner_basis_2d(loc_upts_pri_tri_rest(0,i),loc_upts_pri_tri_rest(1,i),j,order_rest);
+  array<double> dubiner_basis_at_loc;
+  for (int i=0;i<n_upts_tri_rest;i++) {
+      eval_dubiner_basis_2d_modes(loc_upts_pri_tri_rest(0,i),loc_upts_pri_tri_rest(1,i),order_rest,dubiner_basis_at_loc);
+      for (int j=0;j<n_upts_tri_rest;j++)
+        vandermonde_tri_rest(i,j) = dubiner_basis_at_loc(j);
+    }
 
   // Store its inverse
   inv_vandermonde_tri_rest = inv_array(vandermonde_tri_rest);
@@ -727,7 +739,7 @@ void eles_pris::write_restart_info(ofstream& restart_file)
 
 // evaluate nodal basis
 
-double eles_pris::eval_nodal_basis(int in_index, array<double> in_loc)
+double eles_pris::eval_nodal_basis(int in_index, array<double>& in_loc)
 {
   double oned_nodal_basis_at_loc;
   double tri_nodal_basis_at_loc;
@@ -737,15 +749,14 @@ double eles_pris::eval_nodal_basis(int in_index, array<double> in_loc)
 
   // 1. First evaluate the triangular nodal basis at loc(0) and loc(1)
 
-  // First evaluate the normalized Dubiner basis at position in_loc
-  array<double> dubiner_basis_at_loc(n_upts_tri);
-  for (int i=0;i<n_upts_tri;i++)
-    dubiner_basis_at_loc(i) = eval_dubiner_basis_2d(in_loc(0),in_loc(1),i,order);
+  // First evaluate the normalized Dubiner basis at position in_loc, unless it was the last position in the triangle
+  if (!check_basis_memo(in_loc,2,order,basis_memo_loc,basis_memo_order))
+    eval_dubiner_basis_2d_modes(in_loc(0),in_loc(1),order,basis_memo);
 
   // From Hesthaven, equation 3.3, V^T * l = P, or l = (V^-1)^T P
   tri_nodal_basis_at_loc = 0.;
   for (int i=0;i<n_upts_tri;i++)
-    tri_nodal_basis_at_loc += inv_vandermonde_tri(i,index_tri)*dubiner_basis_at_loc(i);
+    tri_nodal_basis_at_loc += inv_vandermonde_tri(i,index_tri)*basis_memo(i);
 
   // 2. Now evaluate the 1D lagrange basis at loc(2)
   oned_nodal_basis_at_loc = eval_lagrange(in_loc(2),index_1d,loc_upts_pri_1d);
@@ -756,7 +767,7 @@ double eles_pris::eval_nodal_basis(int in_index, array<double> in_loc)
 
 // evaluate nodal basis for restart
 
-double eles_pris::eval_nodal_basis_restart(int in_index, array<double> in_loc)
+double eles_pris::eval_nodal_basis_restart(int in_index, array<double>& in_loc)
 {
   double oned_nodal_basis_at_loc;
   double tri_nodal_basis_at_loc;
@@ -766,15 +777,14 @@ double eles_pris::eval_nodal_basis_restart(int in_index, array<double> in_loc)
 
   // 1. First evaluate the triangular nodal basis at loc(0) and loc(1)
 
-  // First evaluate the normalized Dubiner basis at position in_loc
-  array<double> dubiner_basis_at_loc(n_upts_tri_rest);
-  for (int i=0;i<n_upts_tri_rest;i++)
-    dubiner_basis_at_loc(i) = eval_dubiner_basis_2d(in_loc(0),in_loc(1),i,order_rest);
+  // First evaluate the normalized Dubiner basis at position in_loc, unless it was the last position in the triangle
+  if (!check_basis_memo(in_loc,2,order_rest,basis_memo_loc,basis_memo_order))
+    eval_dubiner_basis_2d_modes(in_loc(0),in_loc(1),order_rest,basis_memo);
 
   // From Hesthaven, equation 3.3, V^T * l = P, or l = (V^-1)^T P
   tri_nodal_basis_at_loc = 0.;
   for (int i=0;i<n_upts_tri_rest;i++)
-    tri_nodal_basis_at_loc += inv_vandermonde_tri_rest(i,index_tri)*dubiner_basis_at_loc(i);
+    tri_nodal_basis_at_loc += inv_vandermonde_tri_rest(i,index_tri)*basis_memo(i);
 
   // 2. Now evaluate the 1D lagrange basis at loc(2)
   oned_nodal_basis_at_loc = eval_lagrange(in_loc(2),index_1d,loc_upts_pri_1d_rest);
@@ -784,7 +794,7 @@ double eles_pris::eval_nodal_basis_restart(int in_index, array<double> in_loc)
 
 // evaluate derivative of nodal basis
 
-double eles_pris::eval_d_nodal_basis(int in_index, int in_cpnt, array<double> in_loc)
+double eles_pris::eval_d_nodal_basis(int in_index, int in_cpnt, array<double>& in_loc)
 {
   double out_d_nodal_basis_at_loc;
 
@@ -798,19 +808,14 @@ double eles_pris::eval_d_nodal_basis(int in_index, int in_cpnt, array<double> in
 
       // 1. Evaluate the derivative of triangular nodal basis at loc(0) and loc(1)
 
-      // Evalute the derivative normalized Dubiner basis at position in_loc
-      array<double> d_dubiner_basis_at_loc(n_upts_per_ele);
-      for (int i=0;i<n_upts_tri;i++) {
-          if (in_cpnt==0)
-            d_dubiner_basis_at_loc(i) = eval_dr_dubiner_basis_2d(in_loc(0),in_loc(1),i,order);
-          else if (in_cpnt==1)
-            d_dubiner_basis_at_loc(i) = eval_ds_dubiner_basis_2d(in_loc(0),in_loc(1),i,order);
-        }
+      // Evalute the derivative normalized Dubiner basis at position in_loc, unless it was the last position in the triangle
+      if (!check_basis_memo(in_loc,2,order,d_basis_memo_loc,d_basis_memo_order))
+        eval_grad_dubiner_basis_2d_modes(in_loc(0),in_loc(1),order,d_basis_memo);
 
       // From Hesthaven, equation 3.3, V^T * l = P, or l = (V^-1)^T P
       d_tri_nodal_basis_at_loc = 0.;
       for (int i=0;i<n_upts_tri;i++)
-        d_tri_nodal_basis_at_loc += inv_vandermonde_tri(i,index_tri)*d_dubiner_basis_at_loc(i);
+        d_tri_nodal_basis_at_loc += inv_vandermonde_tri(i,index_tri)*d_basis_memo(i,in_cpnt);
 
       // 2. Evaluate the 1d nodal basis at loc(2)
       oned_nodal_basis_at_loc = eval_lagrange(in_loc(2),index_1d,loc_upts_pri_1d);
@@ -825,15 +830,14 @@ double eles_pris::eval_d_nodal_basis(int in_index, int in_cpnt, array<double> in
 
       // 1. First evaluate the triangular nodal basis at loc(0) and loc(1)
 
-      // Evaluate the normalized Dubiner basis at position in_loc
-      array<double> dubiner_basis_at_loc(n_upts_tri);
-      for (int i=0;i<n_upts_tri;i++)
-        dubiner_basis_at_loc(i) = eval_dubiner_basis_2d(in_loc(0),in_loc(1),i,order);
+      // Evaluate the normalized Dubiner basis at position in_loc, unless it was the last position in the triangle
+      if (!check_basis_memo(in_loc,2,order,basis_memo_loc,basis_memo_order))
+        eval_dubiner_basis_2d_modes(in_loc(0),in_loc(1),order,basis_memo);
 
       // From Hesthaven, equation 3.3, V^T * l = P, or l = (V^-1)^T P
       tri_nodal_basis_at_loc = 0.;
       for (int i=0;i<n_upts_tri;i++)
-        tri_nodal_basis_at_loc += inv_vandermonde_tri(i,index_tri)*dubiner_basis_at_loc(i);
+        tri_nodal_basis_at_loc += inv_vandermonde_tri(i,index_tri)*basis_memo(i);
 
       // 2. Then evaluate teh derivative of 1d nodal basis at loc(2)
       d_oned_nodal_basis_at_loc = eval_d_lagrange(in_loc(2),index_1d,loc_upts_pri_1d);
@@ -849,7 +853,7 @@ double eles_pris::eval_d_nodal_basis(int in_index, int in_cpnt, array<double> in
 
 // evaluate nodal shape basis
 
-double eles_pris::eval_nodal_s_basis(int in_index, array<double> in_loc, int in_n_spts)
+double eles_pris::eval_nodal_s_basis(int in_index, array<double>& in_loc, int in_n_spts)
 {
 
   double nodal_s_basis;
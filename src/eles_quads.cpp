@@ -74,6 +74,8 @@ void eles_quads::setup_ele_type_specific()
   ele_type=1;
   n_dims=2;
 
+  setup_opp_cache();
+
   if (run_input.equation==0)
     n_fields=4;
   else if (run_input.equation==1)
@@ -131,14 +133,12 @@ void eles_quads::setup_ele_type_specific()
       set_opp_5(run_input.sparse_quad);
       set_opp_6(run_input.sparse_quad);
 
-      temp_grad_u.setup(n_fields,n_dims);
-
       // Compute quad filter matrix
       if(filter) compute_filter_upts();
     }
 
-  temp_u.setup(n_fields);
-  temp_f.setup(n_fields,n_dims);
+  if(run_input.sparse_quad==2)
+    set_opp_tensor();
 
   set_area_coord();  // Not sure if this is the right place to call it - check later (some differences in the master version)
 }
@@ -384,7 +384,7 @@ void eles_quads::set_volume_cubpts(void)
 }
 
 // Compute the surface jacobian determinant on a face
-double eles_quads::compute_inter_detjac_inters_cubpts(int in_inter,array<double> d_pos)
+double eles_quads::compute_inter_detjac_inters_cubpts(int in_inter,array<double>& d_pos)
 {
   double output = 0.;
   double xr, xs;
@@ -852,7 +852,7 @@ void eles_quads::set_area_coord(void)
 
 // evaluate nodal basis
 
-double eles_quads::eval_nodal_basis(int in_index, array<double> in_loc)
+double eles_quads::eval_nodal_basis(int in_index, array<double>& in_loc)
 {
   int i,j;
 
@@ -869,7 +869,7 @@ double eles_quads::eval_nodal_basis(int in_index, array<double> in_loc)
 
 // evaluate nodal basis using restart points
 
-double eles_quads::eval_nodal_basis_restart(int in_index, array<double> in_loc)
+double eles_quads::eval_nodal_basis_restart(int in_index, array<double>& in_loc)
 {
   int i,j;
 
@@ -885,7 +885,7 @@ double eles_quads::eval_nodal_basis_restart(int in_index, array<double> in_loc)
 
 // evaluate derivative of nodal basis
 
-double eles_quads::eval_d_nodal_basis(int in_index, int in_cpnt, array<double> in_loc)
+double eles_quads::eval_d_nodal_basis(int in_index, int in_cpnt, array<double>& in_loc)
 {
   int i,j;
 
@@ -912,7 +912,7 @@ double eles_quads::eval_d_nodal_basis(int in_index, int in_cpnt, array<double> i
 
 // evaluate nodal shape basis
 
-double eles_quads::eval_nodal_s_basis(int in_index, array<double> in_loc, int in_n_spts)
+double eles_quads::eval_nodal_s_basis(int in_index, array<double>& in_loc, int in_n_spts)
 {
   int i,j;
   double nodal_s_basis;
@@ -1006,7 +1006,7 @@ void eles_quads::eval_d_nodal_s_basis(array<double> &d_nodal_s_basis, array<doub
 }
 
 // Evaluate 2D legendre basis
-double eles_quads::eval_legendre_basis_2D_hierarchical(int in_mode, array<double> in_loc, int in_basis_order)
+double eles_quads::eval_legendre_basis_2D_hierarchical(int in_mode, array<double>& in_loc, int in_basis_order)
 {
         double leg_basis;
 
@@ -74,6 +74,8 @@ void eles_tets::setup_ele_type_specific()
   ele_type=2;
   n_dims=3;
 
+  setup_opp_cache();
+
   if (run_input.equation==0)
     n_fields=5;
   else if (run_input.equation==1)
@@ -130,14 +132,9 @@ void eles_tets::setup_ele_type_specific()
       set_opp_5(run_input.sparse_tet);
       set_opp_6(run_input.sparse_tet);
 
-      temp_grad_u.setup(n_fields,n_dims);
-
       // Compute tet filter matrix
       if(filter) compute_filter_upts();
     }
-
-  temp_u.setup(n_fields);
-  temp_f.setup(n_fields,n_dims);
 }
 
 void eles_tets::set_connectivity_plot()
@@ -450,7 +447,7 @@ void eles_tets::set_volume_cubpts(void)
 
 
 // Compute the surface jacobian determinant on a face
-double eles_tets::compute_inter_detjac_inters_cubpts(int in_inter,array<double> d_pos)
+double eles_tets::compute_inter_detjac_inters_cubpts(int in_inter,array<double>& d_pos)
 {
 
   double output = 0.;
@@ -634,6 +631,9 @@ void eles_tets::compute_filter_upts(void)
 
   filter_upts.setup(N,N);
 
+  if(cached_opps.get("filter_upts",filter_upts))
+    return;
+
   X = loc_upts;
 
   N2 = N/2;
@@ -713,6 +713,8 @@ void eles_tets::compute_filter_upts(void)
   for(i=0;i<N;i++)
     for(j=0;j<N;j++)
       sum+=filter_upts(i,j);
+
+  cached_opps.put("filter_upts",filter_upts);
 }
 
 
@@ -723,13 +725,25 @@ void eles_tets::set_vandermonde(void)
 {
   vandermonde.setup(n_upts_per_ele,n_upts_per_ele);
 
-  // create the vandermonde matrix
-  for (int i=0;i<n_upts_per_ele;i++)
-    for (int j=0;j<n_upts_per_ele;j++)
-      vandermonde(i,j) = eval_dubiner_basis_3d(loc_upts(0,i),loc_upts(1,i),loc_upts(2,i),j,order);
+  if(!cached_opps.get("vandermonde",vandermonde))
+  {
+    // create the vandermonde matrix
+    array<double> dubiner_basis_at_loc;
+    for (int i=0;i<n_upts_per_ele;i++) {
+        eval_dubiner_basis_3d_modes(loc_upts(0,i),loc_upts(1,i),loc_upts(2,i),order,dubiner_basis_at_loc);
+        for (int j=0;j<n_upts_per_ele;j++)
+          vandermonde(i,j) = dubiner_basis_at_loc(j);
+      }
+    cached_opps.put("vandermonde",vandermonde);
+  }
 
   // Store its inverse
-  inv_vandermonde = inv_array(vandermonde);
+  inv_vandermonde.setup(vandermonde.get_dim(0),vandermonde.get_dim(1));
+  if(!cached_opps.get("inv_vandermonde",inv_vandermonde))
+  {
+    inv_vandermonde = inv_array(vandermonde);
+    cached_opps.put("inv_vandermonde",inv_vandermonde);
+  }
 }
 
 // initialize the vandermonde matrix
@@ -738,9 +752,12 @@ void eles_tets::set_vandermonde_restart()
   vandermonde.setup(n_upts_per_ele_rest,n_upts_per_ele_rest);
 
   // create the vandermonde matrix
-  for (int i=0;i<n_upts_per_ele_rest;i++)
-    for (int j=0;j<n_upts_per_ele_rest;j++)
-      vandermonde(i,j) = eval_dubiner_basis_3d(loc_upts_rest(0,i),loc_upts_rest(1,i),loc_upts_rest(2,i),j,order_rest);
+  array<double> dubiner_basis_at_loc;
+  for (int i=0;i<n_upts_per_ele_rest;i++) {
+      eval_dubiner_basis_3d_modes(loc_upts_rest(0,i),loc_upts_rest(1,i),loc_upts_rest(2,i),order_rest,dubiner_basis_at_loc);
+      for (int j=0;j<n_upts_per_ele_rest;j++)
+        vandermonde(i,j) = dubiner_basis_at_loc(j);
+    }
 
   // Store its inverse
   inv_vandermonde_rest = inv_array(vandermonde);
@@ -802,64 +819,61 @@ void eles_tets::write_restart_info(ofstream& restart_file)
 
 // evaluate nodal basis
 
-double eles_tets::eval_nodal_basis(int in_index, array<double> in_loc)
+double eles_tets::eval_nodal_basis(int in_index, array<double>& in_loc)
 {
-  array<double> dubiner_basis_at_loc(n_upts_per_ele);
   double out_nodal_basis_at_loc;
 
-  // First evaluate the normalized Dubiner basis at position in_loc
-  for (int i=0;i<n_upts_per_ele;i++)
-    dubiner_basis_at_loc(i) = eval_dubiner_basis_3d(in_loc(0),in_loc(1),in_loc(2),i,order);
+  // First evaluate the normalized Dubiner basis at position in_loc, unless it was the last position
+  if (!check_basis_memo(in_loc,3,order,basis_memo_loc,basis_memo_order))
+    eval_dubiner_basis_3d_modes(in_loc(0),in_loc(1),in_loc(2),order,basis_memo);
 
   // From Hesthaven, equation 3.3, V^T * l = P, or l = (V^-1)^T P
   out_nodal_basis_at_loc = 0.;
   for (int i=0;i<n_upts_per_ele;i++)
-    out_nodal_basis_at_loc += inv_vandermonde(i,in_index)*dubiner_basis_at_loc(i);
+    out_nodal_basis_at_loc += inv_vandermonde(i,in_index)*basis_memo(i);
 
   return out_nodal_basis_at_loc;
 }
 
 // evaluate nodal basis
 
-double eles_tets::eval_nodal_basis_restart(int in_index, array<double> in_loc)
+double eles_tets::eval_nodal_basis_restart(int in_index, array<double>& in_loc)
 {
-  array<double> dubiner_basis_at_loc(n_upts_per_ele_rest);
   double out_nodal_basis_at_loc;
 
-  // First evaluate the normalized Dubiner basis at position in_loc
-  for (int i=0;i<n_upts_per_ele_rest;i++)
-    dubiner_basis_at_loc(i) = eval_dubiner_basis_3d(in_loc(0),in_loc(1),in_loc(2),i,order_rest);
+  // First evaluate the normalized Dubiner basis at position in_loc, unless it was the last position
+  if (!check_basis_memo(in_loc,3,order_rest,basis_memo_loc,basis_memo_order))
+    eval_dubiner_basis_3d_modes(in_loc(0),in_loc(1),in_loc(2),order_rest,basis_memo);
 
   // From Hesthaven, equation 3.3, V^T * l = P, or l = (V^-1)^T P
   out_nodal_basis_at_loc = 0.;
   for (int i=0;i<n_upts_per_ele_rest;i++)
-    out_nodal_basis_at_loc += inv_vandermonde_rest(i,in_index)*dubiner_basis_at_loc(i);
+    out_nodal_basis_at_loc += inv_vandermonde_rest(i,in_index)*basis_memo(i);
 
   return out_nodal_basis_at_loc;
 }
 
 // evaluate derivative of nodal basis
 
-double eles_tets::eval_d_nodal_basis(int in_index, int in_cpnt, array<double> in_loc)
+double eles_tets::eval_d_nodal_basis(int in_index, int in_cpnt, array<double>& in_loc)
 {
-  array<double> d_dubiner_basis_at_loc(n_upts_per_ele);
   double out_d_nodal_basis_at_loc;
 
-  // First evaluate the derivative normalized Dubiner basis at position in_loc
-  for (int i=0;i<n_upts_per_ele;i++)
-    d_dubiner_basis_at_loc(i) = eval_grad_dubiner_basis_3d(in_loc(0),in_loc(1),in_loc(2),i,order,in_cpnt);
+  // First evaluate the derivative normalized Dubiner basis at position in_loc, unless it was the last position
+  if (!check_basis_memo(in_loc,3,order,d_basis_memo_loc,d_basis_memo_order))
+    eval_grad_dubiner_basis_3d_modes(in_loc(0),in_loc(1),in_loc(2),order,d_basis_memo);
 
   // From Hesthaven, equation 3.3, V^T * l = P, or l = (V^-1)^T P
   out_d_nodal_basis_at_loc = 0.;
   for (int i=0;i<n_upts_per_ele;i++)
-    out_d_nodal_basis_at_loc += inv_vandermonde(i,in_index)*d_dubiner_basis_at_loc(i);
+    out_d_nodal_basis_at_loc += inv_vandermonde(i,in_index)*d_basis_memo(i,in_cpnt);
 
   return out_d_nodal_basis_at_loc;
 }
 
 // evaluate nodal shape basis
 
-double eles_tets::eval_nodal_s_basis(int in_index, array<double> in_loc, int in_n_spts)
+double eles_tets::eval_nodal_s_basis(int in_index, array<double>& in_loc, int in_n_spts)
 {
   double nodal_s_basis;
 
@@ -1020,9 +1034,11 @@ double eles_tets::eval_div_dg_tet(int in_index, array<double>& loc)
   int face, face_fpt;
   double r,s,t;
   double r_face,s_face,face_jac;
-  double integral, edge_length, gdotn_at_cubpt;
+  double edge_length, gdotn_at_cubpt;
   double div_vcjh_basis;
 
+  array<double> integral(n_upts_per_ele);
+  array<double> dubiner_face, dubiner_vol;
   array<double> mtemp_0(n_fpts_per_inter(0),n_fpts_per_inter(0));
   array<double> gdotn(n_fpts_per_inter(0),1);
   array<double> coeff_gdotn(n_fpts_per_inter(0),1);
@@ -1065,8 +1081,9 @@ double eles_tets::eval_div_dg_tet(int in_index, array<double>& loc)
           s_face = r;
         }
 
+      eval_dubiner_basis_2d_modes(r_face,s_face,order,dubiner_face);
       for (int j=0;j<n_fpts_per_inter(0);j++)
-        mtemp_0(i,j) = eval_dubiner_basis_2d(r_face,s_face,j,order);
+        mtemp_0(i,j) = dubiner_face(j);
     }
 
   mtemp_0 = inv_array(mtemp_0);
@@ -1075,55 +1092,60 @@ double eles_tets::eval_div_dg_tet(int in_index, array<double>& loc)
   if (isnan(coeff_gdotn(0,0)))
     exit(1);
 
-  // 2. Perform the edge integrals to obtain coefficients sigma_i
-  for (int i=0;i<n_upts_per_ele;i++)
+  // 2. Perform the edge integrals to obtain coefficients sigma_i, evaluating all the Dubiner modes at each cubature point once
+  cubature_tri cub2d(12); //TODO: Check if strong enough
+  integral.initialize_to_zero();
+
+  for (int j=0;j<cub2d.get_n_pts();j++)
     {
-      cubature_tri cub2d(12); //TODO: Check if strong enough
-      integral = 0.;
+      r_face = cub2d.get_r(j);
+      s_face = cub2d.get_s(j);
 
-      for (int j=0;j<cub2d.get_n_pts();j++)
-        {
-          r_face = cub2d.get_r(j);
-          s_face = cub2d.get_s(j);
-
-          // Get the position along the edge
-          if (face==0) {
-              face_jac = sqrt(3.);
-              r = r_face;
-              t = s_face;
-              s = -1. -t -r;
-            }
-          else if (face==1) {
-              face_jac = 1.;
-              r = -1.0;
-              s = s_face;
-              t = r_face;
-            }
-          else if (face==2) {
-              face_jac = 1.;
-              r = r_face;
-              s = -1.0;
-              t = s_face;
-            }
-          else if (face==3) {
-              face_jac = 1.;
-              r = s_face;
-              s = r_face;
-              t = -1.0;
-            }
+      // Get the position along the edge
+      if (face==0) {
+          face_jac = sqrt(3.);
+          r = r_face;
+          t = s_face;
+          s = -1. -t -r;
+        }
+      else if (face==1) {
+          face_jac = 1.;
+          r = -1.0;
+          s = s_face;
+          t = r_face;
+        }
+      else if (face==2) {
+          face_jac = 1.;
+          r = r_face;
+          s = -1.0;
+          t = s_face;
+        }
+      else if (face==3) {
+          face_jac = 1.;
+          r = s_face;
+          s = r_face;
+          t = -1.0;
+        }
 
-          gdotn_at_cubpt = 0.;
-          for (int k=0;k<n_fpts_per_inter(0);k++)
-            gdotn_at_cubpt += coeff_gdotn(k,0)*eval_dubiner_basis_2d(r_face,s_face,k,order);
+      eval_dubiner_basis_2d_modes(r_face,s_face,order,dubiner_face);
+      eval_dubiner_basis_3d_modes(r,s,t,order,dubiner_vol);
 
-          integral += cub2d.get_weight(j)*eval_dubiner_basis_3d(r,s,t,i,order)*gdotn_at_cubpt;
-        }
-      coeff_divg(i,0) = integral*face_jac;
+      gdotn_at_cubpt = 0.;
+      for (int k=0;k<n_fpts_per_inter(0);k++)
+        gdotn_at_cubpt += coeff_gdotn(k,0)*dubiner_face(k);
+
+      for (int i=0;i<n_upts_per_ele;i++)
+        integral(i) += cub2d.get_weight(j)*dubiner_vol(i)*gdotn_at_cubpt;
     }
 
+  for (int i=0;i<n_upts_per_ele;i++)
+    coeff_divg(i,0) = integral(i)*face_jac;
+
+  eval_dubiner_basis_3d_modes(loc(0),loc(1),loc(2),order,dubiner_vol);
+
   div_vcjh_basis = 0.;
   for (int i=0;i<n_upts_per_ele;i++)
-    div_vcjh_basis += coeff_divg(i,0)*eval_dubiner_basis_3d(loc(0),loc(1),loc(2),i,order);
+    div_vcjh_basis += coeff_divg(i,0)*dubiner_vol(i);
 
   return div_vcjh_basis;
 
@@ -1222,11 +1244,13 @@ void eles_tets::compute_filt_matrix_tet(array<double>& Filt, int vcjh_scheme_tet
   run_input.c_tet = c_tet;
 
   // Evaluate the derivative normalized of Dubiner basis at position in_loc
+  array<double> grad_dubiner;
   for (int i=0;i<n_upts_per_ele;i++) {
+      eval_grad_dubiner_basis_3d_modes(loc_upts(0,i),loc_upts(1,i),loc_upts(2,i),order,grad_dubiner);
       for (int j=0;j<n_upts_per_ele;j++) {
-          tempr(i,j) = eval_grad_dubiner_basis_3d(loc_upts(0,i),loc_upts(1,i),loc_upts(2,i),j,order,0);
-          temps(i,j) = eval_grad_dubiner_basis_3d(loc_upts(0,i),loc_upts(1,i),loc_upts(2,i),j,order,1);
-          tempt(i,j) = eval_grad_dubiner_basis_3d(loc_upts(0,i),loc_upts(1,i),loc_upts(2,i),j,order,2);
+          tempr(i,j) = grad_dubiner(j,0);
+          temps(i,j) = grad_dubiner(j,1);
+          tempt(i,j) = grad_dubiner(j,2);
         }
     }
 
@@ -73,6 +73,8 @@ void eles_tris::setup_ele_type_specific()
   ele_type=0;
   n_dims=2;
 
+  setup_opp_cache();
+
 
   if (run_input.equation==0)
     n_fields=4;
@@ -127,14 +129,9 @@ void eles_tris::setup_ele_type_specific()
       set_opp_5(run_input.sparse_tri);
       set_opp_6(run_input.sparse_tri);
 
-      temp_grad_u.setup(n_fields,n_dims);
-
       // Compute tri filter matrix
       if(filter) compute_filter_upts();
     }
-
-  temp_u.setup(n_fields);
-  temp_f.setup(n_fields,n_dims);
 }
 
 void eles_tris::set_connectivity_plot()
@@ -348,7 +345,7 @@ void eles_tris::set_inters_cubpts(void)
 }
 
 // Compute the surface jacobian determinant on a face
-double eles_tris::compute_inter_detjac_inters_cubpts(int in_inter,array<double> d_pos)
+double eles_tris::compute_inter_detjac_inters_cubpts(int in_inter,array<double>& d_pos)
 {
   double output = 0.;
   double xr, xs, yr, ys;
@@ -482,13 +479,25 @@ void eles_tris::set_vandermonde(void)
   vandermonde.setup(n_upts_per_ele,n_upts_per_ele);
   inv_vandermonde.setup(n_upts_per_ele,n_upts_per_ele);
 
-  // create the vandermonde matrix
-  for (int i=0;i<n_upts_per_ele;i++)
-    for (int j=0;j<n_upts_per_ele;j++)
-      vandermonde(i,j) = eval_dubiner_basis_2d(loc_upts(0,i),loc_upts(1,i),j,order);
+  if(!cached_opps.get("vandermonde",vandermonde))
+  {
+    // create the vandermonde matrix
+    array<double> dubiner_basis_at_loc;
+    for (int i=0;i<n_upts_per_ele;i++) {
+        eval_dubiner_basis_2d_modes(loc_upts(0,i),loc_upts(1,i),order,dubiner_basis_at_loc);
+        for (int j=0;j<n_upts_per_ele;j++)
+          vandermonde(i,j) = dubiner_basis_at_loc(j);
+      }
+    cached_opps.put("vandermonde",vandermonde);
+  }
 
   // Store its inverse
-  inv_vandermonde = inv_array(vandermonde);
+  inv_vandermonde.setup(vandermonde.get_dim(0),vandermonde.get_dim(1));
+  if(!cached_opps.get("inv_vandermonde",inv_vandermonde))
+  {
+    inv_vandermonde = inv_array(vandermonde);
+    cached_opps.put("inv_vandermonde",inv_vandermonde);
+  }
 }
 
 // initialize the vandermonde matrix for the restart file
@@ -499,9 +508,12 @@ void eles_tris::set_vandermonde_restart()
   inv_vandermonde_rest.setup(n_upts_per_ele_rest,n_upts_per_ele_rest);
 
   // create the vandermonde matrix
-  for (int i=0;i<n_upts_per_ele_rest;i++)
-    for (int j=0;j<n_upts_per_ele_rest;j++)
-      vandermonde_rest(i,j) = eval_dubiner_basis_2d(loc_upts_rest(0,i),loc_upts_rest(1,i),j,order_rest);
+  array<double> dubiner_basis_at_loc;
+  for (int i=0;i<n_upts_per_ele_rest;i++) {
+      eval_dubiner_basis_2d_modes(loc_upts_rest(0,i),loc_upts_rest(1,i),order_rest,dubiner_basis_at_loc);
+      for (int j=0;j<n_upts_per_ele_rest;j++)
+        vandermonde_rest(i,j) = dubiner_basis_at_loc(j);
+    }
 
   // Store its inverse
   inv_vandermonde_rest = inv_array(vandermonde_rest);
@@ -564,65 +576,58 @@ void eles_tris::write_restart_info(ofstream& restart_file)
 }
 
 // evaluate nodal basis
-double eles_tris::eval_nodal_basis(int in_index, array<double> in_loc)
+double eles_tris::eval_nodal_basis(int in_index, array<double>& in_loc)
 {
-  array<double> dubiner_basis_at_loc(n_upts_per_ele);
   double out_nodal_basis_at_loc;
 
-  // First evaluate the normalized Dubiner basis at position in_loc
-  for (int i=0;i<n_upts_per_ele;i++)
-    dubiner_basis_at_loc(i) = eval_dubiner_basis_2d(in_loc(0),in_loc(1),i,order);
+  // First evaluate the normalized Dubiner basis at position in_loc, unless it was the last position
+  if (!check_basis_memo(in_loc,2,order,basis_memo_loc,basis_memo_order))
+    eval_dubiner_basis_2d_modes(in_loc(0),in_loc(1),order,basis_memo);
 
   // From Hesthaven, equation 3.3, V^T * l = P, or l = (V^-1)^T P
   out_nodal_basis_at_loc = 0.;
   for (int i=0;i<n_upts_per_ele;i++)
-    out_nodal_basis_at_loc += inv_vandermonde(i,in_index)*dubiner_basis_at_loc(i);
+    out_nodal_basis_at_loc += inv_vandermonde(i,in_index)*basis_memo(i);
 
   return out_nodal_basis_at_loc;
 }
 
 // evaluate nodal basis with restart points
-double eles_tris::eval_nodal_basis_restart(int in_index, array<double> in_loc)
+double eles_tris::eval_nodal_basis_restart(int in_index, array<double>& in_loc)
 {
-  array<double> dubiner_basis_at_loc(n_upts_per_ele_rest);
   double out_nodal_basis_at_loc;
 
-  // First evaluate the normalized Dubiner basis at position in_loc
-  for (int i=0;i<n_upts_per_ele_rest;i++)
-    dubiner_basis_at_loc(i) = eval_dubiner_basis_2d(in_loc(0),in_loc(1),i,order_rest);
+  // First evaluate the normalized Dubiner basis at position in_loc, unless it was the last position
+  if (!check_basis_memo(in_loc,2,order_rest,basis_memo_loc,basis_memo_order))
+    eval_dubiner_basis_2d_modes(in_loc(0),in_loc(1),order_rest,basis_memo);
 
   // From Hesthaven, equation 3.3, V^T * l = P, or l = (V^-1)^T P
   out_nodal_basis_at_loc = 0.;
   for (int i=0;i<n_upts_per_ele_rest;i++)
-    out_nodal_basis_at_loc += inv_vandermonde_rest(i,in_index)*dubiner_basis_at_loc(i);
+    out_nodal_basis_at_loc += inv_vandermonde_rest(i,in_index)*basis_memo(i);
 
   return out_nodal_basis_at_loc;
 }
 
 // evaluate derivative of nodal basis
-double eles_tris::eval_d_nodal_basis(int in_index, int in_cpnt, array<double> in_loc)
+double eles_tris::eval_d_nodal_basis(int in_index, int in_cpnt, array<double>& in_loc)
 {
-  array<double> d_dubiner_basis_at_loc(n_upts_per_ele);
   double out_d_nodal_basis_at_loc;
 
-  // First evaluate the derivative normalized Dubiner basis at position in_loc
-  for (int i=0;i<n_upts_per_ele;i++) {
-      if (in_cpnt==0)
-        d_dubiner_basis_at_loc(i) = eval_dr_dubiner_basis_2d(in_loc(0),in_loc(1),i,order);
-      else if (in_cpnt==1)
-        d_dubiner_basis_at_loc(i) = eval_ds_dubiner_basis_2d(in_loc(0),in_loc(1),i,order);
-    }
+  // First evaluate the derivative normalized Dubiner basis at position in_loc, unless it was the last position
+  if (!check_basis_memo(in_loc,2,order,d_basis_memo_loc,d_basis_memo_order))
+    eval_grad_dubiner_basis_2d_modes(in_loc(0),in_loc(1),order,d_basis_memo);
 
   // From Hesthaven, equation 3.3, V^T * l = P, or l = (V^-1)^T P
   out_d_nodal_basis_at_loc = 0.;
   for (int i=0;i<n_upts_per_ele;i++)
-    out_d_nodal_basis_at_loc += inv_vandermonde(i,in_index)*d_dubiner_basis_at_loc(i);
+    out_d_nodal_basis_at_loc += inv_vandermonde(i,in_index)*d_basis_memo(i,in_cpnt);
 
   return out_d_nodal_basis_at_loc;
 }
 
 // evaluate nodal shape basis
-double eles_tris::eval_nodal_s_basis(int in_index, array<double> in_loc, int in_n_spts)
+double eles_tris::eval_nodal_s_basis(int in_index, array<double>& in_loc, int in_n_spts)
 {
 
   array<double> nodal_s_basis(in_n_spts,1);
@@ -655,6 +660,9 @@ void eles_tris::compute_filter_upts(void)
 
   filter_upts.setup(N,N);
 
+  if(cached_opps.get("filter_upts",filter_upts))
+    return;
+
   N2 = N/2;
   // If N is odd, round up N/2
   if(N % 2 != 0){N2 += 1;}
@@ -800,6 +808,8 @@ void eles_tris::compute_filter_upts(void)
   for(i=0;i<N;i++)
     for(j=0;j<N;j++)
       sum+=filter_upts(i,j);
+
+  cached_opps.put("filter_upts",filter_upts);
 }
 
 
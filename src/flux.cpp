@@ -24,6 +24,7 @@
  */
 
 #include <cmath>
+#include <algorithm>
 
 #include "../include/global.h"
 #include "../include/array.h"
@@ -431,6 +432,443 @@ void calc_visf_3d(array<double>& in_u, array<double>& in_grad_u, array<double>&
 }
 
 
+// number of points processed together by the batched flux functions
+
+#define FLUX_BATCH 8
+
+// calculate the molecular viscosity and, with the SA model, the eddy viscosity and the psi function
+// for in_n_pts points from their density, internal energy and working variable (in_nu==NULL without SA)
+
+static void calc_mu_batch(int in_n_pts, double* in_rho, double* in_inte, double* in_nu, double* out_mu, double* out_mu_t, double* out_psi)
+{
+  double rt_ratio, mu, nu_tilde, Chi;
+
+  for(int p=0;p<in_n_pts;p++)
+    {
+      rt_ratio = (run_input.gamma-1.0)*in_inte[p]/(run_input.rt_inf);
+      mu = (run_input.mu_inf)*pow(rt_ratio,1.5)*(1.+(run_input.c_sth))/(rt_ratio+(run_input.c_sth));
+      mu = mu + run_input.fix_vis*(run_input.mu_inf - mu);
+      out_mu[p] = mu;
+
+      if (in_nu!=NULL) {
+
+        nu_tilde = in_nu[p]/in_rho[p];
+
+        if (nu_tilde >= 0.0) {
+          double f_v1 = pow(in_nu[p]/mu, 3.0)/(pow(in_nu[p]/mu, 3.0) + pow(run_input.c_v1, 3.0));
+          out_mu_t[p] = in_nu[p]*f_v1;
+        }
+        else {
+          out_mu_t[p] = 0.0;
+        }
+
+        Chi = in_nu[p]/mu;
+        if (Chi <= 10.0)
+          out_psi[p] = 0.05*log(1.0 + exp(20.0*Chi));
+        else
+          out_psi[p] = Chi;
+      }
+      else {
+        out_mu_t[p] = 0.0;
+      }
+    }
+}
+
+// calculate inviscid flux in 2D for a batch of points
+
+void calc_invf_2d_batch(int in_n_pts, int in_n_fields, double* in_u, int in_u_stride, double* out_f, int in_f_stride)
+{
+  double* f_x = out_f;
+  double* f_y = out_f+in_n_fields*in_f_stride;
+
+  if (run_input.equation==0) // Euler and NS equation
+    {
+      double* rho   = in_u;
+      double* mom_x = in_u+in_u_stride;
+      double* mom_y = in_u+2*in_u_stride;
+      double* ene   = in_u+3*in_u_stride;
+      double gamma_m1 = run_input.gamma-1.0;
+
+      for(int p=0;p<in_n_pts;p++)
+        {
+          double vx=mom_x[p]/rho[p];
+          double vy=mom_y[p]/rho[p];
+          double pr=gamma_m1*(ene[p]-(0.5*rho[p]*((vx*vx)+(vy*vy))));
+
+          f_x[p]=mom_x[p];
+          f_x[p+in_f_stride]=pr+(mom_x[p]*vx);
+          f_x[p+2*in_f_stride]=mom_y[p]*vx;
+          f_x[p+3*in_f_stride]=vx*(ene[p]+pr);
+
+          f_y[p]=mom_y[p];
+          f_y[p+in_f_stride]=mom_x[p]*vy;
+          f_y[p+2*in_f_stride]=pr+(mom_y[p]*vy);
+          f_y[p+3*in_f_stride]=vy*(ene[p]+pr);
+        }
+
+      if(run_input.turb_model==1) // SA model
+        {
+          double* nu = in_u+4*in_u_stride;
+
+          for(int p=0;p<in_n_pts;p++)
+            {
+              f_x[p+4*in_f_stride] = nu[p]*(mom_x[p]/rho[p]);
+              f_y[p+4*in_f_stride] = nu[p]*(mom_y[p]/rho[p]);
+            }
+        }
+    }
+  else if (run_input.equation==1) // Advection-diffusion equation
+    {
+      for(int p=0;p<in_n_pts;p++)
+        {
+          f_x[p] = run_input.wave_speed(0)*in_u[p];
+          f_y[p] = run_input.wave_speed(1)*in_u[p];
+        }
+    }
+  else
+    {
+      FatalError("equation not recognized");
+    }
+}
+
+// calculate inviscid flux in 3D for a batch of points
+
+void calc_invf_3d_batch(int in_n_pts, int in_n_fields, double* in_u, int in_u_stride, double* out_f, int in_f_stride)
+{
+  double* f_x = out_f;
+  double* f_y = out_f+in_n_fields*in_f_stride;
+  double* f_z = out_f+2*in_n_fields*in_f_stride;
+
+  if (run_input.equation==0) // Euler and NS equation
+    {
+      double* rho   = in_u;
+      double* mom_x = in_u+in_u_stride;
+      double* mom_y = in_u+2*in_u_stride;
+      double* mom_z = in_u+3*in_u_stride;
+      double* ene   = in_u+4*in_u_stride;
+      double gamma_m1 = run_input.gamma-1.0;
+
+      for(int p=0;p<in_n_pts;p++)
+        {
+          double vx=mom_x[p]/rho[p];
+          double vy=mom_y[p]/rho[p];
+          double vz=mom_z[p]/rho[p];
+          double pr=gamma_m1*(ene[p]-(0.5*rho[p]*((vx*vx)+(vy*vy)+(vz*vz))));
+
+          f_x[p]=mom_x[p];
+          f_x[p+in_f_stride]=pr+(mom_x[p]*vx);
+          f_x[p+2*in_f_stride]=mom_y[p]*vx;
+          f_x[p+3*in_f_stride]=mom_z[p]*vx;
+          f_x[p+4*in_f_stride]=vx*(ene[p]+pr);
+
+          f_y[p]=mom_y[p];
+          f_y[p+in_f_stride]=mom_x[p]*vy;
+          f_y[p+2*in_f_stride]=pr+(mom_y[p]*vy);
+          f_y[p+3*in_f_stride]=mom_z[p]*vy;
+          f_y[p+4*in_f_stride]=vy*(ene[p]+pr);
+
+          f_z[p]=mom_z[p];
+          f_z[p+in_f_stride]=mom_x[p]*vz;
+          f_z[p+2*in_f_stride]=mom_y[p]*vz;
+          f_z[p+3*in_f_stride]=pr+(mom_z[p]*vz);
+          f_z[p+4*in_f_stride]=vz*(ene[p]+pr);
+        }
+
+      if(run_input.turb_model==1) // SA model
+        {
+          double* nu = in_u+5*in_u_stride;
+
+          for(int p=0;p<in_n_pts;p++)
+            {
+              f_x[p+5*in_f_stride] = nu[p]*(mom_x[p]/rho[p]);
+              f_y[p+5*in_f_stride] = nu[p]*(mom_y[p]/rho[p]);
+              f_z[p+5*in_f_stride] = nu[p]*(mom_z[p]/rho[p]);
+            }
+        }
+    }
+  else if (run_input.equation==1) // Advection-diffusion equation
+    {
+      for(int p=0;p<in_n_pts;p++)
+        {
+          f_x[p] = run_input.wave_speed(0)*in_u[p];
+          f_y[p] = run_input.wave_speed(1)*in_u[p];
+          f_z[p] = run_input.wave_speed(2)*in_u[p];
+        }
+    }
+  else
+    {
+      FatalError("equation not recognized");
+    }
+}
+
+// calculate viscous flux in 2D for a batch of points
+
+void calc_visf_2d_batch(int in_n_pts, int in_n_fields, double* in_u, int in_u_stride, double* in_grad_u, int in_grad_stride, double* out_f, int in_f_stride)
+{
+  int dim_stride = in_n_fields*in_grad_stride;
+
+  if (run_input.equation==0) // Navier-Stokes equations
+    {
+      double inte[FLUX_BATCH], mu[FLUX_BATCH], mu_t[FLUX_BATCH], psi[FLUX_BATCH];
+      bool sa = (run_input.turb_model==1);
+
+      for(int p0=0;p0<in_n_pts;p0+=FLUX_BATCH)
+        {
+          int n = min(FLUX_BATCH,in_n_pts-p0);
+
+          // states
+
+          double* rho   = in_u+p0;
+          double* mom_x = rho+in_u_stride;
+          double* mom_y = rho+2*in_u_stride;
+          double* ene   = rho+3*in_u_stride;
+
+          // gradients
+
+          double* rho_dx   = in_grad_u+p0;
+          double* mom_x_dx = rho_dx+in_grad_stride;
+          double* mom_y_dx = rho_dx+2*in_grad_stride;
+          double* ene_dx   = rho_dx+3*in_grad_stride;
+
+          double* rho_dy   = rho_dx+dim_stride;
+          double* mom_x_dy = rho_dy+in_grad_stride;
+          double* mom_y_dy = rho_dy+2*in_grad_stride;
+          double* ene_dy   = rho_dy+3*in_grad_stride;
+
+          double* f_x = out_f+p0;
+          double* f_y = f_x+in_n_fields*in_f_stride;
+
+          // viscosity
+
+          for(int p=0;p<n;p++)
+            {
+              double u = mom_x[p]/rho[p];
+              double v = mom_y[p]/rho[p];
+              inte[p] = ene[p]/rho[p] - 0.5*(u*u+v*v);
+            }
+
+          calc_mu_batch(n,rho,inte,sa ? rho+4*in_u_stride : NULL,mu,mu_t,psi);
+
+          // construct flux
+
+          for(int p=0;p<n;p++)
+            {
+              double u = mom_x[p]/rho[p];
+              double v = mom_y[p]/rho[p];
+
+              double du_dx = (mom_x_dx[p]-rho_dx[p]*u)/rho[p];
+              double du_dy = (mom_x_dy[p]-rho_dy[p]*u)/rho[p];
+
+              double dv_dx = (mom_y_dx[p]-rho_dx[p]*v)/rho[p];
+              double dv_dy = (mom_y_dy[p]-rho_dy[p]*v)/rho[p];
+
+              double dke_dx = 0.5*(u*u+v*v)*rho_dx[p]+rho[p]*(u*du_dx+v*dv_dx);
+              double dke_dy = 0.5*(u*u+v*v)*rho_dy[p]+rho[p]*(u*du_dy+v*dv_dy);
+
+              double de_dx = (ene_dx[p]-dke_dx-rho_dx[p]*inte[p])/rho[p];
+              double de_dy = (ene_dy[p]-dke_dy-rho_dy[p]*inte[p])/rho[p];
+
+              double diag = (du_dx + dv_dy)/3.0;
+
+              double tauxx = 2.0*(mu[p]+mu_t[p])*(du_dx-diag);
+              double tauxy = (mu[p]+mu_t[p])*(du_dy + dv_dx);
+              double tauyy = 2.0*(mu[p]+mu_t[p])*(dv_dy-diag);
+
+              f_x[p] = 0.0;
+              f_x[p+in_f_stride] = -tauxx;
+              f_x[p+2*in_f_stride] = -tauxy;
+              f_x[p+3*in_f_stride] = -(u*tauxx+v*tauxy+(mu[p]/run_input.prandtl + mu_t[p]/run_input.prandtl_t)*(run_input.gamma)*de_dx);
+
+              f_y[p] = 0.0;
+              f_y[p+in_f_stride] = -tauxy;
+              f_y[p+2*in_f_stride] = -tauyy;
+              f_y[p+3*in_f_stride] = -(u*tauxy+v*tauyy+(mu[p]/run_input.prandtl + mu_t[p]/run_input.prandtl_t)*(run_input.gamma)*de_dy);
+            }
+
+          if (sa) {
+
+            double* nu = rho+4*in_u_stride;
+            double* nu_dx = rho_dx+4*in_grad_stride;
+            double* nu_dy = rho_dy+4*in_grad_stride;
+
+            for(int p=0;p<n;p++)
+              {
+                double nu_tilde = nu[p]/rho[p];
+                double dnu_tilde_dx = (nu_dx[p]-rho_dx[p]*nu_tilde)/rho[p];
+                double dnu_tilde_dy = (nu_dy[p]-rho_dy[p]*nu_tilde)/rho[p];
+
+                f_x[p+4*in_f_stride] = -(1.0/run_input.omega)*(mu[p] + mu[p]*psi[p])*dnu_tilde_dx;
+                f_y[p+4*in_f_stride] = -(1.0/run_input.omega)*(mu[p] + mu[p]*psi[p])*dnu_tilde_dy;
+              }
+          }
+        }
+    }
+  else if (run_input.equation==1) // Advection-diffusion equation
+    {
+      for(int p=0;p<in_n_pts;p++)
+        {
+          out_f[p] = -run_input.diff_coeff*in_grad_u[p];
+          out_f[p+in_n_fields*in_f_stride] = -run_input.diff_coeff*in_grad_u[p+dim_stride];
+        }
+    }
+  else
+    {
+      FatalError("equation not recognized");
+    }
+}
+
+// calculate viscous flux in 3D for a batch of points
+
+void calc_visf_3d_batch(int in_n_pts, int in_n_fields, double* in_u, int in_u_stride, double* in_grad_u, int in_grad_stride, double* out_f, int in_f_stride)
+{
+  int dim_stride = in_n_fields*in_grad_stride;
+
+  if (run_input.equation==0) // Navier-Stokes equations
+    {
+      double inte[FLUX_BATCH], mu[FLUX_BATCH], mu_t[FLUX_BATCH], psi[FLUX_BATCH];
+      bool sa = (run_input.turb_model==1);
+
+      for(int p0=0;p0<in_n_pts;p0+=FLUX_BATCH)
+        {
+          int n = min(FLUX_BATCH,in_n_pts-p0);
+
+          // states
+
+          double* rho   = in_u+p0;
+          double* mom_x = rho+in_u_stride;
+          double* mom_y = rho+2*in_u_stride;
+          double* mom_z = rho+3*in_u_stride;
+          double* ene   = rho+4*in_u_stride;
+
+          // gradients
+
+          double* rho_dx   = in_grad_u+p0;
+          double* mom_x_dx = rho_dx+in_grad_stride;
+          double* mom_y_dx = rho_dx+2*in_grad_stride;
+          double* mom_z_dx = rho_dx+3*in_grad_stride;
+          double* ene_dx   = rho_dx+4*in_grad_stride;
+
+          double* rho_dy   = rho_dx+dim_stride;
+          double* mom_x_dy = rho_dy+in_grad_stride;
+          double* mom_y_dy = rho_dy+2*in_grad_stride;
+          double* mom_z_dy = rho_dy+3*in_grad_stride;
+          double* ene_dy   = rho_dy+4*in_grad_stride;
+
+          double* rho_dz   = rho_dy+dim_stride;
+          double* mom_x_dz = rho_dz+in_grad_stride;
+          double* mom_y_dz = rho_dz+2*in_grad_stride;
+          double* mom_z_dz = rho_dz+3*in_grad_stride;
+          double* ene_dz   = rho_dz+4*in_grad_stride;
+
+          double* f_x = out_f+p0;
+          double* f_y = f_x+in_n_fields*in_f_stride;
+          double* f_z = f_y+in_n_fields*in_f_stride;
+
+          // viscosity
+
+          for(int p=0;p<n;p++)
+            {
+              double u = mom_x[p]/rho[p];
+              double v = mom_y[p]/rho[p];
+              double w = mom_z[p]/rho[p];
+              inte[p] = ene[p]/rho[p] - 0.5*(u*u+v*v+w*w);
+            }
+
+          calc_mu_batch(n,rho,inte,sa ? rho+5*in_u_stride : NULL,mu,mu_t,psi);
+
+          // construct flux
+
+          for(int p=0;p<n;p++)
+            {
+              double u = mom_x[p]/rho[p];
+              double v = mom_y[p]/rho[p];
+              double w = mom_z[p]/rho[p];
+
+              double du_dx = (mom_x_dx[p]-rho_dx[p]*u)/rho[p];
+              double du_dy = (mom_x_dy[p]-rho_dy[p]*u)/rho[p];
+              double du_dz = (mom_x_dz[p]-rho_dz[p]*u)/rho[p];
+
+              double dv_dx = (mom_y_dx[p]-rho_dx[p]*v)/rho[p];
+              double dv_dy = (mom_y_dy[p]-rho_dy[p]*v)/rho[p];
+              double dv_dz = (mom_y_dz[p]-rho_dz[p]*v)/rho[p];
+
+              double dw_dx = (mom_z_dx[p]-rho_dx[p]*w)/rho[p];
+              double dw_dy = (mom_z_dy[p]-rho_dy[p]*w)/rho[p];
+              double dw_dz = (mom_z_dz[p]-rho_dz[p]*w)/rho[p];
+
+              double dke_dx = 0.5*(u*u+v*v+w*w)*rho_dx[p] + rho[p]*(u*du_dx+v*dv_dx+w*dw_dx);
+              double dke_dy = 0.5*(u*u+v*v+w*w)*rho_dy[p] + rho[p]*(u*du_dy+v*dv_dy+w*dw_dy);
+              double dke_dz = 0.5*(u*u+v*v+w*w)*rho_dz[p] + rho[p]*(u*du_dz+v*dv_dz+w*dw_dz);
+
+              double de_dx = (ene_dx[p]-dke_dx-rho_dx[p]*inte[p])/rho[p];
+              double de_dy = (ene_dy[p]-dke_dy-rho_dy[p]*inte[p])/rho[p];
+              double de_dz = (ene_dz[p]-dke_dz-rho_dz[p]*inte[p])/rho[p];
+
+              double diag = (du_dx + dv_dy + dw_dz)/3.0;
+
+              double tauxx = 2.0*(mu[p]+mu_t[p])*(du_dx-diag);
+              double tauyy = 2.0*(mu[p]+mu_t[p])*(dv_dy-diag);
+              double tauzz = 2.0*(mu[p]+mu_t[p])*(dw_dz-diag);
+
+              double tauxy = (mu[p]+mu_t[p])*(du_dy + dv_dx);
+              double tauxz = (mu[p]+mu_t[p])*(du_dz + dw_dx);
+              double tauyz = (mu[p]+mu_t[p])*(dv_dz + dw_dy);
+
+              f_x[p] = 0.0;
+              f_x[p+in_f_stride] = -tauxx;
+              f_x[p+2*in_f_stride] = -tauxy;
+              f_x[p+3*in_f_stride] = -tauxz;
+              f_x[p+4*in_f_stride] = -(u*tauxx+v*tauxy+w*tauxz+(mu[p]/run_input.prandtl + mu_t[p]/run_input.prandtl_t)*(run_input.gamma)*de_dx);
+
+              f_y[p] = 0.0;
+              f_y[p+in_f_stride] = -tauxy;
+              f_y[p+2*in_f_stride] = -tauyy;
+              f_y[p+3*in_f_stride] = -tauyz;
+              f_y[p+4*in_f_stride] = -(u*tauxy+v*tauyy+w*tauyz+(mu[p]/run_input.prandtl + mu_t[p]/run_input.prandtl_t)*(run_input.gamma)*de_dy);
+
+              f_z[p] = 0.0;
+              f_z[p+in_f_stride] = -tauxz;
+              f_z[p+2*in_f_stride] = -tauyz;
+              f_z[p+3*in_f_stride] = -tauzz;
+              f_z[p+4*in_f_stride] = -(u*tauxz+v*tauyz+w*tauzz+(mu[p]/run_input.prandtl + mu_t[p]/run_input.prandtl_t)*(run_input.gamma)*de_dz);
+            }
+
+          if (sa) {
+
+            double* nu = rho+5*in_u_stride;
+            double* nu_dx = rho_dx+5*in_grad_stride;
+            double* nu_dy = rho_dy+5*in_grad_stride;
+            double* nu_dz = rho_dz+5*in_grad_stride;
+
+            for(int p=0;p<n;p++)
+              {
+                double nu_tilde = nu[p]/rho[p];
+                double dnu_tilde_dx = (nu_dx[p]-rho_dx[p]*nu_tilde)/rho[p];
+                double dnu_tilde_dy = (nu_dy[p]-rho_dy[p]*nu_tilde)/rho[p];
+                double dnu_tilde_dz = (nu_dz[p]-rho_dz[p]*nu_tilde)/rho[p];
+
+                f_x[p+5*in_f_stride] = -(1.0/run_input.omega)*(mu[p] + mu[p]*psi[p])*dnu_tilde_dx;
+                f_y[p+5*in_f_stride] = -(1.0/run_input.omega)*(mu[p] + mu[p]*psi[p])*dnu_tilde_dy;
+                f_z[p+5*in_f_stride] = -(1.0/run_input.omega)*(mu[p] + mu[p]*psi[p])*dnu_tilde_dz;
+              }
+          }
+        }
+    }
+  else if (run_input.equation==1) // Advection-diffusion equation
+    {
+      for(int p=0;p<in_n_pts;p++)
+        {
+          out_f[p] = -run_input.diff_coeff*in_grad_u[p];
+          out_f[p+in_n_fields*in_f_stride] = -run_input.diff_coeff*in_grad_u[p+dim_stride];
+          out_f[p+2*in_n_fields*in_f_stride] = -run_input.diff_coeff*in_grad_u[p+2*dim_stride];
+        }
+    }
+  else
+    {
+      FatalError("equation not recognized");
+    }
+}
+
 /*! Add additional ALE flux term due to mesh motion (2D) */
 void calc_alef_2d(array<double>& in_u, array<double>& in_v, array<double>& out_f)
 {
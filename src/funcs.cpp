@@ -642,10 +642,12 @@ void compute_filt_matrix_tri(array<double>& Filt, array<double>& vandermonde_tri
   run_input.c_tri = c_tri;
 
   // Evaluate the derivative normalized of Dubiner basis at position in_loc
+  array<double> grad_dubiner;
   for (int i=0;i<n_upts_tri;i++) {
+      eval_grad_dubiner_basis_2d_modes(loc_upts_tri(0,i),loc_upts_tri(1,i),order,grad_dubiner);
       for (int j=0;j<n_upts_tri;j++) {
-          tempr(i,j) = eval_dr_dubiner_basis_2d(loc_upts_tri(0,i),loc_upts_tri(1,i),j,order);
-          temps(i,j) = eval_ds_dubiner_basis_2d(loc_upts_tri(0,i),loc_upts_tri(1,i),j,order);
+          tempr(i,j) = grad_dubiner(j,0);
+          temps(i,j) = grad_dubiner(j,1);
         }
     }
 
@@ -808,9 +810,11 @@ double eval_div_dg_tri(array<double> &in_loc , int in_edge, int in_edge_fpt, int
   int n_upts_tri = (in_order+1)*(in_order+2)/2;
 
   double r,s,t;
-  double integral, edge_length, gdotn_at_cubpt;
+  double edge_length, gdotn_at_cubpt;
   double div_vcjh_basis;
 
+  array<double> integral(n_upts_tri);
+  array<double> jacobi_edge(in_order+1), dubiner_basis;
   array<double> mtemp_0((in_order+1),(in_order+1));
   array<double> gdotn((in_order+1),1);
   array<double> coeff_gdotn((in_order+1),1);
@@ -841,52 +845,58 @@ double eval_div_dg_tri(array<double> &in_loc , int in_edge, int in_edge_fpt, int
       // map to [0..edge_length] interval
       t = (1.+in_loc_fpts_1d(i))/2.*edge_length;
 
+      eval_jacobi_modes(t,0,0,in_order+1,jacobi_edge.get_ptr_cpu());
       for (int j=0;j<(in_order+1);j++)
-        mtemp_0(i,j) = eval_jacobi(t,0,0,j);
+        mtemp_0(i,j) = jacobi_edge(j);
     }
 
   mtemp_0 = inv_array(mtemp_0);
   coeff_gdotn = mult_arrays(mtemp_0,gdotn);
 
-  // 2. Perform the edge integrals to obtain coefficients sigma_i
-  for (int i=0;i<n_upts_tri;i++)
-    {
-      integral = 0.;
+  // 2. Perform the edge integrals to obtain coefficients sigma_i, evaluating all the Dubiner modes at each cubature point once
+  integral.initialize_to_zero();
 
-      for (int j=0;j<cub1d.get_n_pts();j++)
+  for (int j=0;j<cub1d.get_n_pts();j++)
+    {
+      // Get the position along the edge
+      if (in_edge==0)
         {
-          // Get the position along the edge
-          if (in_edge==0)
-            {
-              t = (cub1d.get_r(j)+1.)/2.*edge_length;
-              r = -1 + t;
-              s = -1;
-            }
-          else if (in_edge==1)
-            {
-              t = (cub1d.get_r(j)+1.)/2.*edge_length;
-              r = 1 - t/edge_length*2;
-              s = -1 + t/edge_length*2;
-            }
-          else if (in_edge==2)
-            {
-              t = (cub1d.get_r(j)+1.)/2.*edge_length;
-              r = -1;
-              s = 1 - t;
-            }
+          t = (cub1d.get_r(j)+1.)/2.*edge_length;
+          r = -1 + t;
+          s = -1;
+        }
+      else if (in_edge==1)
+        {
+          t = (cub1d.get_r(j)+1.)/2.*edge_length;
+          r = 1 - t/edge_length*2;
+          s = -1 + t/edge_length*2;
+        }
+      else if (in_edge==2)
+        {
+          t = (cub1d.get_r(j)+1.)/2.*edge_length;
+          r = -1;
+          s = 1 - t;
+        }
 
-          gdotn_at_cubpt = 0.;
-          for (int k=0;k<(in_order+1);k++)
-            gdotn_at_cubpt += coeff_gdotn(k,0)*eval_jacobi(t,0,0,k);
+      eval_jacobi_modes(t,0,0,in_order+1,jacobi_edge.get_ptr_cpu());
+      eval_dubiner_basis_2d_modes(r,s,in_order,dubiner_basis);
 
-          integral += cub1d.get_weight(j)*eval_dubiner_basis_2d(r,s,i,in_order)*gdotn_at_cubpt;
-        }
-      coeff_divg(i,0) = integral*(edge_length)/2;
+      gdotn_at_cubpt = 0.;
+      for (int k=0;k<(in_order+1);k++)
+        gdotn_at_cubpt += coeff_gdotn(k,0)*jacobi_edge(k);
+
+      for (int i=0;i<n_upts_tri;i++)
+        integral(i) += cub1d.get_weight(j)*dubiner_basis(i)*gdotn_at_cubpt;
     }
 
+  for (int i=0;i<n_upts_tri;i++)
+    coeff_divg(i,0) = integral(i)*(edge_length)/2;
+
+  eval_dubiner_basis_2d_modes(in_loc(0),in_loc(1),in_order,dubiner_basis);
+
   div_vcjh_basis = 0.;
   for (int i=0;i<n_upts_tri;i++)
-    div_vcjh_basis += coeff_divg(i,0)*eval_dubiner_basis_2d(in_loc(0),in_loc(1),i,in_order);
+    div_vcjh_basis += coeff_divg(i,0)*dubiner_basis(i);
 
   return div_vcjh_basis;
 
@@ -900,7 +910,6 @@ void array_to_mklcsr(array<double>& in_array, array<double>& out_data, array<int
   double tol=1e-24;
   int nnz=0;
   int pos=0;
-  int new_row=0;
 
   array<double> temp_data;
   array<int> temp_cols, temp_b, temp_e;
@@ -925,24 +934,18 @@ void array_to_mklcsr(array<double>& in_array, array<double>& out_data, array<int
 
   for(j=0;j<in_array.get_dim(0);j++)
     {
+      // a row without non-zeros starts and ends at the next row
+      temp_b(j)=pos+1;
+
       for(i=0;i<in_array.get_dim(1);i++)
         {
           if((in_array(j,i)*in_array(j,i))>tol)
             {
               temp_data(pos)=in_array(j,i);
               temp_cols(pos)=i+1;
-
-              if(new_row==0)
-                {
-                  temp_b(j)=pos+1;
-                  new_row=1;
-                }
-
               pos++;
             }
         }
-
-      new_row=0;
     }
 
   for(i=0;i<temp_e.get_dim(0)-1;i++)
@@ -1113,58 +1116,88 @@ double eval_gamma(int in_n)
   return gamma_val;
 }
 
+// normalized jacobi polynomial of mode 0
+
+static double eval_jacobi_mode_0(int in_alpha, int in_beta)
+{
+  double dtemp_0, dtemp_1, dtemp_2;
+
+  dtemp_0=pow(2.0,(-in_alpha-in_beta-1));
+  dtemp_1=eval_gamma(in_alpha+in_beta+2);
+  dtemp_2=eval_gamma(in_alpha+1)*eval_gamma(in_beta+1);
+
+  return sqrt(dtemp_0*(dtemp_1/dtemp_2));
+}
+
+// normalized jacobi polynomial of mode 1
+
+static double eval_jacobi_mode_1(double in_r, int in_alpha, int in_beta)
+{
+  double dtemp_0, dtemp_1, dtemp_2, dtemp_3, dtemp_4, dtemp_5;
+
+  dtemp_0=pow(2.0,(-in_alpha-in_beta-1));
+  dtemp_1=eval_gamma(in_alpha+in_beta+2);
+  dtemp_2=eval_gamma(in_alpha+1)*eval_gamma(in_beta+1);
+  dtemp_3=in_alpha+in_beta+3;
+  dtemp_4=(in_alpha+1)*(in_beta+1);
+  dtemp_5=(in_r*(in_alpha+in_beta+2)+(in_alpha-in_beta));
+
+  return 0.5*sqrt(dtemp_0*(dtemp_1/dtemp_2))*sqrt(dtemp_3/dtemp_4)*dtemp_5;
+}
+
+// normalized jacobi polynomial of mode in_mode>1 from those of modes in_mode-1 (in_jacobi_1) and in_mode-2 (in_jacobi_2)
+
+static double eval_jacobi_recurrence(double in_r, int in_alpha, int in_beta, int in_mode, double in_jacobi_1, double in_jacobi_2)
+{
+  double dtemp_0, dtemp_1, dtemp_3, dtemp_4, dtemp_5, dtemp_6, dtemp_7, dtemp_8, dtemp_9, dtemp_10, dtemp_11, dtemp_12, dtemp_13, dtemp_14;
+
+  dtemp_0=in_mode*(in_mode+in_alpha+in_beta)*(in_mode+in_alpha)*(in_mode+in_beta);
+  dtemp_1=((2*in_mode)+in_alpha+in_beta-1)*((2*in_mode)+in_alpha+in_beta+1);
+  dtemp_3=(2*in_mode)+in_alpha+in_beta;
+
+  dtemp_4=(in_mode-1)*((in_mode-1)+in_alpha+in_beta)*((in_mode-1)+in_alpha)*((in_mode-1)+in_beta);
+  dtemp_5=((2*(in_mode-1))+in_alpha+in_beta-1)*((2*(in_mode-1))+in_alpha+in_beta+1);
+  dtemp_6=(2*(in_mode-1))+in_alpha+in_beta;
+
+  dtemp_7=-((in_alpha*in_alpha)-(in_beta*in_beta));
+  dtemp_8=((2*(in_mode-1))+in_alpha+in_beta)*((2*(in_mode-1))+in_alpha+in_beta+2);
+
+  dtemp_9=(2.0/dtemp_3)*sqrt(dtemp_0/dtemp_1);
+  dtemp_10=(2.0/dtemp_6)*sqrt(dtemp_4/dtemp_5);
+  dtemp_11=dtemp_7/dtemp_8;
+
+  dtemp_12=in_r*in_jacobi_1;
+  dtemp_13=dtemp_10*in_jacobi_2;
+  dtemp_14=dtemp_11*in_jacobi_1;
+
+  return (1.0/dtemp_9)*(dtemp_12-dtemp_13-dtemp_14);
+}
+
 // helper method to evaluate a normalized jacobi polynomial
 double eval_jacobi(double in_r, int in_alpha, int in_beta, int in_mode)
 {
-  double jacobi;
+  double jacobi, jacobi_1, jacobi_2;
 
   if(in_mode==0)
     {
-      double dtemp_0, dtemp_1, dtemp_2;
-
-      dtemp_0=pow(2.0,(-in_alpha-in_beta-1));
-      dtemp_1=eval_gamma(in_alpha+in_beta+2);
-      dtemp_2=eval_gamma(in_alpha+1)*eval_gamma(in_beta+1);
-
-      jacobi=sqrt(dtemp_0*(dtemp_1/dtemp_2));
+      jacobi=eval_jacobi_mode_0(in_alpha,in_beta);
     }
   else if(in_mode==1)
     {
-      double dtemp_0, dtemp_1, dtemp_2, dtemp_3, dtemp_4, dtemp_5;
-
-      dtemp_0=pow(2.0,(-in_alpha-in_beta-1));
-      dtemp_1=eval_gamma(in_alpha+in_beta+2);
-      dtemp_2=eval_gamma(in_alpha+1)*eval_gamma(in_beta+1);
-      dtemp_3=in_alpha+in_beta+3;
-      dtemp_4=(in_alpha+1)*(in_beta+1);
-      dtemp_5=(in_r*(in_alpha+in_beta+2)+(in_alpha-in_beta));
-
-      jacobi=0.5*sqrt(dtemp_0*(dtemp_1/dtemp_2))*sqrt(dtemp_3/dtemp_4)*dtemp_5;
+      jacobi=eval_jacobi_mode_1(in_r,in_alpha,in_beta);
     }
   else
     {
-      double dtemp_0, dtemp_1, dtemp_2, dtemp_3, dtemp_4, dtemp_5, dtemp_6, dtemp_7, dtemp_8, dtemp_9, dtemp_10, dtemp_11, dtemp_12, dtemp_13, dtemp_14;
-
-      dtemp_0=in_mode*(in_mode+in_alpha+in_beta)*(in_mode+in_alpha)*(in_mode+in_beta);
-      dtemp_1=((2*in_mode)+in_alpha+in_beta-1)*((2*in_mode)+in_alpha+in_beta+1);
-      dtemp_3=(2*in_mode)+in_alpha+in_beta;
-
-      dtemp_4=(in_mode-1)*((in_mode-1)+in_alpha+in_beta)*((in_mode-1)+in_alpha)*((in_mode-1)+in_beta);
-      dtemp_5=((2*(in_mode-1))+in_alpha+in_beta-1)*((2*(in_mode-1))+in_alpha+in_beta+1);
-      dtemp_6=(2*(in_mode-1))+in_alpha+in_beta;
-
-      dtemp_7=-((in_alpha*in_alpha)-(in_beta*in_beta));
-      dtemp_8=((2*(in_mode-1))+in_alpha+in_beta)*((2*(in_mode-1))+in_alpha+in_beta+2);
-
-      dtemp_9=(2.0/dtemp_3)*sqrt(dtemp_0/dtemp_1);
-      dtemp_10=(2.0/dtemp_6)*sqrt(dtemp_4/dtemp_5);
-      dtemp_11=dtemp_7/dtemp_8;
+      // run the three term recurrence up from modes 0 and 1
+      jacobi_2=eval_jacobi_mode_0(in_alpha,in_beta);
+      jacobi_1=eval_jacobi_mode_1(in_r,in_alpha,in_beta);
 
-      dtemp_12=in_r*eval_jacobi(in_r,in_alpha,in_beta,in_mode-1);
-      dtemp_13=dtemp_10*eval_jacobi(in_r,in_alpha,in_beta,in_mode-2);
-      dtemp_14=dtemp_11*eval_jacobi(in_r,in_alpha,in_beta,in_mode-1);
-
-      jacobi=(1.0/dtemp_9)*(dtemp_12-dtemp_13-dtemp_14);
+      for(int m=2;m<=in_mode;m++)
+        {
+          jacobi=eval_jacobi_recurrence(in_r,in_alpha,in_beta,m,jacobi_1,jacobi_2);
+          jacobi_2=jacobi_1;
+          jacobi_1=jacobi;
+        }
     }
 
   return jacobi;
@@ -1187,6 +1220,34 @@ double eval_grad_jacobi(double in_r, int in_alpha, int in_beta, int in_mode)
   return grad_jacobi;
 }
 
+// evaluate normalized jacobi polynomials of modes 0 to in_n_modes-1 in one sweep of the recurrence
+
+void eval_jacobi_modes(double in_r, int in_alpha, int in_beta, int in_n_modes, double* out_jacobi)
+{
+  if(in_n_modes>0)
+    out_jacobi[0]=eval_jacobi_mode_0(in_alpha,in_beta);
+
+  if(in_n_modes>1)
+    out_jacobi[1]=eval_jacobi_mode_1(in_r,in_alpha,in_beta);
+
+  for(int m=2;m<in_n_modes;m++)
+    out_jacobi[m]=eval_jacobi_recurrence(in_r,in_alpha,in_beta,m,out_jacobi[m-1],out_jacobi[m-2]);
+}
+
+// evaluate gradients of normalized jacobi polynomials of modes 0 to in_n_modes-1 in one sweep of the recurrence
+
+void eval_grad_jacobi_modes(double in_r, int in_alpha, int in_beta, int in_n_modes, double* out_grad_jacobi)
+{
+  if(in_n_modes>0)
+    out_grad_jacobi[0]=0.0;
+
+  // d/dr P^(a,b)_m = sqrt(m(m+a+b+1)) P^(a+1,b+1)_(m-1)
+  eval_jacobi_modes(in_r,in_alpha+1,in_beta+1,in_n_modes-1,out_grad_jacobi+1);
+
+  for(int m=1;m<in_n_modes;m++)
+    out_grad_jacobi[m]=sqrt(1.0*m*(m+in_alpha+in_beta+1))*out_grad_jacobi[m];
+}
+
 double eval_dubiner_basis_2d(double in_r, double in_s, int in_mode, int in_basis_order)
 {
   double dubiner_basis_2d;
@@ -1488,6 +1549,237 @@ double eval_grad_dubiner_basis_3d(double in_r, double in_s, double in_t, int in_
 
 }
 
+// evaluate all modes of the triangle dubiner basis, with one jacobi recurrence per family of polynomials
+
+void eval_dubiner_basis_2d_modes(double in_r, double in_s, int in_basis_order, array<double>& out_basis)
+{
+  int i,j,k;
+  int mode;
+  int n_1d=in_basis_order+1;
+  int n_dof=((in_basis_order+1)*(in_basis_order+2))/2;
+
+  array<double> ab;
+  array<double> jacobi_0(n_1d), jacobi_1(n_1d,n_1d);
+
+  if(out_basis.get_dim(0)!=n_dof)
+    out_basis.setup(n_dof);
+
+  ab=rs_to_ab(in_r,in_s);
+
+  // jacobi_0(i)=P^(0,0)_i(a), jacobi_1(j,i)=P^(2i+1,0)_j(b)
+  eval_jacobi_modes(ab(0),0,0,n_1d,jacobi_0.get_ptr_cpu());
+  for (i=0;i<n_1d;i++)
+    eval_jacobi_modes(ab(1),(2*i)+1,0,n_1d-i,jacobi_1.get_ptr_cpu(0,i));
+
+  mode = 0;
+  for (k=0;k<in_basis_order+1;k++)
+    {
+      for (j=0;j<k+1;j++)
+        {
+          i = k-j;
+          out_basis(mode)=sqrt(2.0)*jacobi_0(i)*jacobi_1(j,i)*pow(1.0-ab(1),i);
+          mode++;
+        }
+    }
+}
+
+// evaluate d/dr and d/ds of all modes of the triangle dubiner basis, indexing of out_grad_basis: (in_mode,in_cpnt)
+
+void eval_grad_dubiner_basis_2d_modes(double in_r, double in_s, int in_basis_order, array<double>& out_grad_basis)
+{
+  int i,j,k;
+  int mode;
+  int n_1d=in_basis_order+1;
+  int n_dof=((in_basis_order+1)*(in_basis_order+2))/2;
+  double jacobi_0, jacobi_1, jacobi_2, jacobi_3, jacobi_4;
+
+  array<double> ab;
+  array<double> jacobi_a(n_1d), grad_jacobi_a(n_1d), jacobi_b(n_1d,n_1d), grad_jacobi_b(n_1d,n_1d);
+
+  if(out_grad_basis.get_dim(0)!=n_dof || out_grad_basis.get_dim(1)!=2)
+    out_grad_basis.setup(n_dof,2);
+
+  ab=rs_to_ab(in_r,in_s);
+
+  eval_jacobi_modes(ab(0),0,0,n_1d,jacobi_a.get_ptr_cpu());
+  eval_grad_jacobi_modes(ab(0),0,0,n_1d,grad_jacobi_a.get_ptr_cpu());
+  for (i=0;i<n_1d;i++)
+    {
+      eval_jacobi_modes(ab(1),(2*i)+1,0,n_1d-i,jacobi_b.get_ptr_cpu(0,i));
+      eval_grad_jacobi_modes(ab(1),(2*i)+1,0,n_1d-i,grad_jacobi_b.get_ptr_cpu(0,i));
+    }
+
+  mode = 0;
+  for (k=0;k<in_basis_order+1;k++)
+    {
+      for (j=0;j<k+1;j++)
+        {
+          i = k-j;
+
+          jacobi_0=grad_jacobi_a(i);
+          jacobi_1=jacobi_b(j,i);
+          jacobi_2=jacobi_a(i);
+          jacobi_3=grad_jacobi_b(j,i)*pow(1.0-ab(1),i);
+
+          if(i==0) // to avoid singularity
+            {
+              out_grad_basis(mode,0)=0.;
+              out_grad_basis(mode,1)=sqrt(2.0)*(jacobi_2*jacobi_3);
+            }
+          else
+            {
+              jacobi_4=jacobi_b(j,i)*i*pow(1.0-ab(1),i-1);
+
+              out_grad_basis(mode,0)=2.0*sqrt(2.0)*jacobi_0*jacobi_1*pow(1.0-ab(1),i-1);
+              out_grad_basis(mode,1)=sqrt(2.0)*((jacobi_0*jacobi_1*pow(1.0-ab(1),i-1)*(1.0+ab(0)))+(jacobi_2*(jacobi_3-jacobi_4)));
+            }
+          mode++;
+        }
+    }
+}
+
+// evaluate all modes of the tet dubiner basis, with one jacobi recurrence per family of polynomials
+
+void eval_dubiner_basis_3d_modes(double in_r, double in_s, double in_t, int in_basis_order, array<double>& out_basis)
+{
+  int i,j,k,m,n;
+  int mode;
+  int n_1d=in_basis_order+1;
+  int n_dof=((in_basis_order+1)*(in_basis_order+2)*(in_basis_order+3))/6;
+
+  array<double> abc;
+  array<double> jacobi_0(n_1d), jacobi_1(n_1d,n_1d), jacobi_2(n_1d,n_1d);
+
+  if(out_basis.get_dim(0)!=n_dof)
+    out_basis.setup(n_dof);
+
+  abc=rst_to_abc(in_r,in_s,in_t);
+
+  // jacobi_0(i)=P^(0,0)_i(a), jacobi_1(j,i)=P^(2i+1,0)_j(b), jacobi_2(k,i+j)=P^(2(i+j)+2,0)_k(c)
+  eval_jacobi_modes(abc(0),0,0,n_1d,jacobi_0.get_ptr_cpu());
+  for (i=0;i<n_1d;i++)
+    {
+      eval_jacobi_modes(abc(1),(2*i)+1,0,n_1d-i,jacobi_1.get_ptr_cpu(0,i));
+      eval_jacobi_modes(abc(2),(2*i)+2,0,n_1d-i,jacobi_2.get_ptr_cpu(0,i));
+    }
+
+  mode = 0;
+  for(m=0;m<in_basis_order+1;m++)
+    {
+      for(n=0;n<m+1;n++)
+        {
+          for(k=0;k<n+1;k++)
+            {
+              j= n-k;
+              i = m-j-k;
+              out_basis(mode)=2.0*sqrt(2.0)*jacobi_0(i)*jacobi_1(j,i)*jacobi_2(k,i+j)*pow(1.0-abc(1),i)*pow(1-abc(2),i+j);
+              mode++;
+            }
+        }
+    }
+}
+
+// evaluate the gradient of all modes of the tet dubiner basis, indexing of out_grad_basis: (in_mode,in_cpnt)
+
+void eval_grad_dubiner_basis_3d_modes(double in_r, double in_s, double in_t, int in_basis_order, array<double>& out_grad_basis)
+{
+  int i,j,k,m,n;
+  int mode;
+  int n_1d=in_basis_order+1;
+  int n_dof=((in_basis_order+1)*(in_basis_order+2)*(in_basis_order+3))/6;
+  double dr_sdubiner,ds_sdubiner,dt_sdubiner;
+  double temp,fa,gb,hc,dfa,dgb,dhc;
+
+  array<double> abc;
+  array<double> jacobi_a(n_1d), grad_jacobi_a(n_1d);
+  array<double> jacobi_b(n_1d,n_1d), grad_jacobi_b(n_1d,n_1d), jacobi_c(n_1d,n_1d), grad_jacobi_c(n_1d,n_1d);
+
+  if(out_grad_basis.get_dim(0)!=n_dof || out_grad_basis.get_dim(1)!=3)
+    out_grad_basis.setup(n_dof,3);
+
+  abc=rst_to_abc(in_r,in_s,in_t);
+
+  eval_jacobi_modes(abc(0),0,0,n_1d,jacobi_a.get_ptr_cpu());
+  eval_grad_jacobi_modes(abc(0),0,0,n_1d,grad_jacobi_a.get_ptr_cpu());
+  for (i=0;i<n_1d;i++)
+    {
+      eval_jacobi_modes(abc(1),2*i+1,0,n_1d-i,jacobi_b.get_ptr_cpu(0,i));
+      eval_grad_jacobi_modes(abc(1),2*i+1,0,n_1d-i,grad_jacobi_b.get_ptr_cpu(0,i));
+      eval_jacobi_modes(abc(2),2*i+2,0,n_1d-i,jacobi_c.get_ptr_cpu(0,i));
+      eval_grad_jacobi_modes(abc(2),2*i+2,0,n_1d-i,grad_jacobi_c.get_ptr_cpu(0,i));
+    }
+
+  mode = 0;
+  for(m=0;m<in_basis_order+1;m++)
+    {
+      for(n=0;n<m+1;n++)
+        {
+          for(k=0;k<n+1;k++)
+            {
+              j= n-k;
+              i = m-j-k;
+
+              fa = jacobi_a(i);
+              gb = jacobi_b(j,i);
+              hc = jacobi_c(k,i+j);
+
+              dfa = grad_jacobi_a(i);
+              dgb = grad_jacobi_b(j,i);
+              dhc = grad_jacobi_c(k,i+j);
+
+              dr_sdubiner = dfa*gb*hc;
+
+              if (i>0)
+                {
+                  dr_sdubiner = dr_sdubiner*pow( 0.5*(1.-abc(1)), i-1);
+                }
+              if (i+j>0)
+                {
+                  dr_sdubiner = dr_sdubiner*pow( 0.5*(1.-abc(2)), i+j-1);
+                }
+
+              out_grad_basis(mode,0) = dr_sdubiner*pow(2,2*i+j+1.5);
+
+              ds_sdubiner = (0.5*(1.+abc(0)))*dr_sdubiner;
+
+              temp = dgb*pow(0.5*(1.-abc(1)),i);
+
+              if (i>0)
+                {
+                  temp = temp+(-0.5*i)*gb*pow((0.5*(1.-abc(1))),i-1);
+                }
+              if (i+j>0)
+                {
+                  temp = temp*pow(0.5*(1-abc(2)),i+j-1);
+                }
+              temp = fa*temp*hc;
+
+              ds_sdubiner = ds_sdubiner + temp;
+
+              out_grad_basis(mode,1) = ds_sdubiner*pow(2,2*i+j+1.5);
+
+              dt_sdubiner = 0.5*(1.+abc(0))*dr_sdubiner + 0.5*(1.+abc(1))*temp;
+              temp = dhc*pow(0.5*(1.-abc(2)),i+j);
+
+              if (i+j > 0)
+                {
+                  temp = temp - 0.5*(i+j)*(hc*pow(0.5*(1-abc(2)),i+j-1));
+                }
+
+              temp = fa*(gb*temp);
+
+              temp = temp*pow(0.5*(1.-abc(1)),i);
+
+              dt_sdubiner = dt_sdubiner + temp;
+
+              out_grad_basis(mode,2) = dt_sdubiner*pow(2,2*i+j+1.5);
+
+              mode++;
+            }
+        }
+    }
+}
+
 bool is_perfect_square(int in_a)
 {
   int number = round(sqrt(1.0*in_a));
@@ -2322,7 +2614,7 @@ array<double> diffPoly(array<double> & p, array<int> & term2Diff)
 }
 
 
-double evalPoly(array<double> p, array<double> coords)
+double evalPoly(array<double>& p, array<double>& coords)
 {
   //need to check that length of coords is equal to height of p
   if(p.get_dim(0) != coords.get_dim(1))
@@ -0,0 +1,228 @@
+/*!
+ * \file gemm_benchmark.cpp
+ * \author - Original code: SD++ developed by Patrice Castonguay, Antony Jameson,
+ *                          Peter Vincent, David Williams (alphabetical by surname).
+ *         - Current development: Aerospace Computing Laboratory (ACL)
+ *                                Aero/Astro Department. Stanford University.
+ * \version 0.1.0
+ *
+ * High Fidelity Large Eddy Simulation (HiFiLES) Code.
+ * Copyright (C) 2014 Aerospace Computing Laboratory (ACL).
+ *
+ * HiFiLES is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * HiFiLES is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with HiFiLES.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Benchmark of the small matrix multiply (sparse_* 3) against the BLAS the code is built with (the in-tree
+ * dgemm for BLAS=NO_BLAS), on the operator shapes of every element type for orders 1 to 8:
+ *
+ *   make gemm_benchmark [BLAS=...]
+ *   bin/gemm_benchmark [n_points] [n_fields]
+ *
+ * Each operator is applied to the n_fields*n_eles columns of a partition with about n_points solution points
+ * (default 200000) and n_fields fields (default 5), as in eles::apply_opp. The operator and columns are random.
+ * The maximum difference to the BLAS result is reported; it is 0 with NO_BLAS, as both do the same operations.
+ * The last column times opp_1 and opp_2 of all dimensions applied to the flux in one pass by stacked_opp, as in
+ * eles::calculate_totalFlux_divergence, against one small matrix multiply per operator and dimension.
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include <cstdlib>
+
+#if defined _ACCELERATE_BLAS
+#include <Accelerate/Accelerate.h>
+#endif
+
+#if defined _MKL_BLAS
+#include "mkl.h"
+#endif
+
+#if defined _STANDARD_BLAS
+extern "C"
+{
+#include "cblas.h"
+}
+#endif
+
+#include "../include/global.h"
+#include "../include/array.h"
+#include "../include/eles_kernels.h"
+
+using namespace std;
+
+// numbers of solution and flux points of element type in_ele_type (0: tri, 1: quad, 2: tet, 3: pri, 4: hex) at order in_order
+
+void get_n_pts(int in_ele_type, int in_order, int& out_n_upts, int& out_n_fpts)
+{
+  int n1=in_order+1;
+
+  if(in_ele_type==0)
+  {
+    out_n_upts=n1*(n1+1)/2;
+    out_n_fpts=3*n1;
+  }
+  else if(in_ele_type==1)
+  {
+    out_n_upts=n1*n1;
+    out_n_fpts=4*n1;
+  }
+  else if(in_ele_type==2)
+  {
+    out_n_upts=n1*(n1+1)*(n1+2)/6;
+    out_n_fpts=4*n1*(n1+1)/2;
+  }
+  else if(in_ele_type==3)
+  {
+    out_n_upts=n1*n1*(n1+1)/2;
+    out_n_fpts=2*n1*(n1+1)/2+3*n1*n1;
+  }
+  else
+  {
+    out_n_upts=n1*n1*n1;
+    out_n_fpts=6*n1*n1;
+  }
+}
+
+// apply an in_n_rows x in_n_inner operator with both backends, print the timings and the largest difference
+
+void bench_opp(const char* in_name, int in_n_rows, int in_n_inner, int in_n_cols)
+{
+  array<double> opp(in_n_rows,in_n_inner), packed(get_small_gemm_size(in_n_rows,in_n_inner));
+  array<double> in(in_n_inner,in_n_cols), out_blas(in_n_rows,in_n_cols), out_small(in_n_rows,in_n_cols);
+
+  for(int i=0;i<in_n_rows*in_n_inner;i++)
+    opp(i)=rand()/(double)RAND_MAX-0.5;
+
+  for(int i=0;i<in_n_inner*in_n_cols;i++)
+    in(i)=rand()/(double)RAND_MAX-0.5;
+
+  pack_small_gemm(opp.get_ptr_cpu(),in_n_rows,in_n_inner,packed.get_ptr_cpu());
+  small_gemm_kernel small_gemm_fn=get_small_gemm_kernel(in_n_rows);
+
+  // enough repetitions for about 1e9 multiply-adds
+  int n_reps=(int)(1.e9/((double)in_n_rows*in_n_inner*in_n_cols))+1;
+
+  double t_blas=get_wall_time();
+  for(int r=0;r<n_reps;r++)
+  {
+#if defined _ACCELERATE_BLAS || defined _MKL_BLAS || defined _STANDARD_BLAS
+    cblas_dgemm(CblasColMajor,CblasNoTrans,CblasNoTrans,in_n_rows,in_n_cols,in_n_inner,1.0,opp.get_ptr_cpu(),in_n_rows,in.get_ptr_cpu(),in_n_inner,0.0,out_blas.get_ptr_cpu(),in_n_rows);
+#elif defined _NO_BLAS
+    dgemm(in_n_rows,in_n_cols,in_n_inner,1.0,0.0,opp.get_ptr_cpu(),in_n_rows,in.get_ptr_cpu(),in_n_inner,out_blas.get_ptr_cpu(),in_n_rows);
+#endif
+  }
+  t_blas=(get_wall_time()-t_blas)/n_reps;
+
+  double t_small=get_wall_time();
+  for(int r=0;r<n_reps;r++)
+    small_gemm_fn(packed.get_ptr_cpu(),in_n_rows,in_n_inner,in.get_ptr_cpu(),in_n_inner,in_n_cols,0.0,out_small.get_ptr_cpu(),in_n_rows);
+  t_small=(get_wall_time()-t_small)/n_reps;
+
+  double max_diff=0.;
+  for(int i=0;i<in_n_rows*in_n_cols;i++)
+    max_diff=max(max_diff,fabs(out_small(i)-out_blas(i)));
+
+  cout << setw(8) << in_name << setw(6) << in_n_rows << " x" << setw(5) << in_n_inner << setw(9) << in_n_cols
+       << setw(12) << setprecision(4) << 1.e3*t_blas << setw(12) << 1.e3*t_small
+       << setw(9) << setprecision(3) << t_blas/t_small << setw(12) << setprecision(2) << scientific << max_diff << fixed << endl;
+}
+
+// apply in_n_dims pairs of operators in_n_fpts x in_n_upts and in_n_upts x in_n_upts to in_n_dims inputs, once per operator
+// and dimension and stacked in one pass, and return the speedup of the stacked form
+
+double bench_stacked(int in_n_dims, int in_n_upts, int in_n_fpts, int in_n_cols)
+{
+  int n_rows[2]={in_n_fpts,in_n_upts};
+  int n_inner=in_n_upts*in_n_dims;
+
+  array<double> in(in_n_upts,in_n_cols,in_n_dims);
+  array<double> out_fpts(in_n_fpts,in_n_cols), out_upts(in_n_upts,in_n_cols);
+  array< array<double> > packed(2), packed_dim(2,in_n_dims);
+
+  for(int i=0;i<in_n_upts*in_n_cols*in_n_dims;i++)
+    in(i)=rand()/(double)RAND_MAX-0.5;
+
+  // the operators of all dimensions side by side, packed together and one dimension at a time
+  for(int o=0;o<2;o++)
+  {
+    array<double> opp(n_rows[o],n_inner);
+    for(int i=0;i<n_rows[o]*n_inner;i++)
+      opp(i)=rand()/(double)RAND_MAX-0.5;
+
+    packed(o).setup(get_small_gemm_size(n_rows[o],n_inner));
+    pack_small_gemm(opp.get_ptr_cpu(),n_rows[o],n_inner,packed(o).get_ptr_cpu());
+
+    for(int d=0;d<in_n_dims;d++)
+    {
+      packed_dim(o,d).setup(get_small_gemm_size(n_rows[o],in_n_upts));
+      pack_small_gemm(opp.get_ptr_cpu()+n_rows[o]*in_n_upts*d,n_rows[o],in_n_upts,packed_dim(o,d).get_ptr_cpu());
+    }
+  }
+
+  double* packed_ptr[2]={packed(0).get_ptr_cpu(),packed(1).get_ptr_cpu()};
+  double* out_ptr[2]={out_fpts.get_ptr_cpu(),out_upts.get_ptr_cpu()};
+
+  int n_reps=(int)(1.e9/((double)(in_n_fpts+in_n_upts)*n_inner*in_n_cols))+1;
+
+  double t_sep=get_wall_time();
+  for(int r=0;r<n_reps;r++)
+    for(int o=0;o<2;o++)
+      for(int d=0;d<in_n_dims;d++)
+        get_small_gemm_kernel(n_rows[o])(packed_dim(o,d).get_ptr_cpu(),n_rows[o],in_n_upts,in.get_ptr_cpu(0,0,d),in_n_upts,in_n_cols,(d==0 ? 0.0 : 1.0),out_ptr[o],n_rows[o]);
+  t_sep=get_wall_time()-t_sep;
+
+  double t_stacked=get_wall_time();
+  for(int r=0;r<n_reps;r++)
+    stacked_opp(2,packed_ptr,n_rows,in_n_upts,in_n_dims,in.get_ptr_cpu(),in_n_upts,in_n_upts*in_n_cols,0.0,out_ptr,n_rows,in_n_cols,1,0,in_n_cols);
+  t_stacked=get_wall_time()-t_stacked;
+
+  return t_sep/t_stacked;
+}
+
+int main(int argc, char *argv[])
+{
+  int n_points=(argc>1 ? atoi(argv[1]) : 200000);
+  int n_fields=(argc>2 ? atoi(argv[2]) : 5);
+
+  const char* ele_names[5]={"tri","quad","tet","pri","hex"};
+
+  cout << setiosflags(ios::fixed);
+
+  for(int ele_type=0;ele_type<5;ele_type++)
+  {
+    cout << endl << "==== " << ele_names[ele_type] << " ====" << endl;
+    cout << " p operator  rows x inner     cols   blas (ms)  small (ms)  speedup    max diff" << endl;
+
+    for(int order=1;order<=8;order++)
+    {
+      int n_upts, n_fpts;
+      get_n_pts(ele_type,order,n_upts,n_fpts);
+
+      int n_cols=n_fields*max(1,n_points/n_upts);
+
+      // opp_0,1,6: upts to fpts, opp_2,4: upts to upts, opp_3,5: fpts to upts
+      cout << setw(2) << order;
+      bench_opp("opp_0",n_fpts,n_upts,n_cols);
+      cout << "  ";
+      bench_opp("opp_4",n_upts,n_upts,n_cols);
+      cout << "  ";
+      bench_opp("opp_5",n_upts,n_fpts,n_cols);
+      cout << "  " << setw(70) << "stacked opp_1,opp_2 speedup" << setw(8) << setprecision(3) << bench_stacked(ele_type<2 ? 2 : 3,n_upts,n_fpts,n_cols) << endl;
+    }
+  }
+
+  return 0;
+}
@@ -300,6 +300,17 @@ void GeoPreprocess(struct solution* FlowSol, mesh &Mesh) {
   FlowSol->mesh_eles_hexas.setup(num_hexas,max_n_spts_per_hexa);
   if (FlowSol->rank==0) cout << "done initializing elements" << endl;
 
+  // Storage order of the cells in mesh_eles
+  array<int> c_order;
+
+  if (FlowSol->rank==0 && run_input.reorder_eles!=0) {
+      if (run_input.reorder_eles==1) cout << "ordering elements along a Morton curve" << endl;
+      else if (run_input.reorder_eles==2) cout << "ordering elements along a Hilbert curve" << endl;
+      else if (run_input.reorder_eles==3) cout << "ordering elements by reverse Cuthill-McKee" << endl;
+    }
+
+  ReorderCells(run_input.reorder_eles,xv,c2v,c2n_v,f2c,FlowSol->num_inters,FlowSol->num_eles,FlowSol->n_dims,c_order);
+
   // Set shape for each cell
   array<int> local_c(FlowSol->num_eles);
 
@@ -312,7 +323,9 @@ void GeoPreprocess(struct solution* FlowSol, mesh &Mesh) {
   array<double> pos(FlowSol->n_dims);
 
   if (FlowSol->rank==0) cout << "setting elements shape ... ";
-  for (int i=0;i<FlowSol->num_eles;i++) {
+  for (int ic=0;ic<FlowSol->num_eles;ic++) {
+      int i = c_order(ic);
+
       if (ctype(i) == 0) //tri
         {
           local_c(i) = tris_count;
@@ -700,6 +713,15 @@ void GeoPreprocess(struct solution* FlowSol, mesh &Mesh) {
 
   // TODO: Need to count quad and triangle faces
 
+  // Order in which the faces are set up as interfaces
+  array<int> f_order(FlowSol->num_inters);
+
+  if (run_input.reorder_faces)
+    ReorderFaces(f2c,c_order,FlowSol->num_inters,FlowSol->num_eles,f_order);
+  else
+    for (int i=0;i<FlowSol->num_inters;i++)
+      f_order(i) = i;
+
   // Count the number of int_inters and bdy_inters
   int n_seg_int_inters = 0;
   int n_tri_int_inters = 0;
@@ -760,8 +782,9 @@ void GeoPreprocess(struct solution* FlowSol, mesh &Mesh) {
   int i_tri_bdy=0;
   int i_quad_bdy=0;
 
-  for(int i=0;i<FlowSol->num_inters;i++)
+  for(int i_f=0;i_f<FlowSol->num_inters;i_f++)
     {
+      int i = f_order(i_f);
       bctype_f = bctype_c( f2c(i,0),f2loc_f(i,0) );
       ic_l = f2c(i,0);
       ic_r = f2c(i,1);
@@ -804,9 +827,95 @@ void GeoPreprocess(struct solution* FlowSol, mesh &Mesh) {
         }
     }
 
+  // Group the boundary interfaces by boundary type, to evaluate the boundary conditions of each type together
+  for(int i=0;i<FlowSol->n_bdy_inter_types;i++)
+    FlowSol->mesh_bdy_inters(i).set_bdy_groups();
+
+  // Storage of the connectivity of the interfaces to the flux points of the elements
+  long n_bytes_conn=0, n_bytes_ptrs=0;
+
+  for(int i=0;i<3;i++) {
+      long n_bytes, n_bytes_p;
+
+      FlowSol->mesh_int_inters(i).get_fpts_n_bytes(n_bytes,n_bytes_p);
+      n_bytes_conn+=n_bytes;
+      n_bytes_ptrs+=n_bytes_p;
+
+      FlowSol->mesh_bdy_inters(i).get_fpts_n_bytes(n_bytes,n_bytes_p);
+      n_bytes_conn+=n_bytes;
+      n_bytes_ptrs+=n_bytes_p;
+
+#ifdef _MPI
+      FlowSol->mesh_mpi_inters(i).get_fpts_n_bytes(n_bytes,n_bytes_p);
+      n_bytes_conn+=n_bytes;
+      n_bytes_ptrs+=n_bytes_p;
+#endif
+    }
+
+#ifdef _MPI
+  long n_bytes_local[2] = {n_bytes_conn,n_bytes_ptrs}, n_bytes_global[2];
+  MPI_Reduce(n_bytes_local,n_bytes_global,2,MPI_LONG,MPI_SUM,0,MPI_COMM_WORLD);
+  n_bytes_conn = n_bytes_global[0];
+  n_bytes_ptrs = n_bytes_global[1];
+#endif
+
+  if (FlowSol->rank==0) cout << "interface connectivity: " << n_bytes_conn/1048576. << " MB in place of " << n_bytes_ptrs/1048576. << " MB of pointers" << endl;
+
   if (run_input.motion)
     Mesh.ic2loc_c = local_c;
 
+  // Neighbours of each cell across interior and periodic faces, used to colour the elements for the implicit solver
+  // and to find the neighbours of the levels of local time stepping
+  if (run_input.adv_type==4 || run_input.lts_levels>1) {
+      Mesh.ic2loc_c = local_c;
+      Mesh.c2c.setup(FlowSol->num_eles,MAX_F_PER_C);
+      Mesh.c2c.initialize_to_value(-1);
+
+      for(int i=0;i<FlowSol->num_inters;i++) {
+          bctype_f = bctype_c( f2c(i,0),f2loc_f(i,0) );
+          if (bctype_f==0 && f2c(i,1)!=-1) {
+              Mesh.c2c(f2c(i,0),f2loc_f(i,0)) = f2c(i,1);
+              Mesh.c2c(f2c(i,1),f2loc_f(i,1)) = f2c(i,0);
+            }
+        }
+    }
+
+  // Interface of each face for local time stepping, numbered per kind and type in the order they were set up above
+  if (run_input.lts_levels>1) {
+      Mesh.f2loc_f = f2loc_f;
+      Mesh.f2inter.setup(FlowSol->num_inters,3);
+      Mesh.f2inter.initialize_to_value(-1);
+
+      array<int> n_inters_kind(3,3);
+      n_inters_kind.initialize_to_zero();
+
+      for(int i_f=0;i_f<FlowSol->num_inters;i_f++) {
+          int i = f_order(i_f);
+          bctype_f = bctype_c( f2c(i,0),f2loc_f(i,0) );
+          int kind = -1;
+
+          if (bctype_f==0)
+            kind = 0;
+          else if (bctype_f!=10 && bctype_f!=99)
+            kind = 1;
+
+          if (kind>=0) {
+              Mesh.f2inter(i,0) = kind;
+              Mesh.f2inter(i,1) = f2nv(i)-2;
+              Mesh.f2inter(i,2) = n_inters_kind(kind,f2nv(i)-2)++;
+            }
+        }
+
+#ifdef _MPI
+      for(int i_mpi=0;i_mpi<FlowSol->n_mpi_inters;i_mpi++) {
+          int i = f_mpi2f(i_mpi);
+          Mesh.f2inter(i,0) = 2;
+          Mesh.f2inter(i,1) = f2nv(i)-2;
+          Mesh.f2inter(i,2) = n_inters_kind(2,f2nv(i)-2)++;
+        }
+#endif
+    }
+
   // Flag interfaces for calculating LES wall model
   if(run_input.wall_model>0 or run_input.turb_model>0) {
 
@@ -989,6 +1098,215 @@ void GeoPreprocess(struct solution* FlowSol, mesh &Mesh) {
 
 }
 
+// compare the (key, cell) pairs of the space-filling curve ordering
+
+static int compare_cell_keys(const void* a, const void* b)
+{
+  const int* ka = (const int*) a;
+  const int* kb = (const int*) b;
+
+  if (ka[0]!=kb[0])
+    return (ka[0]<kb[0]) ? -1 : 1;
+
+  return ka[1]-kb[1];
+}
+
+// position of in_coord (in_n_bits bits per dimension) along the Hilbert curve, by the transform of J. Skilling,
+// "Programming the Hilbert curve", AIP Conf. Proc. 707 (2004), written as the transposed coordinates
+
+static void hilbert_transpose(int* inout_coord, int in_n_bits, int in_n_dims)
+{
+  int m = 1 << (in_n_bits-1);
+  int p, q, t;
+
+  // Inverse undo
+  for (q=m;q>1;q>>=1) {
+      p = q-1;
+      for (int i=0;i<in_n_dims;i++) {
+          if (inout_coord[i] & q)
+            inout_coord[0] ^= p;
+          else {
+              t = (inout_coord[0]^inout_coord[i]) & p;
+              inout_coord[0] ^= t;
+              inout_coord[i] ^= t;
+            }
+        }
+    }
+
+  // Gray encode
+  for (int i=1;i<in_n_dims;i++)
+    inout_coord[i] ^= inout_coord[i-1];
+
+  t = 0;
+  for (q=m;q>1;q>>=1)
+    if (inout_coord[in_n_dims-1] & q)
+      t ^= q-1;
+
+  for (int i=0;i<in_n_dims;i++)
+    inout_coord[i] ^= t;
+}
+
+void ReorderCells(int in_order_type, array<double>& in_xv, array<int>& in_c2v, array<int>& in_c2n_v, array<int>& in_f2c, int in_n_faces,
+                  int in_n_cells, int in_n_dims, array<int>& out_c_order)
+{
+  out_c_order.setup(in_n_cells);
+
+  for (int ic=0;ic<in_n_cells;ic++)
+    out_c_order(ic) = ic;
+
+  if (in_order_type==0 || in_n_cells==0)
+    return;
+
+  if (in_order_type==1 || in_order_type==2)
+    {
+      // Key of each cell along the curve through its centroid, 15 bits per dimension in 2D and 10 in 3D
+      int n_bits = (in_n_dims==2) ? 15 : 10;
+      int n_cells_per_dim = 1 << n_bits;
+
+      array<double> centroid(in_n_cells,in_n_dims);
+      array<double> x_min(in_n_dims), x_max(in_n_dims);
+
+      for (int k=0;k<in_n_dims;k++) {
+          x_min(k) = INFINITY;
+          x_max(k) = -INFINITY;
+        }
+
+      for (int ic=0;ic<in_n_cells;ic++) {
+          for (int k=0;k<in_n_dims;k++) {
+              centroid(ic,k) = 0.;
+              for (int j=0;j<in_c2n_v(ic);j++)
+                centroid(ic,k) += in_xv(in_c2v(ic,j),k);
+              centroid(ic,k) /= in_c2n_v(ic);
+
+              x_min(k) = min(x_min(k),centroid(ic,k));
+              x_max(k) = max(x_max(k),centroid(ic,k));
+            }
+        }
+
+      array<int> keys(2,in_n_cells);
+      int coord[3];
+
+      for (int ic=0;ic<in_n_cells;ic++) {
+          for (int k=0;k<in_n_dims;k++) {
+              double extent = x_max(k)-x_min(k);
+              coord[k] = (extent>0.) ? (int)((centroid(ic,k)-x_min(k))/extent*(n_cells_per_dim-1)) : 0;
+            }
+
+          if (in_order_type==2)
+            hilbert_transpose(coord,n_bits,in_n_dims);
+
+          // interleave the bits of the coordinates, most significant first
+          int key = 0;
+          for (int q=n_bits-1;q>=0;q--)
+            for (int k=0;k<in_n_dims;k++)
+              key = (key << 1) | ((coord[k] >> q) & 1);
+
+          keys(0,ic) = key;
+          keys(1,ic) = ic;
+        }
+
+      qsort(keys.get_ptr_cpu(),in_n_cells,2*sizeof(int),compare_cell_keys);
+
+      for (int ic=0;ic<in_n_cells;ic++)
+        out_c_order(ic) = keys(1,ic);
+    }
+  else if (in_order_type==3)
+    {
+      // Neighbours of each cell across the faces, in compressed rows
+      array<int> c2c_sta(in_n_cells+1);
+      c2c_sta.initialize_to_zero();
+
+      for (int i=0;i<in_n_faces;i++)
+        if (in_f2c(i,0)!=-1 && in_f2c(i,1)!=-1) {
+            c2c_sta(in_f2c(i,0)+1)++;
+            c2c_sta(in_f2c(i,1)+1)++;
+          }
+
+      for (int ic=0;ic<in_n_cells;ic++)
+        c2c_sta(ic+1) += c2c_sta(ic);
+
+      array<int> c2c(max(c2c_sta(in_n_cells),1));
+      array<int> n_c2c(in_n_cells);
+      n_c2c.initialize_to_zero();
+
+      for (int i=0;i<in_n_faces;i++)
+        if (in_f2c(i,0)!=-1 && in_f2c(i,1)!=-1) {
+            int ic_l = in_f2c(i,0), ic_r = in_f2c(i,1);
+            c2c(c2c_sta(ic_l)+n_c2c(ic_l)++) = ic_r;
+            c2c(c2c_sta(ic_r)+n_c2c(ic_r)++) = ic_l;
+          }
+
+      // Cuthill-McKee: breadth first from a cell of least degree of each connected part, the neighbours of each cell
+      // in increasing degree
+      array<int> visited(in_n_cells);
+      visited.initialize_to_zero();
+
+      int n_ordered = 0;
+
+      while (n_ordered<in_n_cells)
+        {
+          int start = -1;
+          for (int ic=0;ic<in_n_cells;ic++)
+            if (!visited(ic) && (start==-1 || n_c2c(ic)<n_c2c(start)))
+              start = ic;
+
+          visited(start) = 1;
+          out_c_order(n_ordered++) = start;
+
+          for (int head=n_ordered-1;head<n_ordered;head++)
+            {
+              int ic = out_c_order(head);
+              int first = n_ordered;
+
+              for (int j=c2c_sta(ic);j<c2c_sta(ic+1);j++) {
+                  int ic_n = c2c(j);
+                  if (!visited(ic_n)) {
+                      visited(ic_n) = 1;
+
+                      // insert in increasing degree
+                      int pos = n_ordered++;
+                      while (pos>first && n_c2c(out_c_order(pos-1))>n_c2c(ic_n)) {
+                          out_c_order(pos) = out_c_order(pos-1);
+                          pos--;
+                        }
+                      out_c_order(pos) = ic_n;
+                    }
+                }
+            }
+        }
+
+      // Reverse
+      for (int ic=0;ic<in_n_cells/2;ic++) {
+          int temp = out_c_order(ic);
+          out_c_order(ic) = out_c_order(in_n_cells-1-ic);
+          out_c_order(in_n_cells-1-ic) = temp;
+        }
+    }
+}
+
+void ReorderFaces(array<int>& in_f2c, array<int>& in_c_order, int in_n_faces, int in_n_cells, array<int>& out_f_order)
+{
+  // Position of each cell in the storage order
+  array<int> c_rank(in_n_cells);
+  for (int ic=0;ic<in_n_cells;ic++)
+    c_rank(in_c_order(ic)) = ic;
+
+  // Counting sort of the faces by the position of their left cell, faces of a cell in their original order
+  array<int> n_f_sta(in_n_cells+1);
+  n_f_sta.initialize_to_zero();
+
+  for (int i=0;i<in_n_faces;i++)
+    n_f_sta(c_rank(in_f2c(i,0))+1)++;
+
+  for (int ic=0;ic<in_n_cells;ic++)
+    n_f_sta(ic+1) += n_f_sta(ic);
+
+  out_f_order.setup(in_n_faces);
+
+  for (int i=0;i<in_n_faces;i++)
+    out_f_order(n_f_sta(c_rank(in_f2c(i,0)))++) = i;
+}
+
 void ReadMesh(string& in_file_name, array<double>& out_xv, array<int>& out_c2v, array<int>& out_c2n_v, array<int>& out_ctype, array<int>& out_ic2icg,
               array<int>& out_iv2ivg, int& out_n_cells, int& out_n_verts, int& out_n_verts_global, struct solution* FlowSol)
 {
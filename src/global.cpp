@@ -26,16 +26,25 @@
 #include "../include/global.h"
 #include "../include/array.h"
 #include <math.h>
+#include <ctime>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 using namespace std;
 
 input run_input;
 const double pi=4*atan(1);
 
-const char* HIFILES_DIR = getenv("HIFILES_HOME");
-
 /*! Routine to multiply matrices similar to BLAS's dgemm */
 int dgemm(int Arows, int Bcols, int Acols, double alpha, double beta, double* a, double* b, double* c)
+{
+  return dgemm(Arows,Bcols,Acols,alpha,beta,a,Arows,b,Acols,c,Arows);
+}
+
+/*! Routine to multiply matrices similar to BLAS's dgemm, with leading dimensions */
+int dgemm(int Arows, int Bcols, int Acols, double alpha, double beta, double* a, int lda, double* b, int ldb, double* c, int ldc)
 {
   /* Routine similar to blas dgemm but does not allow for transposes.
 
@@ -46,11 +55,12 @@ int dgemm(int Arows, int Bcols, int Acols, double alpha, double beta, double* a,
      Arows - No. of rows of matrices A and C
      Bcols - No. of columns of matrices B and C
      Acols - No. of columns of A or No. of rows of B
+     lda, ldb, ldc - Leading dimensions of A, B and C (distance between their columns)
   */
 
-  #define A(I,J) a[(I) + (J)*Arows]
-  #define B(I,J) b[(I) + (J)*Acols]
-  #define C(I,J) c[(I) + (J)*Arows]
+  #define A(I,J) a[(I) + (J)*lda]
+  #define B(I,J) b[(I) + (J)*ldb]
+  #define C(I,J) c[(I) + (J)*ldc]
 
   int i,j,l;
   double temp;
@@ -101,6 +111,46 @@ int dgemm(int Arows, int Bcols, int Acols, double alpha, double beta, double* a,
   return 0;
 }
 
+/*! Routine to multiply single precision matrices similar to BLAS's sgemm, see dgemm */
+int sgemm(int Arows, int Bcols, int Acols, float alpha, float beta, float* a, int lda, float* b, int ldb, float* c, int ldc)
+{
+  #define A(I,J) a[(I) + (J)*lda]
+  #define B(I,J) b[(I) + (J)*ldb]
+  #define C(I,J) c[(I) + (J)*ldc]
+
+  int i,j,l;
+  float temp;
+
+  if (Arows == 0 || Bcols == 0 || ((alpha == 0.f || Acols == 0) && beta == 1.f))
+    return 0;
+
+  for (j = 0; j < Bcols; j++) {
+
+    if (beta == 0.f) {
+      for (i = 0; i < Arows; i++)
+        C(i,j) = 0.f;
+    }
+
+    else if (beta != 1.f) {
+      for (i = 0; i < Arows; i++)
+        C(i,j) = beta * C(i,j);
+    }
+
+    for (l = 0; l < Acols; l++) {
+      temp = alpha*B(l,j);
+
+      for (i = 0; i < Arows; i++)
+        C(i,j) += temp * A(i,l);
+    }
+  }
+
+  #undef A
+  #undef B
+  #undef C
+
+  return 0;
+}
+
 /*! Routing to compute alpha*x + y for vectors x and y - similar to BLAS's daxpy */
 int daxpy(int n, double alpha, double *x, double *y)
 {
@@ -115,3 +165,32 @@ int daxpy(int n, double alpha, double *x, double *y)
   return 0;
 }
 
+/*! Number of threads that a parallel region of the CPU kernels will use */
+int get_n_threads(void)
+{
+#ifdef _OPENMP
+  return omp_get_max_threads();
+#else
+  return 1;
+#endif
+}
+
+/*! Thread index of the caller, used to pick per-thread scratch storage */
+int get_thread_num(void)
+{
+#ifdef _OPENMP
+  return omp_get_thread_num();
+#else
+  return 0;
+#endif
+}
+
+/*! Wall-clock time, used to time alternatives at setup */
+double get_wall_time(void)
+{
+#ifdef _OPENMP
+  return omp_get_wtime();
+#else
+  return clock()/(double)CLOCKS_PER_SEC;
+#endif
+}
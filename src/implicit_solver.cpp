@@ -0,0 +1,448 @@
+/*!
+ * \file implicit_solver.cpp
+ * \author - Original code: SD++ developed by Patrice Castonguay, Antony Jameson,
+ *                          Peter Vincent, David Williams (alphabetical by surname).
+ *         - Current development: Aerospace Computing Laboratory (ACL)
+ *                                Aero/Astro Department. Stanford University.
+ * \version 0.1.0
+ *
+ * High Fidelity Large Eddy Simulation (HiFiLES) Code.
+ * Copyright (C) 2014 Aerospace Computing Laboratory (ACL).
+ *
+ * HiFiLES is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * HiFiLES is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with HiFiLES.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <iostream>
+#include <cmath>
+#include <vector>
+
+#include "../include/global.h"
+#include "../include/error.h"
+#include "../include/solver.h"
+#include "../include/implicit_solver.h"
+
+#ifdef _MPI
+#include "mpi.h"
+#endif
+
+using namespace std;
+
+// LU factorization with partial pivoting of the in_n x in_n column-major matrix in_a, in place
+
+static void lu_factor(int in_n, double* in_a, int* out_piv)
+{
+  for (int k=0;k<in_n;k++)
+  {
+    int p = k;
+    for (int i=k+1;i<in_n;i++)
+      if (fabs(in_a[i+k*in_n]) > fabs(in_a[p+k*in_n]))
+        p = i;
+
+    out_piv[k] = p;
+
+    if (in_a[p+k*in_n] == 0.)
+      FatalError("Singular element block in the implicit preconditioner");
+
+    if (p != k)
+      for (int j=0;j<in_n;j++)
+        swap(in_a[k+j*in_n],in_a[p+j*in_n]);
+
+    double inv_pivot = 1./in_a[k+k*in_n];
+    for (int i=k+1;i<in_n;i++)
+      in_a[i+k*in_n] *= inv_pivot;
+
+    for (int j=k+1;j<in_n;j++)
+    {
+      double a_kj = in_a[k+j*in_n];
+      for (int i=k+1;i<in_n;i++)
+        in_a[i+j*in_n] -= in_a[i+k*in_n]*a_kj;
+    }
+  }
+}
+
+// solve with the factors of lu_factor, in_b is overwritten by the solution
+
+static void lu_solve(int in_n, double* in_lu, int* in_piv, double* in_b)
+{
+  for (int k=0;k<in_n;k++)
+    if (in_piv[k] != k)
+      swap(in_b[k],in_b[in_piv[k]]);
+
+  for (int j=0;j<in_n;j++)
+    for (int i=j+1;i<in_n;i++)
+      in_b[i] -= in_lu[i+j*in_n]*in_b[j];
+
+  for (int j=in_n-1;j>=0;j--)
+  {
+    in_b[j] /= in_lu[j+j*in_n];
+    for (int i=0;i<j;i++)
+      in_b[i] -= in_lu[i+j*in_n]*in_b[j];
+  }
+}
+
+// #### constructors ####
+
+// default constructor
+
+implicit_solver::implicit_solver()
+{
+  FlowSol = NULL;
+  n_dofs = 0;
+  rhs_current = false;
+}
+
+// #### methods ####
+
+void implicit_solver::setup(struct solution* in_FlowSol, mesh& Mesh)
+{
+  FlowSol = in_FlowSol;
+
+  int n_ele_types = FlowSol->n_ele_types;
+
+  // unknowns of each element type, one element after the other
+  dof_offset.setup(n_ele_types);
+  n_dofs_per_ele.setup(n_ele_types);
+
+  n_dofs = 0;
+  max_n_dofs_per_ele = 0;
+  for (int i=0;i<n_ele_types;i++)
+  {
+    dof_offset(i) = n_dofs;
+    n_dofs_per_ele(i) = 0;
+
+    if (FlowSol->mesh_eles(i)->get_n_eles() != 0)
+    {
+      n_dofs_per_ele(i) = FlowSol->mesh_eles(i)->get_n_dofs_per_ele();
+      n_dofs += FlowSol->mesh_eles(i)->get_n_eles()*n_dofs_per_ele(i);
+      max_n_dofs_per_ele = max(max_n_dofs_per_ele,n_dofs_per_ele(i));
+    }
+  }
+
+  u = CSysVector(n_dofs);
+  rhs = CSysVector(n_dofs);
+  inv_dt = CSysVector(n_dofs);
+  u_pert = CSysVector(n_dofs);
+  rhs_pert = CSysVector(n_dofs);
+  du = CSysVector(n_dofs);
+
+  for (int i=0;i<n_ele_types;i++)
+    if (FlowSol->mesh_eles(i)->get_n_eles() != 0)
+      FlowSol->mesh_eles(i)->get_disu_upts_dofs(&u[dof_offset(i)]);
+
+  rhs_current = false;
+  dt_scale = 1.;
+
+  if (run_input.dt_type == 0)
+    max_dt_scale = run_input.implicit_cfl_max;
+  else
+    max_dt_scale = run_input.implicit_cfl_max/run_input.CFL;
+
+  if (!run_input.implicit_precond)
+    return;
+
+  // Greedy colouring of the cells: the residual of a cell depends on its neighbours, and on their neighbours
+  // through the corrected gradient when viscous, so no cell within that distance may share its colour
+  int n_cells = FlowSol->num_eles;
+  int n_faces = Mesh.c2c.get_dim(1);
+  array<int> cell_colour(n_cells);
+  vector<int> taken;
+
+  n_colours = 0;
+  for (int ic=0;ic<n_cells;ic++)
+  {
+    for (int j=0;j<n_faces;j++)
+    {
+      int ic_n = Mesh.c2c(ic,j);
+      if (ic_n < 0)
+        continue;
+
+      if (ic_n < ic)
+        taken[cell_colour(ic_n)] = ic;
+
+      if (FlowSol->viscous)
+        for (int k=0;k<n_faces;k++)
+        {
+          int ic_nn = Mesh.c2c(ic_n,k);
+          if (ic_nn >= 0 && ic_nn < ic)
+            taken[cell_colour(ic_nn)] = ic;
+        }
+    }
+
+    int c = 0;
+    while (c < n_colours && taken[c] == ic)
+      c++;
+
+    if (c == n_colours)
+    {
+      taken.push_back(-1);
+      n_colours++;
+    }
+
+    cell_colour(ic) = c;
+  }
+
+  ele_colour.setup(n_ele_types);
+  for (int i=0;i<n_ele_types;i++)
+    ele_colour(i).setup(max(1,FlowSol->mesh_eles(i)->get_n_eles()));
+
+  for (int ic=0;ic<n_cells;ic++)
+    ele_colour(Mesh.ctype(ic))(Mesh.ic2loc_c(ic)) = cell_colour(ic);
+
+  // every partition evaluates the residual the same number of times
+#ifdef _MPI
+  int n_local[2] = {n_colours,max_n_dofs_per_ele}, n_global[2];
+  MPI_Allreduce(n_local,n_global,2,MPI_INT,MPI_MAX,MPI_COMM_WORLD);
+  n_colours = n_global[0];
+  max_n_dofs_per_ele = n_global[1];
+#endif
+
+  jac_blocks.setup(n_ele_types);
+  lu_blocks.setup(n_ele_types);
+  lu_pivots.setup(n_ele_types);
+  for (int i=0;i<n_ele_types;i++)
+  {
+    int n_eles = FlowSol->mesh_eles(i)->get_n_eles();
+    if (n_eles != 0)
+    {
+      jac_blocks(i).setup(n_dofs_per_ele(i),n_dofs_per_ele(i),n_eles);
+      lu_blocks(i).setup(n_dofs_per_ele(i),n_dofs_per_ele(i),n_eles);
+      lu_pivots(i).setup(n_dofs_per_ele(i),n_eles);
+    }
+  }
+
+  n_steps_jac = run_input.implicit_jac_freq;
+
+  if (FlowSol->rank == 0)
+    cout << "implicit solver: " << n_colours << " element colours, " << n_colours*max_n_dofs_per_ele
+         << " residual evaluations per preconditioner" << endl;
+}
+
+void implicit_solver::calc_rhs(int in_file_num, int in_rk_stage, CSysVector& in_u, CSysVector& out_rhs)
+{
+  for (int i=0;i<FlowSol->n_ele_types;i++)
+    if (FlowSol->mesh_eles(i)->get_n_eles() != 0)
+      FlowSol->mesh_eles(i)->set_disu_upts_dofs(&in_u[dof_offset(i)]);
+
+  CalcResidual(in_file_num,in_rk_stage,FlowSol);
+
+  for (int i=0;i<FlowSol->n_ele_types;i++)
+    if (FlowSol->mesh_eles(i)->get_n_eles() != 0)
+      FlowSol->mesh_eles(i)->get_rhs_upts_dofs(&out_rhs[dof_offset(i)]);
+}
+
+void implicit_solver::apply_jacobian(const CSysVector& in_u, CSysVector& out_v)
+{
+  double norm_in = in_u.norm();
+
+  if (norm_in == 0.)
+  {
+    out_v = 0.;
+    return;
+  }
+
+  // step of the finite difference, balancing truncation against round-off in the residual
+  double eps_fd = sqrt(eps*(1.+norm_u))/norm_in;
+
+  for (int i=0;i<n_dofs;i++)
+    u_pert[i] = u[i]+eps_fd*in_u[i];
+
+  // stage 1 keeps the body force of the step
+  calc_rhs(0,1,u_pert,rhs_pert);
+
+  for (int i=0;i<n_dofs;i++)
+    out_v[i] = inv_dt[i]*in_u[i]-(rhs_pert[i]-rhs[i])/eps_fd;
+}
+
+void implicit_solver::apply_precond(const CSysVector& in_u, CSysVector& out_v)
+{
+  out_v = in_u;
+
+  if (!run_input.implicit_precond)
+    return;
+
+  for (int i=0;i<FlowSol->n_ele_types;i++)
+  {
+    int n_eles = FlowSol->mesh_eles(i)->get_n_eles();
+    int n = n_dofs_per_ele(i);
+
+#pragma omp parallel for schedule(static)
+    for (int ic=0;ic<n_eles;ic++)
+      lu_solve(n,lu_blocks(i).get_ptr_cpu(0,0,ic),lu_pivots(i).get_ptr_cpu(0,ic),&out_v[dof_offset(i)+ic*n]);
+  }
+}
+
+void implicit_solver::calc_jacobian_blocks(int in_file_num)
+{
+  double step = sqrt(eps);
+
+  u_pert = u;
+
+  for (int c=0;c<n_colours;c++)
+  {
+    for (int k=0;k<max_n_dofs_per_ele;k++)
+    {
+      // perturb unknown k of every element of colour c
+      for (int i=0;i<FlowSol->n_ele_types;i++)
+      {
+        int n_eles = FlowSol->mesh_eles(i)->get_n_eles();
+        int n = n_dofs_per_ele(i);
+
+        if (k < n)
+          for (int ic=0;ic<n_eles;ic++)
+            if (ele_colour(i)(ic) == c)
+            {
+              int j = dof_offset(i)+ic*n+k;
+              u_pert[j] = u[j]+step*(1.+fabs(u[j]));
+            }
+      }
+
+      calc_rhs(in_file_num,1,u_pert,rhs_pert);
+
+      // column k of the blocks of these elements, with the step actually taken
+      for (int i=0;i<FlowSol->n_ele_types;i++)
+      {
+        int n_eles = FlowSol->mesh_eles(i)->get_n_eles();
+        int n = n_dofs_per_ele(i);
+
+        if (k < n)
+          for (int ic=0;ic<n_eles;ic++)
+            if (ele_colour(i)(ic) == c)
+            {
+              int j = dof_offset(i)+ic*n+k;
+              double inv_h = 1./(u_pert[j]-u[j]);
+
+              for (int r=0;r<n;r++)
+                jac_blocks(i)(r,k,ic) = (rhs_pert[dof_offset(i)+ic*n+r]-rhs[dof_offset(i)+ic*n+r])*inv_h;
+
+              u_pert[j] = u[j];
+            }
+      }
+    }
+  }
+}
+
+void implicit_solver::factor_blocks(void)
+{
+  for (int i=0;i<FlowSol->n_ele_types;i++)
+  {
+    int n_eles = FlowSol->mesh_eles(i)->get_n_eles();
+    int n = n_dofs_per_ele(i);
+
+#pragma omp parallel for schedule(static)
+    for (int ic=0;ic<n_eles;ic++)
+    {
+      double* lu = lu_blocks(i).get_ptr_cpu(0,0,ic);
+      double* jac = jac_blocks(i).get_ptr_cpu(0,0,ic);
+
+      for (int m=0;m<n*n;m++)
+        lu[m] = -jac[m];
+
+      for (int m=0;m<n;m++)
+        lu[m+m*n] += inv_dt[dof_offset(i)+ic*n+m];
+
+      lu_factor(n,lu,lu_pivots(i).get_ptr_cpu(0,ic));
+    }
+  }
+}
+
+void implicit_solver::advance(int in_file_num)
+{
+  // right-hand side at the solution, kept from the end of the previous step
+  if (!rhs_current)
+  {
+    calc_rhs(in_file_num,0,u,rhs);
+    norm_rhs = rhs.norm();
+    rhs_current = true;
+  }
+
+  norm_u = u.norm();
+
+  // pseudo-timestep of each element
+  double dt = run_input.dt;
+  for (int i=0;i<FlowSol->n_ele_types;i++)
+  {
+    int n_eles = FlowSol->mesh_eles(i)->get_n_eles();
+    int n = n_dofs_per_ele(i);
+
+    if (n_eles != 0)
+    {
+      FlowSol->mesh_eles(i)->set_dt_local();
+
+      for (int ic=0;ic<n_eles;ic++)
+      {
+        dt = dt_scale*FlowSol->mesh_eles(i)->get_dt_ele(ic);
+        for (int m=0;m<n;m++)
+          inv_dt[dof_offset(i)+ic*n+m] = 1./dt;
+      }
+    }
+  }
+
+  // element blocks of the preconditioner, the Jacobians are kept for implicit_jac_freq steps
+  if (run_input.implicit_precond)
+  {
+    if (n_steps_jac == run_input.implicit_jac_freq)
+    {
+      calc_jacobian_blocks(in_file_num);
+      n_steps_jac = 0;
+    }
+    n_steps_jac++;
+
+    factor_blocks();
+  }
+
+  // solve (I/dt - dR/du) du = R
+  implicit_jacobian_product jacobian(this);
+  implicit_block_precond precond(this);
+
+  du = 0.;
+  int n_lin_iters = linear_solver.FGMRES(rhs,du,jacobian,precond,run_input.implicit_lin_tol,run_input.implicit_krylov_dim,false,FlowSol);
+
+  // update, and the right-hand side of the next step
+  u_pert = u;
+  u_pert += du;
+  calc_rhs(in_file_num,0,u_pert,rhs_pert);
+
+  double norm_rhs_new = rhs_pert.norm();
+  double dt_scale_old = dt_scale;
+
+  if (norm_rhs_new != norm_rhs_new || norm_rhs_new > 10.*norm_rhs)
+  {
+    // reject the step and retry with a smaller timestep
+    if (dt_scale == 1.)
+      FatalError("The implicit solver diverged at the timestep of the explicit CFL number");
+
+    dt_scale = max(1.,0.25*dt_scale);
+    rhs_current = false;
+
+    for (int i=0;i<FlowSol->n_ele_types;i++)
+      if (FlowSol->mesh_eles(i)->get_n_eles() != 0)
+        FlowSol->mesh_eles(i)->set_disu_upts_dofs(&u[dof_offset(i)]);
+  }
+  else
+  {
+    // switched evolution relaxation: the timestep grows as the residual falls, at most doubling per step
+    dt_scale = min(max_dt_scale,max(1.,dt_scale*min(2.,norm_rhs/norm_rhs_new)));
+
+    u = u_pert;
+    rhs = rhs_pert;
+    norm_rhs = norm_rhs_new;
+  }
+
+  // Leave run_input.dt at the last timestep applied (used to advance the solution time)
+  run_input.dt = dt;
+
+  if (FlowSol->rank == 0 && (in_file_num+1)%run_input.monitor_res_freq == 0)
+    cout << "implicit step: timestep scale " << dt_scale_old << ", FGMRES iterations " << n_lin_iters
+         << (rhs_current ? "" : ", rejected") << endl;
+}
@@ -105,6 +105,8 @@ void input::read_input_file(string fileName, int rank)
   opts.getScalarValue("order",order);
   opts.getScalarValue("viscous",viscous,0);
   opts.getScalarValue("mesh_file",mesh_file);
+  opts.getScalarValue("reorder_eles",reorder_eles,0);
+  opts.getScalarValue("reorder_faces",reorder_faces,0);
   opts.getScalarValue("ic_form",ic_form,1);
   opts.getScalarValue("test_case",test_case,0);
   opts.getScalarValue("n_steps",n_steps);
@@ -155,6 +157,32 @@ void input::read_input_file(string fileName, int rank)
   opts.getScalarValue("riemann_solve_type",riemann_solve_type);
   opts.getScalarValue("vis_riemann_solve_type",vis_riemann_solve_type);
   opts.getScalarValue("adv_type",adv_type);
+  opts.getScalarValue("n_threads",n_threads,0);
+  opts.getScalarValue("blocked_residual",blocked_residual,0);
+  opts.getScalarValue("ele_block_size",ele_block_size,0);
+  opts.getScalarValue("pad_upts",pad_upts,0);
+  opts.getScalarValue("upts_layout",upts_layout,0);
+  opts.getScalarValue("aosoa_width",aosoa_width,4);
+  opts.getScalarValue("precision",precision,0);
+  opts.getScalarValue("opp_cache",opp_cache,0);
+  opts.getScalarValue("opp_cache_dir",opp_cache_dir,string("."));
+  if (adv_type == 4) {
+    opts.getScalarValue("implicit_cfl_max",implicit_cfl_max,1000.);
+    opts.getScalarValue("implicit_lin_tol",implicit_lin_tol,0.05);
+    opts.getScalarValue("implicit_krylov_dim",implicit_krylov_dim,40);
+    opts.getScalarValue("implicit_precond",implicit_precond,1);
+    opts.getScalarValue("implicit_jac_freq",implicit_jac_freq,10);
+  }
+  if (adv_type == 5) {
+    opts.getScalarValue("dual_time_max_iter",dual_time_max_iter,100);
+    opts.getScalarValue("dual_time_tol",dual_time_tol,1e-3);
+  }
+  opts.getScalarValue("p_multigrid",p_multigrid,0);
+  if (p_multigrid) {
+    opts.getScalarValue("pmg_min_order",pmg_min_order,1);
+    opts.getScalarValue("pmg_n_smooth",pmg_n_smooth,1);
+  }
+  opts.getScalarValue("lts_levels",lts_levels,0);
   opts.getScalarValue("dt_type",dt_type);
   if (dt_type == 2 && rank == 0) {
     cout << "!!!!!!" << endl;
@@ -163,10 +191,11 @@ void input::read_input_file(string fileName, int rank)
     cout << "!!!!!!" << endl;
   }
 
-  if (dt_type == 0) {
+  // dual time stepping takes the physical timestep dt and the CFL number of the pseudo timesteps
+  if (dt_type == 0 || adv_type == 5) {
     opts.getScalarValue("dt",dt);
   }
-  else {
+  if (dt_type != 0 || adv_type == 5) {
     opts.getScalarValue("CFL",CFL);
   }
 
@@ -379,6 +408,122 @@ void input::setup_params(int rank)
     if (riemann_solve_type==2)
       FatalError("Roe flux not supported with RANS equation");
   }
+
+  if (sparse_tri==2 || sparse_tet==2 || sparse_pri==2)
+    FatalError("Sum-factorized operators are only available for quads and hexas");
+
+#ifdef _GPU
+  if (sparse_quad==2 || sparse_hexa==2)
+    FatalError("Sum-factorized operators are not available on the GPU");
+
+  if (blocked_residual)
+    FatalError("Blocked residual is not available on the GPU");
+
+  if (pad_upts)
+    FatalError("Padded solution point arrays are not available on the GPU");
+
+  if (upts_layout==1)
+    FatalError("The AoSoA layout is not available on the GPU");
+
+  if (precision==1)
+    FatalError("Mixed precision is not available on the GPU");
+
+  if (sparse_tri==3 || sparse_quad==3 || sparse_hexa==3 || sparse_tet==3 || sparse_pri==3)
+    FatalError("The small matrix multiply operators are not available on the GPU");
+
+  if (sparse_tri==4 || sparse_quad==4 || sparse_hexa==4 || sparse_tet==4 || sparse_pri==4)
+    FatalError("Automatic operator storage is not available on the GPU");
+
+  if (adv_type==4)
+    FatalError("The implicit solver is not available on the GPU");
+
+  if (adv_type==5)
+    FatalError("Dual time stepping is not available on the GPU");
+
+  if (p_multigrid)
+    FatalError("p-multigrid is not available on the GPU");
+
+  if (lts_levels>1)
+    FatalError("Local time stepping is not available on the GPU");
+#endif
+
+  if (adv_type==4)
+  {
+    if (motion)
+      FatalError("The implicit solver is not available with mesh motion");
+
+    if (ArtifOn)
+      FatalError("The implicit solver is not available with shock capturing");
+
+    if (precision==1)
+      FatalError("The implicit solver needs the residual in double precision (precision 0)");
+
+    if (implicit_krylov_dim<1 || implicit_jac_freq<1)
+      FatalError("implicit_krylov_dim and implicit_jac_freq must be at least 1");
+  }
+
+  if (adv_type==5)
+  {
+    if (dt_type==0)
+      FatalError("Dual time stepping needs pseudo timesteps from the CFL number, dt_type 1 or 2");
+
+    if (motion)
+      FatalError("Dual time stepping is not available with mesh motion");
+
+    if (dual_time_max_iter<1)
+      FatalError("dual_time_max_iter must be at least 1");
+  }
+
+  if (p_multigrid)
+  {
+    if (adv_type!=0 && adv_type!=3)
+      FatalError("p-multigrid smooths with the explicit schemes, adv_type 0 or 3");
+
+    if (motion)
+      FatalError("p-multigrid is not available with mesh motion");
+
+    if (pmg_min_order<1 || pmg_min_order>=order)
+      FatalError("pmg_min_order must be at least 1 and below order");
+
+    if (pmg_n_smooth<1)
+      FatalError("pmg_n_smooth must be at least 1");
+  }
+
+  if (reorder_eles<0 || reorder_eles>3)
+    FatalError("reorder_eles must be 0 (as read), 1 (Morton), 2 (Hilbert) or 3 (reverse Cuthill-McKee)");
+
+  if (lts_levels>1)
+  {
+    if (adv_type!=3 || dt_type!=1)
+      FatalError("Local time stepping sub-cycles RK45 (adv_type 3) from the global minimum timestep (dt_type 1)");
+
+    if (p_multigrid)
+      FatalError("Local time stepping is not available with p-multigrid");
+
+    if (motion)
+      FatalError("Local time stepping is not available with mesh motion");
+
+    if (LES || ArtifOn || turb_model || forcing)
+      FatalError("Local time stepping is not available with LES, shock capturing, turbulence models or body forcing");
+  }
+
+  if (precision==1 && upts_layout==1)
+    FatalError("Mixed precision is only available with the structure of arrays layout");
+
+  if (upts_layout==1)
+  {
+    if (aosoa_width<1 || (aosoa_width&(aosoa_width-1))!=0)
+      FatalError("aosoa_width must be a power of 2");
+
+    if (pad_upts)
+      FatalError("pad_upts is not used with the AoSoA layout, the elements of a block are padded instead");
+
+    if (sparse_quad==2 || sparse_hexa==2)
+      FatalError("Sum-factorized operators are not available with the AoSoA layout");
+
+    if (LES || ArtifOn)
+      FatalError("LES and shock capturing are not available with the AoSoA layout");
+  }
   
   
   if (rank==0)
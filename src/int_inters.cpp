@@ -69,112 +69,93 @@ void int_inters::setup(int in_n_inters,int in_inter_type)
 
   (*this).setup_inters(in_n_inters,in_inter_type);
 
-      disu_fpts_r.setup(n_fpts_per_inter,n_inters,n_fields);
-      norm_tconf_fpts_r.setup(n_fpts_per_inter,n_inters,n_fields);
-      detjac_fpts_r.setup(n_fpts_per_inter,n_inters);
-      tdA_fpts_r.setup(n_fpts_per_inter,n_inters);
+      disu_fpts_r.setup(&conn_r,n_conn_types,n_fields);
+      norm_tconf_fpts_r.setup(&conn_r,n_conn_types,n_fields);
+      detjac_fpts_r.setup(&conn_r,n_conn_types);
+      tdA_fpts_r.setup(&conn_r,n_conn_types);
 
       if (motion) {
         if (run_input.GCL) {
           //disu_GCL_fpts_r.setup(n_fpts_per_inter,n_inters);
           //norm_tconf_GCL_fpts_r.setup(n_fpts_per_inter,n_inters);
         }
-        ndA_dyn_fpts_r.setup(n_fpts_per_inter,n_inters);
-        J_dyn_fpts_r.setup(n_fpts_per_inter,n_inters);
+        ndA_dyn_fpts_r.setup(&conn_r,n_conn_types);
+        J_dyn_fpts_r.setup(&conn_r,n_conn_types);
       }
 
-      delta_disu_fpts_r.setup(n_fpts_per_inter,n_inters,n_fields);
+      delta_disu_fpts_r.setup(&conn_r,n_conn_types,n_fields);
 
       if(viscous)
         {
-          grad_disu_fpts_r.setup(n_fpts_per_inter,n_inters,n_fields,n_dims);
+          grad_disu_fpts_r.setup(&conn_r,n_conn_types,n_fields,n_dims);
         }
 }
 
 // set interior interface
 void int_inters::set_interior(int in_inter, int in_ele_type_l, int in_ele_type_r, int in_ele_l, int in_ele_r, int in_local_inter_l, int in_local_inter_r, int rot_tag, struct solution* FlowSol)
 {
-  int i,j,k;
-  int i_rhs,j_rhs;
+  // the right side runs through the flux points of its face in the order of the look up table of rot_tag
+  // (inters::get_lut), permutation 1+rot_tag of the connectivity
+  int perm_r;
 
-      get_lut(rot_tag);
+  if(inters_type==0)
+    perm_r=1;
+  else
+    perm_r=1+rot_tag;
 
-      for(i=0;i<n_fields;i++)
-        {
-          for(j=0;j<n_fpts_per_inter;j++)
-            {
-              j_rhs=lut(j);
+  conn_l.set_inter(in_inter,in_ele_type_l,in_ele_l,in_local_inter_l,0);
+  conn_r.set_inter(in_inter,in_ele_type_r,in_ele_r,in_local_inter_r,perm_r);
 
-              disu_fpts_l(j,in_inter,i)=get_disu_fpts_ptr(in_ele_type_l,in_ele_l,i,in_local_inter_l,j,FlowSol);
-              disu_fpts_r(j,in_inter,i)=get_disu_fpts_ptr(in_ele_type_r,in_ele_r,i,in_local_inter_r,j_rhs,FlowSol);
+  set_fpts_l(in_ele_type_l,in_local_inter_l,FlowSol);
+  set_fpts_r(in_ele_type_r,in_local_inter_r,FlowSol);
+}
 
-              norm_tconf_fpts_l(j,in_inter,i)=get_norm_tconf_fpts_ptr(in_ele_type_l,in_ele_l,i,in_local_inter_l,j,FlowSol);
-              norm_tconf_fpts_r(j,in_inter,i)=get_norm_tconf_fpts_ptr(in_ele_type_r,in_ele_r,i,in_local_inter_r,j_rhs,FlowSol);
+// point the flux point maps of the right side at the flux point arrays of an element type
 
-              for (int k=0;k<n_dims;k++)
-                {
-                  if(viscous)
-                    {
+void int_inters::set_fpts_r(int in_ele_type, int in_local_inter, struct solution* FlowSol)
+{
+  int t=in_ele_type;
+  eles* ele=FlowSol->mesh_eles(t);
 
-                      delta_disu_fpts_l(j,in_inter,i)=get_delta_disu_fpts_ptr(in_ele_type_l,in_ele_l,i,in_local_inter_l,j,FlowSol);
-                      delta_disu_fpts_r(j,in_inter,i)=get_delta_disu_fpts_ptr(in_ele_type_r,in_ele_r,i,in_local_inter_r,j_rhs,FlowSol);
+  if(!conn_r.has_first_fpt(t,in_local_inter))
+    conn_r.set_first_fpt(t,in_local_inter,ele->get_first_fpt(in_local_inter));
 
-                      grad_disu_fpts_l(j,in_inter,i,k) = get_grad_disu_fpts_ptr(in_ele_type_l,in_ele_l,in_local_inter_l,i,k,j,FlowSol);
-                      grad_disu_fpts_r(j,in_inter,i,k) = get_grad_disu_fpts_ptr(in_ele_type_r,in_ele_r,in_local_inter_r,i,k,j_rhs,FlowSol);
-                    }
+  if(disu_fpts_r.has_type(t))
+    return;
 
-                  // Subgrid-scale flux
-                  if(LES)
-                    {
-                      sgsf_fpts_l(j,in_inter,i,k) = get_sgsf_fpts_ptr(in_ele_type_l,in_ele_l,in_local_inter_l,i,k,j,FlowSol);
-                      sgsf_fpts_r(j,in_inter,i,k) = get_sgsf_fpts_ptr(in_ele_type_r,in_ele_r,in_local_inter_r,i,k,j_rhs,FlowSol);
-                    }
-                }
-            }
-        }
+  int n_fpts_per_ele=ele->get_n_fpts_per_ele();
+  int n_eles=ele->get_n_eles();
 
-      if (motion)
-      {
-        for(j=0;j<n_fpts_per_inter;j++)
-        {
-          j_rhs=lut(j);
+  disu_fpts_r.set_type_ele_array(t,get_disu_fpts_ptr(t,0,0,0,0,FlowSol),n_fpts_per_ele,n_eles);
+  norm_tconf_fpts_r.set_type_ele_array(t,get_norm_tconf_fpts_ptr(t,0,0,0,0,FlowSol),n_fpts_per_ele,n_eles);
+  tdA_fpts_r.set_type_ele_array(t,get_tdA_fpts_ptr(t,0,0,0,FlowSol),n_fpts_per_ele,n_eles);
 
-          if (run_input.GCL) {
-//            disu_GCL_fpts_l(j,in_inter)=get_disu_GCL_fpts_ptr(in_ele_type_l,in_ele_l,in_local_inter_l,j,FlowSol);
-//            disu_GCL_fpts_r(j,in_inter)=get_disu_GCL_fpts_ptr(in_ele_type_r,in_ele_r,in_local_inter_r,j_rhs,FlowSol);
-
-//            norm_tconf_GCL_fpts_l(j,in_inter)=get_norm_tconf_GCL_fpts_ptr(in_ele_type_l,in_ele_l,in_local_inter_l,j,FlowSol);
-//            norm_tconf_GCL_fpts_r(j,in_inter)=get_norm_tconf_GCL_fpts_ptr(in_ele_type_r,in_ele_r,in_local_inter_r,j_rhs,FlowSol);
-          }
+  if(viscous) {
+      delta_disu_fpts_r.set_type_ele_array(t,get_delta_disu_fpts_ptr(t,0,0,0,0,FlowSol),n_fpts_per_ele,n_eles);
+      grad_disu_fpts_r.set_type_ele_array(t,get_grad_disu_fpts_ptr(t,0,0,0,0,0,FlowSol),n_fpts_per_ele,n_eles);
+    }
 
-          ndA_dyn_fpts_l(j,in_inter)=get_ndA_dyn_fpts_ptr(in_ele_type_l,in_ele_l,in_local_inter_l,j,FlowSol);
-          ndA_dyn_fpts_r(j,in_inter)=get_ndA_dyn_fpts_ptr(in_ele_type_r,in_ele_r,in_local_inter_r,j_rhs,FlowSol);
+  if(LES)
+    sgsf_fpts_r.set_type_ele_array(t,get_sgsf_fpts_ptr(t,0,0,0,0,0,FlowSol),n_fpts_per_ele,n_eles);
 
-          // pretty sure these should be the same due to the continuous nature of the dynamic->static mapping.
-          // But, leave it this way for now just in case.
-          J_dyn_fpts_l(j,in_inter)=get_detjac_dyn_fpts_ptr(in_ele_type_l,in_ele_l,in_local_inter_l,j,FlowSol);
-          J_dyn_fpts_r(j,in_inter)=get_detjac_dyn_fpts_ptr(in_ele_type_r,in_ele_r,in_local_inter_r,j_rhs,FlowSol);
+  if(motion) {
+      ndA_dyn_fpts_r.set_type_ele_array(t,get_ndA_dyn_fpts_ptr(t,0,0,0,FlowSol),n_fpts_per_ele,n_eles);
+      J_dyn_fpts_r.set_type_ele_array(t,get_detjac_dyn_fpts_ptr(t,0,0,0,FlowSol),n_fpts_per_ele,n_eles);
+    }
+}
 
-          for (k=0; k<n_dims; k++) {
-            norm_dyn_fpts(j,in_inter,k)=get_norm_dyn_fpts_ptr(in_ele_type_l,in_ele_l,in_local_inter_l,j,k,FlowSol);
-            grid_vel_fpts(j,in_inter,k)=get_grid_vel_fpts_ptr(in_ele_type_l,in_ele_l,in_local_inter_l,j,k,FlowSol);
-            pos_dyn_fpts(j,in_inter,k)=get_pos_dyn_fpts_ptr_cpu(in_ele_type_l,in_ele_l,in_local_inter_l,j,k,FlowSol);
-          }
-        }
-      }
+// bytes of the connectivity and flux point maps of both sides, and of the arrays of pointers they replace
 
-      for(i=0;i<n_fpts_per_inter;i++)
-        {
-          i_rhs=lut(i);
+void int_inters::get_fpts_n_bytes(long& out_n_bytes, long& out_n_bytes_ptrs)
+{
+  inters::get_fpts_n_bytes(out_n_bytes,out_n_bytes_ptrs);
 
-          tdA_fpts_l(i,in_inter)=get_tdA_fpts_ptr(in_ele_type_l,in_ele_l,in_local_inter_l,i,FlowSol);
-          tdA_fpts_r(i,in_inter)=get_tdA_fpts_ptr(in_ele_type_r,in_ele_r,in_local_inter_r,i_rhs,FlowSol);
+  out_n_bytes += conn_r.get_n_bytes();
 
-          for(j=0;j<n_dims;j++)
-            {
-              norm_fpts(i,in_inter,j)=get_norm_fpts_ptr(in_ele_type_l,in_ele_l,in_local_inter_l,i,j,FlowSol);
-            }
-        }
+  out_n_bytes_ptrs += disu_fpts_r.get_n_bytes_ptrs() + delta_disu_fpts_r.get_n_bytes_ptrs()
+      + norm_tconf_fpts_r.get_n_bytes_ptrs() + detjac_fpts_r.get_n_bytes_ptrs() + tdA_fpts_r.get_n_bytes_ptrs()
+      + grad_disu_fpts_r.get_n_bytes_ptrs() + sgsf_fpts_r.get_n_bytes_ptrs()
+      + ndA_dyn_fpts_r.get_n_bytes_ptrs() + J_dyn_fpts_r.get_n_bytes_ptrs();
 }
 
 // move all from cpu to gpu
@@ -224,124 +205,110 @@ void int_inters::mv_all_cpu_gpu(void)
 // calculate normal transformed continuous inviscid flux at the flux points
 void int_inters::calculate_common_invFlux(void)
 {
+  calculate_common_invFlux(n_inters,NULL);
+}
 
-#ifdef _CPU
-  array<double> norm(n_dims), fn(n_fields);
+// calculate normal transformed continuous inviscid flux at the flux points of the in_n_list interfaces of in_list, or
+// of all interfaces without a list (on the GPU, always all)
+void int_inters::calculate_common_invFlux(int in_n_list, int* in_list)
+{
 
-  //viscous
-  array<double> u_c(n_fields);
+#ifdef _CPU
+  double t_start = get_wall_time();
 
-  for(int i=0;i<n_inters;i++)
+#pragma omp parallel
   {
-    for(int j=0;j<n_fpts_per_inter;j++)
+    // Batch buffers of this thread
+    int thr = get_thread_num();
+    array<double>& batch_u_l = this->batch_u_l(thr);
+    array<double>& batch_u_r = this->batch_u_r(thr);
+    array<double>& batch_norm = this->batch_norm(thr);
+    array<double>& batch_v = this->batch_v(thr);
+    array<double>& batch_fn = this->batch_fn(thr);
+    array<double>& batch_u_c = this->batch_u_c(thr);
+
+    // The flux points of n_batch_inters interfaces at a time are gathered into the batch buffers, solved together and
+    // scattered back
+#pragma omp for schedule(static)
+    for(int ii_start=0;ii_start<in_n_list;ii_start+=n_batch_inters)
     {
+      int n_block = min(n_batch_inters,in_n_list-ii_start);
+      int n_pts = n_block*n_fpts_per_inter;
 
-      // calculate discontinuous solution at flux points
-      for(int k=0;k<n_fields;k++) {
-        temp_u_l(k)=(*disu_fpts_l(j,i,k));
-        temp_u_r(k)=(*disu_fpts_r(j,i,k));
-      }
+      // Gather the discontinuous solution (in dynamic space), the normal and the grid velocity
+      for(int b=0;b<n_block;b++)
+      {
+        int i=(in_list ? in_list[ii_start+b] : ii_start+b);
+        int p0=b*n_fpts_per_inter;
 
-      if (motion) {
-        // Transform solution to dynamic space
-        for (int k=0; k<n_fields; k++) {
-          temp_u_l(k) /= (*J_dyn_fpts_l(j,i));
-          temp_u_r(k) /= (*J_dyn_fpts_r(j,i));
-        }
-        // Get mesh velocity
-        for (int k=0; k<n_dims; k++) {
-          temp_v(k)=(*grid_vel_fpts(j,i,k));
+        for(int k=0;k<n_fields;k++) {
+          for(int j=0;j<n_fpts_per_inter;j++) {
+            batch_u_l(p0+j,k)=(*disu_fpts_l(j,i,k));
+            batch_u_r(p0+j,k)=(*disu_fpts_r(j,i,k));
+          }
         }
-      }else{
-        temp_v.initialize_to_zero();
-      }
 
-      // Interface unit-normal vector
-      if (motion) {
-        for (int m=0;m<n_dims;m++)
-          norm(m) = *norm_dyn_fpts(j,i,m);
-      }else{
-        for (int m=0;m<n_dims;m++)
-          norm(m) = *norm_fpts(j,i,m);
-      }
+        if (motion) {
+          for(int k=0;k<n_fields;k++) {
+            for(int j=0;j<n_fpts_per_inter;j++) {
+              batch_u_l(p0+j,k) /= (*J_dyn_fpts_l(j,i));
+              batch_u_r(p0+j,k) /= (*J_dyn_fpts_r(j,i));
+            }
+          }
 
-      // Calling Riemann solver
-      if (run_input.riemann_solve_type==0) // Rusanov
-      {
-        // calculate flux from discontinuous solution at flux points
-        if(n_dims==2) {
-          calc_invf_2d(temp_u_l,temp_f_l);
-          calc_invf_2d(temp_u_r,temp_f_r);
-          if (motion) {
-            calc_alef_2d(temp_u_l,temp_v,temp_f_l);
-            calc_alef_2d(temp_u_r,temp_v,temp_f_r);
+          for(int m=0;m<n_dims;m++) {
+            for(int j=0;j<n_fpts_per_inter;j++) {
+              batch_norm(p0+j,m)=(*norm_dyn_fpts(j,i,m));
+              batch_v(p0+j,m)=(*grid_vel_fpts(j,i,m));
+            }
           }
         }
-        else if(n_dims==3) {
-          calc_invf_3d(temp_u_l,temp_f_l);
-          calc_invf_3d(temp_u_r,temp_f_r);
-          if (motion) {
-            calc_alef_3d(temp_u_l,temp_v,temp_f_l);
-            calc_alef_3d(temp_u_r,temp_v,temp_f_r);
-          }
+        else {
+          for(int m=0;m<n_dims;m++)
+            for(int j=0;j<n_fpts_per_inter;j++)
+              batch_norm(p0+j,m)=(*norm_fpts(j,i,m));
         }
-        else
-          FatalError("ERROR: Invalid number of dimensions ... ");
-
-        rusanov_flux(temp_u_l,temp_u_r,temp_v,temp_f_l,temp_f_r,norm,fn,n_dims,n_fields,run_input.gamma);
-      }
-      else if (run_input.riemann_solve_type==1) { // Lax-Friedrich
-        lax_friedrich(temp_u_l,temp_u_r,norm,fn,n_dims,n_fields,run_input.lambda,run_input.wave_speed);
-      }
-      else if (run_input.riemann_solve_type==2) { // ROE
-        roe_flux(temp_u_l,temp_u_r,temp_v,norm,fn,n_dims,n_fields,run_input.gamma);
       }
-      else
-        FatalError("Riemann solver not implemented");
 
-      // Transform back to computational space from dynamic physical space
-      if (motion)
-      {
-        for(int k=0; k<n_fields; k++) {
-          (*norm_tconf_fpts_l(j,i,k)) = fn(k)*(*ndA_dyn_fpts_l(j,i))*(*tdA_fpts_l(j,i));
-          (*norm_tconf_fpts_r(j,i,k)) =-fn(k)*(*ndA_dyn_fpts_r(j,i))*(*tdA_fpts_r(j,i));
-        }
-      }
-      else
+      // Calling Riemann solver
+      calc_common_invFlux_batch(n_pts);
+
+      // Scatter the common flux transformed back to reference space, and the solution corrections
+      for(int b=0;b<n_block;b++)
       {
-        // Transform back to reference space from static physical space
+        int i=(in_list ? in_list[ii_start+b] : ii_start+b);
+        int p0=b*n_fpts_per_inter;
+
         for(int k=0;k<n_fields;k++) {
-          (*norm_tconf_fpts_l(j,i,k))= fn(k)*(*tdA_fpts_l(j,i));
-          (*norm_tconf_fpts_r(j,i,k))=-fn(k)*(*tdA_fpts_r(j,i));
-        }
-      }
+          for(int j=0;j<n_fpts_per_inter;j++) {
+            double fn=batch_fn(p0+j,k);
 
-      if(viscous)
-      {
-        // Calling viscous riemann solver
-        if (run_input.vis_riemann_solve_type==0)
-          ldg_solution(0,temp_u_l,temp_u_r,u_c,run_input.pen_fact,norm);
-        else
-          FatalError("Viscous Riemann solver not implemented");
+            if (motion) {
+              (*norm_tconf_fpts_l(j,i,k)) = fn*(*ndA_dyn_fpts_l(j,i))*(*tdA_fpts_l(j,i));
+              (*norm_tconf_fpts_r(j,i,k)) =-fn*(*ndA_dyn_fpts_r(j,i))*(*tdA_fpts_r(j,i));
+            }
+            else {
+              (*norm_tconf_fpts_l(j,i,k))= fn*(*tdA_fpts_l(j,i));
+              (*norm_tconf_fpts_r(j,i,k))=-fn*(*tdA_fpts_r(j,i));
+            }
 
-        if (motion) // include transformation back to static space
-        {
-          for(int k=0;k<n_fields;k++) {
-            *delta_disu_fpts_l(j,i,k) = (u_c(k) - temp_u_l(k))*(*J_dyn_fpts_l(j,i));
-            *delta_disu_fpts_r(j,i,k) = (u_c(k) - temp_u_r(k))*(*J_dyn_fpts_r(j,i));
-          }
-        }
-        else
-        {
-          for(int k=0;k<n_fields;k++) {
-            *delta_disu_fpts_l(j,i,k) = (u_c(k) - temp_u_l(k));
-            *delta_disu_fpts_r(j,i,k) = (u_c(k) - temp_u_r(k));
+            if(viscous) {
+              if (motion) { // include transformation back to static space
+                *delta_disu_fpts_l(j,i,k) = (batch_u_c(p0+j,k) - batch_u_l(p0+j,k))*(*J_dyn_fpts_l(j,i));
+                *delta_disu_fpts_r(j,i,k) = (batch_u_c(p0+j,k) - batch_u_r(p0+j,k))*(*J_dyn_fpts_r(j,i));
+              }
+              else {
+                *delta_disu_fpts_l(j,i,k) = (batch_u_c(p0+j,k) - batch_u_l(p0+j,k));
+                *delta_disu_fpts_r(j,i,k) = (batch_u_c(p0+j,k) - batch_u_r(p0+j,k));
+              }
+            }
           }
         }
       }
-
     }
   }
+
+  t_invFlux += get_wall_time()-t_start;
 #endif
 
 #ifdef _GPU
@@ -357,109 +324,162 @@ void int_inters::calculate_common_invFlux(void)
 // calculate normal transformed continuous viscous flux at the flux points
 
 void int_inters::calculate_common_viscFlux(void)
+{
+  calculate_common_viscFlux(n_inters,NULL);
+}
+
+// calculate normal transformed continuous viscous flux at the flux points of the in_n_list interfaces of in_list, or of
+// all interfaces without a list (on the GPU, always all)
+
+void int_inters::calculate_common_viscFlux(int in_n_list, int* in_list)
 {
 
 #ifdef _CPU
-  array<double> norm(n_dims), fn(n_fields);
+  double t_start = get_wall_time();
 
-  for(int i=0;i<n_inters;i++)
-    {
-      for(int j=0;j<n_fpts_per_inter;j++)
+#pragma omp parallel
+  {
+    // Scratch storage of this thread
+    int thr = get_thread_num();
+    array<double>& temp_u_l = this->temp_u_l(thr);
+    array<double>& temp_u_r = this->temp_u_r(thr);
+    array<double>& temp_f_l = this->temp_f_l(thr);
+    array<double>& temp_f_r = this->temp_f_r(thr);
+    array<double>& temp_u_l_batch = this->temp_u_l_batch(thr);
+    array<double>& temp_u_r_batch = this->temp_u_r_batch(thr);
+    array<double>& temp_grad_u_l_batch = this->temp_grad_u_l_batch(thr);
+    array<double>& temp_grad_u_r_batch = this->temp_grad_u_r_batch(thr);
+    array<double>& temp_f_l_batch = this->temp_f_l_batch(thr);
+    array<double>& temp_f_r_batch = this->temp_f_r_batch(thr);
+    array<double>& temp_sgsf_l = this->temp_sgsf_l(thr);
+    array<double>& temp_sgsf_r = this->temp_sgsf_r(thr);
+    array<double>& norm = this->temp_norm(thr);
+    array<double>& fn = this->temp_fn(thr);
+
+#pragma omp for schedule(static)
+    for(int ii=0;ii<in_n_list;ii++)
       {
-        // obtain discontinuous solution at flux points
+        int i=(in_list ? in_list[ii] : ii);
 
-        if (motion) {
-          // Transform to dynamic-physical domain
-          for(int k=0;k<n_fields;k++)
+        // Batched viscous flux at all flux points of the interface
+        for(int k=0;k<n_fields;k++)
           {
-            temp_u_l(k)=(*disu_fpts_l(j,i,k))/(*J_dyn_fpts_l(j,i));
-            temp_u_r(k)=(*disu_fpts_r(j,i,k))/(*J_dyn_fpts_r(j,i));
-          }
-        }
-        else
-        {
-          for(int k=0;k<n_fields;k++)
-          {
-            temp_u_l(k)=(*disu_fpts_l(j,i,k));
-            temp_u_r(k)=(*disu_fpts_r(j,i,k));
-          }
-        }
-
-          // obtain physical gradient of discontinuous solution at flux points
-
-          for(int k=0;k<n_dims;k++)
-            {
-              for(int l=0;l<n_fields;l++)
-                {
-                  temp_grad_u_l(l,k) = *grad_disu_fpts_l(j,i,l,k);
-                  temp_grad_u_r(l,k) = *grad_disu_fpts_r(j,i,l,k);
+            for(int j=0;j<n_fpts_per_inter;j++)
+              {
+                temp_u_l_batch(j,k)=(*disu_fpts_l(j,i,k));
+                temp_u_r_batch(j,k)=(*disu_fpts_r(j,i,k));
+
+                // Transform to dynamic-physical domain
+                if (motion) {
+                  temp_u_l_batch(j,k) /= (*J_dyn_fpts_l(j,i));
+                  temp_u_r_batch(j,k) /= (*J_dyn_fpts_r(j,i));
                 }
-            }
 
-          // calculate flux from discontinuous solution at flux points
-
-          if(n_dims==2)
-            {
-              calc_visf_2d(temp_u_l,temp_grad_u_l,temp_f_l);
-              calc_visf_2d(temp_u_r,temp_grad_u_r,temp_f_r);
-            }
-          else if(n_dims==3)
-            {
-              calc_visf_3d(temp_u_l,temp_grad_u_l,temp_f_l);
-              calc_visf_3d(temp_u_r,temp_grad_u_r,temp_f_r);
-            }
-          else
-            FatalError("ERROR: Invalid number of dimensions ... ");
-
-          // If LES, get SGS flux and add to viscous flux
-          if(LES) {
-            for(int k=0;k<n_dims;k++) {
-              for(int l=0;l<n_fields;l++) {
-                // pointers to subgrid-scale fluxes
-                temp_sgsf_l(l,k) = *sgsf_fpts_l(j,i,l,k);
-                temp_sgsf_r(l,k) = *sgsf_fpts_r(j,i,l,k);
-
-                // Add SGS fluxes to viscous fluxes
-                temp_f_l(l,k) += temp_sgsf_l(l,k);
-                temp_f_r(l,k) += temp_sgsf_r(l,k);
+                for(int m=0;m<n_dims;m++)
+                  {
+                    temp_grad_u_l_batch(j,k,m) = *grad_disu_fpts_l(j,i,k,m);
+                    temp_grad_u_r_batch(j,k,m) = *grad_disu_fpts_r(j,i,k,m);
+                  }
               }
-            }
           }
 
-          // storing normal components
-          if (motion) {
-            for (int m=0;m<n_dims;m++)
-              norm(m) = *norm_dyn_fpts(j,i,m);
+        if(n_dims==2)
+          {
+            calc_visf_2d_batch(n_fpts_per_inter,n_fields,temp_u_l_batch.get_ptr_cpu(),n_fpts_per_inter,temp_grad_u_l_batch.get_ptr_cpu(),n_fpts_per_inter,temp_f_l_batch.get_ptr_cpu(),n_fpts_per_inter);
+            calc_visf_2d_batch(n_fpts_per_inter,n_fields,temp_u_r_batch.get_ptr_cpu(),n_fpts_per_inter,temp_grad_u_r_batch.get_ptr_cpu(),n_fpts_per_inter,temp_f_r_batch.get_ptr_cpu(),n_fpts_per_inter);
           }
-          else
+        else if(n_dims==3)
           {
-            for (int m=0;m<n_dims;m++)
-              norm(m) = *norm_fpts(j,i,m);
+            calc_visf_3d_batch(n_fpts_per_inter,n_fields,temp_u_l_batch.get_ptr_cpu(),n_fpts_per_inter,temp_grad_u_l_batch.get_ptr_cpu(),n_fpts_per_inter,temp_f_l_batch.get_ptr_cpu(),n_fpts_per_inter);
+            calc_visf_3d_batch(n_fpts_per_inter,n_fields,temp_u_r_batch.get_ptr_cpu(),n_fpts_per_inter,temp_grad_u_r_batch.get_ptr_cpu(),n_fpts_per_inter,temp_f_r_batch.get_ptr_cpu(),n_fpts_per_inter);
           }
+        else
+          FatalError("ERROR: Invalid number of dimensions ... ");
 
-          // Calling viscous riemann solver
-          if (run_input.vis_riemann_solve_type==0)
-            ldg_flux(0,temp_u_l,temp_u_r,temp_f_l,temp_f_r,norm,fn,n_dims,n_fields,run_input.tau,run_input.pen_fact);
-          else
-            FatalError("Viscous Riemann solver not implemented");
+        for(int j=0;j<n_fpts_per_inter;j++)
+        {
+          // obtain discontinuous solution at flux points
 
-          // Transform back to reference space
           if (motion) {
-            for(int k=0;k<n_fields;k++) {
-              (*norm_tconf_fpts_l(j,i,k))+=  fn(k)*(*tdA_fpts_l(j,i))*(*ndA_dyn_fpts_l(j,i));
-              (*norm_tconf_fpts_r(j,i,k))+= -fn(k)*(*tdA_fpts_r(j,i))*(*ndA_dyn_fpts_r(j,i));
+            // Transform to dynamic-physical domain
+            for(int k=0;k<n_fields;k++)
+            {
+              temp_u_l(k)=(*disu_fpts_l(j,i,k))/(*J_dyn_fpts_l(j,i));
+              temp_u_r(k)=(*disu_fpts_r(j,i,k))/(*J_dyn_fpts_r(j,i));
             }
           }
           else
           {
-            for(int k=0;k<n_fields;k++) {
-              (*norm_tconf_fpts_l(j,i,k))+=  fn(k)*(*tdA_fpts_l(j,i));
-              (*norm_tconf_fpts_r(j,i,k))+= -fn(k)*(*tdA_fpts_r(j,i));
+            for(int k=0;k<n_fields;k++)
+            {
+              temp_u_l(k)=(*disu_fpts_l(j,i,k));
+              temp_u_r(k)=(*disu_fpts_r(j,i,k));
             }
           }
 
-        }
-    }
+            // flux from discontinuous solution at flux points
+
+            for(int k=0;k<n_dims;k++)
+              {
+                for(int l=0;l<n_fields;l++)
+                  {
+                    temp_f_l(l,k) = temp_f_l_batch(j,l,k);
+                    temp_f_r(l,k) = temp_f_r_batch(j,l,k);
+                  }
+              }
+
+            // If LES, get SGS flux and add to viscous flux
+            if(LES) {
+              for(int k=0;k<n_dims;k++) {
+                for(int l=0;l<n_fields;l++) {
+                  // pointers to subgrid-scale fluxes
+                  temp_sgsf_l(l,k) = *sgsf_fpts_l(j,i,l,k);
+                  temp_sgsf_r(l,k) = *sgsf_fpts_r(j,i,l,k);
+
+                  // Add SGS fluxes to viscous fluxes
+                  temp_f_l(l,k) += temp_sgsf_l(l,k);
+                  temp_f_r(l,k) += temp_sgsf_r(l,k);
+                }
+              }
+            }
+
+            // storing normal components
+            if (motion) {
+              for (int m=0;m<n_dims;m++)
+                norm(m) = *norm_dyn_fpts(j,i,m);
+            }
+            else
+            {
+              for (int m=0;m<n_dims;m++)
+                norm(m) = *norm_fpts(j,i,m);
+            }
+
+            // Calling viscous riemann solver
+            if (run_input.vis_riemann_solve_type==0)
+              ldg_flux(0,temp_u_l,temp_u_r,temp_f_l,temp_f_r,norm,fn,n_dims,n_fields,run_input.tau,run_input.pen_fact);
+            else
+              FatalError("Viscous Riemann solver not implemented");
+
+            // Transform back to reference space
+            if (motion) {
+              for(int k=0;k<n_fields;k++) {
+                (*norm_tconf_fpts_l(j,i,k))+=  fn(k)*(*tdA_fpts_l(j,i))*(*ndA_dyn_fpts_l(j,i));
+                (*norm_tconf_fpts_r(j,i,k))+= -fn(k)*(*tdA_fpts_r(j,i))*(*ndA_dyn_fpts_r(j,i));
+              }
+            }
+            else
+            {
+              for(int k=0;k<n_fields;k++) {
+                (*norm_tconf_fpts_l(j,i,k))+=  fn(k)*(*tdA_fpts_l(j,i));
+                (*norm_tconf_fpts_r(j,i,k))+= -fn(k)*(*tdA_fpts_r(j,i));
+              }
+            }
+
+          }
+      }
+  }
+
+  t_viscFlux += get_wall_time()-t_start;
 
 #endif
 
@@ -112,12 +112,34 @@ void inters::setup_inters(int in_n_inters, int in_inters_type)
   if (run_input.turb_model==1)
     n_fields++;
 
-      disu_fpts_l.setup(n_fpts_per_inter,n_inters,n_fields);
-      norm_tconf_fpts_l.setup(n_fpts_per_inter,n_inters,n_fields);
-      detjac_fpts_l.setup(n_fpts_per_inter,n_inters);
-      tdA_fpts_l.setup(n_fpts_per_inter,n_inters);
-      norm_fpts.setup(n_fpts_per_inter,n_inters,n_dims);
-      pos_fpts.setup(n_fpts_per_inter,n_inters,n_dims);
+      // Connectivity of the sides: element types 0 to 4 of eles and 5 for the receive buffer of mpi_inters, up to 6
+      // faces per element, and the identity and the look up table of each rotation tag
+      n_conn_types=6;
+
+      if(inters_type==0)
+        n_perms=2;
+      else if(inters_type==1)
+        n_perms=4;
+      else
+        n_perms=5;
+
+      lut.setup(n_fpts_per_inter);
+
+      conn_l.setup(n_inters,n_fpts_per_inter,n_conn_types,6,n_perms);
+      conn_r.setup(n_inters,n_fpts_per_inter,n_conn_types,6,n_perms);
+
+      for(int r=0;r<n_perms-1;r++) {
+          get_lut(r);
+          conn_l.set_lut(1+r,lut);
+          conn_r.set_lut(1+r,lut);
+        }
+
+      disu_fpts_l.setup(&conn_l,n_conn_types,n_fields);
+      norm_tconf_fpts_l.setup(&conn_l,n_conn_types,n_fields);
+      detjac_fpts_l.setup(&conn_l,n_conn_types);
+      tdA_fpts_l.setup(&conn_l,n_conn_types);
+      norm_fpts.setup(&conn_l,n_conn_types,n_dims);
+      pos_fpts.setup(&conn_l,n_conn_types,n_dims);
 
       if (motion)
       {
@@ -125,62 +147,137 @@ void inters::setup_inters(int in_n_inters, int in_inters_type)
           disu_GCL_fpts_l.setup(n_fpts_per_inter,n_inters);
           norm_tconf_GCL_fpts_l.setup(n_fpts_per_inter,n_inters);
         }
-        grid_vel_fpts.setup(n_fpts_per_inter,n_inters,n_dims);
-        ndA_dyn_fpts_l.setup(n_fpts_per_inter,n_inters);
-        norm_dyn_fpts.setup(n_fpts_per_inter,n_inters,n_dims);
-        J_dyn_fpts_l.setup(n_fpts_per_inter,n_inters);        
-        pos_dyn_fpts.setup(n_fpts_per_inter,n_inters,n_dims);
+        grid_vel_fpts.setup(&conn_l,n_conn_types,n_dims);
+        ndA_dyn_fpts_l.setup(&conn_l,n_conn_types);
+        norm_dyn_fpts.setup(&conn_l,n_conn_types,n_dims);
+        J_dyn_fpts_l.setup(&conn_l,n_conn_types);
+        pos_dyn_fpts.setup(&conn_l,n_conn_types,n_dims);
       }
 
-      delta_disu_fpts_l.setup(n_fpts_per_inter,n_inters,n_fields);
+      delta_disu_fpts_l.setup(&conn_l,n_conn_types,n_fields);
 
       if(viscous)
         {
-          grad_disu_fpts_l.setup(n_fpts_per_inter,n_inters,n_fields,n_dims);
+          grad_disu_fpts_l.setup(&conn_l,n_conn_types,n_fields,n_dims);
           normal_disu_fpts_l.setup(n_fpts_per_inter,n_inters,n_fields);
           pos_disu_fpts_l.setup(n_fpts_per_inter,n_inters,n_dims);
         }
 
       if(LES) {
-        sgsf_fpts_l.setup(n_fpts_per_inter,n_inters,n_fields,n_dims);
-        sgsf_fpts_r.setup(n_fpts_per_inter,n_inters,n_fields,n_dims);
-        temp_sgsf_l.setup(n_fields,n_dims);
-        temp_sgsf_r.setup(n_fields,n_dims);
-      }
-      else {
-        sgsf_fpts_l.setup(1);
-        sgsf_fpts_r.setup(1);
+        sgsf_fpts_l.setup(&conn_l,n_conn_types,n_fields,n_dims);
+        sgsf_fpts_r.setup(&conn_r,n_conn_types,n_fields,n_dims);
       }
 
-      temp_u_l.setup(n_fields);
-      temp_u_r.setup(n_fields);
+      // about 64 flux points per batch, so that the buffers of a batch stay in the L1 cache
+      n_batch_inters = max(1,64/n_fpts_per_inter);
 
-      temp_v.setup(n_dims);
+      setup_thread_scratch();
 
-      temp_grad_u_l.setup(n_fields,n_dims);
-      temp_grad_u_r.setup(n_fields,n_dims);
+      t_invFlux = 0.;
+      t_viscFlux = 0.;
+}
 
-      temp_normal_u_l.setup(n_fields);
+void inters::setup_thread_scratch(void)
+{
+  n_threads = get_n_threads();
+
+  int n_batch = n_batch_inters*n_fpts_per_inter;
+
+  temp_u_l.setup(n_threads);
+  temp_u_r.setup(n_threads);
+  temp_f_l.setup(n_threads);
+  temp_f_r.setup(n_threads);
+  temp_fn_l.setup(n_threads);
+  temp_fn_r.setup(n_threads);
+  temp_norm.setup(n_threads);
+  temp_fn.setup(n_threads);
+  temp_f.setup(n_threads);
+  temp_u_l_batch.setup(n_threads);
+  temp_u_r_batch.setup(n_threads);
+  temp_grad_u_l_batch.setup(n_threads);
+  temp_grad_u_r_batch.setup(n_threads);
+  temp_f_l_batch.setup(n_threads);
+  temp_f_r_batch.setup(n_threads);
+  batch_u_l.setup(n_threads);
+  batch_u_r.setup(n_threads);
+  batch_norm.setup(n_threads);
+  batch_v.setup(n_threads);
+  batch_f_l.setup(n_threads);
+  batch_f_r.setup(n_threads);
+  batch_fn.setup(n_threads);
+  batch_u_c.setup(n_threads);
+  batch_eig.setup(n_threads);
+  temp_sgsf_l.setup(n_threads);
+  temp_sgsf_r.setup(n_threads);
+  v_l.setup(n_threads);
+  v_r.setup(n_threads);
+  um.setup(n_threads);
+  du.setup(n_threads);
+
+  for (int t=0; t<n_threads; t++)
+  {
+    temp_u_l(t).setup(n_fields);
+    temp_u_r(t).setup(n_fields);
 
-      temp_pos_u_l.setup(n_dims);
+    temp_f_l(t).setup(n_fields,n_dims);
+    temp_f_r(t).setup(n_fields,n_dims);
 
-      temp_f_l.setup(n_fields,n_dims);
-      temp_f_r.setup(n_fields,n_dims);
+    temp_f(t).setup(n_fields,n_dims);
 
-      temp_f.setup(n_fields,n_dims);
+    temp_fn_l(t).setup(n_fields);
+    temp_fn_r(t).setup(n_fields);
 
-      temp_fn_l.setup(n_fields);
-      temp_fn_r.setup(n_fields);
+    temp_norm(t).setup(n_dims);
+    temp_fn(t).setup(n_fields);
 
-      temp_loc.setup(n_dims);
+    temp_u_l_batch(t).setup(n_fpts_per_inter,n_fields);
+    temp_u_r_batch(t).setup(n_fpts_per_inter,n_fields);
+    temp_f_l_batch(t).setup(n_fpts_per_inter,n_fields,n_dims);
+    temp_f_r_batch(t).setup(n_fpts_per_inter,n_fields,n_dims);
+    if(viscous) {
+      temp_grad_u_l_batch(t).setup(n_fpts_per_inter,n_fields,n_dims);
+      temp_grad_u_r_batch(t).setup(n_fpts_per_inter,n_fields,n_dims);
+    }
 
-      lut.setup(n_fpts_per_inter);
+    batch_u_l(t).setup(n_batch,n_fields);
+    batch_u_r(t).setup(n_batch,n_fields);
+    batch_norm(t).setup(n_batch,n_dims);
+    batch_v(t).setup(n_batch,n_dims);
+    batch_f_l(t).setup(n_batch,n_fields,n_dims);
+    batch_f_r(t).setup(n_batch,n_fields,n_dims);
+    batch_fn(t).setup(n_batch,n_fields);
+    batch_u_c(t).setup(n_batch,n_fields);
+    batch_eig(t).setup(n_batch);
+
+    // the grid velocity stays zero without motion
+    batch_v(t).initialize_to_zero();
+
+    if(LES) {
+      temp_sgsf_l(t).setup(n_fields,n_dims);
+      temp_sgsf_r(t).setup(n_fields,n_dims);
+    }
 
-      // For Roe flux computation
-      v_l.setup(n_dims);
-      v_r.setup(n_dims);
-      um.setup(n_dims);
-      du.setup(n_fields);
+    // For Roe flux computation
+    v_l(t).setup(n_dims);
+    v_r(t).setup(n_dims);
+    um(t).setup(n_dims);
+    du(t).setup(n_fields);
+  }
+}
+
+int inters::get_n_inters(void)
+{
+  return n_inters;
+}
+
+double inters::get_invFlux_time(void)
+{
+  return t_invFlux;
+}
+
+double inters::get_viscFlux_time(void)
+{
+  return t_viscFlux;
 }
 
 // get look up table for flux point connectivity based on rotation tag
@@ -295,6 +392,63 @@ void inters::get_lut(int in_rot_tag)
     }
 }
 
+// point the flux point maps of the left side at the flux point arrays of an element type
+
+void inters::set_fpts_l(int in_ele_type, int in_local_inter, struct solution* FlowSol)
+{
+  int t=in_ele_type;
+  eles* ele=FlowSol->mesh_eles(t);
+
+  if(!conn_l.has_first_fpt(t,in_local_inter))
+    conn_l.set_first_fpt(t,in_local_inter,ele->get_first_fpt(in_local_inter));
+
+  if(disu_fpts_l.has_type(t))
+    return;
+
+  int n_fpts_per_ele=ele->get_n_fpts_per_ele();
+  int n_eles=ele->get_n_eles();
+
+  disu_fpts_l.set_type_ele_array(t,get_disu_fpts_ptr(t,0,0,0,0,FlowSol),n_fpts_per_ele,n_eles);
+  norm_tconf_fpts_l.set_type_ele_array(t,get_norm_tconf_fpts_ptr(t,0,0,0,0,FlowSol),n_fpts_per_ele,n_eles);
+  tdA_fpts_l.set_type_ele_array(t,get_tdA_fpts_ptr(t,0,0,0,FlowSol),n_fpts_per_ele,n_eles);
+  norm_fpts.set_type_ele_array(t,get_norm_fpts_ptr(t,0,0,0,0,FlowSol),n_fpts_per_ele,n_eles);
+#ifdef _CPU
+  pos_fpts.set_type_ele_array(t,get_loc_fpts_ptr_cpu(t,0,0,0,0,FlowSol),n_fpts_per_ele,n_eles);
+#endif
+#ifdef _GPU
+  pos_fpts.set_type_ele_array(t,get_loc_fpts_ptr_gpu(t,0,0,0,0,FlowSol),n_fpts_per_ele,n_eles);
+#endif
+
+  if(viscous) {
+      delta_disu_fpts_l.set_type_ele_array(t,get_delta_disu_fpts_ptr(t,0,0,0,0,FlowSol),n_fpts_per_ele,n_eles);
+      grad_disu_fpts_l.set_type_ele_array(t,get_grad_disu_fpts_ptr(t,0,0,0,0,0,FlowSol),n_fpts_per_ele,n_eles);
+    }
+
+  if(LES)
+    sgsf_fpts_l.set_type_ele_array(t,get_sgsf_fpts_ptr(t,0,0,0,0,0,FlowSol),n_fpts_per_ele,n_eles);
+
+  if(motion) {
+      ndA_dyn_fpts_l.set_type_ele_array(t,get_ndA_dyn_fpts_ptr(t,0,0,0,FlowSol),n_fpts_per_ele,n_eles);
+      J_dyn_fpts_l.set_type_ele_array(t,get_detjac_dyn_fpts_ptr(t,0,0,0,FlowSol),n_fpts_per_ele,n_eles);
+      norm_dyn_fpts.set_type_ele_array(t,get_norm_dyn_fpts_ptr(t,0,0,0,0,FlowSol),n_fpts_per_ele,n_eles);
+      grid_vel_fpts.set_type_ele_array(t,get_grid_vel_fpts_ptr(t,0,0,0,0,FlowSol),n_fpts_per_ele,n_eles);
+      pos_dyn_fpts.set_type_ele_array(t,get_pos_dyn_fpts_ptr_cpu(t,0,0,0,0,FlowSol),n_fpts_per_ele,n_eles);
+    }
+}
+
+// bytes of the connectivity and flux point maps of the left side, and of the arrays of pointers they replace
+
+void inters::get_fpts_n_bytes(long& out_n_bytes, long& out_n_bytes_ptrs)
+{
+  out_n_bytes = conn_l.get_n_bytes();
+
+  out_n_bytes_ptrs = disu_fpts_l.get_n_bytes_ptrs() + delta_disu_fpts_l.get_n_bytes_ptrs()
+      + norm_tconf_fpts_l.get_n_bytes_ptrs() + detjac_fpts_l.get_n_bytes_ptrs() + tdA_fpts_l.get_n_bytes_ptrs()
+      + norm_fpts.get_n_bytes_ptrs() + pos_fpts.get_n_bytes_ptrs() + pos_dyn_fpts.get_n_bytes_ptrs()
+      + grad_disu_fpts_l.get_n_bytes_ptrs() + sgsf_fpts_l.get_n_bytes_ptrs() + ndA_dyn_fpts_l.get_n_bytes_ptrs()
+      + norm_dyn_fpts.get_n_bytes_ptrs() + J_dyn_fpts_l.get_n_bytes_ptrs() + grid_vel_fpts.get_n_bytes_ptrs();
+}
+
 // Rusanov inviscid numerical flux
 void inters::right_flux(array<double> &f_r, array<double> &norm, array<double> &fn, int n_dims, int n_fields, double gamma)
 {
@@ -311,7 +465,8 @@ void inters::right_flux(array<double> &f_r, array<double> &norm, array<double> &
 void inters::rusanov_flux(array<double> &u_l, array<double> &u_r, array<double> &v_g, array<double> &f_l, array<double> &f_r, array<double> &norm, array<double> &fn, int n_dims, int n_fields, double gamma)
 {
   double vx_l,vy_l,vx_r,vy_r,vz_l,vz_r,vn_l,vn_r,p_l,p_r,vn_g,vn_av_mag,c_av,eig;
-  array<double> fn_l(n_fields),fn_r(n_fields);
+  array<double>& fn_l = temp_fn_l(get_thread_num());
+  array<double>& fn_r = temp_fn_r(get_thread_num());
 
   // calculate normal flux from discontinuous solution at flux points
   for(int k=0;k<n_fields;k++) {
@@ -367,7 +522,8 @@ void inters::rusanov_flux(array<double> &u_l, array<double> &u_r, array<double>
 // Central-difference inviscid numerical flux at the boundaries
 void inters::convective_flux_boundary( array<double> &f_l, array<double> &f_r, array<double> &norm, array<double> &fn, int n_dims, int n_fields)
 {
-  array<double> fn_l(n_fields),fn_r(n_fields);
+  array<double>& fn_l = temp_fn_l(get_thread_num());
+  array<double>& fn_r = temp_fn_r(get_thread_num());
 
   // calculate normal flux from total discontinuous flux at flux points
   for(int k=0;k<n_fields;k++) {
@@ -395,7 +551,12 @@ void inters::roe_flux(array<double> &u_l, array<double> &u_r, array<double> &v_g
   double lambda0,lambdaP,lambdaM;
   double rhoun_l, rhoun_r,eps;
   double a1,a2,a3,a4,a5,a6,aL1,bL1;
-  //array<double> um(n_dims);
+
+  int thr = get_thread_num();
+  array<double>& v_l = this->v_l(thr);
+  array<double>& v_r = this->v_r(thr);
+  array<double>& um = this->um(thr);
+  array<double>& du = this->du(thr);
 
   // velocities
   for (int i=0;i<n_dims;i++)  {
@@ -549,7 +710,7 @@ void inters::lax_friedrich(array<double> &u_l, array<double> &u_r, array<double>
 // LDG viscous numerical flux
 void inters::ldg_flux(int flux_spec, array<double> &u_l, array<double> &u_r, array<double> &f_l, array<double> &f_r, array<double> &norm, array<double> &fn, int n_dims, int n_fields, double tau, double pen_fact)
 {
-  array<double> f_c(n_fields,n_dims);
+  array<double>& f_c = temp_f(get_thread_num());
   double norm_x, norm_y, norm_z;
 
   if(n_dims==2) // needs to be reviewed and understood
@@ -677,3 +838,380 @@ void inters::ldg_solution(int flux_spec, array<double> &u_l, array<double> &u_r,
 
 }
 
+
+// common inviscid flux, and common solution when viscous, of the flux points of the batch buffers
+
+void inters::calc_common_invFlux_batch(int in_n_pts)
+{
+  // Batch buffers of this thread
+  int thr = get_thread_num();
+  array<double>& batch_u_l = this->batch_u_l(thr);
+  array<double>& batch_u_r = this->batch_u_r(thr);
+  array<double>& batch_v = this->batch_v(thr);
+  array<double>& batch_f_l = this->batch_f_l(thr);
+  array<double>& batch_f_r = this->batch_f_r(thr);
+
+  int n_batch = batch_u_l.get_dim(0);
+
+  if (run_input.riemann_solve_type==0) // Rusanov
+    {
+      if(n_dims==2) {
+          calc_invf_2d_batch(in_n_pts,n_fields,batch_u_l.get_ptr_cpu(),n_batch,batch_f_l.get_ptr_cpu(),n_batch);
+          calc_invf_2d_batch(in_n_pts,n_fields,batch_u_r.get_ptr_cpu(),n_batch,batch_f_r.get_ptr_cpu(),n_batch);
+        }
+      else if(n_dims==3) {
+          calc_invf_3d_batch(in_n_pts,n_fields,batch_u_l.get_ptr_cpu(),n_batch,batch_f_l.get_ptr_cpu(),n_batch);
+          calc_invf_3d_batch(in_n_pts,n_fields,batch_u_r.get_ptr_cpu(),n_batch,batch_f_r.get_ptr_cpu(),n_batch);
+        }
+      else
+        FatalError("ERROR: Invalid number of dimensions ... ");
+
+      // additional ALE flux term, as in calc_alef_2d/calc_alef_3d
+      if (motion)
+        {
+          int n_ale_fields = (run_input.equation==0 ? n_dims+2 : 1);
+
+          for(int k=0;k<n_ale_fields;k++)
+            for(int l=0;l<n_dims;l++)
+              {
+                double* f_l = batch_f_l.get_ptr_cpu(0,k,l);
+                double* f_r = batch_f_r.get_ptr_cpu(0,k,l);
+                double* u_l = batch_u_l.get_ptr_cpu(0,k);
+                double* u_r = batch_u_r.get_ptr_cpu(0,k);
+                double* v = batch_v.get_ptr_cpu(0,l);
+
+                for(int p=0;p<in_n_pts;p++) {
+                    f_l[p] -= u_l[p]*v[p];
+                    f_r[p] -= u_r[p]*v[p];
+                  }
+              }
+        }
+
+      rusanov_flux_batch(in_n_pts);
+    }
+  else if (run_input.riemann_solve_type==1) // Lax-Friedrich
+    lax_friedrich_batch(in_n_pts);
+  else if (run_input.riemann_solve_type==2) // ROE
+    roe_flux_batch(in_n_pts);
+  else
+    FatalError("Riemann solver not implemented");
+
+  if(viscous)
+    {
+      if (run_input.vis_riemann_solve_type==0)
+        ldg_solution_batch(in_n_pts);
+      else
+        FatalError("Viscous Riemann solver not implemented");
+    }
+}
+
+// Rusanov inviscid numerical flux of the points of the batch buffers
+
+void inters::rusanov_flux_batch(int in_n_pts)
+{
+  // Batch buffers of this thread
+  int thr = get_thread_num();
+  array<double>& batch_u_l = this->batch_u_l(thr);
+  array<double>& batch_u_r = this->batch_u_r(thr);
+  array<double>& batch_norm = this->batch_norm(thr);
+  array<double>& batch_v = this->batch_v(thr);
+  array<double>& batch_f_l = this->batch_f_l(thr);
+  array<double>& batch_f_r = this->batch_f_r(thr);
+  array<double>& batch_fn = this->batch_fn(thr);
+  array<double>& batch_eig = this->batch_eig(thr);
+
+  double gamma = run_input.gamma;
+  double* rho_l = batch_u_l.get_ptr_cpu(0,0);
+  double* rho_r = batch_u_r.get_ptr_cpu(0,0);
+  double* ene_l = batch_u_l.get_ptr_cpu(0,n_dims+1);
+  double* ene_r = batch_u_r.get_ptr_cpu(0,n_dims+1);
+  double* eig = batch_eig.get_ptr_cpu();
+
+  // wave speed of each point
+  if(n_dims==2) {
+      double* mx_l = batch_u_l.get_ptr_cpu(0,1);
+      double* my_l = batch_u_l.get_ptr_cpu(0,2);
+      double* mx_r = batch_u_r.get_ptr_cpu(0,1);
+      double* my_r = batch_u_r.get_ptr_cpu(0,2);
+      double* nx = batch_norm.get_ptr_cpu(0,0);
+      double* ny = batch_norm.get_ptr_cpu(0,1);
+      double* vgx = batch_v.get_ptr_cpu(0,0);
+      double* vgy = batch_v.get_ptr_cpu(0,1);
+
+      for(int p=0;p<in_n_pts;p++) {
+          double vx_l=mx_l[p]/rho_l[p];
+          double vx_r=mx_r[p]/rho_r[p];
+          double vy_l=my_l[p]/rho_l[p];
+          double vy_r=my_r[p]/rho_r[p];
+
+          double vn_l=vx_l*nx[p]+vy_l*ny[p];
+          double vn_r=vx_r*nx[p]+vy_r*ny[p];
+          double vn_g=vgx[p]*nx[p] + vgy[p]*ny[p];
+
+          double p_l=(gamma-1.0)*(ene_l[p]-(0.5*rho_l[p]*((vx_l*vx_l)+(vy_l*vy_l))));
+          double p_r=(gamma-1.0)*(ene_r[p]-(0.5*rho_r[p]*((vx_r*vx_r)+(vy_r*vy_r))));
+
+          double vn_av_mag=sqrt(0.25*(vn_l+vn_r)*(vn_l+vn_r));
+          double c_av=sqrt((gamma*(p_l+p_r))/(rho_l[p]+rho_r[p]));
+          eig[p] = fabs(vn_av_mag - vn_g + c_av);
+        }
+    }
+  else if(n_dims==3) {
+      double* mx_l = batch_u_l.get_ptr_cpu(0,1);
+      double* my_l = batch_u_l.get_ptr_cpu(0,2);
+      double* mz_l = batch_u_l.get_ptr_cpu(0,3);
+      double* mx_r = batch_u_r.get_ptr_cpu(0,1);
+      double* my_r = batch_u_r.get_ptr_cpu(0,2);
+      double* mz_r = batch_u_r.get_ptr_cpu(0,3);
+      double* nx = batch_norm.get_ptr_cpu(0,0);
+      double* ny = batch_norm.get_ptr_cpu(0,1);
+      double* nz = batch_norm.get_ptr_cpu(0,2);
+      double* vgx = batch_v.get_ptr_cpu(0,0);
+      double* vgy = batch_v.get_ptr_cpu(0,1);
+      double* vgz = batch_v.get_ptr_cpu(0,2);
+
+      for(int p=0;p<in_n_pts;p++) {
+          double vx_l=mx_l[p]/rho_l[p];
+          double vx_r=mx_r[p]/rho_r[p];
+          double vy_l=my_l[p]/rho_l[p];
+          double vy_r=my_r[p]/rho_r[p];
+          double vz_l=mz_l[p]/rho_l[p];
+          double vz_r=mz_r[p]/rho_r[p];
+
+          double vn_l=vx_l*nx[p]+vy_l*ny[p]+vz_l*nz[p];
+          double vn_r=vx_r*nx[p]+vy_r*ny[p]+vz_r*nz[p];
+          double vn_g=vgx[p]*nx[p] + vgy[p]*ny[p] + vgz[p]*nz[p];
+
+          double p_l=(gamma-1.0)*(ene_l[p]-(0.5*rho_l[p]*((vx_l*vx_l)+(vy_l*vy_l)+(vz_l*vz_l))));
+          double p_r=(gamma-1.0)*(ene_r[p]-(0.5*rho_r[p]*((vx_r*vx_r)+(vy_r*vy_r)+(vz_r*vz_r))));
+
+          double vn_av_mag=sqrt(0.25*(vn_l+vn_r)*(vn_l+vn_r));
+          double c_av=sqrt((gamma*(p_l+p_r))/(rho_l[p]+rho_r[p]));
+          eig[p] = fabs(vn_av_mag - vn_g + c_av);
+        }
+    }
+  else
+    FatalError("ERROR: Invalid number of dimensions ... ");
+
+  // calculate the normal continuous flux at the flux points, field by field, with the normal fluxes from the
+  // discontinuous solution summed in place of the x flux
+  for(int k=0;k<n_fields;k++)
+    {
+      double* fn = batch_fn.get_ptr_cpu(0,k);
+      double* u_l = batch_u_l.get_ptr_cpu(0,k);
+      double* u_r = batch_u_r.get_ptr_cpu(0,k);
+      double* fn_l = batch_f_l.get_ptr_cpu(0,k,0);
+      double* fn_r = batch_f_r.get_ptr_cpu(0,k,0);
+      double* n = batch_norm.get_ptr_cpu(0,0);
+
+      for(int p=0;p<in_n_pts;p++) {
+          fn_l[p] *= n[p];
+          fn_r[p] *= n[p];
+        }
+
+      for(int l=1;l<n_dims;l++)
+        {
+          double* f_l = batch_f_l.get_ptr_cpu(0,k,l);
+          double* f_r = batch_f_r.get_ptr_cpu(0,k,l);
+          n = batch_norm.get_ptr_cpu(0,l);
+
+          for(int p=0;p<in_n_pts;p++) {
+              fn_l[p] += f_l[p]*n[p];
+              fn_r[p] += f_r[p]*n[p];
+            }
+        }
+
+      for(int p=0;p<in_n_pts;p++)
+        fn[p] = 0.5*( (fn_l[p]+fn_r[p]) - eig[p]*(u_r[p]-u_l[p]) );
+    }
+}
+
+// Roe inviscid numerical flux of the points of the batch buffers
+
+void inters::roe_flux_batch(int in_n_pts)
+{
+  // Batch buffers of this thread
+  int thr = get_thread_num();
+  array<double>& batch_u_l = this->batch_u_l(thr);
+  array<double>& batch_u_r = this->batch_u_r(thr);
+  array<double>& batch_norm = this->batch_norm(thr);
+  array<double>& batch_v = this->batch_v(thr);
+  array<double>& batch_fn = this->batch_fn(thr);
+
+  if (n_dims!=2)
+    FatalError("Roe not implemented in 3D");
+
+  double gamma = run_input.gamma;
+  double* rho_l = batch_u_l.get_ptr_cpu(0,0);
+  double* mx_l = batch_u_l.get_ptr_cpu(0,1);
+  double* my_l = batch_u_l.get_ptr_cpu(0,2);
+  double* ene_l = batch_u_l.get_ptr_cpu(0,3);
+  double* rho_r = batch_u_r.get_ptr_cpu(0,0);
+  double* mx_r = batch_u_r.get_ptr_cpu(0,1);
+  double* my_r = batch_u_r.get_ptr_cpu(0,2);
+  double* ene_r = batch_u_r.get_ptr_cpu(0,3);
+  double* nx = batch_norm.get_ptr_cpu(0,0);
+  double* ny = batch_norm.get_ptr_cpu(0,1);
+  double* vgx = batch_v.get_ptr_cpu(0,0);
+  double* vgy = batch_v.get_ptr_cpu(0,1);
+  double* fn0 = batch_fn.get_ptr_cpu(0,0);
+  double* fn1 = batch_fn.get_ptr_cpu(0,1);
+  double* fn2 = batch_fn.get_ptr_cpu(0,2);
+  double* fn3 = batch_fn.get_ptr_cpu(0,3);
+
+  for(int p=0;p<in_n_pts;p++)
+    {
+      // velocities
+      double vx_l = mx_l[p]/rho_l[p];
+      double vy_l = my_l[p]/rho_l[p];
+      double vx_r = mx_r[p]/rho_r[p];
+      double vy_r = my_r[p]/rho_r[p];
+
+      double p_l=(gamma-1.0)*(ene_l[p]-(0.5*rho_l[p]*((vx_l*vx_l)+(vy_l*vy_l))));
+      double p_r=(gamma-1.0)*(ene_r[p]-(0.5*rho_r[p]*((vx_r*vx_r)+(vy_r*vy_r))));
+
+      double h_l = (ene_l[p]+p_l)/rho_l[p];
+      double h_r = (ene_r[p]+p_r)/rho_r[p];
+
+      double sq_rho = sqrt(rho_r[p]/rho_l[p]);
+      double rrho = 1./(sq_rho+1.);
+
+      double umx = rrho*(vx_l+sq_rho*vx_r);
+      double umy = rrho*(vy_l+sq_rho*vy_r);
+      double hm = rrho*(h_l+sq_rho*h_r);
+
+      double usq = 0.5*umx*umx + 0.5*umy*umy;
+
+      double am_sq = (gamma-1.)*(hm-usq);
+      double am = sqrt(am_sq);
+      double unm = umx*nx[p] + umy*ny[p];
+      double vgn = vgx[p]*nx[p] + vgy[p]*ny[p];
+
+      // Compute Euler flux (first part)
+      double rhoun_l = mx_l[p]*nx[p] + my_l[p]*ny[p];
+      double rhoun_r = mx_r[p]*nx[p] + my_r[p]*ny[p];
+
+      double f0 = rhoun_l + rhoun_r;
+      double f1 = rhoun_l*vx_l + rhoun_r*vx_r + (p_l+p_r)*nx[p];
+      double f2 = rhoun_l*vy_l + rhoun_r*vy_r + (p_l+p_r)*ny[p];
+      double f3 = rhoun_l*h_l + rhoun_r*h_r;
+
+      double du0 = rho_r[p]-rho_l[p];
+      double du1 = mx_r[p]-mx_l[p];
+      double du2 = my_r[p]-my_l[p];
+      double du3 = ene_r[p]-ene_l[p];
+
+      double lambda0 = fabs(unm-vgn);
+      double lambdaP = fabs(unm-vgn+am);
+      double lambdaM = fabs(unm-vgn-am);
+
+      // Entropy fix
+      double eps = 0.5*(fabs(rhoun_l/rho_l[p]-rhoun_r/rho_r[p])+ fabs(sqrt(gamma*p_l/rho_l[p])-sqrt(gamma*p_r/rho_r[p])));
+      lambda0 = (lambda0 < 2.*eps ? 0.25*lambda0*lambda0/eps + eps : lambda0);
+      lambdaP = (lambdaP < 2.*eps ? 0.25*lambdaP*lambdaP/eps + eps : lambdaP);
+      lambdaM = (lambdaM < 2.*eps ? 0.25*lambdaM*lambdaM/eps + eps : lambdaM);
+
+      double a2 = 0.5*(lambdaP+lambdaM)-lambda0;
+      double a3 = 0.5*(lambdaP-lambdaM)/am;
+      double a1 = a2*(gamma-1.)/am_sq;
+      double a4 = a3*(gamma-1.);
+
+      double a5 = usq*du0-umx*du1-umy*du2+du3;
+      double a6 = unm*du0-nx[p]*du1-ny[p]*du2;
+
+      double aL1 = a1*a5 - a3*a6;
+      double bL1 = a4*a5 - a2*a6;
+
+      // Compute Euler flux (second part)
+      f0 = f0 - (lambda0*du0+aL1);
+      f1 = f1 - (lambda0*du1+aL1*umx+bL1*nx[p]);
+      f2 = f2 - (lambda0*du2+aL1*umy+bL1*ny[p]);
+      f3 = f3 - (lambda0*du3+aL1*hm +bL1*unm);
+
+      fn0[p] = 0.5*f0 - 0.5*vgn*(rho_r[p]+rho_l[p]);
+      fn1[p] = 0.5*f1 - 0.5*vgn*(mx_r[p]+mx_l[p]);
+      fn2[p] = 0.5*f2 - 0.5*vgn*(my_r[p]+my_l[p]);
+      fn3[p] = 0.5*f3 - 0.5*vgn*(ene_r[p]+ene_l[p]);
+    }
+}
+
+// Lax-Friedrich inviscid numerical flux of the points of the batch buffers
+
+void inters::lax_friedrich_batch(int in_n_pts)
+{
+  // Batch buffers of this thread
+  int thr = get_thread_num();
+  array<double>& batch_u_l = this->batch_u_l(thr);
+  array<double>& batch_u_r = this->batch_u_r(thr);
+  array<double>& batch_norm = this->batch_norm(thr);
+  array<double>& batch_fn = this->batch_fn(thr);
+  array<double>& batch_eig = this->batch_eig(thr);
+
+  double lambda = run_input.lambda;
+  double* u_l = batch_u_l.get_ptr_cpu(0,0);
+  double* u_r = batch_u_r.get_ptr_cpu(0,0);
+  double* fn = batch_fn.get_ptr_cpu(0,0);
+  double* norm_speed = batch_eig.get_ptr_cpu();
+
+  for(int p=0;p<in_n_pts;p++)
+    norm_speed[p] = 0.;
+
+  for(int l=0;l<n_dims;l++)
+    {
+      double wave_speed = run_input.wave_speed(l);
+      double* n = batch_norm.get_ptr_cpu(0,l);
+
+      for(int p=0;p<in_n_pts;p++)
+        norm_speed[p] += wave_speed*n[p];
+    }
+
+  for(int p=0;p<in_n_pts;p++)
+    {
+      double u_av = 0.5*(u_l[p]+u_r[p]);
+      double u_diff = (u_l[p]-u_r[p]);
+
+      fn[p] = norm_speed[p]*u_av + 0.5*lambda*fabs(norm_speed[p])*u_diff;
+    }
+}
+
+// LDG common solution of interior and mpi interfaces of the points of the batch buffers
+
+void inters::ldg_solution_batch(int in_n_pts)
+{
+  // Batch buffers of this thread
+  int thr = get_thread_num();
+  array<double>& batch_u_l = this->batch_u_l(thr);
+  array<double>& batch_u_r = this->batch_u_r(thr);
+  array<double>& batch_norm = this->batch_norm(thr);
+  array<double>& batch_u_c = this->batch_u_c(thr);
+  array<double>& batch_eig = this->batch_eig(thr);
+
+  double pen_fact = run_input.pen_fact;
+  double* pen = batch_eig.get_ptr_cpu();
+  double* nx = batch_norm.get_ptr_cpu(0,0);
+  double* ny = batch_norm.get_ptr_cpu(0,1);
+
+  // Choosing a unique direction for the switch
+  if(n_dims==2)
+    {
+      for(int p=0;p<in_n_pts;p++)
+        pen[p] = ((nx[p]+ny[p]) <0. ? -pen_fact : pen_fact);
+    }
+  else
+    {
+      double* nz = batch_norm.get_ptr_cpu(0,2);
+
+      for(int p=0;p<in_n_pts;p++)
+        pen[p] = ((nx[p]+ny[p]+sqrt(2.)*nz[p]) <0. ? -pen_fact : pen_fact);
+    }
+
+  for(int k=0;k<n_fields;k++)
+    {
+      double* u_l = batch_u_l.get_ptr_cpu(0,k);
+      double* u_r = batch_u_r.get_ptr_cpu(0,k);
+      double* u_c = batch_u_c.get_ptr_cpu(0,k);
+
+      for(int p=0;p<in_n_pts;p++)
+        u_c[p] = 0.5*(u_l[p] + u_r[p]) - pen[p]*(u_l[p] - u_r[p]);
+    }
+}
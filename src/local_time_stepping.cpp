@@ -0,0 +1,657 @@
+/*!
+ * \file local_time_stepping.cpp
+ * \author - Original code: SD++ developed by Patrice Castonguay, Antony Jameson,
+ *                          Peter Vincent, David Williams (alphabetical by surname).
+ *         - Current development: Aerospace Computing Laboratory (ACL)
+ *                                Aero/Astro Department. Stanford University.
+ * \version 0.1.0
+ *
+ * High Fidelity Large Eddy Simulation (HiFiLES) Code.
+ * Copyright (C) 2014 Aerospace Computing Laboratory (ACL).
+ *
+ * HiFiLES is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * HiFiLES is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with HiFiLES.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <iostream>
+#include <cmath>
+
+#include "../include/global.h"
+#include "../include/array.h"
+#include "../include/input.h"
+#include "../include/error.h"
+#include "../include/solver.h"
+#include "../include/local_time_stepping.h"
+
+#ifdef _MPI
+#include "mpi.h"
+#endif
+
+using namespace std;
+
+// #### constructors ####
+
+// default constructor
+
+local_time_stepping::local_time_stepping()
+{
+  FlowSol = NULL;
+  Mesh = NULL;
+  n_levels = 0;
+  n_levels_used = 0;
+  dt_min = 0.;
+}
+
+// #### methods ####
+
+void local_time_stepping::setup(struct solution* in_FlowSol, mesh& in_Mesh)
+{
+  FlowSol = in_FlowSol;
+  Mesh = &in_Mesh;
+  n_levels = run_input.lts_levels;
+
+  if (n_levels > 30)
+    FatalError("lts_levels must be at most 30");
+
+  // RK45 of AdvanceSolution: the step is u += sum of rk_w(i)*dt*R_i, with R_i the right-hand side of stage i at
+  // time rk_c(i)*dt into the step
+  rk_a.setup(5);
+  rk_b.setup(5);
+  rk_c.setup(5);
+  rk_w.setup(5);
+
+  rk_a(0) = 0.0;
+  rk_a(1) = -0.417890474499852;
+  rk_a(2) = -1.192151694642677;
+  rk_a(3) = -1.697784692471528;
+  rk_a(4) = -1.514183444257156;
+
+  rk_b(0) = 0.149659021999229;
+  rk_b(1) = 0.379210312999627;
+  rk_b(2) = 0.822955029386982;
+  rk_b(3) = 0.699450455949122;
+  rk_b(4) = 0.153057247968152;
+
+  rk_c(0) = 0.0;
+  rk_c(1) = 1432997174477.0/9575080441755.0;
+  rk_c(2) = 2526269341429.0/6820363962896.0;
+  rk_c(3) = 2006345519317.0/3224310063776.0;
+  rk_c(4) = 2802321613138.0/2924317926251.0;
+
+  rk_w(4) = rk_b(4);
+  for (int i=3;i>=0;i--)
+    rk_w(i) = rk_b(i) + rk_a(i+1)*rk_w(i+1);
+
+  int n_cells = FlowSol->num_eles;
+  int n_ele_types = FlowSol->n_ele_types;
+
+  cell_dt.setup(max(1,n_cells));
+  cell_level.setup(max(1,n_cells));
+  cell_mask.setup(max(1,n_cells));
+
+  level_time.setup(n_levels);
+  level_theta.setup(n_levels);
+
+  // element lists of each level, at most every element once (every face for the faces between levels)
+  ele_level.setup(n_ele_types);
+  ele_runs.setup(n_ele_types);
+  sol_runs.setup(n_ele_types);
+  grad_runs.setup(n_ele_types);
+  interp_list.setup(n_ele_types);
+  reflux_runs.setup(n_ele_types);
+  couple_list.setup(n_ele_types);
+  n_ele_runs.setup(n_ele_types);
+  n_sol_runs.setup(n_ele_types);
+  n_grad_runs.setup(n_ele_types);
+  n_interp_list.setup(n_ele_types);
+  n_reflux_runs.setup(n_ele_types);
+  n_couple_list.setup(n_ele_types);
+
+  for (int i=0;i<n_ele_types;i++)
+  {
+    int n_eles = max(1,FlowSol->mesh_eles(i)->get_n_eles());
+
+    ele_level(i).setup(n_eles);
+    ele_runs(i).setup(2*n_eles,n_levels);
+    sol_runs(i).setup(2*n_eles,n_levels);
+    grad_runs(i).setup(2*n_eles,n_levels);
+    interp_list(i).setup(n_eles,n_levels);
+    reflux_runs(i).setup(2*n_eles,n_levels);
+    couple_list(i).setup(3*n_eles*FlowSol->num_f_per_c(i),n_levels);
+    n_ele_runs(i).setup(n_levels);
+    n_sol_runs(i).setup(n_levels);
+    n_grad_runs(i).setup(n_levels);
+    n_interp_list(i).setup(n_levels);
+    n_reflux_runs(i).setup(n_levels);
+    n_couple_list(i).setup(n_levels);
+  }
+
+  // interface lists of each level, sized by the number of interfaces of each kind and type
+  array<int> n_inters(3,3);
+  n_inters.initialize_to_zero();
+
+  for (int f=0;f<FlowSol->num_inters;f++)
+    if (Mesh->f2inter(f,0) >= 0)
+      n_inters(Mesh->f2inter(f,0),Mesh->f2inter(f,1)) = max(n_inters(Mesh->f2inter(f,0),Mesh->f2inter(f,1)),Mesh->f2inter(f,2)+1);
+
+  int_inv_list.setup(FlowSol->n_int_inter_types);
+  int_visc_list.setup(FlowSol->n_int_inter_types);
+  n_int_inv_list.setup(FlowSol->n_int_inter_types);
+  n_int_visc_list.setup(FlowSol->n_int_inter_types);
+  for (int i=0;i<FlowSol->n_int_inter_types;i++)
+  {
+    int_inv_list(i).setup(max(1,n_inters(0,i)),n_levels);
+    int_visc_list(i).setup(max(1,n_inters(0,i)),n_levels);
+    n_int_inv_list(i).setup(n_levels);
+    n_int_visc_list(i).setup(n_levels);
+  }
+
+  bdy_inv_list.setup(FlowSol->n_bdy_inter_types);
+  bdy_visc_list.setup(FlowSol->n_bdy_inter_types);
+  n_bdy_inv_list.setup(FlowSol->n_bdy_inter_types);
+  n_bdy_visc_list.setup(FlowSol->n_bdy_inter_types);
+  for (int i=0;i<FlowSol->n_bdy_inter_types;i++)
+  {
+    bdy_inv_list(i).setup(max(1,n_inters(1,i)),n_levels);
+    bdy_visc_list(i).setup(max(1,n_inters(1,i)),n_levels);
+    n_bdy_inv_list(i).setup(n_levels);
+    n_bdy_visc_list(i).setup(n_levels);
+  }
+
+  // cells of the MPI interfaces, whose values are sent across
+  mpi_cell.setup(3);
+  mpi_send.setup(3);
+  mpi_level.setup(3);
+  mpi_mask.setup(3);
+  for (int i=0;i<3;i++)
+  {
+    mpi_cell(i).setup(max(1,n_inters(2,i)));
+    mpi_send(i).setup(max(1,n_inters(2,i)));
+    mpi_level(i).setup(max(1,n_inters(2,i)));
+    mpi_mask(i).setup(max(1,n_inters(2,i)));
+  }
+
+  for (int f=0;f<FlowSol->num_inters;f++)
+    if (Mesh->f2inter(f,0) == 2)
+      mpi_cell(Mesh->f2inter(f,1))(Mesh->f2inter(f,2)) = Mesh->f2c(f,0);
+
+  if (FlowSol->rank == 0)
+    cout << "local time stepping: up to " << n_levels << " levels, timesteps 1 to " << (1<<(n_levels-1))
+         << " times the global minimum" << endl;
+}
+
+// one step of the coarsest level in use, the levels are set from the current solution
+
+void local_time_stepping::advance(int in_file_num)
+{
+  double time_start = FlowSol->time;
+
+  set_levels(in_file_num);
+
+  step_level(n_levels_used-1,time_start);
+
+  FlowSol->time = time_start;
+  run_input.dt = dt_min*(1<<(n_levels_used-1));
+}
+
+void local_time_stepping::set_levels(int in_file_num)
+{
+  int i, j, l, ic;
+  int n_cells = FlowSol->num_eles;
+  int n_ele_types = FlowSol->n_ele_types;
+
+  // timestep of each cell, and the global minimum
+  dt_min = 1e12;
+  for (ic=0;ic<n_cells;ic++)
+  {
+    cell_dt(ic) = FlowSol->mesh_eles(Mesh->ctype(ic))->calc_dt_local(Mesh->ic2loc_c(ic));
+    dt_min = min(dt_min,cell_dt(ic));
+  }
+
+#ifdef _MPI
+  double dt_min_global;
+  MPI_Allreduce(&dt_min,&dt_min_global,1,MPI_DOUBLE,MPI_MIN,MPI_COMM_WORLD);
+  dt_min = dt_min_global;
+#endif
+
+  // largest level whose timestep the cell allows
+  for (ic=0;ic<n_cells;ic++)
+  {
+    cell_level(ic) = 0;
+    while (cell_level(ic)+1 < n_levels && dt_min*(2<<cell_level(ic)) <= cell_dt(ic))
+      cell_level(ic)++;
+  }
+
+  // lower the levels until neighbours are at most one level apart, across the partitions as well
+  int changed = 1;
+  while (changed)
+  {
+    changed = 0;
+    exchange_cell_values(cell_level,mpi_level);
+
+    for (ic=0;ic<n_cells;ic++)
+      for (j=0;j<FlowSol->num_f_per_c(Mesh->ctype(ic));j++)
+      {
+        int level_n = get_neighbour_value(ic,j,cell_level,mpi_level);
+        if (level_n >= 0 && cell_level(ic) > level_n+1)
+        {
+          cell_level(ic) = level_n+1;
+          changed = 1;
+        }
+      }
+
+#ifdef _MPI
+    int changed_global;
+    MPI_Allreduce(&changed,&changed_global,1,MPI_INT,MPI_MAX,MPI_COMM_WORLD);
+    changed = changed_global;
+#endif
+  }
+
+  // levels reached by the interface fluxes of each cell: its own and those of its neighbours
+  n_levels_used = 1;
+  double n_updates = 0.;
+  for (ic=0;ic<n_cells;ic++)
+  {
+    n_levels_used = max(n_levels_used,cell_level(ic)+1);
+    n_updates += 1./(1<<cell_level(ic));
+
+    cell_mask(ic) = 1<<cell_level(ic);
+    for (j=0;j<FlowSol->num_f_per_c(Mesh->ctype(ic));j++)
+    {
+      int level_n = get_neighbour_value(ic,j,cell_level,mpi_level);
+      if (level_n >= 0)
+        cell_mask(ic) |= 1<<level_n;
+    }
+  }
+
+  double n_cells_all = n_cells;
+#ifdef _MPI
+  int n_levels_global;
+  MPI_Allreduce(&n_levels_used,&n_levels_global,1,MPI_INT,MPI_MAX,MPI_COMM_WORLD);
+  n_levels_used = n_levels_global;
+
+  double sums[2] = {n_updates,n_cells_all}, sums_global[2];
+  MPI_Allreduce(sums,sums_global,2,MPI_DOUBLE,MPI_SUM,MPI_COMM_WORLD);
+  n_updates = sums_global[0];
+  n_cells_all = sums_global[1];
+#endif
+
+  if (FlowSol->viscous)
+    exchange_cell_values(cell_mask,mpi_mask);
+
+  // element lists of each level
+  for (l=0;l<n_levels_used;l++)
+  {
+    int bit = 1<<l;
+
+    for (i=0;i<n_ele_types;i++)
+    {
+      n_ele_runs(i)(l) = 0;
+      n_sol_runs(i)(l) = 0;
+      n_grad_runs(i)(l) = 0;
+      n_interp_list(i)(l) = 0;
+      n_reflux_runs(i)(l) = 0;
+      n_couple_list(i)(l) = 0;
+    }
+
+    for (ic=0;ic<n_cells;ic++)
+    {
+      i = Mesh->ctype(ic);
+      int ele = Mesh->ic2loc_c(ic);
+      int level = cell_level(ic);
+      int n_faces = FlowSol->num_f_per_c(i);
+
+      // the solution is needed at the flux points of the cells reached by the interface fluxes, and when viscous of
+      // those whose corrected gradient these fluxes use, which reach one cell further
+      bool in_grad = (cell_mask(ic) & bit);
+      bool in_sol = in_grad;
+      if (FlowSol->viscous && !in_sol)
+        for (j=0;j<n_faces;j++)
+        {
+          int mask_n = get_neighbour_value(ic,j,cell_mask,mpi_mask);
+          if (mask_n >= 0 && (mask_n & bit))
+            in_sol = true;
+        }
+
+      if (level == l)
+        add_to_runs(ele,ele_runs(i).get_ptr_cpu(0,l),n_ele_runs(i)(l));
+
+      if (in_sol)
+      {
+        add_to_runs(ele,sol_runs(i).get_ptr_cpu(0,l),n_sol_runs(i)(l));
+
+        if (level > l)
+          interp_list(i)(n_interp_list(i)(l)++,l) = ele;
+      }
+
+      if (FlowSol->viscous && in_grad)
+        add_to_runs(ele,grad_runs(i).get_ptr_cpu(0,l),n_grad_runs(i)(l));
+
+      // faces between levels: the coarser side takes away the flux of its own stages and adds that of the stages of
+      // the finer side
+      bool reflux = false;
+      for (j=0;j<n_faces;j++)
+      {
+        int level_n = get_neighbour_value(ic,j,cell_level,mpi_level);
+        int sign = 0;
+
+        if (level == l && level_n >= 0 && level_n < l)
+          sign = -1;
+        else if (level > l && level_n == l)
+          sign = 1;
+
+        if (sign != 0)
+        {
+          int k = n_couple_list(i)(l)++;
+          couple_list(i)(3*k,l) = ele;
+          couple_list(i)(3*k+1,l) = j;
+          couple_list(i)(3*k+2,l) = sign;
+        }
+
+        if (sign == -1)
+          reflux = true;
+      }
+
+      if (reflux)
+        add_to_runs(ele,reflux_runs(i).get_ptr_cpu(0,l),n_reflux_runs(i)(l));
+    }
+
+    // interfaces of the inviscid pass, and of the viscous pass
+    for (i=0;i<FlowSol->n_int_inter_types;i++)
+    {
+      n_int_inv_list(i)(l) = 0;
+      n_int_visc_list(i)(l) = 0;
+    }
+    for (i=0;i<FlowSol->n_bdy_inter_types;i++)
+    {
+      n_bdy_inv_list(i)(l) = 0;
+      n_bdy_visc_list(i)(l) = 0;
+    }
+
+    for (int f=0;f<FlowSol->num_inters;f++)
+    {
+      int kind = Mesh->f2inter(f,0);
+      if (kind != 0 && kind != 1)
+        continue;
+
+      int type = Mesh->f2inter(f,1);
+      int inter = Mesh->f2inter(f,2);
+      int ic_l = Mesh->f2c(f,0);
+      int ic_r = (kind == 0 ? Mesh->f2c(f,1) : ic_l);
+
+      bool in_visc = (cell_level(ic_l) == l || cell_level(ic_r) == l);
+      bool in_inv = in_visc;
+      if (FlowSol->viscous)
+        in_inv = ((cell_mask(ic_l) & bit) || (cell_mask(ic_r) & bit));
+
+      if (kind == 0)
+      {
+        if (in_inv)
+          int_inv_list(type)(n_int_inv_list(type)(l)++,l) = inter;
+        if (in_visc)
+          int_visc_list(type)(n_int_visc_list(type)(l)++,l) = inter;
+      }
+      else
+      {
+        if (in_inv)
+          bdy_inv_list(type)(n_bdy_inv_list(type)(l)++,l) = inter;
+        if (in_visc)
+          bdy_visc_list(type)(n_bdy_visc_list(type)(l)++,l) = inter;
+      }
+    }
+
+    // boundary interfaces grouped by boundary type, as evaluated
+    for (i=0;i<FlowSol->n_bdy_inter_types;i++)
+    {
+      FlowSol->mesh_bdy_inters(i).sort_by_bdy_type(n_bdy_inv_list(i)(l),bdy_inv_list(i).get_ptr_cpu(0,l));
+      FlowSol->mesh_bdy_inters(i).sort_by_bdy_type(n_bdy_visc_list(i)(l),bdy_visc_list(i).get_ptr_cpu(0,l));
+    }
+  }
+
+  for (ic=0;ic<n_cells;ic++)
+    ele_level(Mesh->ctype(ic))(Mesh->ic2loc_c(ic)) = cell_level(ic);
+
+  for (i=0;i<n_ele_types;i++)
+    FlowSol->mesh_eles(i)->set_lts_levels(ele_level(i).get_ptr_cpu(),dt_min);
+
+  if (FlowSol->rank == 0 && (in_file_num+1)%run_input.monitor_res_freq == 0)
+    cout << "local time stepping: " << n_levels_used << " levels, timestep " << dt_min << " to "
+         << dt_min*(1<<(n_levels_used-1)) << ", element updates " << n_updates/n_cells_all
+         << " of global time stepping" << endl;
+}
+
+void local_time_stepping::exchange_cell_values(array<int>& in_cell_values, array< array<int> >& out_values)
+{
+#ifdef _MPI
+  if (FlowSol->nproc>1)
+    for (int i=0;i<FlowSol->n_mpi_inter_types;i++)
+    {
+      for (int k=0;k<mpi_cell(i).get_dim(0);k++)
+        mpi_send(i)(k) = in_cell_values(mpi_cell(i)(k));
+
+      FlowSol->mesh_mpi_inters(i).exchange_inter_values(mpi_send(i),out_values(i));
+    }
+#endif
+}
+
+int local_time_stepping::get_neighbour_value(int in_cell, int in_face, array<int>& in_cell_values, array< array<int> >& in_mpi_values)
+{
+  int ic_n = Mesh->c2c(in_cell,in_face);
+  if (ic_n >= 0)
+    return in_cell_values(ic_n);
+
+  int f = Mesh->c2f(in_cell,in_face);
+  if (f >= 0 && Mesh->f2inter(f,0) == 2)
+    return in_mpi_values(Mesh->f2inter(f,1))(Mesh->f2inter(f,2));
+
+  return -1;
+}
+
+void local_time_stepping::add_to_runs(int in_ele, int* in_runs, int& n_runs)
+{
+  if (n_runs > 0 && in_runs[2*n_runs-1] == in_ele)
+  {
+    in_runs[2*n_runs-1]++;
+  }
+  else
+  {
+    in_runs[2*n_runs] = in_ele;
+    in_runs[2*n_runs+1] = in_ele+1;
+    n_runs++;
+  }
+}
+
+// one RK45 step of level in_level, then the finer levels twice over the same time. The coarser levels are part way
+// through theirs, and finer neighbours are left at in_time
+
+void local_time_stepping::step_level(int in_level, double in_time)
+{
+  int i, r, k;
+  int n_ele_types = FlowSol->n_ele_types;
+  double dt = dt_min*(1<<in_level);
+
+  level_time(in_level) = in_time;
+  FlowSol->time = in_time;
+
+  for (i=0;i<n_ele_types;i++)
+  {
+    int* runs = ele_runs(i).get_ptr_cpu(0,in_level);
+    for (r=0;r<n_ele_runs(i)(in_level);r++)
+      FlowSol->mesh_eles(i)->save_lts_solution(0,runs[2*r],runs[2*r+1]);
+  }
+
+  for (k=0;k<5;k++)
+  {
+    // the coarser neighbours at the time of the stage
+    for (int m=in_level+1;m<n_levels_used;m++)
+      level_theta(m) = (in_time + rk_c(k)*dt - level_time(m))/(dt_min*(1<<m));
+
+    for (i=0;i<n_ele_types;i++)
+      FlowSol->mesh_eles(i)->interpolate_lts_solution(n_interp_list(i)(in_level),interp_list(i).get_ptr_cpu(0,in_level),level_theta.get_ptr_cpu());
+
+    calc_residual(in_level,rk_w(k)*dt);
+
+    for (i=0;i<n_ele_types;i++)
+    {
+      int* runs = ele_runs(i).get_ptr_cpu(0,in_level);
+      for (r=0;r<n_ele_runs(i)(in_level);r++)
+        FlowSol->mesh_eles(i)->AdvanceSolution(k,3,runs[2*r],runs[2*r+1]);
+    }
+  }
+
+  if (in_level == 0)
+    return;
+
+  for (i=0;i<n_ele_types;i++)
+  {
+    int* runs = ele_runs(i).get_ptr_cpu(0,in_level);
+    for (r=0;r<n_ele_runs(i)(in_level);r++)
+      FlowSol->mesh_eles(i)->save_lts_solution(1,runs[2*r],runs[2*r+1]);
+  }
+
+  step_level(in_level-1,in_time);
+  step_level(in_level-1,in_time+0.5*dt);
+
+  // back to the end of the step, with the flux of the finer neighbours on the faces shared with them
+  for (i=0;i<n_ele_types;i++)
+  {
+    int* runs = ele_runs(i).get_ptr_cpu(0,in_level);
+    for (r=0;r<n_ele_runs(i)(in_level);r++)
+      FlowSol->mesh_eles(i)->restore_lts_solution(runs[2*r],runs[2*r+1]);
+
+    runs = reflux_runs(i).get_ptr_cpu(0,in_level);
+    for (r=0;r<n_reflux_runs(i)(in_level);r++)
+      FlowSol->mesh_eles(i)->apply_lts_flux(runs[2*r],runs[2*r+1]);
+  }
+}
+
+// CalcResidual on the elements of a level, for the flow models local time stepping is available with
+
+void local_time_stepping::calc_residual(int in_level, double in_flux_weight)
+{
+  int i, r;
+  int* runs;
+  int n_ele_types = FlowSol->n_ele_types;
+
+  /*! Compute the solution at the flux points. */
+  for(i=0; i<n_ele_types; i++) {
+      runs = sol_runs(i).get_ptr_cpu(0,in_level);
+      for(r=0; r<n_sol_runs(i)(in_level); r++)
+        FlowSol->mesh_eles(i)->extrapolate_solution(0,runs[2*r],runs[2*r+1]);
+    }
+
+#ifdef _MPI
+  /*! Send the solution at the flux points across the MPI interfaces. */
+  if (FlowSol->nproc>1)
+    for(i=0; i<FlowSol->n_mpi_inter_types; i++)
+      FlowSol->mesh_mpi_inters(i).send_solution();
+#endif
+
+  if (FlowSol->viscous) {
+      /*! Compute the uncorrected gradient of the solution at the solution points. */
+      for(i=0; i<n_ele_types; i++) {
+          runs = grad_runs(i).get_ptr_cpu(0,in_level);
+          for(r=0; r<n_grad_runs(i)(in_level); r++)
+            FlowSol->mesh_eles(i)->calculate_gradient(0,runs[2*r],runs[2*r+1]);
+        }
+    }
+
+  /*! Compute the inviscid flux at the solution points and store in total flux storage. */
+  for(i=0; i<n_ele_types; i++) {
+      runs = ele_runs(i).get_ptr_cpu(0,in_level);
+      for(r=0; r<n_ele_runs(i)(in_level); r++)
+        FlowSol->mesh_eles(i)->evaluate_invFlux(0,runs[2*r],runs[2*r+1]);
+    }
+
+  /*! Compute the inviscid numerical fluxes.
+   Compute the common solution and solution corrections (viscous only). */
+  for(i=0; i<FlowSol->n_int_inter_types; i++)
+    FlowSol->mesh_int_inters(i).calculate_common_invFlux(n_int_inv_list(i)(in_level),int_inv_list(i).get_ptr_cpu(0,in_level));
+
+  for(i=0; i<FlowSol->n_bdy_inter_types; i++)
+    FlowSol->mesh_bdy_inters(i).evaluate_boundaryConditions_invFlux(FlowSol->time,n_bdy_inv_list(i)(in_level),bdy_inv_list(i).get_ptr_cpu(0,in_level));
+
+#ifdef _MPI
+  /*! Send the previously computed values across the MPI interfaces. */
+  if (FlowSol->nproc>1) {
+      for(i=0; i<FlowSol->n_mpi_inter_types; i++)
+        FlowSol->mesh_mpi_inters(i).receive_solution();
+
+      for(i=0; i<FlowSol->n_mpi_inter_types; i++)
+        FlowSol->mesh_mpi_inters(i).calculate_common_invFlux();
+    }
+#endif
+
+  if (FlowSol->viscous) {
+      /*! Compute corrected gradient of the solution at the solution and flux points. */
+      for(i=0; i<n_ele_types; i++) {
+          runs = grad_runs(i).get_ptr_cpu(0,in_level);
+          for(r=0; r<n_grad_runs(i)(in_level); r++) {
+              FlowSol->mesh_eles(i)->correct_gradient(runs[2*r],runs[2*r+1]);
+              FlowSol->mesh_eles(i)->extrapolate_corrected_gradient(runs[2*r],runs[2*r+1]);
+            }
+        }
+
+#ifdef _MPI
+      /*! Send the corrected value across the MPI interface. */
+      if (FlowSol->nproc>1)
+        for(i=0; i<FlowSol->n_mpi_inter_types; i++)
+          FlowSol->mesh_mpi_inters(i).send_corrected_gradient();
+#endif
+
+      /*! Compute discontinuous viscous flux at upts and add to inviscid flux at upts. */
+      for(i=0; i<n_ele_types; i++) {
+          runs = ele_runs(i).get_ptr_cpu(0,in_level);
+          for(r=0; r<n_ele_runs(i)(in_level); r++)
+            FlowSol->mesh_eles(i)->evaluate_viscFlux(0,runs[2*r],runs[2*r+1]);
+        }
+    }
+
+  /*! Compute the normal discontinuous flux at flux points and the divergence of flux at solution points. */
+  for(i=0; i<n_ele_types; i++) {
+      runs = ele_runs(i).get_ptr_cpu(0,in_level);
+      for(r=0; r<n_ele_runs(i)(in_level); r++)
+        FlowSol->mesh_eles(i)->calculate_totalFlux_divergence(0,runs[2*r],runs[2*r+1]);
+    }
+
+  if (FlowSol->viscous) {
+      /*! Compute normal interface viscous flux and add to normal inviscid flux. */
+      for(i=0; i<FlowSol->n_int_inter_types; i++)
+        FlowSol->mesh_int_inters(i).calculate_common_viscFlux(n_int_visc_list(i)(in_level),int_visc_list(i).get_ptr_cpu(0,in_level));
+
+      for(i=0; i<FlowSol->n_bdy_inter_types; i++)
+        FlowSol->mesh_bdy_inters(i).evaluate_boundaryConditions_viscFlux(FlowSol->time,n_bdy_visc_list(i)(in_level),bdy_visc_list(i).get_ptr_cpu(0,in_level));
+
+#ifdef _MPI
+      /*! Evaluate the MPI interfaces. */
+      if (FlowSol->nproc>1) {
+          for(i=0; i<FlowSol->n_mpi_inter_types; i++)
+            FlowSol->mesh_mpi_inters(i).receive_corrected_gradient();
+
+          for(i=0; i<FlowSol->n_mpi_inter_types; i++)
+            FlowSol->mesh_mpi_inters(i).calculate_common_viscFlux();
+        }
+#endif
+    }
+
+  /*! The flux on the faces between levels, before the divergence takes the discontinuous flux out of it. */
+  for(i=0; i<n_ele_types; i++)
+    FlowSol->mesh_eles(i)->accumulate_lts_flux(n_couple_list(i)(in_level),couple_list(i).get_ptr_cpu(0,in_level),in_flux_weight);
+
+  /*! Compute the divergence of the transformed continuous flux. */
+  for(i=0; i<n_ele_types; i++) {
+      runs = ele_runs(i).get_ptr_cpu(0,in_level);
+      for(r=0; r<n_ele_runs(i)(in_level); r++)
+        FlowSol->mesh_eles(i)->calculate_corrected_divergence(0,runs[2*r],runs[2*r+1]);
+    }
+}
@@ -368,7 +368,8 @@ void mesh::set_grid_velocity(solution* FlowSol, double dt)
 
   // Apply velocity to the eles classes at the shape points
   int local_ic;
-  array<double> vel(n_dims);
+  double vel_data[3];
+  array<double> vel(vel_data,n_dims);
   for (int ic=0; ic<n_eles; ic++) {
     for (int j=0; j<c2n_v(ic); j++) {
       for (int idim=0; idim<n_dims; idim++) {
@@ -1297,7 +1298,8 @@ void mesh::update(solution* FlowSol)
   //if (FlowSol->rank==0) cout << "Deform: updating element shape points" << endl;
 
   int ele_type, local_id;
-  array<double> pos(n_dims);
+  double pos_data[3];
+  array<double> pos(pos_data,n_dims);
 
   for (int ic=0; ic<n_eles; ic++) {
     ele_type = ctype(ic);
@@ -56,6 +56,22 @@ mpi_inters::~mpi_inters() { }
 
 // #### methods ####
 
+// round a halo buffer to single precision before it is sent, for the mixed precision mode
+
+static void buffer_to_single(array<double>& in_buffer, array<float>& out_buffer)
+{
+  for (int i=0;i<in_buffer.get_dim(0);i++)
+    out_buffer(i) = (float)in_buffer(i);
+}
+
+// copy a received single precision halo buffer back to double
+
+static void buffer_to_double(array<float>& in_buffer, array<double>& out_buffer)
+{
+  for (int i=0;i<out_buffer.get_dim(0);i++)
+    out_buffer(i) = in_buffer(i);
+}
+
 // setup mpi_inters
 
 void mpi_inters::setup(int in_n_inters, int in_inters_type)
@@ -76,6 +92,22 @@ void mpi_inters::setup(int in_n_inters, int in_inters_type)
           in_buffer_sgsf.setup(in_n_inters*n_fpts_per_inter*n_fields*n_dims);
         }
 
+      // Single precision copies that go over the wire in mixed precision
+      if (run_input.precision==1) {
+          out_buffer_disu_sp.setup(in_n_inters*n_fpts_per_inter*n_fields);
+          in_buffer_disu_sp.setup(in_n_inters*n_fpts_per_inter*n_fields);
+
+          if (viscous) {
+              out_buffer_grad_disu_sp.setup(in_n_inters*n_fpts_per_inter*n_fields*n_dims);
+              in_buffer_grad_disu_sp.setup(in_n_inters*n_fpts_per_inter*n_fields*n_dims);
+            }
+
+          if (LES) {
+              out_buffer_sgsf_sp.setup(in_n_inters*n_fpts_per_inter*n_fields*n_dims);
+              in_buffer_sgsf_sp.setup(in_n_inters*n_fpts_per_inter*n_fields*n_dims);
+            }
+        }
+
 #ifdef _GPU
       // Here, data is copied but is meaningless. Just need to allocate on GPU
       out_buffer_disu.cp_cpu_gpu();
@@ -92,10 +124,30 @@ void mpi_inters::setup(int in_n_inters, int in_inters_type)
         }
 #endif
 
-      disu_fpts_r.setup(n_fpts_per_inter,n_inters,n_fields);
+      // The right side is the receive buffers, element type 5 of the connectivity with one element per interface
+      disu_fpts_r.setup(&conn_r,n_conn_types,n_fields);
       if(viscous)
         {
-          grad_disu_fpts_r.setup(n_fpts_per_inter,n_inters,n_fields,n_dims);
+          grad_disu_fpts_r.setup(&conn_r,n_conn_types,n_fields,n_dims);
+        }
+
+      conn_r.set_first_fpt(5,0,0);
+
+      if(n_inters!=0)
+        {
+#ifdef _GPU
+          disu_fpts_r.set_type(5,in_buffer_disu.get_ptr_gpu(),n_fpts_per_inter*n_fields,n_fpts_per_inter,0);
+          if(viscous)
+            grad_disu_fpts_r.set_type(5,in_buffer_grad_disu.get_ptr_gpu(),n_fpts_per_inter*n_fields*n_dims,n_fpts_per_inter,n_fpts_per_inter*n_fields);
+          if(LES)
+            sgsf_fpts_r.set_type(5,in_buffer_sgsf.get_ptr_gpu(),n_fpts_per_inter*n_fields*n_dims,n_fpts_per_inter,n_fpts_per_inter*n_fields);
+#else
+          disu_fpts_r.set_type(5,in_buffer_disu.get_ptr_cpu(),n_fpts_per_inter*n_fields,n_fpts_per_inter,0);
+          if(viscous)
+            grad_disu_fpts_r.set_type(5,in_buffer_grad_disu.get_ptr_cpu(),n_fpts_per_inter*n_fields*n_dims,n_fpts_per_inter,n_fpts_per_inter*n_fields);
+          if(LES)
+            sgsf_fpts_r.set_type(5,in_buffer_sgsf.get_ptr_cpu(),n_fpts_per_inter*n_fields*n_dims,n_fpts_per_inter,n_fpts_per_inter*n_fields);
+#endif
         }
 }
 
@@ -179,96 +231,30 @@ void mpi_inters::mv_all_cpu_gpu(void)
 
 void mpi_inters::set_mpi(int in_inter, int in_ele_type_l, int in_ele_l, int in_local_inter_l, int rot_tag, struct solution* FlowSol)
 {
-  int i,j,k;
-  int i_rhs,j_rhs;
-
-      get_lut(rot_tag);
-
-      for(j=0;j<n_fpts_per_inter;j++)
-        {
-          for(i=0;i<n_fields;i++)
-            {
-              j_rhs=lut(j);
-
-              disu_fpts_l(j,in_inter,i)=get_disu_fpts_ptr(in_ele_type_l,in_ele_l,i,in_local_inter_l,j,FlowSol);
-
-#ifdef _GPU
-              disu_fpts_r(j,in_inter,i)=in_buffer_disu.get_ptr_gpu(in_inter*n_fpts_per_inter*n_fields+i*n_fpts_per_inter+j_rhs);
-#else
-              disu_fpts_r(j,in_inter,i)=in_buffer_disu.get_ptr_cpu(in_inter*n_fpts_per_inter*n_fields+i*n_fpts_per_inter+j_rhs);
-#endif
-
-              norm_tconf_fpts_l(j,in_inter,i)=get_norm_tconf_fpts_ptr(in_ele_type_l,in_ele_l,i,in_local_inter_l,j,FlowSol);
-
-              for(k=0; k<n_dims; k++)
-                {
-                  if(viscous)
-                    {
-                      delta_disu_fpts_l(j,in_inter,i)=get_delta_disu_fpts_ptr(in_ele_type_l,in_ele_l,i,in_local_inter_l,j,FlowSol);
-
-                      grad_disu_fpts_l(j,in_inter,i,k) = get_grad_disu_fpts_ptr(in_ele_type_l,in_ele_l,in_local_inter_l,i,k,j,FlowSol);
-#ifdef _GPU
-                      grad_disu_fpts_r(j,in_inter,i,k) = in_buffer_grad_disu.get_ptr_gpu(in_inter*n_fpts_per_inter*n_fields*n_dims+k*n_fpts_per_inter*n_fields+i*n_fpts_per_inter+j_rhs);
-#else
-                      grad_disu_fpts_r(j,in_inter,i,k) = in_buffer_grad_disu.get_ptr_cpu(in_inter*n_fpts_per_inter*n_fields*n_dims+k*n_fpts_per_inter*n_fields+i*n_fpts_per_inter+j_rhs);
-#endif
-                    }
-
-                  // Subgrid-scale flux
-                  if(LES)
-                    {
-                      sgsf_fpts_l(j,in_inter,i,k) = get_sgsf_fpts_ptr(in_ele_type_l,in_ele_l,in_local_inter_l,i,k,j,FlowSol);
-#ifdef _GPU
-                      sgsf_fpts_r(j,in_inter,i,k) = in_buffer_sgsf.get_ptr_gpu(in_inter*n_fpts_per_inter*n_fields*n_dims+k*n_fpts_per_inter*n_fields+i*n_fpts_per_inter+j_rhs);
-#else
-                      sgsf_fpts_r(j,in_inter,i,k) = in_buffer_sgsf.get_ptr_cpu(in_inter*n_fpts_per_inter*n_fields*n_dims+k*n_fpts_per_inter*n_fields+i*n_fpts_per_inter+j_rhs);
-#endif
-                    }
-                }
-            }
-        }
+  // the right side runs through the flux points of the interface in the receive buffer in the order of the look up
+  // table of rot_tag (inters::get_lut), permutation 1+rot_tag of the connectivity
+  int perm_r;
 
-      if (motion)
-      {
-        for(j=0;j<n_fpts_per_inter;j++)
-        {
-          j_rhs=lut(j);
-
-          if (run_input.GCL) {
-//            disu_GCL_fpts_l(j,in_inter)=get_disu_GCL_fpts_ptr(in_ele_type_l,in_ele_l,in_local_inter_l,j,FlowSol);
-//            disu_GCL_fpts_r(j,in_inter)=get_disu_GCL_fpts_ptr(in_ele_type_r,in_ele_r,in_local_inter_r,j_rhs,FlowSol);
+  if(inters_type==0)
+    perm_r=1;
+  else
+    perm_r=1+rot_tag;
 
-//            norm_tconf_GCL_fpts_l(j,in_inter)=get_norm_tconf_GCL_fpts_ptr(in_ele_type_l,in_ele_l,in_local_inter_l,j,FlowSol);
-//            norm_tconf_GCL_fpts_r(j,in_inter)=get_norm_tconf_GCL_fpts_ptr(in_ele_type_r,in_ele_r,in_local_inter_r,j_rhs,FlowSol);
-          }
-
-          ndA_dyn_fpts_l(j,in_inter)=get_ndA_dyn_fpts_ptr(in_ele_type_l,in_ele_l,in_local_inter_l,j,FlowSol);
-          //ndA_dyn_fpts_r(j,in_inter)=get_ndA_dyn_fpts_ptr(in_ele_type_r,in_ele_r,in_local_inter_r,j_rhs,FlowSol);
+  conn_l.set_inter(in_inter,in_ele_type_l,in_ele_l,in_local_inter_l,0);
+  conn_r.set_inter(in_inter,5,in_inter,0,perm_r);
 
-          // pretty sure these should be the same due to the continuous nature of the dynamic->static mapping.
-          // But, leave it this way for now just in case.
-          J_dyn_fpts_l(j,in_inter)=get_detjac_dyn_fpts_ptr(in_ele_type_l,in_ele_l,in_local_inter_l,j,FlowSol);
-          //J_dyn_fpts_r(j,in_inter)=get_detjac_dyn_fpts_ptr(in_ele_type_r,in_ele_r,in_local_inter_r,j_rhs,FlowSol);
+  set_fpts_l(in_ele_type_l,in_local_inter_l,FlowSol);
+}
 
-          for (k=0; k<n_dims; k++) {
-            norm_dyn_fpts(j,in_inter,k)=get_norm_dyn_fpts_ptr(in_ele_type_l,in_ele_l,in_local_inter_l,j,k,FlowSol);
-            grid_vel_fpts(j,in_inter,k)=get_grid_vel_fpts_ptr(in_ele_type_l,in_ele_l,in_local_inter_l,j,k,FlowSol);
-            pos_dyn_fpts(j,in_inter,k)=get_pos_dyn_fpts_ptr_cpu(in_ele_type_l,in_ele_l,in_local_inter_l,j,k,FlowSol);
-          }
-        }
-      }
+// bytes of the connectivity and flux point maps of both sides, and of the arrays of pointers they replace
 
-      for(i=0;i<n_fpts_per_inter;i++)
-        {
-          i_rhs=lut(i);
+void mpi_inters::get_fpts_n_bytes(long& out_n_bytes, long& out_n_bytes_ptrs)
+{
+  inters::get_fpts_n_bytes(out_n_bytes,out_n_bytes_ptrs);
 
-          tdA_fpts_l(i,in_inter)=get_tdA_fpts_ptr(in_ele_type_l,in_ele_l,in_local_inter_l,i,FlowSol);
+  out_n_bytes += conn_r.get_n_bytes();
 
-          for(j=0;j<n_dims;j++)
-            {
-              norm_fpts(i,in_inter,j)=get_norm_fpts_ptr(in_ele_type_l,in_ele_l,in_local_inter_l,i,j,FlowSol);
-            }
-        }
+  out_n_bytes_ptrs += disu_fpts_r.get_n_bytes_ptrs() + grad_disu_fpts_r.get_n_bytes_ptrs() + sgsf_fpts_r.get_n_bytes_ptrs();
 }
 
 
@@ -284,6 +270,9 @@ void mpi_inters::send_solution()
         for(int k=0;k<n_fields;k++)
           for(int j=0;j<n_fpts_per_inter;j++)
             out_buffer_disu(counter++) = (*disu_fpts_l(j,i,k));
+
+      if (run_input.precision==1)
+        buffer_to_single(out_buffer_disu,out_buffer_disu_sp);
 #endif
 #ifdef _GPU
       pack_out_buffer_disu_gpu_kernel_wrapper(n_fpts_per_inter,n_inters,n_fields,disu_fpts_l.get_ptr_gpu(),out_buffer_disu.get_ptr_gpu());
@@ -303,8 +292,14 @@ void mpi_inters::send_solution()
           //cout << "rank=" << rank << "p=" << p << "inters_type=" << inters_type << "Nout = " << Nout << endl;
           if (Nout) {
 #ifdef _MPI
-              MPI_Isend(out_buffer_disu.get_ptr_cpu(sk),Nout,MPI_DOUBLE,p,inters_type*10000+p   ,MPI_COMM_WORLD,&mpi_out_requests[request_count]);
-              MPI_Irecv(in_buffer_disu.get_ptr_cpu(sk),Nout,MPI_DOUBLE,p,inters_type*10000+rank,MPI_COMM_WORLD,&mpi_in_requests[request_count]);
+              if (run_input.precision==1) {
+                  MPI_Isend(out_buffer_disu_sp.get_ptr_cpu(sk),Nout,MPI_FLOAT,p,inters_type*10000+p   ,MPI_COMM_WORLD,&mpi_out_requests[request_count]);
+                  MPI_Irecv(in_buffer_disu_sp.get_ptr_cpu(sk),Nout,MPI_FLOAT,p,inters_type*10000+rank,MPI_COMM_WORLD,&mpi_in_requests[request_count]);
+                }
+              else {
+                  MPI_Isend(out_buffer_disu.get_ptr_cpu(sk),Nout,MPI_DOUBLE,p,inters_type*10000+p   ,MPI_COMM_WORLD,&mpi_out_requests[request_count]);
+                  MPI_Irecv(in_buffer_disu.get_ptr_cpu(sk),Nout,MPI_DOUBLE,p,inters_type*10000+rank,MPI_COMM_WORLD,&mpi_in_requests[request_count]);
+                }
 #endif
               sk+=Nout;
               Nmess++;
@@ -323,6 +318,9 @@ void mpi_inters::receive_solution()
 #ifdef _MPI
       MPI_Waitall(Nmess,mpi_in_requests,MPI_STATUSES_IGNORE);
       MPI_Waitall(Nmess,mpi_out_requests,MPI_STATUSES_IGNORE);
+
+      if (run_input.precision==1)
+        buffer_to_double(in_buffer_disu_sp,in_buffer_disu);
 #endif
 #ifdef _GPU
       in_buffer_disu.cp_cpu_gpu();
@@ -332,6 +330,30 @@ void mpi_inters::receive_solution()
 
 }
 
+// send in_values, one per interface, to the partitions across the interfaces and receive their values in out_values
+
+void mpi_inters::exchange_inter_values(array<int>& in_values, array<int>& out_values)
+{
+  if (n_inters!=0) {
+#ifdef _MPI
+      int sk = 0;
+      int request_count = 0;
+      for (int p=0;p<nproc;p++) {
+          int Nout = Nout_proc(p);
+          if (Nout) {
+              MPI_Isend(in_values.get_ptr_cpu(sk),Nout,MPI_INT,p,inters_type*10000+p   ,MPI_COMM_WORLD,&mpi_out_requests[request_count]);
+              MPI_Irecv(out_values.get_ptr_cpu(sk),Nout,MPI_INT,p,inters_type*10000+rank,MPI_COMM_WORLD,&mpi_in_requests[request_count]);
+              sk+=Nout;
+              request_count++;
+            }
+        }
+
+      MPI_Waitall(request_count,mpi_in_requests,MPI_STATUSES_IGNORE);
+      MPI_Waitall(request_count,mpi_out_requests,MPI_STATUSES_IGNORE);
+#endif
+    }
+}
+
 void mpi_inters::send_corrected_gradient()
 {
   if (n_inters!=0)
@@ -344,6 +366,9 @@ void mpi_inters::send_corrected_gradient()
           for(int k=0;k<n_fields;k++)
             for(int j=0;j<n_fpts_per_inter;j++)
               out_buffer_grad_disu(counter++) = (*grad_disu_fpts_l(j,i,k,m));
+
+      if (run_input.precision==1)
+        buffer_to_single(out_buffer_grad_disu,out_buffer_grad_disu_sp);
 #endif
 
 #ifdef _GPU
@@ -365,8 +390,14 @@ void mpi_inters::send_corrected_gradient()
 
           if (Nout) {
 #ifdef _MPI
-              MPI_Isend(out_buffer_grad_disu.get_ptr_cpu(sk),Nout,MPI_DOUBLE,p,inters_type*10000+p   ,MPI_COMM_WORLD,&mpi_out_requests_grad[request_count]);
-              MPI_Irecv(in_buffer_grad_disu.get_ptr_cpu(sk),Nout,MPI_DOUBLE,p,inters_type*10000+rank,MPI_COMM_WORLD,&mpi_in_requests_grad[request_count]);
+              if (run_input.precision==1) {
+                  MPI_Isend(out_buffer_grad_disu_sp.get_ptr_cpu(sk),Nout,MPI_FLOAT,p,inters_type*10000+p   ,MPI_COMM_WORLD,&mpi_out_requests_grad[request_count]);
+                  MPI_Irecv(in_buffer_grad_disu_sp.get_ptr_cpu(sk),Nout,MPI_FLOAT,p,inters_type*10000+rank,MPI_COMM_WORLD,&mpi_in_requests_grad[request_count]);
+                }
+              else {
+                  MPI_Isend(out_buffer_grad_disu.get_ptr_cpu(sk),Nout,MPI_DOUBLE,p,inters_type*10000+p   ,MPI_COMM_WORLD,&mpi_out_requests_grad[request_count]);
+                  MPI_Irecv(in_buffer_grad_disu.get_ptr_cpu(sk),Nout,MPI_DOUBLE,p,inters_type*10000+rank,MPI_COMM_WORLD,&mpi_in_requests_grad[request_count]);
+                }
 #endif
               sk+=Nout;
               Nmess++;
@@ -384,6 +415,9 @@ void mpi_inters::receive_corrected_gradient()
 #ifdef _MPI
       MPI_Waitall(Nmess,mpi_in_requests_grad,MPI_STATUSES_IGNORE);
       MPI_Waitall(Nmess,mpi_out_requests_grad,MPI_STATUSES_IGNORE);
+
+      if (run_input.precision==1)
+        buffer_to_double(in_buffer_grad_disu_sp,in_buffer_grad_disu);
 #endif
 #ifdef _GPU
       in_buffer_grad_disu.cp_cpu_gpu();
@@ -405,6 +439,9 @@ void mpi_inters::send_sgsf_fpts()
           for(int k=0;k<n_fields;k++)
             for(int j=0;j<n_fpts_per_inter;j++)
               out_buffer_sgsf(counter++) = (*sgsf_fpts_l(j,i,k,m));
+
+      if (run_input.precision==1)
+        buffer_to_single(out_buffer_sgsf,out_buffer_sgsf_sp);
 #endif
 
 #ifdef _GPU
@@ -426,8 +463,14 @@ void mpi_inters::send_sgsf_fpts()
 
           if (Nout) {
 #ifdef _MPI
-              MPI_Isend(out_buffer_sgsf.get_ptr_cpu(sk),Nout,MPI_DOUBLE,p,inters_type*10000+p   ,MPI_COMM_WORLD,&mpi_out_requests_sgsf[request_count]);
-              MPI_Irecv(in_buffer_sgsf.get_ptr_cpu(sk),Nout,MPI_DOUBLE,p,inters_type*10000+rank,MPI_COMM_WORLD,&mpi_in_requests_sgsf[request_count]);
+              if (run_input.precision==1) {
+                  MPI_Isend(out_buffer_sgsf_sp.get_ptr_cpu(sk),Nout,MPI_FLOAT,p,inters_type*10000+p   ,MPI_COMM_WORLD,&mpi_out_requests_sgsf[request_count]);
+                  MPI_Irecv(in_buffer_sgsf_sp.get_ptr_cpu(sk),Nout,MPI_FLOAT,p,inters_type*10000+rank,MPI_COMM_WORLD,&mpi_in_requests_sgsf[request_count]);
+                }
+              else {
+                  MPI_Isend(out_buffer_sgsf.get_ptr_cpu(sk),Nout,MPI_DOUBLE,p,inters_type*10000+p   ,MPI_COMM_WORLD,&mpi_out_requests_sgsf[request_count]);
+                  MPI_Irecv(in_buffer_sgsf.get_ptr_cpu(sk),Nout,MPI_DOUBLE,p,inters_type*10000+rank,MPI_COMM_WORLD,&mpi_in_requests_sgsf[request_count]);
+                }
 #endif
               sk+=Nout;
               Nmess++;
@@ -445,6 +488,9 @@ void mpi_inters::receive_sgsf_fpts()
 #ifdef _MPI
       MPI_Waitall(Nmess,mpi_in_requests_sgsf,MPI_STATUSES_IGNORE);
       MPI_Waitall(Nmess,mpi_out_requests_sgsf,MPI_STATUSES_IGNORE);
+
+      if (run_input.precision==1)
+        buffer_to_double(in_buffer_sgsf_sp,in_buffer_sgsf);
 #endif
 #ifdef _GPU
       in_buffer_sgsf.cp_cpu_gpu();
@@ -458,117 +504,88 @@ void mpi_inters::calculate_common_invFlux(void)
 {
 
 #ifdef _CPU
-  array<double> norm(n_dims), fn(n_fields);
-  array<double> u_c(n_fields);
-
-  for(int i=0;i<n_inters;i++)
-    {
-      for(int j=0;j<n_fpts_per_inter;j++)
-        {
-
-          // calculate discontinuous solution at flux points
-          for(int k=0;k<n_fields;k++) {
-            temp_u_l(k)=(*disu_fpts_l(j,i,k));
-            temp_u_r(k)=(*disu_fpts_r(j,i,k));
-          }
+  double t_start = get_wall_time();
+
+#pragma omp parallel
+  {
+    // Batch buffers of this thread
+    int thr = get_thread_num();
+    array<double>& batch_u_l = this->batch_u_l(thr);
+    array<double>& batch_u_r = this->batch_u_r(thr);
+    array<double>& batch_norm = this->batch_norm(thr);
+    array<double>& batch_v = this->batch_v(thr);
+    array<double>& batch_fn = this->batch_fn(thr);
+    array<double>& batch_u_c = this->batch_u_c(thr);
+
+    // The flux points of n_batch_inters interfaces at a time are gathered into the batch buffers, solved together and
+    // scattered back. The right state received from the other processor is in the dynamic space of the left one
+#pragma omp for schedule(static)
+    for(int i_start=0;i_start<n_inters;i_start+=n_batch_inters)
+      {
+        int n_block = min(n_batch_inters,n_inters-i_start);
+        int n_pts = n_block*n_fpts_per_inter;
 
-          if (motion) {
-            // Transform solution to dynamic space
-            for (int k=0; k<n_fields; k++) {
-              temp_u_l(k) /= (*J_dyn_fpts_l(j,i));
-              temp_u_r(k) /= (*J_dyn_fpts_l(j,i));
-            }
-            // Get mesh velocity
-            for (int k=0; k<n_dims; k++) {
-              temp_v(k)=(*grid_vel_fpts(j,i,k));
-            }
-          }else{
-            temp_v.initialize_to_zero();
-          }
+        for(int i=i_start;i<i_start+n_block;i++)
+          {
+            int p0=(i-i_start)*n_fpts_per_inter;
 
-          // Interface unit-normal vector
-          if (motion) {
-            for (int m=0;m<n_dims;m++)
-              norm(m) = *norm_dyn_fpts(j,i,m);
-          }else{
-            for (int m=0;m<n_dims;m++)
-              norm(m) = *norm_fpts(j,i,m);
-          }
+            for(int k=0;k<n_fields;k++) {
+                for(int j=0;j<n_fpts_per_inter;j++) {
+                    batch_u_l(p0+j,k)=(*disu_fpts_l(j,i,k));
+                    batch_u_r(p0+j,k)=(*disu_fpts_r(j,i,k));
+                  }
+              }
 
-          if (run_input.riemann_solve_type==0)
-            {
-              // calculate flux from discontinuous solution at flux points
-              if(n_dims==2) {
-                  calc_invf_2d(temp_u_l,temp_f_l);
-                  calc_invf_2d(temp_u_r,temp_f_r);
-                  if (motion) {
-                    calc_alef_2d(temp_u_l,temp_v,temp_f_l);
-                    calc_alef_2d(temp_u_r,temp_v,temp_f_r);
+            if (motion) {
+                for(int k=0;k<n_fields;k++) {
+                    for(int j=0;j<n_fpts_per_inter;j++) {
+                        batch_u_l(p0+j,k) /= (*J_dyn_fpts_l(j,i));
+                        batch_u_r(p0+j,k) /= (*J_dyn_fpts_l(j,i));
+                      }
                   }
-                }
-              else if(n_dims==3) {
-                  calc_invf_3d(temp_u_l,temp_f_l);
-                  calc_invf_3d(temp_u_r,temp_f_r);
-                  if (motion) {
-                    calc_alef_3d(temp_u_l,temp_v,temp_f_l);
-                    calc_alef_3d(temp_u_r,temp_v,temp_f_r);
+
+                for(int m=0;m<n_dims;m++) {
+                    for(int j=0;j<n_fpts_per_inter;j++) {
+                        batch_norm(p0+j,m)=(*norm_dyn_fpts(j,i,m));
+                        batch_v(p0+j,m)=(*grid_vel_fpts(j,i,m));
+                      }
                   }
-                }
-              else
-                FatalError("ERROR: Invalid number of dimensions ... ");
+              }
+            else {
+                for(int m=0;m<n_dims;m++)
+                  for(int j=0;j<n_fpts_per_inter;j++)
+                    batch_norm(p0+j,m)=(*norm_fpts(j,i,m));
+              }
+          }
 
-              // Calling Riemann solver
-              rusanov_flux(temp_u_l,temp_u_r,temp_v,temp_f_l,temp_f_r,norm,fn,n_dims,n_fields,run_input.gamma);
-            }
-          else if (run_input.riemann_solve_type==1)
-            {
-              lax_friedrich(temp_u_l,temp_u_r,norm,fn,n_dims,n_fields,run_input.lambda,run_input.wave_speed);
-            }
-          else if (run_input.riemann_solve_type==2) { // ROE
-              roe_flux(temp_u_l,temp_u_r,temp_v,norm,fn,n_dims,n_fields,run_input.gamma);
-            }
-          else
-            FatalError("Riemann solver not implemented");
+        // Calling Riemann solver
+        calc_common_invFlux_batch(n_pts);
 
-          // Transform back to computational space from dynamic physical space
-          if (motion)
+        for(int i=i_start;i<i_start+n_block;i++)
           {
-            for(int k=0; k<n_fields; k++) {
-              (*norm_tconf_fpts_l(j,i,k)) = fn(k)*(*ndA_dyn_fpts_l(j,i))*(*tdA_fpts_l(j,i));
-            }
-          }
-          else
-          {
-            // Transform back to reference space from static physical space
-            for(int k=0;k<n_fields;k++) {
-              (*norm_tconf_fpts_l(j,i,k))= fn(k)*(*tdA_fpts_l(j,i));
-            }
-          }
+            int p0=(i-i_start)*n_fpts_per_inter;
 
-          if(viscous)
-            {
-              // Calling viscous riemann solver
-              if (run_input.vis_riemann_solve_type==0)
-                ldg_solution(0,temp_u_l,temp_u_r,u_c,run_input.pen_fact,norm);
-              else
-                FatalError("Viscous Riemann solver not implemented");
-
-              if (motion) // include transformation back to static space
-              {
-                for(int k=0;k<n_fields;k++) {
-                  *delta_disu_fpts_l(j,i,k) = (u_c(k) - temp_u_l(k))*(*J_dyn_fpts_l(j,i));
-                }
-              }
-              else
-              {
-                for(int k=0;k<n_fields;k++) {
-                  *delta_disu_fpts_l(j,i,k) = (u_c(k) - temp_u_l(k));
-                }
+            for(int k=0;k<n_fields;k++) {
+                for(int j=0;j<n_fpts_per_inter;j++) {
+                    // Transform back to reference space
+                    if (motion)
+                      (*norm_tconf_fpts_l(j,i,k)) = batch_fn(p0+j,k)*(*ndA_dyn_fpts_l(j,i))*(*tdA_fpts_l(j,i));
+                    else
+                      (*norm_tconf_fpts_l(j,i,k)) = batch_fn(p0+j,k)*(*tdA_fpts_l(j,i));
+
+                    if(viscous) {
+                        if (motion) // include transformation back to static space
+                          *delta_disu_fpts_l(j,i,k) = (batch_u_c(p0+j,k) - batch_u_l(p0+j,k))*(*J_dyn_fpts_l(j,i));
+                        else
+                          *delta_disu_fpts_l(j,i,k) = (batch_u_c(p0+j,k) - batch_u_l(p0+j,k));
+                      }
+                  }
               }
-            }
+          }
+      }
+  }
 
-        }
-    }
+  t_invFlux += get_wall_time()-t_start;
 #endif
 
 #ifdef _GPU
@@ -583,101 +600,143 @@ void mpi_inters::calculate_common_viscFlux(void)
 {
 
 #ifdef _CPU
+  double t_start = get_wall_time();
+
+#pragma omp parallel
+  {
+    // Scratch storage of this thread
+    int thr = get_thread_num();
+    array<double>& temp_u_l = this->temp_u_l(thr);
+    array<double>& temp_u_r = this->temp_u_r(thr);
+    array<double>& temp_f_l = this->temp_f_l(thr);
+    array<double>& temp_f_r = this->temp_f_r(thr);
+    array<double>& temp_u_l_batch = this->temp_u_l_batch(thr);
+    array<double>& temp_u_r_batch = this->temp_u_r_batch(thr);
+    array<double>& temp_grad_u_l_batch = this->temp_grad_u_l_batch(thr);
+    array<double>& temp_grad_u_r_batch = this->temp_grad_u_r_batch(thr);
+    array<double>& temp_f_l_batch = this->temp_f_l_batch(thr);
+    array<double>& temp_f_r_batch = this->temp_f_r_batch(thr);
+    array<double>& temp_sgsf_l = this->temp_sgsf_l(thr);
+    array<double>& temp_sgsf_r = this->temp_sgsf_r(thr);
+    array<double>& norm = this->temp_norm(thr);
+    array<double>& fn = this->temp_fn(thr);
+
+#pragma omp for schedule(static)
+    for(int i=0;i<n_inters;i++)
+      {
+        // Batched viscous flux at all flux points of the interface
+        for(int k=0;k<n_fields;k++)
+          {
+            for(int j=0;j<n_fpts_per_inter;j++)
+              {
+                temp_u_l_batch(j,k)=(*disu_fpts_l(j,i,k));
+                temp_u_r_batch(j,k)=(*disu_fpts_r(j,i,k));
 
-  array<double> norm(n_dims), fn(n_fields);
+                // Transform solution to dynamic space
+                if (motion) {
+                  temp_u_l_batch(j,k) /= (*J_dyn_fpts_l(j,i));
+                  temp_u_r_batch(j,k) /= (*J_dyn_fpts_r(j,i));
+                }
 
-  for(int i=0;i<n_inters;i++)
-    {
-      for(int j=0;j<n_fpts_per_inter;j++)
-        {
-          // obtain discontinuous solution at flux points
+                for(int m=0;m<n_dims;m++)
+                  {
+                    temp_grad_u_l_batch(j,k,m) = *grad_disu_fpts_l(j,i,k,m);
+                    temp_grad_u_r_batch(j,k,m) = *grad_disu_fpts_r(j,i,k,m);
+                  }
+              }
+          }
 
-          for(int k=0;k<n_fields;k++)
-            {
-              temp_u_l(k)=(*disu_fpts_l(j,i,k));
-              temp_u_r(k)=(*disu_fpts_r(j,i,k));
+        if(n_dims==2)
+          {
+            calc_visf_2d_batch(n_fpts_per_inter,n_fields,temp_u_l_batch.get_ptr_cpu(),n_fpts_per_inter,temp_grad_u_l_batch.get_ptr_cpu(),n_fpts_per_inter,temp_f_l_batch.get_ptr_cpu(),n_fpts_per_inter);
+            calc_visf_2d_batch(n_fpts_per_inter,n_fields,temp_u_r_batch.get_ptr_cpu(),n_fpts_per_inter,temp_grad_u_r_batch.get_ptr_cpu(),n_fpts_per_inter,temp_f_r_batch.get_ptr_cpu(),n_fpts_per_inter);
+          }
+        else if(n_dims==3)
+          {
+            calc_visf_3d_batch(n_fpts_per_inter,n_fields,temp_u_l_batch.get_ptr_cpu(),n_fpts_per_inter,temp_grad_u_l_batch.get_ptr_cpu(),n_fpts_per_inter,temp_f_l_batch.get_ptr_cpu(),n_fpts_per_inter);
+            calc_visf_3d_batch(n_fpts_per_inter,n_fields,temp_u_r_batch.get_ptr_cpu(),n_fpts_per_inter,temp_grad_u_r_batch.get_ptr_cpu(),n_fpts_per_inter,temp_f_r_batch.get_ptr_cpu(),n_fpts_per_inter);
+          }
+        else
+          FatalError("ERROR: Invalid number of dimensions ... ");
+
+        for(int j=0;j<n_fpts_per_inter;j++)
+          {
+            // obtain discontinuous solution at flux points
+
+            for(int k=0;k<n_fields;k++)
+              {
+                temp_u_l(k)=(*disu_fpts_l(j,i,k));
+                temp_u_r(k)=(*disu_fpts_r(j,i,k));
+              }
+
+            if (motion) {
+              // Transform solution to dynamic space
+              for (int k=0; k<n_fields; k++) {
+                temp_u_l(k) /= (*J_dyn_fpts_l(j,i));
+                temp_u_r(k) /= (*J_dyn_fpts_r(j,i));
+              }
             }
 
-          if (motion) {
-            // Transform solution to dynamic space
-            for (int k=0; k<n_fields; k++) {
-              temp_u_l(k) /= (*J_dyn_fpts_l(j,i));
-              temp_u_r(k) /= (*J_dyn_fpts_r(j,i));
+            // Interface unit-normal vector
+            if (motion) {
+              for (int m=0;m<n_dims;m++)
+                norm(m) = *norm_dyn_fpts(j,i,m);
+            }else{
+              for (int m=0;m<n_dims;m++)
+                norm(m) = *norm_fpts(j,i,m);
             }
-          }
 
-          // Interface unit-normal vector
-          if (motion) {
-            for (int m=0;m<n_dims;m++)
-              norm(m) = *norm_dyn_fpts(j,i,m);
-          }else{
-            for (int m=0;m<n_dims;m++)
-              norm(m) = *norm_fpts(j,i,m);
-          }
+            // flux from discontinuous solution at flux points
 
-          // obtain physical gradient of discontinuous solution at flux points
+            for(int k=0;k<n_dims;k++)
+              {
+                for(int l=0;l<n_fields;l++)
+                  {
+                    temp_f_l(l,k) = temp_f_l_batch(j,l,k);
+                    temp_f_r(l,k) = temp_f_r_batch(j,l,k);
+                  }
+              }
 
-          for(int k=0;k<n_dims;k++)
-            {
-              for(int l=0;l<n_fields;l++)
-                {
-                  temp_grad_u_l(l,k) = *grad_disu_fpts_l(j,i,l,k);
-                  temp_grad_u_r(l,k) = *grad_disu_fpts_r(j,i,l,k);
+            // If LES, get SGS flux and add to viscous flux
+            if(LES) {
+              for(int k=0;k<n_dims;k++) {
+                for(int l=0;l<n_fields;l++) {
+                  // pointers to subgrid-scale fluxes
+                  temp_sgsf_l(l,k) = *sgsf_fpts_l(j,i,l,k);
+                  temp_sgsf_r(l,k) = *sgsf_fpts_r(j,i,l,k);
+
+                  // Add SGS fluxes to viscous fluxes
+                  temp_f_l(l,k) += temp_sgsf_l(l,k);
+                  temp_f_r(l,k) += temp_sgsf_r(l,k);
                 }
+              }
             }
 
-          // calculate flux from discontinuous solution at flux points
+            // Calling viscous riemann solver
+            if (run_input.vis_riemann_solve_type==0)
+              ldg_flux(0,temp_u_l,temp_u_r,temp_f_l,temp_f_r,norm,fn,n_dims,n_fields,run_input.tau,run_input.pen_fact);
+            else
+              FatalError("Viscous Riemann solver not implemented");
 
-          if(n_dims==2)
+            // Transform back to computational space from dynamic physical space
+            if (motion)
             {
-              calc_visf_2d(temp_u_l,temp_grad_u_l,temp_f_l);
-              calc_visf_2d(temp_u_r,temp_grad_u_r,temp_f_r);
+              for(int k=0; k<n_fields; k++) {
+                (*norm_tconf_fpts_l(j,i,k)) += fn(k)*(*ndA_dyn_fpts_l(j,i))*(*tdA_fpts_l(j,i));
+              }
             }
-          else if(n_dims==3)
+            else
             {
-              calc_visf_3d(temp_u_l,temp_grad_u_l,temp_f_l);
-              calc_visf_3d(temp_u_r,temp_grad_u_r,temp_f_r);
-            }
-          else
-            FatalError("ERROR: Invalid number of dimensions ... ");
-
-          // If LES, get SGS flux and add to viscous flux
-          if(LES) {
-            for(int k=0;k<n_dims;k++) {
-              for(int l=0;l<n_fields;l++) {
-                // pointers to subgrid-scale fluxes
-                temp_sgsf_l(l,k) = *sgsf_fpts_l(j,i,l,k);
-                temp_sgsf_r(l,k) = *sgsf_fpts_r(j,i,l,k);
-
-                // Add SGS fluxes to viscous fluxes
-                temp_f_l(l,k) += temp_sgsf_l(l,k);
-                temp_f_r(l,k) += temp_sgsf_r(l,k);
+              // Transform back to reference space from static physical space
+              for(int k=0;k<n_fields;k++) {
+                (*norm_tconf_fpts_l(j,i,k)) += fn(k)*(*tdA_fpts_l(j,i));
               }
             }
           }
+      }
+  }
 
-          // Calling viscous riemann solver
-          if (run_input.vis_riemann_solve_type==0)
-            ldg_flux(0,temp_u_l,temp_u_r,temp_f_l,temp_f_r,norm,fn,n_dims,n_fields,run_input.tau,run_input.pen_fact);
-          else
-            FatalError("Viscous Riemann solver not implemented");
-
-          // Transform back to computational space from dynamic physical space
-          if (motion)
-          {
-            for(int k=0; k<n_fields; k++) {
-              (*norm_tconf_fpts_l(j,i,k)) += fn(k)*(*ndA_dyn_fpts_l(j,i))*(*tdA_fpts_l(j,i));
-            }
-          }
-          else
-          {
-            // Transform back to reference space from static physical space
-            for(int k=0;k<n_fields;k++) {
-              (*norm_tconf_fpts_l(j,i,k)) += fn(k)*(*tdA_fpts_l(j,i));
-            }
-          }
-        }
-    }
+  t_viscFlux += get_wall_time()-t_start;
 
   //cout << "done viscous mpi" << endl;
 #endif
@@ -0,0 +1,258 @@
+/*!
+ * \file opp_cache.cpp
+ * \author - Original code: SD++ developed by Patrice Castonguay, Antony Jameson,
+ *                          Peter Vincent, David Williams (alphabetical by surname).
+ *         - Current development: Aerospace Computing Laboratory (ACL)
+ *                                Aero/Astro Department. Stanford University.
+ * \version 0.1.0
+ *
+ * High Fidelity Large Eddy Simulation (HiFiLES) Code.
+ * Copyright (C) 2014 Aerospace Computing Laboratory (ACL).
+ *
+ * HiFiLES is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * HiFiLES is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with HiFiLES.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <cstring>
+
+#include "../include/opp_cache.h"
+
+using namespace std;
+
+// file layout, in the byte order of the machine: "HiFiOPP" and a zero byte, the version, the number and values of
+// the integer key, the number and values of the real key, the number of operators, then for each operator the
+// length and characters of its name, its four dimensions and its values
+
+static const char opp_cache_magic[8]={'H','i','F','i','O','P','P','\0'};
+
+// #### constructors ####
+
+// default constructor
+
+opp_cache::opp_cache()
+{
+  modified=false;
+}
+
+// #### methods ####
+
+void opp_cache::setup(string in_file_name, array<int>& in_key_int, array<double>& in_key_double)
+{
+  file_name=in_file_name;
+  key_int=in_key_int;
+  key_double=in_key_double;
+
+  names.clear();
+  opps.clear();
+  modified=false;
+
+  if(!file_name.empty() && !read())
+  {
+    names.clear();
+    opps.clear();
+  }
+}
+
+bool opp_cache::read(void)
+{
+  ifstream file(file_name.c_str(),ios::in|ios::binary);
+
+  if(!file.is_open())
+    return false;
+
+  char magic[8];
+  int version, n_int, n_double, n_opps;
+
+  file.read(magic,8);
+  file.read((char*)&version,sizeof(int));
+
+  if(!file || memcmp(magic,opp_cache_magic,8)!=0 || version!=OPP_CACHE_VERSION)
+    return false;
+
+  // the key must match exactly, the operators are only valid for the parameters they were computed with
+  file.read((char*)&n_int,sizeof(int));
+  if(!file || n_int!=key_int.get_dim(0))
+    return false;
+
+  for(int i=0;i<n_int;i++)
+  {
+    int val;
+    file.read((char*)&val,sizeof(int));
+    if(!file || val!=key_int(i))
+      return false;
+  }
+
+  file.read((char*)&n_double,sizeof(int));
+  if(!file || n_double!=key_double.get_dim(0))
+    return false;
+
+  for(int i=0;i<n_double;i++)
+  {
+    double val;
+    file.read((char*)&val,sizeof(double));
+    if(!file || memcmp(&val,key_double.get_ptr_cpu(i),sizeof(double))!=0)
+      return false;
+  }
+
+  file.read((char*)&n_opps,sizeof(int));
+  if(!file || n_opps<0)
+    return false;
+
+  for(int m=0;m<n_opps;m++)
+  {
+    int len, dim[4];
+
+    file.read((char*)&len,sizeof(int));
+    if(!file || len<=0 || len>256)
+      return false;
+
+    string name(len,' ');
+    file.read(&name[0],len);
+    file.read((char*)dim,4*sizeof(int));
+
+    if(!file || dim[0]<0 || dim[1]<0 || dim[2]<0 || dim[3]<0)
+      return false;
+
+    array<double> opp(dim[0],dim[1],dim[2],dim[3]);
+    file.read((char*)opp.get_ptr_cpu(),sizeof(double)*dim[0]*dim[1]*dim[2]*dim[3]);
+
+    if(!file)
+      return false;
+
+    names.push_back(name);
+    opps.push_back(opp);
+  }
+
+  return true;
+}
+
+bool opp_cache::get(string in_name, array<double>& out_opp)
+{
+  for(unsigned int m=0;m<names.size();m++)
+  {
+    if(names[m]==in_name)
+    {
+      for(int i=0;i<4;i++)
+        if(opps[m].get_dim(i)!=out_opp.get_dim(i))
+          return false;
+
+      memcpy(out_opp.get_ptr_cpu(),opps[m].get_ptr_cpu(),sizeof(double)*out_opp.get_dim(0)*out_opp.get_dim(1)*out_opp.get_dim(2)*out_opp.get_dim(3));
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void opp_cache::put(string in_name, array<double>& in_opp)
+{
+  if(file_name.empty())
+    return;
+
+  modified=true;
+
+  for(unsigned int m=0;m<names.size();m++)
+  {
+    if(names[m]==in_name)
+    {
+      opps[m]=in_opp;
+      return;
+    }
+  }
+
+  names.push_back(in_name);
+  opps.push_back(in_opp);
+}
+
+bool opp_cache::get(string in_name, array< array<double> >& out_opps)
+{
+  for(int i=0;i<out_opps.get_dim(0);i++)
+  {
+    stringstream name;
+    name << in_name << "(" << i << ")";
+
+    if(!get(name.str(),out_opps(i)))
+      return false;
+  }
+
+  return true;
+}
+
+void opp_cache::put(string in_name, array< array<double> >& in_opps)
+{
+  for(int i=0;i<in_opps.get_dim(0);i++)
+  {
+    stringstream name;
+    name << in_name << "(" << i << ")";
+
+    put(name.str(),in_opps(i));
+  }
+}
+
+void opp_cache::write(int in_rank)
+{
+  if(file_name.empty() || !modified)
+    return;
+
+  // ranks that computed the same operators write the same bytes, renaming a complete file keeps readers from
+  // seeing a partial one
+  stringstream tmp_name;
+  tmp_name << file_name << ".tmp" << in_rank;
+
+  ofstream file(tmp_name.str().c_str(),ios::out|ios::binary|ios::trunc);
+
+  if(!file.is_open())
+  {
+    cout << "WARNING: could not write operator cache " << file_name << endl;
+    return;
+  }
+
+  int version=OPP_CACHE_VERSION;
+  int n_int=key_int.get_dim(0);
+  int n_double=key_double.get_dim(0);
+  int n_opps=names.size();
+
+  file.write(opp_cache_magic,8);
+  file.write((char*)&version,sizeof(int));
+  file.write((char*)&n_int,sizeof(int));
+  file.write((char*)key_int.get_ptr_cpu(),sizeof(int)*n_int);
+  file.write((char*)&n_double,sizeof(int));
+  file.write((char*)key_double.get_ptr_cpu(),sizeof(double)*n_double);
+  file.write((char*)&n_opps,sizeof(int));
+
+  for(int m=0;m<n_opps;m++)
+  {
+    int len=names[m].size();
+    int dim[4]={opps[m].get_dim(0),opps[m].get_dim(1),opps[m].get_dim(2),opps[m].get_dim(3)};
+
+    file.write((char*)&len,sizeof(int));
+    file.write(names[m].c_str(),len);
+    file.write((char*)dim,4*sizeof(int));
+    file.write((char*)opps[m].get_ptr_cpu(),sizeof(double)*dim[0]*dim[1]*dim[2]*dim[3]);
+  }
+
+  file.close();
+
+  if(!file || rename(tmp_name.str().c_str(),file_name.c_str())!=0)
+  {
+    cout << "WARNING: could not write operator cache " << file_name << endl;
+    remove(tmp_name.str().c_str());
+    return;
+  }
+
+  modified=false;
+}
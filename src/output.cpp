@@ -1741,6 +1741,54 @@ void check_stability(struct solution* FlowSol)
 
 }
 
+// Interfaces are listed per kind (interior, boundary, mpi) and type (segment, triangle, quadrilateral), with the total
+// number over all processors and the largest times of any of them, to compare the flux evaluation between thread counts
+void InterfaceTimingOutput(struct solution* FlowSol)
+{
+  const char* kind_names[3] = {"int", "bdy", "mpi"};
+  const char* type_names[3] = {"seg", "tri", "quad"};
+
+  // Number of interfaces, inviscid and viscous time of each kind and type
+  array<double> vals(3,3,3), vals_global(3,3,3);
+  vals.initialize_to_zero();
+
+  for(int i=0; i<FlowSol->n_int_inter_types; i++) {
+    vals(0,i,0) = FlowSol->mesh_int_inters(i).get_n_inters();
+    vals(0,i,1) = FlowSol->mesh_int_inters(i).get_invFlux_time();
+    vals(0,i,2) = FlowSol->mesh_int_inters(i).get_viscFlux_time();
+  }
+
+  for(int i=0; i<FlowSol->n_bdy_inter_types; i++) {
+    vals(1,i,0) = FlowSol->mesh_bdy_inters(i).get_n_inters();
+    vals(1,i,1) = FlowSol->mesh_bdy_inters(i).get_invFlux_time();
+    vals(1,i,2) = FlowSol->mesh_bdy_inters(i).get_viscFlux_time();
+  }
+
+#ifdef _MPI
+  for(int i=0; i<FlowSol->n_mpi_inter_types; i++) {
+    vals(2,i,0) = FlowSol->mesh_mpi_inters(i).get_n_inters();
+    vals(2,i,1) = FlowSol->mesh_mpi_inters(i).get_invFlux_time();
+    vals(2,i,2) = FlowSol->mesh_mpi_inters(i).get_viscFlux_time();
+  }
+
+  // Sum the interfaces, and take the largest times
+  MPI_Reduce(vals.get_ptr_cpu(0,0,0), vals_global.get_ptr_cpu(0,0,0), 9, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+  MPI_Reduce(vals.get_ptr_cpu(0,0,1), vals_global.get_ptr_cpu(0,0,1), 18, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+#else
+  vals_global = vals;
+#endif
+
+  if (FlowSol->rank == 0) {
+    printf("Interface flux time (%d threads per process)\n", get_n_threads());
+
+    for(int i=0; i<3; i++)
+      for(int j=0; j<3; j++)
+        if (vals_global(i,j,0) > 0)
+          printf("  %s %-4s n_inters= %8ld  invFlux= %f s  viscFlux= %f s\n", kind_names[i], type_names[j],
+                 (long) vals_global(i,j,0), vals_global(i,j,1), vals_global(i,j,2));
+  }
+}
+
 #ifdef _GPU
 void CopyGPUCPU(struct solution* FlowSol)
 {
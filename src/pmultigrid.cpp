@@ -0,0 +1,325 @@
+/*!
+ * \file pmultigrid.cpp
+ * \author - Original code: SD++ developed by Patrice Castonguay, Antony Jameson,
+ *                          Peter Vincent, David Williams (alphabetical by surname).
+ *         - Current development: Aerospace Computing Laboratory (ACL)
+ *                                Aero/Astro Department. Stanford University.
+ * \version 0.1.0
+ *
+ * High Fidelity Large Eddy Simulation (HiFiLES) Code.
+ * Copyright (C) 2014 Aerospace Computing Laboratory (ACL).
+ *
+ * HiFiLES is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * HiFiLES is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with HiFiLES.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <iostream>
+#include <cmath>
+
+#include "../include/global.h"
+#include "../include/array.h"
+#include "../include/input.h"
+#include "../include/funcs.h"
+#include "../include/error.h"
+#include "../include/geometry.h"
+#include "../include/solver.h"
+#include "../include/pmultigrid.h"
+
+using namespace std;
+
+// apply the operator in_opp to the values of each field of each element of in_dofs, out_dofs = in_opp*in_dofs or
+// out_dofs += in_opp*in_dofs
+
+static void apply_opp_dofs(array<double>& in_opp, int in_n_eles, int in_n_fields, double* in_dofs, double* out_dofs, bool in_add)
+{
+  int n_out = in_opp.get_dim(0);
+  int n_in = in_opp.get_dim(1);
+
+#pragma omp parallel for schedule(static)
+  for (int ic=0;ic<in_n_eles;ic++)
+  {
+    for (int i=0;i<in_n_fields;i++)
+    {
+      double* in_ptr = in_dofs+(ic*in_n_fields+i)*n_in;
+      double* out_ptr = out_dofs+(ic*in_n_fields+i)*n_out;
+
+      for (int j=0;j<n_out;j++)
+      {
+        double sum = 0.;
+        for (int k=0;k<n_in;k++)
+          sum += in_opp(j,k)*in_ptr[k];
+
+        if (in_add)
+          out_ptr[j] += sum;
+        else
+          out_ptr[j] = sum;
+      }
+    }
+  }
+}
+
+// #### constructors ####
+
+// default constructor
+
+pmultigrid::pmultigrid()
+{
+  n_levels = 0;
+}
+
+// #### methods ####
+
+void pmultigrid::setup(struct solution* FlowSol)
+{
+  int order = run_input.order;
+  int n_ele_types = FlowSol->n_ele_types;
+
+  n_levels = order-run_input.pmg_min_order+1;
+
+  FlowSol_levels.setup(n_levels);
+  Mesh_levels.setup(n_levels);
+
+  FlowSol_levels(0) = FlowSol;
+  Mesh_levels(0) = NULL;
+
+  // the lower orders are set up from the mesh file as the solution was, with the order changed while they are
+  for (int l=1;l<n_levels;l++)
+  {
+    if (FlowSol->rank == 0) cout << endl << "p-multigrid: setting up order " << order-l << endl;
+
+    run_input.set_order(order-l);
+
+    FlowSol_levels(l) = new solution;
+    Mesh_levels(l) = new mesh;
+
+    SetInput(FlowSol_levels(l));
+    GeoPreprocess(FlowSol_levels(l), *Mesh_levels(l));
+
+    FlowSol_levels(l)->time = FlowSol->time;
+    FlowSol_levels(l)->ini_iter = FlowSol->ini_iter;
+
+    // the initial conditions also set the element lengths of the local timesteps, the solution itself is restricted
+    // from the higher order before each use
+    for (int i=0;i<n_ele_types;i++)
+    {
+      if (FlowSol_levels(l)->mesh_eles(i)->get_n_eles() != FlowSol->mesh_eles(i)->get_n_eles())
+        FatalError("The elements of the p-multigrid orders do not match");
+
+      if (FlowSol_levels(l)->mesh_eles(i)->get_n_eles() != 0)
+        FlowSol_levels(l)->mesh_eles(i)->set_ics(FlowSol_levels(l)->time);
+    }
+  }
+
+  run_input.set_order(order);
+
+  opp_prolong.setup(n_levels);
+  opp_restrict.setup(n_levels);
+  disu_restricted.setup(n_levels);
+  forcing.setup(n_levels);
+  disu_work.setup(n_levels);
+  rhs_work.setup(n_levels);
+
+  for (int l=0;l<n_levels;l++)
+  {
+    opp_prolong(l).setup(n_ele_types);
+    opp_restrict(l).setup(n_ele_types);
+    disu_restricted(l).setup(n_ele_types);
+    forcing(l).setup(n_ele_types);
+    disu_work(l).setup(n_ele_types);
+    rhs_work(l).setup(n_ele_types);
+
+    for (int i=0;i<n_ele_types;i++)
+    {
+      eles* ele_l = FlowSol_levels(l)->mesh_eles(i);
+
+      if (ele_l->get_n_eles() == 0)
+        continue;
+
+      int n_dofs = ele_l->get_n_eles()*ele_l->get_n_dofs_per_ele();
+
+      disu_work(l)(i).setup(n_dofs);
+      rhs_work(l)(i).setup(n_dofs);
+
+      if (l > 0)
+      {
+        disu_restricted(l)(i).setup(n_dofs);
+        forcing(l)(i).setup(n_dofs);
+      }
+
+      if (l+1 < n_levels)
+      {
+        // the lower order basis at the solution points of this order, and the least squares fit of the lower
+        // order polynomial to values at these points, (P^T P)^-1 P^T
+        eles* ele_c = FlowSol_levels(l+1)->mesh_eles(i);
+        int n_dims = ele_l->get_n_dims();
+        int n_upts = ele_l->get_n_upts_per_ele();
+        int n_upts_c = ele_c->get_n_upts_per_ele();
+        array<double> loc(n_dims);
+
+        opp_prolong(l)(i).setup(n_upts,n_upts_c);
+
+        for (int j=0;j<n_upts;j++)
+        {
+          for (int k=0;k<n_dims;k++)
+            loc(k) = ele_l->get_loc_upt(j,k);
+
+          for (int k=0;k<n_upts_c;k++)
+            opp_prolong(l)(i)(j,k) = ele_c->eval_nodal_basis(k,loc);
+        }
+
+        array<double> normal_opp(n_upts_c,n_upts_c);
+
+        for (int j=0;j<n_upts_c;j++)
+          for (int k=0;k<n_upts_c;k++)
+          {
+            normal_opp(j,k) = 0.;
+            for (int m=0;m<n_upts;m++)
+              normal_opp(j,k) += opp_prolong(l)(i)(m,j)*opp_prolong(l)(i)(m,k);
+          }
+
+        array<double> inv_normal_opp = inv_array(normal_opp);
+
+        opp_restrict(l)(i).setup(n_upts_c,n_upts);
+
+        for (int j=0;j<n_upts_c;j++)
+          for (int k=0;k<n_upts;k++)
+          {
+            opp_restrict(l)(i)(j,k) = 0.;
+            for (int m=0;m<n_upts_c;m++)
+              opp_restrict(l)(i)(j,k) += inv_normal_opp(j,m)*opp_prolong(l)(i)(k,m);
+          }
+      }
+    }
+  }
+
+  if (FlowSol->rank == 0) cout << endl << "p-multigrid: " << n_levels << " orders, from " << order << " to " << run_input.pmg_min_order << endl;
+}
+
+void pmultigrid::cycle(int in_file_num)
+{
+  for (int l=1;l<n_levels;l++)
+    FlowSol_levels(l)->time = FlowSol_levels(0)->time;
+
+  cycle_level(in_file_num,0);
+}
+
+void pmultigrid::cycle_level(int in_file_num, int in_level)
+{
+  struct solution* FlowSol = FlowSol_levels(in_level);
+
+  smooth(in_file_num,in_level);
+
+  if (in_level+1 < n_levels)
+  {
+    int l_c = in_level+1;
+    struct solution* FlowSol_c = FlowSol_levels(l_c);
+
+    // restrict the solution, and the right-hand side with the forcing of this level
+    calc_rhs(in_file_num,in_level,rhs_work(in_level));
+
+    for (int i=0;i<FlowSol->n_ele_types;i++)
+    {
+      eles* ele_l = FlowSol->mesh_eles(i);
+      int n_eles = ele_l->get_n_eles();
+
+      if (n_eles == 0)
+        continue;
+
+      int n_fields = ele_l->get_n_fields();
+      int n_dofs = n_eles*ele_l->get_n_dofs_per_ele();
+
+      if (in_level > 0)
+        for (int k=0;k<n_dofs;k++)
+          rhs_work(in_level)(i)(k) += forcing(in_level)(i)(k);
+
+      ele_l->get_disu_upts_dofs(disu_work(in_level)(i).get_ptr_cpu());
+
+      apply_opp_dofs(opp_restrict(in_level)(i),n_eles,n_fields,disu_work(in_level)(i).get_ptr_cpu(),disu_restricted(l_c)(i).get_ptr_cpu(),false);
+      apply_opp_dofs(opp_restrict(in_level)(i),n_eles,n_fields,rhs_work(in_level)(i).get_ptr_cpu(),forcing(l_c)(i).get_ptr_cpu(),false);
+
+      FlowSol_c->mesh_eles(i)->set_disu_upts_dofs(disu_restricted(l_c)(i).get_ptr_cpu());
+    }
+
+    // the forcing makes the right-hand side of the lower order the restricted one at the restricted solution
+    calc_rhs(in_file_num,l_c,rhs_work(l_c));
+
+    for (int i=0;i<FlowSol_c->n_ele_types;i++)
+    {
+      eles* ele_c = FlowSol_c->mesh_eles(i);
+
+      if (ele_c->get_n_eles() == 0)
+        continue;
+
+      int n_dofs_c = ele_c->get_n_eles()*ele_c->get_n_dofs_per_ele();
+
+      for (int k=0;k<n_dofs_c;k++)
+        forcing(l_c)(i)(k) -= rhs_work(l_c)(i)(k);
+
+      ele_c->set_mg_src_upts_dofs(forcing(l_c)(i).get_ptr_cpu());
+    }
+
+    cycle_level(in_file_num,l_c);
+
+    // prolongate the change of the lower order solution
+    for (int i=0;i<FlowSol->n_ele_types;i++)
+    {
+      eles* ele_l = FlowSol->mesh_eles(i);
+      eles* ele_c = FlowSol_c->mesh_eles(i);
+      int n_eles = ele_l->get_n_eles();
+
+      if (n_eles == 0)
+        continue;
+
+      int n_dofs_c = n_eles*ele_c->get_n_dofs_per_ele();
+
+      ele_c->get_disu_upts_dofs(disu_work(l_c)(i).get_ptr_cpu());
+
+      for (int k=0;k<n_dofs_c;k++)
+        disu_work(l_c)(i)(k) -= disu_restricted(l_c)(i)(k);
+
+      apply_opp_dofs(opp_prolong(in_level)(i),n_eles,ele_l->get_n_fields(),disu_work(l_c)(i).get_ptr_cpu(),disu_work(in_level)(i).get_ptr_cpu(),true);
+
+      ele_l->set_disu_upts_dofs(disu_work(in_level)(i).get_ptr_cpu());
+    }
+
+    smooth(in_file_num,in_level);
+  }
+}
+
+void pmultigrid::smooth(int in_file_num, int in_level)
+{
+  struct solution* FlowSol = FlowSol_levels(in_level);
+  int n_stages = (run_input.adv_type == 0) ? 1 : 5;
+
+  for (int s=0;s<run_input.pmg_n_smooth;s++)
+  {
+    for (int j=0;j<n_stages;j++)
+    {
+      CalcResidual(in_file_num,j,FlowSol);
+
+      for (int i=0;i<FlowSol->n_ele_types;i++)
+        FlowSol->mesh_eles(i)->AdvanceSolution(j,run_input.adv_type);
+    }
+  }
+}
+
+void pmultigrid::calc_rhs(int in_file_num, int in_level, array< array<double> >& out_rhs)
+{
+  struct solution* FlowSol = FlowSol_levels(in_level);
+
+  CalcResidual(in_file_num,0,FlowSol);
+
+  for (int i=0;i<FlowSol->n_ele_types;i++)
+    if (FlowSol->mesh_eles(i)->get_n_eles() != 0)
+      FlowSol->mesh_eles(i)->get_rhs_upts_dofs(out_rhs(i).get_ptr_cpu());
+}
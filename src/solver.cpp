@@ -92,9 +92,17 @@ void CalcResidual(int in_file_num, int in_rk_stage, struct solution* FlowSol) {
     // #endif
   }
 
-  /*! Compute the solution at the flux points. */
-  for(i=0; i<FlowSol->n_ele_types; i++)
-    FlowSol->mesh_eles(i)->extrapolate_solution(in_disu_upts_from);
+  if (run_input.blocked_residual) {
+      /*! Compute the solution at the flux points, the uncorrected gradient (viscous only) and
+       the inviscid flux at the solution points, one block of elements at a time. */
+      for(i=0; i<FlowSol->n_ele_types; i++)
+        FlowSol->mesh_eles(i)->evaluate_invFlux_blocked(in_disu_upts_from);
+    }
+  else {
+      /*! Compute the solution at the flux points. */
+      for(i=0; i<FlowSol->n_ele_types; i++)
+        FlowSol->mesh_eles(i)->extrapolate_solution(in_disu_upts_from);
+    }
 
 #ifdef _MPI
   /*! Send the solution at the flux points across the MPI interfaces. */
@@ -103,16 +111,18 @@ void CalcResidual(int in_file_num, int in_rk_stage, struct solution* FlowSol) {
       FlowSol->mesh_mpi_inters(i).send_solution();
 #endif
 
-  if (FlowSol->viscous) {
-      /*! Compute the uncorrected gradient of the solution at the solution points. */
+  if (!run_input.blocked_residual) {
+      if (FlowSol->viscous) {
+          /*! Compute the uncorrected gradient of the solution at the solution points. */
+          for(i=0; i<FlowSol->n_ele_types; i++)
+            FlowSol->mesh_eles(i)->calculate_gradient(in_disu_upts_from);
+        }
+
+      /*! Compute the inviscid flux at the solution points and store in total flux storage. */
       for(i=0; i<FlowSol->n_ele_types; i++)
-        FlowSol->mesh_eles(i)->calculate_gradient(in_disu_upts_from);
+        FlowSol->mesh_eles(i)->evaluate_invFlux(in_disu_upts_from);
     }
 
-  /*! Compute the inviscid flux at the solution points and store in total flux storage. */
-  for(i=0; i<FlowSol->n_ele_types; i++)
-    FlowSol->mesh_eles(i)->evaluate_invFlux(in_disu_upts_from);
-
 
   // If running periodic channel or periodic hill cases,
   // calculate body forcing and add to source term
@@ -150,11 +160,17 @@ void CalcResidual(int in_file_num, int in_rk_stage, struct solution* FlowSol) {
 
   if (FlowSol->viscous) {
       /*! Compute corrected gradient of the solution at the solution and flux points. */
-      for(i=0; i<FlowSol->n_ele_types; i++)
-        FlowSol->mesh_eles(i)->correct_gradient();
+      if (run_input.blocked_residual) {
+          for(i=0; i<FlowSol->n_ele_types; i++)
+            FlowSol->mesh_eles(i)->correct_gradient_blocked();
+        }
+      else {
+          for(i=0; i<FlowSol->n_ele_types; i++)
+            FlowSol->mesh_eles(i)->correct_gradient();
 
-      for(i=0; i<FlowSol->n_ele_types; i++)
-        FlowSol->mesh_eles(i)->extrapolate_corrected_gradient();
+          for(i=0; i<FlowSol->n_ele_types; i++)
+            FlowSol->mesh_eles(i)->extrapolate_corrected_gradient();
+        }
 
 #ifdef _MPI
       /*! Send the corrected value and SGS flux across the MPI interface. */
@@ -170,23 +186,30 @@ void CalcResidual(int in_file_num, int in_rk_stage, struct solution* FlowSol) {
 #endif
 
       /*! Compute discontinuous viscous flux at upts and add to inviscid flux at upts. */
-      for(i=0; i<FlowSol->n_ele_types; i++)
-        FlowSol->mesh_eles(i)->evaluate_viscFlux(in_disu_upts_from);
+      if (!run_input.blocked_residual) {
+          for(i=0; i<FlowSol->n_ele_types; i++)
+            FlowSol->mesh_eles(i)->evaluate_viscFlux(in_disu_upts_from);
+        }
     }
 
-  /*! If using LES, compute the SGS flux at flux points. */
-  if (run_input.LES) {
-	  for(i=0; i<FlowSol->n_ele_types; i++)
-			FlowSol->mesh_eles(i)->evaluate_sgsFlux();
-  }
-
-  /*! For viscous or inviscid, compute the normal discontinuous flux at flux points. */
-  for(i=0; i<FlowSol->n_ele_types; i++)
-    FlowSol->mesh_eles(i)->extrapolate_totalFlux();
+  if (run_input.blocked_residual) {
+      /*! Compute the viscous and SGS fluxes, the normal discontinuous flux at flux points and
+       the divergence of flux at solution points, one block of elements at a time. */
+      for(i=0; i<FlowSol->n_ele_types; i++)
+        FlowSol->mesh_eles(i)->calculate_divergence_blocked(in_disu_upts_from,in_div_tconf_upts_to);
+    }
+  else {
+      /*! If using LES, compute the SGS flux at flux points. */
+      if (run_input.LES) {
+        for(i=0; i<FlowSol->n_ele_types; i++)
+          FlowSol->mesh_eles(i)->evaluate_sgsFlux();
+      }
 
-  /*! For viscous or inviscid, compute the divergence of flux at solution points. */
-  for(i=0; i<FlowSol->n_ele_types; i++)
-    FlowSol->mesh_eles(i)->calculate_divergence(in_div_tconf_upts_to);
+      /*! For viscous or inviscid, compute the normal discontinuous flux at flux points
+       and the divergence of flux at solution points. */
+      for(i=0; i<FlowSol->n_ele_types; i++)
+        FlowSol->mesh_eles(i)->calculate_totalFlux_divergence(in_div_tconf_upts_to);
+    }
 
   if (FlowSol->viscous) {
       /*! Compute normal interface viscous flux and add to normal inviscid flux. */
@@ -224,6 +247,56 @@ void CalcResidual(int in_file_num, int in_rk_stage, struct solution* FlowSol) {
   }
 }
 
+// BDF2 dual time stepping: RK45 iterations in pseudo time on the unsteady residual of the solution at the end of the
+// physical timestep, until it has dropped by dual_time_tol or after dual_time_max_iter iterations
+
+void DualTimeStep(int in_file_num, struct solution* FlowSol) {
+
+  int i, j, n_iters = 0;
+  double res = 0., res_0 = 0.;
+  double time_n = FlowSol->time;
+
+  for(i=0; i<FlowSol->n_ele_types; i++)
+    FlowSol->mesh_eles(i)->shift_dual_time_levels();
+
+  // the boundary conditions are imposed at the end of the physical timestep
+  FlowSol->time = time_n + run_input.dt;
+
+  while(n_iters < run_input.dual_time_max_iter) {
+
+      for(j=0; j<5; j++) {
+          CalcResidual(in_file_num, j, FlowSol);
+
+          for(i=0; i<FlowSol->n_ele_types; i++)
+            FlowSol->mesh_eles(i)->AdvanceSolution(j, 5);
+        }
+
+      /*! Unsteady residual at the start of this iteration, from its first stage. */
+      res = 0.;
+      for(i=0; i<FlowSol->n_ele_types; i++)
+        res += FlowSol->mesh_eles(i)->get_dual_time_res();
+
+#ifdef _MPI
+      double res_global;
+      MPI_Allreduce(&res, &res_global, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+      res = res_global;
+#endif
+
+      res = sqrt(res);
+      n_iters++;
+
+      if (n_iters == 1)
+        res_0 = res;
+      else if (res <= run_input.dual_time_tol*res_0)
+        break;
+    }
+
+  FlowSol->time = time_n;
+
+  if (FlowSol->rank == 0 && (in_file_num+1)%run_input.monitor_res_freq == 0)
+    cout << "dual time step: pseudo-time iterations " << n_iters << ", unsteady residual drop " << res/max(res_0,1e-300) << endl;
+}
+
 #ifdef _MPI
 void set_rank_nproc(int in_rank, int in_nproc, struct solution* FlowSol)
 {
@@ -338,7 +411,7 @@ double* get_grad_disu_fpts_ptr(int in_ele_type, int in_ele, int in_local_inter,
 }
 
 // get pointer to the discontinuous solution (close normal) at a flux point
-double* get_normal_disu_fpts_ptr(int in_ele_type, int in_ele, int in_local_inter, int in_field, int in_fpt, struct solution* FlowSol, array<double> temp_loc, double temp_pos[3])
+double* get_normal_disu_fpts_ptr(int in_ele_type, int in_ele, int in_local_inter, int in_field, int in_fpt, struct solution* FlowSol, array<double>& temp_loc, double temp_pos[3])
 {
   return FlowSol->mesh_eles(in_ele_type)->get_normal_disu_fpts_ptr(in_fpt,in_local_inter,in_field,in_ele, temp_loc, temp_pos);
 }
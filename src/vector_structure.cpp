@@ -413,8 +413,8 @@ double dotProd(const CSysVector & u, const CSysVector & v) {
     loc_prod += u.vec_val[i]*v.vec_val[i];
   double prod = 0.0;
   
-#ifdef MPI
-  MPI_Allreduce(&loc_prod, &prod, 1, MPI_DOUBLE, MPI_SUM);
+#ifdef _MPI
+  MPI_Allreduce(&loc_prod, &prod, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
 #else
   prod = loc_prod;
 #endif
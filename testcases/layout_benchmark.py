@@ -0,0 +1,86 @@
+#!/usr/bin/env python
+
+# \file layout_benchmark.py
+# \brief Benchmark of the solution point array layouts on the cylinder and Taylor-Green vortex cases
+#
+# Run from this directory:
+#
+#   python layout_benchmark.py [path/to/HiFiLES] [aosoa_widths]
+#
+# Each case is run with the (upt,ele,field) structure of arrays layout (upts_layout 0) and with the
+# AoSoA layout (upts_layout 1) for each width in the comma-separated list aosoa_widths (default 4,8).
+# The layout options are appended to a copy of the case's input file. Both layouts do the same
+# operations in the same order, so the residuals must match the structure of arrays run exactly.
+
+import sys, os, time, subprocess
+
+cases = [('euler/cylinder', 'input_cylinder_inv'),
+         ('navier-stokes/cylinder', 'input_cylinder_visc'),
+         ('navier-stokes/Taylor_Green_vortex', 'input_TGV_SD_hex')]
+
+def run_case(exe, case_dir, infile, options):
+  ##### Run the solver once with options appended to infile, return the wall-clock time and the final residual line
+  env = os.environ.copy()
+  if 'HIFILES_HOME' not in env:
+    env['HIFILES_HOME'] = os.path.abspath(os.path.join(os.getcwd(), '..'))
+
+  cwd = os.getcwd()
+  os.chdir(case_dir)
+
+  runfile = infile + '_layout'
+  f = open(runfile, 'w')
+  f.write(open(infile).read() + '\n')
+  for key, value in options:
+    f.write('%s %s\n' % (key, value))
+  f.close()
+
+  start = time.time()
+  proc = subprocess.Popen([exe, runfile], stdout=subprocess.PIPE, stderr=subprocess.STDOUT, env=env)
+  out = proc.communicate()[0].decode('utf-8', 'replace')
+  wall = time.time() - start
+
+  os.remove(runfile)
+  os.chdir(cwd)
+
+  if proc.returncode != 0:
+    print(out)
+    sys.exit('HiFiLES failed on %s/%s with %s' % (case_dir, infile, options))
+
+  # Last line of residual output, used to check all layouts give the same answer
+  res = ''
+  for line in out.splitlines():
+    words = line.split()
+    if len(words) > 1 and words[0].isdigit():
+      res = line.strip()
+
+  return wall, res
+
+#########################################################################
+
+def main():
+
+  exe = os.path.abspath(sys.argv[1]) if len(sys.argv) > 1 else os.path.abspath('../bin/HiFiLES')
+  widths = [int(w) for w in sys.argv[2].split(',')] if len(sys.argv) > 2 else [4, 8]
+
+  layouts = [('SoA', [('upts_layout', 0)])]
+  for w in widths:
+    layouts.append(('AoSoA-%d' % w, [('upts_layout', 1), ('aosoa_width', w)]))
+
+  print('%-36s %10s %12s %10s' % ('case', 'layout', 'wall (s)', 'speedup'))
+
+  for case_dir, infile in cases:
+    t_soa = None
+    res_soa = None
+    for name, options in layouts:
+      wall, res = run_case(exe, case_dir, infile, options)
+      if t_soa is None:
+        t_soa = wall
+        res_soa = res
+      print('%-36s %10s %12.3f %10.2f' % (case_dir, name, wall, t_soa/wall))
+      if res != res_soa:
+        print('  WARNING: residuals differ from the SoA run')
+        print('    SoA : ' + res_soa)
+        print('    %s: ' % name + res)
+
+if __name__ == "__main__":
+  main()
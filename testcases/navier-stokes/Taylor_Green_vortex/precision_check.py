@@ -0,0 +1,83 @@
+#!/usr/bin/env python
+
+# \file precision_check.py
+# \brief Validation of the mixed precision mode against double precision on the Taylor-Green vortex case
+#
+# Run from this directory:
+#
+#   python precision_check.py [path/to/HiFiLES] [input_file] [tolerance]
+#
+# The case is run with precision 0 and precision 1, appended to a copy of the input file, and the
+# integral quantities of history.plt (kinetic energy and enstrophy) are compared step by step. The
+# check fails if their largest relative difference is above tolerance (default 1e-5).
+
+import sys, os, time, subprocess
+
+def run_case(exe, infile, precision):
+  ##### Run the solver once and return the wall-clock time and the rows of history.plt
+  env = os.environ.copy()
+  if 'HIFILES_HOME' not in env:
+    env['HIFILES_HOME'] = os.path.abspath(os.path.join(os.getcwd(), '../../..'))
+
+  runfile = infile + '_precision'
+  f = open(runfile, 'w')
+  f.write(open(infile).read() + '\n')
+  f.write('precision %d\n' % precision)
+  f.close()
+
+  start = time.time()
+  proc = subprocess.Popen([exe, runfile], stdout=subprocess.PIPE, stderr=subprocess.STDOUT, env=env)
+  out = proc.communicate()[0].decode('utf-8', 'replace')
+  wall = time.time() - start
+
+  os.remove(runfile)
+
+  if proc.returncode != 0:
+    print(out)
+    sys.exit('HiFiLES failed with precision %d' % precision)
+
+  # Iteration, residuals, forces, integral quantities and times, one row per step
+  hist = {}
+  names = []
+  for line in open('history.plt'):
+    if line.startswith('VARIABLES'):
+      names = [w.strip().strip('"') for w in line.split('=', 1)[1].split(',')]
+    words = line.split(',')
+    if len(words) > 1 and words[0].strip().isdigit():
+      hist[int(words[0])] = [float(w) for w in words]
+
+  return wall, names, hist
+
+#########################################################################
+
+def main():
+
+  exe = os.path.abspath(sys.argv[1]) if len(sys.argv) > 1 else os.path.abspath('../../../bin/HiFiLES')
+  infile = sys.argv[2] if len(sys.argv) > 2 else 'input_TGV_SD_hex'
+  tol = float(sys.argv[3]) if len(sys.argv) > 3 else 1.e-5
+
+  t_dp, names, hist_dp = run_case(exe, infile, 0)
+  t_mp, names, hist_mp = run_case(exe, infile, 1)
+
+  cols = [i for i in range(len(names)) if names[i].startswith('Diagnostics')]
+
+  print('%8s' % 'step' + ''.join(['%16s' % names[i] for i in cols]) + '   (relative difference)')
+
+  max_diff = 0.
+  for step in sorted(hist_dp.keys()):
+    line = '%8d' % step
+    for i in cols:
+      d = abs(hist_mp[step][i] - hist_dp[step][i])/max(abs(hist_dp[step][i]), 1.e-300)
+      max_diff = max(max_diff, d)
+      line += '%16.3e' % d
+    print(line)
+
+  print('wall time: double %.3f s, mixed %.3f s, speedup %.2f' % (t_dp, t_mp, t_dp/t_mp))
+
+  if max_diff > tol:
+    sys.exit('FAILED: largest relative difference %.3e is above %.1e' % (max_diff, tol))
+
+  print('PASSED: largest relative difference %.3e' % max_diff)
+
+if __name__ == "__main__":
+  main()
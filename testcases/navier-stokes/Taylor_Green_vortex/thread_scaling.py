@@ -0,0 +1,90 @@
+#!/usr/bin/env python
+
+# \file thread_scaling.py
+# \brief Thread-scaling benchmark of the OpenMP CPU kernels on the Taylor-Green vortex case
+#
+# Build HiFiLES with OPENMP=YES in makefile.in, then run from this directory:
+#
+#   python thread_scaling.py [path/to/HiFiLES] [max_threads] [input_file]
+#
+# The solver is run once per thread count (1, 2, 4, ... max_threads) through
+# OMP_NUM_THREADS. Wall-clock time is measured here, since the solver's own
+# "Execution time" uses clock() and so adds up the CPU time of all threads.
+# The interface flux times the solver prints at the end are tabulated per
+# kind and type of interface as well.
+
+import sys, os, time, subprocess
+
+def run_case(exe, infile, n_threads):
+  ##### Run the solver once and return the wall-clock time, the final residual line and the interface flux times
+  env = os.environ.copy()
+  env['OMP_NUM_THREADS'] = str(n_threads)
+  if 'HIFILES_HOME' not in env:
+    env['HIFILES_HOME'] = os.path.abspath(os.path.join(os.getcwd(), '../../..'))
+
+  start = time.time()
+  proc = subprocess.Popen([exe, infile], stdout=subprocess.PIPE, stderr=subprocess.STDOUT, env=env)
+  out = proc.communicate()[0].decode('utf-8', 'replace')
+  wall = time.time() - start
+
+  if proc.returncode != 0:
+    print(out)
+    sys.exit('HiFiLES failed with %d threads' % n_threads)
+
+  # Last line of residual output, used to check all runs give the same answer
+  res = ''
+  inters = {}
+  for line in out.splitlines():
+    words = line.split()
+    if len(words) > 1 and words[0].isdigit():
+      res = line.strip()
+    # e.g. "  int quad n_inters=  12288  invFlux= 1.234 s  viscFlux= 2.345 s"
+    if len(words) == 10 and words[2] == 'n_inters=':
+      inters[words[0] + ' ' + words[1]] = (float(words[5]), float(words[8]))
+
+  return wall, res, inters
+
+#########################################################################
+
+def main():
+
+  exe = os.path.abspath(sys.argv[1]) if len(sys.argv) > 1 else os.path.abspath('../../../bin/HiFiLES')
+  max_threads = int(sys.argv[2]) if len(sys.argv) > 2 else 8
+  infile = sys.argv[3] if len(sys.argv) > 3 else 'input_TGV_SD_hex'
+
+  threads = []
+  n = 1
+  while n < max_threads:
+    threads.append(n)
+    n *= 2
+  threads.append(max_threads)
+
+  print('%8s %12s %10s %12s' % ('threads', 'wall (s)', 'speedup', 'efficiency'))
+
+  t_1 = None
+  res_1 = None
+  inters_all = []
+  for n in threads:
+    wall, res, inters = run_case(exe, infile, n)
+    inters_all.append(inters)
+    if t_1 is None:
+      t_1 = wall
+      res_1 = res
+    print('%8d %12.3f %10.2f %12.2f' % (n, wall, t_1/wall, t_1/wall/n))
+    if res != res_1:
+      print('  WARNING: residuals differ from the 1-thread run')
+      print('    1 thread : ' + res_1)
+      print('    %d threads: ' % n + res)
+
+  # Speedup of the flux evaluation of each kind and type of interface
+  print('')
+  print('%8s %10s %12s %10s %12s %10s' % ('threads', 'inters', 'invFlux (s)', 'speedup', 'viscFlux (s)', 'speedup'))
+  for name in sorted(inters_all[0].keys()):
+    inv_1, visc_1 = inters_all[0][name]
+    for n, inters in zip(threads, inters_all):
+      inv, visc = inters.get(name, (0., 0.))
+      print('%8d %10s %12.3f %10.2f %12.3f %10.2f' % (n, name, inv, inv_1/inv if inv > 0 else 0.,
+                                                     visc, visc_1/visc if visc > 0 else 0.))
+
+if __name__ == "__main__":
+  main()